@@ -0,0 +1,103 @@
+#ifndef ALERT_RULES_H
+#define ALERT_RULES_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+#include "timer_service.h"
+
+// Action routing flags
+#define ALERT_ACTION_LED 0x01   // Blink an overlay on the RGB LED while active
+#define ALERT_ACTION_WS  0x02   // Push an "alert" message to WebSocket clients
+#define ALERT_ACTION_LOG 0x04   // Append to the alert log and print to serial
+
+#define ALERT_LOG_SIZE 32
+
+enum AlertComparison {
+    ALERT_ABOVE,
+    ALERT_BELOW
+};
+
+enum AlertState {
+    ALERT_CLEAR,
+    ALERT_PENDING,   // Condition true, waiting out minDurationMs
+    ALERT_ACTIVE
+};
+
+struct AlertRule {
+    String name;
+    String metric;
+    AlertComparison comparison;
+    float threshold;
+    float hysteresis;           // Must cross back past threshold -/+ hysteresis to clear
+    unsigned long minDurationMs;
+    uint8_t actions;
+    uint32_t color;             // 0xRRGGBB for the LED overlay
+
+    // Runtime state
+    AlertState state;
+    unsigned long conditionSince;
+    float lastValue;
+    uint32_t pendingTimer;
+    uint32_t triggerCount;
+};
+
+struct AlertLogEntry {
+    unsigned long timestamp;
+    String rule;
+    bool raised;
+    float value;
+};
+
+struct AlertSample {
+    char metric[24];
+    float value;
+    unsigned long timestamp;
+};
+
+// (rule, raised, value) - raised is false when the alert clears
+typedef std::function<void(const AlertRule&, bool, float)> AlertActionHandler;
+
+class AlertRulesEngine {
+private:
+    std::vector<AlertRule> rules;
+    AlertLogEntry alertLog[ALERT_LOG_SIZE];
+    size_t logHead;
+    size_t logCount;
+    AlertActionHandler actionHandler;
+    TimerService* timers;
+    QueueHandle_t sampleQueue;
+
+    void evaluate(size_t index, float value, unsigned long now);
+    bool conditionMet(const AlertRule& rule, float value);
+    bool clearMet(const AlertRule& rule, float value);
+    void transition(AlertRule& rule, bool raised, float value, unsigned long now);
+    void cancelPending(AlertRule& rule);
+
+public:
+    AlertRulesEngine();
+    bool begin(TimerService* timerService);
+
+    // Rule management
+    void clearRules();
+    void addRule(const String& name, const String& metric, AlertComparison comparison,
+                 float threshold, float hysteresis, unsigned long minDurationMs,
+                 uint8_t actions, uint32_t color);
+    size_t getRuleCount();
+
+    // Sample input; onSample must be called from the loop task,
+    // postSample is safe from any task and is drained by processPending()
+    void onSample(const String& metric, float value);
+    bool postSample(const char* metric, float value);
+    void processPending();
+
+    void setActionHandler(AlertActionHandler handler);
+
+    // Status
+    bool isActive(const String& name);
+    bool getOverlayColor(uint32_t& color);
+    String getActiveAlertsJSON();
+    String getAlertLogJSON();
+};
+
+#endif // ALERT_RULES_H
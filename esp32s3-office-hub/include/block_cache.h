@@ -0,0 +1,84 @@
+#ifndef BLOCK_CACHE_H
+#define BLOCK_CACHE_H
+
+#include <Arduino.h>
+#include "block_device.h"
+
+#define BLOCK_CACHE_BYTES (128 * 1024)      // Sector slots, from PSRAM
+#define BLOCK_CACHE_RUN 16                  // Sectors per read-ahead window and per coalesced write
+#define BLOCK_CACHE_PROTECTED_PERCENT 50    // Slots FAT sectors may keep ahead of file data
+#define BLOCK_CACHE_DIRTY_PERCENT 50        // Write back once this share of slots is dirty
+
+struct BlockCacheStats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t readAheads;        // Windows fetched on sequential misses
+    uint32_t deviceReads;       // Read calls passed to the device
+    uint32_t writeBacks;        // Coalesced runs written to the device
+    uint32_t blocksWrittenBack;
+    uint32_t evictions;
+};
+
+// Write-back sector cache in front of a slow block device (a USB stick: every
+// command costs a CBW/data/CSW round trip). Sequential misses read a whole
+// window in one command, small writes stay dirty until sync or pressure and
+// go out as runs of adjacent sectors, and requests of a full window or more
+// bypass the slots. Sectors in the protected range (FATs, FAT16 root
+// directory) are evicted only after file data, so FAT walks stay in memory.
+class BlockCache : public BlockDevice {
+private:
+    struct Slot {
+        uint32_t block;
+        uint32_t lastUsed;
+        int16_t hashNext;
+        bool valid;
+        bool dirty;
+    };
+
+    BlockDevice* device;
+    uint16_t blockSize;
+    uint16_t slotCount = 0;
+    uint16_t bucketCount = 0;
+    uint8_t* data = nullptr;
+    uint8_t* staging = nullptr;
+    Slot* slots = nullptr;
+    int16_t* buckets = nullptr;
+    int16_t* order = nullptr;           // Scratch for sorting dirty slots
+    uint16_t dirtyCount = 0;
+    uint16_t protectedCount = 0;
+    uint32_t protectedStart = 0;
+    uint32_t protectedEnd = 0;
+    uint32_t clock = 0;
+    uint32_t nextSequential = UINT32_MAX;
+    SemaphoreHandle_t lock = NULL;
+    BlockCacheStats stats = {};
+
+    int16_t lookup(uint32_t block);
+    int16_t allocate(uint32_t block);
+    void unlink(int16_t slot);
+    void touch(int16_t slot);
+    bool isProtected(uint32_t block);
+    uint8_t* slotData(int16_t slot);
+    bool flushDirty();
+    void overlay(uint32_t block, uint8_t* buffer, uint32_t count);
+    void refresh(uint32_t block, const uint8_t* buffer, uint32_t count);
+
+public:
+    BlockCache(BlockDevice* inner);
+    ~BlockCache();
+
+    // Allocates the slots; false leaves the cache unusable
+    bool begin();
+    // Block range kept ahead of file data, usually FAT start to data start
+    void setProtectedRange(uint32_t start, uint32_t end);
+    const BlockCacheStats& getStats();
+
+    bool read(uint32_t block, uint8_t* buffer, uint32_t count) override;
+    bool write(uint32_t block, const uint8_t* buffer, uint32_t count) override;
+    bool sync() override;
+    uint32_t getBlockCount() override;
+    uint16_t getBlockSize() override;
+    bool isReady() override;
+};
+
+#endif // BLOCK_CACHE_H
@@ -0,0 +1,47 @@
+#ifndef BLOCK_DEVICE_H
+#define BLOCK_DEVICE_H
+
+#include <Arduino.h>
+#include <stdio.h>
+
+// Fixed-size block storage underneath the FAT layer
+class BlockDevice {
+public:
+    virtual ~BlockDevice() {}
+    virtual bool read(uint32_t block, uint8_t* buffer, uint32_t count) = 0;
+    virtual bool write(uint32_t block, const uint8_t* buffer, uint32_t count) = 0;
+    virtual bool sync() { return true; }
+    virtual uint32_t getBlockCount() = 0;
+    virtual uint16_t getBlockSize() = 0;
+    virtual bool isReady() = 0;
+};
+
+// Disk image in a regular file, so the FAT and file layers can run against
+// a known image on the host (or from another filesystem on the device)
+class FileBlockDevice : public BlockDevice {
+private:
+    FILE* file;
+    uint32_t blockCount;
+    uint16_t blockSize;
+
+public:
+    FileBlockDevice();
+    ~FileBlockDevice();
+
+    bool open(const char* path, uint16_t size = 512);
+    // Creates or truncates the image; blocks are zero until written
+    bool create(const char* path, uint32_t blocks, uint16_t size = 512);
+    void close();
+
+    bool read(uint32_t block, uint8_t* buffer, uint32_t count) override;
+    bool write(uint32_t block, const uint8_t* buffer, uint32_t count) override;
+    bool sync() override;
+    uint32_t getBlockCount() override;
+    uint16_t getBlockSize() override;
+    bool isReady() override;
+};
+
+// Routes FatFs physical drive pdrv to a block device; nullptr detaches it
+bool registerBlockDiskio(uint8_t pdrv, BlockDevice* device);
+
+#endif // BLOCK_DEVICE_H
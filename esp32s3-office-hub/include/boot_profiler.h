@@ -0,0 +1,42 @@
+#ifndef BOOT_PROFILER_H
+#define BOOT_PROFILER_H
+
+#include <Arduino.h>
+
+#define MAX_BOOT_PHASES 16
+#define MAX_BOOT_EVENTS 8
+
+struct BootMark {
+    const char* name;
+    uint32_t timestampMs;   // Since power-on (esp_timer), not since setup()
+};
+
+// Records boot phase boundaries and one-off asynchronous milestones
+class BootProfiler {
+private:
+    BootMark phases[MAX_BOOT_PHASES];
+    BootMark events[MAX_BOOT_EVENTS];
+    uint8_t phaseCount;
+    uint8_t eventCount;
+    uint32_t startMs;
+    portMUX_TYPE lock;
+
+    static uint32_t nowMs();
+
+public:
+    BootProfiler();
+    void begin();
+
+    // End of a sequential phase; its duration runs from the previous mark
+    void mark(const char* phase);
+
+    // First occurrence of an asynchronous milestone, safe from any task
+    void event(const char* name);
+    bool hasEvent(const char* name);
+    uint32_t getEventTime(const char* name);
+
+    String getReportJSON();
+    void printReport();
+};
+
+#endif // BOOT_PROFILER_H
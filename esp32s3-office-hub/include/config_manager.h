@@ -9,7 +9,7 @@
 class ConfigManager {
 private:
     Preferences preferences;
-    DynamicJsonDocument config;
+    JsonDocument config;
     
 public:
     ConfigManager();
@@ -46,12 +46,32 @@ public:
     void setHourlyAlertEnabled(bool enabled);
     float getTemperatureThreshold();
     void setTemperatureThreshold(float threshold);
+    float getLowTemperatureThreshold();
+    void setLowTemperatureThreshold(float threshold);
+    float getTemperatureHysteresis();
+    void setTemperatureHysteresis(float hysteresis);
+    unsigned long getAlertMinDuration();
+    void setAlertMinDuration(unsigned long duration);
+    float getTemperatureRateThreshold();
+    void setTemperatureRateThreshold(float rate);
+    bool getHighTempAlertEnabled();
+    void setHighTempAlertEnabled(bool enabled);
+    bool getLowTempAlertEnabled();
+    void setLowTempAlertEnabled(bool enabled);
+    bool getRateAlertEnabled();
+    void setRateAlertEnabled(bool enabled);
+    bool getWiFiDisconnectAlertEnabled();
+    void setWiFiDisconnectAlertEnabled(bool enabled);
     
     // Logging settings
     unsigned long getTempLogInterval();
     void setTempLogInterval(unsigned long interval);
     unsigned long getWiFiScanInterval();
     void setWiFiScanInterval(unsigned long interval);
+    
+    // Scheduled actions
+    JsonArray getSchedules();
+    void setSchedules(JsonArrayConst schedules);
 };
 
 #endif // CONFIG_MANAGER_H
@@ -0,0 +1,158 @@
+#ifndef HISTORY_STORE_H
+#define HISTORY_STORE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <SPIFFS.h>
+#include <functional>
+#include "usb_host.h"
+
+#define HISTORY_SEGMENT_RECORDS 720         // One hour at the 5 s reading interval
+#define HISTORY_FLUSH_RECORDS 60            // Buffered in RAM, appended to flash in one write
+#define HISTORY_FLASH_SEGMENTS 96           // Sealed segments kept in SPIFFS; the oldest is dropped past this
+#define HISTORY_ARCHIVE_BATCH 4             // Segments moved to the stick per archive() call
+#define HISTORY_QUERY_POINTS 500            // Buckets for a query without a step
+#define HISTORY_QUERY_MAX_POINTS 2000
+#define HISTORY_FLASH_DIR "/history"
+#define HISTORY_USB_DIR "/history"
+#define HISTORY_SEGMENT_MAGIC 0x31534854    // "THS1"
+// Header plus the worst case of a 5-byte time delta and a 3-byte value delta per record
+#define HISTORY_SEGMENT_MAX_BYTES (sizeof(HistorySegmentHeader) + HISTORY_SEGMENT_RECORDS * 8)
+
+// Times are the hub's local epoch seconds, values hundredths of a degree
+struct __attribute__((packed)) HistoryRecord {
+    uint32_t time;
+    int16_t value;
+};
+
+// Sealed segment: this header, then one varint pair per record after the
+// first: the change in time step and the change in value, both zigzagged.
+// Readings on a steady interval that move by under 0.64 degrees take two bytes.
+struct __attribute__((packed)) HistorySegmentHeader {
+    uint32_t magic;
+    uint32_t firstTime;
+    uint32_t lastTime;
+    uint16_t count;
+    int16_t firstValue;
+    int16_t minValue;
+    int16_t maxValue;
+    int16_t meanValue;
+    uint16_t payloadBytes;
+    uint16_t checksum;          // Fletcher-16 of the payload
+};
+
+// One record of the stick's index file per archived segment, in archive order
+struct __attribute__((packed)) HistoryIndexEntry {
+    HistorySegmentHeader header;
+    uint32_t offset;            // Into the month's archive file, named from firstTime
+};
+
+struct HistoryStats {
+    uint32_t records;
+    uint32_t unclocked;         // Readings taken before the wall clock was known, not stored
+    uint32_t sealed;
+    uint32_t archived;
+    uint32_t dropped;           // Sealed segments lost to a full flash ring with no stick
+    uint32_t corrupt;           // Segments that failed their checksum on read
+    uint64_t flashBytes;        // Written to SPIFFS
+    uint64_t usbBytes;          // Written to the stick
+    uint64_t rawBytes;          // Records sealed, at sizeof(HistoryRecord) each
+    uint64_t sealedBytes;       // The same records once encoded
+};
+
+// Long-term temperature history in three tiers. New readings collect in RAM
+// and are appended to an open segment in SPIFFS a batch at a time; a full
+// segment is encoded and sealed into a ring of flash slots. While a stick is
+// mounted, archive() moves sealed segments, oldest first, into monthly
+// archive files on it and appends their headers to an index. Queries merge
+// the stick, flash and RAM in time order; a segment that falls inside one
+// bucket is answered from its header without being read.
+class HistoryStore {
+private:
+    struct FlashSegment {
+        HistorySegmentHeader header;
+        uint8_t slot;
+    };
+
+    struct Bucket {
+        int64_t sum;
+        uint32_t count;
+        int16_t minValue;
+        int16_t maxValue;
+    };
+
+    USBHostManager* usb = nullptr;
+    SemaphoreHandle_t lock = NULL;
+    HistoryRecord pending[HISTORY_FLUSH_RECORDS];
+    uint16_t pendingCount = 0;
+    uint16_t openCount = 0;                 // Records in the open segment file
+    FlashSegment flash[HISTORY_FLASH_SEGMENTS];
+    uint8_t flashCount = 0;                 // Oldest first
+    uint8_t nextSlot = 0;
+    uint8_t* work = nullptr;                // One encoded segment, then room for its records; PSRAM
+    HistoryRecord* records = nullptr;       // Inside work
+    uint32_t newestTime = 0;
+    HistoryStats stats = {};
+
+    // Query state, valid while a query holds the lock
+    JsonArray points;
+    uint32_t queryFrom = 0;
+    uint32_t queryTo = 0;
+    uint32_t queryStep = 0;
+    uint32_t bucketIndex = 0;
+    uint32_t lastAdded = 0;                 // Tiers may overlap after an interrupted archive
+    Bucket bucket = {};
+    uint32_t decoded = 0;
+    uint32_t summarized = 0;
+
+    String slotPath(uint8_t slot);
+    String openPath();
+    static String archivePath(uint32_t firstTime);
+    static String indexPath();
+
+    void flushPending();
+    bool seal();
+    bool writeSlot(const uint8_t* data, size_t length);
+    bool readSlot(uint8_t index, size_t* length);
+    bool archiveOne();
+    uint32_t readIndexCount();
+    bool readIndex(uint32_t first, HistoryIndexEntry* entries, uint32_t count);
+
+    void beginQuery(JsonArray target, uint32_t from, uint32_t to, uint32_t step);
+    void addRecord(uint32_t time, int16_t value);
+    void addSummary(const HistorySegmentHeader& header);
+    void emitBucket();
+    int classify(const HistorySegmentHeader& header);
+    bool addSegment(const uint8_t* data, size_t length);
+    void queryUsb();
+    void queryFlash();
+    uint32_t queryRecent();
+
+public:
+    ~HistoryStore();
+
+    // Recovers sealed slots and the open segment from SPIFFS
+    bool begin(USBHostManager* usbManager);
+    // Readings with time 0 (no wall clock yet) are counted and dropped
+    void append(uint32_t time, float temperature);
+    // Writes buffered readings to flash, e.g. before a restart
+    void flush();
+    // Moves up to HISTORY_ARCHIVE_BATCH sealed segments to the stick; loop context
+    void archive();
+
+    // Bucketed readings in [from, to]; step 0 picks one giving
+    // HISTORY_QUERY_POINTS buckets. False if the range needs more than
+    // HISTORY_QUERY_MAX_POINTS buckets.
+    bool query(JsonDocument& doc, uint32_t from, uint32_t to, uint32_t step);
+    uint32_t getNewestTime();
+    const HistoryStats& getStats();
+    String getStatusJSON();
+
+    // Segment codec, shared with the flash and stick tiers
+    static size_t encode(const HistoryRecord* records, uint16_t count, uint8_t* out);
+    // Calls fn(time, value) per record; false on a bad header or checksum
+    static bool decode(const uint8_t* data, size_t length, std::function<void(uint32_t, int16_t)> fn);
+    static uint16_t checksum(const uint8_t* data, size_t length);
+};
+
+#endif // HISTORY_STORE_H
@@ -0,0 +1,57 @@
+#ifndef LARGE_LED_H
+#define LARGE_LED_H
+
+#include <Arduino.h>
+#include <driver/ledc.h>
+#include <functional>
+
+#define LARGE_LED_LEDC_MODE LEDC_LOW_SPEED_MODE
+#define LARGE_LED_LEDC_TIMER LEDC_TIMER_0
+#define LARGE_LED_LEDC_CHANNEL LEDC_CHANNEL_0 // analogWrite hands out channels from the top down
+#define LARGE_LED_PWM_BITS 13                 // 80 MHz APB / 2^13 leaves room for 5 kHz
+#define LARGE_LED_PWM_FREQ 5000
+#define LARGE_LED_MAX_DUTY ((1 << LARGE_LED_PWM_BITS) - 1)
+#define LARGE_LED_GAMMA 2.2f
+#define LARGE_LED_FADE_MS 300          // On/off
+#define LARGE_LED_DIM_MS 120           // Brightness changes while on
+
+typedef std::function<void(uint8_t brightness)> LargeLedFadeCallback;
+
+// PWM LED dimmed by the LEDC fade engine; once a fade starts the hardware
+// steps the duty cycle and raises an interrupt at the end, no CPU in between.
+// fadeTo() may be called from any task: it only records the target, and the
+// fade is started by update() on the task that owns the LED.
+class LargeLed {
+private:
+    uint8_t pin;
+    bool ready;
+    uint8_t brightness;        // Target brightness of the current fade, 0-255 perceived
+    bool fading;
+    portMUX_TYPE requestLock;  // Guards the three fields below
+    bool pendingFade;          // A newer target waiting for update()
+    uint8_t pendingBrightness;
+    uint32_t pendingFadeMs;
+    volatile bool fadeEnded;   // Set from the fade-end interrupt
+    LargeLedFadeCallback fadeCallback;
+
+    static bool onFadeEndISR(const ledc_cb_param_t* param, void* arg);
+    void startFade(uint8_t target, uint32_t fadeMs);
+
+public:
+    LargeLed(uint8_t gpio);
+    bool begin();
+    void update();
+
+    // Fades to a perceived brightness from the next update(); 0 ms sets it without a fade
+    void fadeTo(uint8_t target, uint32_t fadeMs = LARGE_LED_FADE_MS);
+    uint8_t getBrightness();
+    uint32_t getDuty();
+    bool isFading();
+
+    // Runs from update(), not the interrupt, after each fade reaches its target
+    void onFadeComplete(LargeLedFadeCallback callback);
+
+    static uint32_t brightnessToDuty(uint8_t brightness);
+};
+
+#endif // LARGE_LED_H
@@ -0,0 +1,96 @@
+#ifndef LED_COMPOSITOR_H
+#define LED_COMPOSITOR_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <FastLED.h>
+
+#define NUM_RGB_LEDS 300
+#define MAX_LED_SEGMENTS 8
+#define LED_SEGMENT_NAME_LEN 12
+
+// WS2812 wire time: 24 bits at 800 kHz per pixel plus the latch gap
+#define LED_WIRE_US_PER_PIXEL 30
+#define LED_LATCH_US 50
+
+// Bottom to top; each layer is blended over the ones below it
+enum LedLayerId {
+    LAYER_BASE,
+    LAYER_ALERT,
+    LAYER_STATUS,
+    LAYER_COUNT
+};
+
+// A named run of pixels, e.g. "desk" or "status"
+struct LedSegment {
+    char name[LED_SEGMENT_NAME_LEN];
+    uint16_t start;
+    uint16_t count;
+};
+
+struct LedLayer {
+    CRGB pixels[NUM_RGB_LEDS];
+    bool visible;
+    uint8_t opacity;           // 255 covers the layers below, black pixels are always transparent
+};
+
+struct CompositorStats {
+    uint32_t frames;           // Frames composed
+    uint32_t shown;            // Frames pushed to the strip
+    uint32_t skipped;          // Frames identical to the last one shown
+    uint32_t lastComposeUs;    // Render, blend and hash time per frame
+    uint32_t maxComposeUs;
+    uint64_t totalComposeUs;
+    uint64_t totalShowUs;
+    unsigned long startTime;
+};
+
+// Blends the layers into the FastLED frame buffer and only calls show()
+// when the composed frame differs from the one already on the strip
+class LedCompositor {
+private:
+    CRGB* output;
+    uint16_t length;
+    LedLayer layers[LAYER_COUNT];
+    LedSegment segments[MAX_LED_SEGMENTS];
+    uint8_t segmentCount;
+    uint32_t lastHash;
+    bool forceShow;
+    CompositorStats stats;
+
+    static uint32_t hashFrame(const CRGB* pixels, uint16_t count);
+
+public:
+    LedCompositor();
+    void begin(CRGB* frame, uint16_t count);
+
+    // Layers
+    CRGB* getLayer(LedLayerId id);
+    void setLayerVisible(LedLayerId id, bool visible);
+    bool isLayerVisible(LedLayerId id);
+    void setLayerOpacity(LedLayerId id, uint8_t opacity);
+    void fillLayer(LedLayerId id, const CRGB& color);
+    void fillSegment(LedLayerId id, int segment, const CRGB& color);
+
+    // Segments
+    int addSegment(const char* name, uint16_t start, uint16_t count);
+    int findSegment(const String& name);
+    const LedSegment* getSegment(int index);
+    uint8_t getSegmentCount();
+
+    // Frames
+    void compose();
+    bool present();            // Compose and show; false if the frame was unchanged
+    bool present(unsigned long frameStartUs); // Frame cost counted from when the caller began rendering
+    void invalidate();         // Show the next frame even if it matches, e.g. after a brightness change
+    uint16_t getLength();
+
+    const CompositorStats& getStats();
+    void resetStats();
+    float getFramesPerSecond();
+    float getCpuPercent(uint16_t targetFps);
+    void writeStats(JsonObject doc);
+    String getStatsJSON();
+};
+
+#endif // LED_COMPOSITOR_H
@@ -3,11 +3,16 @@
 
 #include <Arduino.h>
 #include <FastLED.h>
+#include "large_led.h"
+#include "led_compositor.h"
+#include "led_effects.h"
+#include "led_sequence.h"
 
 #define RGB_LED_PIN 48
 #define LARGE_LED_PIN 47
-#define NUM_RGB_LEDS 1
 #define ONBOARD_LED 2
+#define LED_TARGET_FPS 60
+#define LED_FRAME_INTERVAL_MS (1000 / LED_TARGET_FPS)
 
 enum LEDMode {
     SOLID,
@@ -18,20 +23,42 @@ enum LEDMode {
     FADE
 };
 
+// Base effect state for one strip segment
+struct LedZoneState {
+    LEDMode mode;
+    CRGB color;
+    unsigned long startTime;
+};
+
+// Play request handed from the web task to the loop; an empty name stops playback
+struct LedSeqRequest {
+    char name[LEDSEQ_NAME_LEN + 1];
+};
+
 class LEDController {
 private:
     CRGB rgbLeds[NUM_RGB_LEDS];
+    LedCompositor compositor;
+    LedZoneState zones[MAX_LED_SEGMENTS];
+    int statusSegment;
+    LedSequence sequence;
+    QueueHandle_t sequenceQueue;
+    LargeLed largeLed;
     bool largeLedState;
     uint8_t largeLedBrightness;
     uint8_t rgbBrightness;
     LEDMode currentMode;
     CRGB currentColor;
-    uint8_t hue;
-    uint8_t breathingBrightness;
-    int8_t breathingDirection;
-    bool blinkState;
+    unsigned long modeStartTime;
     unsigned long lastUpdate;
     unsigned long modeUpdateInterval;
+    bool overlayActive;
+    CRGB overlayColor;
+    unsigned long overlayStartTime;
+    
+    void renderBaseLayer(unsigned long now);
+    void processSequenceRequests();
+    void fillStrip(const CRGB& color);
     
 public:
     LEDController();
@@ -52,12 +79,30 @@ public:
     String getModeString();
     void setModeUpdateInterval(unsigned long interval);
     
+    // Zones are named strip segments with their own mode and colour
+    bool setZoneColor(const String& zone, CRGB color);
+    bool setZoneMode(const String& zone, LEDMode mode);
+    
+    // Status indicator, drawn over the "status" zone above alerts
+    void setStatusIndicator(CRGB color);
+    void clearStatusIndicator();
+    
+    // Uploaded bytecode sequences drawn on the base layer in place of the zone modes
+    bool playSequence(const String& name, String& error);
+    bool requestSequence(const String& name);   // Safe from any task, applied on the next frame
+    void stopSequence();
+    bool isSequencePlaying();
+    
+    LedCompositor& getCompositor();
+    String getStripJSON();
+    
     // Large LED control
     void setLargeLedState(bool state);
     bool getLargeLedState();
     void setLargeLedBrightness(uint8_t brightness);
     uint8_t getLargeLedBrightness();
     void toggleLargeLed();
+    void onLargeLedFadeComplete(LargeLedFadeCallback callback);
     
     // Onboard LED
     void setOnboardLed(bool state);
@@ -69,13 +114,16 @@ public:
     void setAllOff();
     void flashAlert(CRGB color = CRGB::Red, int times = 3);
     
-    // Animation methods
-    void updateSolidMode();
-    void updateBlinkMode();
-    void updatePulseMode();
-    void updateRainbowMode();
-    void updateBreathingMode();
-    void updateFadeMode();
+    // Non-blocking alert overlay, blinks over the current mode until cleared
+    void setAlertOverlay(CRGB color);
+    void clearAlertOverlay();
+    bool hasAlertOverlay();
+    
+    // Pixel for a mode at a given time since the mode started, no hardware access
+    static CRGB renderMode(LEDMode mode, uint32_t elapsedMs, const CRGB& color);
+    static bool parseMode(const String& modeStr, LEDMode& mode);
+    static const char* modeName(LEDMode mode);
+    static int findZone(const String& name);   // Index in the default zone table, -1 if unknown
 };
 
 #endif // LED_CONTROLLER_H
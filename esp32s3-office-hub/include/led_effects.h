@@ -0,0 +1,60 @@
+#ifndef LED_EFFECTS_H
+#define LED_EFFECTS_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+// Effect periods; every effect is a pure function of time since the mode started
+#define EFFECT_BLINK_PERIOD_MS 1000
+#define EFFECT_PULSE_PERIOD_MS 2000
+#define EFFECT_BREATHING_PERIOD_MS 5000
+#define EFFECT_RAINBOW_PERIOD_MS 6400
+#define EFFECT_FADE_STEP_MS 1000
+#define EFFECT_OVERLAY_PERIOD_MS 1000
+
+// 8-bit fixed-point curves in the style of FastLED's lib8tion
+namespace LedCurves {
+
+extern const uint8_t sineTable[256];
+extern const uint8_t gammaTable[256];
+extern const uint8_t easeInOutTable[256];
+
+// One full sine period over 0-255, centred on 128
+inline uint8_t sin8(uint8_t theta) { return sineTable[theta]; }
+
+// Gamma 2.2, maps linear brightness to perceived brightness
+inline uint8_t gamma8(uint8_t value) { return gammaTable[value]; }
+
+// Cubic ease-in-out, 0 -> 0 and 255 -> 255
+inline uint8_t ease8InOut(uint8_t t) { return easeInOutTable[t]; }
+
+// 0 -> 254 -> 0 over one cycle
+inline uint8_t triwave8(uint8_t t) { return t < 128 ? t * 2 : (255 - t) * 2; }
+
+inline uint8_t scale8(uint8_t value, uint8_t scale) { return ((uint16_t)value * (1 + scale)) >> 8; }
+
+// Position within a repeating period as 0-255
+inline uint8_t phase8(uint32_t elapsedMs, uint32_t periodMs) {
+    return (uint8_t)(((elapsedMs % periodMs) << 8) / periodMs);
+}
+
+} // namespace LedCurves
+
+namespace LedEffects {
+
+CRGB scale(const CRGB& color, uint8_t brightness);
+CRGB blend(const CRGB& from, const CRGB& to, uint8_t amount);
+
+CRGB solid(uint32_t elapsedMs, const CRGB& color);
+CRGB blink(uint32_t elapsedMs, const CRGB& color);
+CRGB pulse(uint32_t elapsedMs, const CRGB& color);
+CRGB breathing(uint32_t elapsedMs, const CRGB& color);
+CRGB rainbow(uint32_t elapsedMs, const CRGB& color);
+CRGB fade(uint32_t elapsedMs, const CRGB& color);
+
+// Alert overlay blink; false means the frame shows the underlying effect
+bool overlayVisible(uint32_t elapsedMs);
+
+} // namespace LedEffects
+
+#endif // LED_EFFECTS_H
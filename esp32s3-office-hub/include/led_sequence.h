@@ -0,0 +1,132 @@
+#ifndef LED_SEQUENCE_H
+#define LED_SEQUENCE_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "led_compositor.h"
+
+// Bytecode layout, little-endian:
+//   "LSQ" version:u8 tracks:u8 palette:u8 codeLength:u16
+//   trackOffset:u16 * tracks        (into the code section)
+//   r,g,b * palette
+//   code
+#define LEDSEQ_VERSION 1
+#define LEDSEQ_HEADER_SIZE 8
+#define LEDSEQ_MAX_SIZE 2048
+#define LEDSEQ_MAX_TRACKS 4
+#define LEDSEQ_MAX_PALETTE 16
+#define LEDSEQ_MAX_LOOP_DEPTH 4
+#define LEDSEQ_STEPS_PER_FRAME 16      // Instructions a track may run per frame before yielding
+#define LEDSEQ_ALL_SEGMENTS 0xFF
+#define LEDSEQ_NAME_LEN 16             // SPIFFS paths stop at 31 characters
+#define LEDSEQ_DIR "/sequences"
+
+enum LedSeqOpcode : uint8_t {
+    LEDSEQ_END = 0x00,      //                          track stops, pixels hold
+    LEDSEQ_SEGMENT = 0x01,  // segment:u8               0xFF targets the whole strip
+    LEDSEQ_SET = 0x02,      // color:u8                 palette index
+    LEDSEQ_RGB = 0x03,      // r:u8 g:u8 b:u8
+    LEDSEQ_FADE = 0x04,     // color:u8 ms:u16 ease:u8  keyframe from the current colour
+    LEDSEQ_WAIT = 0x05,     // ms:u16
+    LEDSEQ_LOOP = 0x06,     // count:u8                 0 repeats forever
+    LEDSEQ_NEXT = 0x07,     //                          back to the matching LOOP
+    LEDSEQ_GRADIENT = 0x08, // from:u8 to:u8            palette gradient along the segment
+    LEDSEQ_EFFECT = 0x09,   // mode:u8 color:u8 ms:u16  built-in LEDMode for ms
+    LEDSEQ_OPCODE_COUNT
+};
+
+enum LedSeqDisplay : uint8_t {
+    LEDSEQ_SHOW_COLOR,
+    LEDSEQ_SHOW_GRADIENT
+};
+
+enum LedSeqEase : uint8_t {
+    LEDSEQ_EASE_LINEAR = 0,
+    LEDSEQ_EASE_IN_OUT = 1,
+    LEDSEQ_EASE_STEP = 2
+};
+
+struct LedSeqLoop {
+    uint16_t start;            // Offset of the first instruction in the body
+    uint8_t remaining;         // 0 = forever
+};
+
+struct LedSeqTrack {
+    uint16_t pc;
+    bool running;
+    uint8_t segment;
+    CRGB color;                // Colour when the current keyframe started
+    CRGB target;
+    CRGB gradientTo;           // Second stop when showing a gradient from color
+    uint8_t display;
+    uint8_t op;                // Timed opcode in progress, LEDSEQ_END if none
+    uint8_t ease;
+    uint8_t effectMode;
+    uint32_t opStart;
+    uint32_t opDuration;
+    LedSeqLoop loops[LEDSEQ_MAX_LOOP_DEPTH];
+    uint8_t loopDepth;
+};
+
+struct LedSeqStats {
+    uint32_t frames;
+    uint32_t steps;            // Instructions executed
+    uint32_t maxStepsPerFrame;
+    uint32_t budgetHits;       // Frames where a track yielded on LEDSEQ_STEPS_PER_FRAME
+    uint64_t totalCycles;
+    uint32_t maxCycles;
+};
+
+// Validated bytecode plus an interpreter that writes each track's segment
+// into a compositor layer. Every instruction is checked once on load, so
+// the per-frame loop runs without bounds checks.
+class LedSequence {
+private:
+    uint8_t program[LEDSEQ_MAX_SIZE];
+    uint16_t programSize;
+    String name;
+    const uint8_t* code;
+    uint16_t codeLength;
+    CRGB palette[LEDSEQ_MAX_PALETTE];
+    uint8_t paletteCount;
+    uint8_t trackCount;
+    LedSeqTrack tracks[LEDSEQ_MAX_TRACKS];
+    bool loaded;
+    bool playing;
+    LedSeqStats stats;
+
+    bool stepTrack(LedSeqTrack& track, uint32_t now, uint32_t& steps);
+    void renderTrack(LedSeqTrack& track, uint32_t now, LedCompositor& compositor, LedLayerId layer);
+    void fillTarget(const LedSeqTrack& track, LedCompositor& compositor, LedLayerId layer, const CRGB& color);
+
+public:
+    LedSequence();
+
+    // Copies and validates a program; on failure error says why
+    bool load(const uint8_t* data, size_t size, const String& sequenceName, String& error);
+    bool loadFile(const String& sequenceName, String& error);
+    static bool saveFile(const String& sequenceName, const uint8_t* data, size_t size);
+    static bool removeFile(const String& sequenceName);
+    static bool isValidName(const String& sequenceName);
+    static String pathFor(const String& sequenceName);
+    static bool validate(const uint8_t* data, size_t size, String& error);
+
+    void start(uint32_t now);
+    void stop();
+    bool isPlaying();
+    const String& getName();
+    uint16_t getSize();
+
+    // Advances every track to now and draws into the layer; false once all tracks ended
+    bool render(uint32_t now, LedCompositor& compositor, LedLayerId layer);
+
+    const LedSeqStats& getStats();
+    void resetStats();
+
+    static uint8_t instructionLength(uint8_t opcode);
+    static const char* opcodeName(uint8_t opcode);
+    static String disassemble(const uint8_t* data, size_t size);
+    static bool fromHex(const String& hex, uint8_t* out, size_t capacity, size_t& length);
+};
+
+#endif // LED_SEQUENCE_H
@@ -0,0 +1,117 @@
+#ifndef MEMORY_POLICY_H
+#define MEMORY_POLICY_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#define MAX_TASK_ARENAS 4
+#define ARENA_TASK_NAME_LEN 16
+#define TASK_ARENA_SIZE 20480       // Per-task JSON arena, carved from PSRAM; see ArenaAllocator
+#define WS_BUFFER_COUNT 4
+#define WS_BUFFER_SIZE 4096
+#define HEAP_HISTORY_SIZE 60
+
+struct AllocatorStats {
+    uint32_t allocations;
+    uint32_t fallbacks;        // Requests that could not be served from the preferred region
+    size_t bytesInUse;
+    size_t peakBytes;
+};
+
+// Sends allocations to PSRAM, falls back to internal RAM if PSRAM is absent or full
+class PsramAllocator : public ArduinoJson::Allocator {
+private:
+    AllocatorStats stats;
+
+public:
+    PsramAllocator();
+    void* allocate(size_t size) override;
+    void deallocate(void* ptr) override;
+    void* reallocate(void* ptr, size_t newSize) override;
+    const AllocatorStats& getStats();
+};
+
+// Bump allocator over a fixed buffer that rewinds once every block is released.
+// Space freed below the newest block, or left behind when an older block grows,
+// is only reclaimed at that rewind. TASK_ARENA_SIZE covers the largest message
+// the loop task handles (get_timers, with the incoming message still parsed:
+// about 17 KB in the native bench); anything that does not fit goes to the
+// PSRAM heap and is counted as an overflow in /api/memory.
+class ArenaAllocator final : public ArduinoJson::Allocator {
+private:
+    uint8_t* base;
+    size_t capacity;
+    size_t offset;
+    size_t lastOffset;         // Start of the most recent block, SIZE_MAX if unknown
+    uint32_t outstanding;
+    ArduinoJson::Allocator* fallback;
+    AllocatorStats stats;
+
+    bool owns(void* ptr);
+
+public:
+    ArenaAllocator(uint8_t* buffer, size_t size, ArduinoJson::Allocator* overflow);
+    void* allocate(size_t size) override;
+    void deallocate(void* ptr) override;
+    void* reallocate(void* ptr, size_t newSize) override;
+    const AllocatorStats& getStats();
+    size_t getCapacity();
+    bool isEmpty();
+};
+
+// Fixed set of reusable serialization buffers for WebSocket messages
+class BufferPool {
+private:
+    char* buffers[WS_BUFFER_COUNT];
+    uint32_t inUse;
+    portMUX_TYPE lock;
+    uint32_t misses;
+
+public:
+    BufferPool();
+    bool begin();
+    char* acquire();
+    void release(char* buffer);
+    size_t getBufferSize();
+    uint32_t getMisses();
+};
+
+struct HeapSample {
+    unsigned long timestamp;
+    uint32_t internalFree;
+    uint32_t internalLargest;
+    uint32_t psramFree;
+};
+
+// Periodic record of internal heap size and largest free block
+class HeapMonitor {
+private:
+    HeapSample history[HEAP_HISTORY_SIZE];
+    size_t head;
+    size_t count;
+    uint32_t minLargestBlock;
+
+public:
+    HeapMonitor();
+    void sample();
+    float getFragmentation();
+    uint32_t getMinLargestBlock();
+    String getHistoryJSON();
+};
+
+class MemoryPolicy {
+public:
+    static bool begin();
+
+    // Allocator for JSON documents built on the calling task
+    static ArduinoJson::Allocator* json();
+    // Gives the calling task's arena back; call before a task that used json() deletes itself
+    static void releaseTaskArena();
+    static PsramAllocator* psram();
+    static BufferPool& wsBuffers();
+    static HeapMonitor& heap();
+
+    static String getStatsJSON();
+};
+
+#endif // MEMORY_POLICY_H
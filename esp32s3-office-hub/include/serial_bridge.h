@@ -0,0 +1,117 @@
+#ifndef SERIAL_BRIDGE_H
+#define SERIAL_BRIDGE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <atomic>
+#include <functional>
+#include <usb_acm.hpp>
+#include "spsc_ring.h"
+#include "timer_service.h"
+
+#define SERIAL_RING_SIZE 8192           // Each direction
+#define SERIAL_PACKET_SIZE 64           // Full-speed bulk packet; the most OUTDATA takes
+#define SERIAL_READ_SIZE 512            // Per IN transfer; a short packet ends it early
+#define SERIAL_FLUSH_BYTES 512          // Send to clients once this much is buffered...
+#define SERIAL_FLUSH_US 2000            // ...or the oldest buffered byte is this old
+#define SERIAL_DEFAULT_BAUD 115200
+
+// CDC SET_LINE_CODING fields
+struct SerialLineCoding {
+    uint32_t baud;
+    uint8_t dataBits;       // 5-8 or 16
+    uint8_t parity;         // 0 none, 1 odd, 2 even, 3 mark, 4 space
+    uint8_t stopBits;       // 0 = 1, 1 = 1.5, 2 = 2
+};
+
+struct SerialBridgeStats {
+    uint64_t bytesIn;           // Device to clients
+    uint64_t bytesOut;          // Clients to device
+    uint32_t packetsIn;
+    uint32_t packetsOut;
+    uint32_t frames;            // WebSocket frames sent
+    uint32_t flushes;
+    uint32_t deferred;          // Flushes put off because a client could not take more
+    uint32_t stalls;            // IN transfers held back while the receive ring was full
+    uint32_t dropped;           // Client bytes lost to a full transmit ring
+    uint64_t latencyTotalUs;    // Age of the oldest byte at each flush
+    uint32_t latencyMaxUs;
+};
+
+// Returns false when the clients cannot take data right now; the bytes stay
+// buffered and are offered again later
+typedef std::function<bool(const uint8_t* data, size_t length)> SerialOutput;
+
+// Bridges one CDC-ACM device to WebSocket clients. Device data lands in the
+// receive ring from the library's client task and is flushed to the output
+// from the loop in batches; client data goes through the transmit ring to the
+// device one bulk packet at a time. A full receive ring stops IN transfers,
+// so a slow client pushes back to the device instead of losing data.
+class SerialBridge {
+private:
+    SpscRing rx;                            // Client task -> loop
+    SpscRing tx;                            // Web server task -> whoever holds writeBusy
+    USBacmDevice* volatile device = nullptr;
+    volatile bool ready = false;            // Line coding applied, data may flow
+    std::atomic<bool> readBusy{false};      // An IN transfer is submitted
+    std::atomic<bool> writeBusy{false};     // An OUT transfer is in flight; its owner consumes tx
+    std::atomic<bool> controlBusy{false};   // The device's one control transfer is in use
+    std::atomic<uint8_t> controlPending{0};
+    std::atomic<uint32_t> firstByteUs{0};   // Arrival of the oldest buffered byte
+    std::atomic<uint32_t> lastByteUs{0};
+    size_t writeLength = 0;
+    bool deferred = false;
+    uint32_t deferredAtUs = 0;
+    uint32_t attachedAtMs = 0;
+    uint64_t sessionIn = 0;                 // Counters at attach, for per-device rates
+    uint64_t sessionOut = 0;
+    SemaphoreHandle_t lock = NULL;          // Line coding and control lines
+    SerialLineCoding coding = {SERIAL_DEFAULT_BAUD, 8, 0, 0};
+    bool dtr = true;
+    bool rts = true;
+    TimerService* timers = nullptr;
+    SerialOutput output;
+    SerialBridgeStats stats = {};
+
+    static void eventCallback(int event, void* data, size_t length);
+
+    void onData(const uint8_t* data, size_t length);
+    void onWritten();
+    void onControl();
+    void submitRead();
+    void submitWrite();
+    void submitControl();
+    void flush(uint32_t nowUs);
+
+public:
+    bool begin(TimerService* timerService);
+    void onOutput(SerialOutput callback);
+
+    // Called by the USB host manager: attach on its task once the device is
+    // enumerated, detach from the client task when it goes away
+    void attach(USBacmDevice* acm);
+    void detach();
+    bool isConnected();
+
+    // Queues client bytes for the device; returns how many fit
+    size_t write(const uint8_t* data, size_t length);
+    // Applied now if a device is attached, and to every device after it
+    bool setLineCoding(const SerialLineCoding& lineCoding);
+    void setControlLines(bool dtrState, bool rtsState);
+    SerialLineCoding getLineCoding();
+
+    // Loop context: flushes once SERIAL_FLUSH_BYTES are buffered or the
+    // oldest byte reaches SERIAL_FLUSH_US
+    void service();
+    // How long the loop may sleep before service() has work, capped at maxMs
+    uint32_t getMsUntilFlush(uint32_t maxMs);
+
+    const SerialBridgeStats& getStats();
+    String getStatusJSON();
+
+    static const char* parityName(uint8_t parity);
+    // -1 for an unknown name
+    static int parseParity(const String& name);
+};
+
+#endif // SERIAL_BRIDGE_H
@@ -0,0 +1,46 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// Lock-free byte ring for exactly one producer task and one consumer task.
+// Both sides work on contiguous spans inside the ring: the producer reserves
+// free space, fills it in place and commits; the consumer peeks at buffered
+// bytes, hands them on and consumes. Positions are free-running counters, so
+// full and empty need no spare byte. Capacity is a power of two.
+class SpscRing {
+private:
+    uint8_t* buffer = nullptr;
+    size_t mask = 0;
+    std::atomic<size_t> head{0};    // Written by the producer only
+    std::atomic<size_t> tail{0};    // Written by the consumer only
+
+public:
+    SpscRing() {}
+    ~SpscRing();
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Capacity is rounded up to a power of two; the buffer comes from PSRAM
+    bool begin(size_t capacity);
+    size_t capacity() const { return mask + 1; }
+
+    // Producer side. reserve() returns the contiguous free span, which may be
+    // shorter than space() when it wraps; commit() publishes what was filled.
+    size_t reserve(uint8_t** span);
+    void commit(size_t length);
+    size_t write(const uint8_t* data, size_t length);
+    size_t space() const;
+
+    // Consumer side. peek() returns the contiguous buffered span; consume()
+    // releases it back to the producer.
+    size_t peek(const uint8_t** span);
+    void consume(size_t length);
+    size_t available() const;
+
+    // Only while neither side is running
+    void clear();
+};
+
+#endif // SPSC_RING_H
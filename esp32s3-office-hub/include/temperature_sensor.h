@@ -4,6 +4,8 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <SPIFFS.h>
+#include <atomic>
+#include <functional>
 #include "esp_temperature_sensor.h"
 
 struct TemperatureReading {
@@ -12,6 +14,8 @@ struct TemperatureReading {
     bool isValid;
 };
 
+typedef std::function<void(float temperature, float ratePerMinute)> TemperatureReadingCallback;
+
 class TemperatureSensor {
 private:
     temperature_sensor_handle_t tempSensor;
@@ -24,12 +28,19 @@ private:
     std::vector<TemperatureReading> temperatureLog;
     size_t maxLogEntries;
     String logFilePath;
+    TemperatureReadingCallback readingCallback;
+    std::vector<TemperatureReading>* pendingHistory;
+    std::atomic<bool> historyPending;
+    bool historyLoaded;
+    
+    bool parseLogFile(std::vector<TemperatureReading>& readings);
+    void mergeLoadedHistory();
     
 public:
     TemperatureSensor();
     ~TemperatureSensor();
     
-    bool begin();
+    bool begin(bool loadHistory = true);
     void end();
     
     // Temperature reading
@@ -43,11 +54,14 @@ public:
     void setReadingInterval(unsigned long interval);
     unsigned long getReadingInterval();
     void update();
+    void onReading(TemperatureReadingCallback callback);
     
     // Temperature logging
     void logTemperature();
     bool saveLogToFile();
     bool loadLogFromFile();
+    bool loadLogDeferred();   // Parses on the calling task, merged into the log on the next reading
+    bool isHistoryLoaded();
     String getLogJSON(int entries = 100);
     void clearLog();
     void setMaxLogEntries(size_t maxEntries);
@@ -61,6 +75,7 @@ public:
     bool isOverTemperature(float threshold);
     bool isUnderTemperature(float threshold);
     float getTemperatureTrend(); // Returns positive for warming, negative for cooling
+    float getTemperatureRate(int samples = 10); // Least-squares slope in °C per minute
     
     // Calibration
     void setTemperatureOffset(float offset);
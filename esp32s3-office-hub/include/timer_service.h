@@ -0,0 +1,96 @@
+#ifndef TIMER_SERVICE_H
+#define TIMER_SERVICE_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+typedef std::function<void()> TimerCallback;
+typedef std::function<uint32_t()> WallClockSource; // Local epoch seconds, 0 when unknown
+
+#define INVALID_TIMER_ID 0
+
+// Day-of-week masks for wall-clock schedules (bit 0 = Sunday, matches tm_wday)
+#define DAYS_EVERY    0x7F
+#define DAYS_WEEKDAYS 0x3E
+#define DAYS_WEEKENDS 0x41
+
+enum TimerKind {
+    TIMER_INTERVAL,   // Monotonic, fires every intervalMs
+    TIMER_ONESHOT,    // Monotonic, fires once after delayMs
+    TIMER_WALLCLOCK   // Fires at hour:minute on the days in dayMask
+};
+
+struct TimerEntry {
+    uint32_t id;
+    TimerKind kind;
+    String name;
+    TimerCallback callback;
+    uint64_t deadline;        // Monotonic ms (esp_timer based, never wraps)
+    uint32_t intervalMs;
+    int8_t hour;              // -1 = every hour (wall-clock only)
+    int8_t minute;
+    uint8_t dayMask;
+    uint32_t fireCount;
+    bool active;
+};
+
+// Every public call may come from any task; callbacks run on the task that
+// calls service(), outside the lock
+class TimerService {
+private:
+    std::vector<TimerEntry> timers;   // Storage, indexed through the heap below
+    std::vector<size_t> heap;         // Min-heap of indices into timers, keyed on deadline
+    uint32_t nextId;
+    WallClockSource wallClock;
+    int64_t wallClockOffset;          // Local epoch ms minus monotonic ms at last sync
+    bool wallClockValid;
+    TaskHandle_t waitingTask;
+    uint32_t realignThresholdMs;
+    uint32_t realignCount;
+    SemaphoreHandle_t lock;           // Timers are added and listed from web handlers too
+
+    uint32_t addTimer(TimerEntry entry);
+    void heapPush(size_t index);
+    void heapPop();
+    void rebuildHeap();
+    bool scheduleWallClock(TimerEntry& entry, uint64_t nowMs);
+    void checkWallClock(uint64_t nowMs);
+
+public:
+    TimerService();
+
+    void begin(WallClockSource source);
+
+    // Monotonic timers
+    uint32_t every(uint32_t intervalMs, TimerCallback callback, const String& name = "");
+    uint32_t after(uint32_t delayMs, TimerCallback callback, const String& name = "");
+
+    // Wall-clock schedules; hour = -1 fires every hour at the given minute
+    uint32_t at(int8_t hour, int8_t minute, uint8_t dayMask, TimerCallback callback, const String& name = "");
+
+    bool cancel(uint32_t id);
+    void cancelByPrefix(const String& prefix);
+    bool reschedule(uint32_t id, uint32_t intervalMs);
+
+    // Runs every due callback, returns the number of callbacks fired
+    int service();
+
+    // Blocks the calling task until the next deadline, a wake() or maxWaitMs elapses
+    void sleepUntilNextDeadline(uint32_t maxWaitMs = 1000);
+    void wake();
+    void wakeFromISR();
+
+    // Call after the wall clock has been (re)synchronised, e.g. after an NTP update
+    void notifyWallClockChanged();
+
+    uint32_t getMsUntilNextDeadline();
+    size_t getTimerCount();
+    uint32_t getRealignCount();
+    String getTimersJSON();
+
+    static uint64_t monotonicMs();
+    static uint8_t parseDayMask(const String& days);
+};
+
+#endif // TIMER_SERVICE_H
@@ -4,27 +4,278 @@
 #include <Arduino.h>
 #include <SPIFFS.h>
 #include <ArduinoJson.h>
+#include <functional>
+#include <usb_host.hpp>
+#include <usb_msc.hpp>
+#include "ff.h"
+#include "block_device.h"
+#include "block_cache.h"
+#include "serial_bridge.h"
+#include "timer_service.h"
 
+#define USB_MOUNT_POINT "/usb"
+#define USB_MAX_OPEN_FILES 4
+#define USB_ENUMERATE_TIMEOUT_MS 3000   // MAX LUN + READ CAPACITY after attach
+#define USB_MSC_MAX_SECTORS 16          // Per READ(10)/WRITE(10); must move within the library's 20 ms read wait
+#define USB_EVENT_QUEUE_LENGTH 8       // Hot-plug plus one entry per stream buffer
+#define USB_TASK_STACK_SIZE 6144
+#define USB_TRANSFER_CHUNK 16384        // Bytes per f_read/f_write call in upload/download
+#define USB_LIST_MAX_ENTRIES 32         // listFiles() preview stops here and sets "truncated"
+#define USB_LIST_SNAPSHOTS 4            // Sorted directory snapshots kept for paged listings
+#define USB_LIST_SNAPSHOT_MAX 8192      // Entries per snapshot; the rest is cut off and flagged
+#define USB_LIST_BATCH 32               // Entries read per step of the background walk
+#define USB_LIST_PAGE_DEFAULT 50
+#define USB_LIST_PAGE_MAX 200
+#define USB_LIST_BUSY -1                // acquireListing: every snapshot is being paged
+#define USB_LIST_EXPIRED -2             // acquireListing: the cursor's generation is gone
+#define USB_MAX_STREAMS 2               // Concurrent streamed uploads/downloads
+#define USB_STREAM_BUFFER_SIZE 8192     // Each half of a stream's double buffer; whole sectors
+#define USB_STREAM_RETRY -1             // readStream: the next buffer is still being read
+#define USB_STREAM_ERROR -2
+
+enum USBEventType : uint8_t {
+    USB_EVENT_ATTACHED,
+    USB_EVENT_DETACHED,
+    USB_EVENT_STREAM_IO,
+    USB_EVENT_LIST          // Wakes the task for a snapshot walk
+};
+
+struct USBEvent {
+    USBEventType type;
+    uint8_t stream;     // USB_EVENT_STREAM_IO: slot and buffer half to write or fill
+    uint8_t half;
+};
+
+enum USBBufferState : uint8_t {
+    USB_BUFFER_EMPTY,
+    USB_BUFFER_BUSY,    // Owned by the USB task until it gives the stream's semaphore
+    USB_BUFFER_READY
+};
+
+struct USBStreamMemory;
+
+// One open file and a two-half buffer. The caller fills (upload) or drains
+// (download) one half while the USB task writes or reads the other, so a
+// transfer of any size holds USB_STREAM_BUFFER_SIZE * 2 plus a FIL.
+struct USBStream {
+    uint32_t id;                // 0 when the slot is free
+    bool upload;
+    bool fileOpen;              // Cleared on detach; the FIL died with the volume
+    volatile bool failed;
+    USBStreamMemory* memory;
+    volatile USBBufferState state[2];
+    size_t length[2];
+    size_t consumed[2];         // Download: bytes of a ready half already handed out
+    uint8_t active;             // Half the caller is filling or draining
+    uint64_t total;             // Bytes expected, 0 if unknown; used for progress
+    uint64_t transferred;       // Bytes the USB task has written or read
+    uint64_t requested;         // Download: bytes handed to the USB task so far
+    uint64_t offset;            // Download: file position of the next read
+    int reported;
+    SemaphoreHandle_t done;     // Given by the USB task after each half
+    String path;                // "N:/..." for removing an unfinished upload
+};
+
+enum USBListSort : uint8_t {
+    USB_SORT_NAME,
+    USB_SORT_SIZE,
+    USB_SORT_MODIFIED
+};
+
+enum USBListState : uint8_t {
+    USB_LIST_FREE,
+    USB_LIST_WALKING,       // Owned by the USB task until READY or FAILED
+    USB_LIST_READY,
+    USB_LIST_FAILED
+};
+
+struct USBListEntry {
+    uint32_t name;          // Offset into the snapshot's name pool
+    uint32_t modified;      // FAT date << 16 | time
+    uint64_t size;
+    bool directory;
+};
+
+// One directory read in full and sorted (directories first), as it was at
+// the volume generation it carries. Pages are cut from it by index, so a
+// cursor stays consistent for as long as its snapshot is cached.
+struct USBListSnapshot {
+    volatile USBListState state;
+    String path;
+    USBListSort sort;
+    bool descending;
+    bool truncated;
+    FRESULT error;
+    uint32_t generation;
+    uint32_t lastUsed;
+    uint8_t readers;        // Pages being sent from it; never recycled while non-zero
+    USBListEntry* entries;
+    uint32_t count;
+    uint32_t capacity;
+    char* names;
+    size_t namesUsed;
+    size_t namesCapacity;
+    DIR* dir;               // Open between walk steps
+};
+
+typedef std::function<void(bool mounted)> USBMountCallback;
+
+// LUN 0 of an enumerated stick. Calls are serialized because the library
+// keeps one in-flight command per device. The library copies only the first
+// block of a READ(10) data stage into the caller's buffer; the whole stage
+// comes from its data callback, one block per call, and a library that never
+// calls it gets one block per command.
+class MscBlockDevice : public BlockDevice {
+private:
+    USBmscDevice* device;
+    uint8_t lun;
+    uint32_t blockCount;
+    uint16_t blockSize;
+    volatile bool present;
+    bool multiSector = true;
+    SemaphoreHandle_t lock;
+    uint8_t* volatile readTarget = nullptr;    // Set while a READ(10) is in flight
+    size_t readExpected = 0;
+    volatile size_t readReceived = 0;
+
+public:
+    MscBlockDevice(USBmscDevice* msc, uint8_t lunNumber);
+    ~MscBlockDevice();
+
+    bool read(uint32_t block, uint8_t* buffer, uint32_t count) override;
+    bool write(uint32_t block, const uint8_t* buffer, uint32_t count) override;
+    uint32_t getBlockCount() override;
+    uint16_t getBlockSize() override;
+    bool isReady() override;
+    // Called from the host client task when the device goes away; fails I/O fast
+    void detach();
+    // Registered as the library's data_cb
+    static void dataCallback(usb_transfer_t* transfer);
+};
+
+// Hot-plug runs on a dedicated task woken by host client events: attach
+// enumerates and mounts FAT through VFS at /usb, or hands a CDC-ACM serial
+// device to the serial bridge; detach undoes either. File calls from other
+// tasks are serialized against mount changes.
 class USBHostManager {
 private:
-    bool usbMounted = false;
-    String mountPoint = "/usb";
-    
+    volatile bool usbMounted = false;
+    String mountPoint = USB_MOUNT_POINT;
+    USBhost* host = nullptr;
+    USBmscDevice* msc = nullptr;
+    MscBlockDevice* volatile disk = nullptr;
+    BlockCache* cache = nullptr;
+    bool cacheEnabled = true;
+    FATFS* fatfs = nullptr;
+    uint8_t drive = 0xFF;
+    uint8_t mscInterface = 0;
+    volatile bool interfaceClaimed = false;
+    USBacmDevice* acm = nullptr;
+    SerialBridge* serialBridge = nullptr;
+    uint8_t acmInterfaces[2] = {};       // Communication and data, both claimed by the library
+    volatile bool acmClaimed = false;
+    QueueHandle_t eventQueue = NULL;     // Host client callback -> USB task
+    QueueHandle_t mountQueue = NULL;     // USB task -> loop, mount state changes
+    SemaphoreHandle_t enumerated = NULL;
+    SemaphoreHandle_t lock = NULL;
+    TimerService* timers = nullptr;
+    USBMountCallback mountCallback;
+    uint64_t totalBytes = 0;
+    uint64_t freeBytes = 0;
+    String fileSystem;
+    String manufacturer;
+    String product;
+    uint16_t vendorId = 0;
+    uint16_t productId = 0;
+    USBStream streams[USB_MAX_STREAMS] = {};
+    uint32_t nextStreamId = 1;
+    volatile uint32_t generation = 1;    // Bumped by every change to the volume
+    USBListSnapshot snapshots[USB_LIST_SNAPSHOTS] = {};
+    volatile bool walkPending = false;
+    uint32_t listClock = 0;
+
+    static void usbTask(void* param);
+    static void clientEventCallback(const usb_host_client_event_msg_t* event, void* arg);
+    static void capacityCallback(usb_transfer_t* transfer);
+
+    bool postEvent(USBEventType type, uint8_t stream = 0, uint8_t half = 0);
+    bool mountDisk();
+    void unmountDisk();
+    void refreshSpace();
+    void markModified();
+    void readDeviceStrings();
+    void releaseMsc();
+    bool findAcmInterfaces(const usb_config_desc_t* config);
+    void attachSerial(const usb_config_desc_t* config);
+    String drivePath(const String& path);
+    void notifyMountChange();
+    USBStream* openStream(const String& filename, bool upload, uint64_t total);
+    USBStream* findStream(uint32_t id);
+    bool submitHalf(USBStream* stream, uint8_t half);
+    void requestRead(USBStream* stream, uint8_t half);
+    void waitIdle(USBStream* stream, uint8_t half);
+    void serviceStream(uint8_t slot, uint8_t half);
+    bool releaseStream(USBStream* stream, bool keepUpload);
+    void walkListing();
+    bool appendEntry(USBListSnapshot* snapshot, const FILINFO& info);
+    void sortListing(USBListSnapshot* snapshot);
+    void resetListing(USBListSnapshot* snapshot);
+
 public:
-    bool initialize();
+    bool initialize(TimerService* timerService = nullptr);
     bool isMounted();
+    // First USB_LIST_MAX_ENTRIES entries in directory order, walked on the
+    // caller's task; whole directories page through acquireListing
     String listFiles(String path = "/");
     bool uploadFile(String filename, uint8_t* data, size_t length);
+    // *data comes from MemoryPolicy::psram(); release it with MemoryPolicy::psram()->deallocate()
     bool downloadFile(String filename, uint8_t** data, size_t* length);
     bool deleteFile(String filename);
+    bool statFile(const String& filename, uint64_t* size, bool* directory);
     bool createDirectory(String dirname);
+    // Small random-access I/O on the caller's task. readFileAt stops at the end
+    // of the file; writeFileAt creates the file and may extend it.
+    bool readFileAt(const String& filename, uint64_t offset, uint8_t* data, size_t length, size_t* read);
+    bool writeFileAt(const String& filename, uint64_t offset, const uint8_t* data, size_t length);
     uint64_t getTotalSpace();
     uint64_t getFreeSpace();
     String getDeviceInfo();
-    
-    // Event callbacks
+    // Sector cache in front of the stick (on by default); applies from the next mount
+    void setBlockCache(bool enabled);
+    // CDC-ACM devices are handed to the bridge; without one they are ignored
+    void setSerialBridge(SerialBridge* bridge);
+
+    // Runs the mount callback for attach/detach seen since the last call; loop context
+    void processEvents();
+    void onMountChange(USBMountCallback callback);
+
+    // Streamed transfers for files larger than RAM. Ids are never reused, so
+    // closeStream on a finished or unknown id does nothing. total/length only
+    // feed progress reporting and may be 0 for uploads of unknown size.
+    uint32_t openUpload(const String& filename, uint64_t total);
+    bool writeStream(uint32_t id, const uint8_t* data, size_t length);
+    // Flushes and closes; false (and the partial file removed) if any write failed
+    bool finishUpload(uint32_t id);
+    uint32_t openDownload(const String& filename, uint64_t offset, uint64_t length);
+    // Bytes copied, 0 at the end, USB_STREAM_RETRY while the next half is in flight
+    // or USB_STREAM_ERROR. Never blocks on the stick.
+    int32_t readStream(uint32_t id, uint8_t* buffer, size_t maxLength);
+    // Waits for in-flight buffers; an unfinished upload is removed
+    void closeStream(uint32_t id);
+
+    // Paged directory listings. acquireListing returns a snapshot handle for
+    // the current generation, or for an older one a cursor was cut from,
+    // starting a walk on the USB task if needed; poll the snapshot's state
+    // until READY or FAILED, then releaseListing.
+    int acquireListing(const String& path, USBListSort sort, bool descending, uint32_t cursorGeneration = 0);
+    const USBListSnapshot* getListing(int handle);
+    void releaseListing(int handle);
+    uint32_t getGeneration();
+
+    // Hot-plug handlers, run on the USB task
     void onUSBConnect();
     void onUSBDisconnect();
+    // Reported by uploadFile/downloadFile on the caller's task, by streams on the USB task
     void onFileTransferProgress(int percentage);
 };
 
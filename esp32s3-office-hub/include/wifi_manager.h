@@ -39,6 +39,7 @@ public:
     // Connection management
     bool connectToNetwork(const String& ssid, const String& password);
     bool connectToBestNetwork();
+    bool beginConnectAsync();   // Starts association with the preferred saved network, returns immediately
     void disconnect();
     bool isWiFiConnected();
     
@@ -0,0 +1,7 @@
+// Host simulation shim: the loopback transport lives in ESPAsyncWebServer.h
+#ifndef SIM_ASYNCTCP_H
+#define SIM_ASYNCTCP_H
+
+#include <Arduino.h>
+
+#endif // SIM_ASYNCTCP_H
@@ -0,0 +1,350 @@
+// Host simulation shim: AsyncWebServer / AsyncWebSocket with in-process dispatch.
+// Requests and WebSocket frames are injected by the sim runner or arrive over
+// the loopback TCP listener (one newline-framed message per line). Request
+// bodies reach body/upload handlers in TCP-segment-sized pieces, and filler
+// responses are drained the same way, as on the device.
+#ifndef SIM_ESPASYNCWEBSERVER_H
+#define SIM_ESPASYNCWEBSERVER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+#include "WiFi.h"
+
+typedef enum {
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_DELETE = 0b00000100,
+    HTTP_PUT = 0b00001000,
+    HTTP_PATCH = 0b00010000,
+    HTTP_HEAD = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY = 0b01111111
+} WebRequestMethod;
+
+typedef uint8_t WebRequestMethodComposite;
+
+// Filler return value: nothing ready yet, call again later
+#define RESPONSE_TRY_AGAIN 0xFFFFFFFF
+
+class AsyncWebServerRequest;
+class AsyncWebServer;
+class AsyncWebSocket;
+class AsyncWebSocketClient;
+
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+typedef std::function<bool(AsyncWebServerRequest* request)> ArRequestFilterFunction;
+typedef std::function<void(AsyncWebServerRequest* request, const String& filename, size_t index,
+                           uint8_t* data, size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, uint8_t* data, size_t len,
+                           size_t index, size_t total)> ArBodyHandlerFunction;
+typedef std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+typedef std::function<void(void)> ArDisconnectHandler;
+
+class AsyncWebHeader {
+private:
+    String headerName;
+    String headerValue;
+
+public:
+    AsyncWebHeader(const String& name, const String& value) : headerName(name), headerValue(value) {}
+    const String& name() const { return headerName; }
+    const String& value() const { return headerValue; }
+};
+
+// Query string parameter; the URL keeps only the path
+class AsyncWebParameter {
+private:
+    String paramName;
+    String paramValue;
+
+public:
+    AsyncWebParameter(const String& name, const String& value) : paramName(name), paramValue(value) {}
+    const String& name() const { return paramName; }
+    const String& value() const { return paramValue; }
+};
+
+class AsyncWebServerResponse {
+protected:
+    int code;
+    String contentType;
+    std::string body;
+    std::vector<AsyncWebHeader> headers;
+
+public:
+    AsyncWebServerResponse(int code, const String& contentType) : code(code), contentType(contentType) {}
+    virtual ~AsyncWebServerResponse() {}
+    int getCode() const { return code; }
+    void setCode(int status) { code = status; }
+    const String& getContentType() const { return contentType; }
+    const std::string& getBody() const { return body; }
+    void setBody(const std::string& content) { body = content; }
+    void addHeader(const String& name, const String& value) { headers.emplace_back(name, value); }
+
+    // Simulation only
+    String getHeader(const char* name) const;
+    // Produces the body of callback responses the way the TCP stack would pull it
+    virtual void drain() {}
+};
+
+// beginResponse(type, len, filler) and beginChunkedResponse
+class AsyncCallbackResponse : public AsyncWebServerResponse {
+private:
+    AwsResponseFiller filler;
+    size_t contentLength;
+    bool chunked;
+
+public:
+    AsyncCallbackResponse(const String& contentType, size_t len, AwsResponseFiller callback, bool chunked)
+        : AsyncWebServerResponse(200, contentType), filler(callback), contentLength(len), chunked(chunked) {}
+    void drain() override;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+public:
+    AsyncResponseStream(const String& contentType) : AsyncWebServerResponse(200, contentType) {}
+    size_t write(uint8_t c) override { body.push_back((char)c); return 1; }
+    size_t write(const uint8_t* data, size_t len) override { body.append((const char*)data, len); return len; }
+    using Print::write;
+};
+
+class AsyncWebServerRequest {
+    friend class AsyncWebServer;
+
+private:
+    WebRequestMethod requestMethod;
+    String requestUrl;
+    AsyncWebServerResponse* response;
+    std::vector<AsyncWebHeader> headers;
+    std::vector<AsyncWebParameter> params;
+    std::string body;
+    ArDisconnectHandler disconnectHandler;
+
+public:
+    // Owned by the handler; freed with free() when the request goes away
+    void* _tempObject;
+
+    AsyncWebServerRequest(WebRequestMethod method, const String& url);
+    ~AsyncWebServerRequest();
+
+    WebRequestMethod method() const { return requestMethod; }
+    const String& url() const { return requestUrl; }
+    bool hasHeader(const char* name) const { return getHeader(name) != nullptr; }
+    const AsyncWebHeader* getHeader(const char* name) const;
+    const String& header(const char* name) const;
+    const String& contentType() const { return header("Content-Type"); }
+    bool hasParam(const char* name) const { return getParam(name) != nullptr; }
+    const AsyncWebParameter* getParam(const char* name) const;
+    size_t contentLength() const { return body.size(); }
+    // Runs when the client goes away, after the response or mid-transfer
+    void onDisconnect(ArDisconnectHandler fn) { disconnectHandler = fn; }
+
+    void send(int code, const String& contentType = String(), const String& content = String());
+    void send(AsyncWebServerResponse* response);
+    void send(FS& fs, const String& path, const String& contentType = String());
+    AsyncResponseStream* beginResponseStream(const String& contentType, size_t bufferSize = 1460);
+    AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(), const String& content = String());
+    AsyncWebServerResponse* beginResponse(const String& contentType, size_t len, AwsResponseFiller callback);
+    AsyncWebServerResponse* beginChunkedResponse(const String& contentType, AwsResponseFiller callback);
+
+    // Simulation only
+    const AsyncWebServerResponse* getResponse() const { return response; }
+    void addHeader(const String& name, const String& value) { headers.emplace_back(name, value); }
+    void setBody(const std::string& content) { body = content; }
+};
+
+class AsyncWebHandler {
+protected:
+    ArRequestFilterFunction filter;
+
+public:
+    virtual ~AsyncWebHandler() {}
+    AsyncWebHandler& setFilter(ArRequestFilterFunction fn) { filter = fn; return *this; }
+    bool filterRequest(AsyncWebServerRequest* request) { return !filter || filter(request); }
+    virtual bool canHandle(AsyncWebServerRequest* request) { (void)request; return false; }
+    virtual void handleRequest(AsyncWebServerRequest* request) { (void)request; }
+    virtual void handleUpload(AsyncWebServerRequest* request, const String& filename, size_t index,
+                              uint8_t* data, size_t len, bool final) {
+        (void)request; (void)filename; (void)index; (void)data; (void)len; (void)final;
+    }
+    virtual void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+        (void)request; (void)data; (void)len; (void)index; (void)total;
+    }
+};
+
+class AsyncStaticWebHandler : public AsyncWebHandler {
+private:
+    FS& fs;
+    String uri;
+    String path;
+    String defaultFile;
+
+public:
+    AsyncStaticWebHandler(const char* uri, FS& fs, const char* path) : fs(fs), uri(uri), path(path), defaultFile("index.htm") {}
+    AsyncStaticWebHandler& setDefaultFile(const char* filename) { defaultFile = filename; return *this; }
+    AsyncStaticWebHandler& setFilter(ArRequestFilterFunction fn) { filter = fn; return *this; }
+    bool canHandle(AsyncWebServerRequest* request) override;
+    void handleRequest(AsyncWebServerRequest* request) override;
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+private:
+    String uri;
+    WebRequestMethodComposite method;
+    ArRequestHandlerFunction onRequest;
+    ArUploadHandlerFunction uploadHandler;
+    ArBodyHandlerFunction bodyHandler;
+
+public:
+    AsyncCallbackWebHandler(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction fn)
+        : uri(uri), method(method), onRequest(fn) {}
+    void onUpload(ArUploadHandlerFunction fn) { uploadHandler = fn; }
+    void onBody(ArBodyHandlerFunction fn) { bodyHandler = fn; }
+    // "/prefix*" matches any URL starting with /prefix
+    bool canHandle(AsyncWebServerRequest* request) override {
+        if (!(request->method() & method)) return false;
+        if (uri.endsWith("*")) return request->url().startsWith(uri.substring(0, uri.length() - 1));
+        return request->url() == uri;
+    }
+    void handleRequest(AsyncWebServerRequest* request) override { if (onRequest) onRequest(request); }
+    void handleUpload(AsyncWebServerRequest* request, const String& filename, size_t index,
+                      uint8_t* data, size_t len, bool final) override {
+        if (uploadHandler) uploadHandler(request, filename, index, data, len, final);
+    }
+    void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) override {
+        if (bodyHandler) bodyHandler(request, data, len, index, total);
+    }
+};
+
+class AsyncWebServer {
+private:
+    uint16_t port;
+    std::vector<AsyncWebHandler*> handlers;
+    ArRequestHandlerFunction notFound;
+
+public:
+    AsyncWebServer(uint16_t port) : port(port) {}
+    ~AsyncWebServer();
+
+    void begin() {}
+    void end() {}
+    AsyncStaticWebHandler& serveStatic(const char* uri, FS& fs, const char* path);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                                ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody = nullptr);
+    AsyncWebHandler& addHandler(AsyncWebHandler* handler) { handlers.push_back(handler); return *handler; }
+    void onNotFound(ArRequestHandlerFunction fn) { notFound = fn; }
+
+    // Simulation only: runs the request through the handler chain, feeding its
+    // body to the matched handler first and draining a callback response after
+    void dispatch(AsyncWebServerRequest* request);
+};
+
+typedef enum {
+    WS_EVT_CONNECT,
+    WS_EVT_DISCONNECT,
+    WS_EVT_PONG,
+    WS_EVT_ERROR,
+    WS_EVT_DATA
+} AwsEventType;
+
+typedef enum {
+    WS_CONTINUATION,
+    WS_TEXT,
+    WS_BINARY,
+    WS_DISCONNECT = 0x08,
+    WS_PING,
+    WS_PONG
+} AwsFrameType;
+
+typedef struct {
+    uint8_t message_opcode;
+    uint32_t num;
+    uint8_t final;
+    uint8_t masked;
+    uint8_t opcode;
+    uint64_t len;
+    uint8_t mask[4];
+    uint64_t index;
+} AwsFrameInfo;
+
+typedef std::function<void(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type,
+                           void* arg, uint8_t* data, size_t len)> AwsEventHandler;
+
+// Receives everything the firmware sends to one client
+typedef std::function<void(uint32_t clientId, const char* data, size_t len)> SimWsSink;
+
+class AsyncWebSocketClient {
+private:
+    uint32_t clientId;
+    IPAddress ip;
+    SimWsSink sink;
+    SimWsSink binarySink;
+    std::atomic<bool> blocked{false};
+
+public:
+    AsyncWebSocketClient(uint32_t id, const IPAddress& ip, SimWsSink sink, SimWsSink binarySink)
+        : clientId(id), ip(ip), sink(sink), binarySink(binarySink) {}
+    uint32_t id() const { return clientId; }
+    IPAddress remoteIP() const { return ip; }
+    bool canSend() const { return !blocked; }
+    void text(const char* message, size_t len) { if (sink) sink(clientId, message, len); }
+    void text(const char* message) { text(message, strlen(message)); }
+    void text(const String& message) { text(message.c_str(), message.length()); }
+    // Binary frames go to the binary sink, or the text one if there is none
+    void binary(const uint8_t* message, size_t len) {
+        SimWsSink& target = binarySink ? binarySink : sink;
+        if (target) target(clientId, (const char*)message, len);
+    }
+    void binary(const char* message, size_t len) { binary((const uint8_t*)message, len); }
+    void close() {}
+
+    // Simulation only: a blocked client reports a full send queue
+    void setBlocked(bool state) { blocked = state; }
+};
+
+class AsyncWebSocket : public AsyncWebHandler {
+private:
+    String url;
+    AwsEventHandler eventHandler;
+    std::vector<AsyncWebSocketClient*> clients;
+    std::recursive_mutex lock;
+    std::mutex eventLock; // Callbacks are serialized like on the async_tcp task
+    uint32_t nextId;
+
+public:
+    AsyncWebSocket(const char* url) : url(url), nextId(1) {}
+    ~AsyncWebSocket();
+
+    void onEvent(AwsEventHandler handler) { eventHandler = handler; }
+    size_t count();
+    void cleanupClients(uint16_t maxClients = 8);
+    void textAll(const char* message, size_t len);
+    void textAll(const char* message) { textAll(message, strlen(message)); }
+    void textAll(const String& message) { textAll(message.c_str(), message.length()); }
+    void binaryAll(const uint8_t* message, size_t len);
+    void binaryAll(const char* message, size_t len) { binaryAll((const uint8_t*)message, len); }
+    bool availableForWriteAll();
+
+    // Simulation only: connect a client, feed it text or binary frames, drop it
+    AsyncWebSocketClient* connectClient(SimWsSink sink, const IPAddress& ip = IPAddress(127, 0, 0, 1),
+                                        SimWsSink binarySink = nullptr);
+    void injectText(AsyncWebSocketClient* client, const char* message, size_t len);
+    void injectBinary(AsyncWebSocketClient* client, const uint8_t* message, size_t len);
+    void disconnectClient(AsyncWebSocketClient* client);
+};
+
+namespace sim {
+
+// Serves WebSocket frames and simple "GET /path", "POST /path" and "DELETE /path"
+// lines on a loopback TCP port
+bool startLoopbackServer(uint16_t port, AsyncWebServer* server, AsyncWebSocket* ws);
+void stopLoopbackServer();
+
+} // namespace sim
+
+#endif // SIM_ESPASYNCWEBSERVER_H
@@ -0,0 +1,61 @@
+// Host simulation shim: Arduino FS backed by an in-memory file table
+#ifndef SIM_FS_H
+#define SIM_FS_H
+
+#include <Arduino.h>
+#include <memory>
+
+namespace fs {
+
+struct FileData;
+
+class File : public Stream {
+private:
+    std::shared_ptr<FileData> data;
+    std::string filePath;
+    size_t pos;
+    bool writable;
+
+public:
+    File() : pos(0), writable(false) {}
+    File(std::shared_ptr<FileData> data, const std::string& path, bool writable, bool append);
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;
+    using Stream::readBytes;
+
+    size_t read(uint8_t* buffer, size_t size) { return readBytes((char*)buffer, size); }
+    bool seek(uint32_t pos);
+    size_t position() const { return pos; }
+    size_t size() const;
+    const char* name() const;
+    const char* path() const { return filePath.c_str(); }
+    bool isDirectory() const { return false; }
+    void close() { data.reset(); }
+    operator bool() const { return (bool)data; }
+};
+
+class FS {
+public:
+    virtual ~FS() {}
+    File open(const char* path, const char* mode = "r");
+    File open(const String& path, const char* mode = "r") { return open(path.c_str(), mode); }
+    bool exists(const char* path);
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool remove(const String& path) { return remove(path.c_str()); }
+    bool rename(const char* from, const char* to);
+    bool mkdir(const char* path) { (void)path; return true; }
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif // SIM_FS_H
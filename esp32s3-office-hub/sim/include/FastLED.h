@@ -0,0 +1,86 @@
+// Host simulation shim: FastLED pixel types and a controller that counts frames
+#ifndef SIM_FASTLED_H
+#define SIM_FASTLED_H
+
+#include <Arduino.h>
+
+struct CHSV {
+    uint8_t h, s, v;
+    CHSV() : h(0), s(0), v(0) {}
+    CHSV(uint8_t hue, uint8_t sat, uint8_t val) : h(hue), s(sat), v(val) {}
+};
+
+struct CRGB {
+    union {
+        struct {
+            uint8_t r;
+            uint8_t g;
+            uint8_t b;
+        };
+        uint8_t raw[3];
+    };
+
+    enum HTMLColorCode {
+        Black = 0x000000,
+        Blue = 0x0000FF,
+        Cyan = 0x00FFFF,
+        Green = 0x008000,
+        Magenta = 0xFF00FF,
+        Orange = 0xFFA500,
+        Purple = 0x800080,
+        Red = 0xFF0000,
+        White = 0xFFFFFF,
+        Yellow = 0xFFFF00
+    };
+
+    CRGB() : r(0), g(0), b(0) {}
+    CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) {}
+    CRGB(HTMLColorCode colorcode) : CRGB((uint32_t)colorcode) {}
+    CRGB(const CHSV& hsv) { *this = hsv; }
+
+    CRGB& operator=(uint32_t colorcode) { return *this = CRGB(colorcode); }
+    CRGB& operator=(const CHSV& hsv);
+    uint8_t& operator[](uint8_t index) { return raw[index]; }
+    const uint8_t& operator[](uint8_t index) const { return raw[index]; }
+    bool operator==(const CRGB& rhs) const { return r == rhs.r && g == rhs.g && b == rhs.b; }
+    bool operator!=(const CRGB& rhs) const { return !(*this == rhs); }
+    CRGB& nscale8(uint8_t scale);
+};
+
+enum EOrder { RGB = 0012, GRB = 0102 };
+
+template <uint8_t DATA_PIN, EOrder RGB_ORDER> class WS2812B {};
+
+class CFastLED {
+private:
+    CRGB* leds = nullptr;
+    int count = 0;
+    uint8_t brightness = 255;
+    uint32_t frames = 0;
+
+public:
+    template <template <uint8_t, EOrder> class CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+    CFastLED& addLeds(CRGB* data, int numLeds) {
+        leds = data;
+        count = numLeds;
+        return *this;
+    }
+
+    void setBrightness(uint8_t scale) { brightness = scale; }
+    uint8_t getBrightness() const { return brightness; }
+    void show() { frames++; }
+    void clear(bool writeData = false) {
+        for (int i = 0; i < count; i++) leds[i] = CRGB::Black;
+        if (writeData) show();
+    }
+
+    // Simulation only
+    uint32_t getFrameCount() const { return frames; }
+    const CRGB* getLeds() const { return leds; }
+    int size() const { return count; }
+};
+
+extern CFastLED FastLED;
+
+#endif // SIM_FASTLED_H
@@ -0,0 +1,29 @@
+// Host simulation shim: NTP answers from sim::setWallClock
+#ifndef SIM_NTPCLIENT_H
+#define SIM_NTPCLIENT_H
+
+#include <Arduino.h>
+#include "WiFiUdp.h"
+
+class NTPClient {
+private:
+    long timeOffset;
+    unsigned long updateInterval;
+    unsigned long lastUpdate;
+    uint32_t syncedEpoch;
+
+public:
+    NTPClient(WiFiUDP& udp, const char* poolServerName, long timeOffset = 0, unsigned long updateInterval = 60000);
+
+    void begin() {}
+    void end() {}
+    bool update();
+    bool forceUpdate();
+    bool isTimeSet() const { return syncedEpoch != 0; }
+    void setTimeOffset(int offset) { timeOffset = offset; }
+    void setUpdateInterval(unsigned long interval) { updateInterval = interval; }
+    unsigned long getEpochTime() const;
+    String getFormattedTime() const;
+};
+
+#endif // SIM_NTPCLIENT_H
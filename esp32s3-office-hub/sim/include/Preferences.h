@@ -0,0 +1,37 @@
+// Host simulation shim: NVS preferences kept in a process-wide map
+#ifndef SIM_PREFERENCES_H
+#define SIM_PREFERENCES_H
+
+#include <Arduino.h>
+
+class Preferences {
+private:
+    std::string ns;
+    bool opened = false;
+
+    void put(const char* key, const std::string& value);
+    bool get(const char* key, std::string& value);
+
+public:
+    bool begin(const char* name, bool readOnly = false);
+    void end() { opened = false; }
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+
+    size_t putString(const char* key, const String& value) { put(key, value.c_str()); return value.length(); }
+    size_t putBool(const char* key, bool value) { put(key, value ? "1" : "0"); return 1; }
+    size_t putInt(const char* key, int32_t value) { put(key, std::to_string(value)); return 4; }
+    size_t putUChar(const char* key, uint8_t value) { put(key, std::to_string(value)); return 1; }
+    size_t putULong(const char* key, uint32_t value) { put(key, std::to_string(value)); return 4; }
+    size_t putFloat(const char* key, float value) { put(key, std::to_string(value)); return 4; }
+
+    String getString(const char* key, const String& def = String());
+    bool getBool(const char* key, bool def = false);
+    int32_t getInt(const char* key, int32_t def = 0);
+    uint8_t getUChar(const char* key, uint8_t def = 0);
+    uint32_t getULong(const char* key, uint32_t def = 0);
+    float getFloat(const char* key, float def = NAN);
+};
+
+#endif // SIM_PREFERENCES_H
@@ -0,0 +1,17 @@
+// Host simulation shim: SPIFFS over the in-memory FS
+#ifndef SIM_SPIFFS_H
+#define SIM_SPIFFS_H
+
+#include "FS.h"
+
+class SPIFFSFS : public fs::FS {
+public:
+    bool begin(bool formatOnFail = false) { (void)formatOnFail; return true; }
+    void end() {}
+    size_t totalBytes() { return 1536 * 1024; }
+    size_t usedBytes();
+};
+
+extern SPIFFSFS SPIFFS;
+
+#endif // SIM_SPIFFS_H
@@ -0,0 +1,150 @@
+// Host simulation shim: Arduino String on top of std::string
+#ifndef SIM_WSTRING_H
+#define SIM_WSTRING_H
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <string>
+
+class String {
+private:
+    std::string s;
+
+public:
+    String() {}
+    String(const char* str) : s(str ? str : "") {}
+    String(const std::string& str) : s(str) {}
+    String(const String& other) = default;
+    String(String&& other) = default;
+    explicit String(char c) : s(1, c) {}
+    String(int value, unsigned char base = 10) { fromLong(value, base); }
+    String(unsigned int value, unsigned char base = 10) { fromULong(value, base); }
+    String(long value, unsigned char base = 10) { fromLong(value, base); }
+    String(unsigned long value, unsigned char base = 10) { fromULong(value, base); }
+    String(long long value) : s(std::to_string(value)) {}
+    String(unsigned long long value) : s(std::to_string(value)) {}
+    String(float value, unsigned int decimals = 2) { fromDouble(value, decimals); }
+    String(double value, unsigned int decimals = 2) { fromDouble(value, decimals); }
+
+    String& operator=(const String& other) = default;
+    String& operator=(String&& other) = default;
+    String& operator=(const char* str) {
+        if (str) s = str; else s.clear();
+        return *this;
+    }
+
+    const char* c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.length(); }
+    bool isEmpty() const { return s.empty(); }
+    bool reserve(unsigned int size) { s.reserve(size); return true; }
+    const std::string& str() const { return s; }
+
+    bool concat(const char* str) { if (str) s += str; return true; }
+    bool concat(const char* str, unsigned int len) { if (str) s.append(str, len); return true; }
+    bool concat(const String& str) { s += str.s; return true; }
+    bool concat(char c) { s += c; return true; }
+
+    String& operator+=(const String& rhs) { s += rhs.s; return *this; }
+    String& operator+=(const char* rhs) { if (rhs) s += rhs; return *this; }
+    String& operator+=(char c) { s += c; return *this; }
+    String& operator+=(int v) { s += std::to_string(v); return *this; }
+    String& operator+=(unsigned int v) { s += std::to_string(v); return *this; }
+    String& operator+=(long v) { s += std::to_string(v); return *this; }
+    String& operator+=(unsigned long v) { s += std::to_string(v); return *this; }
+
+    friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+    friend String operator+(const String& a, const char* b) { return String(a.s + (b ? b : "")); }
+    friend String operator+(const char* a, const String& b) { return String(std::string(a ? a : "") + b.s); }
+    friend String operator+(const String& a, char c) { return String(a.s + c); }
+    friend String operator+(const String& a, int v) { return String(a.s + std::to_string(v)); }
+    friend String operator+(const String& a, unsigned long v) { return String(a.s + std::to_string(v)); }
+
+    bool operator==(const String& rhs) const { return s == rhs.s; }
+    bool operator==(const char* rhs) const { return s == (rhs ? rhs : ""); }
+    bool operator!=(const String& rhs) const { return s != rhs.s; }
+    bool operator!=(const char* rhs) const { return !(*this == rhs); }
+    bool operator<(const String& rhs) const { return s < rhs.s; }
+    bool equals(const String& rhs) const { return s == rhs.s; }
+    bool equalsIgnoreCase(const String& rhs) const { return strcasecmp(s.c_str(), rhs.s.c_str()) == 0; }
+
+    char operator[](unsigned int index) const { return index < s.size() ? s[index] : 0; }
+    char& operator[](unsigned int index) { return s[index]; }
+    char charAt(unsigned int index) const { return (*this)[index]; }
+
+    int indexOf(char c, unsigned int from = 0) const {
+        size_t pos = s.find(c, from);
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+    int indexOf(const String& str, unsigned int from = 0) const {
+        size_t pos = s.find(str.s, from);
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+    int lastIndexOf(char c) const {
+        size_t pos = s.rfind(c);
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+    String substring(unsigned int from) const {
+        return from >= s.size() ? String() : String(s.substr(from));
+    }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) { unsigned int t = from; from = to; to = t; }
+        if (from >= s.size()) return String();
+        return String(s.substr(from, to - from));
+    }
+    bool startsWith(const String& prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+    bool endsWith(const String& suffix) const {
+        return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+    }
+
+    void toLowerCase() { for (auto& c : s) c = tolower(c); }
+    void toUpperCase() { for (auto& c : s) c = toupper(c); }
+    void trim() {
+        size_t start = s.find_first_not_of(" \t\r\n");
+        size_t end = s.find_last_not_of(" \t\r\n");
+        s = start == std::string::npos ? "" : s.substr(start, end - start + 1);
+    }
+    void replace(const String& from, const String& to) {
+        if (from.s.empty()) return;
+        size_t pos = 0;
+        while ((pos = s.find(from.s, pos)) != std::string::npos) {
+            s.replace(pos, from.s.size(), to.s);
+            pos += to.s.size();
+        }
+    }
+    void remove(unsigned int index, unsigned int count = (unsigned int)-1) {
+        if (index < s.size()) s.erase(index, count);
+    }
+
+    long toInt() const { return strtol(s.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(s.c_str(), nullptr); }
+    double toDouble() const { return strtod(s.c_str(), nullptr); }
+
+private:
+    void fromLong(long value, unsigned char base) {
+        if (base == 10) { s = std::to_string(value); return; }
+        if (value < 0) { fromULong(-value, base); s = "-" + s; return; }
+        fromULong(value, base);
+    }
+    void fromULong(unsigned long value, unsigned char base) {
+        if (base == 10) { s = std::to_string(value); return; }
+        char buf[72];
+        char* p = buf + sizeof(buf) - 1;
+        *p = 0;
+        do {
+            int d = value % base;
+            *--p = d < 10 ? '0' + d : 'A' + d - 10;
+            value /= base;
+        } while (value);
+        s = p;
+    }
+    void fromDouble(double value, unsigned int decimals) {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+        s = buf;
+    }
+};
+
+#endif // SIM_WSTRING_H
@@ -0,0 +1,13 @@
+// Host simulation shim: UDP socket placeholder for NTPClient
+#ifndef SIM_WIFIUDP_H
+#define SIM_WIFIUDP_H
+
+#include <Arduino.h>
+
+class WiFiUDP {
+public:
+    uint8_t begin(uint16_t port) { (void)port; return 1; }
+    void stop() {}
+};
+
+#endif // SIM_WIFIUDP_H
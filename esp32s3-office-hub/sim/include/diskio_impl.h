@@ -0,0 +1,38 @@
+// Host simulation shim: ESP-IDF FatFs diskio driver registration
+#ifndef SIM_DISKIO_IMPL_H
+#define SIM_DISKIO_IMPL_H
+
+#include "esp_err.h"
+#include "ff.h"
+
+typedef BYTE DSTATUS;
+
+typedef enum {
+    RES_OK = 0,
+    RES_ERROR,
+    RES_WRPRT,
+    RES_NOTRDY,
+    RES_PARERR
+} DRESULT;
+
+#define STA_NOINIT 0x01
+#define STA_NODISK 0x02
+#define STA_PROTECT 0x04
+
+#define CTRL_SYNC 0
+#define GET_SECTOR_COUNT 1
+#define GET_SECTOR_SIZE 2
+#define GET_BLOCK_SIZE 3
+
+typedef struct {
+    DSTATUS (*init)(BYTE pdrv);
+    DSTATUS (*status)(BYTE pdrv);
+    DRESULT (*read)(BYTE pdrv, BYTE* buff, DWORD sector, UINT count);
+    DRESULT (*write)(BYTE pdrv, const BYTE* buff, DWORD sector, UINT count);
+    DRESULT (*ioctl)(BYTE pdrv, BYTE cmd, void* buff);
+} ff_diskio_impl_t;
+
+void ff_diskio_register(BYTE pdrv, const ff_diskio_impl_t* discio_impl);
+esp_err_t ff_diskio_get_drive(BYTE* out_pdrv);
+
+#endif // SIM_DISKIO_IMPL_H
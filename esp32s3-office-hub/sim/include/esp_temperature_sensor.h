@@ -0,0 +1,23 @@
+// Host simulation shim: the on-die temperature sensor reads the scripted curve
+#ifndef SIM_ESP_TEMPERATURE_SENSOR_H
+#define SIM_ESP_TEMPERATURE_SENSOR_H
+
+#include "esp_err.h"
+
+typedef struct {
+    int range_min;
+    int range_max;
+} temperature_sensor_config_t;
+
+#define TEMPERATURE_SENSOR_CONFIG_DEFAULT(min, max) { (min), (max) }
+
+struct temperature_sensor_obj_t;
+typedef struct temperature_sensor_obj_t* temperature_sensor_handle_t;
+
+esp_err_t temperature_sensor_install(const temperature_sensor_config_t* config, temperature_sensor_handle_t* handle);
+esp_err_t temperature_sensor_uninstall(temperature_sensor_handle_t handle);
+esp_err_t temperature_sensor_enable(temperature_sensor_handle_t handle);
+esp_err_t temperature_sensor_disable(temperature_sensor_handle_t handle);
+esp_err_t temperature_sensor_get_celsius(temperature_sensor_handle_t handle, float* celsius);
+
+#endif // SIM_ESP_TEMPERATURE_SENSOR_H
@@ -0,0 +1,9 @@
+// Host simulation shim: esp_timer reads the simulated monotonic clock
+#ifndef SIM_ESP_TIMER_H
+#define SIM_ESP_TIMER_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time();
+
+#endif // SIM_ESP_TIMER_H
@@ -0,0 +1,14 @@
+// Host simulation shim: VFS registration of a FatFs drive. Paths under the
+// base path are not routed to POSIX calls on the host; firmware reaches the
+// volume through the FatFs API.
+#ifndef SIM_ESP_VFS_FAT_H
+#define SIM_ESP_VFS_FAT_H
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "ff.h"
+
+esp_err_t esp_vfs_fat_register(const char* base_path, const char* fat_drive, size_t max_files, FATFS** out_fs);
+esp_err_t esp_vfs_fat_unregister_path(const char* base_path);
+
+#endif // SIM_ESP_VFS_FAT_H
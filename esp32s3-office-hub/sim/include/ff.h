@@ -0,0 +1,141 @@
+// Host simulation shim: the FatFs API subset the hub uses, implemented in
+// sim_fatfs.cpp over the registered diskio drivers. FAT16 and FAT32 with long
+// file names; the on-disk format matches what the device's FatFs reads.
+#ifndef SIM_FF_H
+#define SIM_FF_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t BYTE;
+typedef uint16_t WORD;
+typedef uint32_t DWORD;
+typedef unsigned int UINT;
+typedef char TCHAR;
+typedef DWORD LBA_t;
+typedef DWORD FSIZE_t;
+
+#define FF_VOLUMES 2
+#define FF_MIN_SS 512
+#define FF_MAX_SS 4096
+#define FF_MAX_LFN 255
+
+typedef enum {
+    FR_OK = 0,
+    FR_DISK_ERR,
+    FR_INT_ERR,
+    FR_NOT_READY,
+    FR_NO_FILE,
+    FR_NO_PATH,
+    FR_INVALID_NAME,
+    FR_DENIED,
+    FR_EXIST,
+    FR_INVALID_OBJECT,
+    FR_WRITE_PROTECTED,
+    FR_INVALID_DRIVE,
+    FR_NOT_ENABLED,
+    FR_NO_FILESYSTEM,
+    FR_MKFS_ABORTED,
+    FR_TIMEOUT,
+    FR_LOCKED,
+    FR_NOT_ENOUGH_CORE,
+    FR_TOO_MANY_OPEN_FILES,
+    FR_INVALID_PARAMETER
+} FRESULT;
+
+#define FS_FAT12 1
+#define FS_FAT16 2
+#define FS_FAT32 3
+#define FS_EXFAT 4
+
+#define FA_READ 0x01
+#define FA_WRITE 0x02
+#define FA_OPEN_EXISTING 0x00
+#define FA_CREATE_NEW 0x04
+#define FA_CREATE_ALWAYS 0x08
+#define FA_OPEN_ALWAYS 0x10
+#define FA_OPEN_APPEND 0x30
+
+#define AM_RDO 0x01
+#define AM_HID 0x02
+#define AM_SYS 0x04
+#define AM_DIR 0x10
+#define AM_ARC 0x20
+
+typedef struct {
+    BYTE fs_type;
+    BYTE pdrv;
+    BYTE n_fats;
+    BYTE wflag;
+    BYTE fsi_flag;
+    WORD ssize;
+    WORD csize;
+    WORD n_rootdir;
+    DWORD n_fatent;
+    DWORD fsize;
+    DWORD free_clst;
+    DWORD last_clst;
+    LBA_t volbase;
+    LBA_t fatbase;
+    LBA_t dirbase;      // Root directory sector (FAT16) or cluster (FAT32)
+    LBA_t database;
+    LBA_t fsi_sect;
+    LBA_t winsect;
+    BYTE win[FF_MAX_SS];
+} FATFS;
+
+typedef struct {
+    FATFS* fs;
+    DWORD sclust;
+    FSIZE_t objsize;
+} FFOBJID;
+
+typedef struct {
+    FFOBJID obj;
+    BYTE flag;
+    FSIZE_t fptr;
+    DWORD clust;        // Cluster holding fptr and its index in the chain
+    DWORD clust_index;
+    LBA_t sect;         // Sector cached in buf, 0 if none
+    LBA_t dir_sect;
+    UINT dir_offset;
+    BYTE buf[FF_MAX_SS];
+} FIL;
+
+typedef struct {
+    FFOBJID obj;
+    DWORD dptr;         // Entry index
+    DWORD clust;
+    LBA_t sect;         // 0 once the end is reached
+} DIR;
+
+typedef struct {
+    FSIZE_t fsize;
+    WORD fdate;
+    WORD ftime;
+    BYTE fattrib;
+    TCHAR altname[13];
+    TCHAR fname[FF_MAX_LFN + 1];
+} FILINFO;
+
+FRESULT f_mount(FATFS* fs, const TCHAR* path, BYTE opt);
+FRESULT f_open(FIL* fp, const TCHAR* path, BYTE mode);
+FRESULT f_close(FIL* fp);
+FRESULT f_read(FIL* fp, void* buff, UINT btr, UINT* br);
+FRESULT f_write(FIL* fp, const void* buff, UINT btw, UINT* bw);
+FRESULT f_lseek(FIL* fp, FSIZE_t ofs);
+FRESULT f_sync(FIL* fp);
+FRESULT f_opendir(DIR* dp, const TCHAR* path);
+FRESULT f_closedir(DIR* dp);
+FRESULT f_readdir(DIR* dp, FILINFO* fno);
+FRESULT f_stat(const TCHAR* path, FILINFO* fno);
+FRESULT f_unlink(const TCHAR* path);
+FRESULT f_mkdir(const TCHAR* path);
+FRESULT f_rename(const TCHAR* path_old, const TCHAR* path_new);
+FRESULT f_getfree(const TCHAR* path, DWORD* nclst, FATFS** fatfs);
+
+#define f_size(fp) ((fp)->obj.objsize)
+#define f_tell(fp) ((fp)->fptr)
+#define f_eof(fp) ((int)((fp)->fptr == (fp)->obj.objsize))
+
+#endif // SIM_FF_H
@@ -0,0 +1,18 @@
+// Host-side compiler from LED sequence source text to the bytecode in led_sequence.h
+#ifndef SIM_LEDSEQ_COMPILER_H
+#define SIM_LEDSEQ_COMPILER_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace sim {
+
+// error is "line N: reason" on failure; the output always passes LedSequence::validate
+bool compileSequence(const std::string& source, std::vector<uint8_t>& bytecode, std::string& error);
+
+std::string toHex(const std::vector<uint8_t>& bytes);
+
+} // namespace sim
+
+#endif // SIM_LEDSEQ_COMPILER_H
@@ -0,0 +1,96 @@
+// Controls for the host simulation: virtual clock, scripted sensors,
+// in-memory filesystem, simulated WiFi, USB devices and allocation counters.
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+
+#include <stdint.h>
+#include <atomic>
+#include <functional>
+#include <string>
+
+namespace sim {
+
+// Monotonic clock. Virtual by default: time only moves when firmware code
+// sleeps (delay, vTaskDelay, ulTaskNotifyTake) or the runner advances it.
+uint64_t nowUs();
+void advanceUs(uint64_t us);
+void setRealtime(bool enabled);
+bool isRealtime();
+
+// Deferred callbacks on the simulated timeline (WiFi events and the like)
+void scheduleAt(uint64_t atUs, std::function<void()> callback);
+void runDueEvents();
+
+// Serial output, muted during benchmarks
+void setSerialEcho(bool enabled);
+uint64_t getSerialBytes();
+
+// Temperature sensor curve, degrees C as a function of simulated time in ms.
+// Named presets: steady, ramp, sine, spike, cold.
+typedef std::function<float(uint64_t ms)> TemperatureCurve;
+void setTemperatureCurve(TemperatureCurve curve);
+bool setTemperatureCurve(const std::string& preset);
+float readTemperature();
+
+// In-memory SPIFFS
+void seedFile(const std::string& path, const std::string& contents);
+int seedFromDirectory(const std::string& hostDir);
+bool readFile(const std::string& path, std::string& contents);
+size_t getFileCount();
+
+// Simulated access points for scans and association
+void addNetwork(const std::string& ssid, int32_t rssi, uint8_t channel, bool open = false);
+void setAssociationDelayMs(uint32_t ms);
+void dropConnection();
+
+// Wall clock seen by NTPClient, UTC seconds; 0 keeps NTP unsynced
+void setWallClock(uint32_t epochSeconds);
+
+// USB mass storage on the host port, backed by a disk image file. Attach and
+// detach raise the host client events after delayMs of simulated time.
+bool attachUsbImage(const std::string& path, uint32_t delayMs = 0);
+void detachUsbImage(uint32_t delayMs = 0);
+// Fresh FAT16 (under 64 MB) or FAT32 image of sizeMB, 512-byte sectors
+bool formatFatImage(const std::string& path, uint32_t sizeMB);
+
+struct UsbStats {
+    uint64_t commands;
+    uint64_t blocksRead;
+    uint64_t blocksWritten;
+    uint64_t busyUs;        // Simulated bus time spent in commands
+};
+UsbStats getUsbStats();
+void resetUsbStats();
+
+// A USB-serial adapter wired in loopback (TX to RX, RTS to CTS) on the host
+// port instead of a stick: what the hub writes comes back one character time
+// per byte at the line coding it set. Runs in real time, so use it with
+// setRealtime(true).
+bool attachUsbSerialLoopback(uint32_t delayMs = 0);
+void detachUsbSerialLoopback(uint32_t delayMs = 0);
+
+struct SerialLoopbackState {
+    uint32_t baud;
+    uint8_t dataBits;
+    uint8_t parity;
+    uint8_t stopBits;
+    bool dtr;
+    bool rts;
+    uint64_t echoed;        // Bytes that went round the wire
+};
+SerialLoopbackState getSerialLoopbackState();
+
+// Every operator new and heap_caps allocation is counted; blocks on the
+// internal heap (operator new and heap_caps without MALLOC_CAP_SPIRAM) are
+// also counted as they come and go, so a leak shows as allocs != frees
+struct AllocCounters {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> internalAllocs{0};
+    std::atomic<uint64_t> internalFrees{0};
+};
+AllocCounters& allocations();
+
+} // namespace sim
+
+#endif // SIM_HAL_H
@@ -0,0 +1,114 @@
+// Host simulation shim: the ESP-IDF USB host types and calls the hub and
+// esp32-usb-host use. One simulated port; see sim_usb.cpp.
+#ifndef SIM_USB_USB_HOST_H
+#define SIM_USB_USB_HOST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#define USB_CLASS_COMM 0x02
+#define USB_CLASS_MASS_STORAGE 0x08
+#define USB_CLASS_CDC_DATA 0x0a
+
+typedef struct usb_host_client_s* usb_host_client_handle_t;
+typedef struct usb_device_handle_s* usb_device_handle_t;
+
+typedef enum {
+    USB_HOST_CLIENT_EVENT_NEW_DEV = 1,
+    USB_HOST_CLIENT_EVENT_DEV_GONE
+} usb_host_client_event_t;
+
+typedef struct {
+    usb_host_client_event_t event;
+    union {
+        struct {
+            uint8_t address;
+        } new_dev;
+        struct {
+            usb_device_handle_t dev_hdl;
+        } dev_gone;
+    };
+} usb_host_client_event_msg_t;
+
+typedef void (*usb_host_client_event_cb_t)(const usb_host_client_event_msg_t* event_msg, void* arg);
+
+typedef struct {
+    uint8_t bLength;
+    uint8_t bDescriptorType;
+    uint16_t bcdUSB;
+    uint8_t bDeviceClass;
+    uint8_t bDeviceSubClass;
+    uint8_t bDeviceProtocol;
+    uint8_t bMaxPacketSize0;
+    uint16_t idVendor;
+    uint16_t idProduct;
+    uint16_t bcdDevice;
+    uint8_t iManufacturer;
+    uint8_t iProduct;
+    uint8_t iSerialNumber;
+    uint8_t bNumConfigurations;
+} usb_device_desc_t;
+
+typedef struct {
+    uint8_t bLength;
+    uint8_t bDescriptorType;
+    uint16_t wTotalLength;
+    uint8_t bNumInterfaces;
+    uint8_t bConfigurationValue;
+    uint8_t iConfiguration;
+    uint8_t bmAttributes;
+    uint8_t bMaxPower;
+} usb_config_desc_t;
+
+typedef struct {
+    uint8_t bLength;
+    uint8_t bDescriptorType;
+    uint8_t bInterfaceNumber;
+    uint8_t bAlternateSetting;
+    uint8_t bNumEndpoints;
+    uint8_t bInterfaceClass;
+    uint8_t bInterfaceSubClass;
+    uint8_t bInterfaceProtocol;
+    uint8_t iInterface;
+} usb_intf_desc_t;
+
+typedef struct {
+    uint8_t bLength;
+    uint8_t bDescriptorType;
+    uint16_t wData[32];     // UTF-16LE, (bLength - 2) / 2 characters
+} usb_str_desc_t;
+
+typedef struct {
+    uint8_t speed;
+    uint8_t dev_addr;
+    uint8_t bMaxPacketSize0;
+    uint8_t bConfigurationValue;
+    const usb_str_desc_t* str_desc_manufacturer;
+    const usb_str_desc_t* str_desc_product;
+    const usb_str_desc_t* str_desc_serial_num;
+} usb_device_info_t;
+
+typedef struct usb_transfer_s usb_transfer_t;
+typedef void (*usb_transfer_cb_t)(usb_transfer_t* transfer);
+
+struct usb_transfer_s {
+    uint8_t* data_buffer;
+    size_t data_buffer_size;
+    int num_bytes;
+    int actual_num_bytes;
+    uint32_t flags;
+    usb_device_handle_t device_handle;
+    uint8_t bEndpointAddress;
+    int status;
+    uint32_t timeout_ms;
+    usb_transfer_cb_t callback;
+    void* context;
+};
+
+const usb_intf_desc_t* usb_parse_interface_descriptor(const usb_config_desc_t* config_desc, uint8_t bInterfaceNumber,
+                                                      uint8_t bAlternateSetting, int* offset);
+esp_err_t usb_host_interface_release(usb_host_client_handle_t client_hdl, usb_device_handle_t dev_hdl,
+                                     uint8_t bInterfaceNumber);
+
+#endif // SIM_USB_USB_HOST_H
@@ -0,0 +1,42 @@
+// Host simulation shim: esp32-usb-host's USBacmDevice on the simulated port.
+// Behind it is the loopback serial adapter plugged in with
+// sim::attachUsbSerialLoopback, which echoes what it is sent at the line
+// rate. Transfers complete on the adapter's own thread, standing in for the
+// library's client task.
+#ifndef SIM_USB_ACM_HPP
+#define SIM_USB_ACM_HPP
+
+#include "usb_host.hpp"
+
+#define CDC_DATA_IN                             1
+#define CDC_DATA_OUT                            2
+#define CDC_CTRL_SET_CONTROL_LINE_STATE         3
+#define CDC_CTRL_SET_LINE_CODING                4
+#define CDC_CTRL_GET_LINE_CODING                5
+
+typedef void (*usb_host_event_cb_t)(int, void* data, size_t len);
+
+class USBacmDevice
+{
+    friend struct SimSerialAdapter;
+
+private:
+    USBhost* _host;
+    bool connected = false;
+    usb_host_event_cb_t event_cb = nullptr;
+
+public:
+    USBacmDevice(const usb_config_desc_t* config_desc, USBhost*);
+    ~USBacmDevice();
+
+    bool init();
+    void setControlLine(bool dtr, bool rts);
+    void setLineCoding(uint32_t bitrate, uint8_t cf, uint8_t parity, uint8_t bits);
+    void getLineCoding();
+    void INDATA(size_t len = 64);
+    void OUTDATA(uint8_t*, size_t);
+    bool isConnected();
+    void onEvent(usb_host_event_cb_t _cb) { event_cb = _cb; }
+};
+
+#endif // SIM_USB_ACM_HPP
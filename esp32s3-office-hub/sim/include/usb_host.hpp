@@ -0,0 +1,34 @@
+// Host simulation shim: esp32-usb-host's USBhost on the simulated port.
+// Client events are delivered from an "async" task, as the library does.
+#ifndef SIM_USB_HOST_HPP
+#define SIM_USB_HOST_HPP
+
+#include "usb/usb_host.h"
+
+class USBhost
+{
+    friend void _client_event_callback(const usb_host_client_event_msg_t *event_msg, void *arg);
+
+protected:
+    usb_device_handle_t dev_hdl = nullptr;
+    usb_host_client_event_cb_t _client_event_cb = nullptr;
+
+public:
+    USBhost();
+    ~USBhost();
+
+    usb_host_client_handle_t client_hdl = nullptr;
+    bool init(bool create_tasks = true);
+    bool open(const usb_host_client_event_msg_t *event_msg);
+    void close();
+    usb_device_info_t getDeviceInfo();
+    const usb_device_desc_t* getDeviceDescriptor();
+    const usb_config_desc_t* getConfigurationDescriptor();
+
+    usb_host_client_handle_t clientHandle();
+    usb_device_handle_t deviceHandle();
+
+    void registerClientCb(usb_host_client_event_cb_t cb) { _client_event_cb = cb; }
+};
+
+#endif // SIM_USB_HOST_HPP
@@ -0,0 +1,43 @@
+// Host simulation shim: esp32-usb-host's USBmscDevice backed by the disk
+// image attached with sim::attachUsbImage. Commands complete synchronously
+// and advance the simulated clock by a full-speed bulk transfer time.
+#ifndef SIM_USB_MSC_HPP
+#define SIM_USB_MSC_HPP
+
+#include "esp_err.h"
+#include "usb_host.hpp"
+
+typedef struct {
+    usb_transfer_cb_t cbw_cb;
+    usb_transfer_cb_t data_cb;
+    usb_transfer_cb_t csw_cb;
+    usb_transfer_cb_t capacity_cb;
+    usb_transfer_cb_t inquiry_cb;
+    usb_transfer_cb_t unit_ready_cb;
+    usb_transfer_cb_t max_luns_cb;
+    usb_transfer_cb_t sense_cb;
+} msc_transfer_cb_t;
+
+class USBmscDevice
+{
+private:
+    USBhost* _host;
+    uint32_t block_count = 0;
+    uint32_t block_size = 512;
+    msc_transfer_cb_t callbacks = {};
+
+public:
+    USBmscDevice(const usb_config_desc_t* config_desc, USBhost*);
+    ~USBmscDevice();
+
+    bool            init();
+    uint8_t         getMaxLUN();
+    uint32_t        getBlockCount(uint8_t lun = 0);
+    uint16_t        getBlockSize(uint8_t lun = 0);
+    void            registerCallbacks(msc_transfer_cb_t);
+
+    esp_err_t _read10 (uint8_t lun, int offset, int num_sectors, uint8_t* buff);
+    esp_err_t _write10(uint8_t lun, int offset, int num_sectors, uint8_t* buff);
+};
+
+#endif // SIM_USB_MSC_HPP
@@ -0,0 +1,268 @@
+// LED sequence compiler. One statement per line, '#' starts a comment:
+//
+//   palette warm #FF8000        name a colour (a literal #RRGGBB also works inline)
+//   track                       start a track, up to LEDSEQ_MAX_TRACKS
+//     segment desk              desk, shelf, status, all or a zone index
+//     set warm                  rgb #RRGGBB sets a colour without the palette
+//     loop [count]              no count repeats forever
+//       fade warm 1500 [linear|in_out|step]
+//       wait 500
+//       effect pulse warm 4000  any LED mode for the given time
+//       gradient warm off
+//     next
+//   end
+#include "ledseq_compiler.h"
+#include "led_controller.h"
+#include "led_sequence.h"
+
+#include <map>
+#include <sstream>
+
+namespace sim {
+
+namespace {
+
+struct Compiler {
+    std::map<std::string, uint8_t> colorNames;
+    std::vector<uint32_t> palette;
+    std::vector<uint16_t> trackOffsets;
+    std::vector<uint8_t> code;
+    std::string error;
+    int line = 0;
+    bool inTrack = false;
+    int depth = 0;
+
+    bool fail(const std::string& reason) {
+        error = "line " + std::to_string(line) + ": " + reason;
+        return false;
+    }
+
+    static bool parseHex(const std::string& token, uint32_t& rgb) {
+        if (token.size() != 7 || token[0] != '#') return false;
+        char* end;
+        rgb = strtoul(token.c_str() + 1, &end, 16);
+        return *end == '\0';
+    }
+
+    bool parseNumber(const std::string& token, uint32_t max, uint32_t& value) {
+        char* end;
+        unsigned long parsed = strtoul(token.c_str(), &end, 10);
+        if (token.empty() || *end != '\0' || parsed > max) {
+            return fail("expected a number up to " + std::to_string(max) + ", got '" + token + "'");
+        }
+        value = parsed;
+        return true;
+    }
+
+    bool color(const std::string& token, uint8_t& index) {
+        uint32_t rgb;
+        if (parseHex(token, rgb)) {
+            // Literals share palette slots with identical named colours
+            for (size_t i = 0; i < palette.size(); i++) {
+                if (palette[i] == rgb) {
+                    index = i;
+                    return true;
+                }
+            }
+            if (palette.size() >= LEDSEQ_MAX_PALETTE) return fail("more than " + std::to_string(LEDSEQ_MAX_PALETTE) + " colours");
+            palette.push_back(rgb);
+            index = palette.size() - 1;
+            return true;
+        }
+        auto it = colorNames.find(token);
+        if (it == colorNames.end()) return fail("unknown colour '" + token + "'");
+        index = it->second;
+        return true;
+    }
+
+    void emit16(uint32_t value) {
+        code.push_back(value & 0xFF);
+        code.push_back(value >> 8);
+    }
+
+    bool statement(const std::vector<std::string>& args) {
+        const std::string& op = args[0];
+        size_t argc = args.size() - 1;
+
+        if (op == "palette") {
+            uint32_t rgb;
+            if (argc != 2 || !parseHex(args[2], rgb)) return fail("usage: palette NAME #RRGGBB");
+            if (colorNames.count(args[1])) return fail("colour '" + args[1] + "' already defined");
+            uint8_t index;
+            if (!color(args[2], index)) return false;
+            colorNames[args[1]] = index;
+            return true;
+        }
+        if (op == "track") {
+            if (inTrack) return fail("track inside a track, missing end");
+            if (trackOffsets.size() >= LEDSEQ_MAX_TRACKS) return fail("more than " + std::to_string(LEDSEQ_MAX_TRACKS) + " tracks");
+            trackOffsets.push_back(code.size());
+            inTrack = true;
+            return true;
+        }
+        if (!inTrack) return fail("'" + op + "' outside a track");
+
+        uint8_t a, b;
+        uint32_t n;
+        if (op == "end") {
+            if (depth != 0) return fail("end inside a loop");
+            code.push_back(LEDSEQ_END);
+            inTrack = false;
+        } else if (op == "segment") {
+            if (argc != 1) return fail("usage: segment NAME|all|INDEX");
+            int zone = args[1] == "all" ? LEDSEQ_ALL_SEGMENTS : LEDController::findZone(args[1].c_str());
+            if (zone < 0) {
+                if (!parseNumber(args[1], MAX_LED_SEGMENTS - 1, n)) return false;
+                zone = n;
+            }
+            code.push_back(LEDSEQ_SEGMENT);
+            code.push_back(zone);
+        } else if (op == "set") {
+            if (argc != 1 || !color(args[1], a)) return error.empty() ? fail("usage: set COLOUR") : false;
+            code.push_back(LEDSEQ_SET);
+            code.push_back(a);
+        } else if (op == "rgb") {
+            uint32_t rgb;
+            if (argc != 1 || !parseHex(args[1], rgb)) return fail("usage: rgb #RRGGBB");
+            code.push_back(LEDSEQ_RGB);
+            code.push_back(rgb >> 16);
+            code.push_back(rgb >> 8);
+            code.push_back(rgb);
+        } else if (op == "fade") {
+            if (argc < 2 || argc > 3) return fail("usage: fade COLOUR MS [linear|in_out|step]");
+            if (!color(args[1], a) || !parseNumber(args[2], 65535, n)) return false;
+            uint8_t ease = LEDSEQ_EASE_LINEAR;
+            if (argc == 3) {
+                if (args[3] == "in_out") ease = LEDSEQ_EASE_IN_OUT;
+                else if (args[3] == "step") ease = LEDSEQ_EASE_STEP;
+                else if (args[3] != "linear") return fail("unknown easing '" + args[3] + "'");
+            }
+            code.push_back(LEDSEQ_FADE);
+            code.push_back(a);
+            emit16(n);
+            code.push_back(ease);
+        } else if (op == "wait") {
+            if (argc != 1) return fail("usage: wait MS");
+            if (!parseNumber(args[1], 65535, n)) return false;
+            code.push_back(LEDSEQ_WAIT);
+            emit16(n);
+        } else if (op == "loop") {
+            n = 0;
+            if (argc > 1 || (argc == 1 && !parseNumber(args[1], 255, n))) return error.empty() ? fail("usage: loop [COUNT]") : false;
+            if (argc == 1 && n == 0) return fail("loop count must be 1-255, omit it to repeat forever");
+            if (++depth > LEDSEQ_MAX_LOOP_DEPTH) return fail("loops nested deeper than " + std::to_string(LEDSEQ_MAX_LOOP_DEPTH));
+            code.push_back(LEDSEQ_LOOP);
+            code.push_back(n);
+        } else if (op == "next") {
+            if (--depth < 0) return fail("next without loop");
+            code.push_back(LEDSEQ_NEXT);
+        } else if (op == "gradient") {
+            if (argc != 2) return fail("usage: gradient COLOUR COLOUR");
+            if (!color(args[1], a) || !color(args[2], b)) return false;
+            code.push_back(LEDSEQ_GRADIENT);
+            code.push_back(a);
+            code.push_back(b);
+        } else if (op == "effect") {
+            LEDMode mode;
+            if (argc != 3) return fail("usage: effect MODE COLOUR MS");
+            if (!LEDController::parseMode(args[1].c_str(), mode)) return fail("unknown mode '" + args[1] + "'");
+            if (!color(args[2], a) || !parseNumber(args[3], 65535, n)) return false;
+            code.push_back(LEDSEQ_EFFECT);
+            code.push_back(mode);
+            code.push_back(a);
+            emit16(n);
+        } else {
+            return fail("unknown statement '" + op + "'");
+        }
+        return true;
+    }
+};
+
+} // namespace
+
+bool compileSequence(const std::string& source, std::vector<uint8_t>& bytecode, std::string& error) {
+    Compiler compiler;
+    std::istringstream input(source);
+    std::string text;
+
+    while (std::getline(input, text)) {
+        compiler.line++;
+        size_t comment = text.find('#');
+        // '#' followed by six hex digits is a colour, anything else starts a comment
+        while (comment != std::string::npos) {
+            uint32_t rgb;
+            if (!Compiler::parseHex(text.substr(comment, 7), rgb) ||
+                (comment + 7 < text.size() && !isspace((unsigned char)text[comment + 7]))) {
+                text.erase(comment);
+                break;
+            }
+            comment = text.find('#', comment + 7);
+        }
+
+        std::istringstream words(text);
+        std::vector<std::string> args;
+        std::string word;
+        while (words >> word) args.push_back(word);
+        if (args.empty()) continue;
+
+        if (!compiler.statement(args)) {
+            error = compiler.error;
+            return false;
+        }
+    }
+
+    if (compiler.inTrack) {
+        error = "track " + std::to_string(compiler.trackOffsets.size() - 1) + " has no end";
+        return false;
+    }
+    if (compiler.trackOffsets.empty()) {
+        error = "no tracks";
+        return false;
+    }
+
+    size_t size = LEDSEQ_HEADER_SIZE + compiler.trackOffsets.size() * 2 + compiler.palette.size() * 3 + compiler.code.size();
+    if (size > LEDSEQ_MAX_SIZE) {
+        error = std::to_string(size) + " bytes, the limit is " + std::to_string(LEDSEQ_MAX_SIZE);
+        return false;
+    }
+
+    bytecode.clear();
+    bytecode.push_back('L');
+    bytecode.push_back('S');
+    bytecode.push_back('Q');
+    bytecode.push_back(LEDSEQ_VERSION);
+    bytecode.push_back(compiler.trackOffsets.size());
+    bytecode.push_back(compiler.palette.size());
+    bytecode.push_back(compiler.code.size() & 0xFF);
+    bytecode.push_back(compiler.code.size() >> 8);
+    for (uint16_t offset : compiler.trackOffsets) {
+        bytecode.push_back(offset & 0xFF);
+        bytecode.push_back(offset >> 8);
+    }
+    for (uint32_t rgb : compiler.palette) {
+        bytecode.push_back(rgb >> 16);
+        bytecode.push_back(rgb >> 8);
+        bytecode.push_back(rgb);
+    }
+    bytecode.insert(bytecode.end(), compiler.code.begin(), compiler.code.end());
+
+    String invalid;
+    if (!LedSequence::validate(bytecode.data(), bytecode.size(), invalid)) {
+        error = std::string("internal error, output rejected: ") + invalid.c_str();
+        return false;
+    }
+    return true;
+}
+
+std::string toHex(const std::vector<uint8_t>& bytes) {
+    static const char digits[] = "0123456789ABCDEF";
+    std::string hex;
+    hex.reserve(bytes.size() * 2);
+    for (uint8_t b : bytes) {
+        hex += digits[b >> 4];
+        hex += digits[b & 0x0F];
+    }
+    return hex;
+}
+
+} // namespace sim
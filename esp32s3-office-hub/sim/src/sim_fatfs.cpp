@@ -0,0 +1,1435 @@
+// FatFs on the host: FAT16 and FAT32 with long file names over the diskio
+// drivers the firmware registers. Covers the API in sim/include/ff.h; the
+// device links ESP-IDF's FatFs instead. Images written here mount on a PC.
+#include "ff.h"
+#include "diskio_impl.h"
+#include "esp_vfs_fat.h"
+#include "block_device.h"
+#include "sim_hal.h"
+
+#include <ctype.h>
+#include <mutex>
+#include <string>
+#include <string.h>
+#include <time.h>
+
+#define FA_MODIFIED 0x40        // Directory entry needs rewriting
+#define FA_DIRTY 0x80           // buf differs from the disk
+#define AM_VOL 0x08
+#define AM_LFN 0x0F
+#define DIR_ENTRY_SIZE 32
+#define LFN_CHARS 13
+#define DELETED_MARK 0xE5
+#define SIM_FAT_EPOCH 1767225600  // 2026-01-01, plus simulated uptime, for timestamps
+
+namespace {
+
+const ff_diskio_impl_t* drivers[FF_VOLUMES];
+FATFS* volumes[FF_VOLUMES];
+std::string vfsPaths[FF_VOLUMES];
+FATFS* vfsVolumes[FF_VOLUMES];     // Owned by the VFS registration, as in ESP-IDF
+std::recursive_mutex fsLock;   // The device's FatFs is built reentrant too
+
+const int lfnOffsets[LFN_CHARS] = {1, 3, 5, 7, 9, 14, 16, 18, 20, 22, 24, 28, 30};
+
+WORD ld16(const BYTE* p) { return p[0] | (p[1] << 8); }
+DWORD ld32(const BYTE* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((DWORD)p[3] << 24); }
+void st16(BYTE* p, WORD v) { p[0] = v; p[1] = v >> 8; }
+void st32(BYTE* p, DWORD v) { p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24; }
+
+DWORD fatTime() {
+    time_t now = SIM_FAT_EPOCH + (time_t)(sim::nowUs() / 1000000);
+    struct tm t;
+    gmtime_r(&now, &t);
+    return ((DWORD)(t.tm_year - 80) << 25) | ((DWORD)(t.tm_mon + 1) << 21) | ((DWORD)t.tm_mday << 16) |
+           (t.tm_hour << 11) | (t.tm_min << 5) | (t.tm_sec / 2);
+}
+
+void stampEntry(BYTE* e, bool created) {
+    DWORD tm = fatTime();
+    if (created) {
+        st16(e + 14, tm);
+        st16(e + 16, tm >> 16);
+    }
+    st16(e + 18, tm >> 16);
+    st16(e + 22, tm);
+    st16(e + 24, tm >> 16);
+}
+
+// ---------------------------------------------------------------------------
+// Sector window, FAT and cluster chains
+// ---------------------------------------------------------------------------
+
+bool diskRead(FATFS* fs, BYTE* buffer, LBA_t sector, UINT count) {
+    const ff_diskio_impl_t* drv = drivers[fs->pdrv];
+    return drv && drv->read(fs->pdrv, buffer, sector, count) == RES_OK;
+}
+
+bool diskWrite(FATFS* fs, const BYTE* buffer, LBA_t sector, UINT count) {
+    const ff_diskio_impl_t* drv = drivers[fs->pdrv];
+    return drv && drv->write(fs->pdrv, buffer, sector, count) == RES_OK;
+}
+
+LBA_t clusterSector(FATFS* fs, DWORD clst) {
+    return fs->database + (LBA_t)fs->csize * (clst - 2);
+}
+
+FRESULT syncWindow(FATFS* fs) {
+    if (!fs->wflag) return FR_OK;
+    if (!diskWrite(fs, fs->win, fs->winsect, 1)) return FR_DISK_ERR;
+    // FAT sectors are mirrored into every copy
+    if (fs->winsect >= fs->fatbase && fs->winsect < fs->fatbase + fs->fsize) {
+        for (BYTE n = 1; n < fs->n_fats; n++) {
+            if (!diskWrite(fs, fs->win, fs->winsect + n * fs->fsize, 1)) return FR_DISK_ERR;
+        }
+    }
+    fs->wflag = 0;
+    return FR_OK;
+}
+
+FRESULT moveWindow(FATFS* fs, LBA_t sector) {
+    if (sector == fs->winsect) return FR_OK;
+    FRESULT res = syncWindow(fs);
+    if (res != FR_OK) return res;
+    if (!diskRead(fs, fs->win, sector, 1)) {
+        fs->winsect = (LBA_t)-1;
+        return FR_DISK_ERR;
+    }
+    fs->winsect = sector;
+    return FR_OK;
+}
+
+FRESULT syncFs(FATFS* fs) {
+    FRESULT res = syncWindow(fs);
+    if (res != FR_OK) return res;
+
+    if (fs->fs_type == FS_FAT32 && fs->fsi_flag) {
+        res = moveWindow(fs, fs->fsi_sect);
+        if (res != FR_OK) return res;
+        if (ld32(fs->win) == 0x41615252 && ld32(fs->win + 484) == 0x61417272) {
+            st32(fs->win + 488, fs->free_clst);
+            st32(fs->win + 492, fs->last_clst);
+            fs->wflag = 1;
+            res = syncWindow(fs);
+            if (res != FR_OK) return res;
+        }
+        fs->fsi_flag = 0;
+    }
+
+    const ff_diskio_impl_t* drv = drivers[fs->pdrv];
+    return drv && drv->ioctl(fs->pdrv, CTRL_SYNC, NULL) == RES_OK ? FR_OK : FR_DISK_ERR;
+}
+
+// Next cluster in the chain: >= n_fatent at the end, 0xFFFFFFFF on a disk error
+DWORD getFat(FATFS* fs, DWORD clst) {
+    if (clst < 2 || clst >= fs->n_fatent) return 1;
+
+    DWORD bytes = fs->fs_type == FS_FAT16 ? 2 : 4;
+    DWORD offset = clst * bytes;
+    if (moveWindow(fs, fs->fatbase + offset / fs->ssize) != FR_OK) return 0xFFFFFFFF;
+    const BYTE* p = fs->win + offset % fs->ssize;
+    return bytes == 2 ? ld16(p) : ld32(p) & 0x0FFFFFFF;
+}
+
+FRESULT putFat(FATFS* fs, DWORD clst, DWORD value) {
+    if (clst < 2 || clst >= fs->n_fatent) return FR_INT_ERR;
+
+    DWORD bytes = fs->fs_type == FS_FAT16 ? 2 : 4;
+    DWORD offset = clst * bytes;
+    FRESULT res = moveWindow(fs, fs->fatbase + offset / fs->ssize);
+    if (res != FR_OK) return res;
+    BYTE* p = fs->win + offset % fs->ssize;
+    if (bytes == 2) {
+        st16(p, (WORD)value);
+    } else {
+        st32(p, (ld32(p) & 0xF0000000) | (value & 0x0FFFFFFF));
+    }
+    fs->wflag = 1;
+    return FR_OK;
+}
+
+// Allocates a cluster and links it after clst (0 starts a new chain).
+// Returns 0 when the volume is full, 0xFFFFFFFF on a disk error.
+DWORD createChain(FATFS* fs, DWORD clst) {
+    DWORD total = fs->n_fatent - 2;
+    if (fs->free_clst == 0) return 0;
+
+    DWORD candidate = fs->last_clst >= 2 && fs->last_clst < fs->n_fatent ? fs->last_clst : 1;
+    for (DWORD tried = 0; tried < total; tried++) {
+        candidate = candidate + 1 >= fs->n_fatent ? 2 : candidate + 1;
+        DWORD value = getFat(fs, candidate);
+        if (value == 0xFFFFFFFF) return 0xFFFFFFFF;
+        if (value != 0) continue;
+
+        if (putFat(fs, candidate, 0x0FFFFFFF) != FR_OK) return 0xFFFFFFFF;
+        if (clst && putFat(fs, clst, candidate) != FR_OK) return 0xFFFFFFFF;
+        fs->last_clst = candidate;
+        if (fs->free_clst <= total) fs->free_clst--;
+        fs->fsi_flag = 1;
+        return candidate;
+    }
+    fs->free_clst = 0;
+    return 0;
+}
+
+FRESULT removeChain(FATFS* fs, DWORD clst) {
+    DWORD total = fs->n_fatent - 2;
+    while (clst >= 2 && clst < fs->n_fatent) {
+        DWORD next = getFat(fs, clst);
+        if (next == 0xFFFFFFFF) return FR_DISK_ERR;
+        FRESULT res = putFat(fs, clst, 0);
+        if (res != FR_OK) return res;
+        if (fs->free_clst < total) fs->free_clst++;
+        fs->fsi_flag = 1;
+        clst = next;
+    }
+    return FR_OK;
+}
+
+FRESULT zeroCluster(FATFS* fs, DWORD clst) {
+    FRESULT res = syncWindow(fs);
+    if (res != FR_OK) return res;
+
+    static BYTE zeros[FF_MAX_SS];
+    LBA_t first = clusterSector(fs, clst);
+    for (WORD i = 0; i < fs->csize; i++) {
+        if (!diskWrite(fs, zeros, first + i, 1)) return FR_DISK_ERR;
+    }
+    if (fs->winsect >= first && fs->winsect < first + fs->csize) {
+        fs->winsect = (LBA_t)-1;
+    }
+    return FR_OK;
+}
+
+// ---------------------------------------------------------------------------
+// Directories
+// ---------------------------------------------------------------------------
+
+struct DirPos {
+    FATFS* fs;
+    DWORD sclust;       // 0 for the FAT16 root
+    DWORD clust;
+    LBA_t sect;
+    DWORD index;
+};
+
+struct Entry {
+    DirPos start;       // First slot of the name, an LFN part or the SFN itself
+    DirPos pos;         // The SFN slot
+    DWORD sclust;
+    DWORD size;
+    BYTE attr;
+    WORD wdate;
+    WORD wtime;
+    char name[FF_MAX_LFN * 3 + 1];
+    char altname[13];
+};
+
+DWORD entryCluster(FATFS* fs, const BYTE* e) {
+    DWORD clst = ld16(e + 26);
+    if (fs->fs_type == FS_FAT32) clst |= (DWORD)ld16(e + 20) << 16;
+    return clst;
+}
+
+void setEntryCluster(FATFS* fs, BYTE* e, DWORD clst) {
+    st16(e + 26, clst);
+    st16(e + 20, fs->fs_type == FS_FAT32 ? clst >> 16 : 0);
+}
+
+void dirStart(DirPos& d, FATFS* fs, DWORD sclust) {
+    if (sclust == 0 && fs->fs_type == FS_FAT32) sclust = fs->dirbase;
+    d.fs = fs;
+    d.sclust = sclust;
+    d.index = 0;
+    d.clust = sclust;
+    d.sect = sclust ? clusterSector(fs, sclust) : fs->dirbase;
+}
+
+// Steps to the next slot. FR_NO_FILE at the end; with stretch the directory
+// grows by a cluster instead (FR_DENIED if it cannot).
+FRESULT dirNext(DirPos& d, bool stretch) {
+    FATFS* fs = d.fs;
+    DWORD perSector = fs->ssize / DIR_ENTRY_SIZE;
+    DWORD next = d.index + 1;
+
+    if (next % perSector == 0) {
+        if (d.clust == 0) {
+            if (next >= fs->n_rootdir) return stretch ? FR_DENIED : FR_NO_FILE;
+            d.sect++;
+        } else if ((next / perSector) % fs->csize == 0) {
+            DWORD nextClust = getFat(fs, d.clust);
+            if (nextClust == 0xFFFFFFFF) return FR_DISK_ERR;
+            if (nextClust < 2) return FR_INT_ERR;
+            if (nextClust >= fs->n_fatent) {
+                if (!stretch) return FR_NO_FILE;
+                nextClust = createChain(fs, d.clust);
+                if (nextClust == 0) return FR_DENIED;
+                if (nextClust == 0xFFFFFFFF) return FR_DISK_ERR;
+                FRESULT res = zeroCluster(fs, nextClust);
+                if (res != FR_OK) return res;
+            }
+            d.clust = nextClust;
+            d.sect = clusterSector(fs, nextClust);
+        } else {
+            d.sect++;
+        }
+    }
+    d.index = next;
+    return FR_OK;
+}
+
+BYTE* dirSlot(DirPos& d, FRESULT& res) {
+    res = moveWindow(d.fs, d.sect);
+    return d.fs->win + (d.index % (d.fs->ssize / DIR_ENTRY_SIZE)) * DIR_ENTRY_SIZE;
+}
+
+BYTE sfnChecksum(const BYTE* sfn) {
+    BYTE sum = 0;
+    for (int i = 0; i < 11; i++) {
+        sum = ((sum & 1) << 7) + (sum >> 1) + sfn[i];
+    }
+    return sum;
+}
+
+void sfnToString(const BYTE* e, char* out) {
+    int n = 0;
+    for (int i = 0; i < 8 && e[i] != ' '; i++) {
+        char c = (i == 0 && e[i] == 0x05) ? (char)DELETED_MARK : e[i];
+        out[n++] = (e[12] & 0x08) ? tolower(c) : c;
+    }
+    if (e[8] != ' ') {
+        out[n++] = '.';
+        for (int i = 8; i < 11 && e[i] != ' '; i++) {
+            out[n++] = (e[12] & 0x10) ? tolower(e[i]) : e[i];
+        }
+    }
+    out[n] = '\0';
+}
+
+size_t utf8ToUtf16(const std::string& in, WORD* out, size_t max) {
+    size_t n = 0;
+    for (size_t i = 0; i < in.size() && n < max;) {
+        BYTE c = in[i];
+        WORD wc;
+        if (c < 0x80) {
+            wc = c;
+            i += 1;
+        } else if ((c & 0xE0) == 0xC0 && i + 1 < in.size()) {
+            wc = ((c & 0x1F) << 6) | (in[i + 1] & 0x3F);
+            i += 2;
+        } else if ((c & 0xF0) == 0xE0 && i + 2 < in.size()) {
+            wc = ((c & 0x0F) << 12) | ((in[i + 1] & 0x3F) << 6) | (in[i + 2] & 0x3F);
+            i += 3;
+        } else {
+            wc = '_';
+            i += 1;
+        }
+        out[n++] = wc;
+    }
+    return n;
+}
+
+void utf16ToUtf8(const WORD* in, size_t length, char* out) {
+    size_t n = 0;
+    for (size_t i = 0; i < length && in[i] != 0 && in[i] != 0xFFFF; i++) {
+        WORD wc = in[i];
+        if (wc < 0x80) {
+            out[n++] = wc;
+        } else if (wc < 0x800) {
+            out[n++] = 0xC0 | (wc >> 6);
+            out[n++] = 0x80 | (wc & 0x3F);
+        } else {
+            out[n++] = 0xE0 | (wc >> 12);
+            out[n++] = 0x80 | ((wc >> 6) & 0x3F);
+            out[n++] = 0x80 | (wc & 0x3F);
+        }
+    }
+    out[n] = '\0';
+}
+
+// Reads the entry at d or the first one after it, assembling its long name.
+// Leaves d on the SFN slot; FR_NO_FILE past the last entry.
+FRESULT readEntry(DirPos& d, Entry& entry) {
+    WORD lfn[FF_MAX_LFN + 1];
+    int lfnOrd = 0;
+    int lfnLength = 0;
+    BYTE lfnSum = 0;
+    bool lfnValid = false;
+
+    for (;;) {
+        FRESULT res;
+        BYTE* e = dirSlot(d, res);
+        if (res != FR_OK) return res;
+
+        BYTE c = e[0];
+        BYTE attr = e[11] & 0x3F;
+        if (c == 0) return FR_NO_FILE;
+
+        if (c == DELETED_MARK) {
+            lfnValid = false;
+        } else if (attr == AM_LFN) {
+            BYTE ord = c & 0x3F;
+            if (c & 0x40) {
+                entry.start = d;
+                lfnSum = e[13];
+                lfnOrd = ord;
+                lfnLength = ord * LFN_CHARS;
+                lfnValid = ord >= 1 && lfnLength <= FF_MAX_LFN + LFN_CHARS;
+                memset(lfn, 0, sizeof(lfn));
+            }
+            if (lfnValid && ord == lfnOrd && e[13] == lfnSum) {
+                for (int k = 0; k < LFN_CHARS; k++) {
+                    int index = (ord - 1) * LFN_CHARS + k;
+                    if (index <= FF_MAX_LFN) lfn[index] = ld16(e + lfnOffsets[k]);
+                }
+                lfnOrd--;
+            } else {
+                lfnValid = false;
+            }
+        } else if ((attr & AM_VOL) || c == '.') {
+            lfnValid = false;
+        } else {
+            bool hasLfn = lfnValid && lfnOrd == 0 && sfnChecksum(e) == lfnSum;
+            if (!hasLfn) entry.start = d;
+            entry.pos = d;
+            entry.sclust = entryCluster(d.fs, e);
+            entry.size = ld32(e + 28);
+            entry.attr = attr;
+            entry.wtime = ld16(e + 22);
+            entry.wdate = ld16(e + 24);
+            sfnToString(e, entry.altname);
+            if (hasLfn) {
+                utf16ToUtf8(lfn, lfnLength < FF_MAX_LFN ? lfnLength : FF_MAX_LFN, entry.name);
+            } else {
+                strcpy(entry.name, entry.altname);
+            }
+            return FR_OK;
+        }
+
+        res = dirNext(d, false);
+        if (res != FR_OK) return res;
+    }
+}
+
+FRESULT findEntry(const DirPos& dir, const std::string& name, Entry& entry) {
+    DirPos d = dir;
+    for (;;) {
+        FRESULT res = readEntry(d, entry);
+        if (res != FR_OK) return res;
+        if (strcasecmp(entry.name, name.c_str()) == 0 || strcasecmp(entry.altname, name.c_str()) == 0) {
+            return FR_OK;
+        }
+        res = dirNext(d, false);
+        if (res != FR_OK) return res;
+    }
+}
+
+bool shortNameExists(const DirPos& dir, const BYTE* sfn, FRESULT& res) {
+    DirPos d = dir;
+    for (;;) {
+        BYTE* e = dirSlot(d, res);
+        if (res != FR_OK || e[0] == 0) return false;
+        if (e[0] != DELETED_MARK && (e[11] & 0x3F) != AM_LFN && !(e[11] & AM_VOL) && memcmp(e, sfn, 11) == 0) {
+            return true;
+        }
+        res = dirNext(d, false);
+        if (res != FR_OK) {
+            if (res == FR_NO_FILE) res = FR_OK;
+            return false;
+        }
+    }
+}
+
+bool isShortNameChar(BYTE c) {
+    return c >= 0x80 || isalnum(c) || strchr("!#$%&'()-@^_`{}~", c);
+}
+
+bool isNameChar(BYTE c) {
+    return c >= 0x20 && !strchr("\"*:<>?\\|", c);
+}
+
+// Fills sfn if name is already a valid 8.3 name; lowercase parts are kept
+// through the NT case flags rather than a long name, as Windows does
+bool makeShortName(const std::string& name, BYTE* sfn, BYTE& ntFlags) {
+    size_t dot = name.rfind('.');
+    std::string base = dot == std::string::npos ? name : name.substr(0, dot);
+    std::string ext = dot == std::string::npos ? "" : name.substr(dot + 1);
+    if (base.empty() || base.size() > 8 || ext.size() > 3) return false;
+    if (dot != std::string::npos && ext.empty()) return false;
+
+    ntFlags = 0;
+    memset(sfn, ' ', 11);
+    for (int part = 0; part < 2; part++) {
+        const std::string& text = part == 0 ? base : ext;
+        bool lower = false;
+        bool upper = false;
+        for (size_t i = 0; i < text.size(); i++) {
+            BYTE c = text[i];
+            if (!isShortNameChar(c)) return false;
+            lower |= islower(c) != 0;
+            upper |= isupper(c) != 0;
+            sfn[(part == 0 ? 0 : 8) + i] = toupper(c);
+        }
+        if (lower && upper) return false;
+        if (lower) ntFlags |= part == 0 ? 0x08 : 0x10;
+    }
+    if (sfn[0] == DELETED_MARK) sfn[0] = 0x05;
+    return true;
+}
+
+// "BASIS~N.EXT" alias for a long name
+void numberedShortName(const std::string& name, DWORD number, BYTE* sfn) {
+    size_t dot = name.rfind('.');
+    if (dot == 0) dot = std::string::npos;
+    size_t baseEnd = dot == std::string::npos ? name.size() : dot;
+
+    BYTE basis[8];
+    int baseLength = 0;
+    for (size_t i = 0; i < baseEnd && baseLength < 8; i++) {
+        BYTE c = name[i];
+        if (c == ' ' || c == '.') continue;
+        basis[baseLength++] = isShortNameChar(c) ? toupper(c) : '_';
+    }
+
+    char suffix[12];
+    int suffixLength = snprintf(suffix, sizeof(suffix), "~%u", number);
+    int keep = baseLength < 8 - suffixLength ? baseLength : 8 - suffixLength;
+
+    memset(sfn, ' ', 11);
+    memcpy(sfn, basis, keep);
+    memcpy(sfn + keep, suffix, suffixLength);
+    if (dot != std::string::npos) {
+        int n = 0;
+        for (size_t i = dot + 1; i < name.size() && n < 3; i++) {
+            BYTE c = name[i];
+            if (c == ' ') continue;
+            sfn[8 + n++] = isShortNameChar(c) ? toupper(c) : '_';
+        }
+    }
+}
+
+// Writes a new entry into dir, with long name slots when the name needs them
+FRESULT createEntry(const DirPos& dir, const std::string& name, BYTE attr, DWORD sclust, Entry* created) {
+    FATFS* fs = dir.fs;
+    BYTE sfn[11];
+    BYTE ntFlags = 0;
+    FRESULT res = FR_OK;
+
+    bool needLfn = !makeShortName(name, sfn, ntFlags) || shortNameExists(dir, sfn, res);
+    if (res != FR_OK) return res;
+    if (needLfn) {
+        ntFlags = 0;
+        DWORD number = 1;
+        for (;; number++) {
+            if (number > 999999) return FR_DENIED;
+            numberedShortName(name, number, sfn);
+            if (!shortNameExists(dir, sfn, res)) break;
+        }
+        if (res != FR_OK) return res;
+    }
+
+    WORD lfn[FF_MAX_LFN + 1];
+    size_t lfnLength = needLfn ? utf8ToUtf16(name, lfn, FF_MAX_LFN) : 0;
+    int lfnSlots = (lfnLength + LFN_CHARS - 1) / LFN_CHARS;
+
+    // First run of free slots long enough for the name, growing the directory if needed
+    DirPos d = dir;
+    DirPos runStart = dir;
+    int run = 0;
+    for (;;) {
+        BYTE* e = dirSlot(d, res);
+        if (res != FR_OK) return res;
+        if (e[0] == 0 || e[0] == DELETED_MARK) {
+            if (run == 0) runStart = d;
+            if (++run == lfnSlots + 1) break;
+        } else {
+            run = 0;
+        }
+        res = dirNext(d, true);
+        if (res != FR_OK) return res;
+    }
+
+    d = runStart;
+    BYTE sum = sfnChecksum(sfn);
+    for (int ord = lfnSlots; ord >= 1; ord--) {
+        BYTE* e = dirSlot(d, res);
+        if (res != FR_OK) return res;
+        memset(e, 0, DIR_ENTRY_SIZE);
+        e[0] = ord | (ord == lfnSlots ? 0x40 : 0);
+        e[11] = AM_LFN;
+        e[13] = sum;
+        for (int k = 0; k < LFN_CHARS; k++) {
+            size_t index = (ord - 1) * LFN_CHARS + k;
+            WORD wc = index < lfnLength ? lfn[index] : index == lfnLength ? 0 : 0xFFFF;
+            st16(e + lfnOffsets[k], wc);
+        }
+        fs->wflag = 1;
+        res = dirNext(d, false);
+        if (res != FR_OK) return res;
+    }
+
+    BYTE* e = dirSlot(d, res);
+    if (res != FR_OK) return res;
+    memset(e, 0, DIR_ENTRY_SIZE);
+    memcpy(e, sfn, 11);
+    e[11] = attr;
+    e[12] = ntFlags;
+    stampEntry(e, true);
+    setEntryCluster(fs, e, sclust);
+    fs->wflag = 1;
+
+    if (created) {
+        created->start = runStart;
+        created->pos = d;
+        created->sclust = sclust;
+        created->size = 0;
+        created->attr = attr;
+        created->wtime = ld16(e + 22);
+        created->wdate = ld16(e + 24);
+        sfnToString(e, created->altname);
+        strncpy(created->name, name.c_str(), sizeof(created->name) - 1);
+        created->name[sizeof(created->name) - 1] = '\0';
+    }
+    return FR_OK;
+}
+
+FRESULT removeEntry(Entry& entry) {
+    DirPos d = entry.start;
+    for (;;) {
+        FRESULT res;
+        BYTE* e = dirSlot(d, res);
+        if (res != FR_OK) return res;
+        e[0] = DELETED_MARK;
+        d.fs->wflag = 1;
+        if (d.index == entry.pos.index) return FR_OK;
+        res = dirNext(d, false);
+        if (res != FR_OK) return res;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Volumes and paths
+// ---------------------------------------------------------------------------
+
+bool isBootSector(const BYTE* b, WORD ssize) {
+    BYTE csize = b[13];
+    return ld16(b + 510) == 0xAA55 && (b[0] == 0xEB || b[0] == 0xE9 || b[0] == 0xE8) &&
+           ld16(b + 11) == ssize && csize != 0 && (csize & (csize - 1)) == 0 &&
+           ld16(b + 14) != 0 && (b[16] == 1 || b[16] == 2);
+}
+
+FRESULT mountVolume(FATFS* fs) {
+    const ff_diskio_impl_t* drv = drivers[fs->pdrv];
+    fs->fs_type = 0;
+    if (!drv || (drv->init(fs->pdrv) & STA_NOINIT)) return FR_NOT_READY;
+
+    WORD ssize = 0;
+    if (drv->ioctl(fs->pdrv, GET_SECTOR_SIZE, &ssize) != RES_OK ||
+        ssize < FF_MIN_SS || ssize > FF_MAX_SS || (ssize & (ssize - 1))) {
+        return FR_DISK_ERR;
+    }
+    fs->ssize = ssize;
+    fs->winsect = (LBA_t)-1;
+    fs->wflag = 0;
+
+    // Superfloppy, or the first FAT partition of an MBR
+    LBA_t bootSector = 0;
+    if (moveWindow(fs, 0) != FR_OK) return FR_DISK_ERR;
+    if (!isBootSector(fs->win, ssize)) {
+        if (ld16(fs->win + 510) != 0xAA55) return FR_NO_FILESYSTEM;
+        for (int i = 0; i < 4 && !bootSector; i++) {
+            const BYTE* p = fs->win + 446 + 16 * i;
+            if (strchr("\x01\x04\x06\x0B\x0C\x0E", p[4]) && p[4]) bootSector = ld32(p + 8);
+        }
+        if (!bootSector || moveWindow(fs, bootSector) != FR_OK || !isBootSector(fs->win, ssize)) {
+            return FR_NO_FILESYSTEM;
+        }
+    }
+
+    const BYTE* b = fs->win;
+    WORD reserved = ld16(b + 14);
+    BYTE fats = b[16];
+    WORD rootEntries = ld16(b + 17);
+    DWORD totalSectors = ld16(b + 19) ? ld16(b + 19) : ld32(b + 32);
+    DWORD fatSize = ld16(b + 22) ? ld16(b + 22) : ld32(b + 36);
+    DWORD rootSectors = (rootEntries * DIR_ENTRY_SIZE + ssize - 1) / ssize;
+    DWORD systemSectors = reserved + fatSize * fats + rootSectors;
+    if (totalSectors < systemSectors) return FR_NO_FILESYSTEM;
+
+    DWORD clusters = (totalSectors - systemSectors) / b[13];
+    if (clusters < 4085) return FR_NO_FILESYSTEM;     // FAT12 is not simulated
+    BYTE type = clusters <= 65524 ? FS_FAT16 : FS_FAT32;
+    if ((type == FS_FAT32) != (rootEntries == 0)) return FR_NO_FILESYSTEM;
+    if ((uint64_t)fatSize * ssize < (uint64_t)(clusters + 2) * (type == FS_FAT16 ? 2 : 4)) return FR_NO_FILESYSTEM;
+
+    fs->csize = b[13];
+    fs->n_fats = fats;
+    fs->n_rootdir = rootEntries;
+    fs->n_fatent = clusters + 2;
+    fs->fsize = fatSize;
+    fs->volbase = bootSector;
+    fs->fatbase = bootSector + reserved;
+    fs->database = bootSector + systemSectors;
+    fs->dirbase = type == FS_FAT32 ? ld32(b + 44) : fs->fatbase + fatSize * fats;
+    fs->free_clst = 0xFFFFFFFF;
+    fs->last_clst = 1;
+    fs->fsi_flag = 0;
+
+    if (type == FS_FAT32) {
+        fs->fsi_sect = bootSector + ld16(b + 48);
+        if (moveWindow(fs, fs->fsi_sect) == FR_OK && ld32(fs->win) == 0x41615252 &&
+            ld32(fs->win + 484) == 0x61417272) {
+            DWORD freeCount = ld32(fs->win + 488);
+            DWORD nextFree = ld32(fs->win + 492);
+            if (freeCount <= clusters) fs->free_clst = freeCount;
+            if (nextFree >= 2 && nextFree < fs->n_fatent) fs->last_clst = nextFree;
+        }
+    }
+    fs->fs_type = type;
+    return FR_OK;
+}
+
+int parseDrive(const TCHAR*& path) {
+    int volume = 0;
+    if (path[0] >= '0' && path[0] <= '9' && path[1] == ':') {
+        volume = path[0] - '0';
+        path += 2;
+    }
+    return volume;
+}
+
+// Strips the drive prefix and returns its volume, remounting after a media change
+FRESULT findVolume(const TCHAR*& path, FATFS*& fs) {
+    int volume = parseDrive(path);
+    if (volume >= FF_VOLUMES) return FR_INVALID_DRIVE;
+    fs = volumes[volume];
+    if (!fs) return FR_NOT_ENABLED;
+
+    const ff_diskio_impl_t* drv = drivers[fs->pdrv];
+    if (fs->fs_type && drv && !(drv->status(fs->pdrv) & STA_NOINIT)) return FR_OK;
+    return mountVolume(fs);
+}
+
+// Walks path from the root. FR_OK: entry is the target (isRoot for "/").
+// FR_NO_FILE: the last part is missing, dir is its parent and name holds it.
+FRESULT followPath(FATFS* fs, const char* path, DirPos& dir, Entry& entry, std::string& name, bool& isRoot) {
+    dirStart(dir, fs, 0);
+    isRoot = true;
+    for (;;) {
+        while (*path == '/' || *path == '\\') path++;
+        if (*path == '\0') return FR_OK;
+
+        const char* end = path;
+        while (*end && *end != '/' && *end != '\\') end++;
+        name.assign(path, end - path);
+        path = end;
+        if (name == ".") continue;
+
+        while (!name.empty() && (name.back() == ' ' || name.back() == '.')) name.pop_back();
+        if (name.empty() || name.size() > FF_MAX_LFN) return FR_INVALID_NAME;
+        for (char c : name) {
+            if (!isNameChar(c)) return FR_INVALID_NAME;
+        }
+
+        while (*path == '/' || *path == '\\') path++;
+        bool last = *path == '\0';
+        isRoot = false;
+
+        FRESULT res = findEntry(dir, name, entry);
+        if (res == FR_NO_FILE) return last ? FR_NO_FILE : FR_NO_PATH;
+        if (res != FR_OK || last) return res;
+        if (!(entry.attr & AM_DIR)) return FR_NO_PATH;
+        dirStart(dir, fs, entry.sclust);
+    }
+}
+
+void fillInfo(const Entry& entry, FILINFO* fno) {
+    if (!fno) return;
+    fno->fsize = entry.size;
+    fno->fdate = entry.wdate;
+    fno->ftime = entry.wtime;
+    fno->fattrib = entry.attr;
+    strncpy(fno->altname, entry.altname, sizeof(fno->altname));
+    strncpy(fno->fname, entry.name, sizeof(fno->fname) - 1);
+    fno->fname[sizeof(fno->fname) - 1] = '\0';
+}
+
+// ---------------------------------------------------------------------------
+// File data
+// ---------------------------------------------------------------------------
+
+FRESULT flushBuffer(FIL* fp) {
+    if (fp->flag & FA_DIRTY) {
+        if (!diskWrite(fp->obj.fs, fp->buf, fp->sect, 1)) return FR_DISK_ERR;
+        fp->flag &= ~FA_DIRTY;
+    }
+    return FR_OK;
+}
+
+FRESULT loadBuffer(FIL* fp, LBA_t sector, bool read) {
+    if (fp->sect == sector) return FR_OK;
+    FRESULT res = flushBuffer(fp);
+    if (res != FR_OK) return res;
+    if (read) {
+        if (!diskRead(fp->obj.fs, fp->buf, sector, 1)) {
+            fp->sect = 0;
+            return FR_DISK_ERR;
+        }
+    } else {
+        memset(fp->buf, 0, fp->obj.fs->ssize);
+    }
+    fp->sect = sector;
+    return FR_OK;
+}
+
+// Cluster number index in the file's chain, allocating up to it when extend is set.
+// FR_DENIED when the volume is full.
+FRESULT fileCluster(FIL* fp, DWORD index, bool extend, DWORD& clst) {
+    FATFS* fs = fp->obj.fs;
+    DWORD n;
+    if (fp->clust && fp->clust_index <= index) {
+        clst = fp->clust;
+        n = fp->clust_index;
+    } else {
+        clst = fp->obj.sclust;
+        n = 0;
+        if (clst == 0) {
+            if (!extend) return FR_INT_ERR;
+            clst = createChain(fs, 0);
+            if (clst == 0) return FR_DENIED;
+            if (clst == 0xFFFFFFFF) return FR_DISK_ERR;
+            fp->obj.sclust = clst;
+            fp->flag |= FA_MODIFIED;
+        }
+    }
+
+    while (n < index) {
+        DWORD next = getFat(fs, clst);
+        if (next == 0xFFFFFFFF) return FR_DISK_ERR;
+        if (next < 2) return FR_INT_ERR;
+        if (next >= fs->n_fatent) {
+            if (!extend) return FR_INT_ERR;
+            next = createChain(fs, clst);
+            if (next == 0) return FR_DENIED;
+            if (next == 0xFFFFFFFF) return FR_DISK_ERR;
+        }
+        clst = next;
+        n++;
+    }
+    fp->clust = clst;
+    fp->clust_index = n;
+    return FR_OK;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// diskio and VFS registration
+// ---------------------------------------------------------------------------
+
+void ff_diskio_register(BYTE pdrv, const ff_diskio_impl_t* discio_impl) {
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    if (pdrv < FF_VOLUMES) drivers[pdrv] = discio_impl;
+}
+
+esp_err_t ff_diskio_get_drive(BYTE* out_pdrv) {
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    *out_pdrv = 0xFF;
+    for (BYTE i = 0; i < FF_VOLUMES; i++) {
+        if (!drivers[i]) {
+            *out_pdrv = i;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t esp_vfs_fat_register(const char* base_path, const char* fat_drive, size_t max_files, FATFS** out_fs) {
+    (void)max_files;
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    const TCHAR* path = fat_drive;
+    int volume = parseDrive(path);
+    if (volume >= FF_VOLUMES) return ESP_ERR_INVALID_ARG;
+    for (int i = 0; i < FF_VOLUMES; i++) {
+        if (vfsPaths[i] == base_path) return ESP_ERR_INVALID_STATE;
+    }
+    if (!vfsPaths[volume].empty()) return ESP_ERR_INVALID_STATE;
+
+    vfsPaths[volume] = base_path;
+    vfsVolumes[volume] = new FATFS();
+    *out_fs = vfsVolumes[volume];
+    return ESP_OK;
+}
+
+esp_err_t esp_vfs_fat_unregister_path(const char* base_path) {
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    for (int i = 0; i < FF_VOLUMES; i++) {
+        if (vfsPaths[i] == base_path) {
+            vfsPaths[i].clear();
+            if (volumes[i] == vfsVolumes[i]) volumes[i] = nullptr;
+            delete vfsVolumes[i];
+            vfsVolumes[i] = nullptr;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_INVALID_STATE;
+}
+
+// ---------------------------------------------------------------------------
+// FatFs API
+// ---------------------------------------------------------------------------
+
+FRESULT f_mount(FATFS* fs, const TCHAR* path, BYTE opt) {
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    int volume = parseDrive(path);
+    if (volume >= FF_VOLUMES) return FR_INVALID_DRIVE;
+
+    if (volumes[volume]) volumes[volume]->fs_type = 0;
+    volumes[volume] = fs;
+    if (!fs) return FR_OK;
+
+    fs->fs_type = 0;
+    fs->pdrv = volume;
+    return opt ? mountVolume(fs) : FR_OK;
+}
+
+FRESULT f_open(FIL* fp, const TCHAR* path, BYTE mode) {
+    if (!fp) return FR_INVALID_OBJECT;
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    fp->obj.fs = nullptr;
+
+    FATFS* fs;
+    FRESULT res = findVolume(path, fs);
+    if (res != FR_OK) return res;
+
+    DirPos dir;
+    Entry entry;
+    std::string name;
+    bool isRoot;
+    res = followPath(fs, path, dir, entry, name, isRoot);
+    if (res == FR_OK && isRoot) res = FR_INVALID_NAME;
+
+    bool modified = false;
+    if (mode & (FA_CREATE_ALWAYS | FA_OPEN_ALWAYS | FA_CREATE_NEW)) {
+        if (res == FR_NO_FILE) {
+            res = createEntry(dir, name, AM_ARC, 0, &entry);
+            modified = true;
+        } else if (res == FR_OK) {
+            if (entry.attr & (AM_DIR | AM_RDO)) {
+                res = FR_DENIED;
+            } else if (mode & FA_CREATE_NEW) {
+                res = FR_EXIST;
+            } else if (mode & FA_CREATE_ALWAYS) {
+                BYTE* e = dirSlot(entry.pos, res);
+                if (res == FR_OK) {
+                    setEntryCluster(fs, e, 0);
+                    st32(e + 28, 0);
+                    stampEntry(e, false);
+                    fs->wflag = 1;
+                    res = removeChain(fs, entry.sclust);
+                    entry.sclust = 0;
+                    entry.size = 0;
+                    modified = true;
+                }
+            }
+        }
+    } else if (res == FR_OK) {
+        if (entry.attr & AM_DIR) {
+            res = FR_NO_FILE;
+        } else if ((mode & FA_WRITE) && (entry.attr & AM_RDO)) {
+            res = FR_DENIED;
+        }
+    }
+    if (res == FR_OK && modified) res = syncFs(fs);
+    if (res != FR_OK) return res;
+
+    fp->obj.fs = fs;
+    fp->obj.sclust = entry.sclust;
+    fp->obj.objsize = entry.size;
+    fp->flag = mode & (FA_READ | FA_WRITE);
+    fp->fptr = 0;
+    fp->clust = 0;
+    fp->clust_index = 0;
+    fp->sect = 0;
+    fp->dir_sect = entry.pos.sect;
+    fp->dir_offset = (entry.pos.index % (fs->ssize / DIR_ENTRY_SIZE)) * DIR_ENTRY_SIZE;
+
+    if ((mode & FA_OPEN_APPEND) == FA_OPEN_APPEND) {
+        fp->fptr = fp->obj.objsize;
+    }
+    return FR_OK;
+}
+
+FRESULT f_read(FIL* fp, void* buff, UINT btr, UINT* br) {
+    *br = 0;
+    if (!fp || !fp->obj.fs) return FR_INVALID_OBJECT;
+    if (!(fp->flag & FA_READ)) return FR_DENIED;
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+
+    FATFS* fs = fp->obj.fs;
+    UINT clusterBytes = fs->csize * fs->ssize;
+    if (btr > fp->obj.objsize - fp->fptr) btr = fp->obj.objsize - fp->fptr;
+
+    BYTE* out = (BYTE*)buff;
+    while (btr > 0) {
+        DWORD clst;
+        FRESULT res = fileCluster(fp, fp->fptr / clusterBytes, false, clst);
+        if (res != FR_OK) return res;
+
+        UINT sectorInCluster = (fp->fptr % clusterBytes) / fs->ssize;
+        LBA_t sector = clusterSector(fs, clst) + sectorInCluster;
+        UINT offset = fp->fptr % fs->ssize;
+        UINT n;
+
+        if (offset == 0 && btr >= fs->ssize) {
+            // Whole sectors go straight to the caller, up to the end of the cluster
+            UINT count = btr / fs->ssize;
+            if (count > fs->csize - sectorInCluster) count = fs->csize - sectorInCluster;
+            if (fp->sect >= sector && fp->sect < sector + count) {
+                res = flushBuffer(fp);
+                if (res != FR_OK) return res;
+            }
+            if (!diskRead(fs, out, sector, count)) return FR_DISK_ERR;
+            n = count * fs->ssize;
+        } else {
+            res = loadBuffer(fp, sector, true);
+            if (res != FR_OK) return res;
+            n = fs->ssize - offset < btr ? fs->ssize - offset : btr;
+            memcpy(out, fp->buf + offset, n);
+        }
+
+        out += n;
+        fp->fptr += n;
+        *br += n;
+        btr -= n;
+    }
+    return FR_OK;
+}
+
+FRESULT f_write(FIL* fp, const void* buff, UINT btw, UINT* bw) {
+    *bw = 0;
+    if (!fp || !fp->obj.fs) return FR_INVALID_OBJECT;
+    if (!(fp->flag & FA_WRITE)) return FR_DENIED;
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+
+    FATFS* fs = fp->obj.fs;
+    UINT clusterBytes = fs->csize * fs->ssize;
+    const BYTE* in = (const BYTE*)buff;
+
+    while (btw > 0) {
+        DWORD clst;
+        FRESULT res = fileCluster(fp, fp->fptr / clusterBytes, true, clst);
+        if (res == FR_DENIED) break;    // Volume full: a short write, as FatFs does
+        if (res != FR_OK) return res;
+
+        UINT sectorInCluster = (fp->fptr % clusterBytes) / fs->ssize;
+        LBA_t sector = clusterSector(fs, clst) + sectorInCluster;
+        UINT offset = fp->fptr % fs->ssize;
+        UINT n;
+
+        if (offset == 0 && btw >= fs->ssize) {
+            UINT count = btw / fs->ssize;
+            if (count > fs->csize - sectorInCluster) count = fs->csize - sectorInCluster;
+            if (fp->sect >= sector && fp->sect < sector + count) {
+                fp->flag &= ~FA_DIRTY;
+                fp->sect = 0;
+            }
+            if (!diskWrite(fs, in, sector, count)) return FR_DISK_ERR;
+            n = count * fs->ssize;
+        } else {
+            // A sector starting at or past the end of the file has nothing to keep
+            res = loadBuffer(fp, sector, fp->fptr - offset < fp->obj.objsize);
+            if (res != FR_OK) return res;
+            n = fs->ssize - offset < btw ? fs->ssize - offset : btw;
+            memcpy(fp->buf + offset, in, n);
+            fp->flag |= FA_DIRTY;
+        }
+
+        in += n;
+        fp->fptr += n;
+        *bw += n;
+        btw -= n;
+        if (fp->fptr > fp->obj.objsize) fp->obj.objsize = fp->fptr;
+        fp->flag |= FA_MODIFIED;
+    }
+    return FR_OK;
+}
+
+FRESULT f_lseek(FIL* fp, FSIZE_t ofs) {
+    if (!fp || !fp->obj.fs) return FR_INVALID_OBJECT;
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+
+    if (ofs > fp->obj.objsize) {
+        if (!(fp->flag & FA_WRITE)) {
+            ofs = fp->obj.objsize;
+        } else {
+            // Growing a file in write mode allocates the clusters now
+            FATFS* fs = fp->obj.fs;
+            DWORD clst;
+            FRESULT res = fileCluster(fp, (ofs - 1) / (fs->csize * fs->ssize), true, clst);
+            if (res != FR_OK) return res;
+            fp->obj.objsize = ofs;
+            fp->flag |= FA_MODIFIED;
+        }
+    }
+    fp->fptr = ofs;
+    return FR_OK;
+}
+
+FRESULT f_sync(FIL* fp) {
+    if (!fp || !fp->obj.fs) return FR_INVALID_OBJECT;
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+
+    FATFS* fs = fp->obj.fs;
+    FRESULT res = flushBuffer(fp);
+    if (res != FR_OK) return res;
+
+    if (fp->flag & FA_MODIFIED) {
+        res = moveWindow(fs, fp->dir_sect);
+        if (res != FR_OK) return res;
+        BYTE* e = fs->win + fp->dir_offset;
+        e[11] |= AM_ARC;
+        setEntryCluster(fs, e, fp->obj.sclust);
+        st32(e + 28, fp->obj.objsize);
+        stampEntry(e, false);
+        fs->wflag = 1;
+        fp->flag &= ~FA_MODIFIED;
+    }
+    return syncFs(fs);
+}
+
+FRESULT f_close(FIL* fp) {
+    FRESULT res = f_sync(fp);
+    if (res == FR_OK) fp->obj.fs = nullptr;
+    return res;
+}
+
+FRESULT f_opendir(DIR* dp, const TCHAR* path) {
+    if (!dp) return FR_INVALID_OBJECT;
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    dp->obj.fs = nullptr;
+
+    FATFS* fs;
+    FRESULT res = findVolume(path, fs);
+    if (res != FR_OK) return res;
+
+    DirPos dir;
+    Entry entry;
+    std::string name;
+    bool isRoot;
+    res = followPath(fs, path, dir, entry, name, isRoot);
+    if (res == FR_NO_FILE) return FR_NO_PATH;
+    if (res != FR_OK) return res;
+    if (!isRoot) {
+        if (!(entry.attr & AM_DIR)) return FR_NO_PATH;
+        dirStart(dir, fs, entry.sclust);
+    }
+
+    dp->obj.fs = fs;
+    dp->obj.sclust = dir.sclust;
+    dp->dptr = dir.index;
+    dp->clust = dir.clust;
+    dp->sect = dir.sect;
+    return FR_OK;
+}
+
+FRESULT f_closedir(DIR* dp) {
+    if (!dp || !dp->obj.fs) return FR_INVALID_OBJECT;
+    dp->obj.fs = nullptr;
+    return FR_OK;
+}
+
+FRESULT f_readdir(DIR* dp, FILINFO* fno) {
+    if (!dp || !dp->obj.fs) return FR_INVALID_OBJECT;
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+
+    DirPos d;
+    if (!fno) {
+        dirStart(d, dp->obj.fs, dp->obj.sclust);
+    } else {
+        if (dp->sect == 0) {
+            fno->fname[0] = '\0';
+            return FR_OK;
+        }
+        d = {dp->obj.fs, dp->obj.sclust, dp->clust, dp->sect, dp->dptr};
+
+        Entry entry;
+        FRESULT res = readEntry(d, entry);
+        if (res == FR_NO_FILE) {
+            dp->sect = 0;
+            fno->fname[0] = '\0';
+            return FR_OK;
+        }
+        if (res != FR_OK) return res;
+        fillInfo(entry, fno);
+
+        res = dirNext(d, false);
+        if (res == FR_NO_FILE) {
+            dp->sect = 0;
+            return FR_OK;
+        }
+        if (res != FR_OK) return res;
+    }
+    dp->dptr = d.index;
+    dp->clust = d.clust;
+    dp->sect = d.sect;
+    return FR_OK;
+}
+
+FRESULT f_stat(const TCHAR* path, FILINFO* fno) {
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    FATFS* fs;
+    FRESULT res = findVolume(path, fs);
+    if (res != FR_OK) return res;
+
+    DirPos dir;
+    Entry entry;
+    std::string name;
+    bool isRoot;
+    res = followPath(fs, path, dir, entry, name, isRoot);
+    if (res == FR_OK && isRoot) return FR_INVALID_NAME;
+    if (res == FR_OK) fillInfo(entry, fno);
+    return res;
+}
+
+FRESULT f_unlink(const TCHAR* path) {
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    FATFS* fs;
+    FRESULT res = findVolume(path, fs);
+    if (res != FR_OK) return res;
+
+    DirPos dir;
+    Entry entry;
+    std::string name;
+    bool isRoot;
+    res = followPath(fs, path, dir, entry, name, isRoot);
+    if (res != FR_OK) return res;
+    if (isRoot) return FR_INVALID_NAME;
+    if (entry.attr & AM_RDO) return FR_DENIED;
+
+    if (entry.attr & AM_DIR) {
+        DirPos child;
+        Entry first;
+        dirStart(child, fs, entry.sclust);
+        res = readEntry(child, first);
+        if (res == FR_OK) return FR_DENIED;
+        if (res != FR_NO_FILE) return res;
+    }
+
+    res = removeEntry(entry);
+    if (res == FR_OK) res = removeChain(fs, entry.sclust);
+    if (res == FR_OK) res = syncFs(fs);
+    return res;
+}
+
+FRESULT f_mkdir(const TCHAR* path) {
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    FATFS* fs;
+    FRESULT res = findVolume(path, fs);
+    if (res != FR_OK) return res;
+
+    DirPos dir;
+    Entry entry;
+    std::string name;
+    bool isRoot;
+    res = followPath(fs, path, dir, entry, name, isRoot);
+    if (res == FR_OK) return FR_EXIST;
+    if (res != FR_NO_FILE) return res;
+
+    DWORD clst = createChain(fs, 0);
+    if (clst == 0) return FR_DENIED;
+    if (clst == 0xFFFFFFFF) return FR_DISK_ERR;
+    res = zeroCluster(fs, clst);
+    if (res != FR_OK) return res;
+
+    // "." and "..", the latter 0 when the parent is the root
+    res = moveWindow(fs, clusterSector(fs, clst));
+    if (res != FR_OK) return res;
+    BYTE* e = fs->win;
+    memset(e, ' ', 11);
+    e[0] = '.';
+    e[11] = AM_DIR;
+    stampEntry(e, true);
+    setEntryCluster(fs, e, clst);
+    memcpy(e + DIR_ENTRY_SIZE, e, DIR_ENTRY_SIZE);
+    e[DIR_ENTRY_SIZE + 1] = '.';
+    bool parentIsRoot = dir.clust == 0 || (fs->fs_type == FS_FAT32 && dir.sclust == fs->dirbase);
+    setEntryCluster(fs, e + DIR_ENTRY_SIZE, parentIsRoot ? 0 : dir.sclust);
+    fs->wflag = 1;
+
+    res = createEntry(dir, name, AM_DIR, clst, nullptr);
+    if (res != FR_OK) {
+        removeChain(fs, clst);
+        return res;
+    }
+    return syncFs(fs);
+}
+
+FRESULT f_rename(const TCHAR* path_old, const TCHAR* path_new) {
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    FATFS* fs;
+    FRESULT res = findVolume(path_old, fs);
+    if (res != FR_OK) return res;
+    parseDrive(path_new);
+
+    DirPos oldDir;
+    Entry oldEntry;
+    std::string oldName;
+    bool isRoot;
+    res = followPath(fs, path_old, oldDir, oldEntry, oldName, isRoot);
+    if (res != FR_OK) return res;
+    if (isRoot) return FR_INVALID_NAME;
+
+    BYTE saved[DIR_ENTRY_SIZE];
+    BYTE* e = dirSlot(oldEntry.pos, res);
+    if (res != FR_OK) return res;
+    memcpy(saved, e, DIR_ENTRY_SIZE);
+
+    DirPos newDir;
+    Entry newEntry;
+    std::string newName;
+    res = followPath(fs, path_new, newDir, newEntry, newName, isRoot);
+    if (res == FR_OK) return FR_EXIST;
+    if (res != FR_NO_FILE) return res;
+
+    res = createEntry(newDir, newName, saved[11], oldEntry.sclust, &newEntry);
+    if (res != FR_OK) return res;
+    e = dirSlot(newEntry.pos, res);
+    if (res != FR_OK) return res;
+    memcpy(e + 13, saved + 13, DIR_ENTRY_SIZE - 13);
+    fs->wflag = 1;
+
+    res = removeEntry(oldEntry);
+    if (res != FR_OK) return res;
+
+    // A directory moved to a new parent needs its ".." repointed
+    if ((saved[11] & AM_DIR) && newDir.sclust != oldDir.sclust && oldEntry.sclust) {
+        res = moveWindow(fs, clusterSector(fs, oldEntry.sclust));
+        if (res != FR_OK) return res;
+        BYTE* dotdot = fs->win + DIR_ENTRY_SIZE;
+        if (dotdot[0] == '.' && dotdot[1] == '.') {
+            bool parentIsRoot = newDir.clust == 0 || (fs->fs_type == FS_FAT32 && newDir.sclust == fs->dirbase);
+            setEntryCluster(fs, dotdot, parentIsRoot ? 0 : newDir.sclust);
+            fs->wflag = 1;
+        }
+    }
+    return syncFs(fs);
+}
+
+FRESULT f_getfree(const TCHAR* path, DWORD* nclst, FATFS** fatfs) {
+    std::lock_guard<std::recursive_mutex> guard(fsLock);
+    FATFS* fs;
+    FRESULT res = findVolume(path, fs);
+    if (res != FR_OK) return res;
+
+    if (fs->free_clst > fs->n_fatent - 2) {
+        DWORD count = 0;
+        for (DWORD clst = 2; clst < fs->n_fatent; clst++) {
+            DWORD value = getFat(fs, clst);
+            if (value == 0xFFFFFFFF) return FR_DISK_ERR;
+            if (value == 0) count++;
+        }
+        fs->free_clst = count;
+        fs->fsi_flag = 1;
+    }
+    *nclst = fs->free_clst;
+    *fatfs = fs;
+    return FR_OK;
+}
+
+// ---------------------------------------------------------------------------
+// Image formatting for the runner
+// ---------------------------------------------------------------------------
+
+namespace sim {
+
+bool formatFatImage(const std::string& path, uint32_t sizeMB) {
+    const WORD ssize = 512;
+    DWORD total = sizeMB * 2048;
+    bool fat32 = sizeMB >= 64;
+
+    WORD reserved = fat32 ? 32 : 1;
+    WORD rootEntries = fat32 ? 0 : 512;
+    DWORD rootSectors = rootEntries * DIR_ENTRY_SIZE / ssize;
+    BYTE csize = fat32 ? (sizeMB < 260 ? 1 : sizeMB < 8192 ? 8 : sizeMB < 16384 ? 16 : 32) : 1;
+    DWORD clusters;
+    DWORD fatSize;
+    for (;;) {
+        DWORD estimate = (total - reserved - rootSectors) / csize;
+        fatSize = ((estimate + 2) * (fat32 ? 4 : 2) + ssize - 1) / ssize;
+        clusters = (total - reserved - rootSectors - 2 * fatSize) / csize;
+        if (fat32 || clusters <= 65524) break;
+        csize *= 2;
+    }
+    if (fat32 ? clusters < 65525 : clusters < 4085) {
+        fprintf(stderr, "%u MB is too small for FAT%s\n", sizeMB, fat32 ? "32" : "16");
+        return false;
+    }
+
+    FileBlockDevice image;
+    if (!image.create(path.c_str(), total, ssize)) return false;
+
+    BYTE b[512] = {};
+    b[0] = 0xEB;
+    b[1] = fat32 ? 0x58 : 0x3C;
+    b[2] = 0x90;
+    memcpy(b + 3, "MSWIN4.1", 8);
+    st16(b + 11, ssize);
+    b[13] = csize;
+    st16(b + 14, reserved);
+    b[16] = 2;
+    st16(b + 17, rootEntries);
+    if (total < 0x10000) {
+        st16(b + 19, total);
+    } else {
+        st32(b + 32, total);
+    }
+    b[21] = 0xF8;
+    st16(b + 24, 63);
+    st16(b + 26, 255);
+    BYTE* ext = b + (fat32 ? 64 : 36);
+    if (fat32) {
+        st32(b + 36, fatSize);
+        st32(b + 44, 2);
+        st16(b + 48, 1);
+        st16(b + 50, 6);
+    } else {
+        st16(b + 22, fatSize);
+    }
+    ext[0] = 0x80;
+    ext[2] = 0x29;
+    st32(ext + 3, 0x0FF1CE00 | sizeMB);
+    memcpy(ext + 7, "OFFICEHUB  ", 11);
+    memcpy(ext + 18, fat32 ? "FAT32   " : "FAT16   ", 8);
+    b[510] = 0x55;
+    b[511] = 0xAA;
+    bool ok = image.write(0, b, 1);
+
+    if (fat32) {
+        ok = ok && image.write(6, b, 1);
+        BYTE fsinfo[512] = {};
+        st32(fsinfo, 0x41615252);
+        st32(fsinfo + 484, 0x61417272);
+        st32(fsinfo + 488, clusters - 1);
+        st32(fsinfo + 492, 2);
+        st32(fsinfo + 508, 0xAA550000);
+        ok = ok && image.write(1, fsinfo, 1) && image.write(7, fsinfo, 1);
+    }
+
+    // Media byte, end-of-chain marker and (FAT32) the root directory cluster
+    BYTE fat[512] = {};
+    if (fat32) {
+        st32(fat, 0x0FFFFFF8);
+        st32(fat + 4, 0x0FFFFFFF);
+        st32(fat + 8, 0x0FFFFFFF);
+    } else {
+        st16(fat, 0xFFF8);
+        st16(fat + 2, 0xFFFF);
+    }
+    ok = ok && image.write(reserved, fat, 1) && image.write(reserved + fatSize, fat, 1);
+    ok = ok && image.sync();
+    image.close();
+    return ok;
+}
+
+} // namespace sim
@@ -0,0 +1,1429 @@
+// Host simulation of the Arduino-ESP32 HAL used by the office hub:
+// clock, FreeRTOS, heap_caps, Serial/GPIO, SPIFFS, Preferences, WiFi,
+// NTP, the temperature sensor and FastLED.
+#include <Arduino.h>
+#include <FastLED.h>
+#include <NTPClient.h>
+#include <Preferences.h>
+#include <SPIFFS.h>
+#include <WiFi.h>
+#include <driver/ledc.h>
+#include "esp_heap_caps.h"
+#include "esp_temperature_sensor.h"
+#include "esp_timer.h"
+#include "sim_hal.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <new>
+#include <random>
+#include <sstream>
+#include <thread>
+
+// ---------------------------------------------------------------------------
+// Allocation counting
+// ---------------------------------------------------------------------------
+
+namespace sim {
+
+AllocCounters& allocations() {
+    static AllocCounters counters;
+    return counters;
+}
+
+} // namespace sim
+
+// Replacement operators pair malloc with free; GCC can't see that through inlining
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void* operator new(size_t size) {
+    sim::allocations().count++;
+    sim::allocations().bytes += size;
+    void* ptr = malloc(size ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+    sim::allocations().internalAllocs++;
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    if (!ptr) return;
+    sim::allocations().internalFrees++;
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+// ---------------------------------------------------------------------------
+// Clock and event timeline
+// ---------------------------------------------------------------------------
+
+namespace sim {
+
+static std::atomic<uint64_t> virtualUs{0};
+static std::atomic<bool> realtime{false};
+static const std::chrono::steady_clock::time_point processStart = std::chrono::steady_clock::now();
+static uint64_t realtimeBaseUs = 0;
+
+static std::mutex eventLock;
+static std::multimap<uint64_t, std::function<void()>> events;
+
+uint64_t nowUs() {
+    if (realtime) {
+        auto elapsed = std::chrono::steady_clock::now() - processStart;
+        return realtimeBaseUs + std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    }
+    return virtualUs;
+}
+
+void setRealtime(bool enabled) {
+    if (enabled == realtime) return;
+    if (enabled) {
+        // Continue from the current virtual time
+        auto elapsed = std::chrono::steady_clock::now() - processStart;
+        realtimeBaseUs = virtualUs - std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    } else {
+        virtualUs = nowUs();
+    }
+    realtime = enabled;
+}
+
+bool isRealtime() {
+    return realtime;
+}
+
+void advanceUs(uint64_t us) {
+    if (realtime) {
+        std::this_thread::sleep_for(std::chrono::microseconds(us));
+    } else {
+        virtualUs += us;
+    }
+    runDueEvents();
+}
+
+void scheduleAt(uint64_t atUs, std::function<void()> callback) {
+    std::lock_guard<std::mutex> guard(eventLock);
+    events.emplace(atUs, callback);
+}
+
+void runDueEvents() {
+    for (;;) {
+        std::function<void()> callback;
+        {
+            std::lock_guard<std::mutex> guard(eventLock);
+            if (events.empty() || events.begin()->first > nowUs()) return;
+            callback = events.begin()->second;
+            events.erase(events.begin());
+        }
+        callback();
+    }
+}
+
+} // namespace sim
+
+unsigned long millis() {
+    return (unsigned long)(sim::nowUs() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)sim::nowUs();
+}
+
+void delay(unsigned long ms) {
+    sim::advanceUs((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+    sim::advanceUs(us);
+}
+
+void yield() {
+    sim::runDueEvents();
+}
+
+int64_t esp_timer_get_time() {
+    return (int64_t)sim::nowUs();
+}
+
+const char* esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK: return "ESP_OK";
+        case ESP_FAIL: return "ESP_FAIL";
+        case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+        default: return "UNKNOWN";
+    }
+}
+
+// ---------------------------------------------------------------------------
+// FreeRTOS on std::thread
+// ---------------------------------------------------------------------------
+
+struct SimTask {
+    std::string name;
+    std::mutex lock;
+    std::condition_variable cv;
+    uint32_t notifyValue = 0;
+};
+
+struct SimTaskDeleted {};
+
+static thread_local SimTask* currentTask = nullptr;
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    if (!currentTask) {
+        currentTask = new SimTask();
+        currentTask->name = "loopTask";
+    }
+    return currentTask;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackDepth, void* param,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+    (void)stackDepth;
+    (void)priority;
+    (void)core;
+
+    SimTask* task = new SimTask();
+    task->name = name ? name : "task";
+    if (handle) *handle = task;
+
+    std::thread([task, fn, param]() {
+        currentTask = task;
+        try {
+            fn(param);
+        } catch (const SimTaskDeleted&) {
+        }
+    }).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackDepth, void* param,
+                       UBaseType_t priority, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(fn, name, stackDepth, param, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    // Only self-deletion is supported, which is all the firmware does
+    if (task == NULL || task == currentTask) {
+        throw SimTaskDeleted();
+    }
+}
+
+void vTaskDelay(TickType_t ticks) {
+    sim::advanceUs((uint64_t)ticks * 1000);
+}
+
+const char* pcTaskGetName(TaskHandle_t task) {
+    if (!task) task = xTaskGetCurrentTaskHandle();
+    return task->name.c_str();
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)millis();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+    SimTask* task = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> guard(task->lock);
+
+    if (task->notifyValue == 0 && ticksToWait > 0) {
+        if (sim::isRealtime() || ticksToWait == portMAX_DELAY) {
+            auto notified = [task]() { return task->notifyValue > 0; };
+            if (ticksToWait == portMAX_DELAY) {
+                task->cv.wait(guard, notified);
+            } else {
+                task->cv.wait_for(guard, std::chrono::milliseconds(ticksToWait), notified);
+            }
+            guard.unlock();
+            sim::runDueEvents();
+            guard.lock();
+        } else {
+            // Nothing else moves virtual time, so sleeping the full timeout is exact
+            guard.unlock();
+            sim::advanceUs((uint64_t)ticksToWait * 1000);
+            guard.lock();
+        }
+    }
+
+    uint32_t value = task->notifyValue;
+    if (clearOnExit) {
+        task->notifyValue = 0;
+    } else if (task->notifyValue > 0) {
+        task->notifyValue--;
+    }
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (!task) return pdFAIL;
+    {
+        std::lock_guard<std::mutex> guard(task->lock);
+        task->notifyValue++;
+    }
+    task->cv.notify_all();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken) {
+    xTaskNotifyGive(task);
+    if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdTRUE;
+}
+
+struct SimQueue {
+    std::mutex lock;
+    std::condition_variable cv;
+    std::deque<std::vector<uint8_t>> items;
+    size_t length;
+    size_t itemSize;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    SimQueue* queue = new SimQueue();
+    queue->length = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+    std::unique_lock<std::mutex> guard(queue->lock);
+    if (queue->items.size() >= queue->length) {
+        if (ticksToWait == 0) return pdFAIL;
+        auto hasRoom = [queue]() { return queue->items.size() < queue->length; };
+        if (ticksToWait == portMAX_DELAY) {
+            queue->cv.wait(guard, hasRoom);
+        } else if (!queue->cv.wait_for(guard, std::chrono::milliseconds(ticksToWait), hasRoom)) {
+            return pdFAIL;
+        }
+    }
+    const uint8_t* bytes = (const uint8_t*)item;
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    queue->cv.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* higherPriorityTaskWoken) {
+    if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdFALSE;
+    return xQueueSend(queue, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticksToWait) {
+    std::unique_lock<std::mutex> guard(queue->lock);
+    if (queue->items.empty()) {
+        if (ticksToWait == 0) return pdFAIL;
+        auto hasItem = [queue]() { return !queue->items.empty(); };
+        if (ticksToWait == portMAX_DELAY) {
+            queue->cv.wait(guard, hasItem);
+        } else if (!queue->cv.wait_for(guard, std::chrono::milliseconds(ticksToWait), hasItem)) {
+            return pdFAIL;
+        }
+    }
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    queue->cv.notify_all();
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> guard(queue->lock);
+    return queue->items.size();
+}
+
+struct SimSemaphore {
+    std::mutex lock;
+    std::condition_variable cv;
+    int count;
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    SimSemaphore* sem = new SimSemaphore();
+    sem->count = 1;
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    SimSemaphore* sem = new SimSemaphore();
+    sem->count = 0;
+    return sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticksToWait) {
+    std::unique_lock<std::mutex> guard(sem->lock);
+    auto available = [sem]() { return sem->count > 0; };
+    if (!available()) {
+        if (ticksToWait == 0) return pdFAIL;
+        if (ticksToWait == portMAX_DELAY) {
+            sem->cv.wait(guard, available);
+        } else if (!sem->cv.wait_for(guard, std::chrono::milliseconds(ticksToWait), available)) {
+            return pdFAIL;
+        }
+    }
+    sem->count--;
+    return pdPASS;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    {
+        std::lock_guard<std::mutex> guard(sem->lock);
+        if (sem->count >= 1) return pdFAIL;
+        sem->count++;
+    }
+    sem->cv.notify_one();
+    return pdPASS;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t* higherPriorityTaskWoken) {
+    if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdFALSE;
+    return xSemaphoreGive(sem);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    delete sem;
+}
+
+// ---------------------------------------------------------------------------
+// heap_caps: two regions with the sizes of an N8R2 module
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct HeapRegion {
+    size_t capacity;
+    std::atomic<size_t> used{0};
+    std::atomic<size_t> peak{0};
+};
+
+HeapRegion internalRegion{320 * 1024};
+HeapRegion spiramRegion{2 * 1024 * 1024};
+
+struct AllocHeader {
+    size_t size;
+    HeapRegion* region;
+    uint64_t pad; // keep user data 16-byte aligned
+};
+
+HeapRegion* regionFor(uint32_t caps) {
+    return (caps & MALLOC_CAP_SPIRAM) ? &spiramRegion : &internalRegion;
+}
+
+void trackUse(HeapRegion* region, long delta) {
+    size_t used = region->used += delta;
+    size_t peak = region->peak;
+    while (used > peak && !region->peak.compare_exchange_weak(peak, used)) {}
+}
+
+} // namespace
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+    HeapRegion* region = regionFor(caps);
+    if (region->used + size > region->capacity) return nullptr;
+
+    AllocHeader* header = (AllocHeader*)malloc(sizeof(AllocHeader) + size);
+    if (!header) return nullptr;
+    header->size = size;
+    header->region = region;
+    trackUse(region, (long)size);
+
+    sim::allocations().count++;
+    sim::allocations().bytes += size;
+    if (region == &internalRegion) sim::allocations().internalAllocs++;
+    return header + 1;
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    void* ptr = heap_caps_malloc(n * size, caps);
+    if (ptr) memset(ptr, 0, n * size);
+    return ptr;
+}
+
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+    if (!ptr) return heap_caps_malloc(size, caps);
+    if (size == 0) {
+        heap_caps_free(ptr);
+        return nullptr;
+    }
+
+    AllocHeader* header = (AllocHeader*)ptr - 1;
+    HeapRegion* region = regionFor(caps);
+    if (region != header->region) {
+        void* moved = heap_caps_malloc(size, caps);
+        if (!moved) return nullptr;
+        memcpy(moved, ptr, std::min(size, header->size));
+        heap_caps_free(ptr);
+        return moved;
+    }
+    if (region->used - header->size + size > region->capacity) return nullptr;
+
+    size_t oldSize = header->size;
+    AllocHeader* resized = (AllocHeader*)realloc(header, sizeof(AllocHeader) + size);
+    if (!resized) return nullptr;
+    resized->size = size;
+    trackUse(region, (long)size - (long)oldSize);
+
+    sim::allocations().count++;
+    sim::allocations().bytes += size;
+    return resized + 1;
+}
+
+void heap_caps_free(void* ptr) {
+    if (!ptr) return;
+    AllocHeader* header = (AllocHeader*)ptr - 1;
+    trackUse(header->region, -(long)header->size);
+    if (header->region == &internalRegion) sim::allocations().internalFrees++;
+    free(header);
+}
+
+size_t heap_caps_get_allocated_size(void* ptr) {
+    return ptr ? ((AllocHeader*)ptr - 1)->size : 0;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    HeapRegion* region = regionFor(caps);
+    return region->capacity - region->used;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    // Fragmentation is not modelled
+    return heap_caps_get_free_size(caps);
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    HeapRegion* region = regionFor(caps);
+    return region->capacity - region->peak;
+}
+
+bool psramFound() {
+    return true;
+}
+
+EspClass ESP;
+
+uint32_t EspClass::getFreeHeap() {
+    return heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+    return heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+    return heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+}
+
+uint32_t EspClass::getFreePsram() {
+    return heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+}
+
+uint32_t EspClass::getCycleCount() {
+    // Real time even when the clock is virtual, so code can be profiled
+    auto elapsed = std::chrono::steady_clock::now() - sim::processStart;
+    return (uint32_t)(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() * 240 / 1000);
+}
+
+void EspClass::restart() {
+    Serial.println("[sim] ESP.restart() requested, exiting");
+    fflush(stdout);
+    exit(0);
+}
+
+// ---------------------------------------------------------------------------
+// Serial, GPIO, random
+// ---------------------------------------------------------------------------
+
+HardwareSerial Serial;
+
+namespace sim {
+
+static std::atomic<bool> serialEcho{true};
+static std::atomic<uint64_t> serialBytes{0};
+
+void setSerialEcho(bool enabled) {
+    serialEcho = enabled;
+}
+
+uint64_t getSerialBytes() {
+    return serialBytes;
+}
+
+} // namespace sim
+
+size_t HardwareSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    sim::serialBytes += size;
+    if (sim::serialEcho) {
+        fwrite(buffer, 1, size, stdout);
+    }
+    return size;
+}
+
+static uint8_t pinModes[64];
+static int pinValues[64];
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin < 64) pinModes[pin] = mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin < 64) pinValues[pin] = value;
+}
+
+int digitalRead(uint8_t pin) {
+    return pin < 64 ? pinValues[pin] : 0;
+}
+
+void analogWrite(uint8_t pin, int value) {
+    if (pin < 64) pinValues[pin] = value;
+}
+
+int analogRead(uint8_t pin) {
+    return pin < 64 ? pinValues[pin] : 0;
+}
+
+// Fixed seed so runs are reproducible
+static std::mt19937 rng(0x0FF1CE);
+
+long random(long max) {
+    return max > 0 ? (long)(rng() % (unsigned long)max) : 0;
+}
+
+long random(long min, long max) {
+    return max > min ? min + random(max - min) : min;
+}
+
+void randomSeed(unsigned long seed) {
+    rng.seed(seed);
+}
+
+// ---------------------------------------------------------------------------
+// LEDC
+// ---------------------------------------------------------------------------
+
+struct LedcChannel {
+    bool configured;
+    int gpio;
+    uint32_t duty;             // Duty at fadeStartUs, or the fixed duty when idle
+    uint32_t targetDuty;
+    uint64_t fadeStartUs;
+    uint64_t fadeUs;
+    bool fadeArmed;            // ledc_set_fade_with_time called, waiting for ledc_fade_start
+    bool fading;
+    ledc_cb_t callback;
+    void* callbackArg;
+};
+
+static LedcChannel ledcChannels[LEDC_CHANNEL_MAX];
+static bool ledcFadeInstalled = false;
+
+static uint32_t ledcCurrentDuty(const LedcChannel& ch) {
+    if (!ch.fading) return ch.duty;
+    uint64_t elapsed = sim::nowUs() - ch.fadeStartUs;
+    if (elapsed >= ch.fadeUs) return ch.targetDuty;
+    int64_t delta = (int64_t)ch.targetDuty - (int64_t)ch.duty;
+    return (uint32_t)((int64_t)ch.duty + delta * (int64_t)elapsed / (int64_t)ch.fadeUs);
+}
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t* config) {
+    return config && config->timer_num < LEDC_TIMER_MAX ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t* config) {
+    if (!config || config->channel >= LEDC_CHANNEL_MAX) return ESP_ERR_INVALID_ARG;
+    LedcChannel& ch = ledcChannels[config->channel];
+    ch = LedcChannel();
+    ch.configured = true;
+    ch.gpio = config->gpio_num;
+    ch.duty = config->duty;
+    ch.targetDuty = config->duty;
+    if (config->gpio_num >= 0 && config->gpio_num < 64) pinValues[config->gpio_num] = config->duty;
+    return ESP_OK;
+}
+
+esp_err_t ledc_fade_func_install(int intr_alloc_flags) {
+    (void)intr_alloc_flags;
+    if (ledcFadeInstalled) return ESP_ERR_INVALID_STATE;
+    ledcFadeInstalled = true;
+    return ESP_OK;
+}
+
+esp_err_t ledc_cb_register(ledc_mode_t speed_mode, ledc_channel_t channel, ledc_cbs_t* cbs, void* user_arg) {
+    (void)speed_mode;
+    if (channel >= LEDC_CHANNEL_MAX || !cbs) return ESP_ERR_INVALID_ARG;
+    ledcChannels[channel].callback = cbs->fade_cb;
+    ledcChannels[channel].callbackArg = user_arg;
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_duty_and_update(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t duty, uint32_t hpoint) {
+    (void)speed_mode;
+    (void)hpoint;
+    if (channel >= LEDC_CHANNEL_MAX || !ledcChannels[channel].configured) return ESP_ERR_INVALID_ARG;
+    LedcChannel& ch = ledcChannels[channel];
+    if (ch.fading) return ESP_ERR_INVALID_STATE; // Blocks on hardware until the fade ends
+    ch.duty = duty;
+    ch.targetDuty = duty;
+    if (ch.gpio >= 0 && ch.gpio < 64) pinValues[ch.gpio] = duty;
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_fade_with_time(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t target_duty, int max_fade_time_ms) {
+    (void)speed_mode;
+    if (channel >= LEDC_CHANNEL_MAX || !ledcChannels[channel].configured) return ESP_ERR_INVALID_ARG;
+    if (!ledcFadeInstalled) return ESP_ERR_INVALID_STATE;
+    LedcChannel& ch = ledcChannels[channel];
+    if (ch.fading) {
+        // The real driver waits for the running fade, which would stall the caller
+        printf("[sim] ledc channel %d: fade requested while fading, caller would block\n", channel);
+        return ESP_ERR_INVALID_STATE;
+    }
+    ch.targetDuty = target_duty;
+    ch.fadeUs = (uint64_t)(max_fade_time_ms > 0 ? max_fade_time_ms : 0) * 1000;
+    ch.fadeArmed = true;
+    return ESP_OK;
+}
+
+esp_err_t ledc_fade_start(ledc_mode_t speed_mode, ledc_channel_t channel, ledc_fade_mode_t fade_mode) {
+    if (channel >= LEDC_CHANNEL_MAX || !ledcChannels[channel].fadeArmed) return ESP_ERR_INVALID_STATE;
+    LedcChannel& ch = ledcChannels[channel];
+    ch.fadeArmed = false;
+    ch.fading = true;
+    ch.fadeStartUs = sim::nowUs();
+
+    // The fade-end interrupt fires from the clock when the duty reaches its target
+    sim::scheduleAt(ch.fadeStartUs + ch.fadeUs, [speed_mode, channel]() {
+        LedcChannel& done = ledcChannels[channel];
+        done.fading = false;
+        done.duty = done.targetDuty;
+        if (done.gpio >= 0 && done.gpio < 64) pinValues[done.gpio] = done.duty;
+        if (done.callback) {
+            ledc_cb_param_t param = {LEDC_FADE_END_EVT, (uint32_t)speed_mode, (uint32_t)channel, done.duty};
+            done.callback(&param, done.callbackArg);
+        }
+    });
+
+    if (fade_mode == LEDC_FADE_WAIT_DONE) {
+        delay((uint32_t)(ch.fadeUs / 1000));
+    }
+    return ESP_OK;
+}
+
+uint32_t ledc_get_duty(ledc_mode_t speed_mode, ledc_channel_t channel) {
+    (void)speed_mode;
+    return channel < LEDC_CHANNEL_MAX ? ledcCurrentDuty(ledcChannels[channel]) : 0;
+}
+
+// ---------------------------------------------------------------------------
+// Temperature sensor
+// ---------------------------------------------------------------------------
+
+namespace sim {
+
+static std::mutex curveLock;
+static TemperatureCurve temperatureCurve = [](uint64_t) { return 24.0f; };
+
+void setTemperatureCurve(TemperatureCurve curve) {
+    std::lock_guard<std::mutex> guard(curveLock);
+    temperatureCurve = curve;
+}
+
+bool setTemperatureCurve(const std::string& preset) {
+    if (preset == "steady") {
+        setTemperatureCurve([](uint64_t ms) { return 24.0f + 0.1f * sinf(ms / 7000.0f); });
+    } else if (preset == "ramp") {
+        // +0.5 C/min from 22 C, levelling off at 40 C
+        setTemperatureCurve([](uint64_t ms) { return std::min(22.0f + ms / 120000.0f, 40.0f); });
+    } else if (preset == "sine") {
+        // 10 minute period between 8 and 38 C, crosses both default thresholds
+        setTemperatureCurve([](uint64_t ms) { return 23.0f + 15.0f * sinf(ms * 2.0f * (float)M_PI / 600000.0f); });
+    } else if (preset == "spike") {
+        // Excursion above the default 35 C threshold from minute 2 to 5
+        setTemperatureCurve([](uint64_t ms) { return (ms >= 120000 && ms < 300000) ? 38.0f : 24.0f; });
+    } else if (preset == "cold") {
+        setTemperatureCurve([](uint64_t) { return 8.0f; });
+    } else {
+        return false;
+    }
+    return true;
+}
+
+float readTemperature() {
+    std::lock_guard<std::mutex> guard(curveLock);
+    return temperatureCurve(nowUs() / 1000);
+}
+
+} // namespace sim
+
+struct temperature_sensor_obj_t {
+    bool enabled;
+};
+
+esp_err_t temperature_sensor_install(const temperature_sensor_config_t* config, temperature_sensor_handle_t* handle) {
+    if (!config || !handle) return ESP_ERR_INVALID_ARG;
+    *handle = new temperature_sensor_obj_t{false};
+    return ESP_OK;
+}
+
+esp_err_t temperature_sensor_uninstall(temperature_sensor_handle_t handle) {
+    delete handle;
+    return ESP_OK;
+}
+
+esp_err_t temperature_sensor_enable(temperature_sensor_handle_t handle) {
+    if (!handle) return ESP_ERR_INVALID_ARG;
+    handle->enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t temperature_sensor_disable(temperature_sensor_handle_t handle) {
+    if (!handle) return ESP_ERR_INVALID_ARG;
+    handle->enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t temperature_sensor_get_celsius(temperature_sensor_handle_t handle, float* celsius) {
+    if (!handle || !celsius) return ESP_ERR_INVALID_ARG;
+    if (!handle->enabled) return ESP_ERR_INVALID_STATE;
+    *celsius = sim::readTemperature();
+    return ESP_OK;
+}
+
+// ---------------------------------------------------------------------------
+// In-memory filesystem
+// ---------------------------------------------------------------------------
+
+namespace fs {
+
+// Files live in flash on the device, so their storage bypasses the counted
+// operator new and never shows up as internal heap
+template <typename T>
+struct FlashAllocator {
+    using value_type = T;
+
+    FlashAllocator() = default;
+    template <typename U>
+    FlashAllocator(const FlashAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        T* ptr = (T*)malloc(n * sizeof(T));
+        if (!ptr) throw std::bad_alloc();
+        return ptr;
+    }
+    void deallocate(T* ptr, size_t) {
+        free(ptr);
+    }
+
+    template <typename U>
+    bool operator==(const FlashAllocator<U>&) const { return true; }
+    template <typename U>
+    bool operator!=(const FlashAllocator<U>&) const { return false; }
+};
+
+typedef std::basic_string<char, std::char_traits<char>, FlashAllocator<char>> FlashString;
+
+struct FileData {
+    std::mutex lock;
+    FlashString bytes;
+};
+
+static std::shared_ptr<FileData> newFileData() {
+    return std::allocate_shared<FileData>(FlashAllocator<FileData>());
+}
+
+} // namespace fs
+
+namespace sim {
+
+static std::mutex fsLock;
+static std::map<fs::FlashString, std::shared_ptr<fs::FileData>, std::less<fs::FlashString>,
+                fs::FlashAllocator<std::pair<const fs::FlashString, std::shared_ptr<fs::FileData>>>> files;
+
+void seedFile(const std::string& path, const std::string& contents) {
+    auto data = fs::newFileData();
+    data->bytes.assign(contents.begin(), contents.end());
+    std::lock_guard<std::mutex> guard(fsLock);
+    files[path.c_str()] = data;
+}
+
+int seedFromDirectory(const std::string& hostDir) {
+    namespace stdfs = std::filesystem;
+    std::error_code ec;
+    if (!stdfs::is_directory(hostDir, ec)) return -1;
+
+    int count = 0;
+    for (const auto& entry : stdfs::recursive_directory_iterator(hostDir, ec)) {
+        if (!entry.is_regular_file()) continue;
+        std::ifstream in(entry.path(), std::ios::binary);
+        std::stringstream contents;
+        contents << in.rdbuf();
+        seedFile("/" + stdfs::relative(entry.path(), hostDir).generic_string(), contents.str());
+        count++;
+    }
+    return count;
+}
+
+bool readFile(const std::string& path, std::string& contents) {
+    std::lock_guard<std::mutex> guard(fsLock);
+    auto it = files.find(path.c_str());
+    if (it == files.end()) return false;
+    std::lock_guard<std::mutex> dataGuard(it->second->lock);
+    contents.assign(it->second->bytes.begin(), it->second->bytes.end());
+    return true;
+}
+
+size_t getFileCount() {
+    std::lock_guard<std::mutex> guard(fsLock);
+    return files.size();
+}
+
+} // namespace sim
+
+namespace fs {
+
+File::File(std::shared_ptr<FileData> data, const std::string& path, bool writable, bool append)
+    : data(data), filePath(path), pos(0), writable(writable) {
+    if (append) pos = data->bytes.size();
+}
+
+size_t File::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+    if (!data || !writable) return 0;
+    std::lock_guard<std::mutex> guard(data->lock);
+    if (pos + size > data->bytes.size()) data->bytes.resize(pos + size);
+    memcpy(&data->bytes[pos], buffer, size);
+    pos += size;
+    return size;
+}
+
+int File::available() {
+    if (!data) return 0;
+    std::lock_guard<std::mutex> guard(data->lock);
+    return pos < data->bytes.size() ? (int)(data->bytes.size() - pos) : 0;
+}
+
+int File::read() {
+    if (!data) return -1;
+    std::lock_guard<std::mutex> guard(data->lock);
+    return pos < data->bytes.size() ? (uint8_t)data->bytes[pos++] : -1;
+}
+
+int File::peek() {
+    if (!data) return -1;
+    std::lock_guard<std::mutex> guard(data->lock);
+    return pos < data->bytes.size() ? (uint8_t)data->bytes[pos] : -1;
+}
+
+size_t File::readBytes(char* buffer, size_t length) {
+    if (!data) return 0;
+    std::lock_guard<std::mutex> guard(data->lock);
+    size_t n = pos < data->bytes.size() ? std::min(length, data->bytes.size() - pos) : 0;
+    memcpy(buffer, data->bytes.data() + pos, n);
+    pos += n;
+    return n;
+}
+
+bool File::seek(uint32_t position) {
+    if (!data) return false;
+    std::lock_guard<std::mutex> guard(data->lock);
+    if (position > data->bytes.size()) return false;
+    pos = position;
+    return true;
+}
+
+size_t File::size() const {
+    if (!data) return 0;
+    std::lock_guard<std::mutex> guard(data->lock);
+    return data->bytes.size();
+}
+
+const char* File::name() const {
+    size_t slash = filePath.rfind('/');
+    return filePath.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+}
+
+File FS::open(const char* path, const char* mode) {
+    std::lock_guard<std::mutex> guard(sim::fsLock);
+    auto it = sim::files.find(path);
+
+    if (mode[0] == 'r') {
+        if (it == sim::files.end()) return File();
+        return File(it->second, path, false, false);
+    }
+
+    // "w" replaces the contents, "a" appends; readers keep their snapshot
+    std::shared_ptr<FileData> data;
+    if (mode[0] == 'a' && it != sim::files.end()) {
+        data = it->second;
+    } else {
+        data = newFileData();
+        sim::files[path] = data;
+    }
+    return File(data, path, true, mode[0] == 'a');
+}
+
+bool FS::exists(const char* path) {
+    std::lock_guard<std::mutex> guard(sim::fsLock);
+    std::string prefix = std::string(path) + "/";
+    for (const auto& entry : sim::files) {
+        if (entry.first == path || entry.first.compare(0, prefix.size(), prefix.c_str()) == 0) return true;
+    }
+    return false;
+}
+
+bool FS::remove(const char* path) {
+    std::lock_guard<std::mutex> guard(sim::fsLock);
+    return sim::files.erase(path) > 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+    std::lock_guard<std::mutex> guard(sim::fsLock);
+    auto it = sim::files.find(from);
+    if (it == sim::files.end()) return false;
+    sim::files[to] = it->second;
+    sim::files.erase(it);
+    return true;
+}
+
+} // namespace fs
+
+SPIFFSFS SPIFFS;
+
+size_t SPIFFSFS::usedBytes() {
+    std::lock_guard<std::mutex> guard(sim::fsLock);
+    size_t used = 0;
+    for (const auto& entry : sim::files) {
+        used += entry.second->bytes.size();
+    }
+    return used;
+}
+
+// ---------------------------------------------------------------------------
+// Preferences
+// ---------------------------------------------------------------------------
+
+static std::mutex nvsLock;
+static std::map<std::string, std::map<std::string, std::string>> nvs;
+
+bool Preferences::begin(const char* name, bool readOnly) {
+    (void)readOnly;
+    ns = name;
+    opened = true;
+    return true;
+}
+
+void Preferences::put(const char* key, const std::string& value) {
+    if (!opened) return;
+    std::lock_guard<std::mutex> guard(nvsLock);
+    nvs[ns][key] = value;
+}
+
+bool Preferences::get(const char* key, std::string& value) {
+    if (!opened) return false;
+    std::lock_guard<std::mutex> guard(nvsLock);
+    auto space = nvs.find(ns);
+    if (space == nvs.end()) return false;
+    auto it = space->second.find(key);
+    if (it == space->second.end()) return false;
+    value = it->second;
+    return true;
+}
+
+bool Preferences::clear() {
+    std::lock_guard<std::mutex> guard(nvsLock);
+    nvs.erase(ns);
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    std::lock_guard<std::mutex> guard(nvsLock);
+    return nvs[ns].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+    std::string value;
+    return get(key, value);
+}
+
+String Preferences::getString(const char* key, const String& def) {
+    std::string value;
+    return get(key, value) ? String(value) : def;
+}
+
+bool Preferences::getBool(const char* key, bool def) {
+    std::string value;
+    return get(key, value) ? value == "1" : def;
+}
+
+int32_t Preferences::getInt(const char* key, int32_t def) {
+    std::string value;
+    return get(key, value) ? (int32_t)strtol(value.c_str(), nullptr, 10) : def;
+}
+
+uint8_t Preferences::getUChar(const char* key, uint8_t def) {
+    std::string value;
+    return get(key, value) ? (uint8_t)strtoul(value.c_str(), nullptr, 10) : def;
+}
+
+uint32_t Preferences::getULong(const char* key, uint32_t def) {
+    std::string value;
+    return get(key, value) ? (uint32_t)strtoul(value.c_str(), nullptr, 10) : def;
+}
+
+float Preferences::getFloat(const char* key, float def) {
+    std::string value;
+    return get(key, value) ? strtof(value.c_str(), nullptr) : def;
+}
+
+// ---------------------------------------------------------------------------
+// WiFi
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct SimNetwork {
+    std::string ssid;
+    int32_t rssi;
+    uint8_t channel;
+    bool open;
+};
+
+struct WiFiState {
+    std::recursive_mutex lock;
+    std::vector<SimNetwork> networks;
+    std::vector<SimNetwork> scanResults;
+    std::vector<std::pair<WiFiEventFuncCb, arduino_event_id_t>> handlers;
+    wifi_mode_t mode = WIFI_OFF;
+    wl_status_t status = WL_IDLE_STATUS;
+    std::string ssid;
+    int32_t rssi = 0;
+    uint8_t channel = 0;
+    uint32_t associationDelayMs = 1500;
+    uint32_t attempt = 0;
+    bool autoConnect = false;
+};
+
+WiFiState& wifiState() {
+    static WiFiState state;
+    return state;
+}
+
+void fireWiFiEvent(arduino_event_id_t event) {
+    std::vector<WiFiEventFuncCb> matching;
+    {
+        std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+        for (const auto& handler : wifiState().handlers) {
+            if (handler.second == event || handler.second == ARDUINO_EVENT_MAX) {
+                matching.push_back(handler.first);
+            }
+        }
+    }
+
+    // Real callbacks run on the event task, never under driver locks
+    WiFiEventInfo_t info = {0};
+    for (const auto& callback : matching) {
+        callback(event, info);
+    }
+}
+
+} // namespace
+
+namespace sim {
+
+void addNetwork(const std::string& ssid, int32_t rssi, uint8_t channel, bool open) {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    wifiState().networks.push_back({ssid, rssi, channel, open});
+}
+
+void setAssociationDelayMs(uint32_t ms) {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    wifiState().associationDelayMs = ms;
+}
+
+void dropConnection() {
+    {
+        std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+        if (wifiState().status != WL_CONNECTED) return;
+        wifiState().status = WL_CONNECTION_LOST;
+        wifiState().attempt++;
+    }
+    fireWiFiEvent(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+}
+
+} // namespace sim
+
+WiFiClass WiFi;
+
+bool WiFiClass::mode(wifi_mode_t mode) {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    wifiState().mode = mode;
+    return true;
+}
+
+wifi_mode_t WiFiClass::getMode() {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    return wifiState().mode;
+}
+
+bool WiFiClass::setAutoConnect(bool enabled) {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    wifiState().autoConnect = enabled;
+    return true;
+}
+
+bool WiFiClass::getAutoConnect() {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    return wifiState().autoConnect;
+}
+
+bool WiFiClass::setAutoReconnect(bool enabled) {
+    (void)enabled;
+    return true;
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* password) {
+    (void)password;
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    WiFiState& state = wifiState();
+    state.status = WL_DISCONNECTED;
+    state.ssid = ssid ? ssid : "";
+    uint32_t attempt = ++state.attempt;
+
+    // Association completes (or fails) on the simulated timeline
+    sim::scheduleAt(sim::nowUs() + (uint64_t)state.associationDelayMs * 1000, [attempt]() {
+        bool found = false;
+        {
+            std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+            WiFiState& state = wifiState();
+            if (attempt != state.attempt) return; // Superseded by another begin()
+
+            for (const auto& network : state.networks) {
+                if (network.ssid == state.ssid) {
+                    state.rssi = network.rssi;
+                    state.channel = network.channel;
+                    found = true;
+                    break;
+                }
+            }
+            state.status = found ? WL_CONNECTED : WL_NO_SSID_AVAIL;
+        }
+
+        if (found) {
+            fireWiFiEvent(ARDUINO_EVENT_WIFI_STA_CONNECTED);
+            fireWiFiEvent(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+        } else {
+            fireWiFiEvent(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+        }
+    });
+    return state.status;
+}
+
+bool WiFiClass::disconnect(bool wifiOff) {
+    bool wasConnected;
+    {
+        std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+        wasConnected = wifiState().status == WL_CONNECTED;
+        wifiState().status = WL_DISCONNECTED;
+        wifiState().attempt++;
+        if (wifiOff) wifiState().mode = WIFI_OFF;
+    }
+    if (wasConnected) fireWiFiEvent(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    return true;
+}
+
+wl_status_t WiFiClass::status() {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    return wifiState().status;
+}
+
+int16_t WiFiClass::scanNetworks() {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    wifiState().scanResults = wifiState().networks;
+    return (int16_t)wifiState().scanResults.size();
+}
+
+String WiFiClass::SSID(uint8_t index) {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    return index < wifiState().scanResults.size() ? String(wifiState().scanResults[index].ssid) : String();
+}
+
+int32_t WiFiClass::RSSI(uint8_t index) {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    return index < wifiState().scanResults.size() ? wifiState().scanResults[index].rssi : 0;
+}
+
+int32_t WiFiClass::channel(uint8_t index) {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    return index < wifiState().scanResults.size() ? wifiState().scanResults[index].channel : 0;
+}
+
+wifi_auth_mode_t WiFiClass::encryptionType(uint8_t index) {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    if (index >= wifiState().scanResults.size()) return WIFI_AUTH_OPEN;
+    return wifiState().scanResults[index].open ? WIFI_AUTH_OPEN : WIFI_AUTH_WPA2_PSK;
+}
+
+String WiFiClass::SSID() {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    return wifiState().status == WL_CONNECTED ? String(wifiState().ssid) : String();
+}
+
+int8_t WiFiClass::RSSI() {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    return wifiState().status == WL_CONNECTED ? (int8_t)wifiState().rssi : 0;
+}
+
+int32_t WiFiClass::channel() {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    return wifiState().status == WL_CONNECTED ? wifiState().channel : 0;
+}
+
+IPAddress WiFiClass::localIP() {
+    return status() == WL_CONNECTED ? IPAddress(192, 168, 1, 50) : IPAddress();
+}
+
+String WiFiClass::macAddress() {
+    return String("24:0A:C4:5E:00:01");
+}
+
+bool WiFiClass::softAP(const char* ssid, const char* password) {
+    (void)ssid;
+    (void)password;
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    if (wifiState().mode == WIFI_STA) wifiState().mode = WIFI_AP_STA;
+    else if (wifiState().mode == WIFI_OFF) wifiState().mode = WIFI_AP;
+    return true;
+}
+
+bool WiFiClass::softAPdisconnect(bool wifiOff) {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    if (wifiState().mode == WIFI_AP_STA) wifiState().mode = WIFI_STA;
+    else if (wifiState().mode == WIFI_AP && wifiOff) wifiState().mode = WIFI_OFF;
+    return true;
+}
+
+IPAddress WiFiClass::softAPIP() {
+    return IPAddress(192, 168, 4, 1);
+}
+
+int WiFiClass::onEvent(WiFiEventFuncCb callback, arduino_event_id_t event) {
+    std::lock_guard<std::recursive_mutex> guard(wifiState().lock);
+    wifiState().handlers.emplace_back(callback, event);
+    return (int)wifiState().handlers.size();
+}
+
+// ---------------------------------------------------------------------------
+// NTP
+// ---------------------------------------------------------------------------
+
+namespace sim {
+
+static std::atomic<uint32_t> wallClockBase{0};
+static std::atomic<uint64_t> wallClockSetAtUs{0};
+
+void setWallClock(uint32_t epochSeconds) {
+    wallClockSetAtUs = nowUs();
+    wallClockBase = epochSeconds;
+}
+
+static uint32_t wallClockNow() {
+    uint32_t base = wallClockBase;
+    if (base == 0) return 0;
+    return base + (uint32_t)((nowUs() - wallClockSetAtUs) / 1000000);
+}
+
+} // namespace sim
+
+NTPClient::NTPClient(WiFiUDP& udp, const char* poolServerName, long timeOffset, unsigned long updateInterval)
+    : timeOffset(timeOffset), updateInterval(updateInterval), lastUpdate(0), syncedEpoch(0) {
+    (void)udp;
+    (void)poolServerName;
+}
+
+bool NTPClient::update() {
+    if (lastUpdate != 0 && millis() - lastUpdate < updateInterval) return false;
+    return forceUpdate();
+}
+
+bool NTPClient::forceUpdate() {
+    if (WiFi.status() != WL_CONNECTED) return false;
+    uint32_t epoch = sim::wallClockNow();
+    if (epoch == 0) return false;
+    syncedEpoch = epoch;
+    lastUpdate = millis();
+    if (lastUpdate == 0) lastUpdate = 1;
+    return true;
+}
+
+unsigned long NTPClient::getEpochTime() const {
+    return timeOffset + syncedEpoch + (millis() - lastUpdate) / 1000;
+}
+
+String NTPClient::getFormattedTime() const {
+    unsigned long epoch = getEpochTime();
+    char buf[9];
+    snprintf(buf, sizeof(buf), "%02lu:%02lu:%02lu", (epoch % 86400) / 3600, (epoch % 3600) / 60, epoch % 60);
+    return String(buf);
+}
+
+// ---------------------------------------------------------------------------
+// FastLED
+// ---------------------------------------------------------------------------
+
+CFastLED FastLED;
+
+CRGB& CRGB::operator=(const CHSV& hsv) {
+    // Six-sector spectrum conversion, close enough to FastLED's rainbow for inspection
+    uint8_t region = hsv.h / 43;
+    uint8_t remainder = (hsv.h - region * 43) * 6;
+    uint8_t p = (hsv.v * (255 - hsv.s)) >> 8;
+    uint8_t q = (hsv.v * (255 - ((hsv.s * remainder) >> 8))) >> 8;
+    uint8_t t = (hsv.v * (255 - ((hsv.s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 0: r = hsv.v; g = t; b = p; break;
+        case 1: r = q; g = hsv.v; b = p; break;
+        case 2: r = p; g = hsv.v; b = t; break;
+        case 3: r = p; g = q; b = hsv.v; break;
+        case 4: r = t; g = p; b = hsv.v; break;
+        default: r = hsv.v; g = p; b = q; break;
+    }
+    return *this;
+}
+
+CRGB& CRGB::nscale8(uint8_t scale) {
+    r = ((uint16_t)r * (1 + scale)) >> 8;
+    g = ((uint16_t)g * (1 + scale)) >> 8;
+    b = ((uint16_t)b * (1 + scale)) >> 8;
+    return *this;
+}
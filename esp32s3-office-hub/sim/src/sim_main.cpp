@@ -0,0 +1,1515 @@
+// Entry point for the host simulation build (pio run -e native).
+//
+//   --run SECONDS   run the firmware for SECONDS of simulated time (default 600)
+//   --bench N       inject N WebSocket messages of each type, report latency and allocations
+//   --soak ROUNDS   every WebSocket message type once per simulated second for ROUNDS
+//                   seconds, exit 1 if internal-heap allocations and frees do not net out
+//   --serve PORT    real-time mode with a loopback TCP listener on 127.0.0.1:PORT
+//   --temp PRESET   temperature curve: steady, ramp, sine, spike, cold (default steady)
+//   --data DIR      directory seeded into the in-memory SPIFFS (default data)
+//   --no-wifi       no access points in range, exercises the hotspot fallback
+//   --quiet         mute firmware serial output
+//   --render MODE   print an LED effect as "t_ms RRGGBB" lines, with --frames N, --fps F,
+//                   --color #RRGGBB and --golden FILE (exit 1 if the frames differ);
+//                   --render all --golden DIR checks every mode against DIR/MODE.txt
+//   --led-bench SECONDS  drive the full strip at LED_TARGET_FPS for each mode and report
+//                   frame cost, host frames/s, CPU% at the target rate and elided show() calls
+//   --compile FILE  compile LED sequence source and print the hex for led_sequence_upload,
+//                   --out FILE also writes the bytecode
+//   --disasm FILE   disassemble a compiled sequence, or source after compiling it
+//   --seq-bench FILE  play a sequence for 60 simulated seconds and report interpreter cost
+//   --usb-image FILE  plug a FAT disk image into the USB host port, formatting a new one
+//                   of --usb-size MB (default 128) if FILE does not exist
+//   --usb-check     mount the image (a scratch one without --usb-image), exercise the file
+//                   calls and hot-plug, exit 1 on any failure
+//   --usb-stream-check  boot the firmware with the image and push files through the
+//                   /api/usb/files routes: streamed upload, Range downloads, multipart,
+//                   abandoned transfers; reports stream memory and rates, exit 1 on failure
+//   --usb-list-check  boot the firmware, fill a folder with 1500 files and page through it
+//                   over HTTP: sort orders, cursors across changes, cached snapshots
+//   --usb-bench     sequential 8 MB write/read, random 4K reads and 4 KB files against the
+//                   image, first straight to the stick and then through the block cache
+//   --history-check  feed a month of readings through the history store, first with no
+//                   stick and then with one, and compare queries across the USB, flash
+//                   and RAM tiers with what went in; reports bytes per reading and
+//                   flash writes per day, exit 1 on failure
+//   --usb-serial    plug a loopback USB-serial adapter into the port instead (with --serve)
+//   --serial-check  real time: bridge the loopback adapter to /ws/serial and check line
+//                   coding, echo integrity, backpressure and replug; reports throughput
+//                   and round-trip latency, exit 1 on failure
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "alert_rules.h"
+#include "esp_heap_caps.h"
+#include "history_store.h"
+#include "led_controller.h"
+#include "led_sequence.h"
+#include "ledseq_compiler.h"
+#include "memory_policy.h"
+#include "sim_hal.h"
+#include "temperature_sensor.h"
+#include "timer_service.h"
+#include "usb_host.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+
+void setup();
+void loop();
+
+extern AsyncWebServer server;
+extern AsyncWebSocket ws;
+extern TemperatureSensor tempSensor;
+extern TimerService timerService;
+extern AlertRulesEngine alertRules;
+extern USBHostManager usbManager;
+extern SerialBridge serialBridge;
+extern AsyncWebSocket serialSocket;
+
+struct BenchCase {
+    const char* type;
+    const char* message;
+};
+
+// One representative message per handler branch in handleWebSocketMessage
+static const BenchCase benchCases[] = {
+    {"get_status", "{\"type\":\"get_status\"}"},
+    {"get_temperature", "{\"type\":\"get_temperature\"}"},
+    {"rgb_color", "{\"type\":\"rgb_color\",\"color\":\"#3366FF\"}"},
+    {"rgb_mode", "{\"type\":\"rgb_mode\",\"mode\":\"solid\"}"},
+    {"rgb_brightness", "{\"type\":\"rgb_brightness\",\"value\":128}"},
+    {"large_led", "{\"type\":\"large_led\",\"state\":true}"},
+    {"brightness", "{\"type\":\"brightness\",\"value\":200}"},
+    {"wifi_scan", "{\"type\":\"wifi_scan\"}"},
+    {"usb_list_files", "{\"type\":\"usb_list_files\"}"},
+    {"get_timers", "{\"type\":\"get_timers\"}"},
+    {"save_config", "{\"type\":\"save_config\"}"},
+    {"update_setting", "{\"type\":\"update_setting\",\"setting\":\"temp_threshold\",\"value\":\"30.5\"}"},
+    {"update_schedules", "{\"type\":\"update_schedules\",\"schedules\":[{\"name\":\"morning\",\"time\":\"09:00\","
+                         "\"days\":\"weekdays\",\"action\":\"rgb_color\",\"value\":\"#FFFFFF\"}]}"},
+};
+
+static void runFor(uint64_t durationMs) {
+    uint64_t end = sim::nowUs() + durationMs * 1000;
+    while (sim::nowUs() < end) {
+        loop();
+    }
+}
+
+static void waitForBootWorker() {
+    // The worker thread runs in real time, history is merged on the next reading
+    for (int i = 0; i < 200 && !tempSensor.isHistoryLoaded(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        runFor(tempSensor.getReadingInterval());
+    }
+}
+
+static uint64_t percentile(std::vector<uint64_t> values, double p) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    size_t index = (size_t)(p * (values.size() - 1) + 0.5);
+    return values[index];
+}
+
+static void runBenchmark(int iterations) {
+    uint64_t txBytes = 0;
+    AsyncWebSocketClient* client = ws.connectClient([&txBytes](uint32_t id, const char* data, size_t len) {
+        (void)id;
+        (void)data;
+        txBytes += len;
+    });
+
+    printf("\n%-18s %7s %10s %10s %10s %10s %12s %10s\n",
+           "message", "n", "mean_us", "p50_us", "p99_us", "allocs", "alloc_bytes", "tx_bytes");
+
+    for (const BenchCase& bench : benchCases) {
+        size_t len = strlen(bench.message);
+
+        // Warm up arenas, pools and lazily created state
+        for (int i = 0; i < 3; i++) {
+            ws.injectText(client, bench.message, len);
+        }
+
+        std::vector<uint64_t> latencies;
+        latencies.reserve(iterations);
+        uint64_t allocCount = 0;
+        uint64_t allocBytes = 0;
+        uint64_t messageTx = 0;
+
+        for (int i = 0; i < iterations; i++) {
+            uint64_t countBefore = sim::allocations().count;
+            uint64_t bytesBefore = sim::allocations().bytes;
+            uint64_t txBefore = txBytes;
+            auto start = std::chrono::steady_clock::now();
+
+            ws.injectText(client, bench.message, len);
+
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            allocCount += sim::allocations().count - countBefore;
+            allocBytes += sim::allocations().bytes - bytesBefore;
+            messageTx += txBytes - txBefore;
+            latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+            // Keep the firmware's timers running between messages
+            if (i % 16 == 15) loop();
+        }
+
+        uint64_t total = 0;
+        for (uint64_t ns : latencies) total += ns;
+        printf("%-18s %7d %10.2f %10.2f %10.2f %10.1f %12.1f %10.1f\n",
+               bench.type, iterations,
+               total / 1000.0 / iterations,
+               percentile(latencies, 0.50) / 1000.0,
+               percentile(latencies, 0.99) / 1000.0,
+               (double)allocCount / iterations,
+               (double)allocBytes / iterations,
+               (double)messageTx / iterations);
+    }
+
+    ws.disconnectClient(client);
+}
+
+// Every handler branch once per round with a simulated second of timers in
+// between; after a warm-up the internal heap has to net out to zero blocks
+static int runSoak(int rounds) {
+    AsyncWebSocketClient* client = ws.connectClient([](uint32_t, const char*, size_t) {});
+    auto round = [client]() {
+        for (const BenchCase& bench : benchCases) {
+            ws.injectText(client, bench.message, strlen(bench.message));
+        }
+        runFor(1000);
+    };
+
+    // Lazily created state, pools and the first round of deferred reloads
+    for (int i = 0; i < 10; i++) round();
+
+    sim::AllocCounters& counters = sim::allocations();
+    uint64_t allocsBefore = counters.internalAllocs;
+    uint64_t freesBefore = counters.internalFrees;
+    size_t freeBefore = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+
+    for (int i = 0; i < rounds; i++) round();
+
+    uint64_t allocs = counters.internalAllocs - allocsBefore;
+    uint64_t frees = counters.internalFrees - freesBefore;
+    size_t freeAfter = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ws.disconnectClient(client);
+
+    int64_t net = (int64_t)(allocs - frees);
+    printf("soak: %d rounds of %zu messages, %llu s simulated\n", rounds,
+           sizeof(benchCases) / sizeof(benchCases[0]), (unsigned long long)(sim::nowUs() / 1000000));
+    printf("  internal heap: %llu allocations, %llu frees, net %lld blocks\n",
+           (unsigned long long)allocs, (unsigned long long)frees, (long long)net);
+    printf("  heap_caps internal free: %zu -> %zu bytes\n", freeBefore, freeAfter);
+    printf("  memory: %s\n", MemoryPolicy::getStatsJSON().c_str());
+    if (net != 0 || freeAfter != freeBefore) {
+        printf("Soak FAILED: internal heap did not net out\n");
+        return 1;
+    }
+    printf("Soak passed\n");
+    return 0;
+}
+
+static const LEDMode renderModes[] = {SOLID, BLINK, PULSE, RAINBOW, BREATHING, FADE};
+
+static int renderEffect(const String& modeName, int frames, int fps, const String& colorHex, const char* goldenPath) {
+    if (modeName == "all") {
+        if (!goldenPath) {
+            fprintf(stderr, "--render all needs --golden DIR\n");
+            return 2;
+        }
+        int result = 0;
+        for (LEDMode mode : renderModes) {
+            String name = LEDController::modeName(mode);
+            String path = String(goldenPath) + "/" + name + ".txt";
+            result = std::max(result, renderEffect(name, frames, fps, colorHex, path.c_str()));
+        }
+        return result;
+    }
+
+    LEDMode mode;
+    if (!LEDController::parseMode(modeName, mode)) {
+        fprintf(stderr, "Unknown LED mode: %s\n", modeName.c_str());
+        return 2;
+    }
+
+    LEDController leds;
+    CRGB color = leds.hexToColor(colorHex);
+
+    // Frame times are exact multiples of the frame period, independent of the loop
+    std::ostringstream out;
+    for (int i = 0; i < frames; i++) {
+        uint32_t t = (uint32_t)((uint64_t)i * 1000 / fps);
+        CRGB pixel = LEDController::renderMode(mode, t, color);
+        char line[32];
+        snprintf(line, sizeof(line), "%u %02X%02X%02X\n", t, pixel.r, pixel.g, pixel.b);
+        out << line;
+    }
+
+    if (!goldenPath) {
+        fputs(out.str().c_str(), stdout);
+        return 0;
+    }
+
+    std::ifstream golden(goldenPath);
+    if (!golden) {
+        fprintf(stderr, "Cannot read golden file %s\n", goldenPath);
+        return 2;
+    }
+    std::stringstream expected;
+    expected << golden.rdbuf();
+    if (expected.str() != out.str()) {
+        fprintf(stderr, "%s: frames differ from %s\n", modeName.c_str(), goldenPath);
+        return 1;
+    }
+    printf("%s: %d frames match %s\n", modeName.c_str(), frames, goldenPath);
+    return 0;
+}
+
+struct LedBenchCase {
+    const char* name;
+    LEDMode mode;
+    bool alert;
+};
+
+static const LedBenchCase ledBenchCases[] = {
+    {"solid", SOLID, false},
+    {"blink", BLINK, false},
+    {"pulse", PULSE, false},
+    {"breathing", BREATHING, false},
+    {"rainbow", RAINBOW, false},
+    {"fade", FADE, false},
+    {"solid+alert", SOLID, true},
+    {"rainbow+alert", RAINBOW, true},
+};
+
+static void runLedBenchmark(int seconds) {
+    printf("\n%d pixels at %d FPS, %d s per case (host timings; /api/leds reports on-device cost)\n",
+           NUM_RGB_LEDS, LED_TARGET_FPS, seconds);
+    printf("%-15s %7s %7s %7s %10s %10s %11s %8s\n",
+           "case", "frames", "shown", "skipped", "mean_us", "p99_us", "max_fps", "cpu_%");
+
+    for (const LedBenchCase& bench : ledBenchCases) {
+        LEDController leds;
+        leds.begin();
+        leds.setRGBColor(CRGB(0x33, 0x66, 0xFF));
+        leds.setMode(bench.mode);
+        leds.setStatusIndicator(CRGB::Green);
+        if (bench.alert) leds.setAlertOverlay(CRGB::Red);
+        leds.getCompositor().resetStats();
+
+        int frames = seconds * LED_TARGET_FPS;
+        std::vector<uint64_t> latencies;
+        latencies.reserve(frames);
+        for (int i = 0; i < frames; i++) {
+            sim::advanceUs(LED_FRAME_INTERVAL_MS * 1000);
+            auto start = std::chrono::steady_clock::now();
+            leds.update();
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+        uint64_t total = 0;
+        for (uint64_t ns : latencies) total += ns;
+        double meanUs = total / 1000.0 / frames;
+        const CompositorStats& stats = leds.getCompositor().getStats();
+        printf("%-15s %7u %7u %7u %10.2f %10.2f %11.0f %8.2f\n",
+               bench.name, stats.frames, stats.shown, stats.skipped,
+               meanUs, percentile(latencies, 0.99) / 1000.0,
+               meanUs > 0 ? 1000000.0 / meanUs : 0.0,
+               meanUs * LED_TARGET_FPS / 10000.0);
+    }
+}
+
+static bool readFile(const char* path, std::string& contents) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    contents = buffer.str();
+    return true;
+}
+
+// Accepts compiled bytecode as-is, anything else is compiled as source
+static bool loadSequence(const char* path, std::vector<uint8_t>& bytecode) {
+    std::string contents;
+    if (!readFile(path, contents)) {
+        fprintf(stderr, "Cannot read %s\n", path);
+        return false;
+    }
+    if (contents.compare(0, 3, "LSQ") == 0) {
+        bytecode.assign(contents.begin(), contents.end());
+        return true;
+    }
+    std::string error;
+    if (!sim::compileSequence(contents, bytecode, error)) {
+        fprintf(stderr, "%s:%s\n", path, error.c_str());
+        return false;
+    }
+    return true;
+}
+
+static int compileSequenceFile(const char* path, const char* outPath) {
+    std::vector<uint8_t> bytecode;
+    if (!loadSequence(path, bytecode)) return 1;
+    if (outPath) {
+        std::ofstream out(outPath, std::ios::binary);
+        out.write((const char*)bytecode.data(), bytecode.size());
+        if (!out) {
+            fprintf(stderr, "Cannot write %s\n", outPath);
+            return 1;
+        }
+    }
+    printf("%s\n", sim::toHex(bytecode).c_str());
+    fprintf(stderr, "%zu bytes\n", bytecode.size());
+    return 0;
+}
+
+static int disassembleSequenceFile(const char* path) {
+    std::vector<uint8_t> bytecode;
+    if (!loadSequence(path, bytecode)) return 1;
+    printf("%s", LedSequence::disassemble(bytecode.data(), bytecode.size()).c_str());
+    return 0;
+}
+
+static int runSequenceBenchmark(const char* path) {
+    const int seconds = 60;
+    std::vector<uint8_t> bytecode;
+    if (!loadSequence(path, bytecode)) return 1;
+    if (!LedSequence::saveFile("bench", bytecode.data(), bytecode.size())) {
+        fprintf(stderr, "Cannot store the sequence in SPIFFS\n");
+        return 1;
+    }
+
+    sim::setSerialEcho(false);
+    LEDController leds;
+    leds.begin();
+    String error;
+    if (!leds.playSequence("bench", error)) {
+        fprintf(stderr, "Sequence rejected: %s\n", error.c_str());
+        return 1;
+    }
+    leds.getCompositor().resetStats();
+
+    int frames = seconds * LED_TARGET_FPS;
+    std::vector<uint64_t> latencies;
+    latencies.reserve(frames);
+    for (int i = 0; i < frames; i++) {
+        sim::advanceUs(LED_FRAME_INTERVAL_MS * 1000);
+        auto start = std::chrono::steady_clock::now();
+        leds.update();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    uint64_t total = 0;
+    for (uint64_t ns : latencies) total += ns;
+    JsonDocument doc(MemoryPolicy::json());
+    deserializeJson(doc, leds.getStripJSON());
+    JsonObject seq = doc["sequence"];
+    const CompositorStats& stats = leds.getCompositor().getStats();
+
+    printf("%s: %zu bytes, %d s at %d FPS (host timings; /api/leds reports on-device cost)\n",
+           path, bytecode.size(), seconds, LED_TARGET_FPS);
+    printf("  playing:       %s\n", leds.isSequencePlaying() ? "yes" : "ended");
+    printf("  steps/frame:   mean %.2f, max %u (budget %d, hit %u times)\n",
+           seq["steps_per_frame"].as<float>(), seq["max_steps_per_frame"].as<unsigned>(),
+           LEDSEQ_STEPS_PER_FRAME, seq["budget_hits"].as<unsigned>());
+    printf("  interpreter:   mean %u cycles, max %u cycles per frame\n",
+           seq["cycles_per_frame"].as<unsigned>(), seq["max_cycles"].as<unsigned>());
+    printf("  frame:         mean %.2f us, p99 %.2f us\n",
+           total / 1000.0 / frames, percentile(latencies, 0.99) / 1000.0);
+    printf("  show():        %u shown, %u skipped\n", stats.shown, stats.skipped);
+    return 0;
+}
+
+static bool prepareUsbImage(const char* path, uint32_t sizeMB) {
+    if (access(path, F_OK) == 0) return true;
+    printf("[sim] formatting %u MB USB image %s\n", sizeMB, path);
+    return sim::formatFatImage(path, sizeMB);
+}
+
+// Hot-plug runs on the USB task in real time; keep simulated events flowing while it works
+static bool waitForUsbMount(USBHostManager& usb, bool mounted) {
+    for (int i = 0; i < 2000 && usb.isMounted() != mounted; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        sim::runDueEvents();
+    }
+    return usb.isMounted() == mounted;
+}
+
+static bool listingHas(const String& json, const char* name, size_t size) {
+    JsonDocument doc(MemoryPolicy::json());
+    deserializeJson(doc, json);
+    for (JsonObject file : doc["files"].as<JsonArray>()) {
+        if (strcmp(file["name"] | "", name) == 0 && file["size"].as<size_t>() == size) return true;
+    }
+    return false;
+}
+
+static bool downloadMatches(USBHostManager& usb, const String& path, const std::vector<uint8_t>& expected) {
+    uint8_t* data;
+    size_t length;
+    if (!usb.downloadFile(path, &data, &length)) return false;
+    bool same = length == expected.size() && memcmp(data, expected.data(), length) == 0;
+    MemoryPolicy::psram()->deallocate(data);
+    return same;
+}
+
+static int runUsbCheck(const char* imagePath, uint32_t sizeMB) {
+    std::string scratch;
+    if (!imagePath) {
+        scratch = "/tmp/office_hub_usb_check_" + std::to_string(getpid()) + ".img";
+        imagePath = scratch.c_str();
+    }
+    if (!prepareUsbImage(imagePath, sizeMB)) return 1;
+
+    sim::setSerialEcho(false);
+    USBHostManager usb;
+    int failures = 0;
+    auto check = [&failures](bool ok, const char* what) {
+        printf("  %-44s %s\n", what, ok ? "ok" : "FAIL");
+        if (!ok) failures++;
+    };
+
+    const String dir = "/hub-check";
+    const String file = dir + "/Quarterly report 2026.txt";
+    std::vector<uint8_t> payload(100 * 1024);
+    for (size_t i = 0; i < payload.size(); i++) payload[i] = (uint8_t)(i * 31 + (i >> 9));
+
+    check(usb.initialize(nullptr) && sim::attachUsbImage(imagePath) && waitForUsbMount(usb, true), "attach and mount");
+    if (!usb.isMounted()) return 1;
+    printf("  %s\n", usb.getDeviceInfo().c_str());
+    uint64_t freeBefore = usb.getFreeSpace();
+
+    check(usb.createDirectory(dir) && usb.createDirectory(dir), "mkdir (twice)");
+
+    sim::resetUsbStats();
+    uint64_t startUs = sim::nowUs();
+    bool uploaded = usb.uploadFile(file, payload.data(), payload.size());
+    uint64_t writeUs = sim::nowUs() - startUs;
+    check(uploaded, "upload 100 KB with a long name");
+    sim::UsbStats written = sim::getUsbStats();
+
+    check(listingHas(usb.listFiles(dir), "Quarterly report 2026.txt", payload.size()), "listing shows name and size");
+
+    // Still in the block cache: a check, not a measurement
+    check(downloadMatches(usb, file, payload), "download matches upload");
+
+    check(usb.getFreeSpace() + payload.size() <= freeBefore, "free space accounts for the file");
+    check(!usb.uploadFile("../escape.txt", payload.data(), 16), "path outside the volume rejected");
+    check(!usb.deleteFile(dir), "non-empty directory not deleted");
+
+    sim::detachUsbImage();
+    check(waitForUsbMount(usb, false) && usb.listFiles(dir).indexOf("Quarterly") < 0, "detach unmounts");
+    sim::attachUsbImage(imagePath);
+    bool remounted = waitForUsbMount(usb, true);
+
+    // The replug started a cold cache, so this read goes to the stick
+    sim::resetUsbStats();
+    startUs = sim::nowUs();
+    check(remounted && downloadMatches(usb, file, payload), "file survives replug");
+    uint64_t readUs = sim::nowUs() - startUs;
+    sim::UsbStats read = sim::getUsbStats();
+
+    check(usb.deleteFile(file) && usb.deleteFile(dir), "delete file and directory");
+    check(usb.getFreeSpace() == freeBefore, "free space restored");
+
+    sim::detachUsbImage();
+    waitForUsbMount(usb, false);
+
+    printf("  write: %llu commands, %llu blocks, %.1f KB/s simulated\n",
+           (unsigned long long)written.commands, (unsigned long long)written.blocksWritten,
+           writeUs ? payload.size() * 1e6 / 1024 / writeUs : 0.0);
+    printf("  read:  %llu commands, %llu blocks, %.1f KB/s simulated, after replug\n",
+           (unsigned long long)read.commands, (unsigned long long)read.blocksRead,
+           readUs ? payload.size() * 1e6 / 1024 / readUs : 0.0);
+    if (!scratch.empty()) unlink(scratch.c_str());
+
+    printf("%s\n", failures ? "USB check FAILED" : "USB check passed");
+    return failures ? 1 : 0;
+}
+
+struct HttpReply {
+    int code;
+    String contentType;
+    String contentRange;
+    std::string body;
+};
+
+static HttpReply httpRequest(WebRequestMethod method, const String& url, const std::string& body = std::string(),
+                             const char* contentType = nullptr, const char* range = nullptr) {
+    AsyncWebServerRequest request(method, url);
+    if (contentType) request.addHeader("Content-Type", contentType);
+    if (range) request.addHeader("Range", range);
+    request.setBody(body);
+    server.dispatch(&request);
+
+    HttpReply reply = {500, String(), String(), std::string()};
+    const AsyncWebServerResponse* response = request.getResponse();
+    if (response) {
+        reply.code = response->getCode();
+        reply.contentType = response->getContentType();
+        reply.contentRange = response->getHeader("Content-Range");
+        reply.body = response->getBody();
+    }
+    return reply;
+}
+
+// Highest PSRAM use seen while fn runs, above what was in use before it
+static size_t psramHighWater(std::function<void()> fn) {
+    size_t baseline = MemoryPolicy::psram()->getStats().bytesInUse;
+    std::atomic<bool> running{true};
+    std::atomic<size_t> highest{baseline};
+    std::thread sampler([&]() {
+        while (running) {
+            size_t inUse = MemoryPolicy::psram()->getStats().bytesInUse;
+            if (inUse > highest) highest = inUse;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    });
+    fn();
+    running = false;
+    sampler.join();
+    return highest - baseline;
+}
+
+static std::string streamPayload(size_t size, uint32_t seed) {
+    std::string data(size, '\0');
+    for (size_t i = 0; i < size; i++) data[i] = (char)(i * seed + (i >> 11));
+    return data;
+}
+
+// Sequential write, sequential read, random 4K read, small files
+struct UsbBenchResult {
+    double rate[4];
+    uint64_t commands[4];
+};
+
+// Simulated MB/s for one workload, with the USB commands it took
+static double usbBenchRate(uint64_t bytes, uint64_t* commands, std::function<bool()> workload) {
+    sim::resetUsbStats();
+    uint64_t startUs = sim::nowUs();
+    bool ok = workload();
+    uint64_t elapsedUs = std::max<uint64_t>(1, sim::nowUs() - startUs);
+    *commands = sim::getUsbStats().commands;
+    return ok ? bytes / (double)elapsedUs : 0.0;
+}
+
+static bool usbBenchDrain(USBHostManager& usb, uint32_t stream, uint64_t expected) {
+    static uint8_t chunk[4096];
+    uint64_t received = 0;
+    int32_t n;
+    while ((n = usb.readStream(stream, chunk, sizeof(chunk))) != 0) {
+        if (n == USB_STREAM_ERROR) break;
+        if (n == USB_STREAM_RETRY) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            continue;
+        }
+        received += n;
+    }
+    usb.closeStream(stream);
+    return n == 0 && received == expected;
+}
+
+static UsbBenchResult runUsbBenchPass(USBHostManager& usb, size_t fileBytes) {
+    UsbBenchResult result = {};
+    const String file = "/usb-bench/sequential.bin";
+    std::string payload = streamPayload(fileBytes, 77);
+    usb.createDirectory("/usb-bench");
+
+    // Sequential: streams move 8 KB halves, the way the HTTP routes do
+    result.rate[0] = usbBenchRate(fileBytes, &result.commands[0], [&]() {
+        uint32_t stream = usb.openUpload(file, fileBytes);
+        for (size_t done = 0; stream && done < fileBytes; done += 4096) {
+            if (!usb.writeStream(stream, (const uint8_t*)payload.data() + done, std::min<size_t>(4096, fileBytes - done))) break;
+        }
+        return stream && usb.finishUpload(stream);
+    });
+    result.rate[1] = usbBenchRate(fileBytes, &result.commands[1], [&]() {
+        uint32_t stream = usb.openDownload(file, 0, fileBytes);
+        return stream && usbBenchDrain(usb, stream, fileBytes);
+    });
+
+    // Random 4K: open, seek through the cluster chain, read one page
+    const int randomReads = 256;
+    result.rate[2] = usbBenchRate(randomReads * 4096ULL, &result.commands[2], [&]() {
+        uint32_t seed = 12345;
+        for (int i = 0; i < randomReads; i++) {
+            seed = seed * 1103515245 + 12345;
+            uint64_t offset = (uint64_t)(seed >> 8) % (fileBytes / 4096) * 4096;
+            uint32_t stream = usb.openDownload(file, offset, 4096);
+            if (!stream || !usbBenchDrain(usb, stream, 4096)) return false;
+        }
+        return true;
+    });
+
+    // Small files: directory entry, FAT and data sectors for each 4 KB file
+    const int smallFiles = 64;
+    result.rate[3] = usbBenchRate(smallFiles * 4096ULL, &result.commands[3], [&]() {
+        for (int i = 0; i < smallFiles; i++) {
+            String name = "/usb-bench/note-" + String(i) + ".txt";
+            if (!usb.uploadFile(name, (uint8_t*)payload.data() + i * 4096, 4096)) return false;
+        }
+        return true;
+    });
+
+    for (int i = 0; i < smallFiles; i++) {
+        usb.deleteFile("/usb-bench/note-" + String(i) + ".txt");
+    }
+    usb.deleteFile(file);
+    usb.deleteFile("/usb-bench");
+    return result;
+}
+
+static int runUsbBenchmark(const char* imagePath, uint32_t sizeMB) {
+    std::string scratch;
+    if (!imagePath) {
+        scratch = "/tmp/office_hub_usb_bench_" + std::to_string(getpid()) + ".img";
+        imagePath = scratch.c_str();
+    }
+    if (!prepareUsbImage(imagePath, sizeMB)) return 1;
+
+    sim::setSerialEcho(false);
+    USBHostManager usb;
+    if (!usb.initialize(nullptr)) return 1;
+
+    const size_t fileBytes = 8 << 20;
+    UsbBenchResult passes[2];
+    String cacheInfo;
+    for (int pass = 0; pass < 2; pass++) {
+        usb.setBlockCache(pass == 1);
+        if (!sim::attachUsbImage(imagePath) || !waitForUsbMount(usb, true)) {
+            fprintf(stderr, "USB image did not mount\n");
+            return 1;
+        }
+        passes[pass] = runUsbBenchPass(usb, fileBytes);
+        if (pass == 1) cacheInfo = usb.getDeviceInfo();
+        sim::detachUsbImage();
+        waitForUsbMount(usb, false);
+    }
+
+    const char* names[] = {"sequential write 8 MB", "sequential read 8 MB", "random 4K read x256", "4 KB files x64"};
+    printf("  %-24s %12s %12s %10s %10s\n", "", "direct MB/s", "cached MB/s", "commands", "cached");
+    for (int i = 0; i < 4; i++) {
+        printf("  %-24s %12.3f %12.3f %10llu %10llu\n", names[i], passes[0].rate[i], passes[1].rate[i],
+               (unsigned long long)passes[0].commands[i], (unsigned long long)passes[1].commands[i]);
+    }
+    JsonDocument doc(MemoryPolicy::json());
+    deserializeJson(doc, cacheInfo);
+    String stats;
+    serializeJson(doc["cache"], stats);
+    printf("  cache: %s\n", stats.c_str());
+
+    if (!scratch.empty()) unlink(scratch.c_str());
+    bool ok = true;
+    for (int i = 0; i < 4; i++) {
+        ok = ok && passes[0].rate[i] > 0 && passes[1].rate[i] > 0;
+    }
+    return ok ? 0 : 1;
+}
+
+static int runUsbStreamCheck(const char* imagePath, uint32_t sizeMB) {
+    std::string scratch;
+    if (!imagePath) {
+        scratch = "/tmp/office_hub_usb_stream_" + std::to_string(getpid()) + ".img";
+        imagePath = scratch.c_str();
+    }
+    if (!prepareUsbImage(imagePath, sizeMB)) return 1;
+
+    sim::setSerialEcho(false);
+    sim::setWallClock(1767258000);
+    if (!sim::attachUsbImage(imagePath)) return 1;
+    setup();
+
+    int failures = 0;
+    auto check = [&failures](bool ok, const char* what) {
+        printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+        if (!ok) failures++;
+    };
+
+    check(waitForUsbMount(usbManager, true), "firmware mounts the stick");
+    if (!usbManager.isMounted()) return 1;
+
+    // Same route for a small and a large file: stream memory must not grow with size
+    const size_t sizes[] = {1 << 20, 8 << 20};
+    size_t uploadMemory[2] = {};
+    size_t downloadMemory[2] = {};
+    double writeRate = 0;
+    double readRate = 0;
+    const String url = "/api/usb/files/stream-check.bin";
+    std::string payload;
+    for (int i = 0; i < 2; i++) {
+        payload = streamPayload(sizes[i], 131 + i);
+        HttpReply reply;
+        uint64_t startUs = sim::nowUs();
+        uploadMemory[i] = psramHighWater([&]() {
+            reply = httpRequest(HTTP_POST, url, payload, "application/octet-stream");
+        });
+        writeRate = payload.size() * 1e6 / 1024 / std::max<uint64_t>(1, sim::nowUs() - startUs);
+        check(reply.code == 201 && reply.body.find("\"size\":" + std::to_string(payload.size())) != std::string::npos,
+              i ? "POST 8 MB raw body -> 201" : "POST 1 MB raw body -> 201");
+
+        startUs = sim::nowUs();
+        downloadMemory[i] = psramHighWater([&]() {
+            reply = httpRequest(HTTP_GET, url);
+        });
+        readRate = payload.size() * 1e6 / 1024 / std::max<uint64_t>(1, sim::nowUs() - startUs);
+        check(reply.code == 200 && reply.body == payload, i ? "GET 8 MB matches" : "GET 1 MB matches");
+    }
+
+    HttpReply reply = httpRequest(HTTP_GET, url, std::string(), nullptr, "bytes=1000-99999");
+    check(reply.code == 206 && reply.body == payload.substr(1000, 99000) &&
+          reply.contentRange == "bytes 1000-99999/" + std::to_string(payload.size()), "Range a-b -> 206 with Content-Range");
+    reply = httpRequest(HTTP_GET, url, std::string(), nullptr, "bytes=-700");
+    check(reply.code == 206 && reply.body == payload.substr(payload.size() - 700), "Range suffix -> last bytes");
+    reply = httpRequest(HTTP_GET, url, std::string(), nullptr, "bytes=8388000-");
+    check(reply.code == 206 && reply.body == payload.substr(8388000), "Range open end, unaligned start");
+    reply = httpRequest(HTTP_GET, url, std::string(), nullptr, ("bytes=" + std::to_string(payload.size()) + "-").c_str());
+    check(reply.code == 416 && reply.contentRange == "bytes */" + std::to_string(payload.size()), "Range past the end -> 416");
+
+    std::string form = streamPayload(20000, 7);
+    std::string multipart = "--hubcheck\r\nContent-Disposition: form-data; name=\"file\"; filename=\"form.txt\"\r\n"
+                            "Content-Type: text/plain\r\n\r\n" + form + "\r\n--hubcheck--\r\n";
+    reply = httpRequest(HTTP_POST, "/api/usb/files/", multipart, "multipart/form-data; boundary=hubcheck");
+    check(reply.code == 201 && reply.body.find("\"/form.txt\"") != std::string::npos, "multipart POST to / keeps the file name");
+    reply = httpRequest(HTTP_GET, "/api/usb/files/form.txt");
+    check(reply.code == 200 && reply.contentType == "text/plain" && reply.body == form, "multipart file reads back");
+    reply = httpRequest(HTTP_POST, "/api/usb/files/empty.txt");
+    check(reply.code == 201 && httpRequest(HTTP_GET, "/api/usb/files/empty.txt").code == 200, "empty body creates an empty file");
+    reply = httpRequest(HTTP_GET, "/api/usb/files/");
+    check(reply.code == 200 && listingHas(reply.body.c_str(), "form.txt", form.size()), "GET on a directory lists it");
+    check(httpRequest(HTTP_POST, "/api/usb/files/../x.bin", form, "application/octet-stream").code == 500,
+          "path outside the volume rejected");
+
+    // A client that goes away mid-upload leaves nothing behind
+    uint64_t size;
+    bool directory;
+    uint32_t stream = usbManager.openUpload("/partial.bin", payload.size());
+    check(stream && usbManager.writeStream(stream, (const uint8_t*)payload.data(), 100000), "upload stream accepts data");
+    usbManager.closeStream(stream);
+    check(!usbManager.statFile("/partial.bin", &size, &directory), "abandoned upload removed");
+
+    uint32_t first = usbManager.openDownload("/stream-check.bin", 0, payload.size());
+    uint32_t second = usbManager.openDownload("/stream-check.bin", 0, payload.size());
+    check(first && second && httpRequest(HTTP_GET, url).code == 503, "third concurrent stream -> 503");
+    usbManager.closeStream(second);
+
+    // Pulling the stick fails the open stream instead of touching a dead volume
+    sim::detachUsbImage();
+    waitForUsbMount(usbManager, false);
+    uint8_t chunk[512];
+    int32_t result = USB_STREAM_RETRY;
+    for (int i = 0; i < 1000 && result != USB_STREAM_ERROR; i++) {
+        result = usbManager.readStream(first, chunk, sizeof(chunk));
+        if (result == USB_STREAM_RETRY) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    check(result == USB_STREAM_ERROR, "detach fails an open download");
+    usbManager.closeStream(first);
+    check(httpRequest(HTTP_GET, url).code == 503, "GET while unplugged -> 503");
+
+    sim::attachUsbImage(imagePath);
+    check(waitForUsbMount(usbManager, true) && httpRequest(HTTP_GET, url).body == payload, "file intact after replug");
+    check(httpRequest(HTTP_DELETE, url).code == 200 && httpRequest(HTTP_DELETE, "/api/usb/files/form.txt").code == 200 &&
+          httpRequest(HTTP_DELETE, "/api/usb/files/empty.txt").code == 200, "DELETE removes the files");
+    check(httpRequest(HTTP_GET, url).code == 404, "GET after DELETE -> 404");
+
+    printf("  stream PSRAM, 1 MB / 8 MB: upload %u / %u bytes, download %u / %u bytes\n",
+           (unsigned)uploadMemory[0], (unsigned)uploadMemory[1], (unsigned)downloadMemory[0], (unsigned)downloadMemory[1]);
+    check(uploadMemory[0] == uploadMemory[1] && downloadMemory[0] == downloadMemory[1], "memory independent of file size");
+    printf("  8 MB: write %.1f KB/s, read %.1f KB/s simulated\n", writeRate, readRate);
+
+    sim::detachUsbImage();
+    waitForUsbMount(usbManager, false);
+    if (!scratch.empty()) unlink(scratch.c_str());
+
+    printf("%s\n", failures ? "USB stream check FAILED" : "USB stream check passed");
+    return failures ? 1 : 0;
+}
+
+// One page of a directory listing; names appended to *names
+static bool fetchListingPage(const String& url, std::vector<std::string>* names, String* nextCursor,
+                             uint32_t* generation, uint32_t* total) {
+    HttpReply reply = httpRequest(HTTP_GET, url);
+    JsonDocument doc(MemoryPolicy::json());
+    if (reply.code != 200 || deserializeJson(doc, reply.body) || doc["error"].is<const char*>()) return false;
+    for (JsonObject file : doc["files"].as<JsonArray>()) {
+        names->push_back(file["name"].as<const char*>());
+    }
+    *nextCursor = doc["next_cursor"].isNull() ? String() : String(doc["next_cursor"].as<const char*>());
+    *generation = doc["generation"];
+    *total = doc["total"];
+    return true;
+}
+
+static int runUsbListCheck(const char* imagePath, uint32_t sizeMB) {
+    std::string scratch;
+    if (!imagePath) {
+        scratch = "/tmp/office_hub_usb_list_" + std::to_string(getpid()) + ".img";
+        imagePath = scratch.c_str();
+    }
+    if (!prepareUsbImage(imagePath, sizeMB)) return 1;
+
+    sim::setSerialEcho(false);
+    sim::setWallClock(1767258000);
+    if (!sim::attachUsbImage(imagePath)) return 1;
+    setup();
+
+    int failures = 0;
+    auto check = [&failures](bool ok, const char* what) {
+        printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+        if (!ok) failures++;
+    };
+
+    check(waitForUsbMount(usbManager, true), "firmware mounts the stick");
+    if (!usbManager.isMounted()) return 1;
+
+    // Far more entries than one page or the listFiles preview
+    const int fileCount = 1500;
+    bool created = usbManager.createDirectory("/many") && usbManager.createDirectory("/many/zz-folder") &&
+                   usbManager.createDirectory("/many/aa-folder");
+    // Leading digits keep 8.3 aliases unique without numbered ~N tails
+    std::string data = streamPayload(1000, 3);
+    for (int i = 0; created && i < fileCount; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "/many/%04d Report.txt", (i * 7919) % fileCount);
+        created = usbManager.uploadFile(name, (uint8_t*)data.data(), i % 10 * 100);
+    }
+    check(created, "1500 files and 2 folders created");
+
+    std::vector<std::string> names;
+    String cursor;
+    uint32_t generation = 0;
+    uint32_t total = 0;
+    int pages = 0;
+    bool paged = true;
+    uint64_t startUs = sim::nowUs();
+    do {
+        String url = "/api/usb/files/many/?limit=200";
+        if (cursor.length()) url += "&cursor=" + cursor;
+        uint32_t pageGeneration;
+        paged = fetchListingPage(url, &names, &cursor, &pageGeneration, &total);
+        paged = paged && (!generation || pageGeneration == generation);
+        generation = pageGeneration;
+        pages++;
+    } while (paged && cursor.length() && pages < 100);
+    uint64_t listUs = sim::nowUs() - startUs;
+    check(paged && pages == 8 && total == fileCount + 2 && names.size() == total, "8 pages of 200 cover every entry");
+
+    bool ordered = names.size() > 2 && names[0] == "aa-folder" && names[1] == "zz-folder";
+    for (size_t i = 3; ordered && i < names.size(); i++) {
+        ordered = strcasecmp(names[i - 1].c_str(), names[i].c_str()) < 0;
+    }
+    check(ordered, "folders first, then names in order, no repeats");
+
+    // Cursors keep paging the snapshot they came from while the folder changes
+    std::vector<std::string> bySize;
+    uint32_t sizeTotal;
+    uint32_t sizeGeneration;
+    bool first = fetchListingPage("/api/usb/files/many/?sort=size&order=desc&limit=100", &bySize, &cursor,
+                                  &sizeGeneration, &sizeTotal);
+    check(first && bySize.size() == 100 && bySize[2].find(" Report.txt") == 4, "sort=size&order=desc");
+    usbManager.deleteFile("/many/0000 Report.txt");
+    uint32_t nextGeneration;
+    bool second = fetchListingPage("/api/usb/files/many/?sort=size&order=desc&limit=100&cursor=" + cursor, &bySize,
+                                   &cursor, &nextGeneration, &sizeTotal);
+    check(second && nextGeneration == sizeGeneration && sizeTotal == fileCount + 2, "cursor pages its snapshot after a delete");
+    std::vector<std::string> fresh;
+    check(fetchListingPage("/api/usb/files/many/?limit=10", &fresh, &cursor, &nextGeneration, &total) &&
+          nextGeneration > generation && total == fileCount + 1, "new first page sees the delete");
+
+    check(httpRequest(HTTP_GET, "/api/usb/files/many/?cursor=4000000000-0").code == 410, "unknown cursor -> 410");
+    check(httpRequest(HTTP_GET, "/api/usb/files/many/?sort=colour").code == 400, "bad sort -> 400");
+    check(httpRequest(HTTP_GET, "/api/usb/files/none/").code == 404, "missing folder -> 404");
+
+    // Repeat of an unchanged listing comes from the cached snapshot
+    sim::resetUsbStats();
+    check(fetchListingPage("/api/usb/files/many/?limit=10", &fresh, &cursor, &nextGeneration, &total) &&
+          sim::getUsbStats().commands == 0, "cached snapshot answers without USB commands");
+
+    printf("  %u entries in %d pages, %.1f ms simulated\n", (unsigned)names.size(), pages, listUs / 1000.0);
+
+    sim::detachUsbImage();
+    waitForUsbMount(usbManager, false);
+    if (!scratch.empty()) unlink(scratch.c_str());
+
+    printf("%s\n", failures ? "USB list check FAILED" : "USB list check passed");
+    return failures ? 1 : 0;
+}
+
+struct HistoryTruth {
+    std::vector<HistoryRecord> records;
+    uint32_t time;
+    uint32_t index;
+
+    // Daily swing, a slower drift and a little sensor noise
+    float next() {
+        float t = (float)time;
+        float temperature = 22.0f + 3.0f * sinf(t * 2.0f * (float)M_PI / 86400.0f) + 0.4f * sinf(t / 600.0f) +
+                            (int)((index * 2654435761u) >> 29) * 0.02f;
+        records.push_back({time, (int16_t)roundf(temperature * 100.0f)});
+        index++;
+        return temperature;
+    }
+};
+
+// Feeds readings every 5 s for hours; archive() runs each simulated minute when asked
+static void feedHistory(HistoryStore& store, HistoryTruth& truth, uint32_t hours, bool archive) {
+    for (uint32_t i = 0; i < hours * 720; i++) {
+        store.append(truth.time, truth.next());
+        truth.time += 5;
+        if (archive && i % 12 == 11) store.archive();
+    }
+}
+
+// Compares a query with buckets built from the readings that went in; the
+// mean of a bucket answered from segment headers may be off by a rounding step
+static bool historyMatches(JsonDocument& doc, const HistoryTruth& truth, uint32_t from, uint32_t to, uint32_t* total) {
+    uint32_t step = doc["step"];
+    JsonArray points = doc["points"];
+    size_t point = 0;
+    *total = 0;
+    size_t i = std::lower_bound(truth.records.begin(), truth.records.end(), from,
+                                [](const HistoryRecord& r, uint32_t t) { return r.time < t; }) - truth.records.begin();
+    while (i < truth.records.size() && truth.records[i].time <= to) {
+        uint32_t bucket = (truth.records[i].time - from) / step;
+        int64_t sum = 0;
+        uint32_t count = 0;
+        int16_t low = INT16_MAX;
+        int16_t high = INT16_MIN;
+        for (; i < truth.records.size() && truth.records[i].time <= to &&
+               (truth.records[i].time - from) / step == bucket; i++) {
+            sum += truth.records[i].value;
+            count++;
+            low = std::min(low, truth.records[i].value);
+            high = std::max(high, truth.records[i].value);
+        }
+        if (point >= points.size()) return false;
+        JsonObject p = points[point++];
+        float mean = (float)sum / count / 100.0f;
+        if (p["time"].as<uint32_t>() != from + bucket * step || p["count"].as<uint32_t>() != count ||
+            fabsf(p["min"].as<float>() - low / 100.0f) > 0.001f || fabsf(p["max"].as<float>() - high / 100.0f) > 0.001f ||
+            fabsf(p["temp"].as<float>() - mean) > 0.011f) {
+            printf("  bucket at %u: got %u readings, %.2f [%.2f, %.2f]; expected %u, %.3f [%.2f, %.2f]\n",
+                   from + bucket * step, p["count"].as<unsigned>(), p["temp"].as<float>(), p["min"].as<float>(),
+                   p["max"].as<float>(), count, mean, low / 100.0f, high / 100.0f);
+            return false;
+        }
+        *total += count;
+    }
+    return point == points.size();
+}
+
+static int runHistoryCheck(const char* imagePath, uint32_t sizeMB) {
+    std::string scratch;
+    if (!imagePath) {
+        scratch = "/tmp/office_hub_history_" + std::to_string(getpid()) + ".img";
+        imagePath = scratch.c_str();
+    }
+    if (!prepareUsbImage(imagePath, sizeMB)) return 1;
+
+    sim::setSerialEcho(false);
+    USBHostManager usb;
+    int failures = 0;
+    auto check = [&failures](bool ok, const char* what) {
+        printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+        if (!ok) failures++;
+    };
+    auto status = [](HistoryStore& store) {
+        JsonDocument doc(MemoryPolicy::json());
+        deserializeJson(doc, store.getStatusJSON());
+        return doc;
+    };
+    auto query = [](HistoryStore& store, JsonDocument& doc, uint32_t from, uint32_t to, uint32_t step) {
+        doc.clear();
+        return store.query(doc, from, to, step);
+    };
+
+    HistoryTruth truth = {{}, 1767225600, 0}; // 2026-01-01 00:00
+    const uint32_t start = truth.time;
+    std::unique_ptr<HistoryStore> store(new HistoryStore());
+    check(usb.initialize(nullptr) && store->begin(&usb), "store starts on an empty flash");
+    store->append(0, 21.0f);
+
+    // Three days with no stick: everything stays in the flash ring
+    feedHistory(*store, truth, 72, false);
+    for (int i = 0; i < 100; i++) {
+        store->append(truth.time, truth.next());
+        truth.time += 5;
+    }
+    JsonDocument doc = status(*store);
+    check(doc["flash"]["segments"] == 72 && doc["recent"] == 100 && doc["stats"]["unclocked"] == 1,
+          "72 sealed hours in flash, 100 readings open");
+    uint64_t flashPerDay = store->getStats().flashBytes / 3;
+
+    // A restart keeps what was flushed
+    store->flush();
+    store.reset(new HistoryStore());
+    store->begin(&usb);
+    doc = status(*store);
+    check(doc["flash"]["segments"] == 72 && doc["recent"] == 100, "restart recovers flash slots and the open segment");
+
+    // Plugging a stick drains the ring, oldest first
+    check(sim::attachUsbImage(imagePath) && waitForUsbMount(usb, true), "attach and mount");
+    for (int i = 0; i < 100 && status(*store)["flash"]["segments"] != 0; i++) {
+        store->archive();
+    }
+    doc = status(*store);
+    check(doc["flash"]["segments"] == 0 && doc["usb"]["segments"] == 72 && doc["usb"]["oldest"] == start,
+          "archive moves all 72 segments to the stick");
+
+    // The rest of the month with the stick in, then a few hours it has not taken yet
+    feedHistory(*store, truth, 24 * 27 - 4, true);
+    truth.time += 1800; // Sensor outage: a gap inside a segment
+    feedHistory(*store, truth, 1, true);
+    feedHistory(*store, truth, 3, false);
+    for (int i = 0; i < 250; i++) {
+        store->append(truth.time, truth.next());
+        truth.time += 5;
+    }
+    doc = status(*store);
+    const HistoryStats& stats = store->getStats();
+    uint32_t onStick = doc["usb"]["segments"];
+    check(doc["flash"]["segments"] == 3 && onStick + 3 == truth.records.size() / 720 && doc["recent"] == truth.records.size() % 720,
+          "a month: 3 hours still in flash, the rest on the stick");
+    uint32_t newest = store->getNewestTime();
+
+    JsonDocument result(MemoryPolicy::json());
+    uint32_t total;
+    uint32_t from = newest - 5 * 3600 + 5;
+    check(query(*store, result, from, newest, 10) && historyMatches(result, truth, from, newest, &total) &&
+          result["sources"]["usb_decoded"] == 2 && result["sources"]["flash_decoded"] == 3 && result["sources"]["recent"] > 0,
+          "last 5 h in 10 s buckets across all three tiers");
+
+    sim::resetUsbStats();
+    uint64_t startUs = sim::nowUs();
+    bool month = query(*store, result, start, newest, 0) && historyMatches(result, truth, start, newest, &total);
+    uint64_t monthUs = sim::nowUs() - startUs;
+    sim::UsbStats monthUsb = sim::getUsbStats();
+    check(month && total == truth.records.size() && result["points"].size() <= HISTORY_QUERY_POINTS,
+          "whole month in 500 buckets matches every reading");
+    uint32_t monthSummarized = result["sources"]["usb_summarized"];
+
+    sim::resetUsbStats();
+    startUs = sim::nowUs();
+    bool daily = query(*store, result, start, start + 28 * 86400 - 1, 86400) &&
+                 historyMatches(result, truth, start, start + 28 * 86400 - 1, &total);
+    uint64_t dailyUs = sim::nowUs() - startUs;
+    sim::UsbStats dailyUsb = sim::getUsbStats();
+    // Only segments that straddle midnight are read
+    check(daily && result["points"].size() == 28 && result["sources"]["usb_decoded"] <= 28 &&
+          result["sources"]["usb_summarized"] >= 28 * 23, "day buckets come from the index");
+
+    JsonDocument bad(MemoryPolicy::json());
+    check(!query(*store, bad, start, newest, 60) && !query(*store, bad, newest, start, 0),
+          "too many buckets or from after to rejected");
+
+    // Unplugged, queries fall back to what the hub holds itself
+    sim::detachUsbImage();
+    waitForUsbMount(usb, false);
+    uint32_t flashOldest = status(*store)["flash"]["oldest"];
+    check(query(*store, result, start, newest, 5 * 3600) && result["sources"]["usb_decoded"] == 0 &&
+          result["sources"]["usb_summarized"] == 0 && query(*store, result, flashOldest, newest, 10) && historyMatches(result, truth, flashOldest, newest, &total),
+          "unplugged: flash and RAM still answer");
+
+    // Four more days with no stick overflow the ring
+    feedHistory(*store, truth, 24 * 4 + 1, false);
+    doc = status(*store);
+    check(doc["flash"]["segments"] == HISTORY_FLASH_SEGMENTS && doc["stats"]["dropped"] == 3 + 24 * 4 + 1 - HISTORY_FLASH_SEGMENTS,
+          "full flash ring drops its oldest segments");
+
+    // Sealed segments survive a round trip through the codec exactly
+    std::vector<HistoryRecord> decoded;
+    uint8_t encoded[HISTORY_SEGMENT_MAX_BYTES];
+    size_t length = HistoryStore::encode(truth.records.data() + 1000, HISTORY_SEGMENT_RECORDS, encoded);
+    bool roundTrip = HistoryStore::decode(encoded, length, [&decoded](uint32_t time, int16_t value) {
+        decoded.push_back({time, value});
+    }) && memcmp(decoded.data(), truth.records.data() + 1000, HISTORY_SEGMENT_RECORDS * sizeof(HistoryRecord)) == 0;
+    encoded[length / 2] ^= 0x10;
+    check(roundTrip && !HistoryStore::decode(encoded, length, [](uint32_t, int16_t) {}), "codec round trip, checksum catches a flipped bit");
+
+    printf("  sealed: %.2f bytes per reading, %.1fx smaller than raw records\n",
+           (double)stats.sealedBytes / (stats.rawBytes / sizeof(HistoryRecord)), (double)stats.rawBytes / stats.sealedBytes);
+    printf("  flash writes with no stick: %.1f KB per day\n", flashPerDay / 1024.0);
+    printf("  stick: %.1f KB for %u segments, index included\n", stats.usbBytes / 1024.0, stats.archived);
+    printf("  month query: %u buckets, %u segments from the index, %llu USB commands, %.1f ms simulated\n",
+           HISTORY_QUERY_POINTS, monthSummarized, (unsigned long long)monthUsb.commands, monthUs / 1000.0);
+    printf("  day buckets: %llu USB commands, %.1f ms simulated\n", (unsigned long long)dailyUsb.commands, dailyUs / 1000.0);
+
+    if (!scratch.empty()) unlink(scratch.c_str());
+    printf("%s\n", failures ? "History check FAILED" : "History check passed");
+    return failures ? 1 : 0;
+}
+
+static bool waitUntil(uint32_t timeoutMs, std::function<bool()> condition) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    return true;
+}
+
+// Runs with the loop on its own thread, as on the device, while this thread
+// plays the browser: binary frames out, echoes back through the loopback
+static int runSerialCheck() {
+    sim::setSerialEcho(false);
+    sim::setRealtime(true);
+    if (!sim::attachUsbSerialLoopback()) return 1;
+    setup();
+
+    std::atomic<bool> running{true};
+    std::thread looper([&running]() {
+        while (running) loop();
+    });
+
+    int failures = 0;
+    auto check = [&failures](bool ok, const char* what) {
+        printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+        if (!ok) failures++;
+    };
+
+    std::mutex received;
+    std::string echoed;
+    std::string lastText;
+    AsyncWebSocketClient* client = serialSocket.connectClient(
+        [&](uint32_t, const char* data, size_t len) {
+            std::lock_guard<std::mutex> guard(received);
+            lastText.assign(data, len);
+        },
+        IPAddress(127, 0, 0, 1),
+        [&](uint32_t, const char* data, size_t len) {
+            std::lock_guard<std::mutex> guard(received);
+            echoed.append(data, len);
+        });
+    auto echoedSize = [&]() {
+        std::lock_guard<std::mutex> guard(received);
+        return echoed.size();
+    };
+    auto sendText = [&](const char* message) {
+        {
+            std::lock_guard<std::mutex> guard(received);
+            lastText.clear();
+        }
+        serialSocket.injectText(client, message, strlen(message));
+        std::lock_guard<std::mutex> guard(received);
+        return lastText;
+    };
+
+    check(waitUntil(2000, []() { return serialBridge.isConnected(); }), "bridge takes the CDC-ACM device");
+
+    std::string reply = sendText("{\"type\":\"line_coding\",\"baud\":921600,\"data_bits\":8,"
+                                 "\"parity\":\"even\",\"stop_bits\":1}");
+    bool applied = waitUntil(500, []() { return sim::getSerialLoopbackState().baud == 921600; });
+    sim::SerialLoopbackState line = sim::getSerialLoopbackState();
+    check(applied && line.parity == 2 && line.dataBits == 8 && line.stopBits == 0 &&
+          reply.find("\"baud\":921600") != std::string::npos, "line_coding reaches the device");
+    check(sendText("{\"type\":\"line_coding\",\"data_bits\":9}").find("error") != std::string::npos &&
+          sendText("{\"type\":\"line_coding\",\"stop_bits\":3}").find("error") != std::string::npos,
+          "bad data bits or stop bits -> error");
+    sendText("{\"type\":\"control_lines\",\"dtr\":true,\"rts\":false}");
+    check(waitUntil(500, []() { return !sim::getSerialLoopbackState().rts; }) && sim::getSerialLoopbackState().dtr,
+          "control_lines sets DTR and RTS");
+
+    // Bulk echo, keeping at most 4 KB in flight so the transmit ring never fills
+    const std::string payload = streamPayload(128 * 1024, 29);
+    auto startTime = std::chrono::steady_clock::now();
+    for (size_t sent = 0; sent < payload.size();) {
+        if (sent - echoedSize() > 4096) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            continue;
+        }
+        size_t n = std::min<size_t>(1024, payload.size() - sent);
+        serialSocket.injectBinary(client, (const uint8_t*)payload.data() + sent, n);
+        sent += n;
+    }
+    bool complete = waitUntil(5000, [&]() { return echoedSize() >= payload.size(); });
+    double echoSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    {
+        std::lock_guard<std::mutex> guard(received);
+        check(complete && echoed == payload, "128 KB echoed intact at 921600 baud");
+        echoed.clear();
+    }
+
+    // Round trip of one keystroke: OUT packet, wire, IN frame, flush deadline
+    std::vector<uint64_t> roundTrips;
+    for (int i = 0; i < 50; i++) {
+        uint8_t key = 'a' + i % 26;
+        auto sentAt = std::chrono::steady_clock::now();
+        serialSocket.injectBinary(client, &key, 1);
+        if (!waitUntil(500, [&]() { return echoedSize() >= (size_t)i + 1; })) break;
+        roundTrips.push_back(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - sentAt).count());
+    }
+    check(roundTrips.size() == 50 && percentile(roundTrips, 0.5) < 20000, "keystrokes echo within 20 ms");
+
+    // A client that cannot take more holds data in the rings and the device
+    // waits instead of dropping; it all arrives once the client catches up
+    {
+        std::lock_guard<std::mutex> guard(received);
+        echoed.clear();
+    }
+    SerialBridgeStats before = serialBridge.getStats();
+    client->setBlocked(true);
+    const std::string held = streamPayload(12 * 1024, 41);
+    for (size_t sent = 0; sent < held.size(); sent += 1024) {
+        // Below the line rate, so only the far end can be what backs up
+        serialSocket.injectBinary(client, (const uint8_t*)held.data() + sent, 1024);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    SerialBridgeStats blocked = serialBridge.getStats();
+    check(echoedSize() == 0 && blocked.deferred > before.deferred && blocked.stalls > before.stalls,
+          "blocked client defers flushes and stalls reads");
+    client->setBlocked(false);
+    complete = waitUntil(5000, [&]() { return echoedSize() >= held.size(); });
+    {
+        std::lock_guard<std::mutex> guard(received);
+        check(complete && echoed == held && serialBridge.getStats().dropped == 0, "held data arrives intact, nothing dropped");
+    }
+
+    HttpReply status = httpRequest(HTTP_GET, "/api/serial");
+    JsonDocument doc(MemoryPolicy::json());
+    bool parsed = status.code == 200 && !deserializeJson(doc, status.body);
+    const SerialBridgeStats& stats = serialBridge.getStats();
+    check(parsed && doc["connected"] == true && doc["stats"]["rx_bytes"] == stats.bytesIn &&
+          stats.bytesIn == stats.bytesOut && stats.bytesIn == sim::getSerialLoopbackState().echoed,
+          "GET /api/serial counters match the wire");
+
+    sim::detachUsbSerialLoopback();
+    check(waitUntil(2000, []() { return !serialBridge.isConnected(); }) && serialBridge.write((const uint8_t*)"x", 1) == 0,
+          "unplug stops the bridge");
+    sim::attachUsbSerialLoopback();
+    {
+        std::lock_guard<std::mutex> guard(received);
+        echoed.clear();
+    }
+    bool replugged = waitUntil(2000, []() { return serialBridge.isConnected(); });
+    serialSocket.injectBinary(client, (const uint8_t*)"replug", 6);
+    check(replugged && waitUntil(500, [&]() { return echoedSize() >= 6; }) &&
+          sim::getSerialLoopbackState().baud == 921600, "replug restores line coding and echo");
+
+    serialSocket.disconnectClient(client);
+    running = false;
+    timerService.wake();
+    looper.join();
+
+    printf("  echo: %.1f KB/s (%.1f KB/s line rate)\n", payload.size() / 1024.0 / echoSeconds,
+           921600 / 11.0 / 1024);
+    printf("  keystroke round trip: median %.2f ms, p95 %.2f ms, max %.2f ms\n",
+           percentile(roundTrips, 0.5) / 1000.0, percentile(roundTrips, 0.95) / 1000.0,
+           percentile(roundTrips, 1.0) / 1000.0);
+    printf("  flushes: %u, frames: %u, oldest byte at flush avg %u us, max %u us\n", (unsigned)stats.flushes,
+           (unsigned)stats.frames, stats.flushes ? (unsigned)(stats.latencyTotalUs / stats.flushes) : 0,
+           (unsigned)stats.latencyMaxUs);
+    printf("  IN packets: %u, OUT packets: %u, stalls: %u, deferred: %u\n", (unsigned)stats.packetsIn,
+           (unsigned)stats.packetsOut, (unsigned)stats.stalls, (unsigned)stats.deferred);
+
+    printf("%s\n", failures ? "Serial check FAILED" : "Serial check passed");
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    uint64_t runSeconds = 600;
+    int benchIterations = 0;
+    int soakRounds = 0;
+    int servePort = 0;
+    const char* dataDir = "data";
+    const char* tempPreset = "steady";
+    bool wifi = true;
+    bool quiet = false;
+    const char* renderMode = nullptr;
+    int renderFrames = 100;
+    int renderFps = 20;
+    const char* renderColor = "#FF0000";
+    const char* goldenPath = nullptr;
+    int ledBenchSeconds = 0;
+    const char* compilePath = nullptr;
+    const char* outPath = nullptr;
+    const char* disasmPath = nullptr;
+    const char* seqBenchPath = nullptr;
+    const char* usbImagePath = nullptr;
+    uint32_t usbSizeMB = 128;
+    bool usbCheck = false;
+    bool usbStreamCheck = false;
+    bool usbBench = false;
+    bool usbListCheck = false;
+    bool usbSerial = false;
+    bool serialCheck = false;
+    bool historyCheck = false;
+
+    for (int i = 1; i < argc; i++) {
+        String arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--run" && hasValue) {
+            runSeconds = strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--bench" && hasValue) {
+            benchIterations = atoi(argv[++i]);
+        } else if (arg == "--soak" && hasValue) {
+            soakRounds = atoi(argv[++i]);
+        } else if (arg == "--serve" && hasValue) {
+            servePort = atoi(argv[++i]);
+        } else if (arg == "--temp" && hasValue) {
+            tempPreset = argv[++i];
+        } else if (arg == "--data" && hasValue) {
+            dataDir = argv[++i];
+        } else if (arg == "--no-wifi") {
+            wifi = false;
+        } else if (arg == "--quiet") {
+            quiet = true;
+        } else if (arg == "--render" && hasValue) {
+            renderMode = argv[++i];
+        } else if (arg == "--frames" && hasValue) {
+            renderFrames = atoi(argv[++i]);
+        } else if (arg == "--fps" && hasValue) {
+            renderFps = atoi(argv[++i]);
+        } else if (arg == "--color" && hasValue) {
+            renderColor = argv[++i];
+        } else if (arg == "--golden" && hasValue) {
+            goldenPath = argv[++i];
+        } else if (arg == "--led-bench" && hasValue) {
+            ledBenchSeconds = atoi(argv[++i]);
+        } else if (arg == "--compile" && hasValue) {
+            compilePath = argv[++i];
+        } else if (arg == "--out" && hasValue) {
+            outPath = argv[++i];
+        } else if (arg == "--disasm" && hasValue) {
+            disasmPath = argv[++i];
+        } else if (arg == "--seq-bench" && hasValue) {
+            seqBenchPath = argv[++i];
+        } else if (arg == "--usb-image" && hasValue) {
+            usbImagePath = argv[++i];
+        } else if (arg == "--usb-size" && hasValue) {
+            usbSizeMB = strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--usb-check") {
+            usbCheck = true;
+        } else if (arg == "--usb-stream-check") {
+            usbStreamCheck = true;
+        } else if (arg == "--usb-bench") {
+            usbBench = true;
+        } else if (arg == "--usb-list-check") {
+            usbListCheck = true;
+        } else if (arg == "--history-check") {
+            historyCheck = true;
+        } else if (arg == "--usb-serial") {
+            usbSerial = true;
+        } else if (arg == "--serial-check") {
+            serialCheck = true;
+        } else {
+            fprintf(stderr, "usage: %s [--run SECONDS] [--bench N] [--soak ROUNDS] [--serve PORT] [--temp PRESET] "
+                            "[--data DIR] [--no-wifi] [--quiet] [--render MODE ...] [--led-bench SECONDS] "
+                            "[--compile FILE [--out FILE]] [--disasm FILE] [--seq-bench FILE] "
+                            "[--usb-image FILE [--usb-size MB]] [--usb-check] [--usb-stream-check] [--usb-list-check] [--usb-bench] "
+                            "[--history-check] [--usb-serial] [--serial-check]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (compilePath) {
+        return compileSequenceFile(compilePath, outPath);
+    }
+    if (disasmPath) {
+        return disassembleSequenceFile(disasmPath);
+    }
+    if (seqBenchPath) {
+        return runSequenceBenchmark(seqBenchPath);
+    }
+    if (usbCheck) {
+        return runUsbCheck(usbImagePath, usbSizeMB);
+    }
+    if (usbStreamCheck) {
+        return runUsbStreamCheck(usbImagePath, usbSizeMB);
+    }
+    if (usbListCheck) {
+        return runUsbListCheck(usbImagePath, usbSizeMB);
+    }
+    if (usbBench) {
+        return runUsbBenchmark(usbImagePath, usbSizeMB);
+    }
+    if (historyCheck) {
+        return runHistoryCheck(usbImagePath, usbSizeMB);
+    }
+    if (serialCheck) {
+        return runSerialCheck();
+    }
+
+    if (renderMode) {
+        return renderEffect(renderMode, renderFrames, renderFps > 0 ? renderFps : 20, renderColor, goldenPath);
+    }
+    if (ledBenchSeconds > 0) {
+        sim::setSerialEcho(false);
+        runLedBenchmark(ledBenchSeconds);
+        return 0;
+    }
+
+    if (!sim::setTemperatureCurve(tempPreset)) {
+        fprintf(stderr, "Unknown temperature preset: %s\n", tempPreset);
+        return 2;
+    }
+    if (sim::seedFromDirectory(dataDir) < 0) {
+        fprintf(stderr, "Warning: data directory %s not found, starting with an empty SPIFFS\n", dataDir);
+    }
+    if (wifi) {
+        sim::addNetwork("Office_WiFi_5G", -52, 36);
+        sim::addNetwork("Office_WiFi_2.4G", -61, 6);
+        sim::addNetwork("Guest", -74, 11, true);
+    }
+    if (usbImagePath) {
+        if (!prepareUsbImage(usbImagePath, usbSizeMB) || !sim::attachUsbImage(usbImagePath)) return 1;
+    } else if (usbSerial && !sim::attachUsbSerialLoopback()) {
+        return 1;
+    }
+    sim::setWallClock(1767258000); // 2026-01-01 09:00:00 UTC
+    sim::setSerialEcho(!quiet && benchIterations == 0 && soakRounds == 0);
+
+    if (servePort > 0) {
+        sim::setRealtime(true);
+    }
+
+    setup();
+
+    if (servePort > 0) {
+        if (!sim::startLoopbackServer(servePort, &server, &ws)) {
+            fprintf(stderr, "Failed to listen on 127.0.0.1:%d\n", servePort);
+            return 1;
+        }
+        printf("[sim] listening on 127.0.0.1:%d, one JSON message or \"GET /path\" per line\n", servePort);
+        fflush(stdout);
+        for (;;) {
+            loop();
+        }
+    }
+
+    if (benchIterations > 0) {
+        // Let association, NTP and the deferred history load settle first
+        runFor(5000);
+        waitForBootWorker();
+        runBenchmark(benchIterations);
+        printf("\nmemory: %s\n", MemoryPolicy::getStatsJSON().c_str());
+        return 0;
+    }
+    if (soakRounds > 0) {
+        runFor(5000);
+        waitForBootWorker();
+        return runSoak(soakRounds);
+    }
+
+    // Observe what a dashboard would receive
+    ws.connectClient([](uint32_t id, const char* data, size_t len) {
+        printf("[ws#%u] %.*s\n", id, (int)len, data);
+    });
+
+    runFor(runSeconds * 1000);
+
+    printf("\n[sim] %llu s simulated\n", (unsigned long long)(sim::nowUs() / 1000000));
+    printf("[sim] timers: %s\n", timerService.getTimersJSON().c_str());
+    printf("[sim] alerts: %s\n", alertRules.getActiveAlertsJSON().c_str());
+    printf("[sim] alert log: %s\n", alertRules.getAlertLogJSON().c_str());
+    printf("[sim] memory: %s\n", MemoryPolicy::getStatsJSON().c_str());
+    return 0;
+}
@@ -0,0 +1,559 @@
+// Simulated USB host port with one device behind it: a mass-storage stick or
+// a USB-serial adapter wired in loopback. The stick is a disk image file;
+// SCSI commands complete synchronously and charge the simulated clock what a
+// full-speed bulk-only transfer would take. The adapter runs in real time on
+// its own task.
+#include "usb_host.hpp"
+#include "usb_msc.hpp"
+#include "usb_acm.hpp"
+#include "block_device.h"
+#include "freertos/FreeRTOS.h"
+#include "sim_hal.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string.h>
+#include <vector>
+
+// CBW and CSW each wait for a 1 ms frame slot; data moves at about 1 MB/s
+#define SIM_USB_COMMAND_US 1000
+#define SIM_USB_NS_PER_BYTE 1000
+
+// The adapter's UART FIFOs, and the frame its IN data waits for
+#define SIM_SERIAL_FIFO 512
+#define SIM_SERIAL_FRAME_US 1000
+
+namespace {
+
+std::mutex portLock;
+FileBlockDevice image;
+bool connected = false;
+bool serialAttached = false;    // The device on the port is the loopback adapter
+USBhost* clientHost = nullptr;
+QueueHandle_t clientEvents = NULL;
+sim::UsbStats stats = {};
+
+const usb_device_desc_t deviceDesc = {18, 1, 0x0200, 0, 0, 0, 64, 0x0781, 0x5581, 0x0100, 1, 2, 3, 1};
+const usb_config_desc_t configDesc = {9, 2, 32, 1, 1, 0, 0x80, 50};
+const usb_intf_desc_t mscInterface = {9, 4, 0, 0, 2, USB_CLASS_MASS_STORAGE, 0x06, 0x50, 0};
+
+usb_str_desc_t makeString(const char* text) {
+    usb_str_desc_t desc = {};
+    size_t length = strlen(text);
+    desc.bLength = 2 + 2 * length;
+    desc.bDescriptorType = 3;
+    for (size_t i = 0; i < length; i++) desc.wData[i] = text[i];
+    return desc;
+}
+
+const usb_str_desc_t manufacturerString = makeString("SanDisk");
+const usb_str_desc_t productString = makeString("Ultra Sim");
+const usb_str_desc_t serialString = makeString("4C530001");
+
+// CDC-ACM: communication interface with its interrupt endpoint, data interface with bulk IN/OUT
+const usb_device_desc_t serialDeviceDesc = {18, 1, 0x0200, 0x02, 0, 0, 64, 0x1a86, 0x55d3, 0x0100, 1, 2, 3, 1};
+const usb_config_desc_t serialConfigDesc = {9, 2, 67, 2, 1, 0, 0x80, 50};
+const usb_intf_desc_t commInterface = {9, 4, 0, 0, 1, USB_CLASS_COMM, 0x02, 0x01, 0};
+const usb_intf_desc_t dataInterface = {9, 4, 1, 0, 2, USB_CLASS_CDC_DATA, 0x00, 0x00, 0};
+const usb_str_desc_t serialManufacturerString = makeString("WCH");
+const usb_str_desc_t serialProductString = makeString("Loopback Serial");
+
+void chargeTransfer(uint64_t bytes) {
+    uint64_t us = SIM_USB_COMMAND_US + bytes * SIM_USB_NS_PER_BYTE / 1000;
+    {
+        std::lock_guard<std::mutex> guard(portLock);
+        stats.commands++;
+        stats.busyUs += us;
+    }
+    sim::advanceUs(us);
+}
+
+void postClientEvent(usb_host_client_event_t type) {
+    usb_host_client_event_msg_t msg = {};
+    msg.event = type;
+    msg.new_dev.address = 1;
+    if (clientEvents) {
+        xQueueSend(clientEvents, &msg, 0);
+    }
+}
+
+void clientTask(void*) {
+    usb_host_client_event_msg_t msg;
+    while (true) {
+        if (xQueueReceive(clientEvents, &msg, portMAX_DELAY) == pdTRUE) {
+            _client_event_callback(&msg, clientHost);
+        }
+    }
+}
+
+} // namespace
+
+// Same order as the library: open before the user callback, close after it
+void _client_event_callback(const usb_host_client_event_msg_t* event_msg, void* arg) {
+    USBhost* host = (USBhost*)arg;
+    if (event_msg->event == USB_HOST_CLIENT_EVENT_NEW_DEV) {
+        host->open(event_msg);
+        if (host->_client_event_cb) host->_client_event_cb(event_msg, arg);
+    } else {
+        if (host->_client_event_cb) host->_client_event_cb(event_msg, arg);
+        host->close();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// IDF calls
+
+const usb_intf_desc_t* usb_parse_interface_descriptor(const usb_config_desc_t* config_desc, uint8_t bInterfaceNumber,
+                                                      uint8_t bAlternateSetting, int* offset) {
+    if (bAlternateSetting != 0) return nullptr;
+    const usb_intf_desc_t* intf = nullptr;
+    if (config_desc == &configDesc && bInterfaceNumber == 0) {
+        intf = &mscInterface;
+    } else if (config_desc == &serialConfigDesc && bInterfaceNumber < 2) {
+        intf = bInterfaceNumber == 0 ? &commInterface : &dataInterface;
+    }
+    if (intf && offset) *offset = config_desc->bLength;
+    return intf;
+}
+
+esp_err_t usb_host_interface_release(usb_host_client_handle_t, usb_device_handle_t dev_hdl,
+                                     uint8_t bInterfaceNumber) {
+    uint8_t interfaces = dev_hdl == (usb_device_handle_t)&serialDeviceDesc ? 2 : 1;
+    return bInterfaceNumber < interfaces ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+// ---------------------------------------------------------------------------
+// USBhost
+
+USBhost::USBhost() {
+}
+
+USBhost::~USBhost() {
+}
+
+bool USBhost::init(bool create_tasks) {
+    std::lock_guard<std::mutex> guard(portLock);
+    if (clientEvents) return false;
+
+    clientHost = this;
+    client_hdl = (usb_host_client_handle_t)this;
+    clientEvents = xQueueCreate(8, sizeof(usb_host_client_event_msg_t));
+    if (create_tasks) {
+        xTaskCreate(clientTask, "async", 3072, NULL, 20, NULL);
+    }
+    // A stick plugged in before the host came up is reported right away
+    if (connected) {
+        postClientEvent(USB_HOST_CLIENT_EVENT_NEW_DEV);
+    }
+    return true;
+}
+
+bool USBhost::open(const usb_host_client_event_msg_t*) {
+    std::lock_guard<std::mutex> guard(portLock);
+    dev_hdl = (usb_device_handle_t)(serialAttached ? &serialDeviceDesc : &deviceDesc);
+    return true;
+}
+
+void USBhost::close() {
+    dev_hdl = nullptr;
+}
+
+usb_device_info_t USBhost::getDeviceInfo() {
+    usb_device_info_t info = {};
+    info.speed = 1;
+    info.dev_addr = 1;
+    info.bMaxPacketSize0 = deviceDesc.bMaxPacketSize0;
+    info.bConfigurationValue = 1;
+    bool serial = dev_hdl == (usb_device_handle_t)&serialDeviceDesc;
+    info.str_desc_manufacturer = serial ? &serialManufacturerString : &manufacturerString;
+    info.str_desc_product = serial ? &serialProductString : &productString;
+    info.str_desc_serial_num = &serialString;
+    return info;
+}
+
+const usb_device_desc_t* USBhost::getDeviceDescriptor() {
+    return (const usb_device_desc_t*)dev_hdl;
+}
+
+const usb_config_desc_t* USBhost::getConfigurationDescriptor() {
+    if (!dev_hdl) return nullptr;
+    return dev_hdl == (usb_device_handle_t)&serialDeviceDesc ? &serialConfigDesc : &configDesc;
+}
+
+usb_host_client_handle_t USBhost::clientHandle() {
+    return client_hdl;
+}
+
+usb_device_handle_t USBhost::deviceHandle() {
+    return dev_hdl;
+}
+
+// ---------------------------------------------------------------------------
+// USBmscDevice
+
+USBmscDevice::USBmscDevice(const usb_config_desc_t*, USBhost* host) {
+    _host = host;
+}
+
+USBmscDevice::~USBmscDevice() {
+}
+
+bool USBmscDevice::init() {
+    {
+        std::lock_guard<std::mutex> guard(portLock);
+        if (!connected) return false;
+        block_count = image.getBlockCount();
+        block_size = image.getBlockSize();
+    }
+
+    // GET MAX LUN, READ CAPACITY(10), INQUIRY
+    chargeTransfer(1);
+    chargeTransfer(8);
+    if (callbacks.capacity_cb) {
+        uint8_t capacity[8];
+        uint32_t lastBlock = block_count - 1;
+        for (int i = 0; i < 4; i++) {
+            capacity[i] = lastBlock >> (24 - 8 * i);
+            capacity[4 + i] = block_size >> (24 - 8 * i);
+        }
+        usb_transfer_t transfer = {};
+        transfer.data_buffer = capacity;
+        transfer.data_buffer_size = sizeof(capacity);
+        transfer.num_bytes = sizeof(capacity);
+        transfer.actual_num_bytes = sizeof(capacity);
+        transfer.context = this;
+        callbacks.capacity_cb(&transfer);
+    }
+    chargeTransfer(36);
+    return true;
+}
+
+uint8_t USBmscDevice::getMaxLUN() {
+    return 0;
+}
+
+uint32_t USBmscDevice::getBlockCount(uint8_t lun) {
+    return lun == 0 ? block_count : 0;
+}
+
+uint16_t USBmscDevice::getBlockSize(uint8_t) {
+    return block_size;
+}
+
+void USBmscDevice::registerCallbacks(msc_transfer_cb_t cb) {
+    callbacks = cb;
+}
+
+// Like the library, only the first block of the data stage reaches buff, and
+// the data callback gets the stage one block-sized IN transfer at a time
+esp_err_t USBmscDevice::_read10(uint8_t lun, int offset, int num_sectors, uint8_t* buff) {
+    std::vector<uint8_t> data((size_t)num_sectors * block_size);
+    {
+        std::lock_guard<std::mutex> guard(portLock);
+        if (!connected || lun != 0) return ESP_ERR_TIMEOUT;
+        if (!image.read(offset, data.data(), num_sectors)) return ESP_FAIL;
+        stats.blocksRead += num_sectors;
+    }
+    memcpy(buff, data.data(), block_size);
+    chargeTransfer(data.size());
+    for (int i = 0; callbacks.data_cb && i < num_sectors; i++) {
+        usb_transfer_t transfer = {};
+        transfer.data_buffer = data.data() + (size_t)i * block_size;
+        transfer.data_buffer_size = block_size;
+        transfer.num_bytes = block_size;
+        transfer.actual_num_bytes = block_size;
+        transfer.context = this;
+        callbacks.data_cb(&transfer);
+    }
+    return ESP_OK;
+}
+
+esp_err_t USBmscDevice::_write10(uint8_t lun, int offset, int num_sectors, uint8_t* buff) {
+    {
+        std::lock_guard<std::mutex> guard(portLock);
+        if (!connected || lun != 0) return ESP_ERR_TIMEOUT;
+        if (!image.write(offset, buff, num_sectors)) return ESP_FAIL;
+        stats.blocksWritten += num_sectors;
+    }
+    chargeTransfer((uint64_t)num_sectors * block_size);
+    return ESP_OK;
+}
+
+// ---------------------------------------------------------------------------
+// Loopback serial adapter
+
+// What the host sends goes into the transmit FIFO and out on the wire, one
+// character time per byte, straight back into the receive FIFO. RTS is wired
+// to CTS, so a full receive FIFO holds the wire; an OUT packet that does not
+// fit the transmit FIFO is NAKed until it does. IN data goes out once per frame.
+struct SimSerialAdapter {
+    std::mutex lock;
+    std::condition_variable wake;
+    bool started = false;
+    USBacmDevice* device = nullptr;
+    std::deque<uint8_t> txFifo;
+    std::deque<uint8_t> rxFifo;
+    double wireUs = 0;              // When the character at the head of txFifo is back
+    size_t inRequested = 0;         // Length of the submitted IN transfer, 0 if none
+    std::vector<uint8_t> outPacket;
+    bool outPending = false;
+    bool delivering = false;        // Callbacks running unlocked; the device must outlive them
+    std::deque<int> controlDone;
+    uint64_t nextFrameUs = 0;
+    sim::SerialLoopbackState state = {115200, 8, 0, 0, false, false, 0};
+
+    static void task(void* param);
+
+    double charUs() {
+        double bits = 1 + state.dataBits + (state.parity ? 1 : 0) + (state.stopBits == 0 ? 1 : state.stopBits == 1 ? 1.5 : 2);
+        return bits * 1e6 / (state.baud ? state.baud : 1);
+    }
+
+    // Caller holds lock
+    void moveWire(uint64_t now) {
+        if (rxFifo.size() >= SIM_SERIAL_FIFO && wireUs < now) {
+            wireUs = now;
+        }
+        while (!txFifo.empty() && wireUs <= now && rxFifo.size() < SIM_SERIAL_FIFO) {
+            rxFifo.push_back(txFifo.front());
+            txFifo.pop_front();
+            state.echoed++;
+            wireUs += charUs();
+        }
+    }
+
+    void reset() {
+        txFifo.clear();
+        rxFifo.clear();
+        inRequested = 0;
+        outPending = false;
+        controlDone.clear();
+    }
+};
+
+// Never destroyed: its task is still waiting on it when main() returns
+static SimSerialAdapter& adapter = *new SimSerialAdapter();
+
+struct SimSerialCompletion {
+    int event;
+    std::vector<uint8_t> data;
+};
+
+void SimSerialAdapter::task(void*) {
+    std::unique_lock<std::mutex> guard(adapter.lock);
+    while (true) {
+        uint64_t now = sim::nowUs();
+        adapter.moveWire(now);
+
+        std::vector<SimSerialCompletion> done;
+        while (!adapter.controlDone.empty()) {
+            done.push_back({adapter.controlDone.front(), {}});
+            adapter.controlDone.pop_front();
+        }
+        if (adapter.outPending && adapter.txFifo.size() + adapter.outPacket.size() <= SIM_SERIAL_FIFO) {
+            if (adapter.txFifo.empty()) {
+                adapter.wireUs = now + adapter.charUs();
+            }
+            adapter.txFifo.insert(adapter.txFifo.end(), adapter.outPacket.begin(), adapter.outPacket.end());
+            adapter.outPending = false;
+            done.push_back({CDC_DATA_OUT, {}});
+        }
+        if (adapter.inRequested && !adapter.rxFifo.empty() && now >= adapter.nextFrameUs) {
+            size_t n = std::min(adapter.inRequested, adapter.rxFifo.size());
+            done.push_back({CDC_DATA_IN, std::vector<uint8_t>(adapter.rxFifo.begin(), adapter.rxFifo.begin() + n)});
+            adapter.rxFifo.erase(adapter.rxFifo.begin(), adapter.rxFifo.begin() + n);
+            adapter.inRequested = 0;
+            adapter.nextFrameUs = now + SIM_SERIAL_FRAME_US;
+        }
+
+        USBacmDevice* device = adapter.device;
+        if (!done.empty() && device) {
+            // Callbacks submit the next transfers, so they run unlocked
+            adapter.delivering = true;
+            guard.unlock();
+            for (SimSerialCompletion& completion : done) {
+                if (completion.event != CDC_DATA_IN && completion.event != CDC_DATA_OUT) {
+                    device->connected = true;
+                }
+                if (device->event_cb) {
+                    device->event_cb(completion.event, completion.data.data(), completion.data.size());
+                }
+            }
+            guard.lock();
+            adapter.delivering = false;
+            adapter.wake.notify_all();
+            continue;
+        }
+
+        bool busy = !adapter.txFifo.empty() || adapter.outPending || (adapter.inRequested && !adapter.rxFifo.empty());
+        if (busy) {
+            adapter.wake.wait_for(guard, std::chrono::microseconds(SIM_SERIAL_FRAME_US / 4));
+        } else {
+            adapter.wake.wait(guard);
+        }
+    }
+}
+
+USBacmDevice::USBacmDevice(const usb_config_desc_t*, USBhost* host) {
+    _host = host;
+    std::lock_guard<std::mutex> guard(adapter.lock);
+    adapter.device = this;
+    adapter.reset();
+    if (!adapter.started) {
+        xTaskCreate(SimSerialAdapter::task, "acm_loopback", 4096, NULL, 5, NULL);
+        adapter.started = true;
+    }
+}
+
+USBacmDevice::~USBacmDevice() {
+    std::unique_lock<std::mutex> guard(adapter.lock);
+    adapter.wake.wait(guard, []() { return !adapter.delivering; });
+    if (adapter.device == this) {
+        adapter.device = nullptr;
+        adapter.reset();
+    }
+}
+
+bool USBacmDevice::init() {
+    return true;
+}
+
+void USBacmDevice::setControlLine(bool dtr, bool rts) {
+    std::lock_guard<std::mutex> guard(adapter.lock);
+    adapter.state.dtr = dtr;
+    adapter.state.rts = rts;
+    adapter.controlDone.push_back(CDC_CTRL_SET_CONTROL_LINE_STATE);
+    adapter.wake.notify_all();
+}
+
+// cf is bCharFormat, the stop bits
+void USBacmDevice::setLineCoding(uint32_t bitrate, uint8_t cf, uint8_t parity, uint8_t bits) {
+    std::lock_guard<std::mutex> guard(adapter.lock);
+    adapter.state.baud = bitrate;
+    adapter.state.stopBits = cf;
+    adapter.state.parity = parity;
+    adapter.state.dataBits = bits;
+    adapter.controlDone.push_back(CDC_CTRL_SET_LINE_CODING);
+    adapter.wake.notify_all();
+}
+
+void USBacmDevice::getLineCoding() {
+    std::lock_guard<std::mutex> guard(adapter.lock);
+    adapter.controlDone.push_back(CDC_CTRL_GET_LINE_CODING);
+    adapter.wake.notify_all();
+}
+
+void USBacmDevice::INDATA(size_t len) {
+    if (!connected) return;
+    std::lock_guard<std::mutex> guard(adapter.lock);
+    if (adapter.device != this) return;
+    adapter.inRequested = len;
+    adapter.wake.notify_all();
+}
+
+// The library copies into a 64-byte transfer, so longer packets would overrun it
+void USBacmDevice::OUTDATA(uint8_t* data, size_t len) {
+    if (!connected || !len) return;
+    if (len > 64) {
+        fprintf(stderr, "USBacmDevice::OUTDATA: %zu bytes overruns the 64-byte transfer\n", len);
+        len = 64;
+    }
+    std::lock_guard<std::mutex> guard(adapter.lock);
+    if (adapter.device != this) return;
+    adapter.outPacket.assign(data, data + len);
+    adapter.outPending = true;
+    adapter.wake.notify_all();
+}
+
+bool USBacmDevice::isConnected() {
+    return connected;
+}
+
+// ---------------------------------------------------------------------------
+// Runner controls
+
+namespace sim {
+
+bool attachUsbImage(const std::string& path, uint32_t delayMs) {
+    {
+        std::lock_guard<std::mutex> guard(portLock);
+        if (connected) {
+            fprintf(stderr, "USB port already has a device\n");
+            return false;
+        }
+        if (!image.open(path.c_str())) return false;
+        serialAttached = false;
+    }
+
+    scheduleAt(nowUs() + (uint64_t)delayMs * 1000, []() {
+        std::lock_guard<std::mutex> guard(portLock);
+        connected = true;
+        postClientEvent(USB_HOST_CLIENT_EVENT_NEW_DEV);
+    });
+    runDueEvents();
+    return true;
+}
+
+void detachUsbImage(uint32_t delayMs) {
+    scheduleAt(nowUs() + (uint64_t)delayMs * 1000, []() {
+        std::lock_guard<std::mutex> guard(portLock);
+        if (!connected || serialAttached) return;
+        connected = false;
+        image.sync();
+        postClientEvent(USB_HOST_CLIENT_EVENT_DEV_GONE);
+    });
+    runDueEvents();
+}
+
+bool attachUsbSerialLoopback(uint32_t delayMs) {
+    {
+        std::lock_guard<std::mutex> guard(portLock);
+        if (connected) {
+            fprintf(stderr, "USB port already has a device\n");
+            return false;
+        }
+        serialAttached = true;
+    }
+
+    scheduleAt(nowUs() + (uint64_t)delayMs * 1000, []() {
+        std::lock_guard<std::mutex> guard(portLock);
+        connected = true;
+        postClientEvent(USB_HOST_CLIENT_EVENT_NEW_DEV);
+    });
+    runDueEvents();
+    return true;
+}
+
+// Transfers in flight are dropped, as they are when a cable is pulled
+void detachUsbSerialLoopback(uint32_t delayMs) {
+    scheduleAt(nowUs() + (uint64_t)delayMs * 1000, []() {
+        {
+            std::lock_guard<std::mutex> guard(adapter.lock);
+            adapter.reset();
+        }
+        std::lock_guard<std::mutex> guard(portLock);
+        if (!connected || !serialAttached) return;
+        connected = false;
+        postClientEvent(USB_HOST_CLIENT_EVENT_DEV_GONE);
+    });
+    runDueEvents();
+}
+
+SerialLoopbackState getSerialLoopbackState() {
+    std::lock_guard<std::mutex> guard(adapter.lock);
+    return adapter.state;
+}
+
+UsbStats getUsbStats() {
+    std::lock_guard<std::mutex> guard(portLock);
+    return stats;
+}
+
+void resetUsbStats() {
+    std::lock_guard<std::mutex> guard(portLock);
+    stats = {};
+}
+
+} // namespace sim
@@ -0,0 +1,505 @@
+// Host simulation of ESPAsyncWebServer: in-process request dispatch,
+// WebSocket clients with output sinks and a loopback TCP listener.
+#include <ESPAsyncWebServer.h>
+#include "sim_hal.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Body and response pieces are one TCP segment, like lwIP hands them over
+static const size_t SIM_TCP_SEGMENT = 1436;
+// A filler that keeps answering RESPONSE_TRY_AGAIN this long loses its client
+#define SIM_FILL_TIMEOUT_MS 10000
+
+// ---------------------------------------------------------------------------
+// HTTP
+// ---------------------------------------------------------------------------
+
+static String urlDecode(const String& text) {
+    String result;
+    for (unsigned int i = 0; i < text.length(); i++) {
+        char c = text[i];
+        if (c == '+') {
+            result += ' ';
+        } else if (c == '%' && i + 2 < text.length()) {
+            result += (char)strtol(text.substring(i + 1, i + 3).c_str(), nullptr, 16);
+            i += 2;
+        } else {
+            result += c;
+        }
+    }
+    return result;
+}
+
+AsyncWebServerRequest::AsyncWebServerRequest(WebRequestMethod method, const String& url)
+    : requestMethod(method), requestUrl(url), response(nullptr), _tempObject(nullptr) {
+    int query = url.indexOf('?');
+    if (query < 0) return;
+
+    requestUrl = url.substring(0, query);
+    String rest = url.substring(query + 1);
+    while (rest.length()) {
+        int amp = rest.indexOf('&');
+        String pair = amp < 0 ? rest : rest.substring(0, amp);
+        rest = amp < 0 ? String() : rest.substring(amp + 1);
+        int equals = pair.indexOf('=');
+        if (pair.length()) {
+            params.emplace_back(urlDecode(equals < 0 ? pair : pair.substring(0, equals)),
+                                urlDecode(equals < 0 ? String() : pair.substring(equals + 1)));
+        }
+    }
+}
+
+AsyncWebServerRequest::~AsyncWebServerRequest() {
+    if (disconnectHandler) disconnectHandler();
+    delete response;
+    free(_tempObject);
+}
+
+const AsyncWebHeader* AsyncWebServerRequest::getHeader(const char* name) const {
+    for (const AsyncWebHeader& header : headers) {
+        if (header.name().equalsIgnoreCase(name)) return &header;
+    }
+    return nullptr;
+}
+
+const AsyncWebParameter* AsyncWebServerRequest::getParam(const char* name) const {
+    for (const AsyncWebParameter& param : params) {
+        if (param.name() == name) return &param;
+    }
+    return nullptr;
+}
+
+const String& AsyncWebServerRequest::header(const char* name) const {
+    static const String empty;
+    const AsyncWebHeader* found = getHeader(name);
+    return found ? found->value() : empty;
+}
+
+void AsyncWebServerRequest::send(int code, const String& contentType, const String& content) {
+    send(beginResponse(code, contentType, content));
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse* newResponse) {
+    delete response;
+    response = newResponse;
+}
+
+void AsyncWebServerRequest::send(FS& fs, const String& path, const String& contentType) {
+    File file = fs.open(path, "r");
+    if (!file) {
+        send(404, "text/plain", "Not found");
+        return;
+    }
+
+    AsyncWebServerResponse* fileResponse = new AsyncWebServerResponse(200, contentType);
+    std::string body(file.size(), '\0');
+    file.readBytes(&body[0], body.size());
+    file.close();
+    fileResponse->setBody(body);
+    send(fileResponse);
+}
+
+AsyncResponseStream* AsyncWebServerRequest::beginResponseStream(const String& contentType, size_t bufferSize) {
+    (void)bufferSize;
+    return new AsyncResponseStream(contentType);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(int code, const String& contentType, const String& content) {
+    AsyncWebServerResponse* result = new AsyncWebServerResponse(code, contentType);
+    result->setBody(content.str());
+    return result;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(const String& contentType, size_t len,
+                                                             AwsResponseFiller callback) {
+    return new AsyncCallbackResponse(contentType, len, callback, false);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginChunkedResponse(const String& contentType,
+                                                                    AwsResponseFiller callback) {
+    return new AsyncCallbackResponse(contentType, 0, callback, true);
+}
+
+String AsyncWebServerResponse::getHeader(const char* name) const {
+    for (const AsyncWebHeader& header : headers) {
+        if (header.name().equalsIgnoreCase(name)) return header.value();
+    }
+    return String();
+}
+
+void AsyncCallbackResponse::drain() {
+    uint8_t segment[SIM_TCP_SEGMENT];
+    size_t index = 0;
+    int waits = 0;
+    while (chunked || index < contentLength) {
+        size_t maxLen = sizeof(segment);
+        if (!chunked && contentLength - index < maxLen) maxLen = contentLength - index;
+
+        size_t n = filler(segment, maxLen, index);
+        if (n == RESPONSE_TRY_AGAIN) {
+            // The filler is waiting on another task
+            if (++waits > SIM_FILL_TIMEOUT_MS) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            sim::runDueEvents();
+            continue;
+        }
+        // A short fixed-length body is a dropped connection on the device
+        if (n == 0) break;
+        waits = 0;
+        body.append((const char*)segment, n);
+        index += n;
+    }
+}
+
+static String contentTypeFor(const String& path) {
+    if (path.endsWith(".html") || path.endsWith(".htm")) return "text/html";
+    if (path.endsWith(".css")) return "text/css";
+    if (path.endsWith(".js")) return "application/javascript";
+    if (path.endsWith(".json")) return "application/json";
+    if (path.endsWith(".png")) return "image/png";
+    return "text/plain";
+}
+
+bool AsyncStaticWebHandler::canHandle(AsyncWebServerRequest* request) {
+    return request->method() == HTTP_GET && request->url().startsWith(uri);
+}
+
+void AsyncStaticWebHandler::handleRequest(AsyncWebServerRequest* request) {
+    String file = path + request->url().substring(uri.length());
+    if (file.endsWith("/")) file += defaultFile;
+    file.replace("//", "/");
+
+    if (!fs.exists(file)) {
+        request->send(404, "text/plain", "Not found");
+        return;
+    }
+    request->send(fs, file, contentTypeFor(file));
+}
+
+AsyncWebServer::~AsyncWebServer() {
+    // Handlers passed to addHandler are owned by the caller
+    (void)port;
+}
+
+AsyncStaticWebHandler& AsyncWebServer::serveStatic(const char* uri, FS& fs, const char* path) {
+    AsyncStaticWebHandler* handler = new AsyncStaticWebHandler(uri, fs, path);
+    addHandler(handler);
+    return *handler;
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method,
+                                            ArRequestHandlerFunction onRequest) {
+    AsyncCallbackWebHandler* handler = new AsyncCallbackWebHandler(uri, method, onRequest);
+    addHandler(handler);
+    return *handler;
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method,
+                                            ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload,
+                                            ArBodyHandlerFunction onBody) {
+    AsyncCallbackWebHandler& handler = on(uri, method, onRequest);
+    handler.onUpload(onUpload);
+    handler.onBody(onBody);
+    return handler;
+}
+
+// Each part with a filename goes to the upload handler; plain fields are dropped
+static void deliverMultipart(AsyncWebHandler* handler, AsyncWebServerRequest* request, std::string& body,
+                             const std::string& delimiter) {
+    size_t pos = body.find(delimiter);
+    while (pos != std::string::npos) {
+        size_t headerStart = pos + delimiter.size();
+        if (body.compare(headerStart, 2, "--") == 0) break;
+        size_t headerEnd = body.find("\r\n\r\n", headerStart);
+        if (headerEnd == std::string::npos) break;
+        size_t dataStart = headerEnd + 4;
+        size_t next = body.find("\r\n" + delimiter, dataStart);
+        if (next == std::string::npos) break;
+
+        std::string partHeaders = body.substr(headerStart, headerEnd - headerStart);
+        size_t nameAt = partHeaders.find("filename=\"");
+        if (nameAt != std::string::npos) {
+            nameAt += 10;
+            String filename = partHeaders.substr(nameAt, partHeaders.find('"', nameAt) - nameAt);
+            size_t length = next - dataStart;
+            size_t index = 0;
+            do {
+                size_t len = std::min(SIM_TCP_SEGMENT, length - index);
+                handler->handleUpload(request, filename, index, (uint8_t*)&body[dataStart + index], len,
+                                      index + len == length);
+                index += len;
+            } while (index < length);
+        }
+        pos = next + 2;
+    }
+}
+
+static void deliverBody(AsyncWebHandler* handler, AsyncWebServerRequest* request, std::string& body) {
+    if (body.empty()) return;
+
+    String type = request->contentType();
+    int boundaryAt = type.indexOf("boundary=");
+    if (type.startsWith("multipart/form-data") && boundaryAt >= 0) {
+        deliverMultipart(handler, request, body, "--" + type.substring(boundaryAt + 9).str());
+        return;
+    }
+    for (size_t index = 0; index < body.size(); index += SIM_TCP_SEGMENT) {
+        size_t len = std::min(SIM_TCP_SEGMENT, body.size() - index);
+        handler->handleBody(request, (uint8_t*)&body[index], len, index, body.size());
+    }
+}
+
+void AsyncWebServer::dispatch(AsyncWebServerRequest* request) {
+    // Callback handlers first so "/" static serving doesn't shadow the API
+    AsyncWebHandler* match = nullptr;
+    for (AsyncWebHandler* handler : handlers) {
+        if (dynamic_cast<AsyncStaticWebHandler*>(handler)) continue;
+        if (handler->filterRequest(request) && handler->canHandle(request)) {
+            match = handler;
+            break;
+        }
+    }
+    for (AsyncWebHandler* handler : handlers) {
+        if (match) break;
+        if (!dynamic_cast<AsyncStaticWebHandler*>(handler)) continue;
+        if (handler->filterRequest(request) && handler->canHandle(request)) {
+            match = handler;
+        }
+    }
+
+    if (match) {
+        deliverBody(match, request, request->body);
+        match->handleRequest(request);
+    } else if (notFound) {
+        notFound(request);
+    } else {
+        request->send(404);
+    }
+
+    if (request->response) {
+        request->response->drain();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// WebSocket
+// ---------------------------------------------------------------------------
+
+AsyncWebSocket::~AsyncWebSocket() {
+    for (AsyncWebSocketClient* client : clients) {
+        delete client;
+    }
+}
+
+size_t AsyncWebSocket::count() {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    return clients.size();
+}
+
+void AsyncWebSocket::cleanupClients(uint16_t maxClients) {
+    std::vector<AsyncWebSocketClient*> dropped;
+    {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        while (clients.size() > maxClients) {
+            dropped.push_back(clients.front());
+            clients.erase(clients.begin());
+        }
+    }
+    for (AsyncWebSocketClient* client : dropped) {
+        std::lock_guard<std::mutex> events(eventLock);
+        if (eventHandler) eventHandler(this, client, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+        delete client;
+    }
+}
+
+void AsyncWebSocket::textAll(const char* message, size_t len) {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    for (AsyncWebSocketClient* client : clients) {
+        client->text(message, len);
+    }
+}
+
+void AsyncWebSocket::binaryAll(const uint8_t* message, size_t len) {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    for (AsyncWebSocketClient* client : clients) {
+        client->binary(message, len);
+    }
+}
+
+bool AsyncWebSocket::availableForWriteAll() {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    for (AsyncWebSocketClient* client : clients) {
+        if (!client->canSend()) return false;
+    }
+    return true;
+}
+
+AsyncWebSocketClient* AsyncWebSocket::connectClient(SimWsSink sink, const IPAddress& ip, SimWsSink binarySink) {
+    AsyncWebSocketClient* client;
+    {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        client = new AsyncWebSocketClient(nextId++, ip, sink, binarySink);
+        clients.push_back(client);
+    }
+
+    std::lock_guard<std::mutex> events(eventLock);
+    if (eventHandler) eventHandler(this, client, WS_EVT_CONNECT, nullptr, nullptr, 0);
+    return client;
+}
+
+void AsyncWebSocket::injectText(AsyncWebSocketClient* client, const char* message, size_t len) {
+    AwsFrameInfo info = {};
+    info.final = 1;
+    info.index = 0;
+    info.len = len;
+    info.opcode = WS_TEXT;
+    info.message_opcode = WS_TEXT;
+
+    // The library hands handlers a buffer with room for a terminator
+    std::vector<uint8_t> frame(len + 1);
+    memcpy(frame.data(), message, len);
+
+    std::lock_guard<std::mutex> events(eventLock);
+    if (eventHandler) eventHandler(this, client, WS_EVT_DATA, &info, frame.data(), len);
+}
+
+void AsyncWebSocket::injectBinary(AsyncWebSocketClient* client, const uint8_t* message, size_t len) {
+    AwsFrameInfo info = {};
+    info.final = 1;
+    info.index = 0;
+    info.len = len;
+    info.opcode = WS_BINARY;
+    info.message_opcode = WS_BINARY;
+
+    std::vector<uint8_t> frame(message, message + len);
+    frame.push_back(0);
+
+    std::lock_guard<std::mutex> events(eventLock);
+    if (eventHandler) eventHandler(this, client, WS_EVT_DATA, &info, frame.data(), len);
+}
+
+void AsyncWebSocket::disconnectClient(AsyncWebSocketClient* client) {
+    {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        auto it = std::find(clients.begin(), clients.end(), client);
+        if (it == clients.end()) return;
+        clients.erase(it);
+    }
+
+    std::lock_guard<std::mutex> events(eventLock);
+    if (eventHandler) eventHandler(this, client, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+    delete client;
+}
+
+// ---------------------------------------------------------------------------
+// Loopback TCP listener
+// ---------------------------------------------------------------------------
+
+namespace sim {
+
+static std::atomic<bool> listening{false};
+static int listenFd = -1;
+
+static void writeAll(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        ssize_t n = ::send(fd, data, len, MSG_NOSIGNAL);
+        if (n <= 0) return;
+        data += n;
+        len -= n;
+    }
+}
+
+static void serveConnection(int fd, AsyncWebServer* server, AsyncWebSocket* ws) {
+    auto writeLock = std::make_shared<std::mutex>();
+    AsyncWebSocketClient* client = ws->connectClient([fd, writeLock](uint32_t id, const char* data, size_t len) {
+        (void)id;
+        std::lock_guard<std::mutex> guard(*writeLock);
+        writeAll(fd, data, len);
+        writeAll(fd, "\n", 1);
+    });
+
+    std::string pending;
+    char buf[1024];
+    ssize_t n;
+    while ((n = ::recv(fd, buf, sizeof(buf), 0)) > 0) {
+        pending.append(buf, n);
+
+        size_t newline;
+        while ((newline = pending.find('\n')) != std::string::npos) {
+            std::string line = pending.substr(0, newline);
+            pending.erase(0, newline + 1);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (line.empty()) continue;
+
+            // "GET /api/status" style lines go to the HTTP handlers
+            size_t space = line.find(' ');
+            std::string verb = line.substr(0, space);
+            WebRequestMethod method = verb == "GET" ? HTTP_GET : verb == "POST" ? HTTP_POST : HTTP_DELETE;
+            if (space != std::string::npos && (verb == "GET" || verb == "POST" || verb == "DELETE")) {
+                String url = String(line.substr(space + 1));
+                url.trim();
+                AsyncWebServerRequest request(method, url);
+                server->dispatch(&request);
+
+                const AsyncWebServerResponse* response = request.getResponse();
+                std::string reply = "HTTP " + std::to_string(response ? response->getCode() : 500) + " " +
+                                    (response ? response->getContentType().c_str() : "") + "\n" +
+                                    (response ? response->getBody() : "") + "\n";
+                std::lock_guard<std::mutex> guard(*writeLock);
+                writeAll(fd, reply.data(), reply.size());
+                continue;
+            }
+
+            ws->injectText(client, line.data(), line.size());
+        }
+    }
+
+    ws->disconnectClient(client);
+    ::close(fd);
+}
+
+bool startLoopbackServer(uint16_t port, AsyncWebServer* server, AsyncWebSocket* ws) {
+    listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) return false;
+
+    int reuse = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (::bind(listenFd, (sockaddr*)&addr, sizeof(addr)) < 0 || ::listen(listenFd, 4) < 0) {
+        ::close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    listening = true;
+    std::thread([server, ws]() {
+        while (listening) {
+            int fd = ::accept(listenFd, nullptr, nullptr);
+            if (fd < 0) continue;
+            std::thread(serveConnection, fd, server, ws).detach();
+        }
+    }).detach();
+    return true;
+}
+
+void stopLoopbackServer() {
+    listening = false;
+    if (listenFd >= 0) {
+        ::shutdown(listenFd, SHUT_RDWR);
+        ::close(listenFd);
+        listenFd = -1;
+    }
+}
+
+} // namespace sim
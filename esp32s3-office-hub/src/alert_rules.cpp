@@ -0,0 +1,250 @@
+#include "alert_rules.h"
+#include "memory_policy.h"
+#include <ArduinoJson.h>
+
+AlertRulesEngine::AlertRulesEngine() {
+    logHead = 0;
+    logCount = 0;
+    timers = nullptr;
+    sampleQueue = NULL;
+}
+
+bool AlertRulesEngine::begin(TimerService* timerService) {
+    timers = timerService;
+
+    sampleQueue = xQueueCreate(16, sizeof(AlertSample));
+    if (!sampleQueue) {
+        Serial.println("Failed to create alert sample queue");
+        return false;
+    }
+
+    Serial.println("Alert rules engine initialized");
+    return true;
+}
+
+void AlertRulesEngine::clearRules() {
+    for (auto& rule : rules) {
+        cancelPending(rule);
+    }
+    rules.clear();
+}
+
+void AlertRulesEngine::addRule(const String& name, const String& metric, AlertComparison comparison,
+                               float threshold, float hysteresis, unsigned long minDurationMs,
+                               uint8_t actions, uint32_t color) {
+    AlertRule rule;
+    rule.name = name;
+    rule.metric = metric;
+    rule.comparison = comparison;
+    rule.threshold = threshold;
+    rule.hysteresis = hysteresis < 0 ? 0 : hysteresis;
+    rule.minDurationMs = minDurationMs;
+    rule.actions = actions;
+    rule.color = color;
+    rule.state = ALERT_CLEAR;
+    rule.conditionSince = 0;
+    rule.lastValue = NAN;
+    rule.pendingTimer = INVALID_TIMER_ID;
+    rule.triggerCount = 0;
+
+    rules.push_back(rule);
+}
+
+size_t AlertRulesEngine::getRuleCount() {
+    return rules.size();
+}
+
+void AlertRulesEngine::setActionHandler(AlertActionHandler handler) {
+    actionHandler = handler;
+}
+
+void AlertRulesEngine::onSample(const String& metric, float value) {
+    unsigned long now = millis();
+
+    for (size_t i = 0; i < rules.size(); i++) {
+        if (rules[i].metric == metric) {
+            evaluate(i, value, now);
+        }
+    }
+}
+
+bool AlertRulesEngine::postSample(const char* metric, float value) {
+    if (!sampleQueue) return false;
+
+    AlertSample sample;
+    strlcpy(sample.metric, metric, sizeof(sample.metric));
+    sample.value = value;
+    sample.timestamp = millis();
+
+    if (xQueueSend(sampleQueue, &sample, 0) != pdTRUE) {
+        return false;
+    }
+
+    if (timers) {
+        timers->wake();
+    }
+    return true;
+}
+
+void AlertRulesEngine::processPending() {
+    if (!sampleQueue) return;
+
+    AlertSample sample;
+    while (xQueueReceive(sampleQueue, &sample, 0) == pdTRUE) {
+        for (size_t i = 0; i < rules.size(); i++) {
+            if (rules[i].metric == sample.metric) {
+                evaluate(i, sample.value, sample.timestamp);
+            }
+        }
+    }
+}
+
+bool AlertRulesEngine::conditionMet(const AlertRule& rule, float value) {
+    if (isnan(value)) return false;
+    return rule.comparison == ALERT_ABOVE ? value > rule.threshold : value < rule.threshold;
+}
+
+bool AlertRulesEngine::clearMet(const AlertRule& rule, float value) {
+    if (isnan(value)) return false;
+    return rule.comparison == ALERT_ABOVE ? value <= rule.threshold - rule.hysteresis
+                                          : value >= rule.threshold + rule.hysteresis;
+}
+
+void AlertRulesEngine::cancelPending(AlertRule& rule) {
+    if (rule.pendingTimer != INVALID_TIMER_ID && timers) {
+        timers->cancel(rule.pendingTimer);
+    }
+    rule.pendingTimer = INVALID_TIMER_ID;
+}
+
+void AlertRulesEngine::evaluate(size_t index, float value, unsigned long now) {
+    AlertRule& rule = rules[index];
+    rule.lastValue = value;
+
+    switch (rule.state) {
+        case ALERT_CLEAR:
+            if (!conditionMet(rule, value)) break;
+
+            if (rule.minDurationMs == 0) {
+                transition(rule, true, value, now);
+                break;
+            }
+
+            rule.state = ALERT_PENDING;
+            rule.conditionSince = now;
+
+            // Samples may be sparse (or event-driven), so don't wait for the next one
+            if (timers) {
+                rule.pendingTimer = timers->after(rule.minDurationMs, [this, index]() {
+                    if (index >= rules.size()) return;
+                    AlertRule& r = rules[index];
+                    r.pendingTimer = INVALID_TIMER_ID;
+                    if (r.state == ALERT_PENDING && conditionMet(r, r.lastValue)) {
+                        transition(r, true, r.lastValue, millis());
+                    }
+                }, "alert:" + rule.name);
+            }
+            break;
+
+        case ALERT_PENDING:
+            if (!conditionMet(rule, value)) {
+                cancelPending(rule);
+                rule.state = ALERT_CLEAR;
+            } else if (now - rule.conditionSince >= rule.minDurationMs) {
+                cancelPending(rule);
+                transition(rule, true, value, now);
+            }
+            break;
+
+        case ALERT_ACTIVE:
+            if (clearMet(rule, value)) {
+                transition(rule, false, value, now);
+            }
+            break;
+    }
+}
+
+void AlertRulesEngine::transition(AlertRule& rule, bool raised, float value, unsigned long now) {
+    rule.state = raised ? ALERT_ACTIVE : ALERT_CLEAR;
+    if (raised) {
+        rule.triggerCount++;
+    }
+
+    if (rule.actions & ALERT_ACTION_LOG) {
+        AlertLogEntry& entry = alertLog[logHead];
+        entry.timestamp = now;
+        entry.rule = rule.name;
+        entry.raised = raised;
+        entry.value = value;
+        logHead = (logHead + 1) % ALERT_LOG_SIZE;
+        if (logCount < ALERT_LOG_SIZE) logCount++;
+
+        Serial.printf("Alert %s: %s (value %.2f)\n", raised ? "raised" : "cleared", rule.name.c_str(), value);
+    }
+
+    if (actionHandler) {
+        actionHandler(rule, raised, value);
+    }
+}
+
+bool AlertRulesEngine::isActive(const String& name) {
+    for (const auto& rule : rules) {
+        if (rule.name == name) {
+            return rule.state == ALERT_ACTIVE;
+        }
+    }
+    return false;
+}
+
+bool AlertRulesEngine::getOverlayColor(uint32_t& color) {
+    // Most recently added active rule wins
+    for (auto it = rules.rbegin(); it != rules.rend(); ++it) {
+        if (it->state == ALERT_ACTIVE && (it->actions & ALERT_ACTION_LED)) {
+            color = it->color;
+            return true;
+        }
+    }
+    return false;
+}
+
+String AlertRulesEngine::getActiveAlertsJSON() {
+    JsonDocument doc(MemoryPolicy::json());
+    JsonArray list = doc.createNestedArray("rules");
+
+    for (const auto& rule : rules) {
+        JsonObject r = list.createNestedObject();
+        r["name"] = rule.name;
+        r["metric"] = rule.metric;
+        r["threshold"] = rule.threshold;
+        r["hysteresis"] = rule.hysteresis;
+        r["state"] = rule.state == ALERT_ACTIVE ? "active" : (rule.state == ALERT_PENDING ? "pending" : "clear");
+        r["triggers"] = rule.triggerCount;
+        if (!isnan(rule.lastValue)) {
+            r["value"] = rule.lastValue;
+        }
+    }
+
+    String result;
+    serializeJson(doc, result);
+    return result;
+}
+
+String AlertRulesEngine::getAlertLogJSON() {
+    JsonDocument doc(MemoryPolicy::json());
+    JsonArray list = doc.createNestedArray("log");
+
+    // Oldest first
+    size_t start = (logHead + ALERT_LOG_SIZE - logCount) % ALERT_LOG_SIZE;
+    for (size_t i = 0; i < logCount; i++) {
+        const AlertLogEntry& entry = alertLog[(start + i) % ALERT_LOG_SIZE];
+        JsonObject e = list.createNestedObject();
+        e["timestamp"] = entry.timestamp;
+        e["rule"] = entry.rule;
+        e["event"] = entry.raised ? "raised" : "cleared";
+        e["value"] = entry.value;
+    }
+
+    String result;
+    serializeJson(doc, result);
+    return result;
+}
@@ -0,0 +1,325 @@
+#include "block_cache.h"
+#include "memory_policy.h"
+#include <algorithm>
+
+BlockCache::BlockCache(BlockDevice* inner) {
+    device = inner;
+    blockSize = inner->getBlockSize();
+}
+
+BlockCache::~BlockCache() {
+    if (data) {
+        MemoryPolicy::psram()->deallocate(data);
+    }
+    if (staging) {
+        MemoryPolicy::psram()->deallocate(staging);
+    }
+    delete[] slots;
+    delete[] buckets;
+    delete[] order;
+    if (lock) {
+        vSemaphoreDelete(lock);
+    }
+}
+
+bool BlockCache::begin() {
+    slotCount = blockSize ? BLOCK_CACHE_BYTES / blockSize : 0;
+    if (slotCount < BLOCK_CACHE_RUN * 2) {
+        Serial.printf("Block cache: %u-byte sectors leave too few slots\n", blockSize);
+        return false;
+    }
+
+    // staging holds a read-ahead window followed by a write-back run
+    bucketCount = slotCount;
+    data = (uint8_t*)MemoryPolicy::psram()->allocate((size_t)slotCount * blockSize);
+    staging = (uint8_t*)MemoryPolicy::psram()->allocate((size_t)BLOCK_CACHE_RUN * 2 * blockSize);
+    slots = new Slot[slotCount];
+    buckets = new int16_t[bucketCount];
+    order = new int16_t[slotCount];
+    lock = xSemaphoreCreateMutex();
+    if (!data || !staging || !slots || !buckets || !order || !lock) {
+        Serial.println("Block cache: out of memory");
+        return false;
+    }
+
+    for (uint16_t i = 0; i < slotCount; i++) {
+        slots[i] = {0, 0, -1, false, false};
+    }
+    for (uint16_t i = 0; i < bucketCount; i++) {
+        buckets[i] = -1;
+    }
+    return true;
+}
+
+void BlockCache::setProtectedRange(uint32_t start, uint32_t end) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    protectedStart = start;
+    protectedEnd = end;
+    protectedCount = 0;
+    for (uint16_t i = 0; i < slotCount; i++) {
+        if (slots[i].valid && isProtected(slots[i].block)) {
+            protectedCount++;
+        }
+    }
+    xSemaphoreGive(lock);
+}
+
+const BlockCacheStats& BlockCache::getStats() {
+    return stats;
+}
+
+bool BlockCache::isProtected(uint32_t block) {
+    return block >= protectedStart && block < protectedEnd;
+}
+
+uint8_t* BlockCache::slotData(int16_t slot) {
+    return data + (size_t)slot * blockSize;
+}
+
+int16_t BlockCache::lookup(uint32_t block) {
+    for (int16_t i = buckets[block % bucketCount]; i >= 0; i = slots[i].hashNext) {
+        if (slots[i].block == block) return i;
+    }
+    return -1;
+}
+
+void BlockCache::touch(int16_t slot) {
+    slots[slot].lastUsed = ++clock;
+}
+
+void BlockCache::unlink(int16_t slot) {
+    int16_t* link = &buckets[slots[slot].block % bucketCount];
+    while (*link != slot) {
+        link = &slots[*link].hashNext;
+    }
+    *link = slots[slot].hashNext;
+
+    if (isProtected(slots[slot].block)) {
+        protectedCount--;
+    }
+    slots[slot].valid = false;
+    slots[slot].hashNext = -1;
+}
+
+// Free slot, else the least recently used file-data slot while protected
+// sectors are within their share, else the oldest protected one. Evicting a
+// dirty slot writes back everything dirty so the runs stay long.
+int16_t BlockCache::allocate(uint32_t block) {
+    int16_t victim = -1;
+    int16_t oldestData = -1;
+    int16_t oldestProtected = -1;
+    for (uint16_t i = 0; i < slotCount && victim < 0; i++) {
+        if (!slots[i].valid) {
+            victim = i;
+            continue;
+        }
+        int16_t& oldest = isProtected(slots[i].block) ? oldestProtected : oldestData;
+        if (oldest < 0 || slots[i].lastUsed < slots[oldest].lastUsed) {
+            oldest = i;
+        }
+    }
+
+    if (victim < 0) {
+        bool overQuota = protectedCount * 100 > slotCount * BLOCK_CACHE_PROTECTED_PERCENT;
+        victim = oldestData >= 0 && !overQuota ? oldestData : oldestProtected >= 0 ? oldestProtected : oldestData;
+        if (slots[victim].dirty && !flushDirty()) return -1;
+        unlink(victim);
+        stats.evictions++;
+    }
+
+    Slot& slot = slots[victim];
+    slot.block = block;
+    slot.valid = true;
+    slot.dirty = false;
+    slot.hashNext = buckets[block % bucketCount];
+    buckets[block % bucketCount] = victim;
+    if (isProtected(block)) {
+        protectedCount++;
+    }
+    touch(victim);
+    return victim;
+}
+
+// Writes every dirty slot, adjacent sectors together in one device write
+bool BlockCache::flushDirty() {
+    if (dirtyCount == 0) return true;
+
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < slotCount; i++) {
+        if (slots[i].valid && slots[i].dirty) {
+            order[n++] = i;
+        }
+    }
+    std::sort(order, order + n, [this](int16_t a, int16_t b) {
+        return slots[a].block < slots[b].block;
+    });
+
+    uint8_t* run = staging + (size_t)BLOCK_CACHE_RUN * blockSize;
+    bool ok = true;
+    for (uint16_t start = 0; start < n;) {
+        uint16_t end = start + 1;
+        while (end < n && end - start < BLOCK_CACHE_RUN && slots[order[end]].block == slots[order[end - 1]].block + 1) {
+            end++;
+        }
+
+        const uint8_t* source = slotData(order[start]);
+        if (end - start > 1) {
+            for (uint16_t k = start; k < end; k++) {
+                memcpy(run + (size_t)(k - start) * blockSize, slotData(order[k]), blockSize);
+            }
+            source = run;
+        }
+
+        stats.writeBacks++;
+        if (device->write(slots[order[start]].block, source, end - start)) {
+            stats.blocksWrittenBack += end - start;
+            for (uint16_t k = start; k < end; k++) {
+                slots[order[k]].dirty = false;
+                dirtyCount--;
+            }
+        } else {
+            ok = false;
+        }
+        start = end;
+    }
+    return ok;
+}
+
+// Dirty copies are newer than what a bypassing read got from the device
+void BlockCache::overlay(uint32_t block, uint8_t* buffer, uint32_t count) {
+    if (dirtyCount == 0) return;
+    for (uint32_t i = 0; i < count; i++) {
+        int16_t slot = lookup(block + i);
+        if (slot >= 0 && slots[slot].dirty) {
+            memcpy(buffer + (size_t)i * blockSize, slotData(slot), blockSize);
+        }
+    }
+}
+
+// A bypassing write went to the device; cached copies take the new data
+void BlockCache::refresh(uint32_t block, const uint8_t* buffer, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        int16_t slot = lookup(block + i);
+        if (slot < 0) continue;
+        memcpy(slotData(slot), buffer + (size_t)i * blockSize, blockSize);
+        if (slots[slot].dirty) {
+            slots[slot].dirty = false;
+            dirtyCount--;
+        }
+    }
+}
+
+bool BlockCache::read(uint32_t block, uint8_t* buffer, uint32_t count) {
+    if (!isReady() || block + count > device->getBlockCount()) return false;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool ok = true;
+    if (count >= BLOCK_CACHE_RUN) {
+        stats.deviceReads++;
+        ok = device->read(block, buffer, count);
+        if (ok) {
+            overlay(block, buffer, count);
+        }
+        nextSequential = block + count;
+        xSemaphoreGive(lock);
+        return ok;
+    }
+
+    for (uint32_t i = 0; i < count && ok; i++) {
+        uint32_t current = block + i;
+        uint8_t* out = buffer + (size_t)i * blockSize;
+        int16_t slot = lookup(current);
+        if (slot >= 0) {
+            stats.hits++;
+            memcpy(out, slotData(slot), blockSize);
+            touch(slot);
+            nextSequential = current + 1;
+            continue;
+        }
+
+        // A miss right after the previous read fetches a window, stopping at
+        // the first cached sector so a dirty copy is never replaced
+        stats.misses++;
+        uint32_t window = 1;
+        if (current == nextSequential) {
+            uint32_t limit = min((uint32_t)BLOCK_CACHE_RUN, device->getBlockCount() - current);
+            while (window < limit && lookup(current + window) < 0) {
+                window++;
+            }
+        }
+
+        stats.deviceReads++;
+        if (!device->read(current, staging, window)) {
+            ok = false;
+            break;
+        }
+        if (window > 1) {
+            stats.readAheads++;
+        }
+        memcpy(out, staging, blockSize);
+
+        // Caching is best effort: a failed write-back only costs the copy
+        for (uint32_t j = 0; j < window; j++) {
+            int16_t fresh = allocate(current + j);
+            if (fresh < 0) break;
+            memcpy(slotData(fresh), staging + (size_t)j * blockSize, blockSize);
+        }
+        nextSequential = current + 1;
+    }
+    xSemaphoreGive(lock);
+    return ok;
+}
+
+bool BlockCache::write(uint32_t block, const uint8_t* buffer, uint32_t count) {
+    if (!isReady() || block + count > device->getBlockCount()) return false;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool ok = true;
+    if (count >= BLOCK_CACHE_RUN) {
+        ok = device->write(block, buffer, count);
+        if (ok) {
+            refresh(block, buffer, count);
+        }
+    } else {
+        for (uint32_t i = 0; i < count && ok; i++) {
+            int16_t slot = lookup(block + i);
+            if (slot < 0) {
+                slot = allocate(block + i);
+            }
+            if (slot < 0) {
+                ok = false;
+                break;
+            }
+            memcpy(slotData(slot), buffer + (size_t)i * blockSize, blockSize);
+            if (!slots[slot].dirty) {
+                slots[slot].dirty = true;
+                dirtyCount++;
+            }
+            touch(slot);
+        }
+        if (ok && dirtyCount * 100 >= slotCount * BLOCK_CACHE_DIRTY_PERCENT) {
+            ok = flushDirty();
+        }
+    }
+    xSemaphoreGive(lock);
+    return ok;
+}
+
+bool BlockCache::sync() {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool ok = flushDirty() && device->sync();
+    xSemaphoreGive(lock);
+    return ok;
+}
+
+uint32_t BlockCache::getBlockCount() {
+    return device->getBlockCount();
+}
+
+uint16_t BlockCache::getBlockSize() {
+    return blockSize;
+}
+
+bool BlockCache::isReady() {
+    return device->isReady() && data != nullptr;
+}
@@ -0,0 +1,150 @@
+#include "block_device.h"
+#include "diskio_impl.h"
+#include "ff.h"
+
+FileBlockDevice::FileBlockDevice() {
+    file = nullptr;
+    blockCount = 0;
+    blockSize = 512;
+}
+
+FileBlockDevice::~FileBlockDevice() {
+    close();
+}
+
+bool FileBlockDevice::open(const char* path, uint16_t size) {
+    close();
+    file = fopen(path, "r+b");
+    if (!file) {
+        Serial.printf("Cannot open disk image %s\n", path);
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long bytes = ftell(file);
+    blockSize = size;
+    blockCount = bytes > 0 ? bytes / size : 0;
+    if (blockCount == 0) {
+        Serial.printf("Disk image %s is empty\n", path);
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool FileBlockDevice::create(const char* path, uint32_t blocks, uint16_t size) {
+    close();
+    file = fopen(path, "w+b");
+    if (!file) {
+        Serial.printf("Cannot create disk image %s\n", path);
+        return false;
+    }
+
+    // Writing the last byte sizes the file; the rest reads back as zeros
+    uint8_t zero = 0;
+    if (blocks == 0 || fseek(file, (long)blocks * size - 1, SEEK_SET) != 0 || fwrite(&zero, 1, 1, file) != 1) {
+        Serial.printf("Cannot size disk image %s to %u blocks\n", path, blocks);
+        close();
+        return false;
+    }
+    blockSize = size;
+    blockCount = blocks;
+    return true;
+}
+
+void FileBlockDevice::close() {
+    if (file) {
+        fclose(file);
+        file = nullptr;
+    }
+    blockCount = 0;
+}
+
+bool FileBlockDevice::read(uint32_t block, uint8_t* buffer, uint32_t count) {
+    if (!file || block + count > blockCount) return false;
+    if (fseek(file, (long)block * blockSize, SEEK_SET) != 0) return false;
+    return fread(buffer, blockSize, count, file) == count;
+}
+
+bool FileBlockDevice::write(uint32_t block, const uint8_t* buffer, uint32_t count) {
+    if (!file || block + count > blockCount) return false;
+    if (fseek(file, (long)block * blockSize, SEEK_SET) != 0) return false;
+    return fwrite(buffer, blockSize, count, file) == count;
+}
+
+bool FileBlockDevice::sync() {
+    return file && fflush(file) == 0;
+}
+
+uint32_t FileBlockDevice::getBlockCount() {
+    return blockCount;
+}
+
+uint16_t FileBlockDevice::getBlockSize() {
+    return blockSize;
+}
+
+bool FileBlockDevice::isReady() {
+    return file != nullptr;
+}
+
+// FatFs diskio driver over BlockDevice
+
+static BlockDevice* diskDevices[FF_VOLUMES];
+
+static DSTATUS blockDiskInit(BYTE pdrv) {
+    BlockDevice* device = diskDevices[pdrv];
+    return device && device->isReady() ? 0 : STA_NOINIT;
+}
+
+static DSTATUS blockDiskStatus(BYTE pdrv) {
+    return blockDiskInit(pdrv);
+}
+
+static DRESULT blockDiskRead(BYTE pdrv, BYTE* buffer, DWORD sector, UINT count) {
+    BlockDevice* device = diskDevices[pdrv];
+    if (!device || !device->isReady()) return RES_NOTRDY;
+    return device->read(sector, buffer, count) ? RES_OK : RES_ERROR;
+}
+
+static DRESULT blockDiskWrite(BYTE pdrv, const BYTE* buffer, DWORD sector, UINT count) {
+    BlockDevice* device = diskDevices[pdrv];
+    if (!device || !device->isReady()) return RES_NOTRDY;
+    return device->write(sector, buffer, count) ? RES_OK : RES_ERROR;
+}
+
+static DRESULT blockDiskIoctl(BYTE pdrv, BYTE cmd, void* buffer) {
+    BlockDevice* device = diskDevices[pdrv];
+    if (!device || !device->isReady()) return RES_NOTRDY;
+
+    switch (cmd) {
+        case CTRL_SYNC:
+            return device->sync() ? RES_OK : RES_ERROR;
+        case GET_SECTOR_COUNT:
+            *(DWORD*)buffer = device->getBlockCount();
+            return RES_OK;
+        case GET_SECTOR_SIZE:
+            *(WORD*)buffer = device->getBlockSize();
+            return RES_OK;
+        case GET_BLOCK_SIZE:
+            *(DWORD*)buffer = 1;
+            return RES_OK;
+    }
+    return RES_PARERR;
+}
+
+static const ff_diskio_impl_t blockDiskio = {
+    blockDiskInit,
+    blockDiskStatus,
+    blockDiskRead,
+    blockDiskWrite,
+    blockDiskIoctl
+};
+
+bool registerBlockDiskio(uint8_t pdrv, BlockDevice* device) {
+    if (pdrv >= FF_VOLUMES) return false;
+
+    diskDevices[pdrv] = device;
+    ff_diskio_register(pdrv, device ? &blockDiskio : NULL);
+    return true;
+}
@@ -0,0 +1,105 @@
+#include "boot_profiler.h"
+#include "memory_policy.h"
+#include "esp_timer.h"
+
+BootProfiler::BootProfiler() {
+    phaseCount = 0;
+    eventCount = 0;
+    startMs = 0;
+    lock = portMUX_INITIALIZER_UNLOCKED;
+}
+
+uint32_t BootProfiler::nowMs() {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+void BootProfiler::begin() {
+    startMs = nowMs();
+    phaseCount = 0;
+    eventCount = 0;
+}
+
+void BootProfiler::mark(const char* phase) {
+    if (phaseCount >= MAX_BOOT_PHASES) return;
+
+    phases[phaseCount].name = phase;
+    phases[phaseCount].timestampMs = nowMs();
+    phaseCount++;
+}
+
+void BootProfiler::event(const char* name) {
+    uint32_t now = nowMs();
+
+    portENTER_CRITICAL(&lock);
+    bool seen = false;
+    for (uint8_t i = 0; i < eventCount; i++) {
+        if (strcmp(events[i].name, name) == 0) {
+            seen = true;
+            break;
+        }
+    }
+    if (!seen && eventCount < MAX_BOOT_EVENTS) {
+        events[eventCount].name = name;
+        events[eventCount].timestampMs = now;
+        eventCount++;
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+bool BootProfiler::hasEvent(const char* name) {
+    return getEventTime(name) != 0;
+}
+
+uint32_t BootProfiler::getEventTime(const char* name) {
+    for (uint8_t i = 0; i < eventCount; i++) {
+        if (strcmp(events[i].name, name) == 0) {
+            return events[i].timestampMs;
+        }
+    }
+    return 0;
+}
+
+String BootProfiler::getReportJSON() {
+    JsonDocument doc(MemoryPolicy::json());
+    doc["setup_start_ms"] = startMs;
+
+    JsonArray list = doc["phases"].to<JsonArray>();
+    uint32_t previous = startMs;
+    for (uint8_t i = 0; i < phaseCount; i++) {
+        JsonObject p = list.add<JsonObject>();
+        p["name"] = phases[i].name;
+        p["at_ms"] = phases[i].timestampMs;
+        p["duration_ms"] = phases[i].timestampMs - previous;
+        previous = phases[i].timestampMs;
+    }
+
+    JsonObject ev = doc["events"].to<JsonObject>();
+    for (uint8_t i = 0; i < eventCount; i++) {
+        ev[events[i].name] = events[i].timestampMs;
+    }
+
+    // The number the fast-boot path is tuned for
+    uint32_t associated = getEventTime("wifi_got_ip");
+    uint32_t firstRequest = getEventTime("first_http_request");
+    uint32_t serverReady = getEventTime("server_started");
+    if (associated && serverReady) {
+        doc["web_ready_after_wifi_ms"] = serverReady > associated ? serverReady - associated : 0;
+    }
+    if (associated && firstRequest) {
+        doc["first_request_after_wifi_ms"] = firstRequest > associated ? firstRequest - associated : 0;
+    }
+
+    String result;
+    serializeJson(doc, result);
+    return result;
+}
+
+void BootProfiler::printReport() {
+    Serial.println("Boot timing:");
+    uint32_t previous = startMs;
+    for (uint8_t i = 0; i < phaseCount; i++) {
+        Serial.printf("  %-20s %6u ms (+%u)\n", phases[i].name, phases[i].timestampMs,
+                      phases[i].timestampMs - previous);
+        previous = phases[i].timestampMs;
+    }
+}
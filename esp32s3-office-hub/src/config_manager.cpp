@@ -1,6 +1,7 @@
 #include "config_manager.h"
+#include "memory_policy.h"
 
-ConfigManager::ConfigManager() : config(4096) {
+ConfigManager::ConfigManager() : config(MemoryPolicy::psram()) {
 }
 
 bool ConfigManager::begin() {
@@ -148,6 +149,78 @@ void ConfigManager::setTemperatureThreshold(float threshold) {
     preferences.putFloat("temp_threshold", threshold);
 }
 
+float ConfigManager::getLowTemperatureThreshold() {
+    return config["alerts"]["low_temperature_threshold"] | 10.0;
+}
+
+void ConfigManager::setLowTemperatureThreshold(float threshold) {
+    config["alerts"]["low_temperature_threshold"] = threshold;
+    preferences.putFloat("temp_low", threshold);
+}
+
+float ConfigManager::getTemperatureHysteresis() {
+    return config["alerts"]["temperature_hysteresis"] | 1.0;
+}
+
+void ConfigManager::setTemperatureHysteresis(float hysteresis) {
+    config["alerts"]["temperature_hysteresis"] = hysteresis;
+    preferences.putFloat("temp_hyst", hysteresis);
+}
+
+unsigned long ConfigManager::getAlertMinDuration() {
+    return config["alerts"]["min_duration"] | 15000;
+}
+
+void ConfigManager::setAlertMinDuration(unsigned long duration) {
+    config["alerts"]["min_duration"] = duration;
+    preferences.putULong("alert_min_dur", duration);
+}
+
+float ConfigManager::getTemperatureRateThreshold() {
+    return config["alerts"]["temperature_rate_threshold"] | 2.0;
+}
+
+void ConfigManager::setTemperatureRateThreshold(float rate) {
+    config["alerts"]["temperature_rate_threshold"] = rate;
+    preferences.putFloat("temp_rate", rate);
+}
+
+bool ConfigManager::getHighTempAlertEnabled() {
+    return config["alerts"]["high_temp_alert"] | true;
+}
+
+void ConfigManager::setHighTempAlertEnabled(bool enabled) {
+    config["alerts"]["high_temp_alert"] = enabled;
+    preferences.putBool("high_temp", enabled);
+}
+
+bool ConfigManager::getLowTempAlertEnabled() {
+    return config["alerts"]["low_temp_alert"] | false;
+}
+
+void ConfigManager::setLowTempAlertEnabled(bool enabled) {
+    config["alerts"]["low_temp_alert"] = enabled;
+    preferences.putBool("low_temp", enabled);
+}
+
+bool ConfigManager::getRateAlertEnabled() {
+    return config["alerts"]["rate_alert"] | false;
+}
+
+void ConfigManager::setRateAlertEnabled(bool enabled) {
+    config["alerts"]["rate_alert"] = enabled;
+    preferences.putBool("rate_alert", enabled);
+}
+
+bool ConfigManager::getWiFiDisconnectAlertEnabled() {
+    return config["alerts"]["wifi_disconnect_alert"] | true;
+}
+
+void ConfigManager::setWiFiDisconnectAlertEnabled(bool enabled) {
+    config["alerts"]["wifi_disconnect_alert"] = enabled;
+    preferences.putBool("wifi_alert", enabled);
+}
+
 unsigned long ConfigManager::getTempLogInterval() {
     return config["logging"]["temp_log_interval"] | 300000;
 }
@@ -165,3 +238,14 @@ void ConfigManager::setWiFiScanInterval(unsigned long interval) {
     config["logging"]["wifi_scan_interval"] = interval;
     preferences.putULong("wifi_interval", interval);
 }
+
+JsonArray ConfigManager::getSchedules() {
+    if (!config["schedules"].is<JsonArray>()) {
+        return config["schedules"].to<JsonArray>();
+    }
+    return config["schedules"].as<JsonArray>();
+}
+
+void ConfigManager::setSchedules(JsonArrayConst schedules) {
+    config["schedules"] = schedules;
+}
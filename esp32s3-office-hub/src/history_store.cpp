@@ -0,0 +1,596 @@
+#include "history_store.h"
+#include "memory_policy.h"
+
+#define INDEX_CHUNK 128         // Index entries read at a time while scanning
+
+enum SegmentUse {
+    SEGMENT_SKIP,
+    SEGMENT_SUMMARY,
+    SEGMENT_DECODE
+};
+
+static size_t putVarint(uint8_t* out, uint64_t value) {
+    size_t n = 0;
+    while (value >= 0x80) {
+        out[n++] = (uint8_t)value | 0x80;
+        value >>= 7;
+    }
+    out[n++] = (uint8_t)value;
+    return n;
+}
+
+static bool getVarint(const uint8_t*& in, const uint8_t* end, uint64_t* value) {
+    *value = 0;
+    for (int shift = 0; in < end && shift < 64; shift += 7) {
+        uint8_t byte = *in++;
+        *value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+static uint64_t zigzag(int64_t value) {
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t unzigzag(uint64_t value) {
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+HistoryStore::~HistoryStore() {
+    if (work) {
+        MemoryPolicy::psram()->deallocate(work);
+    }
+}
+
+bool HistoryStore::begin(USBHostManager* usbManager) {
+    usb = usbManager;
+    lock = xSemaphoreCreateMutex();
+    work = (uint8_t*)MemoryPolicy::psram()->allocate(HISTORY_SEGMENT_MAX_BYTES +
+                                                      HISTORY_SEGMENT_RECORDS * sizeof(HistoryRecord));
+    if (!lock || !work) {
+        Serial.println("History: out of memory");
+        return false;
+    }
+    records = (HistoryRecord*)(work + HISTORY_SEGMENT_MAX_BYTES);
+
+    // SPIFFS has no directories to list, so probe every slot
+    flashCount = 0;
+    for (uint8_t slot = 0; slot < HISTORY_FLASH_SEGMENTS; slot++) {
+        File file = SPIFFS.open(slotPath(slot), "r");
+        if (!file) continue;
+        HistorySegmentHeader header;
+        bool valid = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                     header.magic == HISTORY_SEGMENT_MAGIC;
+        file.close();
+        if (!valid) {
+            Serial.printf("History: discarding unreadable slot %u\n", slot);
+            SPIFFS.remove(slotPath(slot));
+            continue;
+        }
+        flash[flashCount++] = {header, slot};
+    }
+    std::sort(flash, flash + flashCount, [](const FlashSegment& a, const FlashSegment& b) {
+        return a.header.firstTime < b.header.firstTime;
+    });
+    if (flashCount > 0) {
+        nextSlot = (flash[flashCount - 1].slot + 1) % HISTORY_FLASH_SEGMENTS;
+        newestTime = flash[flashCount - 1].header.lastTime;
+    }
+
+    // A reset mid-append can leave part of a record at the end
+    openCount = 0;
+    File open = SPIFFS.open(openPath(), "r");
+    if (open) {
+        size_t size = open.size();
+        size_t whole = min(size / sizeof(HistoryRecord), (size_t)HISTORY_SEGMENT_RECORDS - 1);
+        open.read((uint8_t*)records, whole * sizeof(HistoryRecord));
+        open.close();
+        if (whole * sizeof(HistoryRecord) != size) {
+            File rewrite = SPIFFS.open(openPath(), "w");
+            if (rewrite) {
+                rewrite.write((uint8_t*)records, whole * sizeof(HistoryRecord));
+                rewrite.close();
+            }
+        }
+        openCount = whole;
+        if (whole > 0 && records[whole - 1].time > newestTime) {
+            newestTime = records[whole - 1].time;
+        }
+    }
+
+    Serial.printf("History: %u sealed segments in flash, %u readings in the open segment\n", flashCount, openCount);
+    return true;
+}
+
+String HistoryStore::slotPath(uint8_t slot) {
+    char path[32];
+    snprintf(path, sizeof(path), HISTORY_FLASH_DIR "/s%02u.ths", slot);
+    return path;
+}
+
+String HistoryStore::openPath() {
+    return HISTORY_FLASH_DIR "/open.bin";
+}
+
+// The hub's epoch is already local time, so no further zone conversion
+String HistoryStore::archivePath(uint32_t firstTime) {
+    time_t seconds = firstTime;
+    struct tm timeinfo;
+    gmtime_r(&seconds, &timeinfo);
+    char path[48];
+    snprintf(path, sizeof(path), HISTORY_USB_DIR "/%04d-%02d.ths", timeinfo.tm_year + 1900, timeinfo.tm_mon + 1);
+    return path;
+}
+
+String HistoryStore::indexPath() {
+    return HISTORY_USB_DIR "/index.thi";
+}
+
+void HistoryStore::append(uint32_t time, float temperature) {
+    if (time == 0) {
+        stats.unclocked++;
+        return;
+    }
+    if (!lock) return;
+
+    float scaled = roundf(temperature * 100.0f);
+    int16_t value = scaled > INT16_MAX ? INT16_MAX : scaled < INT16_MIN ? INT16_MIN : (int16_t)scaled;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    pending[pendingCount++] = {time, value};
+    newestTime = time;
+    stats.records++;
+    if (openCount + pendingCount >= HISTORY_SEGMENT_RECORDS) {
+        seal();
+    } else if (pendingCount == HISTORY_FLUSH_RECORDS) {
+        flushPending();
+    }
+    xSemaphoreGive(lock);
+}
+
+void HistoryStore::flush() {
+    if (!lock) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    flushPending();
+    xSemaphoreGive(lock);
+}
+
+// Caller holds lock. Readings that cannot be written are dropped so the
+// RAM batch never overflows.
+void HistoryStore::flushPending() {
+    if (pendingCount == 0) return;
+
+    File file = SPIFFS.open(openPath(), "a");
+    size_t bytes = pendingCount * sizeof(HistoryRecord);
+    if (!file || file.write((uint8_t*)pending, bytes) != bytes) {
+        Serial.printf("History: cannot append to the open segment, %u readings lost\n", pendingCount);
+    } else {
+        openCount += pendingCount;
+        stats.flashBytes += bytes;
+    }
+    if (file) file.close();
+    pendingCount = 0;
+}
+
+// Caller holds lock
+bool HistoryStore::seal() {
+    size_t count = 0;
+    if (openCount > 0) {
+        File file = SPIFFS.open(openPath(), "r");
+        if (file) {
+            count = file.read((uint8_t*)records, openCount * sizeof(HistoryRecord)) / sizeof(HistoryRecord);
+            file.close();
+        }
+    }
+    memcpy(records + count, pending, pendingCount * sizeof(HistoryRecord));
+    count += pendingCount;
+
+    size_t length = encode(records, count, work);
+    bool ok = writeSlot(work, length);
+    if (ok) {
+        stats.sealed++;
+        stats.rawBytes += count * sizeof(HistoryRecord);
+        stats.sealedBytes += length;
+    }
+    SPIFFS.remove(openPath());
+    openCount = 0;
+    pendingCount = 0;
+    return ok;
+}
+
+// Caller holds lock. Without a stick to drain it the ring overwrites its oldest segment.
+bool HistoryStore::writeSlot(const uint8_t* data, size_t length) {
+    if (flashCount == HISTORY_FLASH_SEGMENTS) {
+        Serial.printf("History: flash full, dropping the segment from %u\n", flash[0].header.firstTime);
+        SPIFFS.remove(slotPath(flash[0].slot));
+        memmove(flash, flash + 1, --flashCount * sizeof(FlashSegment));
+        stats.dropped++;
+    }
+
+    uint8_t slot = nextSlot;
+    File file = SPIFFS.open(slotPath(slot), "w");
+    if (!file || file.write(data, length) != length) {
+        if (file) file.close();
+        SPIFFS.remove(slotPath(slot));
+        Serial.println("History: cannot write a sealed segment to flash");
+        return false;
+    }
+    file.close();
+
+    flash[flashCount++] = {*(const HistorySegmentHeader*)data, slot};
+    nextSlot = (slot + 1) % HISTORY_FLASH_SEGMENTS;
+    stats.flashBytes += length;
+    return true;
+}
+
+// Caller holds lock; the segment lands in work
+bool HistoryStore::readSlot(uint8_t index, size_t* length) {
+    File file = SPIFFS.open(slotPath(flash[index].slot), "r");
+    if (!file) return false;
+    *length = file.read(work, HISTORY_SEGMENT_MAX_BYTES);
+    file.close();
+    return *length == sizeof(HistorySegmentHeader) + flash[index].header.payloadBytes;
+}
+
+void HistoryStore::archive() {
+    if (!lock || !usb || !usb->isMounted() || flashCount == 0) return;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (usb->createDirectory(HISTORY_USB_DIR)) {
+        for (int i = 0; i < HISTORY_ARCHIVE_BATCH && flashCount > 0; i++) {
+            if (!archiveOne()) break;
+        }
+    }
+    xSemaphoreGive(lock);
+}
+
+// Caller holds lock. Segment data goes out before its index entry, and the
+// flash copy is removed last, so an interruption at any point leaves either
+// a retry or an index entry to recognise on the next attempt.
+bool HistoryStore::archiveOne() {
+    const HistorySegmentHeader& header = flash[0].header;
+    size_t length;
+    if (!readSlot(0, &length)) {
+        Serial.printf("History: slot %u is unreadable, discarding it\n", flash[0].slot);
+        stats.corrupt++;
+    } else {
+        uint32_t count = readIndexCount();
+        HistoryIndexEntry last;
+        bool archived = count > 0 && readIndex(count - 1, &last, 1) &&
+                        last.header.firstTime == header.firstTime && last.header.count == header.count;
+
+        if (!archived) {
+            String path = archivePath(header.firstTime);
+            uint64_t size = 0;
+            bool directory;
+            usb->statFile(path, &size, &directory);
+
+            HistoryIndexEntry entry = {header, (uint32_t)size};
+            if (!usb->writeFileAt(path, size, work, length) ||
+                !usb->writeFileAt(indexPath(), (uint64_t)count * sizeof(entry), (const uint8_t*)&entry, sizeof(entry))) {
+                return false;
+            }
+            stats.usbBytes += length + sizeof(entry);
+        }
+        stats.archived++;
+    }
+
+    SPIFFS.remove(slotPath(flash[0].slot));
+    memmove(flash, flash + 1, --flashCount * sizeof(FlashSegment));
+    return true;
+}
+
+// A torn entry at the end is ignored and overwritten by the next append
+uint32_t HistoryStore::readIndexCount() {
+    uint64_t size = 0;
+    bool directory;
+    if (!usb->statFile(indexPath(), &size, &directory)) return 0;
+    return size / sizeof(HistoryIndexEntry);
+}
+
+bool HistoryStore::readIndex(uint32_t first, HistoryIndexEntry* entries, uint32_t count) {
+    size_t bytes = count * sizeof(HistoryIndexEntry);
+    size_t read = 0;
+    return usb->readFileAt(indexPath(), (uint64_t)first * sizeof(HistoryIndexEntry), (uint8_t*)entries, bytes, &read) &&
+           read == bytes;
+}
+
+bool HistoryStore::query(JsonDocument& doc, uint32_t from, uint32_t to, uint32_t step) {
+    if (!lock || to < from) return false;
+    uint64_t span = (uint64_t)to - from + 1;
+    if (step == 0) {
+        step = (span + HISTORY_QUERY_POINTS - 1) / HISTORY_QUERY_POINTS;
+    }
+    if ((span + step - 1) / step > HISTORY_QUERY_MAX_POINTS) return false;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    doc["from"] = from;
+    doc["to"] = to;
+    doc["step"] = step;
+    beginQuery(doc.createNestedArray("points"), from, to, step);
+
+    // Oldest tier first: archiving moves segments off flash oldest first
+    JsonObject sources = doc.createNestedObject("sources");
+    queryUsb();
+    sources["usb_decoded"] = decoded;
+    sources["usb_summarized"] = summarized;
+    decoded = summarized = 0;
+    queryFlash();
+    sources["flash_decoded"] = decoded;
+    sources["flash_summarized"] = summarized;
+    sources["recent"] = queryRecent();
+    emitBucket();
+    xSemaphoreGive(lock);
+    return true;
+}
+
+void HistoryStore::beginQuery(JsonArray target, uint32_t from, uint32_t to, uint32_t step) {
+    points = target;
+    queryFrom = from;
+    queryTo = to;
+    queryStep = step;
+    bucketIndex = 0;
+    lastAdded = 0;
+    bucket = {};
+    decoded = 0;
+    summarized = 0;
+}
+
+void HistoryStore::addRecord(uint32_t time, int16_t value) {
+    if (time < queryFrom || time > queryTo || time <= lastAdded) return;
+    lastAdded = time;
+
+    uint32_t index = (time - queryFrom) / queryStep;
+    if (index != bucketIndex) {
+        emitBucket();
+        bucketIndex = index;
+    }
+    if (bucket.count == 0 || value < bucket.minValue) bucket.minValue = value;
+    if (bucket.count == 0 || value > bucket.maxValue) bucket.maxValue = value;
+    bucket.sum += value;
+    bucket.count++;
+}
+
+// The header's rounded mean stands in for the sum, within half a hundredth
+void HistoryStore::addSummary(const HistorySegmentHeader& header) {
+    uint32_t index = (header.firstTime - queryFrom) / queryStep;
+    if (index != bucketIndex) {
+        emitBucket();
+        bucketIndex = index;
+    }
+    if (bucket.count == 0 || header.minValue < bucket.minValue) bucket.minValue = header.minValue;
+    if (bucket.count == 0 || header.maxValue > bucket.maxValue) bucket.maxValue = header.maxValue;
+    bucket.sum += (int64_t)header.meanValue * header.count;
+    bucket.count += header.count;
+    lastAdded = header.lastTime;
+    summarized++;
+}
+
+void HistoryStore::emitBucket() {
+    if (bucket.count == 0) return;
+    JsonObject point = points.createNestedObject();
+    point["time"] = queryFrom + bucketIndex * queryStep;
+    point["temp"] = roundf((float)bucket.sum / bucket.count) / 100.0f;
+    point["min"] = bucket.minValue / 100.0f;
+    point["max"] = bucket.maxValue / 100.0f;
+    point["count"] = bucket.count;
+    bucket = {};
+}
+
+int HistoryStore::classify(const HistorySegmentHeader& header) {
+    if (header.lastTime < queryFrom || header.firstTime > queryTo || header.lastTime <= lastAdded) {
+        return SEGMENT_SKIP;
+    }
+    bool inside = header.firstTime >= queryFrom && header.lastTime <= queryTo && header.firstTime > lastAdded;
+    if (inside && (header.firstTime - queryFrom) / queryStep == (header.lastTime - queryFrom) / queryStep) {
+        return SEGMENT_SUMMARY;
+    }
+    return SEGMENT_DECODE;
+}
+
+bool HistoryStore::addSegment(const uint8_t* data, size_t length) {
+    bool ok = decode(data, length, [this](uint32_t time, int16_t value) {
+        addRecord(time, value);
+    });
+    if (ok) {
+        decoded++;
+    } else {
+        stats.corrupt++;
+    }
+    return ok;
+}
+
+// Binary search for the first entry that reaches from, then a forward scan
+// in chunks until entries start after to
+void HistoryStore::queryUsb() {
+    if (!usb || !usb->isMounted()) return;
+    uint32_t count = readIndexCount();
+    HistoryIndexEntry* entries = (HistoryIndexEntry*)records;
+
+    uint32_t low = 0;
+    uint32_t high = count;
+    while (low < high) {
+        uint32_t middle = (low + high) / 2;
+        if (!readIndex(middle, entries, 1)) return;
+        if (entries[0].header.lastTime < queryFrom) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    for (uint32_t first = low; first < count;) {
+        uint32_t chunk = min(count - first, (uint32_t)INDEX_CHUNK);
+        if (!readIndex(first, entries, chunk)) return;
+        for (uint32_t i = 0; i < chunk; i++) {
+            const HistoryIndexEntry& entry = entries[i];
+            if (entry.header.firstTime > queryTo) return;
+
+            int use = classify(entry.header);
+            if (use == SEGMENT_SUMMARY) {
+                addSummary(entry.header);
+            } else if (use == SEGMENT_DECODE) {
+                size_t length = sizeof(HistorySegmentHeader) + entry.header.payloadBytes;
+                size_t read = 0;
+                if (length <= HISTORY_SEGMENT_MAX_BYTES &&
+                    usb->readFileAt(archivePath(entry.header.firstTime), entry.offset, work, length, &read) &&
+                    read == length) {
+                    addSegment(work, length);
+                } else {
+                    stats.corrupt++;
+                }
+            }
+        }
+        first += chunk;
+    }
+}
+
+void HistoryStore::queryFlash() {
+    for (uint8_t i = 0; i < flashCount; i++) {
+        int use = classify(flash[i].header);
+        size_t length;
+        if (use == SEGMENT_SUMMARY) {
+            addSummary(flash[i].header);
+        } else if (use == SEGMENT_DECODE && readSlot(i, &length)) {
+            addSegment(work, length);
+        }
+    }
+}
+
+uint32_t HistoryStore::queryRecent() {
+    size_t count = 0;
+    if (openCount > 0) {
+        File file = SPIFFS.open(openPath(), "r");
+        if (file) {
+            count = file.read((uint8_t*)records, openCount * sizeof(HistoryRecord)) / sizeof(HistoryRecord);
+            file.close();
+        }
+    }
+    for (size_t i = 0; i < count; i++) {
+        addRecord(records[i].time, records[i].value);
+    }
+    for (uint16_t i = 0; i < pendingCount; i++) {
+        addRecord(pending[i].time, pending[i].value);
+    }
+    return count + pendingCount;
+}
+
+uint32_t HistoryStore::getNewestTime() {
+    return newestTime;
+}
+
+const HistoryStats& HistoryStore::getStats() {
+    return stats;
+}
+
+String HistoryStore::getStatusJSON() {
+    JsonDocument doc(MemoryPolicy::json());
+    if (lock) {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        uint32_t flashBytes = 0;
+        for (uint8_t i = 0; i < flashCount; i++) {
+            flashBytes += sizeof(HistorySegmentHeader) + flash[i].header.payloadBytes;
+        }
+        doc["newest"] = newestTime;
+        doc["recent"] = openCount + pendingCount;
+
+        JsonObject flashTier = doc.createNestedObject("flash");
+        flashTier["segments"] = flashCount;
+        flashTier["capacity"] = HISTORY_FLASH_SEGMENTS;
+        flashTier["bytes"] = flashBytes;
+        flashTier["oldest"] = flashCount ? flash[0].header.firstTime : 0;
+
+        JsonObject usbTier = doc.createNestedObject("usb");
+        bool mounted = usb && usb->isMounted();
+        usbTier["mounted"] = mounted;
+        uint32_t archived = mounted ? readIndexCount() : 0;
+        HistoryIndexEntry oldest;
+        usbTier["segments"] = archived;
+        usbTier["oldest"] = archived && readIndex(0, &oldest, 1) ? oldest.header.firstTime : 0;
+        xSemaphoreGive(lock);
+    }
+
+    JsonObject counters = doc.createNestedObject("stats");
+    counters["records"] = stats.records;
+    counters["unclocked"] = stats.unclocked;
+    counters["sealed"] = stats.sealed;
+    counters["archived"] = stats.archived;
+    counters["dropped"] = stats.dropped;
+    counters["corrupt"] = stats.corrupt;
+    counters["flash_bytes"] = stats.flashBytes;
+    counters["usb_bytes"] = stats.usbBytes;
+    counters["compression"] = stats.sealedBytes ? (float)stats.rawBytes / stats.sealedBytes : 0.0f;
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+
+size_t HistoryStore::encode(const HistoryRecord* input, uint16_t count, uint8_t* out) {
+    HistorySegmentHeader header = {};
+    header.magic = HISTORY_SEGMENT_MAGIC;
+    header.count = count;
+    if (count > 0) {
+        header.firstTime = input[0].time;
+        header.lastTime = input[count - 1].time;
+        header.firstValue = header.minValue = header.maxValue = input[0].value;
+    }
+
+    uint8_t* payload = out + sizeof(header);
+    size_t length = 0;
+    int64_t sum = count > 0 ? input[0].value : 0;
+    int64_t previousStep = 0;
+    for (uint16_t i = 1; i < count; i++) {
+        int64_t step = (int64_t)input[i].time - input[i - 1].time;
+        length += putVarint(payload + length, zigzag(step - previousStep));
+        length += putVarint(payload + length, zigzag((int64_t)input[i].value - input[i - 1].value));
+        previousStep = step;
+
+        sum += input[i].value;
+        if (input[i].value < header.minValue) header.minValue = input[i].value;
+        if (input[i].value > header.maxValue) header.maxValue = input[i].value;
+    }
+    header.meanValue = count > 0 ? (int16_t)lroundf((float)sum / count) : 0;
+    header.payloadBytes = length;
+    header.checksum = checksum(payload, length);
+    memcpy(out, &header, sizeof(header));
+    return sizeof(header) + length;
+}
+
+bool HistoryStore::decode(const uint8_t* data, size_t length, std::function<void(uint32_t, int16_t)> fn) {
+    HistorySegmentHeader header;
+    if (length < sizeof(header)) return false;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != HISTORY_SEGMENT_MAGIC || sizeof(header) + header.payloadBytes > length || header.count == 0) {
+        return false;
+    }
+    const uint8_t* in = data + sizeof(header);
+    const uint8_t* end = in + header.payloadBytes;
+    if (checksum(in, header.payloadBytes) != header.checksum) return false;
+
+    int64_t time = header.firstTime;
+    int64_t value = header.firstValue;
+    int64_t step = 0;
+    fn(time, value);
+    for (uint16_t i = 1; i < header.count; i++) {
+        uint64_t stepDelta;
+        uint64_t valueDelta;
+        if (!getVarint(in, end, &stepDelta) || !getVarint(in, end, &valueDelta)) return false;
+        step += unzigzag(stepDelta);
+        time += step;
+        value += unzigzag(valueDelta);
+        fn((uint32_t)time, (int16_t)value);
+    }
+    return in == end;
+}
+
+uint16_t HistoryStore::checksum(const uint8_t* data, size_t length) {
+    uint16_t sum1 = 0;
+    uint16_t sum2 = 0;
+    for (size_t i = 0; i < length; i++) {
+        sum1 = (sum1 + data[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    return sum2 << 8 | sum1;
+}
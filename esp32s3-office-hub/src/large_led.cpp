@@ -0,0 +1,151 @@
+#include "large_led.h"
+#include <math.h>
+
+LargeLed::LargeLed(uint8_t gpio) {
+    pin = gpio;
+    ready = false;
+    brightness = 0;
+    fading = false;
+    requestLock = portMUX_INITIALIZER_UNLOCKED;
+    pendingFade = false;
+    pendingBrightness = 0;
+    pendingFadeMs = 0;
+    fadeEnded = false;
+}
+
+bool LargeLed::begin() {
+    ledc_timer_config_t timer = {};
+    timer.speed_mode = LARGE_LED_LEDC_MODE;
+    timer.duty_resolution = (ledc_timer_bit_t)LARGE_LED_PWM_BITS;
+    timer.timer_num = LARGE_LED_LEDC_TIMER;
+    timer.freq_hz = LARGE_LED_PWM_FREQ;
+    timer.clk_cfg = LEDC_AUTO_CLK;
+    if (ledc_timer_config(&timer) != ESP_OK) {
+        Serial.println("Failed to configure LEDC timer for large LED");
+        return false;
+    }
+
+    ledc_channel_config_t channel = {};
+    channel.gpio_num = pin;
+    channel.speed_mode = LARGE_LED_LEDC_MODE;
+    channel.channel = LARGE_LED_LEDC_CHANNEL;
+    channel.intr_type = LEDC_INTR_DISABLE;
+    channel.timer_sel = LARGE_LED_LEDC_TIMER;
+    channel.duty = 0;
+    channel.hpoint = 0;
+    if (ledc_channel_config(&channel) != ESP_OK) {
+        Serial.println("Failed to configure LEDC channel for large LED");
+        return false;
+    }
+
+    // The fade service may already be installed by another driver
+    esp_err_t err = ledc_fade_func_install(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        Serial.printf("Failed to install LEDC fade service: %d\n", err);
+        return false;
+    }
+
+    ledc_cbs_t callbacks = {};
+    callbacks.fade_cb = onFadeEndISR;
+    ledc_cb_register(LARGE_LED_LEDC_MODE, LARGE_LED_LEDC_CHANNEL, &callbacks, this);
+
+    ready = true;
+    Serial.printf("Large LED on GPIO%d: %d-bit LEDC at %d Hz with hardware fades\n",
+                  pin, LARGE_LED_PWM_BITS, LARGE_LED_PWM_FREQ);
+    return true;
+}
+
+bool IRAM_ATTR LargeLed::onFadeEndISR(const ledc_cb_param_t* param, void* arg) {
+    if (param->event == LEDC_FADE_END_EVT) {
+        ((LargeLed*)arg)->fadeEnded = true;
+    }
+    return false;
+}
+
+void LargeLed::update() {
+    bool ended = fadeEnded;
+    if (ended) {
+        fadeEnded = false;
+        fading = false;
+    }
+    // ledc_set_fade_with_time blocks until a running fade ends, so a new target waits
+    if (fading) return;
+
+    // Only the newest target matters; intermediate slider positions are dropped
+    bool start = false;
+    uint8_t target = 0;
+    uint32_t fadeMs = 0;
+    portENTER_CRITICAL(&requestLock);
+    if (pendingFade) {
+        pendingFade = false;
+        start = true;
+        target = pendingBrightness;
+        fadeMs = pendingFadeMs;
+    }
+    portEXIT_CRITICAL(&requestLock);
+
+    if (start) {
+        startFade(target, fadeMs);
+        return;
+    }
+
+    if (ended && fadeCallback) {
+        fadeCallback(brightness);
+    }
+}
+
+void LargeLed::fadeTo(uint8_t target, uint32_t fadeMs) {
+    if (!ready) return;
+
+    portENTER_CRITICAL(&requestLock);
+    pendingFade = true;
+    pendingBrightness = target;
+    pendingFadeMs = fadeMs;
+    portEXIT_CRITICAL(&requestLock);
+}
+
+void LargeLed::startFade(uint8_t target, uint32_t fadeMs) {
+    uint32_t duty = brightnessToDuty(target);
+    brightness = target;
+
+    if (fadeMs == 0 || duty == ledc_get_duty(LARGE_LED_LEDC_MODE, LARGE_LED_LEDC_CHANNEL)) {
+        ledc_set_duty_and_update(LARGE_LED_LEDC_MODE, LARGE_LED_LEDC_CHANNEL, duty, 0);
+        if (fadeCallback) fadeCallback(brightness);
+        return;
+    }
+
+    if (ledc_set_fade_with_time(LARGE_LED_LEDC_MODE, LARGE_LED_LEDC_CHANNEL, duty, fadeMs) != ESP_OK ||
+        ledc_fade_start(LARGE_LED_LEDC_MODE, LARGE_LED_LEDC_CHANNEL, LEDC_FADE_NO_WAIT) != ESP_OK) {
+        Serial.println("LEDC fade failed, setting large LED duty directly");
+        ledc_set_duty_and_update(LARGE_LED_LEDC_MODE, LARGE_LED_LEDC_CHANNEL, duty, 0);
+        return;
+    }
+    fading = true;
+}
+
+uint8_t LargeLed::getBrightness() {
+    portENTER_CRITICAL(&requestLock);
+    uint8_t result = pendingFade ? pendingBrightness : brightness;
+    portEXIT_CRITICAL(&requestLock);
+    return result;
+}
+
+uint32_t LargeLed::getDuty() {
+    return ready ? ledc_get_duty(LARGE_LED_LEDC_MODE, LARGE_LED_LEDC_CHANNEL) : 0;
+}
+
+bool LargeLed::isFading() {
+    return fading;
+}
+
+void LargeLed::onFadeComplete(LargeLedFadeCallback callback) {
+    fadeCallback = callback;
+}
+
+uint32_t LargeLed::brightnessToDuty(uint8_t value) {
+    // Gamma is applied at full PWM resolution so the low end keeps distinct steps
+    if (value == 0) return 0;
+    float linear = powf(value / 255.0f, LARGE_LED_GAMMA);
+    uint32_t duty = (uint32_t)(linear * LARGE_LED_MAX_DUTY + 0.5f);
+    return duty > 0 ? duty : 1;
+}
@@ -0,0 +1,205 @@
+#include "led_compositor.h"
+#include "led_effects.h"
+#include "memory_policy.h"
+
+LedCompositor::LedCompositor() {
+    output = nullptr;
+    length = 0;
+    segmentCount = 0;
+    lastHash = 0;
+    forceShow = true;
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        layers[i].visible = i == LAYER_BASE;
+        layers[i].opacity = 255;
+    }
+    resetStats();
+}
+
+void LedCompositor::begin(CRGB* frame, uint16_t count) {
+    output = frame;
+    length = count > NUM_RGB_LEDS ? NUM_RGB_LEDS : count;
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        fillLayer((LedLayerId)i, CRGB::Black);
+    }
+    forceShow = true;
+    resetStats();
+}
+
+CRGB* LedCompositor::getLayer(LedLayerId id) {
+    return layers[id].pixels;
+}
+
+void LedCompositor::setLayerVisible(LedLayerId id, bool visible) {
+    layers[id].visible = visible;
+}
+
+bool LedCompositor::isLayerVisible(LedLayerId id) {
+    return layers[id].visible;
+}
+
+void LedCompositor::setLayerOpacity(LedLayerId id, uint8_t opacity) {
+    layers[id].opacity = opacity;
+}
+
+void LedCompositor::fillLayer(LedLayerId id, const CRGB& color) {
+    CRGB* pixels = layers[id].pixels;
+    for (uint16_t i = 0; i < length; i++) {
+        pixels[i] = color;
+    }
+}
+
+void LedCompositor::fillSegment(LedLayerId id, int segment, const CRGB& color) {
+    if (segment < 0 || segment >= segmentCount) return;
+    CRGB* pixels = layers[id].pixels + segments[segment].start;
+    for (uint16_t i = 0; i < segments[segment].count; i++) {
+        pixels[i] = color;
+    }
+}
+
+int LedCompositor::addSegment(const char* name, uint16_t start, uint16_t count) {
+    if (segmentCount >= MAX_LED_SEGMENTS || start >= length) {
+        Serial.printf("Cannot add LED segment %s\n", name);
+        return -1;
+    }
+    if (start + count > length) count = length - start;
+
+    LedSegment& segment = segments[segmentCount];
+    strlcpy(segment.name, name, sizeof(segment.name));
+    segment.start = start;
+    segment.count = count;
+    return segmentCount++;
+}
+
+int LedCompositor::findSegment(const String& name) {
+    for (int i = 0; i < segmentCount; i++) {
+        if (name == segments[i].name) return i;
+    }
+    return -1;
+}
+
+const LedSegment* LedCompositor::getSegment(int index) {
+    if (index < 0 || index >= segmentCount) return nullptr;
+    return &segments[index];
+}
+
+uint8_t LedCompositor::getSegmentCount() {
+    return segmentCount;
+}
+
+void LedCompositor::compose() {
+    const CRGB* base = layers[LAYER_BASE].pixels;
+    for (uint16_t i = 0; i < length; i++) {
+        output[i] = base[i];
+    }
+
+    for (int id = LAYER_BASE + 1; id < LAYER_COUNT; id++) {
+        const LedLayer& layer = layers[id];
+        if (!layer.visible || layer.opacity == 0) continue;
+
+        for (uint16_t i = 0; i < length; i++) {
+            const CRGB& pixel = layer.pixels[i];
+            if (!pixel.r && !pixel.g && !pixel.b) continue;
+            output[i] = layer.opacity == 255 ? pixel : LedEffects::blend(output[i], pixel, layer.opacity);
+        }
+    }
+}
+
+bool LedCompositor::present() {
+    return present(micros());
+}
+
+bool LedCompositor::present(unsigned long frameStartUs) {
+    if (!output) return false;
+    compose();
+
+    // A hash collision would drop a single frame, the next change shows it
+    uint32_t hash = hashFrame(output, length);
+
+    uint32_t elapsed = micros() - frameStartUs;
+    stats.frames++;
+    stats.lastComposeUs = elapsed;
+    stats.totalComposeUs += elapsed;
+    if (elapsed > stats.maxComposeUs) stats.maxComposeUs = elapsed;
+
+    if (hash == lastHash && !forceShow) {
+        stats.skipped++;
+        return false;
+    }
+
+    unsigned long start = micros();
+    FastLED.show();
+    stats.totalShowUs += micros() - start;
+    stats.shown++;
+    lastHash = hash;
+    forceShow = false;
+    return true;
+}
+
+void LedCompositor::invalidate() {
+    forceShow = true;
+}
+
+uint16_t LedCompositor::getLength() {
+    return length;
+}
+
+uint32_t LedCompositor::hashFrame(const CRGB* pixels, uint16_t count) {
+    // FNV-1a over the raw bytes
+    const uint8_t* bytes = (const uint8_t*)pixels;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < (size_t)count * sizeof(CRGB); i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+const CompositorStats& LedCompositor::getStats() {
+    return stats;
+}
+
+void LedCompositor::resetStats() {
+    memset(&stats, 0, sizeof(stats));
+    stats.startTime = millis();
+}
+
+float LedCompositor::getFramesPerSecond() {
+    unsigned long elapsed = millis() - stats.startTime;
+    return elapsed > 0 ? stats.frames * 1000.0f / elapsed : 0;
+}
+
+float LedCompositor::getCpuPercent(uint16_t targetFps) {
+    // Share of one core spent composing at the target rate; show() waits on the RMT
+    if (stats.frames == 0) return 0;
+    float averageUs = (float)stats.totalComposeUs / stats.frames;
+    return averageUs * targetFps / 10000.0f;
+}
+
+void LedCompositor::writeStats(JsonObject doc) {
+    doc["pixels"] = length;
+    doc["frames"] = stats.frames;
+    doc["shown"] = stats.shown;
+    doc["skipped"] = stats.skipped;
+    doc["fps"] = getFramesPerSecond();
+    doc["compose_us"] = stats.frames ? (uint32_t)(stats.totalComposeUs / stats.frames) : 0;
+    doc["compose_max_us"] = stats.maxComposeUs;
+    doc["show_us"] = stats.shown ? (uint32_t)(stats.totalShowUs / stats.shown) : 0;
+    doc["wire_us"] = (uint32_t)length * LED_WIRE_US_PER_PIXEL + LED_LATCH_US;
+
+    JsonArray zones = doc["segments"].to<JsonArray>();
+    for (int i = 0; i < segmentCount; i++) {
+        JsonObject zone = zones.add<JsonObject>();
+        zone["name"] = segments[i].name;
+        zone["start"] = segments[i].start;
+        zone["count"] = segments[i].count;
+    }
+}
+
+String LedCompositor::getStatsJSON() {
+    JsonDocument doc(MemoryPolicy::json());
+    writeStats(doc.to<JsonObject>());
+
+    String result;
+    serializeJson(doc, result);
+    return result;
+}
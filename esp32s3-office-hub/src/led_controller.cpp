@@ -1,17 +1,32 @@
 #include "led_controller.h"
+#include "memory_policy.h"
 
-LEDController::LEDController() {
+// Logical zones along the strip; the last pixels carry the status indicator
+static const LedSegment defaultZones[] = {
+    {"desk", 0, 150},
+    {"shelf", 150, 140},
+    {"status", 290, 10},
+};
+
+LEDController::LEDController() : largeLed(LARGE_LED_PIN) {
     largeLedState = false;
     largeLedBrightness = 255;
     rgbBrightness = 128;
     currentMode = SOLID;
     currentColor = CRGB::Red;
-    hue = 0;
-    breathingBrightness = 0;
-    breathingDirection = 1;
-    blinkState = false;
+    modeStartTime = 0;
     lastUpdate = 0;
-    modeUpdateInterval = 50;
+    modeUpdateInterval = LED_FRAME_INTERVAL_MS;
+    overlayActive = false;
+    overlayColor = CRGB::Black;
+    overlayStartTime = 0;
+    statusSegment = -1;
+    sequenceQueue = NULL;
+    for (int i = 0; i < MAX_LED_SEGMENTS; i++) {
+        zones[i].mode = currentMode;
+        zones[i].color = currentColor;
+        zones[i].startTime = 0;
+    }
 }
 
 bool LEDController::begin() {
@@ -21,9 +36,24 @@ bool LEDController::begin() {
     FastLED.clear();
     FastLED.show();
     
-    // Initialize large LED pin
-    pinMode(LARGE_LED_PIN, OUTPUT);
-    analogWrite(LARGE_LED_PIN, largeLedState ? largeLedBrightness : 0);
+    compositor.begin(rgbLeds, NUM_RGB_LEDS);
+    for (const LedSegment& zone : defaultZones) {
+        compositor.addSegment(zone.name, zone.start, zone.count);
+    }
+    statusSegment = compositor.findSegment("status");
+    
+    sequenceQueue = xQueueCreate(4, sizeof(LedSeqRequest));
+    if (!sequenceQueue) {
+        Serial.println("Failed to create LED sequence queue");
+        return false;
+    }
+    
+    // Large LED dims on the LEDC fade engine
+    if (!largeLed.begin()) {
+        Serial.println("WARNING: Large LED unavailable");
+    } else if (largeLedState) {
+        largeLed.fadeTo(largeLedBrightness, 0);
+    }
     
     // Initialize onboard LED
     pinMode(ONBOARD_LED, OUTPUT);
@@ -34,44 +64,116 @@ bool LEDController::begin() {
 }
 
 void LEDController::update() {
-    if (millis() - lastUpdate >= modeUpdateInterval) {
-        switch (currentMode) {
-            case SOLID:
-                updateSolidMode();
-                break;
-            case BLINK:
-                updateBlinkMode();
-                break;
-            case PULSE:
-                updatePulseMode();
-                break;
-            case RAINBOW:
-                updateRainbowMode();
-                break;
-            case BREATHING:
-                updateBreathingMode();
-                break;
-            case FADE:
-                updateFadeMode();
-                break;
+    largeLed.update();
+    
+    unsigned long now = millis();
+    if (now - lastUpdate < modeUpdateInterval) return;
+    lastUpdate = now;
+    
+    // Frames are sampled from the effect's timeline, so late ticks don't slow it down
+    processSequenceRequests();
+    
+    unsigned long frameStart = micros();
+    if (sequence.isPlaying()) {
+        sequence.render(now, compositor, LAYER_BASE);
+    } else {
+        renderBaseLayer(now);
+    }
+    compositor.setLayerVisible(LAYER_ALERT, overlayActive && LedEffects::overlayVisible(now - overlayStartTime));
+    
+    // Static frames (solid colour, no blinking overlay) never reach the RMT
+    compositor.present(frameStart);
+}
+
+void LEDController::renderBaseLayer(unsigned long now) {
+    CRGB* base = compositor.getLayer(LAYER_BASE);
+    
+    for (int z = 0; z < compositor.getSegmentCount(); z++) {
+        const LedSegment* segment = compositor.getSegment(z);
+        const LedZoneState& zone = zones[z];
+        uint32_t elapsed = now - zone.startTime;
+        
+        if (zone.mode != RAINBOW) {
+            compositor.fillSegment(LAYER_BASE, z, renderMode(zone.mode, elapsed, zone.color));
+            continue;
+        }
+        
+        // Spread one full hue cycle along the zone so the rainbow travels
+        for (uint16_t i = 0; i < segment->count; i++) {
+            uint32_t offset = (uint32_t)i * EFFECT_RAINBOW_PERIOD_MS / segment->count;
+            base[segment->start + i] = renderMode(RAINBOW, elapsed + offset, zone.color);
         }
-        lastUpdate = millis();
     }
 }
 
-void LEDController::setRGBColor(uint8_t r, uint8_t g, uint8_t b) {
-    currentColor = CRGB(r, g, b);
-    if (currentMode == SOLID) {
-        rgbLeds[0] = currentColor;
-        FastLED.show();
+void LEDController::processSequenceRequests() {
+    if (!sequenceQueue) return;
+    
+    LedSeqRequest request;
+    while (xQueueReceive(sequenceQueue, &request, 0) == pdTRUE) {
+        if (request.name[0] == '\0') {
+            stopSequence();
+            continue;
+        }
+        String error;
+        if (!playSequence(request.name, error)) {
+            Serial.printf("Cannot play LED sequence %s: %s\n", request.name, error.c_str());
+        }
     }
 }
 
+bool LEDController::playSequence(const String& name, String& error) {
+    if (!sequence.loadFile(name, error)) return false;
+    
+    compositor.fillLayer(LAYER_BASE, CRGB::Black);
+    sequence.start(millis());
+    Serial.printf("Playing LED sequence %s (%u bytes)\n", name.c_str(), sequence.getSize());
+    return true;
+}
+
+bool LEDController::requestSequence(const String& name) {
+    if (!sequenceQueue || name.length() > LEDSEQ_NAME_LEN) return false;
+    
+    LedSeqRequest request;
+    strlcpy(request.name, name.c_str(), sizeof(request.name));
+    return xQueueSend(sequenceQueue, &request, 0) == pdTRUE;
+}
+
+void LEDController::stopSequence() {
+    sequence.stop();
+}
+
+bool LEDController::isSequencePlaying() {
+    return sequence.isPlaying();
+}
+
+void LEDController::fillStrip(const CRGB& color) {
+    for (int i = 0; i < NUM_RGB_LEDS; i++) {
+        rgbLeds[i] = color;
+    }
+}
+
+CRGB LEDController::renderMode(LEDMode mode, uint32_t elapsedMs, const CRGB& color) {
+    switch (mode) {
+        case BLINK: return LedEffects::blink(elapsedMs, color);
+        case PULSE: return LedEffects::pulse(elapsedMs, color);
+        case RAINBOW: return LedEffects::rainbow(elapsedMs, color);
+        case BREATHING: return LedEffects::breathing(elapsedMs, color);
+        case FADE: return LedEffects::fade(elapsedMs, color);
+        case SOLID:
+        default: return LedEffects::solid(elapsedMs, color);
+    }
+}
+
+void LEDController::setRGBColor(uint8_t r, uint8_t g, uint8_t b) {
+    setRGBColor(CRGB(r, g, b));
+}
+
 void LEDController::setRGBColor(CRGB color) {
+    // Picked up by the next frame
     currentColor = color;
-    if (currentMode == SOLID) {
-        rgbLeds[0] = currentColor;
-        FastLED.show();
+    for (int i = 0; i < MAX_LED_SEGMENTS; i++) {
+        zones[i].color = color;
     }
 }
 
@@ -83,7 +185,7 @@ void LEDController::setRGBColorHex(const String& hexColor) {
 void LEDController::setRGBBrightness(uint8_t brightness) {
     rgbBrightness = brightness;
     FastLED.setBrightness(rgbBrightness);
-    FastLED.show();
+    compositor.invalidate(); // Brightness is applied by show(), the frame hash doesn't see it
 }
 
 uint8_t LEDController::getRGBBrightness() {
@@ -91,20 +193,31 @@ uint8_t LEDController::getRGBBrightness() {
 }
 
 void LEDController::setMode(LEDMode mode) {
+    sequence.stop();
     currentMode = mode;
+    modeStartTime = millis(); // Effects start from the beginning of their cycle
+    for (int i = 0; i < MAX_LED_SEGMENTS; i++) {
+        zones[i].mode = mode;
+        zones[i].startTime = modeStartTime;
+    }
     Serial.printf("LED mode changed to: %s\n", getModeString().c_str());
 }
 
 void LEDController::setMode(const String& modeStr) {
-    if (modeStr == "solid") currentMode = SOLID;
-    else if (modeStr == "blink") currentMode = BLINK;
-    else if (modeStr == "pulse") currentMode = PULSE;
-    else if (modeStr == "rainbow") currentMode = RAINBOW;
-    else if (modeStr == "breathing") currentMode = BREATHING;
-    else if (modeStr == "fade") currentMode = FADE;
-    else currentMode = SOLID;
-    
-    Serial.printf("LED mode changed to: %s\n", modeStr.c_str());
+    LEDMode mode;
+    if (!parseMode(modeStr, mode)) mode = SOLID;
+    setMode(mode);
+}
+
+bool LEDController::parseMode(const String& modeStr, LEDMode& mode) {
+    if (modeStr == "solid") mode = SOLID;
+    else if (modeStr == "blink") mode = BLINK;
+    else if (modeStr == "pulse") mode = PULSE;
+    else if (modeStr == "rainbow") mode = RAINBOW;
+    else if (modeStr == "breathing") mode = BREATHING;
+    else if (modeStr == "fade") mode = FADE;
+    else return false;
+    return true;
 }
 
 LEDMode LEDController::getMode() {
@@ -112,7 +225,11 @@ LEDMode LEDController::getMode() {
 }
 
 String LEDController::getModeString() {
-    switch (currentMode) {
+    return modeName(currentMode);
+}
+
+const char* LEDController::modeName(LEDMode mode) {
+    switch (mode) {
         case SOLID: return "solid";
         case BLINK: return "blink";
         case PULSE: return "pulse";
@@ -123,13 +240,92 @@ String LEDController::getModeString() {
     }
 }
 
+int LEDController::findZone(const String& name) {
+    for (size_t i = 0; i < sizeof(defaultZones) / sizeof(defaultZones[0]); i++) {
+        if (name == defaultZones[i].name) return i;
+    }
+    return -1;
+}
+
 void LEDController::setModeUpdateInterval(unsigned long interval) {
     modeUpdateInterval = interval;
 }
 
+bool LEDController::setZoneColor(const String& zone, CRGB color) {
+    int index = compositor.findSegment(zone);
+    if (index < 0) {
+        Serial.printf("Unknown LED zone: %s\n", zone.c_str());
+        return false;
+    }
+    zones[index].color = color;
+    return true;
+}
+
+bool LEDController::setZoneMode(const String& zone, LEDMode mode) {
+    int index = compositor.findSegment(zone);
+    if (index < 0) {
+        Serial.printf("Unknown LED zone: %s\n", zone.c_str());
+        return false;
+    }
+    zones[index].mode = mode;
+    zones[index].startTime = millis();
+    return true;
+}
+
+void LEDController::setStatusIndicator(CRGB color) {
+    compositor.fillSegment(LAYER_STATUS, statusSegment, color);
+    compositor.setLayerVisible(LAYER_STATUS, true);
+}
+
+void LEDController::clearStatusIndicator() {
+    compositor.setLayerVisible(LAYER_STATUS, false);
+}
+
+LedCompositor& LEDController::getCompositor() {
+    return compositor;
+}
+
+String LEDController::getStripJSON() {
+    JsonDocument doc(MemoryPolicy::json());
+    compositor.writeStats(doc.to<JsonObject>());
+    
+    doc["target_fps"] = LED_TARGET_FPS;
+    doc["cpu_percent"] = compositor.getCpuPercent(LED_TARGET_FPS);
+    doc["alert_overlay"] = overlayActive;
+    doc["status_indicator"] = compositor.isLayerVisible(LAYER_STATUS);
+    
+    JsonObject seq = doc["sequence"].to<JsonObject>();
+    const LedSeqStats& seqStats = sequence.getStats();
+    seq["name"] = sequence.getName();
+    seq["playing"] = sequence.isPlaying();
+    seq["bytes"] = sequence.getSize();
+    seq["steps_per_frame"] = seqStats.frames ? (float)seqStats.steps / seqStats.frames : 0;
+    seq["max_steps_per_frame"] = seqStats.maxStepsPerFrame;
+    seq["budget_hits"] = seqStats.budgetHits;
+    seq["cycles_per_frame"] = seqStats.frames ? (uint32_t)(seqStats.totalCycles / seqStats.frames) : 0;
+    seq["max_cycles"] = seqStats.maxCycles;
+    
+    JsonObject large = doc["large_led"].to<JsonObject>();
+    large["state"] = largeLedState;
+    large["brightness"] = largeLedBrightness;
+    large["duty"] = largeLed.getDuty();
+    large["max_duty"] = LARGE_LED_MAX_DUTY;
+    large["fading"] = largeLed.isFading();
+    
+    JsonArray segments = doc["segments"];
+    for (int i = 0; i < compositor.getSegmentCount() && i < (int)segments.size(); i++) {
+        segments[i]["mode"] = modeName(zones[i].mode);
+        segments[i]["color"] = colorToHex(zones[i].color);
+    }
+    
+    String result;
+    serializeJson(doc, result);
+    return result;
+}
+
 void LEDController::setLargeLedState(bool state) {
     largeLedState = state;
-    analogWrite(LARGE_LED_PIN, largeLedState ? largeLedBrightness : 0);
+    largeLed.fadeTo(largeLedState ? largeLedBrightness : 0, LARGE_LED_FADE_MS);
 }
 
 bool LEDController::getLargeLedState() {
@@ -139,7 +335,7 @@ bool LEDController::getLargeLedState() {
 void LEDController::setLargeLedBrightness(uint8_t brightness) {
     largeLedBrightness = brightness;
     if (largeLedState) {
-        analogWrite(LARGE_LED_PIN, largeLedBrightness);
+        largeLed.fadeTo(largeLedBrightness, LARGE_LED_DIM_MS);
     }
 }
 
@@ -151,6 +347,10 @@ void LEDController::toggleLargeLed() {
     setLargeLedState(!largeLedState);
 }
 
+void LEDController::onLargeLedFadeComplete(LargeLedFadeCallback callback) {
+    largeLed.onFadeComplete(callback);
+}
+
 void LEDController::setOnboardLed(bool state) {
     digitalWrite(ONBOARD_LED, state ? HIGH : LOW);
 }
@@ -165,7 +365,7 @@ void LEDController::blinkOnboardLed(int times, int delayMs) {
 }
 
 CRGB LEDController::hexToColor(const String& hexColor) {
-    long number = strtol(&hexColor[1], NULL, 16);
+    long number = strtol(hexColor.c_str() + 1, NULL, 16);
     uint8_t r = number >> 16;
     uint8_t g = number >> 8 & 0xFF;
     uint8_t b = number & 0xFF;
@@ -181,6 +381,7 @@ String LEDController::colorToHex(CRGB color) {
 void LEDController::setAllOff() {
     FastLED.clear();
     FastLED.show();
+    compositor.invalidate();
     setLargeLedState(false);
     setOnboardLed(false);
 }
@@ -190,12 +391,12 @@ void LEDController::flashAlert(CRGB color, int times) {
     LEDMode originalMode = currentMode;
     
     for (int i = 0; i < times; i++) {
-        rgbLeds[0] = color;
+        fillStrip(color);
         FastLED.show();
         setOnboardLed(true);
         delay(200);
         
-        rgbLeds[0] = CRGB::Black;
+        fillStrip(CRGB::Black);
         FastLED.show();
         setOnboardLed(false);
         delay(200);
@@ -203,60 +404,22 @@ void LEDController::flashAlert(CRGB color, int times) {
     
     currentColor = originalColor;
     currentMode = originalMode;
+    compositor.invalidate();
 }
 
-void LEDController::updateSolidMode() {
-    rgbLeds[0] = currentColor;
-    FastLED.show();
-}
-
-void LEDController::updateBlinkMode() {
-    blinkState = !blinkState;
-    rgbLeds[0] = blinkState ? currentColor : CRGB::Black;
-    FastLED.show();
-}
-
-void LEDController::updatePulseMode() {
-    static uint8_t brightness = 0;
-    static int8_t direction = 1;
-    
-    brightness += direction * 5;
-    if (brightness >= 255 || brightness <= 0) {
-        direction *= -1;
+void LEDController::setAlertOverlay(CRGB color) {
+    if (!overlayActive) {
+        overlayStartTime = millis(); // Start on the visible half so short flashes show
     }
-    
-    rgbLeds[0] = currentColor;
-    FastLED.setBrightness(brightness);
-    FastLED.show();
-}
-
-void LEDController::updateRainbowMode() {
-    hue += 2;
-    rgbLeds[0] = CHSV(hue, 255, 255);
-    FastLED.show();
+    overlayActive = true;
+    overlayColor = color;
+    compositor.fillLayer(LAYER_ALERT, color);
 }
 
-void LEDController::updateBreathingMode() {
-    breathingBrightness += breathingDirection * 3;
-    if (breathingBrightness >= 255 || breathingBrightness <= 0) {
-        breathingDirection *= -1;
-    }
-    
-    rgbLeds[0] = currentColor;
-    FastLED.setBrightness(breathingBrightness);
-    FastLED.show();
+void LEDController::clearAlertOverlay() {
+    overlayActive = false;
 }
 
-void LEDController::updateFadeMode() {
-    static uint8_t colorIndex = 0;
-    CRGB colors[] = {CRGB::Red, CRGB::Green, CRGB::Blue, CRGB::Yellow, CRGB::Cyan, CRGB::Magenta};
-    
-    rgbLeds[0] = colors[colorIndex];
-    FastLED.show();
-    
-    static unsigned long lastColorChange = 0;
-    if (millis() - lastColorChange >= 1000) {
-        colorIndex = (colorIndex + 1) % 6;
-        lastColorChange = millis();
-    }
+bool LEDController::hasAlertOverlay() {
+    return overlayActive;
 }
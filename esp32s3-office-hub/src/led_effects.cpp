@@ -0,0 +1,112 @@
+#include "led_effects.h"
+
+// Generated with round(128 + 127.5 * sin(2 * pi * i / 256))
+constexpr uint8_t LedCurves::sineTable[256] = {
+    128, 131, 134, 137, 140, 144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174,
+    177, 180, 183, 185, 188, 191, 194, 196, 199, 201, 204, 206, 209, 211, 214, 216,
+    218, 220, 222, 225, 227, 229, 230, 232, 234, 236, 237, 239, 240, 242, 243, 245,
+    246, 247, 248, 249, 250, 251, 252, 252, 253, 254, 254, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 254, 254, 253, 252, 252, 251, 250, 249, 248, 247,
+    246, 245, 243, 242, 240, 239, 237, 236, 234, 232, 230, 229, 227, 225, 222, 220,
+    218, 216, 214, 211, 209, 206, 204, 201, 199, 196, 194, 191, 188, 185, 183, 180,
+    177, 174, 171, 168, 165, 162, 159, 156, 153, 150, 147, 144, 140, 137, 134, 131,
+    128, 125, 122, 119, 116, 112, 109, 106, 103, 100,  97,  94,  91,  88,  85,  82,
+     79,  76,  73,  71,  68,  65,  62,  60,  57,  55,  52,  50,  47,  45,  42,  40,
+     38,  36,  34,  31,  29,  27,  26,  24,  22,  20,  19,  17,  16,  14,  13,  11,
+     10,   9,   8,   7,   6,   5,   4,   4,   3,   2,   2,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   2,   2,   3,   4,   4,   5,   6,   7,   8,   9,
+     10,  11,  13,  14,  16,  17,  19,  20,  22,  24,  26,  27,  29,  31,  34,  36,
+     38,  40,  42,  45,  47,  50,  52,  55,  57,  60,  62,  65,  68,  71,  73,  76,
+     79,  82,  85,  88,  91,  94,  97, 100, 103, 106, 109, 112, 116, 119, 122, 125,
+};
+
+// Generated with round(255 * (i / 255) ^ 2.2)
+constexpr uint8_t LedCurves::gammaTable[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+      3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+      6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+     12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+     20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+     30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+     42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+     73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+     91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+    113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+    137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+    163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+    192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
+
+// Generated with round(255 * easeInOutCubic(i / 255))
+constexpr uint8_t LedCurves::easeInOutTable[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,
+      2,   2,   2,   3,   3,   3,   3,   4,   4,   4,   5,   5,   5,   6,   6,   6,
+      7,   7,   8,   8,   9,   9,  10,  10,  11,  11,  12,  13,  13,  14,  15,  15,
+     16,  17,  18,  19,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,
+     31,  33,  34,  35,  36,  38,  39,  41,  42,  43,  45,  46,  48,  49,  51,  53,
+     54,  56,  58,  60,  62,  63,  65,  67,  69,  71,  73,  75,  77,  80,  82,  84,
+     86,  89,  91,  94,  96,  99, 101, 104, 106, 109, 112, 114, 117, 120, 123, 126,
+    129, 132, 135, 138, 141, 143, 146, 149, 151, 154, 156, 159, 161, 164, 166, 169,
+    171, 173, 175, 178, 180, 182, 184, 186, 188, 190, 192, 193, 195, 197, 199, 201,
+    202, 204, 206, 207, 209, 210, 212, 213, 214, 216, 217, 219, 220, 221, 222, 224,
+    225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 236, 237, 238, 239,
+    240, 240, 241, 242, 242, 243, 244, 244, 245, 245, 246, 246, 247, 247, 248, 248,
+    249, 249, 249, 250, 250, 250, 251, 251, 251, 252, 252, 252, 252, 253, 253, 253,
+    253, 253, 253, 254, 254, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+using namespace LedCurves;
+
+CRGB LedEffects::scale(const CRGB& color, uint8_t brightness) {
+    return CRGB(scale8(color.r, brightness), scale8(color.g, brightness), scale8(color.b, brightness));
+}
+
+CRGB LedEffects::blend(const CRGB& from, const CRGB& to, uint8_t amount) {
+    uint8_t keep = 255 - amount;
+    return CRGB(scale8(from.r, keep) + scale8(to.r, amount),
+                scale8(from.g, keep) + scale8(to.g, amount),
+                scale8(from.b, keep) + scale8(to.b, amount));
+}
+
+CRGB LedEffects::solid(uint32_t, const CRGB& color) {
+    return color;
+}
+
+CRGB LedEffects::blink(uint32_t elapsedMs, const CRGB& color) {
+    return phase8(elapsedMs, EFFECT_BLINK_PERIOD_MS) < 128 ? color : CRGB(CRGB::Black);
+}
+
+CRGB LedEffects::pulse(uint32_t elapsedMs, const CRGB& color) {
+    // Eased ramp up and down, starting dark
+    uint8_t level = ease8InOut(triwave8(phase8(elapsedMs, EFFECT_PULSE_PERIOD_MS)));
+    return scale(color, gamma8(level));
+}
+
+CRGB LedEffects::breathing(uint32_t elapsedMs, const CRGB& color) {
+    // Sine starting from its minimum, gamma-corrected so the dim end lingers
+    uint8_t level = sin8(phase8(elapsedMs, EFFECT_BREATHING_PERIOD_MS) + 192);
+    return scale(color, gamma8(level));
+}
+
+CRGB LedEffects::rainbow(uint32_t elapsedMs, const CRGB&) {
+    return CRGB(CHSV(phase8(elapsedMs, EFFECT_RAINBOW_PERIOD_MS), 255, 255));
+}
+
+CRGB LedEffects::fade(uint32_t elapsedMs, const CRGB&) {
+    static const CRGB colors[] = {CRGB::Red, CRGB::Green, CRGB::Blue, CRGB::Yellow, CRGB::Cyan, CRGB::Magenta};
+    const uint32_t count = sizeof(colors) / sizeof(colors[0]);
+    
+    // Cross-fade from one palette entry to the next over each step
+    uint32_t step = elapsedMs / EFFECT_FADE_STEP_MS;
+    uint8_t amount = ease8InOut(phase8(elapsedMs, EFFECT_FADE_STEP_MS));
+    return blend(colors[step % count], colors[(step + 1) % count], amount);
+}
+
+bool LedEffects::overlayVisible(uint32_t elapsedMs) {
+    return phase8(elapsedMs, EFFECT_OVERLAY_PERIOD_MS) < 128;
+}
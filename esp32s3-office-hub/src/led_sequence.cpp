@@ -0,0 +1,488 @@
+#include "led_sequence.h"
+#include "led_controller.h"
+#include "led_effects.h"
+#include <SPIFFS.h>
+
+static uint16_t read16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+
+LedSequence::LedSequence() {
+    programSize = 0;
+    code = nullptr;
+    codeLength = 0;
+    paletteCount = 0;
+    trackCount = 0;
+    loaded = false;
+    playing = false;
+    resetStats();
+}
+
+uint8_t LedSequence::instructionLength(uint8_t opcode) {
+    switch (opcode) {
+        case LEDSEQ_END: return 1;
+        case LEDSEQ_SEGMENT: return 2;
+        case LEDSEQ_SET: return 2;
+        case LEDSEQ_RGB: return 4;
+        case LEDSEQ_FADE: return 5;
+        case LEDSEQ_WAIT: return 3;
+        case LEDSEQ_LOOP: return 2;
+        case LEDSEQ_NEXT: return 1;
+        case LEDSEQ_GRADIENT: return 3;
+        case LEDSEQ_EFFECT: return 5;
+        default: return 0;
+    }
+}
+
+const char* LedSequence::opcodeName(uint8_t opcode) {
+    switch (opcode) {
+        case LEDSEQ_END: return "end";
+        case LEDSEQ_SEGMENT: return "segment";
+        case LEDSEQ_SET: return "set";
+        case LEDSEQ_RGB: return "rgb";
+        case LEDSEQ_FADE: return "fade";
+        case LEDSEQ_WAIT: return "wait";
+        case LEDSEQ_LOOP: return "loop";
+        case LEDSEQ_NEXT: return "next";
+        case LEDSEQ_GRADIENT: return "gradient";
+        case LEDSEQ_EFFECT: return "effect";
+        default: return "?";
+    }
+}
+
+bool LedSequence::validate(const uint8_t* data, size_t size, String& error) {
+    if (size < LEDSEQ_HEADER_SIZE || data[0] != 'L' || data[1] != 'S' || data[2] != 'Q') {
+        error = "not a sequence";
+        return false;
+    }
+    if (data[3] != LEDSEQ_VERSION) {
+        error = "unsupported version " + String(data[3]);
+        return false;
+    }
+    if (size > LEDSEQ_MAX_SIZE) {
+        error = "larger than " + String(LEDSEQ_MAX_SIZE) + " bytes";
+        return false;
+    }
+
+    uint8_t tracks = data[4];
+    uint8_t colors = data[5];
+    uint16_t length = read16(data + 6);
+    if (tracks == 0 || tracks > LEDSEQ_MAX_TRACKS || colors > LEDSEQ_MAX_PALETTE) {
+        error = "bad track or palette count";
+        return false;
+    }
+    size_t codeStart = LEDSEQ_HEADER_SIZE + tracks * 2 + colors * 3;
+    if (length == 0 || codeStart + length != size) {
+        error = "length mismatch";
+        return false;
+    }
+    const uint8_t* bytecode = data + codeStart;
+
+    // One pass over the code: operands, loop nesting and instruction boundaries
+    uint8_t boundaries[LEDSEQ_MAX_SIZE / 8] = {0};
+    int depth = 0;
+    uint16_t pc = 0;
+    uint8_t lastOp = LEDSEQ_END;
+    while (pc < length) {
+        uint8_t op = bytecode[pc];
+        uint8_t len = instructionLength(op);
+        if (len == 0 || pc + len > length) {
+            error = "bad instruction at " + String(pc);
+            return false;
+        }
+        boundaries[pc / 8] |= 1 << (pc % 8);
+        const uint8_t* arg = bytecode + pc + 1;
+
+        bool ok = true;
+        switch (op) {
+            case LEDSEQ_SEGMENT: ok = arg[0] < MAX_LED_SEGMENTS || arg[0] == LEDSEQ_ALL_SEGMENTS; break;
+            case LEDSEQ_SET: ok = arg[0] < colors; break;
+            case LEDSEQ_FADE: ok = arg[0] < colors && arg[3] <= LEDSEQ_EASE_STEP; break;
+            case LEDSEQ_GRADIENT: ok = arg[0] < colors && arg[1] < colors; break;
+            case LEDSEQ_EFFECT: ok = arg[0] <= FADE && arg[1] < colors; break;
+            case LEDSEQ_LOOP: ok = ++depth <= LEDSEQ_MAX_LOOP_DEPTH; break;
+            case LEDSEQ_NEXT: ok = --depth >= 0; break;
+            case LEDSEQ_END: ok = depth == 0; break;
+        }
+        if (!ok) {
+            error = String("bad ") + opcodeName(op) + " at " + String(pc);
+            return false;
+        }
+        lastOp = op;
+        pc += len;
+    }
+    if (lastOp != LEDSEQ_END) {
+        error = "code must finish with end";
+        return false;
+    }
+
+    // Tracks start on an instruction outside any loop
+    for (int t = 0; t < tracks; t++) {
+        uint16_t offset = read16(data + LEDSEQ_HEADER_SIZE + t * 2);
+        if (offset >= length || !(boundaries[offset / 8] & (1 << (offset % 8)))) {
+            error = "bad offset for track " + String(t);
+            return false;
+        }
+        int trackDepth = 0;
+        for (uint16_t scan = 0; scan < offset; scan += instructionLength(bytecode[scan])) {
+            if (bytecode[scan] == LEDSEQ_LOOP) trackDepth++;
+            else if (bytecode[scan] == LEDSEQ_NEXT) trackDepth--;
+        }
+        if (trackDepth != 0) {
+            error = "track " + String(t) + " starts inside a loop";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool LedSequence::load(const uint8_t* data, size_t size, const String& sequenceName, String& error) {
+    if (!validate(data, size, error)) return false;
+
+    playing = false;
+    memcpy(program, data, size);
+    programSize = size;
+    name = sequenceName;
+    trackCount = program[4];
+    paletteCount = program[5];
+    codeLength = read16(program + 6);
+
+    const uint8_t* rgb = program + LEDSEQ_HEADER_SIZE + trackCount * 2;
+    for (int i = 0; i < paletteCount; i++) {
+        palette[i] = CRGB(rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2]);
+    }
+    code = rgb + paletteCount * 3;
+    loaded = true;
+    return true;
+}
+
+bool LedSequence::isValidName(const String& sequenceName) {
+    if (sequenceName.length() == 0 || sequenceName.length() > LEDSEQ_NAME_LEN) return false;
+    for (unsigned int i = 0; i < sequenceName.length(); i++) {
+        char c = sequenceName[i];
+        if (!isalnum(c) && c != '_' && c != '-') return false;
+    }
+    return true;
+}
+
+String LedSequence::pathFor(const String& sequenceName) {
+    return String(LEDSEQ_DIR) + "/" + sequenceName + ".lsq";
+}
+
+bool LedSequence::loadFile(const String& sequenceName, String& error) {
+    if (!isValidName(sequenceName)) {
+        error = "bad name";
+        return false;
+    }
+    File file = SPIFFS.open(pathFor(sequenceName), "r");
+    if (!file) {
+        error = "not found";
+        return false;
+    }
+
+    // Validated in place; the current program keeps running if this one is bad
+    uint8_t buffer[LEDSEQ_MAX_SIZE];
+    size_t size = file.size();
+    if (size > sizeof(buffer)) {
+        file.close();
+        error = "too large";
+        return false;
+    }
+    size = file.read(buffer, size);
+    file.close();
+    return load(buffer, size, sequenceName, error);
+}
+
+bool LedSequence::saveFile(const String& sequenceName, const uint8_t* data, size_t size) {
+    if (!isValidName(sequenceName)) return false;
+    if (!SPIFFS.exists(LEDSEQ_DIR)) {
+        SPIFFS.mkdir(LEDSEQ_DIR);
+    }
+
+    File file = SPIFFS.open(pathFor(sequenceName), "w");
+    if (!file) {
+        Serial.printf("Failed to write sequence %s\n", sequenceName.c_str());
+        return false;
+    }
+    size_t written = file.write(data, size);
+    file.close();
+    return written == size;
+}
+
+bool LedSequence::removeFile(const String& sequenceName) {
+    return isValidName(sequenceName) && SPIFFS.remove(pathFor(sequenceName));
+}
+
+void LedSequence::start(uint32_t now) {
+    if (!loaded) return;
+
+    for (int t = 0; t < trackCount; t++) {
+        LedSeqTrack& track = tracks[t];
+        track.pc = read16(program + LEDSEQ_HEADER_SIZE + t * 2);
+        track.running = true;
+        track.segment = LEDSEQ_ALL_SEGMENTS;
+        track.color = CRGB::Black;
+        track.target = CRGB::Black;
+        track.gradientTo = CRGB::Black;
+        track.display = LEDSEQ_SHOW_COLOR;
+        track.op = LEDSEQ_END;
+        track.ease = LEDSEQ_EASE_LINEAR;
+        track.effectMode = SOLID;
+        track.opStart = now;
+        track.opDuration = 0;
+        track.loopDepth = 0;
+    }
+    playing = true;
+    resetStats();
+}
+
+void LedSequence::stop() {
+    playing = false;
+}
+
+bool LedSequence::isPlaying() {
+    return playing;
+}
+
+const String& LedSequence::getName() {
+    return name;
+}
+
+uint16_t LedSequence::getSize() {
+    return programSize;
+}
+
+bool LedSequence::stepTrack(LedSeqTrack& track, uint32_t now, uint32_t& steps) {
+    for (uint32_t budget = 0; ; budget++) {
+        if (track.op != LEDSEQ_END) {
+            if (now - track.opStart < track.opDuration) return true;
+
+            // Next keyframe starts where this one was due to end, so late frames don't drift
+            track.opStart += track.opDuration;
+            if (track.op == LEDSEQ_FADE || track.op == LEDSEQ_EFFECT) track.color = track.target;
+            track.op = LEDSEQ_END;
+        }
+        if (budget >= LEDSEQ_STEPS_PER_FRAME) {
+            stats.budgetHits++;
+            return true;
+        }
+
+        const uint8_t* ins = code + track.pc;
+        steps++;
+        switch (ins[0]) {
+            case LEDSEQ_END:
+                track.running = false;
+                return false;
+            case LEDSEQ_SEGMENT:
+                track.segment = ins[1];
+                break;
+            case LEDSEQ_SET:
+                track.color = track.target = palette[ins[1]];
+                track.display = LEDSEQ_SHOW_COLOR;
+                break;
+            case LEDSEQ_RGB:
+                track.color = track.target = CRGB(ins[1], ins[2], ins[3]);
+                track.display = LEDSEQ_SHOW_COLOR;
+                break;
+            case LEDSEQ_FADE:
+                track.target = palette[ins[1]];
+                track.opDuration = read16(ins + 2);
+                track.ease = ins[4];
+                track.op = LEDSEQ_FADE;
+                track.display = LEDSEQ_SHOW_COLOR;
+                break;
+            case LEDSEQ_WAIT:
+                track.opDuration = read16(ins + 1);
+                track.op = LEDSEQ_WAIT;
+                break;
+            case LEDSEQ_LOOP: {
+                LedSeqLoop& loop = track.loops[track.loopDepth++];
+                loop.start = track.pc + 2;
+                loop.remaining = ins[1];
+                break;
+            }
+            case LEDSEQ_NEXT: {
+                LedSeqLoop& loop = track.loops[track.loopDepth - 1];
+                if (loop.remaining == 0 || --loop.remaining > 0) {
+                    track.pc = loop.start;
+                    continue;
+                }
+                track.loopDepth--;
+                break;
+            }
+            case LEDSEQ_GRADIENT:
+                track.color = palette[ins[1]];
+                track.gradientTo = palette[ins[2]];
+                track.display = LEDSEQ_SHOW_GRADIENT;
+                break;
+            case LEDSEQ_EFFECT:
+                track.effectMode = ins[1];
+                track.target = palette[ins[2]];
+                track.opDuration = read16(ins + 3);
+                track.op = LEDSEQ_EFFECT;
+                track.display = LEDSEQ_SHOW_COLOR;
+                break;
+        }
+        track.pc += instructionLength(ins[0]);
+    }
+}
+
+void LedSequence::fillTarget(const LedSeqTrack& track, LedCompositor& compositor, LedLayerId layer, const CRGB& color) {
+    if (track.segment == LEDSEQ_ALL_SEGMENTS) {
+        compositor.fillLayer(layer, color);
+    } else {
+        compositor.fillSegment(layer, track.segment, color);
+    }
+}
+
+void LedSequence::renderTrack(LedSeqTrack& track, uint32_t now, LedCompositor& compositor, LedLayerId layer) {
+    uint32_t elapsed = now - track.opStart;
+
+    if (track.op == LEDSEQ_FADE) {
+        uint8_t amount = track.opDuration ? (uint8_t)(elapsed * 255 / track.opDuration) : 255;
+        if (track.ease == LEDSEQ_EASE_IN_OUT) amount = LedCurves::ease8InOut(amount);
+        else if (track.ease == LEDSEQ_EASE_STEP) amount = 0;
+        fillTarget(track, compositor, layer, LedEffects::blend(track.color, track.target, amount));
+        return;
+    }
+    if (track.op == LEDSEQ_EFFECT) {
+        fillTarget(track, compositor, layer, LEDController::renderMode((LEDMode)track.effectMode, elapsed, track.target));
+        return;
+    }
+    if (track.display != LEDSEQ_SHOW_GRADIENT) {
+        fillTarget(track, compositor, layer, track.color);
+        return;
+    }
+
+    uint16_t start = 0;
+    uint16_t count = compositor.getLength();
+    if (track.segment != LEDSEQ_ALL_SEGMENTS) {
+        const LedSegment* segment = compositor.getSegment(track.segment);
+        if (!segment) return;
+        start = segment->start;
+        count = segment->count;
+    }
+    CRGB* pixels = compositor.getLayer(layer) + start;
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t amount = count > 1 ? (uint8_t)((uint32_t)i * 255 / (count - 1)) : 0;
+        pixels[i] = LedEffects::blend(track.color, track.gradientTo, amount);
+    }
+}
+
+bool LedSequence::render(uint32_t now, LedCompositor& compositor, LedLayerId layer) {
+    if (!playing) return false;
+    uint32_t startCycles = ESP.getCycleCount();
+
+    uint32_t steps = 0;
+    bool running = false;
+    for (int t = 0; t < trackCount; t++) {
+        LedSeqTrack& track = tracks[t];
+        if (track.running) {
+            stepTrack(track, now, steps);
+        }
+        renderTrack(track, now, compositor, layer);
+        running |= track.running;
+    }
+
+    uint32_t cycles = ESP.getCycleCount() - startCycles;
+    stats.frames++;
+    stats.steps += steps;
+    stats.totalCycles += cycles;
+    if (steps > stats.maxStepsPerFrame) stats.maxStepsPerFrame = steps;
+    if (cycles > stats.maxCycles) stats.maxCycles = cycles;
+    return running;
+}
+
+const LedSeqStats& LedSequence::getStats() {
+    return stats;
+}
+
+void LedSequence::resetStats() {
+    memset(&stats, 0, sizeof(stats));
+}
+
+String LedSequence::disassemble(const uint8_t* data, size_t size) {
+    String error;
+    if (!validate(data, size, error)) {
+        return "; invalid sequence: " + error + "\n";
+    }
+
+    uint8_t tracks = data[4];
+    uint8_t colors = data[5];
+    uint16_t length = read16(data + 6);
+    const uint8_t* rgb = data + LEDSEQ_HEADER_SIZE + tracks * 2;
+    const uint8_t* bytecode = rgb + colors * 3;
+    char line[64];
+
+    String out;
+    snprintf(line, sizeof(line), "; version %u, %u tracks, %u colours, %u bytes of code\n",
+             data[3], tracks, colors, length);
+    out += line;
+    for (int i = 0; i < colors; i++) {
+        snprintf(line, sizeof(line), "palette %d #%02X%02X%02X\n", i, rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2]);
+        out += line;
+    }
+
+    static const char* easeNames[] = {"linear", "in_out", "step"};
+    for (uint16_t pc = 0; pc < length; pc += instructionLength(bytecode[pc])) {
+        for (int t = 0; t < tracks; t++) {
+            if (read16(data + LEDSEQ_HEADER_SIZE + t * 2) == pc) {
+                snprintf(line, sizeof(line), "track %d\n", t);
+                out += line;
+            }
+        }
+
+        const uint8_t* ins = bytecode + pc;
+        const char* name = opcodeName(ins[0]);
+        switch (ins[0]) {
+            case LEDSEQ_SEGMENT:
+                if (ins[1] == LEDSEQ_ALL_SEGMENTS) snprintf(line, sizeof(line), "%04X  %-9s all\n", pc, name);
+                else snprintf(line, sizeof(line), "%04X  %-9s %u\n", pc, name, ins[1]);
+                break;
+            case LEDSEQ_SET:
+            case LEDSEQ_LOOP:
+                snprintf(line, sizeof(line), "%04X  %-9s %u\n", pc, name, ins[1]);
+                break;
+            case LEDSEQ_RGB:
+                snprintf(line, sizeof(line), "%04X  %-9s #%02X%02X%02X\n", pc, name, ins[1], ins[2], ins[3]);
+                break;
+            case LEDSEQ_FADE:
+                snprintf(line, sizeof(line), "%04X  %-9s %u %ums %s\n", pc, name, ins[1], read16(ins + 2), easeNames[ins[4]]);
+                break;
+            case LEDSEQ_WAIT:
+                snprintf(line, sizeof(line), "%04X  %-9s %ums\n", pc, name, read16(ins + 1));
+                break;
+            case LEDSEQ_GRADIENT:
+                snprintf(line, sizeof(line), "%04X  %-9s %u %u\n", pc, name, ins[1], ins[2]);
+                break;
+            case LEDSEQ_EFFECT:
+                snprintf(line, sizeof(line), "%04X  %-9s %s %u %ums\n", pc, name,
+                         LEDController::modeName((LEDMode)ins[1]), ins[2], read16(ins + 3));
+                break;
+            default:
+                snprintf(line, sizeof(line), "%04X  %s\n", pc, name);
+                break;
+        }
+        out += line;
+    }
+    return out;
+}
+
+bool LedSequence::fromHex(const String& hex, uint8_t* out, size_t capacity, size_t& length) {
+    length = 0;
+    if (hex.length() % 2 != 0 || hex.length() / 2 > capacity) return false;
+
+    for (unsigned int i = 0; i < hex.length(); i += 2) {
+        uint8_t value = 0;
+        for (int nibble = 0; nibble < 2; nibble++) {
+            char c = hex[i + nibble];
+            value <<= 4;
+            if (c >= '0' && c <= '9') value |= c - '0';
+            else if (c >= 'a' && c <= 'f') value |= c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F') value |= c - 'A' + 10;
+            else return false;
+        }
+        out[length++] = value;
+    }
+    return true;
+}
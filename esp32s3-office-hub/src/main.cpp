@@ -8,52 +8,92 @@
 #include <NTPClient.h>
 #include <time.h>
 #include <Preferences.h>
+#include "esp_heap_caps.h"
 
 // Custom headers
 #include "config_manager.h"
 #include "led_controller.h"
 #include "usb_host.h"
+#include "serial_bridge.h"
 #include "temperature_sensor.h"
+#include "history_store.h"
 #include "wifi_manager.h"
+#include "timer_service.h"
+#include "alert_rules.h"
+#include "memory_policy.h"
+#include "boot_profiler.h"
+
+// Serve HTTP before WiFi association and defer slow init steps
+#ifndef FAST_BOOT
+#define FAST_BOOT 1
+#endif
 
 // Global objects
 ConfigManager configManager;
 LEDController ledController;
 USBHostManager usbManager;
+SerialBridge serialBridge;
 TemperatureSensor tempSensor;
+HistoryStore historyStore;
 WiFiManager wifiMgr;
+TimerService timerService;
+AlertRulesEngine alertRules;
+BootProfiler bootProfiler;
 
 // Web Server
 AsyncWebServer server(80);
 AsyncWebSocket ws("/ws");
+AsyncWebSocket serialSocket("/ws/serial");
 
 // NTP Client
 WiFiUDP ntpUDP;
 NTPClient timeClient(ntpUDP, "pool.ntp.org", -18000, 60000); // EST timezone
 
 // System variables
-unsigned long lastStatusUpdate = 0;
-unsigned long lastPeriodicCheck = 0;
 bool systemInitialized = false;
 String firmwareVersion = "1.0.0";
 String buildDate = __DATE__ " " __TIME__;
 
 // Function declarations
 void initializeSystem();
+void bootWorkerTask(void *param);
+void setupWebServer();
 void handleWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, 
                          AwsEventType type, void *arg, uint8_t *data, size_t len);
 void handleWebSocketMessage(AsyncWebSocketClient *client, const String& message);
+void handleSerialSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client,
+                             AwsEventType type, void *arg, uint8_t *data, size_t len);
+void handleSerialControl(AsyncWebSocketClient *client, const String& message);
+void sendJsonMessage(AsyncWebSocketClient *client, JsonDocument& doc);
 void sendStatusUpdate(AsyncWebSocketClient *client = nullptr);
 void sendTemperatureData(AsyncWebSocketClient *client = nullptr);
 void sendWiFiScanData(AsyncWebSocketClient *client = nullptr);
 void sendUSBStatusData(AsyncWebSocketClient *client = nullptr);
-void performPeriodicTasks();
+String usbFilePath(AsyncWebServerRequest *request);
+void handleUSBFileDownload(AsyncWebServerRequest *request);
+void handleUSBListing(AsyncWebServerRequest *request, const String &path);
+void handleUSBFileUploaded(AsyncWebServerRequest *request);
+void handleHistoryQuery(AsyncWebServerRequest *request);
+void writeUSBUpload(AsyncWebServerRequest *request, const String& filename, const uint8_t *data,
+                    size_t len, size_t index, size_t total);
+void setupTimers();
+void loadUserSchedules();
+void applyScheduleAction(const String& action, const String& value);
+void loadAlertRules();
+void handleAlertAction(const AlertRule& rule, bool raised, float value);
+void checkWiFiConnection();
+void hourlyAlert();
 String formatUptime(unsigned long ms);
+uint32_t wallClockNow();
 void handleSystemCommand(const String& command, AsyncWebSocketClient *client);
+void handleSequenceMessage(AsyncWebSocketClient *client, const String& type, JsonDocument& doc);
 
 void setup() {
+    bootProfiler.begin();
     Serial.begin(115200);
+#if !FAST_BOOT
     delay(1000);
+#endif
     
     Serial.println("\n=== ESP32-S3 Office Control & Monitoring Hub ===");
     Serial.printf("Firmware Version: %s\n", firmwareVersion.c_str());
@@ -62,13 +102,37 @@ void setup() {
     initializeSystem();
 }
 
+void bootWorkerTask(void *) {
+    // Slow, independent init steps run here while the loop task serves requests
+    if (!usbManager.initialize(&timerService)) {
+        Serial.println("WARNING: USB host initialization failed");
+    } else {
+        Serial.println("✓ USB host initialized");
+    }
+    bootProfiler.event("usb_ready");
+    
+    tempSensor.loadLogDeferred();
+    bootProfiler.event("history_parsed");
+    
+    MemoryPolicy::releaseTaskArena();
+    vTaskDelete(NULL);
+}
+
 void initializeSystem() {
+    // Route JSON documents and WebSocket buffers away from the internal heap
+    if (!MemoryPolicy::begin()) {
+        Serial.println("WARNING: Memory policy initialization failed");
+    } else {
+        Serial.println("✓ Memory policy initialized");
+    }
+    
     // Initialize SPIFFS
     if (!SPIFFS.begin(true)) {
         Serial.println("ERROR: SPIFFS Mount Failed");
         return;
     }
     Serial.println("✓ SPIFFS initialized");
+    bootProfiler.mark("spiffs");
     
     // Initialize configuration manager
     if (!configManager.begin()) {
@@ -76,6 +140,27 @@ void initializeSystem() {
         return;
     }
     Serial.println("✓ Configuration loaded");
+    bootProfiler.mark("config");
+    
+    // Initialize WiFi manager
+    if (!wifiMgr.begin()) {
+        Serial.println("ERROR: Failed to initialize WiFi manager");
+        return;
+    }
+    Serial.println("✓ WiFi manager initialized");
+    
+    WiFi.onEvent([](WiFiEvent_t, WiFiEventInfo_t) {
+        bootProfiler.event("wifi_got_ip");
+    }, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    
+#if FAST_BOOT
+    // Associate in the background; everything below overlaps with it
+    Serial.println("Connecting to WiFi...");
+    if (!wifiMgr.beginConnectAsync()) {
+        wifiMgr.startHotspot("ESP32-Office-Hub", "office123");
+    }
+#endif
+    bootProfiler.mark("wifi_start");
     
     // Initialize LED controller
     if (!ledController.begin()) {
@@ -84,26 +169,59 @@ void initializeSystem() {
     }
     Serial.println("✓ LED controller initialized");
     
+    // Fades run in hardware; clients hear about the result once it settles
+    ledController.onLargeLedFadeComplete([](uint8_t brightness) {
+        JsonDocument doc(MemoryPolicy::json());
+        doc["type"] = "large_led";
+        doc["state"] = brightness > 0;
+        doc["brightness"] = ledController.getLargeLedBrightness();
+        sendJsonMessage(nullptr, doc);
+    });
+    bootProfiler.mark("leds");
+    
     // Initialize temperature sensor
-    if (!tempSensor.begin()) {
+    if (!tempSensor.begin(!FAST_BOOT)) {
         Serial.println("WARNING: Failed to initialize temperature sensor");
     } else {
         Serial.println("✓ Temperature sensor initialized");
     }
+    bootProfiler.mark("temp_sensor");
+    
+    // Long-term history: flash segments, archived to a stick when one is mounted
+    if (!historyStore.begin(&usbManager)) {
+        Serial.println("WARNING: History store initialization failed");
+    } else {
+        Serial.println("✓ History store initialized");
+    }
+    
+    // Serial adapters plugged into the USB port are bridged to /ws/serial
+    if (!serialBridge.begin(&timerService)) {
+        Serial.println("WARNING: Serial bridge initialization failed");
+    } else {
+        usbManager.setSerialBridge(&serialBridge);
+        Serial.println("✓ Serial bridge initialized");
+    }
+    
+    // Handlers reach everything initialized above, so the server starts only
+    // now; it binds to any interface and can listen before association, and
+    // USB and the history file still come up behind it
+    setupWebServer();
+    server.begin();
+    bootProfiler.event("server_started");
+    Serial.println("✓ Web server started");
+    bootProfiler.mark("web_server");
     
+#if FAST_BOOT
+    // USB host and history load happen on core 0 while we carry on
+    xTaskCreatePinnedToCore(bootWorkerTask, "boot_worker", 8192, NULL, 1, NULL, 0);
+#else
     // Initialize USB host manager
-    if (!usbManager.initialize()) {
+    if (!usbManager.initialize(&timerService)) {
         Serial.println("WARNING: USB host initialization failed");
     } else {
         Serial.println("✓ USB host initialized");
     }
-    
-    // Initialize WiFi manager
-    if (!wifiMgr.begin()) {
-        Serial.println("ERROR: Failed to initialize WiFi manager");
-        return;
-    }
-    Serial.println("✓ WiFi manager initialized");
+    bootProfiler.mark("usb");
     
     // Connect to WiFi
     Serial.println("Connecting to WiFi...");
@@ -120,38 +238,42 @@ void initializeSystem() {
     if (wifiMgr.isWiFiConnected()) {
         Serial.printf("\n✓ WiFi connected to: %s\n", wifiMgr.getCurrentSSID().c_str());
         Serial.printf("✓ IP address: %s\n", wifiMgr.getCurrentIP().c_str());
-        
-        // Initialize NTP
-        timeClient.begin();
-        timeClient.update();
-        Serial.println("✓ NTP client initialized");
     } else {
         Serial.println("\n⚠ WiFi connection failed, starting hotspot...");
         wifiMgr.startHotspot("ESP32-Office-Hub", "office123");
     }
+    bootProfiler.mark("wifi_wait");
+#endif
     
-    // Setup web server routes
-    setupWebServer();
-    
-    // Start web server
-    server.begin();
-    Serial.println("✓ Web server started");
+    // Register periodic work and user schedules
+    setupTimers();
+    bootProfiler.mark("timers");
     
     // Signal successful initialization
+#if FAST_BOOT
+    ledController.setAlertOverlay(CRGB::Green);
+    timerService.after(1200, []() { ledController.clearAlertOverlay(); }, "boot_flash");
+#else
     ledController.flashAlert(CRGB::Green, 3);
+#endif
     systemInitialized = true;
     
+    bootProfiler.printReport();
     Serial.println("=== System initialization complete ===\n");
 }
 
 void setupWebServer() {
     // Serve static files from SPIFFS
-    server.serveStatic("/", SPIFFS, "/").setDefaultFile("index.html");
+    server.serveStatic("/", SPIFFS, "/").setDefaultFile("index.html")
+        .setFilter([](AsyncWebServerRequest *) {
+            bootProfiler.event("first_http_request");
+            return true;
+        });
     
     // API endpoints
     server.on("/api/status", HTTP_GET, [](AsyncWebServerRequest *request) {
         AsyncResponseStream *response = request->beginResponseStream("application/json");
-        DynamicJsonDocument doc(2048);
+        JsonDocument doc(MemoryPolicy::json());
         
         doc["uptime"] = formatUptime(millis());
         doc["wifi"] = wifiMgr.isWiFiConnected() ? "Connected" : "Disconnected";
@@ -162,6 +284,7 @@ void setupWebServer() {
         doc["temp_valid"] = tempSensor.isTemperatureValid();
         doc["usb"] = usbManager.isMounted() ? "Connected" : "Not Connected";
         doc["free_heap"] = ESP.getFreeHeap();
+        doc["largest_free_block"] = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
         doc["chip_model"] = ESP.getChipModel();
         doc["firmware_version"] = firmwareVersion;
         doc["build_date"] = buildDate;
@@ -171,8 +294,71 @@ void setupWebServer() {
         request->send(response);
     });
     
+    server.on("/api/timers", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "application/json", timerService.getTimersJSON());
+    });
+    
+    server.on("/api/alerts", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "application/json", alertRules.getActiveAlertsJSON());
+    });
+    
+    server.on("/api/alerts/log", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "application/json", alertRules.getAlertLogJSON());
+    });
+    
+    server.on("/api/memory", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "application/json", MemoryPolicy::getStatsJSON());
+    });
+    
+    server.on("/api/memory/history", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "application/json", MemoryPolicy::heap().getHistoryJSON());
+    });
+    
+    server.on("/api/leds", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "application/json", ledController.getStripJSON());
+    });
+    
+    server.on("/api/history", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "application/json", historyStore.getStatusJSON());
+    });
+    
+    server.on("/api/history/temperature", HTTP_GET, handleHistoryQuery);
+    
+    server.on("/api/boot", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "application/json", bootProfiler.getReportJSON());
+    });
+    
+    // USB stick files, streamed in constant memory: GET honours Range, POST takes
+    // an application/octet-stream body or a multipart form, DELETE removes.
+    // The rest of the URL is the path on the stick.
+    server.on("/api/usb/files/*", HTTP_GET, handleUSBFileDownload);
+    
+    server.on("/api/usb/files/*", HTTP_POST, handleUSBFileUploaded,
+        [](AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool) {
+            writeUSBUpload(request, filename, data, len, index, request->contentLength());
+        },
+        [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+            writeUSBUpload(request, String(), data, len, index, total);
+        });
+    
+    server.on("/api/usb/files/*", HTTP_DELETE, [](AsyncWebServerRequest *request) {
+        String path = usbFilePath(request);
+        uint64_t size;
+        bool directory;
+        if (!usbManager.isMounted()) {
+            request->send(503, "application/json", "{\"error\":\"USB not mounted\"}");
+        } else if (!usbManager.statFile(path, &size, &directory)) {
+            request->send(404, "application/json", "{\"error\":\"not found\"}");
+        } else if (!usbManager.deleteFile(path)) {
+            request->send(409, "application/json", "{\"error\":\"delete failed\"}");
+        } else {
+            request->send(200, "application/json", "{\"status\":\"deleted\"}");
+        }
+    });
+    
     server.on("/api/restart", HTTP_POST, [](AsyncWebServerRequest *request) {
         request->send(200, "application/json", "{\"status\":\"restarting\"}");
+        historyStore.flush();
         delay(1000);
         ESP.restart();
     });
@@ -192,6 +378,22 @@ void setupWebServer() {
     ws.onEvent(handleWebSocketEvent);
     server.addHandler(&ws);
     
+    // USB serial console: binary frames carry the data both ways, text
+    // frames are JSON control messages
+    serialSocket.onEvent(handleSerialSocketEvent);
+    server.addHandler(&serialSocket);
+    serialBridge.onOutput([](const uint8_t *data, size_t length) {
+        // Nobody listening: the console is live only, drop it
+        if (serialSocket.count() == 0) return true;
+        if (!serialSocket.availableForWriteAll()) return false;
+        serialSocket.binaryAll(data, length);
+        return true;
+    });
+    
+    server.on("/api/serial", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "application/json", serialBridge.getStatusJSON());
+    });
+    
     // Error handling
     server.onNotFound([](AsyncWebServerRequest *request) {
         request->send(404, "text/plain", "Not found");
@@ -227,8 +429,74 @@ void handleWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client,
     }
 }
 
+void handleSerialSocketEvent(AsyncWebSocket *, AsyncWebSocketClient *client,
+                             AwsEventType type, void *arg, uint8_t *data, size_t len) {
+    switch (type) {
+        case WS_EVT_CONNECT:
+            Serial.printf("Serial console client #%u connected from %s\n",
+                         client->id(), client->remoteIP().toString().c_str());
+            client->text("{\"type\":\"serial_status\",\"data\":" + serialBridge.getStatusJSON() + "}");
+            break;
+            
+        case WS_EVT_DISCONNECT:
+            Serial.printf("Serial console client #%u disconnected\n", client->id());
+            break;
+            
+        case WS_EVT_DATA: {
+            // Binary fragments go to the device as they come
+            AwsFrameInfo *info = (AwsFrameInfo*)arg;
+            if (info->message_opcode == WS_BINARY) {
+                serialBridge.write(data, len);
+            } else if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT) {
+                data[len] = 0;
+                handleSerialControl(client, String((char*)data));
+            }
+            break;
+        }
+        
+        case WS_EVT_PONG:
+        case WS_EVT_ERROR:
+            break;
+    }
+}
+
+// {"type":"line_coding","baud":115200,"data_bits":8,"parity":"none","stop_bits":1},
+// {"type":"control_lines","dtr":true,"rts":false} or {"type":"get_status"}
+void handleSerialControl(AsyncWebSocketClient *client, const String& message) {
+    JsonDocument doc(MemoryPolicy::json());
+    if (deserializeJson(doc, message)) {
+        client->text("{\"type\":\"error\",\"message\":\"invalid JSON\"}");
+        return;
+    }
+    
+    String type = doc["type"];
+    if (type == "line_coding") {
+        SerialLineCoding coding = serialBridge.getLineCoding();
+        coding.baud = doc["baud"] | coding.baud;
+        coding.dataBits = doc["data_bits"] | coding.dataBits;
+        if (doc["parity"].is<const char*>()) {
+            int parity = SerialBridge::parseParity(doc["parity"].as<String>());
+            coding.parity = parity < 0 ? 0xFF : parity;
+        }
+        if (!doc["stop_bits"].isNull()) {
+            float stopBits = doc["stop_bits"];
+            coding.stopBits = stopBits == 1.0f ? 0 : stopBits == 1.5f ? 1 : stopBits == 2.0f ? 2 : 0xFF;
+        }
+        if (!serialBridge.setLineCoding(coding)) {
+            client->text("{\"type\":\"error\",\"message\":\"unsupported line coding\"}");
+            return;
+        }
+    } else if (type == "control_lines") {
+        serialBridge.setControlLines(doc["dtr"] | true, doc["rts"] | true);
+    } else if (type != "get_status") {
+        client->text("{\"type\":\"error\",\"message\":\"unknown message type\"}");
+        return;
+    }
+    client->text("{\"type\":\"serial_status\",\"data\":" + serialBridge.getStatusJSON() + "}");
+}
+
 void handleWebSocketMessage(AsyncWebSocketClient *client, const String& message) {
-    DynamicJsonDocument doc(1024);
+    JsonDocument doc(MemoryPolicy::json());
     DeserializationError error = deserializeJson(doc, message);
     
     if (error) {
@@ -244,13 +512,25 @@ void handleWebSocketMessage(AsyncWebSocketClient *client, const String& message)
     }
     else if (type == "rgb_color") {
         String color = doc["color"];
-        ledController.setRGBColorHex(color);
-        configManager.setDefaultColor(color);
+        if (doc["zone"].is<const char*>()) {
+            // Zone colours are not persisted, the saved default covers the whole strip
+            ledController.setZoneColor(doc["zone"].as<String>(), ledController.hexToColor(color));
+        } else {
+            ledController.setRGBColorHex(color);
+            configManager.setDefaultColor(color);
+        }
     }
     else if (type == "rgb_mode") {
         String mode = doc["mode"];
-        ledController.setMode(mode);
-        configManager.setDefaultLEDMode(mode);
+        LEDMode parsed;
+        if (doc["zone"].is<const char*>()) {
+            if (LEDController::parseMode(mode, parsed)) {
+                ledController.setZoneMode(doc["zone"].as<String>(), parsed);
+            }
+        } else {
+            ledController.setMode(mode);
+            configManager.setDefaultLEDMode(mode);
+        }
     }
     else if (type == "rgb_brightness") {
         uint8_t brightness = doc["value"];
@@ -298,17 +578,156 @@ void handleWebSocketMessage(AsyncWebSocketClient *client, const String& message)
             configManager.setTemperatureThreshold(value.toFloat());
         } else if (setting == "hourly_alert") {
             configManager.setHourlyAlertEnabled(doc["value"].as<bool>());
+        } else if (setting == "temp_low_threshold") {
+            configManager.setLowTemperatureThreshold(value.toFloat());
+        } else if (setting == "temp_hysteresis") {
+            configManager.setTemperatureHysteresis(value.toFloat());
+        } else if (setting == "temp_rate_threshold") {
+            configManager.setTemperatureRateThreshold(value.toFloat());
+        } else if (setting == "alert_min_duration") {
+            configManager.setAlertMinDuration(value.toInt());
+        } else if (setting == "high_temp_alert") {
+            configManager.setHighTempAlertEnabled(doc["value"].as<bool>());
+        } else if (setting == "low_temp_alert") {
+            configManager.setLowTempAlertEnabled(doc["value"].as<bool>());
+        } else if (setting == "rate_alert") {
+            configManager.setRateAlertEnabled(doc["value"].as<bool>());
+        } else if (setting == "wifi_disconnect_alert") {
+            configManager.setWiFiDisconnectAlertEnabled(doc["value"].as<bool>());
         }
         
         configManager.saveConfig();
+        // Rules and their pending-duration timers belong to the loop task
+        timerService.cancelByPrefix("reload_alert_rules");
+        timerService.after(0, loadAlertRules, "reload_alert_rules");
+    }
+    else if (type == "update_schedules") {
+        // The config document and the schedule timers belong to the loop task,
+        // so the posted array travels there as text; the newest post wins
+        String schedules;
+        serializeJson(doc["schedules"], schedules);
+        timerService.cancelByPrefix("reload_schedules");
+        timerService.after(0, [schedules]() {
+            JsonDocument posted(MemoryPolicy::json());
+            if (deserializeJson(posted, schedules)) {
+                Serial.println("Posted schedules no longer parse, keeping the old ones");
+                return;
+            }
+            configManager.setSchedules(posted.as<JsonArrayConst>());
+            configManager.saveConfig();
+            loadUserSchedules();
+        }, "reload_schedules");
+        client->text("{\"type\":\"schedules_saved\",\"status\":\"success\"}");
+    }
+    else if (type == "get_timers") {
+        client->text("{\"type\":\"timers\",\"data\":" + timerService.getTimersJSON() + "}");
+    }
+    else if (type.startsWith("led_sequence_")) {
+        handleSequenceMessage(client, type, doc);
     }
     else {
         Serial.printf("Unknown WebSocket message type: %s\n", type.c_str());
     }
 }
 
+void sendJsonMessage(AsyncWebSocketClient *client, JsonDocument& doc) {
+    // Serialize into a pooled PSRAM buffer instead of growing a String on the internal heap
+    size_t length = measureJson(doc);
+    char* buffer = length < MemoryPolicy::wsBuffers().getBufferSize() ? MemoryPolicy::wsBuffers().acquire() : nullptr;
+    
+    if (buffer) {
+        serializeJson(doc, buffer, MemoryPolicy::wsBuffers().getBufferSize());
+        if (client) {
+            client->text(buffer, length);
+        } else {
+            ws.textAll(buffer, length);
+        }
+        MemoryPolicy::wsBuffers().release(buffer);
+        return;
+    }
+    
+    String response;
+    serializeJson(doc, response);
+    
+    if (client) {
+        client->text(response);
+    } else {
+        ws.textAll(response);
+    }
+}
+
+void handleSequenceMessage(AsyncWebSocketClient *client, const String& type, JsonDocument& doc) {
+    String name = doc["name"] | "";
+    JsonDocument reply(MemoryPolicy::json());
+    reply["type"] = "led_sequence";
+    reply["name"] = name;
+    
+    if (type == "led_sequence_stop") {
+        ledController.requestSequence("");
+        reply["event"] = "stopped";
+        sendJsonMessage(client, reply);
+        return;
+    }
+    if (!LedSequence::isValidName(name)) {
+        reply["event"] = "error";
+        reply["error"] = "name must be 1-16 letters, digits, - or _";
+        sendJsonMessage(client, reply);
+        return;
+    }
+    
+    if (type == "led_sequence_upload") {
+        // Bytecode arrives hex-encoded; decode into a pooled buffer rather than the stack
+        uint8_t *buffer = (uint8_t*)MemoryPolicy::wsBuffers().acquire();
+        size_t length = 0;
+        String error;
+        if (!buffer) {
+            error = "busy";
+        } else if (!LedSequence::fromHex(doc["data"] | "", buffer, LEDSEQ_MAX_SIZE, length)) {
+            error = "data must be hex, at most " + String(LEDSEQ_MAX_SIZE) + " bytes";
+        } else if (LedSequence::validate(buffer, length, error)) {
+            if (!LedSequence::saveFile(name, buffer, length)) error = "write failed";
+        }
+        if (buffer) MemoryPolicy::wsBuffers().release((char*)buffer);
+        
+        if (error.length() > 0) {
+            reply["event"] = "error";
+            reply["error"] = error;
+        } else {
+            reply["event"] = "saved";
+            reply["bytes"] = length;
+            if (doc["play"] | false) ledController.requestSequence(name);
+        }
+    }
+    else if (type == "led_sequence_play") {
+        ledController.requestSequence(name);
+        reply["event"] = "queued";
+    }
+    else if (type == "led_sequence_delete") {
+        reply["event"] = LedSequence::removeFile(name) ? "deleted" : "error";
+    }
+    else if (type == "led_sequence_disassemble") {
+        File file = SPIFFS.open(LedSequence::pathFor(name), "r");
+        uint8_t *buffer = (uint8_t*)MemoryPolicy::wsBuffers().acquire();
+        if (file && buffer) {
+            size_t length = file.read(buffer, LEDSEQ_MAX_SIZE);
+            reply["event"] = "listing";
+            reply["listing"] = LedSequence::disassemble(buffer, length);
+        } else {
+            reply["event"] = "error";
+            reply["error"] = file ? "busy" : "not found";
+        }
+        if (file) file.close();
+        if (buffer) MemoryPolicy::wsBuffers().release((char*)buffer);
+    }
+    else {
+        reply["event"] = "error";
+        reply["error"] = "unknown command";
+    }
+    sendJsonMessage(client, reply);
+}
+
 void sendStatusUpdate(AsyncWebSocketClient *client) {
-    DynamicJsonDocument doc(2048);
+    JsonDocument doc(MemoryPolicy::json());
     doc["type"] = "status";
     doc["uptime"] = formatUptime(millis());
     doc["wifi"] = wifiMgr.isWiFiConnected() ? "Connected" : "Disconnected";
@@ -321,18 +740,11 @@ void sendStatusUpdate(AsyncWebSocketClient *client) {
     doc["free_heap"] = ESP.getFreeHeap();
     doc["chip_model"] = ESP.getChipModel();
     
-    String response;
-    serializeJson(doc, response);
-    
-    if (client) {
-        client->text(response);
-    } else {
-        ws.textAll(response);
-    }
+    sendJsonMessage(client, doc);
 }
 
 void sendTemperatureData(AsyncWebSocketClient *client) {
-    DynamicJsonDocument doc(2048);
+    JsonDocument doc(MemoryPolicy::json());
     doc["type"] = "temperature";
     doc["current"] = tempSensor.getCurrentTemperature();
     doc["max"] = tempSensor.getMaxTemperature();
@@ -340,34 +752,20 @@ void sendTemperatureData(AsyncWebSocketClient *client) {
     doc["valid"] = tempSensor.isTemperatureValid();
     doc["log"] = tempSensor.getLogJSON(100);
     
-    String response;
-    serializeJson(doc, response);
-    
-    if (client) {
-        client->text(response);
-    } else {
-        ws.textAll(response);
-    }
+    sendJsonMessage(client, doc);
 }
 
 void sendWiFiScanData(AsyncWebSocketClient *client) {
-    DynamicJsonDocument doc(2048);
+    JsonDocument doc(MemoryPolicy::json());
     doc["type"] = "wifi_scan";
     doc["networks"] = wifiMgr.getScanResultsJSON();
     doc["saved"] = wifiMgr.getSavedNetworksJSON();
     
-    String response;
-    serializeJson(doc, response);
-    
-    if (client) {
-        client->text(response);
-    } else {
-        ws.textAll(response);
-    }
+    sendJsonMessage(client, doc);
 }
 
 void sendUSBStatusData(AsyncWebSocketClient *client) {
-    DynamicJsonDocument doc(2048);
+    JsonDocument doc(MemoryPolicy::json());
     doc["type"] = "usb_status";
     doc["mounted"] = usbManager.isMounted();
     
@@ -378,18 +776,401 @@ void sendUSBStatusData(AsyncWebSocketClient *client) {
         doc["files"] = usbManager.listFiles();
     }
     
-    String response;
-    serializeJson(doc, response);
+    sendJsonMessage(client, doc);
+}
+
+// ?from=&to= in epoch seconds (default: the day up to the newest reading),
+// &step= seconds per bucket (default: HISTORY_QUERY_POINTS buckets)
+void handleHistoryQuery(AsyncWebServerRequest *request) {
+    uint32_t to = historyStore.getNewestTime();
+    if (request->hasParam("to")) {
+        to = strtoul(request->getParam("to")->value().c_str(), nullptr, 10);
+    }
+    uint32_t from = to > 86400 ? to - 86400 : 0;
+    if (request->hasParam("from")) {
+        from = strtoul(request->getParam("from")->value().c_str(), nullptr, 10);
+    }
+    uint32_t step = 0;
+    if (request->hasParam("step")) {
+        step = strtoul(request->getParam("step")->value().c_str(), nullptr, 10);
+    }
     
-    if (client) {
-        client->text(response);
-    } else {
-        ws.textAll(response);
+    JsonDocument doc(MemoryPolicy::json());
+    if (!historyStore.query(doc, from, to, step)) {
+        request->send(400, "application/json",
+                      "{\"error\":\"from must not be after to, and at most " + String(HISTORY_QUERY_MAX_POINTS) + " buckets\"}");
+        return;
+    }
+    AsyncResponseStream *response = request->beginResponseStream("application/json");
+    serializeJson(doc, *response);
+    request->send(response);
+}
+
+// Path on the stick for a /api/usb/files/... URL, without trailing slashes
+String usbFilePath(AsyncWebServerRequest *request) {
+    String path = request->url().substring(strlen("/api/usb/files"));
+    while (path.length() > 1 && path.endsWith("/")) {
+        path.remove(path.length() - 1);
+    }
+    return path;
+}
+
+static String usbContentType(const String& path) {
+    String name = path;
+    name.toLowerCase();
+    if (name.endsWith(".txt") || name.endsWith(".log")) return "text/plain";
+    if (name.endsWith(".csv")) return "text/csv";
+    if (name.endsWith(".json")) return "application/json";
+    if (name.endsWith(".html") || name.endsWith(".htm")) return "text/html";
+    if (name.endsWith(".png")) return "image/png";
+    if (name.endsWith(".jpg") || name.endsWith(".jpeg")) return "image/jpeg";
+    if (name.endsWith(".pdf")) return "application/pdf";
+    return "application/octet-stream";
+}
+
+enum ByteRange {
+    RANGE_NONE,
+    RANGE_PARTIAL,
+    RANGE_UNSATISFIABLE
+};
+
+// "bytes=a-b", "bytes=a-" or "bytes=-n". Malformed headers and multiple
+// ranges are ignored, which serves the whole file as RFC 9110 allows.
+static ByteRange parseByteRange(const String& header, uint64_t size, uint64_t *start, uint64_t *length) {
+    int dash = header.indexOf('-');
+    if (!header.startsWith("bytes=") || dash < 0 || header.indexOf(',') >= 0) return RANGE_NONE;
+
+    String first = header.substring(6, dash);
+    String last = header.substring(dash + 1);
+    first.trim();
+    last.trim();
+
+    if (first.isEmpty()) {
+        uint64_t suffix = strtoull(last.c_str(), nullptr, 10);
+        if (last.isEmpty()) return RANGE_NONE;
+        if (suffix == 0 || size == 0) return RANGE_UNSATISFIABLE;
+        *length = min(suffix, size);
+        *start = size - *length;
+        return RANGE_PARTIAL;
+    }
+
+    uint64_t from = strtoull(first.c_str(), nullptr, 10);
+    uint64_t to = last.isEmpty() ? size - 1 : strtoull(last.c_str(), nullptr, 10);
+    if (from >= size) return RANGE_UNSATISFIABLE;
+    if (to < from) return RANGE_NONE;
+    *start = from;
+    *length = min(to, size - 1) - from + 1;
+    return RANGE_PARTIAL;
+}
+
+// State of one paged listing response; deleted when the client goes away
+struct USBListPage {
+    int handle;
+    uint32_t generation;
+    uint32_t start;
+    uint32_t next;          // Next entry to serialize
+    uint32_t end;
+    uint8_t stage;          // 0 header, 1 entries, 2 footer, 3 done
+    String pending;
+    size_t sent;
+};
+
+static const char *usbSortName(USBListSort sort) {
+    return sort == USB_SORT_SIZE ? "size" : sort == USB_SORT_MODIFIED ? "modified" : "name";
+}
+
+// Next piece of the page into page->pending; false once the page is complete
+static bool fillUSBListPage(USBListPage *page, const USBListSnapshot *snapshot) {
+    page->pending = "";
+    page->sent = 0;
+    char cursor[24];
+
+    if (page->stage == 0) {
+        JsonDocument doc(MemoryPolicy::json());
+        doc["path"] = snapshot->path;
+        if (snapshot->state == USB_LIST_FAILED) {
+            doc["error"] = snapshot->error == FR_NO_PATH || snapshot->error == FR_NO_FILE ? "not found" : "read failed";
+            serializeJson(doc, page->pending);
+            page->stage = 3;
+            return true;
+        }
+        snprintf(cursor, sizeof(cursor), "%u-%u", (unsigned)page->generation, (unsigned)page->next);
+        doc["sort"] = usbSortName(snapshot->sort);
+        doc["order"] = snapshot->descending ? "desc" : "asc";
+        doc["generation"] = page->generation;
+        doc["total"] = snapshot->count;
+        doc["truncated"] = snapshot->truncated;
+        doc["cursor"] = cursor;
+        serializeJson(doc, page->pending);
+        page->pending.remove(page->pending.length() - 1);
+        page->pending += ",\"files\":[";
+        page->stage = 1;
+        return true;
+    }
+
+    if (page->stage == 1) {
+        // A few entries per piece keeps pending well under a TCP segment
+        for (int i = 0; i < 8 && page->next < page->end; i++, page->next++) {
+            const USBListEntry &entry = snapshot->entries[page->next];
+            JsonDocument doc(MemoryPolicy::json());
+            doc["name"] = snapshot->names + entry.name;
+            doc["size"] = entry.size;
+            doc["type"] = entry.directory ? "directory" : "file";
+            uint16_t date = entry.modified >> 16;
+            uint16_t time = entry.modified & 0xFFFF;
+            if (date) {
+                char modified[20];
+                snprintf(modified, sizeof(modified), "%04u-%02u-%02uT%02u:%02u:%02u", (date >> 9) + 1980,
+                         (date >> 5) & 15, date & 31, time >> 11, (time >> 5) & 63, (time & 31) * 2);
+                doc["modified"] = modified;
+            }
+            String item;
+            serializeJson(doc, item);
+            if (page->next > page->start) {
+                page->pending += ",";
+            }
+            page->pending += item;
+        }
+        if (page->next == page->end) {
+            page->stage = 2;
+        }
+        return true;
+    }
+
+    if (page->stage == 2) {
+        page->pending = "],\"next_cursor\":";
+        if (page->end < snapshot->count) {
+            snprintf(cursor, sizeof(cursor), "\"%u-%u\"", (unsigned)page->generation, (unsigned)page->end);
+            page->pending += cursor;
+        } else {
+            page->pending += "null";
+        }
+        page->pending += "}";
+        page->stage = 3;
+        return true;
+    }
+    return false;
+}
+
+// GET on a directory: one page of a sorted snapshot taken by the USB task.
+// ?sort=name|size|modified&order=asc|desc&limit=N, then ?cursor= from the
+// previous page's next_cursor. A cursor pages the snapshot it came from, so
+// pages stay consistent while files change, until that snapshot is recycled.
+void handleUSBListing(AsyncWebServerRequest *request, const String &path) {
+    USBListSort sort = USB_SORT_NAME;
+    bool descending = false;
+    uint32_t limit = USB_LIST_PAGE_DEFAULT;
+    unsigned cursorGeneration = 0;
+    unsigned cursorIndex = 0;
+
+    if (request->hasParam("sort")) {
+        String value = request->getParam("sort")->value();
+        if (value == "size") {
+            sort = USB_SORT_SIZE;
+        } else if (value == "modified") {
+            sort = USB_SORT_MODIFIED;
+        } else if (value != "name") {
+            request->send(400, "application/json", "{\"error\":\"sort is name, size or modified\"}");
+            return;
+        }
+    }
+    if (request->hasParam("order")) {
+        descending = request->getParam("order")->value() == "desc";
+    }
+    if (request->hasParam("limit")) {
+        long value = request->getParam("limit")->value().toInt();
+        limit = value < 1 ? 1 : value > USB_LIST_PAGE_MAX ? USB_LIST_PAGE_MAX : value;
+    }
+    if (request->hasParam("cursor")) {
+        const String &value = request->getParam("cursor")->value();
+        if (sscanf(value.c_str(), "%u-%u", &cursorGeneration, &cursorIndex) != 2 || cursorGeneration == 0) {
+            request->send(400, "application/json", "{\"error\":\"bad cursor\"}");
+            return;
+        }
+    }
+
+    int handle = usbManager.acquireListing(path, sort, descending, cursorGeneration);
+    if (handle == USB_LIST_EXPIRED) {
+        request->send(410, "application/json", "{\"error\":\"cursor expired\"}");
+        return;
+    }
+    if (handle < 0) {
+        request->send(503, "application/json", "{\"error\":\"USB busy\"}");
+        return;
+    }
+
+    USBListPage *page = new USBListPage();
+    page->handle = handle;
+    page->start = cursorIndex;
+    page->next = cursorIndex;
+    page->end = cursorIndex + limit;
+    page->stage = 0;
+    page->sent = 0;
+
+    // The walk may still be running; the page is cut once the snapshot is sorted
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/json",
+        [page](uint8_t *buffer, size_t maxLen, size_t) -> size_t {
+            const USBListSnapshot *snapshot = usbManager.getListing(page->handle);
+            if (snapshot->state == USB_LIST_WALKING) return RESPONSE_TRY_AGAIN;
+            if (page->stage == 0) {
+                page->generation = snapshot->generation;
+                page->start = min(page->start, snapshot->count);
+                page->next = page->start;
+                page->end = min(page->end, snapshot->count);
+            }
+
+            size_t written = 0;
+            while (written < maxLen) {
+                if (page->sent == page->pending.length() && !fillUSBListPage(page, snapshot)) break;
+                size_t n = min(maxLen - written, (size_t)(page->pending.length() - page->sent));
+                memcpy(buffer + written, page->pending.c_str() + page->sent, n);
+                page->sent += n;
+                written += n;
+            }
+            return written;
+        });
+    request->onDisconnect([page]() {
+        usbManager.releaseListing(page->handle);
+        delete page;
+    });
+    request->send(response);
+}
+
+// Directories answer with a page of their listing. Files stream through the USB
+// manager's double buffer: the TCP stack drains one half while the USB task
+// fills the other, and gets RESPONSE_TRY_AGAIN if it catches up.
+void handleUSBFileDownload(AsyncWebServerRequest *request) {
+    String path = usbFilePath(request);
+    uint64_t size;
+    bool directory;
+    if (!usbManager.isMounted()) {
+        request->send(503, "application/json", "{\"error\":\"USB not mounted\"}");
+        return;
+    }
+    if (!usbManager.statFile(path, &size, &directory)) {
+        request->send(404, "application/json", "{\"error\":\"not found\"}");
+        return;
+    }
+    if (directory) {
+        handleUSBListing(request, path);
+        return;
+    }
+
+    char contentRange[64];
+    uint64_t start = 0;
+    uint64_t length = size;
+    ByteRange range = request->hasHeader("Range")
+        ? parseByteRange(request->header("Range"), size, &start, &length) : RANGE_NONE;
+    if (range == RANGE_UNSATISFIABLE) {
+        AsyncWebServerResponse *response = request->beginResponse(416, "text/plain", "Range not satisfiable");
+        snprintf(contentRange, sizeof(contentRange), "bytes */%llu", (unsigned long long)size);
+        response->addHeader("Content-Range", contentRange);
+        request->send(response);
+        return;
+    }
+
+    uint32_t stream = usbManager.openDownload(path, start, length);
+    if (!stream) {
+        request->send(503, "application/json", "{\"error\":\"USB busy\"}");
+        return;
     }
+
+    AsyncWebServerResponse *response = request->beginResponse(usbContentType(path), length,
+        [stream](uint8_t *buffer, size_t maxLen, size_t) -> size_t {
+            int32_t n = usbManager.readStream(stream, buffer, maxLen);
+            if (n == USB_STREAM_RETRY) return RESPONSE_TRY_AGAIN;
+            // 0 before the full length makes the server drop the connection
+            return n > 0 ? n : 0;
+        });
+    response->addHeader("Accept-Ranges", "bytes");
+    if (range == RANGE_PARTIAL) {
+        snprintf(contentRange, sizeof(contentRange), "bytes %llu-%llu/%llu", (unsigned long long)start,
+                 (unsigned long long)(start + length - 1), (unsigned long long)size);
+        response->setCode(206);
+        response->addHeader("Content-Range", contentRange);
+    }
+    request->onDisconnect([stream]() {
+        usbManager.closeStream(stream);
+    });
+    request->send(response);
+}
+
+// Kept in request->_tempObject between body callbacks; the request frees it
+struct USBUploadState {
+    uint32_t stream;
+    bool failed;
+    uint8_t parts;
+    char path[FF_MAX_LFN + 1];
+};
+
+// Body pieces arrive in order; the first opens the stream. Only the first
+// file of a multipart form is stored.
+void writeUSBUpload(AsyncWebServerRequest *request, const String& filename, const uint8_t *data,
+                    size_t len, size_t index, size_t total) {
+    USBUploadState *state = (USBUploadState *)request->_tempObject;
+    if (index == 0) {
+        if (state) {
+            state->parts++;
+            return;
+        }
+        state = (USBUploadState *)calloc(1, sizeof(USBUploadState));
+        if (!state) return;
+        request->_tempObject = state;
+        state->parts = 1;
+
+        // A form posted to a directory keeps the file's own name
+        String path = usbFilePath(request);
+        if (request->url().endsWith("/") && !filename.isEmpty()) {
+            path = (path == "/" ? String() : path) + "/" + filename;
+        }
+        strlcpy(state->path, path.c_str(), sizeof(state->path));
+
+        state->stream = usbManager.openUpload(path, total);
+        state->failed = !state->stream;
+        if (state->stream) {
+            uint32_t stream = state->stream;
+            // No-op once finished; removes the partial file if the client went away
+            request->onDisconnect([stream]() {
+                usbManager.closeStream(stream);
+            });
+        }
+    }
+
+    if (!state || state->failed || state->parts > 1) return;
+    if (!usbManager.writeStream(state->stream, data, len)) {
+        state->failed = true;
+    }
+}
+
+void handleUSBFileUploaded(AsyncWebServerRequest *request) {
+    USBUploadState *state = (USBUploadState *)request->_tempObject;
+    if (!usbManager.isMounted()) {
+        request->send(503, "application/json", "{\"error\":\"USB not mounted\"}");
+        return;
+    }
+
+    // An empty body never reaches the body callback; it still creates the file
+    String path = state ? String(state->path) : usbFilePath(request);
+    uint32_t stream = state ? state->stream : usbManager.openUpload(path, 0);
+    bool ok = stream && usbManager.finishUpload(stream) && !(state && state->failed);
+    if (!ok) {
+        request->send(500, "application/json", "{\"error\":\"upload failed\"}");
+        return;
+    }
+
+    uint64_t size = 0;
+    bool directory;
+    usbManager.statFile(path, &size, &directory);
+    JsonDocument doc(MemoryPolicy::json());
+    doc["path"] = path;
+    doc["size"] = size;
+    String body;
+    serializeJson(doc, body);
+    request->send(201, "application/json", body);
 }
 
 void handleSystemCommand(const String& command, AsyncWebSocketClient *client) {
-    DynamicJsonDocument response(512);
+    JsonDocument response(MemoryPolicy::json());
     response["type"] = "command_response";
     response["command"] = command;
     
@@ -448,59 +1229,203 @@ String formatUptime(unsigned long ms) {
     return uptime;
 }
 
-void performPeriodicTasks() {
-    static unsigned long lastTempCheck = 0;
-    static unsigned long lastWiFiCheck = 0;
-    static unsigned long lastHourlyCheck = 0;
-    
-    unsigned long now = millis();
+// Local epoch seconds, 0 until NTP has answered
+uint32_t wallClockNow() {
+    return timeClient.isTimeSet() ? (uint32_t)timeClient.getEpochTime() : 0;
+}
+
+void setupTimers() {
+    timerService.begin(wallClockNow);
     
-    // Update temperature sensor
-    tempSensor.update();
+    // Sensor sampling and LED animation frames
+    timerService.every(tempSensor.getReadingInterval(), []() { tempSensor.readTemperature(); }, "temp_read");
+    timerService.every(LED_FRAME_INTERVAL_MS, []() { ledController.update(); }, "led_update");
+    timerService.every(1000, []() {
+        // Unchanged colours cost nothing, the compositor drops identical frames
+        ledController.setStatusIndicator(wifiMgr.isWiFiConnected() ? CRGB::Green : CRGB::Orange);
+    }, "led_status");
     
-    // Update LED animations
-    ledController.update();
+    timerService.every(60000, checkWiFiConnection, "wifi_check");
+    timerService.every(10000, []() { sendStatusUpdate(); }, "status_push");
+    timerService.every(1000, []() {
+        ws.cleanupClients();
+        serialSocket.cleanupClients();
+    }, "ws_cleanup");
+    timerService.every(60000, []() { MemoryPolicy::heap().sample(); }, "heap_sample");
+    timerService.every(60000, []() { historyStore.archive(); }, "history_archive");
     
-    // Check temperature alerts
-    if (now - lastTempCheck >= 30000) { // Every 30 seconds
-        float temp = tempSensor.getCurrentTemperature();
-        float threshold = configManager.getTemperatureThreshold();
+    // NTPClient rate-limits itself; a successful sync may shift the wall clock
+    timerService.every(1000, []() {
+        static bool ntpStarted = false;
+        if (!wifiMgr.isWiFiConnected()) return;
         
-        if (temp > threshold) {
-            ledController.flashAlert(CRGB::Red, 2);
-            Serial.printf("High temperature alert: %.1f°C\n", temp);
+        if (!ntpStarted) {
+            timeClient.begin();
+            ntpStarted = true;
+            Serial.println("✓ NTP client initialized");
         }
-        
-        lastTempCheck = now;
+        if (timeClient.update()) {
+            timerService.notifyWallClockChanged();
+        }
+    }, "ntp_update");
+    
+#if FAST_BOOT
+    // Background association didn't make it, fall back to scan + hotspot
+    timerService.after(configManager.getWiFiTimeout(), checkWiFiConnection, "wifi_boot_timeout");
+#endif
+    
+    // Top of every hour, re-aligned whenever NTP corrects the clock
+    timerService.at(-1, 0, DAYS_EVERY, hourlyAlert, "hourly_alert");
+    
+    loadUserSchedules();
+    
+    // Alert rules are evaluated as samples arrive, not on a tick
+    alertRules.begin(&timerService);
+    alertRules.setActionHandler(handleAlertAction);
+    loadAlertRules();
+    
+    tempSensor.onReading([](float temperature, float ratePerMinute) {
+        alertRules.onSample("temperature", temperature);
+        alertRules.onSample("temperature_rate", ratePerMinute);
+        historyStore.append(wallClockNow(), temperature);
+    });
+    
+    // WiFi events arrive on the event task, hand them over through the queue
+    WiFi.onEvent([](WiFiEvent_t, WiFiEventInfo_t) {
+        alertRules.postSample("wifi_connected", 0);
+    }, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    WiFi.onEvent([](WiFiEvent_t, WiFiEventInfo_t) {
+        alertRules.postSample("wifi_connected", 1);
+    }, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    
+    // Hot-plug is handled on the USB task; clients hear about it from the loop
+    usbManager.onMountChange([](bool) {
+        sendUSBStatusData();
+        historyStore.archive();
+    });
+}
+
+void loadAlertRules() {
+    float hysteresis = configManager.getTemperatureHysteresis();
+    unsigned long minDuration = configManager.getAlertMinDuration();
+    const uint8_t allActions = ALERT_ACTION_LED | ALERT_ACTION_WS | ALERT_ACTION_LOG;
+    
+    alertRules.clearRules();
+    
+    if (configManager.getHighTempAlertEnabled()) {
+        alertRules.addRule("high_temp", "temperature", ALERT_ABOVE,
+                           configManager.getTemperatureThreshold(), hysteresis, minDuration,
+                           allActions, 0xFF0000);
+    }
+    if (configManager.getLowTempAlertEnabled()) {
+        alertRules.addRule("low_temp", "temperature", ALERT_BELOW,
+                           configManager.getLowTemperatureThreshold(), hysteresis, minDuration,
+                           allActions, 0x0000FF);
+    }
+    if (configManager.getRateAlertEnabled()) {
+        alertRules.addRule("temp_rising", "temperature_rate", ALERT_ABOVE,
+                           configManager.getTemperatureRateThreshold(), 0.5, minDuration,
+                           allActions, 0xFF8000);
+    }
+    if (configManager.getWiFiDisconnectAlertEnabled()) {
+        alertRules.addRule("wifi_disconnect", "wifi_connected", ALERT_BELOW,
+                           0.5, 0.0, 10000, allActions, 0xFFFF00);
     }
     
-    // WiFi connection monitoring
-    if (now - lastWiFiCheck >= 60000) { // Every minute
-        if (!wifiMgr.isWiFiConnected()) {
-            Serial.println("WiFi disconnected, attempting reconnection...");
-            wifiMgr.handleAutoConnect();
-            ledController.flashAlert(CRGB::Yellow, 1);
+    ledController.clearAlertOverlay();
+    Serial.printf("Loaded %u alert rules\n", (unsigned)alertRules.getRuleCount());
+}
+
+void handleAlertAction(const AlertRule& rule, bool raised, float value) {
+    if (rule.actions & ALERT_ACTION_LED) {
+        uint32_t color;
+        if (alertRules.getOverlayColor(color)) {
+            ledController.setAlertOverlay(CRGB(color));
+        } else {
+            ledController.clearAlertOverlay();
         }
-        lastWiFiCheck = now;
     }
     
-    // Hourly alerts
-    if (configManager.getHourlyAlertEnabled() && now - lastHourlyCheck >= 3600000) { // Every hour
-        time_t rawTime;
-        struct tm timeInfo;
-        time(&rawTime);
-        localtime_r(&rawTime, &timeInfo);
+    if (rule.actions & ALERT_ACTION_WS) {
+        JsonDocument doc(MemoryPolicy::json());
+        doc["type"] = "alert";
+        doc["rule"] = rule.name;
+        doc["event"] = raised ? "raised" : "cleared";
+        doc["metric"] = rule.metric;
+        doc["value"] = value;
+        doc["threshold"] = rule.threshold;
         
-        if (timeInfo.tm_min == 0) { // Top of the hour
-            ledController.flashAlert(CRGB::Cyan, 3);
-            Serial.println("Hourly alert triggered");
+        sendJsonMessage(nullptr, doc);
+    }
+}
+
+void loadUserSchedules() {
+    timerService.cancelByPrefix("user:");
+    
+    int loaded = 0;
+    for (JsonObject schedule : configManager.getSchedules()) {
+        if (!(schedule["enabled"] | true)) continue;
+        
+        String name = schedule["name"] | "schedule";
+        String when = schedule["time"] | "";
+        int colon = when.indexOf(':');
+        if (colon < 0) {
+            Serial.printf("Skipping schedule '%s': invalid time '%s'\n", name.c_str(), when.c_str());
+            continue;
         }
         
-        lastHourlyCheck = now;
+        // "*:MM" runs every hour at minute MM
+        String hourStr = when.substring(0, colon);
+        int8_t hour = hourStr == "*" ? -1 : hourStr.toInt();
+        int8_t minute = when.substring(colon + 1).toInt();
+        uint8_t days = TimerService::parseDayMask(schedule["days"] | "daily");
+        String action = schedule["action"] | "";
+        String value = schedule["value"] | "";
+        
+        uint32_t id = timerService.at(hour, minute, days, [action, value]() {
+            applyScheduleAction(action, value);
+        }, "user:" + name);
+        
+        if (id != INVALID_TIMER_ID) loaded++;
     }
     
-    // Update NTP time
-    timeClient.update();
+    Serial.printf("Loaded %d user schedules\n", loaded);
+}
+
+void applyScheduleAction(const String& action, const String& value) {
+    Serial.printf("Schedule action: %s = %s\n", action.c_str(), value.c_str());
+    
+    if (action == "rgb_color") {
+        ledController.setRGBColorHex(value);
+    } else if (action == "rgb_mode") {
+        ledController.setMode(value);
+    } else if (action == "rgb_brightness") {
+        ledController.setRGBBrightness(value.toInt());
+    } else if (action == "large_led") {
+        ledController.setLargeLedState(value == "on" || value == "true" || value == "1");
+    } else if (action == "large_led_brightness") {
+        ledController.setLargeLedBrightness(value.toInt());
+    } else if (action == "flash") {
+        ledController.flashAlert(ledController.hexToColor(value), 3);
+    } else if (action == "led_sequence") {
+        ledController.requestSequence(value);
+    } else {
+        Serial.printf("Unknown schedule action: %s\n", action.c_str());
+    }
+}
+
+void checkWiFiConnection() {
+    if (!wifiMgr.isWiFiConnected()) {
+        Serial.println("WiFi disconnected, attempting reconnection...");
+        wifiMgr.handleAutoConnect();
+    }
+}
+
+void hourlyAlert() {
+    if (!configManager.getHourlyAlertEnabled()) return;
+    
+    ledController.flashAlert(CRGB::Cyan, 3);
+    Serial.println("Hourly alert triggered");
 }
 
 void loop() {
@@ -509,21 +1434,10 @@ void loop() {
         return;
     }
     
-    // Handle periodic tasks
-    if (millis() - lastPeriodicCheck >= 1000) { // Every second
-        performPeriodicTasks();
-        lastPeriodicCheck = millis();
-    }
-    
-    // Send periodic status updates
-    if (millis() - lastStatusUpdate >= 10000) { // Every 10 seconds
-        sendStatusUpdate();
-        lastStatusUpdate = millis();
-    }
-    
-    // Clean up WebSocket connections
-    ws.cleanupClients();
-    
-    // Small delay to prevent watchdog issues
-    delay(10);
+    // Drain cross-task samples, run whatever is due, then sleep until the next deadline
+    alertRules.processPending();
+    usbManager.processEvents();
+    serialBridge.service();
+    timerService.service();
+    timerService.sleepUntilNextDeadline(serialBridge.getMsUntilFlush(1000));
 }
@@ -0,0 +1,421 @@
+#include "memory_policy.h"
+#include "esp_heap_caps.h"
+
+#define ARENA_ALIGN 8
+#define ARENA_HEADER ((sizeof(size_t) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+
+static size_t alignUp(size_t size) {
+    return (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+// ---------------------------------------------------------------------------
+// PsramAllocator
+
+PsramAllocator::PsramAllocator() {
+    memset(&stats, 0, sizeof(stats));
+}
+
+void* PsramAllocator::allocate(size_t size) {
+    void* ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!ptr) {
+        ptr = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        stats.fallbacks++;
+    }
+    if (ptr) {
+        stats.allocations++;
+        stats.bytesInUse += heap_caps_get_allocated_size(ptr);
+        if (stats.bytesInUse > stats.peakBytes) stats.peakBytes = stats.bytesInUse;
+    }
+    return ptr;
+}
+
+void PsramAllocator::deallocate(void* ptr) {
+    if (!ptr) return;
+    stats.bytesInUse -= heap_caps_get_allocated_size(ptr);
+    heap_caps_free(ptr);
+}
+
+void* PsramAllocator::reallocate(void* ptr, size_t newSize) {
+    if (!ptr) return allocate(newSize);
+
+    size_t oldSize = heap_caps_get_allocated_size(ptr);
+    void* result = heap_caps_realloc(ptr, newSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!result) {
+        // Move to internal RAM rather than failing the document
+        result = heap_caps_malloc(newSize, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!result) return nullptr;
+        memcpy(result, ptr, oldSize < newSize ? oldSize : newSize);
+        heap_caps_free(ptr);
+        stats.fallbacks++;
+    }
+
+    stats.bytesInUse = stats.bytesInUse - oldSize + heap_caps_get_allocated_size(result);
+    if (stats.bytesInUse > stats.peakBytes) stats.peakBytes = stats.bytesInUse;
+    return result;
+}
+
+const AllocatorStats& PsramAllocator::getStats() {
+    return stats;
+}
+
+// ---------------------------------------------------------------------------
+// ArenaAllocator
+//
+// Block layout: [size_t size, padded to ARENA_ALIGN][payload]
+
+ArenaAllocator::ArenaAllocator(uint8_t* buffer, size_t size, ArduinoJson::Allocator* overflow) {
+    base = buffer;
+    capacity = size;
+    offset = 0;
+    lastOffset = SIZE_MAX;
+    outstanding = 0;
+    fallback = overflow;
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool ArenaAllocator::owns(void* ptr) {
+    return ptr >= base && ptr < base + capacity;
+}
+
+void* ArenaAllocator::allocate(size_t size) {
+    size_t need = ARENA_HEADER + alignUp(size);
+    if (offset + need > capacity) {
+        stats.fallbacks++;
+        return fallback->allocate(size);
+    }
+
+    uint8_t* block = base + offset;
+    *(size_t*)block = size;
+    lastOffset = offset;
+    offset += need;
+    outstanding++;
+
+    stats.allocations++;
+    stats.bytesInUse = offset;
+    if (offset > stats.peakBytes) stats.peakBytes = offset;
+    return block + ARENA_HEADER;
+}
+
+void ArenaAllocator::deallocate(void* ptr) {
+    if (!ptr) return;
+    if (!owns(ptr)) {
+        fallback->deallocate(ptr);
+        return;
+    }
+
+    size_t blockOffset = (uint8_t*)ptr - base - ARENA_HEADER;
+    if (blockOffset == lastOffset) {
+        offset = lastOffset;
+        lastOffset = SIZE_MAX;
+    }
+
+    // Rewind completely once the document that owned the arena is gone
+    if (--outstanding == 0) {
+        offset = 0;
+        lastOffset = SIZE_MAX;
+    }
+    stats.bytesInUse = offset;
+}
+
+void* ArenaAllocator::reallocate(void* ptr, size_t newSize) {
+    if (!ptr) return allocate(newSize);
+    if (!owns(ptr)) return fallback->reallocate(ptr, newSize);
+
+    uint8_t* block = (uint8_t*)ptr - ARENA_HEADER;
+    size_t blockOffset = block - base;
+    size_t oldSize = *(size_t*)block;
+
+    // The newest block can grow or shrink in place
+    if (blockOffset == lastOffset && blockOffset + ARENA_HEADER + alignUp(newSize) <= capacity) {
+        *(size_t*)block = newSize;
+        offset = blockOffset + ARENA_HEADER + alignUp(newSize);
+        stats.bytesInUse = offset;
+        if (offset > stats.peakBytes) stats.peakBytes = offset;
+        return ptr;
+    }
+
+    if (newSize <= oldSize) {
+        *(size_t*)block = newSize;
+        return ptr;
+    }
+
+    void* moved = allocate(newSize);
+    if (!moved) return nullptr;
+    memcpy(moved, ptr, oldSize);
+    deallocate(ptr);
+    return moved;
+}
+
+const AllocatorStats& ArenaAllocator::getStats() {
+    return stats;
+}
+
+size_t ArenaAllocator::getCapacity() {
+    return capacity;
+}
+
+bool ArenaAllocator::isEmpty() {
+    return outstanding == 0;
+}
+
+// ---------------------------------------------------------------------------
+// BufferPool
+
+BufferPool::BufferPool() {
+    for (int i = 0; i < WS_BUFFER_COUNT; i++) {
+        buffers[i] = nullptr;
+    }
+    inUse = 0;
+    lock = portMUX_INITIALIZER_UNLOCKED;
+    misses = 0;
+}
+
+bool BufferPool::begin() {
+    for (int i = 0; i < WS_BUFFER_COUNT; i++) {
+        buffers[i] = (char*)MemoryPolicy::psram()->allocate(WS_BUFFER_SIZE);
+        if (!buffers[i]) {
+            Serial.println("Failed to allocate WebSocket buffer pool");
+            return false;
+        }
+    }
+    return true;
+}
+
+char* BufferPool::acquire() {
+    char* result = nullptr;
+
+    portENTER_CRITICAL(&lock);
+    for (int i = 0; i < WS_BUFFER_COUNT; i++) {
+        if (buffers[i] && !(inUse & (1 << i))) {
+            inUse |= (1 << i);
+            result = buffers[i];
+            break;
+        }
+    }
+    if (!result) misses++;
+    portEXIT_CRITICAL(&lock);
+
+    return result;
+}
+
+void BufferPool::release(char* buffer) {
+    portENTER_CRITICAL(&lock);
+    for (int i = 0; i < WS_BUFFER_COUNT; i++) {
+        if (buffers[i] == buffer) {
+            inUse &= ~(1 << i);
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+size_t BufferPool::getBufferSize() {
+    return WS_BUFFER_SIZE;
+}
+
+uint32_t BufferPool::getMisses() {
+    return misses;
+}
+
+// ---------------------------------------------------------------------------
+// HeapMonitor
+
+HeapMonitor::HeapMonitor() {
+    head = 0;
+    count = 0;
+    minLargestBlock = UINT32_MAX;
+}
+
+void HeapMonitor::sample() {
+    HeapSample& s = history[head];
+    s.timestamp = millis();
+    s.internalFree = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    s.internalLargest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    s.psramFree = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+
+    if (s.internalLargest < minLargestBlock) minLargestBlock = s.internalLargest;
+
+    head = (head + 1) % HEAP_HISTORY_SIZE;
+    if (count < HEAP_HISTORY_SIZE) count++;
+}
+
+float HeapMonitor::getFragmentation() {
+    if (count == 0) return 0.0;
+
+    const HeapSample& s = history[(head + HEAP_HISTORY_SIZE - 1) % HEAP_HISTORY_SIZE];
+    if (s.internalFree == 0) return 0.0;
+    return 1.0 - (float)s.internalLargest / s.internalFree;
+}
+
+uint32_t HeapMonitor::getMinLargestBlock() {
+    return minLargestBlock;
+}
+
+String HeapMonitor::getHistoryJSON() {
+    JsonDocument doc(MemoryPolicy::json());
+    JsonArray samples = doc["samples"].to<JsonArray>();
+
+    size_t start = (head + HEAP_HISTORY_SIZE - count) % HEAP_HISTORY_SIZE;
+    for (size_t i = 0; i < count; i++) {
+        const HeapSample& s = history[(start + i) % HEAP_HISTORY_SIZE];
+        JsonArray row = samples.add<JsonArray>();
+        row.add(s.timestamp);
+        row.add(s.internalFree);
+        row.add(s.internalLargest);
+        row.add(s.psramFree);
+    }
+
+    String result;
+    serializeJson(doc, result);
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// MemoryPolicy
+
+// The name is copied when the slot is taken: the task may be gone by the time
+// the stats are read, and its handle must not be dereferenced then
+struct TaskArena {
+    TaskHandle_t task;
+    ArenaAllocator* arena;
+    uint8_t* buffer;
+    char name[ARENA_TASK_NAME_LEN];
+};
+
+static TaskArena taskArenas[MAX_TASK_ARENAS];
+static portMUX_TYPE arenaLock = portMUX_INITIALIZER_UNLOCKED;
+
+bool MemoryPolicy::begin() {
+    if (!psramFound()) {
+        Serial.println("WARNING: PSRAM not found, JSON documents will use internal RAM");
+    }
+
+    if (!wsBuffers().begin()) {
+        return false;
+    }
+
+    heap().sample();
+    return true;
+}
+
+PsramAllocator* MemoryPolicy::psram() {
+    static PsramAllocator allocator;
+    return &allocator;
+}
+
+ArduinoJson::Allocator* MemoryPolicy::json() {
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+
+    for (int i = 0; i < MAX_TASK_ARENAS; i++) {
+        if (taskArenas[i].task == task) {
+            return taskArenas[i].arena ? (ArduinoJson::Allocator*)taskArenas[i].arena : psram();
+        }
+    }
+
+    // First document on this task: give it an arena if a slot is left
+    int slot = -1;
+    portENTER_CRITICAL(&arenaLock);
+    for (int i = 0; i < MAX_TASK_ARENAS; i++) {
+        if (taskArenas[i].task == NULL) {
+            taskArenas[i].task = task;
+            slot = i;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&arenaLock);
+
+    if (slot < 0) {
+        return psram();
+    }
+
+    strlcpy(taskArenas[slot].name, pcTaskGetName(NULL), ARENA_TASK_NAME_LEN);
+    uint8_t* buffer = (uint8_t*)psram()->allocate(TASK_ARENA_SIZE);
+    if (!buffer) {
+        return psram();
+    }
+
+    ArenaAllocator* arena = new ArenaAllocator(buffer, TASK_ARENA_SIZE, psram());
+    portENTER_CRITICAL(&arenaLock);
+    taskArenas[slot].buffer = buffer;
+    taskArenas[slot].arena = arena;
+    portEXIT_CRITICAL(&arenaLock);
+    return arena;
+}
+
+void MemoryPolicy::releaseTaskArena() {
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    ArenaAllocator* arena = nullptr;
+    uint8_t* buffer = nullptr;
+
+    portENTER_CRITICAL(&arenaLock);
+    for (int i = 0; i < MAX_TASK_ARENAS; i++) {
+        if (taskArenas[i].task != task) continue;
+
+        // A document still alive on this task keeps the arena, and its slot, until it is freed
+        if (taskArenas[i].arena && !taskArenas[i].arena->isEmpty()) break;
+        arena = taskArenas[i].arena;
+        buffer = taskArenas[i].buffer;
+        taskArenas[i] = {};
+        break;
+    }
+    portEXIT_CRITICAL(&arenaLock);
+
+    delete arena;
+    if (buffer) psram()->deallocate(buffer);
+}
+
+BufferPool& MemoryPolicy::wsBuffers() {
+    static BufferPool pool;
+    return pool;
+}
+
+HeapMonitor& MemoryPolicy::heap() {
+    static HeapMonitor monitor;
+    return monitor;
+}
+
+String MemoryPolicy::getStatsJSON() {
+    JsonDocument doc(json());
+
+    doc["internal_free"] = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    doc["internal_largest_block"] = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    doc["internal_min_free"] = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    doc["min_largest_block"] = heap().getMinLargestBlock();
+    doc["fragmentation"] = heap().getFragmentation();
+    doc["psram_free"] = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+
+    const AllocatorStats& ps = psram()->getStats();
+    JsonObject p = doc["psram_allocator"].to<JsonObject>();
+    p["allocations"] = ps.allocations;
+    p["fallbacks"] = ps.fallbacks;
+    p["in_use"] = ps.bytesInUse;
+    p["peak"] = ps.peakBytes;
+
+    // Copied under the lock: a slot can be released by its task meanwhile
+    TaskArena slots[MAX_TASK_ARENAS];
+    AllocatorStats arenaStats[MAX_TASK_ARENAS];
+    portENTER_CRITICAL(&arenaLock);
+    for (int i = 0; i < MAX_TASK_ARENAS; i++) {
+        slots[i] = taskArenas[i];
+        if (slots[i].arena) arenaStats[i] = slots[i].arena->getStats();
+    }
+    portEXIT_CRITICAL(&arenaLock);
+
+    JsonArray arenas = doc["arenas"].to<JsonArray>();
+    for (int i = 0; i < MAX_TASK_ARENAS; i++) {
+        if (!slots[i].arena) continue;
+
+        JsonObject a = arenas.add<JsonObject>();
+        a["task"] = (const char*)slots[i].name;
+        a["capacity"] = TASK_ARENA_SIZE;
+        a["allocations"] = arenaStats[i].allocations;
+        a["overflows"] = arenaStats[i].fallbacks;
+        a["peak"] = arenaStats[i].peakBytes;
+    }
+
+    doc["ws_buffer_misses"] = wsBuffers().getMisses();
+
+    String result;
+    serializeJson(doc, result);
+    return result;
+}
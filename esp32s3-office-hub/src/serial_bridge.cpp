@@ -0,0 +1,331 @@
+#include "serial_bridge.h"
+#include "memory_policy.h"
+
+#define CONTROL_LINE_CODING 0x01
+#define CONTROL_LINE_STATE 0x02
+
+// The library's event callback carries no context, and there is one port
+static SerialBridge* activeBridge = nullptr;
+
+static const char* parityNames[] = {"none", "odd", "even", "mark", "space"};
+
+bool SerialBridge::begin(TimerService* timerService) {
+    timers = timerService;
+    lock = xSemaphoreCreateMutex();
+    if (!lock || !rx.begin(SERIAL_RING_SIZE) || !tx.begin(SERIAL_RING_SIZE)) {
+        Serial.println("Serial bridge: out of memory");
+        return false;
+    }
+    activeBridge = this;
+    return true;
+}
+
+void SerialBridge::onOutput(SerialOutput callback) {
+    output = callback;
+}
+
+// Runs on the library's client task
+void SerialBridge::eventCallback(int event, void* data, size_t length) {
+    SerialBridge* bridge = activeBridge;
+    if (!bridge) return;
+
+    if (event == CDC_DATA_IN) {
+        bridge->onData((const uint8_t*)data, length);
+    } else if (event == CDC_DATA_OUT) {
+        bridge->onWritten();
+    } else {
+        bridge->onControl();
+    }
+}
+
+void SerialBridge::attach(USBacmDevice* acm) {
+    // Bytes typed for the previous device are not meant for this one
+    writeBusy.store(true);
+    const uint8_t* span;
+    for (size_t n = tx.peek(&span); n > 0; n = tx.peek(&span)) {
+        tx.consume(n);
+    }
+
+    readBusy.store(false);
+    controlBusy.store(false);
+    controlPending.store(CONTROL_LINE_CODING | CONTROL_LINE_STATE);
+    sessionIn = stats.bytesIn;
+    sessionOut = stats.bytesOut;
+    attachedAtMs = millis();
+    ready = false;
+    acm->onEvent(eventCallback);
+    device = acm;
+    writeBusy.store(false);
+
+    // Data starts flowing once the device has taken both control requests
+    submitControl();
+}
+
+// In-flight transfers die with the device; attach() resets their flags
+void SerialBridge::detach() {
+    ready = false;
+    device = nullptr;
+}
+
+bool SerialBridge::isConnected() {
+    return device && ready;
+}
+
+size_t SerialBridge::write(const uint8_t* data, size_t length) {
+    if (!device) return 0;
+
+    size_t queued = tx.write(data, length);
+    if (queued < length) {
+        stats.dropped += length - queued;
+    }
+    submitWrite();
+    return queued;
+}
+
+bool SerialBridge::setLineCoding(const SerialLineCoding& lineCoding) {
+    bool bitsValid = (lineCoding.dataBits >= 5 && lineCoding.dataBits <= 8) || lineCoding.dataBits == 16;
+    if (lineCoding.baud == 0 || !bitsValid || lineCoding.parity > 4 || lineCoding.stopBits > 2) {
+        return false;
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    coding = lineCoding;
+    xSemaphoreGive(lock);
+    controlPending.fetch_or(CONTROL_LINE_CODING);
+    submitControl();
+    return true;
+}
+
+void SerialBridge::setControlLines(bool dtrState, bool rtsState) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    dtr = dtrState;
+    rts = rtsState;
+    xSemaphoreGive(lock);
+    controlPending.fetch_or(CONTROL_LINE_STATE);
+    submitControl();
+}
+
+SerialLineCoding SerialBridge::getLineCoding() {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    SerialLineCoding result = coding;
+    xSemaphoreGive(lock);
+    return result;
+}
+
+// The device has one control transfer; whoever claims controlBusy sends the
+// next pending request and the completion sends the one after
+void SerialBridge::submitControl() {
+    USBacmDevice* acm = device;
+    if (!acm || controlPending.load() == 0) return;
+    bool idle = false;
+    if (!controlBusy.compare_exchange_strong(idle, true)) return;
+
+    uint8_t pending = controlPending.load();
+    xSemaphoreTake(lock, portMAX_DELAY);
+    SerialLineCoding lineCoding = coding;
+    bool dtrState = dtr;
+    bool rtsState = rts;
+    xSemaphoreGive(lock);
+
+    if (pending & CONTROL_LINE_CODING) {
+        controlPending.fetch_and(~CONTROL_LINE_CODING);
+        acm->setLineCoding(lineCoding.baud, lineCoding.stopBits, lineCoding.parity, lineCoding.dataBits);
+    } else if (pending & CONTROL_LINE_STATE) {
+        controlPending.fetch_and(~CONTROL_LINE_STATE);
+        acm->setControlLine(dtrState, rtsState);
+    } else {
+        controlBusy.store(false);
+    }
+}
+
+void SerialBridge::onControl() {
+    controlBusy.store(false);
+    if (!ready && device && controlPending.load() == 0) {
+        ready = true;
+        submitRead();
+        submitWrite();
+    }
+    submitControl();
+}
+
+// Only submitted with a whole read of room left, so the ring never
+// overflows; while it is short the device is left to NAK
+void SerialBridge::submitRead() {
+    USBacmDevice* acm = device;
+    if (!acm || !ready || rx.space() < SERIAL_READ_SIZE) return;
+    bool idle = false;
+    if (readBusy.compare_exchange_strong(idle, true)) {
+        acm->INDATA(SERIAL_READ_SIZE);
+    }
+}
+
+void SerialBridge::onData(const uint8_t* data, size_t length) {
+    if (length > 0) {
+        uint32_t now = micros();
+        bool wasEmpty = rx.available() == 0;
+        if (wasEmpty) {
+            firstByteUs.store(now);
+        }
+        size_t stored = rx.write(data, length);
+        lastByteUs.store(now);
+        stats.bytesIn += stored;
+        stats.packetsIn++;
+
+        // The loop re-arms its sleep for the first byte and flushes at the threshold
+        if (timers && (wasEmpty || rx.available() >= SERIAL_FLUSH_BYTES)) {
+            timers->wake();
+        }
+    }
+
+    readBusy.store(false);
+    if (rx.space() < SERIAL_READ_SIZE) {
+        stats.stalls++;
+    }
+    submitRead();
+}
+
+// The holder of writeBusy is the transmit ring's consumer. It lets go only
+// when its transfer completes and then looks again, so a producer that lost
+// the race never leaves bytes stranded.
+void SerialBridge::submitWrite() {
+    while (device && ready && tx.available() > 0) {
+        bool idle = false;
+        if (!writeBusy.compare_exchange_strong(idle, true)) return;
+
+        const uint8_t* span;
+        size_t n = tx.peek(&span);
+        USBacmDevice* acm = device;
+        if (n > 0 && acm) {
+            // Consumed on completion, which may come before OUTDATA returns
+            writeLength = n < SERIAL_PACKET_SIZE ? n : SERIAL_PACKET_SIZE;
+            acm->OUTDATA((uint8_t*)span, writeLength);
+            return;
+        }
+        writeBusy.store(false);
+    }
+}
+
+void SerialBridge::onWritten() {
+    tx.consume(writeLength);
+    stats.bytesOut += writeLength;
+    stats.packetsOut++;
+    writeBusy.store(false);
+    submitWrite();
+}
+
+void SerialBridge::service() {
+    size_t buffered = rx.available();
+    if (buffered == 0) {
+        deferred = false;
+        return;
+    }
+
+    uint32_t now = micros();
+    bool due = deferred ? now - deferredAtUs >= SERIAL_FLUSH_US
+                        : buffered >= SERIAL_FLUSH_BYTES || now - firstByteUs.load() >= SERIAL_FLUSH_US;
+    if (due) {
+        flush(now);
+    }
+}
+
+uint32_t SerialBridge::getMsUntilFlush(uint32_t maxMs) {
+    size_t buffered = rx.available();
+    if (buffered == 0) return maxMs;
+    if (!deferred && buffered >= SERIAL_FLUSH_BYTES) return 0;
+
+    uint32_t elapsed = micros() - (deferred ? deferredAtUs : firstByteUs.load());
+    if (elapsed >= SERIAL_FLUSH_US) return 0;
+    uint32_t ms = (SERIAL_FLUSH_US - elapsed + 999) / 1000;
+    return ms < maxMs ? ms : maxMs;
+}
+
+// Sends every contiguous span as one frame. A refusal keeps the rest for a
+// retry after SERIAL_FLUSH_US, and once the ring fills, reads stop.
+void SerialBridge::flush(uint32_t now) {
+    uint32_t age = now - firstByteUs.load();
+    size_t sent = 0;
+    deferred = false;
+
+    const uint8_t* span;
+    for (size_t n = rx.peek(&span); n > 0; n = rx.peek(&span)) {
+        if (!output || !output(span, n)) {
+            deferred = true;
+            deferredAtUs = now;
+            stats.deferred++;
+            break;
+        }
+        rx.consume(n);
+        sent += n;
+        stats.frames++;
+    }
+
+    if (sent > 0) {
+        stats.flushes++;
+        stats.latencyTotalUs += age;
+        if (age > stats.latencyMaxUs) {
+            stats.latencyMaxUs = age;
+        }
+        // What is left arrived no earlier than the newest packet already sent
+        if (rx.available() > 0) {
+            firstByteUs.store(lastByteUs.load());
+        }
+    }
+    submitRead();
+}
+
+const SerialBridgeStats& SerialBridge::getStats() {
+    return stats;
+}
+
+const char* SerialBridge::parityName(uint8_t parity) {
+    return parity <= 4 ? parityNames[parity] : "none";
+}
+
+int SerialBridge::parseParity(const String& name) {
+    for (int i = 0; i <= 4; i++) {
+        if (name == parityNames[i]) return i;
+    }
+    return -1;
+}
+
+String SerialBridge::getStatusJSON() {
+    SerialLineCoding lineCoding = getLineCoding();
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool dtrState = dtr;
+    bool rtsState = rts;
+    xSemaphoreGive(lock);
+
+    JsonDocument doc(MemoryPolicy::json());
+    doc["connected"] = isConnected();
+    doc["baud"] = lineCoding.baud;
+    doc["data_bits"] = lineCoding.dataBits;
+    doc["parity"] = parityName(lineCoding.parity);
+    doc["stop_bits"] = lineCoding.stopBits == 0 ? 1.0 : lineCoding.stopBits == 1 ? 1.5 : 2.0;
+    doc["dtr"] = dtrState;
+    doc["rts"] = rtsState;
+    doc["rx_buffered"] = rx.available();
+    doc["tx_buffered"] = tx.available();
+    doc["flush_bytes"] = SERIAL_FLUSH_BYTES;
+    doc["flush_us"] = SERIAL_FLUSH_US;
+
+    // Rates are averaged over the current device's session
+    JsonObject counters = doc.createNestedObject("stats");
+    uint32_t elapsedMs = millis() - attachedAtMs;
+    counters["rx_bytes"] = stats.bytesIn;
+    counters["tx_bytes"] = stats.bytesOut;
+    counters["rx_packets"] = stats.packetsIn;
+    counters["tx_packets"] = stats.packetsOut;
+    counters["frames"] = stats.frames;
+    counters["flushes"] = stats.flushes;
+    counters["deferred"] = stats.deferred;
+    counters["stalls"] = stats.stalls;
+    counters["dropped"] = stats.dropped;
+    counters["latency_avg_us"] = stats.flushes ? (uint32_t)(stats.latencyTotalUs / stats.flushes) : 0;
+    counters["latency_max_us"] = stats.latencyMaxUs;
+    counters["rx_bytes_per_s"] = device && elapsedMs ? (uint32_t)((stats.bytesIn - sessionIn) * 1000 / elapsedMs) : 0;
+    counters["tx_bytes_per_s"] = device && elapsedMs ? (uint32_t)((stats.bytesOut - sessionOut) * 1000 / elapsedMs) : 0;
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
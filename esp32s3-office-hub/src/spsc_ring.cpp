@@ -0,0 +1,75 @@
+#include "spsc_ring.h"
+#include "memory_policy.h"
+
+SpscRing::~SpscRing() {
+    if (buffer) {
+        MemoryPolicy::psram()->deallocate(buffer);
+    }
+}
+
+bool SpscRing::begin(size_t capacity) {
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    buffer = (uint8_t*)MemoryPolicy::psram()->allocate(size);
+    if (!buffer) return false;
+    mask = size - 1;
+    clear();
+    return true;
+}
+
+// The producer owns head, so its own load is relaxed; acquiring tail makes
+// sure the consumer is done with the bytes before they are overwritten
+size_t SpscRing::reserve(uint8_t** span) {
+    size_t h = head.load(std::memory_order_relaxed);
+    size_t free = capacity() - (h - tail.load(std::memory_order_acquire));
+    size_t toEnd = capacity() - (h & mask);
+    *span = buffer + (h & mask);
+    return free < toEnd ? free : toEnd;
+}
+
+void SpscRing::commit(size_t length) {
+    head.store(head.load(std::memory_order_relaxed) + length, std::memory_order_release);
+}
+
+size_t SpscRing::write(const uint8_t* data, size_t length) {
+    size_t written = 0;
+    while (written < length) {
+        uint8_t* span;
+        size_t n = reserve(&span);
+        if (n == 0) break;
+        if (n > length - written) {
+            n = length - written;
+        }
+        memcpy(span, data + written, n);
+        commit(n);
+        written += n;
+    }
+    return written;
+}
+
+size_t SpscRing::space() const {
+    return capacity() - available();
+}
+
+size_t SpscRing::peek(const uint8_t** span) {
+    size_t t = tail.load(std::memory_order_relaxed);
+    size_t used = head.load(std::memory_order_acquire) - t;
+    size_t toEnd = capacity() - (t & mask);
+    *span = buffer + (t & mask);
+    return used < toEnd ? used : toEnd;
+}
+
+void SpscRing::consume(size_t length) {
+    tail.store(tail.load(std::memory_order_relaxed) + length, std::memory_order_release);
+}
+
+size_t SpscRing::available() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+}
+
+void SpscRing::clear() {
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+}
@@ -1,4 +1,5 @@
 #include "temperature_sensor.h"
+#include "memory_policy.h"
 
 TemperatureSensor::TemperatureSensor() {
     tempSensor = NULL;
@@ -10,13 +11,16 @@ TemperatureSensor::TemperatureSensor() {
     isInitialized = false;
     maxLogEntries = 1000;
     logFilePath = "/logs/temperature.json";
+    pendingHistory = nullptr;
+    historyPending = false;
+    historyLoaded = false;
 }
 
 TemperatureSensor::~TemperatureSensor() {
     end();
 }
 
-bool TemperatureSensor::begin() {
+bool TemperatureSensor::begin(bool loadHistory) {
     temperature_sensor_config_t temp_sensor_config = TEMPERATURE_SENSOR_CONFIG_DEFAULT(-10, 80);
     
     esp_err_t result = temperature_sensor_install(&temp_sensor_config, &tempSensor);
@@ -40,8 +44,10 @@ bool TemperatureSensor::begin() {
         // SPIFFS doesn't support mkdir, so we'll create the log file directly
     }
     
-    // Load existing log
-    loadLogFromFile();
+    // Load existing log, unless the caller defers it off the boot path
+    if (loadHistory) {
+        loadLogFromFile();
+    }
     
     // Take initial reading
     readTemperature();
@@ -64,6 +70,10 @@ bool TemperatureSensor::readTemperature() {
         return false;
     }
     
+    if (historyPending) {
+        mergeLoadedHistory();
+    }
+    
     float temp;
     esp_err_t result = temperature_sensor_get_celsius(tempSensor, &temp);
     
@@ -79,6 +89,11 @@ bool TemperatureSensor::readTemperature() {
         // Log temperature reading
         logTemperature();
         
+        // Push the new sample to listeners (alert rules)
+        if (readingCallback) {
+            readingCallback(currentTemperature, getTemperatureRate());
+        }
+        
         return true;
     } else {
         Serial.printf("Failed to read temperature: %s\n", esp_err_to_name(result));
@@ -116,6 +131,10 @@ void TemperatureSensor::update() {
     }
 }
 
+void TemperatureSensor::onReading(TemperatureReadingCallback callback) {
+    readingCallback = callback;
+}
+
 void TemperatureSensor::logTemperature() {
     TemperatureReading reading;
     reading.timestamp = millis();
@@ -136,13 +155,18 @@ void TemperatureSensor::logTemperature() {
 }
 
 bool TemperatureSensor::saveLogToFile() {
+    // Never overwrite the file before its contents have been merged back in
+    if (!historyLoaded) {
+        return false;
+    }
+    
     File file = SPIFFS.open(logFilePath, "w");
     if (!file) {
         Serial.println("Failed to open temperature log file for writing");
         return false;
     }
     
-    DynamicJsonDocument doc(8192);
+    JsonDocument doc(MemoryPolicy::json());
     JsonArray readings = doc.createNestedArray("readings");
     
     // Save last 500 readings to prevent file from getting too large
@@ -163,6 +187,67 @@ bool TemperatureSensor::saveLogToFile() {
 }
 
 bool TemperatureSensor::loadLogFromFile() {
+    std::vector<TemperatureReading> readings;
+    if (!parseLogFile(readings)) {
+        historyLoaded = true; // Unreadable file, let the next save replace it
+        return false;
+    }
+    
+    temperatureLog = readings;
+    for (const auto& reading : temperatureLog) {
+        // Update min/max from loaded data
+        if (reading.temperature > maxTemperature) maxTemperature = reading.temperature;
+        if (reading.temperature < minTemperature) minTemperature = reading.temperature;
+    }
+    historyLoaded = true;
+    
+    Serial.printf("Loaded %u temperature readings from file\n", (unsigned)temperatureLog.size());
+    return true;
+}
+
+bool TemperatureSensor::loadLogDeferred() {
+    std::vector<TemperatureReading>* readings = new std::vector<TemperatureReading>();
+    if (!parseLogFile(*readings)) {
+        delete readings;
+        historyLoaded = true; // Nothing usable to merge, allow saving again
+        return false;
+    }
+    
+    pendingHistory = readings;
+    historyPending = true;
+    Serial.printf("Parsed %u temperature readings in background\n", (unsigned)readings->size());
+    return true;
+}
+
+void TemperatureSensor::mergeLoadedHistory() {
+    std::vector<TemperatureReading>* readings = pendingHistory;
+    pendingHistory = nullptr;
+    historyPending = false;
+    
+    // Loaded readings are older than anything taken since boot
+    readings->insert(readings->end(), temperatureLog.begin(), temperatureLog.end());
+    temperatureLog.swap(*readings);
+    delete readings;
+    
+    for (const auto& reading : temperatureLog) {
+        if (reading.temperature > maxTemperature) maxTemperature = reading.temperature;
+        if (reading.temperature < minTemperature) minTemperature = reading.temperature;
+    }
+    
+    if (temperatureLog.size() > maxLogEntries) {
+        temperatureLog.erase(temperatureLog.begin(), 
+                           temperatureLog.begin() + (temperatureLog.size() - maxLogEntries));
+    }
+    historyLoaded = true;
+    
+    Serial.printf("Merged temperature history, %u readings\n", (unsigned)temperatureLog.size());
+}
+
+bool TemperatureSensor::isHistoryLoaded() {
+    return historyLoaded;
+}
+
+bool TemperatureSensor::parseLogFile(std::vector<TemperatureReading>& readings) {
     if (!SPIFFS.exists(logFilePath)) {
         Serial.println("No existing temperature log file found");
         return true;
@@ -174,7 +259,7 @@ bool TemperatureSensor::loadLogFromFile() {
         return false;
     }
     
-    DynamicJsonDocument doc(8192);
+    JsonDocument doc(MemoryPolicy::json());
     DeserializationError error = deserializeJson(doc, file);
     file.close();
     
@@ -183,29 +268,21 @@ bool TemperatureSensor::loadLogFromFile() {
         return false;
     }
     
-    temperatureLog.clear();
-    JsonArray readings = doc["readings"];
-    
-    for (JsonObject reading : readings) {
+    readings.clear();
+    for (JsonObject reading : doc["readings"].as<JsonArray>()) {
         TemperatureReading tempReading;
         tempReading.timestamp = reading["timestamp"];
         tempReading.temperature = reading["temperature"];
         tempReading.isValid = reading["valid"] | true;
         
-        temperatureLog.push_back(tempReading);
-        
-        // Update min/max from loaded data
-        float temp = tempReading.temperature;
-        if (temp > maxTemperature) maxTemperature = temp;
-        if (temp < minTemperature) minTemperature = temp;
+        readings.push_back(tempReading);
     }
     
-    Serial.printf("Loaded %d temperature readings from file\n", temperatureLog.size());
     return true;
 }
 
 String TemperatureSensor::getLogJSON(int entries) {
-    DynamicJsonDocument doc(4096);
+    JsonDocument doc(MemoryPolicy::json());
     JsonArray readings = doc.createNestedArray("readings");
     
     // Get the last 'entries' number of readings
@@ -311,6 +388,39 @@ float TemperatureSensor::getTemperatureTrend() {
     return newAvg - oldAvg; // Positive = warming, negative = cooling
 }
 
+float TemperatureSensor::getTemperatureRate(int samples) {
+    // Readings loaded from before the last restart carry millis() of that boot,
+    // so only the run taken since this boot (timestamps never decreasing) counts
+    size_t start = temperatureLog.size();
+    while (start > 0 && temperatureLog.size() - start < (size_t)samples &&
+           (start == temperatureLog.size() || temperatureLog[start - 1].timestamp <= temperatureLog[start].timestamp)) {
+        start--;
+    }
+    size_t count = temperatureLog.size() - start;
+    if (count < 3) {
+        return 0.0; // Not enough data
+    }
+    
+    // Least-squares slope over the most recent readings, time in minutes
+    unsigned long t0 = temperatureLog[start].timestamp;
+    float sumT = 0.0, sumY = 0.0, sumTT = 0.0, sumTY = 0.0;
+    
+    for (size_t i = start; i < temperatureLog.size(); i++) {
+        float t = (temperatureLog[i].timestamp - t0) / 60000.0;
+        float y = temperatureLog[i].temperature;
+        sumT += t;
+        sumY += y;
+        sumTT += t * t;
+        sumTY += t * y;
+    }
+    
+    float denom = count * sumTT - sumT * sumT;
+    if (denom <= 0.0) {
+        return 0.0;
+    }
+    return (count * sumTY - sumT * sumY) / denom;
+}
+
 void TemperatureSensor::setTemperatureOffset(float offset) {
     // This would apply a calibration offset to readings
     // Implementation depends on specific needs
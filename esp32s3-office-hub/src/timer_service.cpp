@@ -0,0 +1,402 @@
+#include "timer_service.h"
+#include "memory_policy.h"
+#include <ArduinoJson.h>
+#include <algorithm>
+#include <time.h>
+#include "esp_timer.h"
+
+// Parked deadline for wall-clock timers while the time of day is unknown
+#define DEADLINE_NEVER UINT64_MAX
+
+TimerService::TimerService() {
+    nextId = 1;
+    wallClockOffset = 0;
+    wallClockValid = false;
+    waitingTask = NULL;
+    realignThresholdMs = 2000;
+    realignCount = 0;
+    lock = xSemaphoreCreateMutex();
+}
+
+void TimerService::begin(WallClockSource source) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    wallClock = source;
+    checkWallClock(monotonicMs());
+    xSemaphoreGive(lock);
+    Serial.println("Timer service initialized");
+}
+
+uint64_t TimerService::monotonicMs() {
+    return (uint64_t)(esp_timer_get_time() / 1000);
+}
+
+uint32_t TimerService::addTimer(TimerEntry entry) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    entry.id = nextId++;
+    if (nextId == INVALID_TIMER_ID) nextId = 1;
+    entry.fireCount = 0;
+    entry.active = true;
+
+    // Reuse a cancelled slot if there is one
+    size_t index = timers.size();
+    for (size_t i = 0; i < timers.size(); i++) {
+        if (!timers[i].active) {
+            index = i;
+            break;
+        }
+    }
+
+    if (index == timers.size()) {
+        timers.push_back(entry);
+    } else {
+        timers[index] = entry;
+    }
+
+    if (entry.kind == TIMER_WALLCLOCK) {
+        scheduleWallClock(timers[index], monotonicMs());
+    }
+
+    heapPush(index);
+    xSemaphoreGive(lock);
+    wake(); // Let a sleeping loop pick up a deadline that may be earlier than its current one
+    return entry.id;
+}
+
+uint32_t TimerService::every(uint32_t intervalMs, TimerCallback callback, const String& name) {
+    TimerEntry entry;
+    entry.kind = TIMER_INTERVAL;
+    entry.name = name;
+    entry.callback = callback;
+    entry.intervalMs = intervalMs > 0 ? intervalMs : 1;
+    entry.deadline = monotonicMs() + entry.intervalMs;
+    entry.hour = -1;
+    entry.minute = 0;
+    entry.dayMask = DAYS_EVERY;
+    return addTimer(entry);
+}
+
+uint32_t TimerService::after(uint32_t delayMs, TimerCallback callback, const String& name) {
+    TimerEntry entry;
+    entry.kind = TIMER_ONESHOT;
+    entry.name = name;
+    entry.callback = callback;
+    entry.intervalMs = 0;
+    entry.deadline = monotonicMs() + delayMs;
+    entry.hour = -1;
+    entry.minute = 0;
+    entry.dayMask = DAYS_EVERY;
+    return addTimer(entry);
+}
+
+uint32_t TimerService::at(int8_t hour, int8_t minute, uint8_t dayMask, TimerCallback callback, const String& name) {
+    if (hour > 23 || minute < 0 || minute > 59 || (dayMask & DAYS_EVERY) == 0) {
+        Serial.printf("Invalid wall-clock schedule: %d:%02d mask 0x%02X\n", hour, minute, dayMask);
+        return INVALID_TIMER_ID;
+    }
+
+    TimerEntry entry;
+    entry.kind = TIMER_WALLCLOCK;
+    entry.name = name;
+    entry.callback = callback;
+    entry.intervalMs = 0;
+    entry.deadline = DEADLINE_NEVER;
+    entry.hour = hour < 0 ? -1 : hour;
+    entry.minute = minute;
+    entry.dayMask = dayMask & DAYS_EVERY;
+    return addTimer(entry);
+}
+
+bool TimerService::cancel(uint32_t id) {
+    bool found = false;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (auto& timer : timers) {
+        if (timer.active && timer.id == id) {
+            timer.active = false;
+            timer.callback = nullptr;
+            rebuildHeap();
+            found = true;
+            break;
+        }
+    }
+    xSemaphoreGive(lock);
+    return found;
+}
+
+void TimerService::cancelByPrefix(const String& prefix) {
+    bool changed = false;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (auto& timer : timers) {
+        if (timer.active && timer.name.startsWith(prefix)) {
+            timer.active = false;
+            timer.callback = nullptr;
+            changed = true;
+        }
+    }
+    if (changed) {
+        rebuildHeap();
+    }
+    xSemaphoreGive(lock);
+}
+
+bool TimerService::reschedule(uint32_t id, uint32_t intervalMs) {
+    bool found = false;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (auto& timer : timers) {
+        if (timer.active && timer.id == id && timer.kind == TIMER_INTERVAL) {
+            timer.intervalMs = intervalMs > 0 ? intervalMs : 1;
+            timer.deadline = monotonicMs() + timer.intervalMs;
+            rebuildHeap();
+            found = true;
+            break;
+        }
+    }
+    xSemaphoreGive(lock);
+    if (found) wake();
+    return found;
+}
+
+void TimerService::heapPush(size_t index) {
+    heap.push_back(index);
+    std::push_heap(heap.begin(), heap.end(), [this](size_t a, size_t b) {
+        return timers[a].deadline > timers[b].deadline;
+    });
+}
+
+void TimerService::heapPop() {
+    std::pop_heap(heap.begin(), heap.end(), [this](size_t a, size_t b) {
+        return timers[a].deadline > timers[b].deadline;
+    });
+    heap.pop_back();
+}
+
+void TimerService::rebuildHeap() {
+    heap.clear();
+    for (size_t i = 0; i < timers.size(); i++) {
+        if (timers[i].active) {
+            heap.push_back(i);
+        }
+    }
+    std::make_heap(heap.begin(), heap.end(), [this](size_t a, size_t b) {
+        return timers[a].deadline > timers[b].deadline;
+    });
+}
+
+bool TimerService::scheduleWallClock(TimerEntry& entry, uint64_t nowMs) {
+    if (!wallClockValid) {
+        entry.deadline = DEADLINE_NEVER;
+        return false;
+    }
+
+    // Strictly after the current local second so a schedule never fires twice
+    time_t nowLocal = (time_t)((wallClockOffset + (int64_t)nowMs) / 1000);
+    struct tm t;
+    gmtime_r(&nowLocal, &t); // Source is already offset to local time
+
+    time_t candidate;
+    if (entry.hour < 0) {
+        candidate = nowLocal - (t.tm_min * 60 + t.tm_sec) + entry.minute * 60;
+    } else {
+        candidate = nowLocal - (t.tm_hour * 3600 + t.tm_min * 60 + t.tm_sec) + entry.hour * 3600 + entry.minute * 60;
+    }
+
+    const time_t step = entry.hour < 0 ? 3600 : 86400;
+    for (int i = 0; i < 24 * 8; i++) {
+        if (candidate > nowLocal) {
+            struct tm c;
+            gmtime_r(&candidate, &c);
+            if (entry.dayMask & (1 << c.tm_wday)) {
+                entry.deadline = (uint64_t)((int64_t)candidate * 1000 - wallClockOffset);
+                return true;
+            }
+        }
+        candidate += step;
+    }
+
+    entry.deadline = DEADLINE_NEVER;
+    return false;
+}
+
+void TimerService::checkWallClock(uint64_t nowMs) {
+    if (!wallClock) return;
+
+    uint32_t epoch = wallClock();
+    if (epoch == 0) return;
+
+    int64_t offset = (int64_t)epoch * 1000 - (int64_t)nowMs;
+
+    if (wallClockValid) {
+        int64_t drift = offset - wallClockOffset;
+        if (drift < 0) drift = -drift;
+        if (drift < realignThresholdMs) {
+            return;
+        }
+        Serial.printf("Wall clock moved by %lld ms, realigning schedules\n", (long long)(offset - wallClockOffset));
+        realignCount++;
+    }
+
+    wallClockOffset = offset;
+    wallClockValid = true;
+
+    for (auto& timer : timers) {
+        if (timer.active && timer.kind == TIMER_WALLCLOCK) {
+            scheduleWallClock(timer, nowMs);
+        }
+    }
+    rebuildHeap();
+}
+
+void TimerService::notifyWallClockChanged() {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    checkWallClock(monotonicMs());
+    xSemaphoreGive(lock);
+    wake();
+}
+
+int TimerService::service() {
+    uint64_t now = monotonicMs();
+    xSemaphoreTake(lock, portMAX_DELAY);
+    checkWallClock(now);
+
+    int fired = 0;
+    while (!heap.empty() && timers[heap.front()].deadline <= now) {
+        size_t index = heap.front();
+        heapPop();
+
+        TimerEntry& timer = timers[index];
+        TimerCallback callback = timer.callback;
+        timer.fireCount++;
+
+        if (timer.kind == TIMER_INTERVAL) {
+            // Keep phase unless we fell more than a whole interval behind
+            timer.deadline += timer.intervalMs;
+            if (timer.deadline <= now) {
+                timer.deadline = now + timer.intervalMs;
+            }
+            heapPush(index);
+        } else if (timer.kind == TIMER_WALLCLOCK) {
+            scheduleWallClock(timer, timer.deadline > now ? timer.deadline : now);
+            heapPush(index);
+        } else {
+            timer.active = false;
+            timer.callback = nullptr;
+        }
+
+        // Run last and unlocked: the callback may add or cancel timers
+        xSemaphoreGive(lock);
+        if (callback) {
+            callback();
+        }
+        fired++;
+        xSemaphoreTake(lock, portMAX_DELAY);
+    }
+
+    xSemaphoreGive(lock);
+    return fired;
+}
+
+uint32_t TimerService::getMsUntilNextDeadline() {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    uint64_t deadline = heap.empty() ? DEADLINE_NEVER : timers[heap.front()].deadline;
+    xSemaphoreGive(lock);
+    if (deadline == DEADLINE_NEVER) return UINT32_MAX;
+
+    uint64_t now = monotonicMs();
+    if (deadline <= now) return 0;
+
+    uint64_t remaining = deadline - now;
+    return remaining > UINT32_MAX ? UINT32_MAX : (uint32_t)remaining;
+}
+
+void TimerService::sleepUntilNextDeadline(uint32_t maxWaitMs) {
+    uint32_t waitMs = getMsUntilNextDeadline();
+    if (waitMs > maxWaitMs) waitMs = maxWaitMs;
+    if (waitMs == 0) return;
+
+    waitingTask = xTaskGetCurrentTaskHandle();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+}
+
+void TimerService::wake() {
+    if (waitingTask) {
+        xTaskNotifyGive(waitingTask);
+    }
+}
+
+void TimerService::wakeFromISR() {
+    if (waitingTask) {
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        vTaskNotifyGiveFromISR(waitingTask, &higherPriorityTaskWoken);
+        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+    }
+}
+
+size_t TimerService::getTimerCount() {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    size_t count = heap.size();
+    xSemaphoreGive(lock);
+    return count;
+}
+
+uint32_t TimerService::getRealignCount() {
+    return realignCount;
+}
+
+String TimerService::getTimersJSON() {
+    JsonDocument doc(MemoryPolicy::json());
+    xSemaphoreTake(lock, portMAX_DELAY);
+    doc["wall_clock_valid"] = wallClockValid;
+    doc["realign_count"] = realignCount;
+    JsonArray list = doc.createNestedArray("timers");
+
+    uint64_t now = monotonicMs();
+    for (const auto& timer : timers) {
+        if (!timer.active) continue;
+
+        JsonObject t = list.createNestedObject();
+        t["id"] = timer.id;
+        t["name"] = timer.name;
+        t["kind"] = timer.kind == TIMER_INTERVAL ? "interval" : (timer.kind == TIMER_ONESHOT ? "oneshot" : "wallclock");
+        t["fired"] = timer.fireCount;
+        if (timer.deadline == DEADLINE_NEVER) {
+            t["next_ms"] = -1;
+        } else {
+            t["next_ms"] = timer.deadline > now ? (uint32_t)(timer.deadline - now) : 0;
+        }
+        if (timer.kind == TIMER_WALLCLOCK) {
+            char when[12];
+            if (timer.hour < 0) {
+                snprintf(when, sizeof(when), "**:%02d", timer.minute);
+            } else {
+                snprintf(when, sizeof(when), "%02d:%02d", timer.hour, timer.minute);
+            }
+            t["at"] = when;
+            t["days"] = timer.dayMask;
+        } else {
+            t["interval_ms"] = timer.intervalMs;
+        }
+    }
+    xSemaphoreGive(lock);
+
+    String result;
+    serializeJson(doc, result);
+    return result;
+}
+
+uint8_t TimerService::parseDayMask(const String& days) {
+    String d = days;
+    d.toLowerCase();
+    d.trim();
+
+    if (d == "" || d == "daily" || d == "every" || d == "all") return DAYS_EVERY;
+    if (d == "weekdays") return DAYS_WEEKDAYS;
+    if (d == "weekends") return DAYS_WEEKENDS;
+
+    static const char* names[] = {"sun", "mon", "tue", "wed", "thu", "fri", "sat"};
+    uint8_t mask = 0;
+    for (int i = 0; i < 7; i++) {
+        if (d.indexOf(names[i]) >= 0) {
+            mask |= (1 << i);
+        }
+    }
+    return mask;
+}
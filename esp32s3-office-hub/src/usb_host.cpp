@@ -1,67 +1,885 @@
 #include "usb_host.h"
+#include "memory_policy.h"
+#include "diskio_impl.h"
+#include "esp_vfs_fat.h"
 #include <Arduino.h>
+#include <algorithm>
 
-bool USBHostManager::initialize() {
+// The library's client callback carries the USBhost, not us
+static USBHostManager* activeManager = nullptr;
+// Device whose READ(10) is in flight, for the data callback
+static MscBlockDevice* volatile activeReader = nullptr;
+
+struct USBStreamMemory {
+    FIL file;
+    uint8_t buffers[2][USB_STREAM_BUFFER_SIZE];
+};
+
+// ---------------------------------------------------------------------------
+// MscBlockDevice
+
+MscBlockDevice::MscBlockDevice(USBmscDevice* msc, uint8_t lunNumber) {
+    device = msc;
+    lun = lunNumber;
+    blockCount = msc->getBlockCount(lun);
+    blockSize = msc->getBlockSize(lun);
+    present = true;
+    lock = xSemaphoreCreateMutex();
+}
+
+MscBlockDevice::~MscBlockDevice() {
+    if (lock) {
+        vSemaphoreDelete(lock);
+    }
+}
+
+bool MscBlockDevice::read(uint32_t block, uint8_t* buffer, uint32_t count) {
+    if (!isReady() || block + count > blockCount) return false;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool ok = true;
+    for (uint32_t done = 0; done < count && ok;) {
+        uint32_t n = multiSector ? min(count - done, (uint32_t)USB_MSC_MAX_SECTORS) : 1;
+        readTarget = buffer + done * blockSize;
+        readExpected = (size_t)n * blockSize;
+        readReceived = 0;
+        activeReader = this;
+        ok = present && device->_read10(lun, block + done, n, readTarget) == ESP_OK;
+        activeReader = nullptr;
+        if (ok && n > 1 && readReceived < readExpected) {
+            Serial.println("USB storage: no multi-block data stage, reading one block per command");
+            multiSector = false;
+            continue;
+        }
+        done += n;
+    }
+    readTarget = nullptr;
+    xSemaphoreGive(lock);
+    return ok;
+}
+
+bool MscBlockDevice::write(uint32_t block, const uint8_t* buffer, uint32_t count) {
+    if (!isReady() || block + count > blockCount) return false;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool ok = true;
+    for (uint32_t done = 0; done < count && ok;) {
+        uint32_t n = min(count - done, (uint32_t)USB_MSC_MAX_SECTORS);
+        // _write10 copies the data into its own transfer buffer
+        ok = present && device->_write10(lun, block + done, n, const_cast<uint8_t*>(buffer + done * blockSize)) == ESP_OK;
+        done += n;
+    }
+    xSemaphoreGive(lock);
+    return ok;
+}
+
+uint32_t MscBlockDevice::getBlockCount() {
+    return blockCount;
+}
+
+uint16_t MscBlockDevice::getBlockSize() {
+    return blockSize;
+}
+
+bool MscBlockDevice::isReady() {
+    return present && device && blockCount > 0;
+}
+
+void MscBlockDevice::detach() {
+    present = false;
+}
+
+// Runs on the library's client task once per block of the data stage, before
+// the CSW completes the command; WRITE(10) data stages land here too and are
+// ignored
+void MscBlockDevice::dataCallback(usb_transfer_t* transfer) {
+    MscBlockDevice* device = activeReader;
+    if (!device || !device->readTarget) return;
+
+    size_t received = device->readReceived;
+    size_t length = min((size_t)transfer->actual_num_bytes, device->readExpected - received);
+    memcpy(device->readTarget + received, transfer->data_buffer, length);
+    device->readReceived = received + length;
+}
+
+// ---------------------------------------------------------------------------
+// USBHostManager
+
+bool USBHostManager::initialize(TimerService* timerService) {
     Serial.println("Initializing USB Host Manager...");
-    
-    // Initialize USB host stack
-    // Note: USB Host functionality is still experimental on ESP32-S3
-    // This is a placeholder implementation
-    
+    timers = timerService;
+    activeManager = this;
+
+    eventQueue = xQueueCreate(USB_EVENT_QUEUE_LENGTH, sizeof(USBEvent));
+    mountQueue = xQueueCreate(USB_EVENT_QUEUE_LENGTH, sizeof(bool));
+    enumerated = xSemaphoreCreateBinary();
+    lock = xSemaphoreCreateMutex();
+    bool streamsReady = true;
+    for (USBStream& stream : streams) {
+        stream.done = xSemaphoreCreateBinary();
+        streamsReady = streamsReady && stream.done;
+    }
+    if (!eventQueue || !mountQueue || !enumerated || !lock || !streamsReady) {
+        Serial.println("USB host: out of memory");
+        return false;
+    }
+
+    if (xTaskCreatePinnedToCore(usbTask, "usb_host", USB_TASK_STACK_SIZE, this, 2, NULL, 0) != pdPASS) {
+        Serial.println("USB host: cannot start task");
+        return false;
+    }
+
+    host = new USBhost();
+    host->registerClientCb(clientEventCallback);
+    if (!host->init(true)) {
+        Serial.println("USB host stack failed to install");
+        return false;
+    }
+
+    Serial.println("USB host ready, waiting for storage");
+    return true;
+}
+
+void USBHostManager::usbTask(void* param) {
+    USBHostManager* manager = (USBHostManager*)param;
+    USBEvent event;
+
+    while (true) {
+        // A pending listing walks one batch whenever nothing else is queued
+        TickType_t wait = manager->walkPending ? 0 : portMAX_DELAY;
+        if (xQueueReceive(manager->eventQueue, &event, wait) != pdTRUE) {
+            manager->walkListing();
+            continue;
+        }
+
+        if (event.type == USB_EVENT_ATTACHED) {
+            manager->onUSBConnect();
+        } else if (event.type == USB_EVENT_DETACHED) {
+            manager->onUSBDisconnect();
+        } else if (event.type == USB_EVENT_STREAM_IO) {
+            manager->serviceStream(event.stream, event.half);
+        }
+    }
+}
+
+// Runs on the library's client task. Enumeration and FAT work are handed to
+// our task so the client task keeps servicing transfers meanwhile.
+void USBHostManager::clientEventCallback(const usb_host_client_event_msg_t* event, void* arg) {
+    USBHostManager* manager = activeManager;
+    if (!manager) return;
+
+    if (event->event == USB_HOST_CLIENT_EVENT_NEW_DEV) {
+        manager->postEvent(USB_EVENT_ATTACHED);
+        return;
+    }
+
+    // I/O stuck on the vanished device fails from here on, and the interfaces
+    // have to be released before the library closes the device
+    USBhost* host = (USBhost*)arg;
+    MscBlockDevice* device = manager->disk;
+    if (device) {
+        device->detach();
+    }
+    if (manager->interfaceClaimed) {
+        usb_host_interface_release(host->clientHandle(), host->deviceHandle(), manager->mscInterface);
+        manager->interfaceClaimed = false;
+    }
+    if (manager->acmClaimed) {
+        manager->serialBridge->detach();
+        for (uint8_t number : manager->acmInterfaces) {
+            usb_host_interface_release(host->clientHandle(), host->deviceHandle(), number);
+        }
+        manager->acmClaimed = false;
+    }
+    manager->postEvent(USB_EVENT_DETACHED);
+}
+
+void USBHostManager::capacityCallback(usb_transfer_t*) {
+    if (activeManager) {
+        xSemaphoreGive(activeManager->enumerated);
+    }
+}
+
+bool USBHostManager::postEvent(USBEventType type, uint8_t stream, uint8_t half) {
+    USBEvent event = {type, stream, half};
+    if (xQueueSend(eventQueue, &event, 0) != pdTRUE) {
+        Serial.println("USB event queue full");
+        return false;
+    }
     return true;
 }
 
+void USBHostManager::onUSBConnect() {
+    Serial.println("USB device connected");
+
+    const usb_config_desc_t* config = host->getConfigurationDescriptor();
+    bool found = false;
+    for (uint8_t n = 0; config && n < config->bNumInterfaces && !found; n++) {
+        int offset = 0;
+        const usb_intf_desc_t* intf = usb_parse_interface_descriptor(config, n, 0, &offset);
+        if (intf && intf->bInterfaceClass == USB_CLASS_MASS_STORAGE) {
+            mscInterface = intf->bInterfaceNumber;
+            found = true;
+        }
+    }
+    if (!found) {
+        if (serialBridge && findAcmInterfaces(config)) {
+            attachSerial(config);
+        } else {
+            Serial.println("USB device is neither mass storage nor a serial port, ignoring");
+        }
+        return;
+    }
+
+    readDeviceStrings();
+
+    // The constructor claims the interface; init() runs MAX LUN and READ CAPACITY
+    xSemaphoreTake(enumerated, 0);
+    msc = new USBmscDevice(config, host);
+    interfaceClaimed = true;
+    msc_transfer_cb_t callbacks = {};
+    callbacks.capacity_cb = capacityCallback;
+    callbacks.data_cb = MscBlockDevice::dataCallback;
+    msc->registerCallbacks(callbacks);
+    if (!msc->init() || xSemaphoreTake(enumerated, pdMS_TO_TICKS(USB_ENUMERATE_TIMEOUT_MS)) != pdTRUE) {
+        Serial.println("USB storage did not report its capacity");
+        releaseMsc();
+        return;
+    }
+
+    MscBlockDevice* device = new MscBlockDevice(msc, 0);
+    if (!device->isReady()) {
+        Serial.println("USB storage reports no media");
+        delete device;
+        releaseMsc();
+        return;
+    }
+
+    BlockCache* blockCache = cacheEnabled ? new BlockCache(device) : nullptr;
+    if (blockCache && !blockCache->begin()) {
+        Serial.println("USB block cache unavailable, running uncached");
+        delete blockCache;
+        blockCache = nullptr;
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    disk = device;
+    cache = blockCache;
+    bool mounted = mountDisk();
+    if (mounted) {
+        usbMounted = true;
+        refreshSpace();
+    } else {
+        cache = nullptr;
+        disk = nullptr;
+    }
+    xSemaphoreGive(lock);
+
+    if (!mounted) {
+        delete blockCache;
+        delete device;
+        releaseMsc();
+        return;
+    }
+
+    Serial.printf("USB storage mounted at %s: %s, %s, %llu MB\n", mountPoint.c_str(),
+                  product.c_str(), fileSystem.c_str(), (unsigned long long)(totalBytes >> 20));
+    notifyMountChange();
+}
+
+void USBHostManager::onUSBDisconnect() {
+    Serial.println("USB device disconnected");
+    bool wasMounted = usbMounted;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    usbMounted = false;
+    // Open streams lose their files with the volume and fail from here on
+    for (USBStream& stream : streams) {
+        if (stream.id) {
+            stream.fileOpen = false;
+            stream.failed = true;
+        }
+    }
+    // Snapshots of the old volume expire; walks in progress fail
+    generation++;
+    for (USBListSnapshot& snapshot : snapshots) {
+        if (snapshot.state == USB_LIST_WALKING) {
+            snapshot.error = FR_NOT_READY;
+            snapshot.state = USB_LIST_FAILED;
+        }
+        if (snapshot.dir) {
+            MemoryPolicy::psram()->deallocate(snapshot.dir);
+            snapshot.dir = nullptr;
+        }
+        if (!snapshot.readers) {
+            resetListing(&snapshot);
+        }
+    }
+    unmountDisk();
+    delete acm;
+    acm = nullptr;
+    delete cache;
+    cache = nullptr;
+    delete disk;
+    disk = nullptr;
+    delete msc;
+    msc = nullptr;
+    totalBytes = 0;
+    freeBytes = 0;
+    fileSystem = "";
+    manufacturer = "";
+    product = "";
+    vendorId = 0;
+    productId = 0;
+    xSemaphoreGive(lock);
+
+    if (wasMounted) {
+        notifyMountChange();
+    }
+}
+
+// Failed bring-up with the device still attached
+void USBHostManager::releaseMsc() {
+    if (interfaceClaimed) {
+        usb_host_interface_release(host->clientHandle(), host->deviceHandle(), mscInterface);
+        interfaceClaimed = false;
+    }
+    delete msc;
+    msc = nullptr;
+}
+
+// A communication interface with its notification endpoint and a data
+// interface with bulk IN and OUT, the only layout the library's ACM driver
+// parses without reading past what it found
+bool USBHostManager::findAcmInterfaces(const usb_config_desc_t* config) {
+    bool comm = false;
+    bool data = false;
+    for (uint8_t n = 0; config && n < config->bNumInterfaces; n++) {
+        int offset = 0;
+        const usb_intf_desc_t* intf = usb_parse_interface_descriptor(config, n, 0, &offset);
+        if (!intf) return false;
+        if (intf->bInterfaceClass == USB_CLASS_COMM && intf->bNumEndpoints == 1) {
+            acmInterfaces[0] = intf->bInterfaceNumber;
+            comm = true;
+        } else if (intf->bInterfaceClass == USB_CLASS_CDC_DATA && intf->bNumEndpoints == 2) {
+            acmInterfaces[1] = intf->bInterfaceNumber;
+            data = true;
+        }
+    }
+    return comm && data;
+}
+
+void USBHostManager::attachSerial(const usb_config_desc_t* config) {
+    readDeviceStrings();
+
+    // The constructor claims both interfaces; the bridge sets the line coding
+    acm = new USBacmDevice(config, host);
+    acmClaimed = true;
+    acm->init();
+    serialBridge->attach(acm);
+
+    const SerialLineCoding coding = serialBridge->getLineCoding();
+    Serial.printf("USB serial device attached: %s %s, %u baud\n", manufacturer.c_str(), product.c_str(),
+                  (unsigned)coding.baud);
+}
+
+static String descriptorString(const usb_str_desc_t* desc) {
+    String result;
+    if (!desc) return result;
+
+    // UTF-16LE; anything outside ASCII shows as '?'
+    int chars = (desc->bLength - 2) / 2;
+    for (int i = 0; i < chars; i++) {
+        uint16_t c = desc->wData[i];
+        result += (c >= 0x20 && c < 0x7F) ? (char)c : '?';
+    }
+    return result;
+}
+
+void USBHostManager::readDeviceStrings() {
+    const usb_device_desc_t* desc = host->getDeviceDescriptor();
+    vendorId = desc ? desc->idVendor : 0;
+    productId = desc ? desc->idProduct : 0;
+
+    usb_device_info_t info = host->getDeviceInfo();
+    manufacturer = descriptorString(info.str_desc_manufacturer);
+    product = descriptorString(info.str_desc_product);
+}
+
+// Caller holds lock
+bool USBHostManager::mountDisk() {
+    uint8_t pdrv = 0xFF;
+    if (ff_diskio_get_drive(&pdrv) != ESP_OK || pdrv == 0xFF) {
+        Serial.println("No free FatFs drive for USB storage");
+        return false;
+    }
+    drive = pdrv;
+    registerBlockDiskio(drive, cache ? (BlockDevice*)cache : disk);
+
+    char path[3] = {(char)('0' + drive), ':', '\0'};
+    esp_err_t err = esp_vfs_fat_register(USB_MOUNT_POINT, path, USB_MAX_OPEN_FILES, &fatfs);
+    if (err != ESP_OK) {
+        Serial.printf("USB VFS register failed: %s\n", esp_err_to_name(err));
+        registerBlockDiskio(drive, nullptr);
+        drive = 0xFF;
+        return false;
+    }
+
+    FRESULT res = f_mount(fatfs, path, 1);
+    if (res != FR_OK) {
+        Serial.printf("USB FAT mount failed (%d)\n", res);
+        f_mount(NULL, path, 0);
+        esp_vfs_fat_unregister_path(USB_MOUNT_POINT);
+        registerBlockDiskio(drive, nullptr);
+        fatfs = nullptr;
+        drive = 0xFF;
+        return false;
+    }
+
+    // FATs and the FAT12/16 root directory outlive file data in the cache
+    if (cache) {
+        cache->setProtectedRange(fatfs->fatbase, fatfs->database);
+    }
+
+    switch (fatfs->fs_type) {
+        case FS_FAT12: fileSystem = "FAT12"; break;
+        case FS_FAT16: fileSystem = "FAT16"; break;
+        case FS_FAT32: fileSystem = "FAT32"; break;
+        default: fileSystem = "exFAT"; break;
+    }
+    return true;
+}
+
+// Caller holds lock
+void USBHostManager::unmountDisk() {
+    if (drive == 0xFF) return;
+
+    char path[3] = {(char)('0' + drive), ':', '\0'};
+    f_mount(NULL, path, 0);
+    esp_vfs_fat_unregister_path(USB_MOUNT_POINT);
+    registerBlockDiskio(drive, nullptr);
+    fatfs = nullptr;
+    drive = 0xFF;
+}
+
+// Caller holds lock. f_getfree scans the FAT once per mount (FAT16, or FAT32
+// without FSInfo); later calls use the count FatFs keeps up to date.
+void USBHostManager::refreshSpace() {
+    FATFS* fs;
+    DWORD freeClusters;
+    String root = drivePath("/");
+    if (!disk || f_getfree(root.c_str(), &freeClusters, &fs) != FR_OK) return;
+
+    uint64_t clusterBytes = (uint64_t)fs->csize * disk->getBlockSize();
+    totalBytes = (uint64_t)(fs->n_fatent - 2) * clusterBytes;
+    freeBytes = (uint64_t)freeClusters * clusterBytes;
+}
+
+// Caller holds lock, after changing the volume
+void USBHostManager::markModified() {
+    generation++;
+    refreshSpace();
+}
+
+// "N:/path" on the mounted drive, or empty for paths that try to climb out
+String USBHostManager::drivePath(const String& path) {
+    if (path == ".." || path.startsWith("../") || path.endsWith("/..") || path.indexOf("/../") >= 0) {
+        return "";
+    }
+
+    String result = String((char)('0' + drive)) + ":";
+    if (!path.startsWith("/")) {
+        result += "/";
+    }
+    result += path;
+    return result;
+}
+
+void USBHostManager::notifyMountChange() {
+    bool mounted = usbMounted;
+    xQueueSend(mountQueue, &mounted, 0);
+    if (timers) {
+        timers->wake();
+    }
+}
+
+void USBHostManager::processEvents() {
+    if (!mountQueue) return;
+
+    bool mounted;
+    while (xQueueReceive(mountQueue, &mounted, 0) == pdTRUE) {
+        if (mountCallback) {
+            mountCallback(mounted);
+        }
+    }
+}
+
+void USBHostManager::onMountChange(USBMountCallback callback) {
+    mountCallback = callback;
+}
+
+void USBHostManager::setBlockCache(bool enabled) {
+    cacheEnabled = enabled;
+}
+
+void USBHostManager::setSerialBridge(SerialBridge* bridge) {
+    serialBridge = bridge;
+}
+
 bool USBHostManager::isMounted() {
     return usbMounted;
 }
 
 String USBHostManager::listFiles(String path) {
-    // Placeholder implementation for file listing
-    DynamicJsonDocument doc(2048);
+    JsonDocument doc(MemoryPolicy::json());
+    doc["path"] = path;
     JsonArray files = doc.createNestedArray("files");
-    
+
     if (usbMounted) {
-        JsonObject file1 = files.createNestedObject();
-        file1["name"] = "example.txt";
-        file1["size"] = 1024;
-        file1["type"] = "file";
-        
-        JsonObject file2 = files.createNestedObject();
-        file2["name"] = "documents";
-        file2["size"] = 0;
-        file2["type"] = "directory";
-    }
-    
+        xSemaphoreTake(lock, portMAX_DELAY);
+        String fullPath = drivePath(path);
+        DIR dir;
+        FRESULT res = fullPath.isEmpty() ? FR_INVALID_NAME : f_opendir(&dir, fullPath.c_str());
+        if (res == FR_OK) {
+            FILINFO info;
+            int count = 0;
+            while (f_readdir(&dir, &info) == FR_OK && info.fname[0]) {
+                if (count == USB_LIST_MAX_ENTRIES) {
+                    doc["truncated"] = true;
+                    break;
+                }
+                JsonObject file = files.createNestedObject();
+                file["name"] = info.fname;
+                file["size"] = info.fsize;
+                file["type"] = (info.fattrib & AM_DIR) ? "directory" : "file";
+                count++;
+            }
+            f_closedir(&dir);
+        } else {
+            doc["error"] = res == FR_NO_PATH || res == FR_NO_FILE ? "not found" : "read failed";
+        }
+        xSemaphoreGive(lock);
+    }
+
     String result;
     serializeJson(doc, result);
     return result;
 }
 
+// ---------------------------------------------------------------------------
+// Paged listings
+
+int USBHostManager::acquireListing(const String& path, USBListSort sort, bool descending, uint32_t cursorGeneration) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    uint32_t wanted = cursorGeneration ? cursorGeneration : generation;
+    int handle = -1;
+    for (int i = 0; i < USB_LIST_SNAPSHOTS && handle < 0; i++) {
+        USBListSnapshot& snapshot = snapshots[i];
+        if ((snapshot.state == USB_LIST_WALKING || snapshot.state == USB_LIST_READY) && snapshot.generation == wanted &&
+            snapshot.sort == sort && snapshot.descending == descending && snapshot.path == path) {
+            handle = i;
+        }
+    }
+
+    // A first page takes a free slot or the least recently paged idle one
+    if (handle < 0 && !cursorGeneration) {
+        for (int i = 0; i < USB_LIST_SNAPSHOTS; i++) {
+            USBListSnapshot& snapshot = snapshots[i];
+            if (snapshot.readers || snapshot.state == USB_LIST_WALKING) continue;
+            if (handle < 0 || snapshot.state == USB_LIST_FREE || snapshot.state == USB_LIST_FAILED ||
+                (snapshots[handle].state == USB_LIST_READY && snapshot.lastUsed < snapshots[handle].lastUsed)) {
+                handle = i;
+            }
+        }
+        if (handle >= 0) {
+            USBListSnapshot& snapshot = snapshots[handle];
+            snapshot.path = path;
+            snapshot.sort = sort;
+            snapshot.descending = descending;
+            snapshot.generation = generation;
+            snapshot.count = 0;
+            snapshot.namesUsed = 0;
+            snapshot.truncated = false;
+            snapshot.error = FR_OK;
+            snapshot.state = USB_LIST_WALKING;
+            walkPending = true;
+            postEvent(USB_EVENT_LIST);
+        }
+    }
+
+    if (handle >= 0) {
+        snapshots[handle].readers++;
+        snapshots[handle].lastUsed = ++listClock;
+    }
+    xSemaphoreGive(lock);
+
+    if (handle < 0) return cursorGeneration ? USB_LIST_EXPIRED : USB_LIST_BUSY;
+    return handle;
+}
+
+const USBListSnapshot* USBHostManager::getListing(int handle) {
+    if (handle < 0 || handle >= USB_LIST_SNAPSHOTS) return nullptr;
+    return &snapshots[handle];
+}
+
+void USBHostManager::releaseListing(int handle) {
+    if (handle < 0 || handle >= USB_LIST_SNAPSHOTS) return;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    USBListSnapshot& snapshot = snapshots[handle];
+    if (snapshot.readers) {
+        snapshot.readers--;
+    }
+    // Left over from a detach while it was being paged
+    if (!snapshot.readers && !usbMounted && snapshot.state != USB_LIST_WALKING) {
+        resetListing(&snapshot);
+    }
+    xSemaphoreGive(lock);
+}
+
+uint32_t USBHostManager::getGeneration() {
+    return generation;
+}
+
+// Caller holds lock; frees the snapshot's memory
+void USBHostManager::resetListing(USBListSnapshot* snapshot) {
+    MemoryPolicy::psram()->deallocate(snapshot->entries);
+    MemoryPolicy::psram()->deallocate(snapshot->names);
+    snapshot->entries = nullptr;
+    snapshot->names = nullptr;
+    snapshot->count = 0;
+    snapshot->capacity = 0;
+    snapshot->namesUsed = 0;
+    snapshot->namesCapacity = 0;
+    snapshot->path = "";
+    snapshot->state = USB_LIST_FREE;
+}
+
+// One batch of the pending walk, on the USB task. The lock is dropped between
+// batches so stream I/O interleaves; a change to the volume meanwhile
+// restarts the walk at the new generation.
+void USBHostManager::walkListing() {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    USBListSnapshot* snapshot = nullptr;
+    for (USBListSnapshot& candidate : snapshots) {
+        if (candidate.state == USB_LIST_WALKING) {
+            snapshot = &candidate;
+            break;
+        }
+    }
+    if (!snapshot) {
+        walkPending = false;
+        xSemaphoreGive(lock);
+        return;
+    }
+
+    FRESULT res = usbMounted ? FR_OK : FR_NOT_READY;
+    if (res == FR_OK && snapshot->dir && snapshot->generation != generation) {
+        f_closedir(snapshot->dir);
+        MemoryPolicy::psram()->deallocate(snapshot->dir);
+        snapshot->dir = nullptr;
+    }
+    if (res == FR_OK && !snapshot->dir) {
+        snapshot->generation = generation;
+        snapshot->count = 0;
+        snapshot->namesUsed = 0;
+        snapshot->truncated = false;
+        String fullPath = drivePath(snapshot->path);
+        snapshot->dir = (DIR*)MemoryPolicy::psram()->allocate(sizeof(DIR));
+        res = !snapshot->dir ? FR_NOT_ENOUGH_CORE : fullPath.isEmpty() ? FR_INVALID_NAME : f_opendir(snapshot->dir, fullPath.c_str());
+        if (res != FR_OK && snapshot->dir) {
+            MemoryPolicy::psram()->deallocate(snapshot->dir);
+            snapshot->dir = nullptr;
+        }
+    }
+
+    bool finished = false;
+    FILINFO info;
+    for (int i = 0; res == FR_OK && !finished && i < USB_LIST_BATCH; i++) {
+        res = f_readdir(snapshot->dir, &info);
+        if (res != FR_OK) break;
+        if (!info.fname[0]) {
+            finished = true;
+        } else if (snapshot->count == USB_LIST_SNAPSHOT_MAX) {
+            snapshot->truncated = true;
+            finished = true;
+        } else if (!appendEntry(snapshot, info)) {
+            res = FR_NOT_ENOUGH_CORE;
+        }
+    }
+
+    if ((res != FR_OK || finished) && snapshot->dir) {
+        f_closedir(snapshot->dir);
+        MemoryPolicy::psram()->deallocate(snapshot->dir);
+        snapshot->dir = nullptr;
+    }
+    if (res != FR_OK) {
+        snapshot->error = res;
+        snapshot->state = USB_LIST_FAILED;
+    } else if (finished) {
+        sortListing(snapshot);
+        snapshot->state = USB_LIST_READY;
+    }
+    xSemaphoreGive(lock);
+}
+
+// Caller holds lock. Entries and names grow by doubling in PSRAM.
+bool USBHostManager::appendEntry(USBListSnapshot* snapshot, const FILINFO& info) {
+    size_t nameLength = strlen(info.fname) + 1;
+    if (snapshot->count == snapshot->capacity) {
+        uint32_t capacity = snapshot->capacity ? snapshot->capacity * 2 : 64;
+        void* grown = MemoryPolicy::psram()->reallocate(snapshot->entries, capacity * sizeof(USBListEntry));
+        if (!grown) return false;
+        snapshot->entries = (USBListEntry*)grown;
+        snapshot->capacity = capacity;
+    }
+    if (snapshot->namesUsed + nameLength > snapshot->namesCapacity) {
+        size_t capacity = snapshot->namesCapacity ? snapshot->namesCapacity * 2 : 1024;
+        while (capacity < snapshot->namesUsed + nameLength) {
+            capacity *= 2;
+        }
+        void* grown = MemoryPolicy::psram()->reallocate(snapshot->names, capacity);
+        if (!grown) return false;
+        snapshot->names = (char*)grown;
+        snapshot->namesCapacity = capacity;
+    }
+
+    USBListEntry& entry = snapshot->entries[snapshot->count++];
+    entry.name = snapshot->namesUsed;
+    entry.modified = (uint32_t)info.fdate << 16 | info.ftime;
+    entry.size = info.fsize;
+    entry.directory = info.fattrib & AM_DIR;
+    memcpy(snapshot->names + snapshot->namesUsed, info.fname, nameLength);
+    snapshot->namesUsed += nameLength;
+    return true;
+}
+
+// Directories first; ties on size or date fall back to the name
+void USBHostManager::sortListing(USBListSnapshot* snapshot) {
+    const char* names = snapshot->names;
+    USBListSort sort = snapshot->sort;
+    bool descending = snapshot->descending;
+    std::sort(snapshot->entries, snapshot->entries + snapshot->count, [=](const USBListEntry& a, const USBListEntry& b) {
+        if (a.directory != b.directory) return a.directory;
+        int order = 0;
+        if (sort == USB_SORT_SIZE && a.size != b.size) {
+            order = a.size < b.size ? -1 : 1;
+        } else if (sort == USB_SORT_MODIFIED && a.modified != b.modified) {
+            order = a.modified < b.modified ? -1 : 1;
+        }
+        if (order == 0) {
+            order = strcasecmp(names + a.name, names + b.name);
+        }
+        return descending ? order > 0 : order < 0;
+    });
+}
+
 bool USBHostManager::uploadFile(String filename, uint8_t* data, size_t length) {
     if (!usbMounted) {
         Serial.println("USB not mounted");
         return false;
     }
-    
-    Serial.printf("Uploading file: %s (%d bytes)\n", filename.c_str(), length);
-    
-    // Placeholder implementation
-    // In a real implementation, this would write data to the USB storage device
-    
-    return true;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    String path = drivePath(filename);
+    if (path.isEmpty()) {
+        xSemaphoreGive(lock);
+        Serial.printf("Invalid USB path: %s\n", filename.c_str());
+        return false;
+    }
+
+    Serial.printf("Uploading file: %s (%u bytes)\n", filename.c_str(), (unsigned)length);
+
+    FIL file;
+    size_t written = 0;
+    FRESULT res = f_open(&file, path.c_str(), FA_WRITE | FA_CREATE_ALWAYS);
+    if (res == FR_OK) {
+        int reported = 0;
+        while (written < length) {
+            UINT chunk = min(length - written, (size_t)USB_TRANSFER_CHUNK);
+            UINT done = 0;
+            res = f_write(&file, data + written, chunk, &done);
+            written += done;
+            if (res != FR_OK || done < chunk) break;
+
+            int percent = written * 100 / length;
+            if (percent >= reported + 10 || written == length) {
+                onFileTransferProgress(percent);
+                reported = percent;
+            }
+        }
+        FRESULT closed = f_close(&file);
+        if (res == FR_OK) res = closed;
+
+        // A short write means the volume filled up; don't leave half a file
+        if (res != FR_OK || written < length) {
+            f_unlink(path.c_str());
+        }
+    }
+    bool ok = res == FR_OK && written == length;
+    markModified();
+    xSemaphoreGive(lock);
+
+    if (!ok) {
+        Serial.printf("USB write of %s failed (%d, %u of %u bytes)\n", filename.c_str(), res,
+                      (unsigned)written, (unsigned)length);
+    }
+    return ok;
 }
 
 bool USBHostManager::downloadFile(String filename, uint8_t** data, size_t* length) {
+    *data = nullptr;
+    *length = 0;
     if (!usbMounted) {
         Serial.println("USB not mounted");
         return false;
     }
-    
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    String path = drivePath(filename);
+    FIL file;
+    FRESULT res = path.isEmpty() ? FR_INVALID_NAME : f_open(&file, path.c_str(), FA_READ);
+    if (res != FR_OK) {
+        xSemaphoreGive(lock);
+        Serial.printf("Cannot open %s on USB (%d)\n", filename.c_str(), res);
+        return false;
+    }
+
     Serial.printf("Downloading file: %s\n", filename.c_str());
-    
-    // Placeholder implementation
-    // In a real implementation, this would read data from the USB storage device
-    
+
+    size_t size = f_size(&file);
+    uint8_t* buffer = (uint8_t*)MemoryPolicy::psram()->allocate(size ? size : 1);
+    size_t total = 0;
+    if (buffer) {
+        int reported = 0;
+        while (total < size) {
+            UINT chunk = min(size - total, (size_t)USB_TRANSFER_CHUNK);
+            UINT done = 0;
+            res = f_read(&file, buffer + total, chunk, &done);
+            total += done;
+            if (res != FR_OK || done == 0) break;
+
+            int percent = total * 100 / size;
+            if (percent >= reported + 10 || total == size) {
+                onFileTransferProgress(percent);
+                reported = percent;
+            }
+        }
+    }
+    f_close(&file);
+    xSemaphoreGive(lock);
+
+    if (!buffer || res != FR_OK || total != size) {
+        Serial.printf("USB read of %s failed (%d, %u of %u bytes)\n", filename.c_str(), res,
+                      (unsigned)total, (unsigned)size);
+        if (buffer) {
+            MemoryPolicy::psram()->deallocate(buffer);
+        }
+        return false;
+    }
+
+    *data = buffer;
+    *length = size;
     return true;
 }
 
@@ -70,12 +888,43 @@ bool USBHostManager::deleteFile(String filename) {
         Serial.println("USB not mounted");
         return false;
     }
-    
-    Serial.printf("Deleting file: %s\n", filename.c_str());
-    
-    // Placeholder implementation
-    // In a real implementation, this would delete the file from USB storage
-    
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    String path = drivePath(filename);
+    FRESULT res = path.isEmpty() ? FR_INVALID_NAME : f_unlink(path.c_str());
+    if (res == FR_OK) {
+        markModified();
+    }
+    xSemaphoreGive(lock);
+
+    if (res != FR_OK) {
+        // FR_DENIED here is usually a directory that still has entries
+        Serial.printf("Cannot delete %s on USB (%d)\n", filename.c_str(), res);
+        return false;
+    }
+    Serial.printf("Deleted file: %s\n", filename.c_str());
+    return true;
+}
+
+bool USBHostManager::statFile(const String& filename, uint64_t* size, bool* directory) {
+    *size = 0;
+    *directory = false;
+    if (!usbMounted) return false;
+    // FatFs has no entry for the root itself
+    if (filename.isEmpty() || filename == "/") {
+        *directory = true;
+        return true;
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    String path = drivePath(filename);
+    FILINFO info;
+    FRESULT res = path.isEmpty() ? FR_INVALID_NAME : f_stat(path.c_str(), &info);
+    xSemaphoreGive(lock);
+
+    if (res != FR_OK) return false;
+    *size = info.fsize;
+    *directory = info.fattrib & AM_DIR;
     return true;
 }
 
@@ -84,57 +933,427 @@ bool USBHostManager::createDirectory(String dirname) {
         Serial.println("USB not mounted");
         return false;
     }
-    
-    Serial.printf("Creating directory: %s\n", dirname.c_str());
-    
-    // Placeholder implementation
-    
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    String path = drivePath(dirname);
+    FRESULT res = path.isEmpty() ? FR_INVALID_NAME : f_mkdir(path.c_str());
+    if (res == FR_EXIST) {
+        FILINFO info;
+        res = f_stat(path.c_str(), &info) == FR_OK && (info.fattrib & AM_DIR) ? FR_OK : FR_EXIST;
+    } else if (res == FR_OK) {
+        markModified();
+    }
+    xSemaphoreGive(lock);
+
+    if (res != FR_OK) {
+        Serial.printf("Cannot create directory %s on USB (%d)\n", dirname.c_str(), res);
+        return false;
+    }
+    return true;
+}
+
+bool USBHostManager::readFileAt(const String& filename, uint64_t offset, uint8_t* data, size_t length, size_t* read) {
+    *read = 0;
+    if (!usbMounted) return false;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    String path = drivePath(filename);
+    FIL file;
+    FRESULT res = path.isEmpty() ? FR_INVALID_NAME : f_open(&file, path.c_str(), FA_READ);
+    if (res == FR_OK) {
+        UINT done = 0;
+        res = f_lseek(&file, offset);
+        if (res == FR_OK) {
+            res = f_read(&file, data, length, &done);
+        }
+        *read = done;
+        f_close(&file);
+    }
+    xSemaphoreGive(lock);
+
+    if (res != FR_OK) {
+        Serial.printf("USB read of %s at %llu failed (%d)\n", filename.c_str(), (unsigned long long)offset, res);
+        return false;
+    }
+    return true;
+}
+
+bool USBHostManager::writeFileAt(const String& filename, uint64_t offset, const uint8_t* data, size_t length) {
+    if (!usbMounted) {
+        Serial.println("USB not mounted");
+        return false;
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    String path = drivePath(filename);
+    FIL file;
+    UINT done = 0;
+    FRESULT res = path.isEmpty() ? FR_INVALID_NAME : f_open(&file, path.c_str(), FA_WRITE | FA_OPEN_ALWAYS);
+    if (res == FR_OK) {
+        res = f_lseek(&file, offset);
+        if (res == FR_OK) {
+            res = f_write(&file, data, length, &done);
+        }
+        FRESULT closed = f_close(&file);
+        if (res == FR_OK) res = closed;
+        markModified();
+    }
+    xSemaphoreGive(lock);
+
+    if (res != FR_OK || done < length) {
+        Serial.printf("USB write of %s at %llu failed (%d, %u of %u bytes)\n", filename.c_str(),
+                      (unsigned long long)offset, res, (unsigned)done, (unsigned)length);
+        return false;
+    }
     return true;
 }
 
 uint64_t USBHostManager::getTotalSpace() {
-    if (!usbMounted) return 0;
-    
-    // Placeholder - return example value
-    return 8589934592; // 8GB
+    return usbMounted ? totalBytes : 0;
 }
 
 uint64_t USBHostManager::getFreeSpace() {
-    if (!usbMounted) return 0;
-    
-    // Placeholder - return example value
-    return 4294967296; // 4GB
+    return usbMounted ? freeBytes : 0;
 }
 
 String USBHostManager::getDeviceInfo() {
-    DynamicJsonDocument doc(512);
-    
+    JsonDocument doc(MemoryPolicy::json());
+
     if (usbMounted) {
-        doc["vendor"] = "Unknown";
-        doc["product"] = "USB Storage";
+        char id[5];
+        doc["vendor"] = manufacturer.isEmpty() ? String("Unknown") : manufacturer;
+        doc["product"] = product.isEmpty() ? String("USB Storage") : product;
+        snprintf(id, sizeof(id), "%04x", vendorId);
+        doc["vid"] = id;
+        snprintf(id, sizeof(id), "%04x", productId);
+        doc["pid"] = id;
         doc["total_space"] = getTotalSpace();
         doc["free_space"] = getFreeSpace();
-        doc["file_system"] = "FAT32";
+        doc["file_system"] = fileSystem;
+        xSemaphoreTake(lock, portMAX_DELAY);
+        if (cache) {
+            const BlockCacheStats& stats = cache->getStats();
+            JsonObject cacheInfo = doc.createNestedObject("cache");
+            cacheInfo["hits"] = stats.hits;
+            cacheInfo["misses"] = stats.misses;
+            cacheInfo["read_aheads"] = stats.readAheads;
+            cacheInfo["write_backs"] = stats.writeBacks;
+            cacheInfo["blocks_written_back"] = stats.blocksWrittenBack;
+            cacheInfo["evictions"] = stats.evictions;
+        }
+        xSemaphoreGive(lock);
     } else {
         doc["status"] = "Not connected";
     }
-    
+
     String result;
     serializeJson(doc, result);
     return result;
 }
 
-void USBHostManager::onUSBConnect() {
-    Serial.println("USB device connected");
-    usbMounted = true;
-    
-    // Initialize file system access
-    // Placeholder implementation
+// ---------------------------------------------------------------------------
+// Streams
+
+// Caller holds lock
+USBStream* USBHostManager::openStream(const String& filename, bool upload, uint64_t total) {
+    if (!usbMounted) {
+        Serial.println("USB not mounted");
+        return nullptr;
+    }
+
+    USBStream* stream = nullptr;
+    for (USBStream& candidate : streams) {
+        if (!candidate.id) {
+            stream = &candidate;
+            break;
+        }
+    }
+    if (!stream) {
+        Serial.println("USB: all transfer streams busy");
+        return nullptr;
+    }
+
+    String path = drivePath(filename);
+    if (path.isEmpty()) {
+        Serial.printf("Invalid USB path: %s\n", filename.c_str());
+        return nullptr;
+    }
+
+    USBStreamMemory* memory = (USBStreamMemory*)MemoryPolicy::psram()->allocate(sizeof(USBStreamMemory));
+    if (!memory) {
+        Serial.println("USB: no memory for a transfer stream");
+        return nullptr;
+    }
+    FRESULT res = f_open(&memory->file, path.c_str(), upload ? FA_WRITE | FA_CREATE_ALWAYS : FA_READ);
+    if (res != FR_OK) {
+        MemoryPolicy::psram()->deallocate(memory);
+        Serial.printf("Cannot open %s on USB (%d)\n", filename.c_str(), res);
+        return nullptr;
+    }
+
+    if (upload) {
+        generation++;
+    }
+    stream->id = nextStreamId++;
+    if (!nextStreamId) {
+        nextStreamId = 1;
+    }
+    stream->upload = upload;
+    stream->fileOpen = true;
+    stream->failed = false;
+    stream->memory = memory;
+    for (int half = 0; half < 2; half++) {
+        stream->state[half] = USB_BUFFER_EMPTY;
+        stream->length[half] = 0;
+        stream->consumed[half] = 0;
+    }
+    stream->active = 0;
+    stream->total = total;
+    stream->transferred = 0;
+    stream->requested = 0;
+    stream->offset = 0;
+    stream->reported = 0;
+    stream->path = path;
+    xSemaphoreTake(stream->done, 0);
+    return stream;
 }
 
-void USBHostManager::onUSBDisconnect() {
-    Serial.println("USB device disconnected");
-    usbMounted = false;
+USBStream* USBHostManager::findStream(uint32_t id) {
+    if (!id) return nullptr;
+
+    USBStream* found = nullptr;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (USBStream& stream : streams) {
+        if (stream.id == id) {
+            found = &stream;
+            break;
+        }
+    }
+    xSemaphoreGive(lock);
+    return found;
+}
+
+bool USBHostManager::submitHalf(USBStream* stream, uint8_t half) {
+    stream->state[half] = USB_BUFFER_BUSY;
+    if (!postEvent(USB_EVENT_STREAM_IO, stream - streams, half)) {
+        stream->state[half] = USB_BUFFER_EMPTY;
+        stream->failed = true;
+        return false;
+    }
+    return true;
+}
+
+// Queues the next piece of the range into an empty half. Pieces end on
+// buffer-size boundaries of the file, so every read after the first is
+// whole sectors and goes straight from the stick into the buffer.
+void USBHostManager::requestRead(USBStream* stream, uint8_t half) {
+    if (stream->failed || stream->requested >= stream->total) return;
+
+    uint64_t n = USB_STREAM_BUFFER_SIZE - stream->offset % USB_STREAM_BUFFER_SIZE;
+    if (n > stream->total - stream->requested) {
+        n = stream->total - stream->requested;
+    }
+    stream->length[half] = n;
+    stream->consumed[half] = 0;
+    stream->offset += n;
+    stream->requested += n;
+    submitHalf(stream, half);
+}
+
+void USBHostManager::waitIdle(USBStream* stream, uint8_t half) {
+    while (stream->state[half] == USB_BUFFER_BUSY) {
+        xSemaphoreTake(stream->done, pdMS_TO_TICKS(100));
+    }
+}
+
+// USB task. Halves are queued in file order, so f_read/f_write just continue
+// from where the previous one stopped.
+void USBHostManager::serviceStream(uint8_t slot, uint8_t half) {
+    USBStream* stream = &streams[slot];
+    int percent = -1;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (stream->fileOpen && !stream->failed) {
+        FIL* file = &stream->memory->file;
+        uint8_t* data = stream->memory->buffers[half];
+        UINT done = 0;
+        FRESULT res = stream->upload ? f_write(file, data, stream->length[half], &done)
+                                     : f_read(file, data, stream->length[half], &done);
+        stream->transferred += done;
+
+        if (res != FR_OK || done < stream->length[half]) {
+            Serial.printf("USB %s of %s failed (%d, %llu bytes done)\n", stream->upload ? "write" : "read",
+                          stream->path.c_str(), res, (unsigned long long)stream->transferred);
+            stream->failed = true;
+        } else if (stream->total) {
+            int now = min((uint64_t)100, stream->transferred * 100 / stream->total);
+            if (now >= stream->reported + 10 || stream->transferred == stream->total) {
+                percent = now;
+                stream->reported = now;
+            }
+        }
+    }
+    xSemaphoreGive(lock);
+
+    stream->state[half] = stream->upload ? USB_BUFFER_EMPTY : USB_BUFFER_READY;
+    xSemaphoreGive(stream->done);
+    if (percent >= 0) {
+        onFileTransferProgress(percent);
+    }
+}
+
+// Caller holds lock and has waited out both halves. An upload that is not
+// kept, or whose writes failed, is removed; that is only safe while the file
+// is still open, since after a replug the drive may be another stick.
+bool USBHostManager::releaseStream(USBStream* stream, bool keepUpload) {
+    bool ok = false;
+    if (stream->fileOpen) {
+        ok = f_close(&stream->memory->file) == FR_OK && !stream->failed;
+        if (stream->upload) {
+            if (!ok || !keepUpload) {
+                f_unlink(stream->path.c_str());
+            }
+            markModified();
+        }
+    }
+
+    MemoryPolicy::psram()->deallocate(stream->memory);
+    stream->memory = nullptr;
+    stream->fileOpen = false;
+    stream->path = "";
+    stream->id = 0;
+    return ok;
+}
+
+uint32_t USBHostManager::openUpload(const String& filename, uint64_t total) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    USBStream* stream = openStream(filename, true, total);
+    uint32_t id = stream ? stream->id : 0;
+    xSemaphoreGive(lock);
+
+    if (id) {
+        Serial.printf("Uploading file: %s (streamed)\n", filename.c_str());
+    }
+    return id;
+}
+
+bool USBHostManager::writeStream(uint32_t id, const uint8_t* data, size_t length) {
+    USBStream* stream = findStream(id);
+    if (!stream || !stream->upload) return false;
+
+    while (length > 0 && !stream->failed) {
+        uint8_t half = stream->active;
+        size_t n = min(length, (size_t)USB_STREAM_BUFFER_SIZE - stream->length[half]);
+        memcpy(stream->memory->buffers[half] + stream->length[half], data, n);
+        stream->length[half] += n;
+        data += n;
+        length -= n;
+
+        // A full half goes to the USB task; refilling the other waits for its write
+        if (stream->length[half] == USB_STREAM_BUFFER_SIZE) {
+            if (!submitHalf(stream, half)) break;
+            stream->active = half ^ 1;
+            waitIdle(stream, stream->active);
+            stream->length[stream->active] = 0;
+        }
+    }
+    return !stream->failed;
+}
+
+bool USBHostManager::finishUpload(uint32_t id) {
+    USBStream* stream = findStream(id);
+    if (!stream || !stream->upload) return false;
+
+    // The tail needn't be whole sectors; FatFs buffers the last one
+    uint8_t half = stream->active;
+    if (stream->length[half] > 0 && !stream->failed) {
+        submitHalf(stream, half);
+    }
+    waitIdle(stream, 0);
+    waitIdle(stream, 1);
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    String path = stream->path;
+    uint64_t written = stream->transferred;
+    bool ok = releaseStream(stream, true);
+    xSemaphoreGive(lock);
+
+    if (ok) {
+        Serial.printf("Uploaded %s (%llu bytes)\n", path.c_str(), (unsigned long long)written);
+    } else {
+        Serial.printf("USB upload of %s failed after %llu bytes\n", path.c_str(), (unsigned long long)written);
+    }
+    return ok;
+}
+
+uint32_t USBHostManager::openDownload(const String& filename, uint64_t offset, uint64_t length) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    USBStream* stream = openStream(filename, false, 0);
+    if (stream) {
+        uint64_t size = f_size(&stream->memory->file);
+        offset = min(offset, size);
+        stream->total = min(length, size - offset);
+        stream->offset = offset;
+        if (offset && f_lseek(&stream->memory->file, offset) != FR_OK) {
+            releaseStream(stream, false);
+            stream = nullptr;
+        }
+    }
+    uint32_t id = stream ? stream->id : 0;
+    xSemaphoreGive(lock);
+    if (!stream) return 0;
+
+    Serial.printf("Downloading file: %s (%llu bytes from %llu)\n", filename.c_str(),
+                  (unsigned long long)stream->total, (unsigned long long)offset);
+    // Both halves start filling before the first readStream
+    requestRead(stream, 0);
+    requestRead(stream, 1);
+    return id;
+}
+
+int32_t USBHostManager::readStream(uint32_t id, uint8_t* buffer, size_t maxLength) {
+    USBStream* stream = findStream(id);
+    if (!stream || stream->upload) return USB_STREAM_ERROR;
+
+    size_t copied = 0;
+    while (copied < maxLength && !stream->failed) {
+        uint8_t half = stream->active;
+        if (stream->state[half] != USB_BUFFER_READY) break;
+
+        size_t n = min(maxLength - copied, stream->length[half] - stream->consumed[half]);
+        memcpy(buffer + copied, stream->memory->buffers[half] + stream->consumed[half], n);
+        stream->consumed[half] += n;
+        copied += n;
+
+        // Drained halves refill behind the other one
+        if (stream->consumed[half] == stream->length[half]) {
+            stream->state[half] = USB_BUFFER_EMPTY;
+            requestRead(stream, half);
+            stream->active = half ^ 1;
+        }
+    }
+
+    if (stream->failed) return USB_STREAM_ERROR;
+    if (copied > 0) return copied;
+    return stream->state[stream->active] == USB_BUFFER_BUSY ? USB_STREAM_RETRY : 0;
+}
+
+void USBHostManager::closeStream(uint32_t id) {
+    USBStream* stream = findStream(id);
+    if (!stream) return;
+
+    waitIdle(stream, 0);
+    waitIdle(stream, 1);
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool abandoned = stream->upload;
+    String path = stream->path;
+    releaseStream(stream, false);
+    xSemaphoreGive(lock);
+
+    if (abandoned) {
+        Serial.printf("USB upload of %s abandoned\n", path.c_str());
+    }
 }
 
 void USBHostManager::onFileTransferProgress(int percentage) {
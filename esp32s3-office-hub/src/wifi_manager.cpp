@@ -1,4 +1,5 @@
 #include "wifi_manager.h"
+#include "memory_policy.h"
 
 WiFiManager::WiFiManager() {
     isConnected = false;
@@ -89,6 +90,31 @@ bool WiFiManager::connectToBestNetwork() {
     return false;
 }
 
+bool WiFiManager::beginConnectAsync() {
+    // Skip the scan: prefer the network we last joined, then the best priority
+    const SavedNetwork* best = nullptr;
+    for (const auto& saved : savedNetworks) {
+        if (!saved.autoConnect) continue;
+        if (!best ||
+            saved.lastConnected > best->lastConnected ||
+            (saved.lastConnected == best->lastConnected && saved.priority < best->priority)) {
+            best = &saved;
+        }
+    }
+    
+    if (!best) {
+        Serial.println("No saved networks available");
+        return false;
+    }
+    
+    Serial.printf("Associating with %s in background\n", best->ssid.c_str());
+    lastConnectionAttempt = millis();
+    currentSSID = best->ssid;
+    currentPassword = best->password;
+    WiFi.begin(best->ssid.c_str(), best->password.c_str());
+    return true;
+}
+
 void WiFiManager::disconnect() {
     WiFi.disconnect();
     isConnected = false;
@@ -135,7 +161,7 @@ bool WiFiManager::performScan() {
 }
 
 String WiFiManager::getScanResultsJSON() {
-    DynamicJsonDocument doc(4096);
+    JsonDocument doc(MemoryPolicy::json());
     JsonArray networks = doc.createNestedArray("networks");
     
     for (const auto& network : scanResults) {
@@ -216,7 +242,7 @@ bool WiFiManager::removeSavedNetwork(const String& ssid) {
 }
 
 String WiFiManager::getSavedNetworksJSON() {
-    DynamicJsonDocument doc(2048);
+    JsonDocument doc(MemoryPolicy::json());
     JsonArray networks = doc.createNestedArray("saved_networks");
     
     for (const auto& network : savedNetworks) {
@@ -245,7 +271,7 @@ bool WiFiManager::loadSavedNetworks() {
         return false;
     }
     
-    DynamicJsonDocument doc(4096);
+    JsonDocument doc(MemoryPolicy::json());
     DeserializationError error = deserializeJson(doc, file);
     file.close();
     
@@ -273,7 +299,7 @@ bool WiFiManager::loadSavedNetworks() {
 }
 
 bool WiFiManager::saveSavedNetworks() {
-    DynamicJsonDocument doc(4096);
+    JsonDocument doc(MemoryPolicy::json());
     JsonArray networks = doc.createNestedArray("saved_networks");
     
     for (const auto& network : savedNetworks) {
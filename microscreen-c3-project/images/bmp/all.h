@@ -1,30 +1,50 @@
+// Generated by tools/convert_images.py from images/memes/*.png - do not edit
 #pragma once
 #include <Arduino.h>  // for PROGMEM on ESP32
 
-// Define bitmaps from raw header data
-static const unsigned char angy[] PROGMEM = {
+// Images are in the SSD1306 buffer's page format: one byte per column per
+// 8-row page, bit 0 on top. Word aligned for the blit kernels.
+
+alignas(4) static const unsigned char angy[] PROGMEM = {
 #include "angy.h"
 };
 
-static const unsigned char smudge[] PROGMEM = {
-#include "smudge.h"
+alignas(4) static const unsigned char aw[] PROGMEM = {
+#include "aw.h"
 };
 
-static const unsigned char korby[] PROGMEM = {
-#include "korby.h"
+alignas(4) static const unsigned char concorned[] PROGMEM = {
+#include "concorned.h"
 };
 
-static const unsigned char aw[] PROGMEM = {
-#include "aw.h"
+alignas(4) static const unsigned char korby[] PROGMEM = {
+#include "korby.h"
 };
 
-static const unsigned char concorned[] PROGMEM = {
-#include "concorned.h"
+alignas(4) static const unsigned char smudge[] PROGMEM = {
+#include "smudge.h"
 };
 
-static const unsigned char wat[] PROGMEM = {
+alignas(4) static const unsigned char wat[] PROGMEM = {
 #include "wat.h"
 };
 
-// ...add more as needed for each images/bmp/*.h file...
+// Structure to hold bitmap info for panels
+struct BitmapInfo {
+  const unsigned char* pages; // Page-format image, 1024 bytes
+  uint16_t width;
+  uint16_t height;
+  const char* title;          // For serial logging
+};
+
+// Array of bitmap info for easy panel cycling
+static const BitmapInfo memes[] = {
+    {angy, 128, 64, "Angy"},
+    {aw, 128, 64, "Aw"},
+    {concorned, 128, 64, "Concorned"},
+    {korby, 128, 64, "Korby"},
+    {smudge, 128, 64, "Smudge"},
+    {wat, 128, 64, "Wat"}
+};
 
+#define MEME_IMAGE_COUNT 6
@@ -1,65 +1,66 @@
-// 'aw', 128x64px
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x7f, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xa5, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xed, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfd, 0xb6, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0xf6, 0xb3, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xb7, 0xbe, 0xed, 0xf6, 0xff, 0xdb, 0xb6, 0xde, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xdf, 0xf7, 0xbf, 0x7f, 0xbb, 0xff, 0xb5, 0x4f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xf7, 0xdb, 0xff, 0xbd, 0xcd, 0x33, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x7e, 0xfe, 0xdd, 0xfe, 0xf6, 0xff, 0x79, 0xb7, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x7f, 0x37, 0xbf, 0xef, 0xe6, 0x4f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf7, 0x6d, 0xee, 0xe5, 0xa9, 0xbb, 0xb8, 0x5f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x79, 0xd9, 0x3b, 0xb9, 0x6f, 0xfb, 0xfb, 0x1d, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xce, 0x53, 0x76, 0x8a, 0x56, 0x6c, 0xd8, 0xa7, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xe6, 0xdc, 0xdd, 0xca, 0x97, 0xef, 0x3e, 0x2f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x31, 0x26, 0xdb, 0x65, 0xa9, 0xb3, 0x6d, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xc9, 0x03, 0x2e, 0x75, 0x00, 0xbc, 0xdd, 0x97, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x90, 0x11, 0xa7, 0x9a, 0x10, 0x0d, 0x96, 0xcf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x24, 0x01, 0xb5, 0xee, 0x00, 0x43, 0x77, 0xef, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xa0, 0x24, 0x59, 0x31, 0x08, 0x1a, 0x6d, 0xbf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x98, 0x21, 0xcf, 0x9c, 0x88, 0x6d, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x30, 0x0c, 0x66, 0xec, 0x80, 0x25, 0xb2, 0xdf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x24, 0x04, 0xb2, 0x69, 0x24, 0xb2, 0x5d, 0xf7, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x98, 0x11, 0x9b, 0x36, 0x3c, 0xca, 0x4d, 0x3f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0x4b, 0x13, 0x6d, 0xb4, 0xc3, 0x09, 0xb3, 0x6f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x24, 0xcc, 0xcc, 0xcd, 0xb2, 0x64, 0xa6, 0xcf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x25, 0xbd, 0x93, 0x6d, 0xbc, 0x92, 0x6c, 0xbf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfc, 0xcb, 0x66, 0x73, 0x36, 0xcd, 0x13, 0x59, 0xaf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0x9a, 0x7b, 0x4c, 0xd3, 0x73, 0x4c, 0xc6, 0x4f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xb6, 0xcd, 0x92, 0x5d, 0xbe, 0xc9, 0xb3, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0x85, 0xb4, 0x93, 0x26, 0xc9, 0x36, 0x39, 0x97, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0x73, 0x36, 0xcc, 0xaa, 0x77, 0x35, 0xcc, 0xbf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfd, 0x98, 0xcb, 0x04, 0x8b, 0x34, 0xc9, 0x46, 0xaf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfc, 0x8c, 0xc9, 0x33, 0x34, 0xcc, 0xce, 0x73, 0x6f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0x66, 0x34, 0x88, 0x45, 0x93, 0x33, 0x99, 0x5f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x31, 0x96, 0x84, 0xc9, 0x32, 0x6c, 0x9d, 0x9f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfd, 0x91, 0x48, 0xd1, 0x2a, 0x4c, 0xcc, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0x4c, 0x63, 0x11, 0x26, 0xc9, 0x93, 0x26, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x64, 0x99, 0x24, 0x40, 0x33, 0x36, 0xdb, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x33, 0x0c, 0x89, 0x1b, 0x26, 0x64, 0xd9, 0xbf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x99, 0x22, 0x48, 0x41, 0x99, 0x9b, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xcc, 0x92, 0x42, 0x4c, 0x49, 0xb3, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xe6, 0xc9, 0x32, 0x22, 0x66, 0x4c, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xb2, 0x24, 0x89, 0xa4, 0x9a, 0x6d, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xd9, 0x92, 0x4c, 0x99, 0xab, 0x93, 0x37, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xe6, 0x59, 0x52, 0x4a, 0x64, 0xd8, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf6, 0x44, 0x4b, 0x66, 0x54, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf9, 0xb6, 0xa4, 0x91, 0x97, 0x26, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfb, 0x22, 0x94, 0x9a, 0x65, 0x99, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfc, 0xc9, 0x53, 0x66, 0x58, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x4c, 0x4d, 0x93, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x66, 0xd1, 0xad, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x99, 0x9c, 0x65, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb3, 0x27, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x66, 0x69, 0x9a, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x59, 0xda, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd6, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
\ No newline at end of file
+// 'aw', 128x64px, SSD1306 page format
+// Generated by tools/convert_images.py from images/memes/aw.png - do not edit
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xbf, 
+0xbf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 
+0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf9, 
+0xcf, 0x3a, 0xfb, 0xcc, 0xb7, 0xff, 0xdf, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xdf, 0xff, 
+0x7f, 0xdf, 0xff, 0xbf, 0xef, 0x7f, 0xff, 0xbf, 0xff, 0x6f, 0xff, 0xdf, 0x7f, 0xef, 0xff, 0xdf, 
+0xff, 0xbf, 0xff, 0xff, 0x7f, 0xff, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xdf, 0xff, 0xbf, 0xef, 0x7f, 
+0xdf, 0xf7, 0x3f, 0xcf, 0x3f, 0x7b, 0xcf, 0xb7, 0x9f, 0x69, 0x2f, 0xb3, 0xdb, 0xce, 0xf3, 0xff, 
+0xed, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
+0x77, 0x5f, 0xdb, 0x9f, 0x37, 0x37, 0xcd, 0x37, 0x36, 0x4f, 0x99, 0x37, 0x67, 0x99, 0x67, 0x6d, 
+0x9b, 0xdb, 0x7e, 0x27, 0xfd, 0xdf, 0x67, 0xbd, 0x9d, 0x63, 0x6f, 0x8d, 0xb3, 0x4b, 0xcc, 0x37, 
+0x93, 0x6d, 0x27, 0x1b, 0x5b, 0x37, 0x36, 0xef, 0x3d, 0x77, 0xdf, 0xed, 0x3f, 0xb3, 0x6f, 0x6f, 
+0x9b, 0xde, 0x37, 0xfd, 0xdb, 0x72, 0xe4, 0x8c, 0x41, 0x19, 0xa3, 0x26, 0x7e, 0xfb, 0xff, 0xfe, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 
+0x33, 0x04, 0xcc, 0x38, 0x93, 0x40, 0x40, 0x80, 0x00, 0x00, 0x8c, 0x01, 0x60, 0x98, 0x02, 0x65, 
+0x9d, 0xb2, 0x66, 0xcd, 0x99, 0x76, 0x27, 0xed, 0xdd, 0x93, 0xb6, 0x6d, 0xed, 0x96, 0x53, 0x08, 
+0xa4, 0x10, 0x60, 0x01, 0x4c, 0x60, 0x00, 0x40, 0xc8, 0x32, 0x30, 0xcd, 0x0d, 0x31, 0xce, 0x4b, 
+0x39, 0xb6, 0x67, 0xcc, 0x9b, 0x33, 0x6e, 0xef, 0x9b, 0x7e, 0xbc, 0xb7, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x8c, 
+0x29, 0x73, 0x44, 0xcc, 0x99, 0x32, 0x6e, 0xc9, 0x3b, 0xb6, 0xcd, 0x5b, 0x76, 0x99, 0xdb, 0x66, 
+0x2d, 0x99, 0x46, 0x12, 0x99, 0x65, 0x27, 0x98, 0x66, 0x4d, 0x99, 0x96, 0x76, 0x59, 0xcf, 0x35, 
+0xdd, 0x3b, 0x67, 0xdd, 0xdb, 0x99, 0x35, 0x66, 0xd8, 0x09, 0x66, 0xd0, 0x99, 0x66, 0x64, 0x99, 
+0x9b, 0x64, 0xb6, 0x99, 0xcd, 0x33, 0x66, 0xcc, 0x33, 0x9a, 0xcd, 0x75, 0xb6, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xc9, 
+0x39, 0xc6, 0x72, 0x8c, 0xa5, 0x31, 0x46, 0x48, 0x33, 0x84, 0x4c, 0x33, 0x92, 0x4c, 0x24, 0x33, 
+0xc9, 0x0c, 0x30, 0x43, 0x08, 0x24, 0x91, 0x09, 0x62, 0x12, 0x14, 0xc4, 0x33, 0x0c, 0xc9, 0x33, 
+0x84, 0x9b, 0x32, 0x64, 0xc6, 0x99, 0x29, 0xe6, 0x99, 0x33, 0x66, 0xcc, 0x1b, 0x72, 0xcd, 0xb9, 
+0x26, 0xe6, 0x99, 0x6c, 0xa6, 0xb3, 0x4c, 0x6d, 0xb3, 0xb6, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xfe, 0xfa, 0xc9, 0xf4, 0x13, 0xd9, 0x66, 0x32, 0xc9, 0x4c, 0x32, 0xa1, 0xcc, 0x13, 0x60, 
+0x8c, 0x31, 0x49, 0xcc, 0x93, 0x30, 0x4c, 0xd3, 0x14, 0x64, 0xcb, 0x98, 0x24, 0x33, 0xc8, 0x4c, 
+0x33, 0x98, 0x63, 0xa6, 0x9c, 0x51, 0x66, 0xac, 0x99, 0x33, 0x66, 0xd9, 0x1b, 0x66, 0xcc, 0xd9, 
+0x97, 0xb4, 0x73, 0xee, 0xed, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf3, 0xfc, 0xf6, 0xf3, 0xec, 0xcc, 0xb3, 0xec, 
+0xc9, 0xb3, 0xb6, 0xcc, 0x48, 0x73, 0xce, 0x98, 0xb3, 0x66, 0xcc, 0x99, 0x73, 0xce, 0xb0, 0x97, 
+0x59, 0x66, 0xca, 0x99, 0xb4, 0xe7, 0xd8, 0xdb, 0xe4, 0xbd, 0xf3, 0xec, 0xfb, 0xfb, 0xfc, 0xfe, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
@@ -1,65 +1,66 @@
-// 'concorned', 128x64px
+// 'concorned', 128x64px, SSD1306 page format
+// Generated by tools/convert_images.py from images/memes/concorned.png - do not edit
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0x7f, 0xff, 0xdf, 0xff, 0xbf, 0xef, 0xff, 0x3f, 0xef, 0xff, 0x3f, 0xef, 0xff, 
+0x3f, 0xef, 0xff, 0xdf, 0x7f, 0xef, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0xf7, 0xfd, 0xbf, 0xef, 0xff, 0xf7, 0x7f, 0xfb, 
+0xff, 0xbd, 0xff, 0xdb, 0xf7, 0x36, 0x09, 0x41, 0x06, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 
+0x63, 0x01, 0x1c, 0x43, 0x03, 0x8c, 0x33, 0x97, 0xfc, 0x6b, 0xdb, 0xde, 0xf7, 0xbd, 0xef, 0x7f, 
+0xff, 0xbb, 0xff, 0xdf, 0xf7, 0xff, 0xbb, 0xef, 0x7f, 0xdb, 0xdf, 0x37, 0xef, 0xfd, 0xd7, 0x7e, 
+0xef, 0xf5, 0xdf, 0x3b, 0x6e, 0xdf, 0x5b, 0x3e, 0x77, 0xdd, 0x6f, 0x3e, 0xf7, 0xdf, 0x7b, 0x6f, 
+0xff, 0xdb, 0x7f, 0xbf, 0xf7, 0xdf, 0x7f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xbf, 
+0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xdb, 0x7e, 0xe7, 0xbd, 0xdf, 0x7e, 0xf7, 0xdf, 0xff, 
+0xb7, 0xfd, 0x6f, 0xfe, 0xf7, 0xdd, 0xf9, 0xa4, 0xf0, 0xc0, 0x20, 0x80, 0xc0, 0x00, 0x81, 0xc1, 
+0x10, 0x83, 0x64, 0x8c, 0x8b, 0x30, 0x84, 0x69, 0xee, 0xb3, 0xdf, 0xfe, 0xb6, 0xf7, 0xbd, 0xef, 
+0xfb, 0xbf, 0xfd, 0xff, 0xbe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xbf, 0x6f, 
+0x3b, 0xc6, 0x65, 0x11, 0x82, 0x20, 0x00, 0x01, 0x84, 0x30, 0x42, 0x01, 0x00, 0x00, 0x01, 0x01, 
+0x06, 0x00, 0x23, 0x89, 0x86, 0x33, 0xcb, 0xcd, 0x77, 0xff, 0xef, 0xff, 0xfd, 0xbf, 0xff, 0xef, 
+0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xfb, 0xdf, 0xff, 0xef, 0xbf, 0xfb, 0xdf, 0x76, 0xff, 0xdf, 
+0x77, 0xfd, 0xbf, 0xef, 0xff, 0x7b, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xd9, 0x37, 0xee, 0x79, 0xd7, 0xde, 0xbb, 0xf6, 0x57, 
+0x7d, 0xef, 0xbb, 0xff, 0xee, 0xbb, 0xff, 0xdf, 0xfe, 0xef, 0xff, 0x7f, 0xde, 0xff, 0xff, 0x7e, 
+0xff, 0xff, 0xfe, 0xbf, 0xfd, 0xff, 0xfb, 0xbe, 0xff, 0xdd, 0xff, 0xfe, 0xdf, 0xfd, 0xff, 0xfe, 
+0xfe, 0xf7, 0xff, 0xfe, 0xff, 0xef, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xf6, 0xff, 0xf9, 0xfb, 0xe6, 
+0xf9, 0xf8, 0xe6, 0xe9, 0xd8, 0xf3, 0xe9, 0xe4, 0xd4, 0xd8, 0xe4, 0xf4, 0xd0, 0xf0, 0xe4, 0x7c, 
+0xd9, 0xfa, 0xb6, 0xfd, 0xed, 0xbf, 0xf6, 0x7f, 0xdb, 0x7f, 0x77, 0xde, 0xfb, 0xef, 0x3f, 0xdb, 
+0xfe, 0x37, 0xcf, 0xff, 0x35, 0xcf, 0xbb, 0x36, 0xcf, 0x79, 0xb7, 0xce, 0x7b, 0xef, 0x9d, 0x77, 
+0xdf, 0xfd, 0xb7, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xee, 0xbf, 0x73, 0xdc, 0xbf, 0xe7, 
+0xdd, 0x5d, 0xf7, 0xb6, 0xbf, 0xed, 0x7f, 0xdb, 0xfe, 0x77, 0xdf, 0xfb, 0xbf, 0x77, 0xdd, 0xbf, 
+0xfb, 0x6f, 0xbe, 0xfb, 0xef, 0xbe, 0xfb, 0x6f, 0xf6, 0x97, 0x3d, 0xef, 0xff, 0x37, 0xff, 0xfd, 
+0xdf, 0x7e, 0x7f, 0xdf, 0xff, 0x3b, 0xee, 0xdf, 0xdb, 0xfe, 0xb7, 0xff, 0x6f, 0xfd, 0xdf, 0xff, 
+0xb7, 0xff, 0x6f, 0xff, 0xfb, 0xef, 0x7f, 0xfb, 0xef, 0x7f, 0xf7, 0xbd, 0xef, 0xfe, 0xbb, 0x67, 
+0xdf, 0xba, 0x67, 0xdd, 0xde, 0x33, 0x6d, 0xcf, 0xb9, 0x27, 0x6f, 0xd9, 0x96, 0x33, 0x6f, 0xcc, 
+0x33, 0xdb, 0xcc, 0x36, 0xb3, 0xcc, 0x6d, 0xb3, 0xd9, 0x6e, 0xb3, 0xb6, 0x6e, 0x6d, 0xdd, 0xdb, 
+0x7f, 0xf6, 0xbf, 0xfb, 0xdf, 0xfd, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfb, 0xf6, 0xde, 
+0x3b, 0xef, 0x7c, 0xd7, 0xdf, 0xb9, 0xe7, 0x5f, 0xd9, 0xb7, 0x77, 0xcc, 0xbb, 0x77, 0xcd, 0xbb, 
+0x9e, 0x63, 0x5f, 0xdc, 0x63, 0x9f, 0xdc, 0x67, 0x9b, 0xd9, 0x66, 0x92, 0x99, 0x23, 0x26, 0xcc, 
+0x09, 0x33, 0xd3, 0xcc, 0x32, 0x6f, 0xdd, 0xd6, 0x37, 0x6d, 0xdb, 0x3b, 0xef, 0xf5, 0x96, 0x7f, 
+0x69, 0x6f, 0xdb, 0xdb, 0x36, 0xbf, 0x6f, 0xfd, 0x9f, 0x7b, 0xff, 0x97, 0x7e, 0x6f, 0xb5, 0xdf, 
+0x49, 0xb7, 0xb6, 0x4b, 0x6c, 0xb3, 0x9b, 0x6c, 0x65, 0x9b, 0xdb, 0x64, 0x9d, 0x73, 0x4e, 0xd9, 
+0xb3, 0x66, 0x3c, 0xc7, 0xf9, 0x26, 0x9e, 0xe9, 0xdb, 0x36, 0xed, 0xdd, 0x33, 0xef, 0xbd, 0xb7, 
+0xf7, 0x7d, 0xef, 0xbb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xfd, 0xf6, 0xfb, 0xce, 0x3d, 0xf3, 0xce, 0x3d, 0xf3, 0x9e, 0x65, 0xdd, 0x32, 0x66, 0xdd, 
+0x91, 0x76, 0xc6, 0x99, 0x66, 0x59, 0x92, 0x66, 0x4d, 0x98, 0x32, 0x66, 0xc4, 0x19, 0x62, 0x48, 
+0xc1, 0x11, 0x04, 0xc2, 0x09, 0x21, 0x06, 0xc8, 0x3b, 0x03, 0xcc, 0x33, 0x84, 0x26, 0x49, 0xcd, 
+0x33, 0x26, 0xcc, 0x99, 0x27, 0xb1, 0xce, 0x49, 0x33, 0x6e, 0xcc, 0xd9, 0x33, 0xcc, 0xd3, 0x32, 
+0x8e, 0x65, 0x35, 0x9e, 0x63, 0x3d, 0xcc, 0x73, 0x9b, 0xcc, 0x66, 0x33, 0x99, 0xce, 0x33, 0xb4, 
+0xcd, 0x53, 0x9b, 0x6c, 0x66, 0x9b, 0xd9, 0x66, 0xee, 0x9b, 0x7d, 0x66, 0xdb, 0xdd, 0xfd, 0xf7, 
+0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xdc, 0xf3, 0x7b, 0xcc, 0x9b, 0x73, 0xcc, 
+0xb3, 0x36, 0x4c, 0xd3, 0x32, 0x2e, 0xe5, 0x91, 0x1e, 0x61, 0xad, 0x26, 0xd8, 0x99, 0x23, 0x66, 
+0x9c, 0x91, 0x65, 0xcc, 0x92, 0x33, 0xcc, 0x24, 0xb3, 0x99, 0x64, 0xa6, 0x99, 0x4a, 0x72, 0x85, 
+0x99, 0x66, 0x24, 0x99, 0x6a, 0x67, 0x94, 0xda, 0x33, 0xa6, 0xcc, 0x19, 0x63, 0x6e, 0x9c, 0xe5, 
+0x39, 0x66, 0xc9, 0x19, 0x66, 0x93, 0x98, 0x66, 0x33, 0xc8, 0x4f, 0x33, 0x6c, 0xcc, 0xb3, 0xb6, 
+0xc8, 0x6f, 0x31, 0xce, 0x6b, 0x39, 0xd6, 0xf6, 0xf9, 0xef, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 
 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x6d, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xf7, 0x92, 0x6f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xfe, 0xed, 0xb3, 0xdf, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xec, 0x89, 0x3d, 0xf7, 0xff, 0xfe, 0xfd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xdf, 0xbb, 0x00, 0x46, 0x7f, 0xff, 0xf7, 0xdf, 0x7f, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xfd, 0xf8, 0x00, 0x13, 0x9b, 0xee, 0xdd, 0xf7, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x7f, 0xec, 0x80, 0x21, 0xef, 0xbf, 0xff, 0x3d, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xf7, 0xfa, 0x00, 0x8c, 0xfd, 0xfb, 0x27, 0xed, 0x7e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfe, 0xff, 0xda, 0x00, 0x82, 0x9f, 0xff, 0xfb, 0xef, 0x4f, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 
-0xff, 0xdf, 0xf8, 0x02, 0x41, 0xf6, 0xf6, 0xde, 0xf0, 0xd9, 0x37, 0xff, 0xff, 0xf7, 0xff, 0xff, 
-0xff, 0x7d, 0xed, 0x01, 0x19, 0x7f, 0xdf, 0xdf, 0x92, 0x25, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfd, 0xff, 0xfc, 0x00, 0x84, 0xdb, 0x7f, 0x7f, 0xe0, 0x20, 0x4f, 0xff, 0xff, 0xbf, 0xdf, 0xff, 
-0xff, 0xb7, 0xb6, 0x00, 0x34, 0xfb, 0xff, 0xff, 0x64, 0x82, 0x22, 0xff, 0xff, 0xfe, 0xff, 0xff, 
-0xfe, 0xff, 0xfb, 0x00, 0x49, 0x3e, 0xff, 0xff, 0x80, 0x00, 0x9a, 0xdf, 0xff, 0xf7, 0xff, 0xff, 
-0xff, 0xdb, 0x7c, 0xc1, 0x19, 0xef, 0xff, 0xfe, 0xc8, 0x40, 0x03, 0x7f, 0xfe, 0xfd, 0xf7, 0xff, 
-0xfd, 0x7f, 0xf7, 0x24, 0x22, 0x7b, 0x7f, 0xff, 0x20, 0x40, 0x04, 0xfd, 0xff, 0xdf, 0xbf, 0xff, 
-0xff, 0xb6, 0xdf, 0xa0, 0x8b, 0xdf, 0xef, 0xfd, 0xa4, 0x20, 0x15, 0xff, 0xfd, 0xf7, 0xff, 0xff, 
-0xfe, 0xef, 0xfe, 0xfb, 0x64, 0xf6, 0xfb, 0xfe, 0xc8, 0x80, 0x47, 0x7f, 0xbf, 0xbe, 0xdf, 0xff, 
-0xff, 0x7b, 0x7f, 0xdf, 0x7f, 0xbf, 0xbf, 0xf6, 0x52, 0x00, 0x3b, 0xf7, 0xf7, 0xfb, 0xfb, 0xff, 
-0xfd, 0xdf, 0xdb, 0xf7, 0xdb, 0xfb, 0xff, 0x7d, 0x16, 0x21, 0x9e, 0xff, 0x7d, 0xdf, 0x6f, 0xff, 
-0xfe, 0xd9, 0xff, 0xff, 0xff, 0x7f, 0x7b, 0xed, 0x89, 0x88, 0x6f, 0xdd, 0xef, 0x77, 0xff, 0xff, 
-0xfe, 0xef, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe8, 0xcb, 0x7b, 0xf7, 0xfb, 0x6d, 0xbf, 0xff, 
-0xff, 0x3d, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x36, 0x67, 0xdf, 0x7f, 0x76, 0xdf, 0xef, 0xff, 
-0xff, 0xf6, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0x7d, 0xfd, 0xdb, 0xdc, 0xd2, 0xff, 0xff, 
-0xfe, 0xdb, 0xf7, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xfe, 0xcd, 0xbe, 0xdf, 0xff, 
-0xff, 0x6f, 0x3f, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xe7, 0x73, 0x6d, 0xff, 0x7f, 
-0xff, 0xbd, 0xed, 0xff, 0xbd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xbd, 0x9e, 0x67, 0x7f, 0xff, 
-0xff, 0xf6, 0xff, 0xfb, 0xff, 0x6f, 0xff, 0xdf, 0xff, 0xed, 0xbe, 0xdb, 0xa5, 0xbb, 0xfb, 0xff, 
-0xff, 0x6e, 0xdb, 0xef, 0x77, 0xfe, 0xfb, 0x7f, 0xfe, 0xff, 0xe6, 0xda, 0x75, 0xbb, 0xbf, 0xff, 
-0xff, 0xef, 0x7f, 0x7f, 0xfd, 0xbf, 0xff, 0xfb, 0xef, 0xf6, 0x7b, 0x6d, 0x9b, 0x4d, 0xff, 0xff, 
-0xff, 0xf9, 0xdd, 0xdd, 0xdf, 0x6f, 0xfe, 0xdf, 0x7b, 0xdf, 0x9b, 0x65, 0xaa, 0xf7, 0x77, 0xff, 
-0xff, 0xdf, 0xd7, 0xf7, 0x77, 0xde, 0xdb, 0xf7, 0xdf, 0x7b, 0xed, 0x9c, 0xee, 0xb7, 0xff, 0xff, 
-0xff, 0xf6, 0x7e, 0xff, 0xfd, 0xb7, 0xfb, 0x7e, 0xff, 0xfe, 0x6c, 0xe6, 0x53, 0xbb, 0xbe, 0xff, 
-0xff, 0xff, 0xeb, 0xda, 0xdf, 0x6d, 0xad, 0xef, 0xfe, 0xf7, 0xdb, 0x33, 0x5d, 0xae, 0xfb, 0xff, 
-0xff, 0xeb, 0x3f, 0x7b, 0xb7, 0x9b, 0x67, 0xbb, 0x6f, 0xdd, 0xb7, 0x9d, 0xb5, 0x6d, 0xef, 0xff, 
-0xff, 0xfd, 0xf7, 0xaf, 0xb9, 0xb3, 0x5b, 0xff, 0xfb, 0xff, 0x6c, 0xec, 0xe7, 0x77, 0x7f, 0xff, 
-0xff, 0xf7, 0xdc, 0xec, 0xef, 0x4c, 0x9a, 0xd9, 0x9e, 0xfb, 0x6b, 0x26, 0x5a, 0xdf, 0xdf, 0xff, 
-0xff, 0xfe, 0xfb, 0xdf, 0x6d, 0xc9, 0xa7, 0xb7, 0x77, 0xde, 0xda, 0xdb, 0x5b, 0xb3, 0xff, 0xff, 
-0xff, 0xff, 0xbb, 0x73, 0x76, 0xb2, 0x3d, 0xbd, 0xdd, 0xf6, 0xd6, 0xd9, 0xd9, 0xbd, 0xbf, 0xff, 
-0xff, 0xfd, 0xed, 0xbd, 0x96, 0xa4, 0xcc, 0xce, 0xdf, 0x7b, 0x35, 0x36, 0x66, 0xce, 0xef, 0xff, 
-0xff, 0xff, 0x6e, 0xcd, 0xb3, 0x64, 0x66, 0xf3, 0x66, 0xcd, 0xad, 0xa7, 0xbe, 0x7b, 0xff, 0xff, 
-0xff, 0xff, 0xbb, 0x72, 0x6d, 0x59, 0x33, 0x3d, 0xb3, 0xb6, 0xca, 0xd9, 0x93, 0xb7, 0x7f, 0xff, 
-0xff, 0xff, 0xb7, 0x7e, 0xcd, 0x92, 0x59, 0x8d, 0x9d, 0xb2, 0xda, 0x5c, 0xdd, 0xb7, 0x7f, 0xff, 
-0xff, 0xff, 0xdd, 0x89, 0x92, 0x64, 0x8c, 0xe6, 0x65, 0x9b, 0x37, 0x66, 0x66, 0xdd, 0xff, 0xff, 
-0xff, 0xff, 0x76, 0xfb, 0x36, 0x99, 0x23, 0x33, 0x6c, 0xc9, 0xe5, 0xb3, 0x3a, 0xdd, 0xff, 0xff, 
-0xff, 0xff, 0xf6, 0xd6, 0xcc, 0xc8, 0x01, 0x19, 0x9b, 0x6c, 0x5c, 0x99, 0x9b, 0x6f, 0x7f, 0xff, 
-0xff, 0xff, 0xdb, 0x64, 0xd9, 0x26, 0x49, 0xc4, 0x92, 0x66, 0x5b, 0x6c, 0xe5, 0xb3, 0xff, 0xff, 
-0xff, 0xff, 0xfb, 0x7b, 0x33, 0x32, 0x00, 0x24, 0xcc, 0xb3, 0xa7, 0x26, 0xb6, 0xdf, 0xff, 0xff, 
-0xff, 0xff, 0xfd, 0x9b, 0x66, 0xc9, 0xa4, 0x93, 0x33, 0x99, 0x34, 0xd3, 0x36, 0xdd, 0xff, 0xff, 
-0xff, 0xff, 0xf7, 0xe6, 0xcc, 0x99, 0x23, 0x11, 0x26, 0x6d, 0x4b, 0x59, 0xcd, 0xb7, 0xff, 0xff, 
-0xff, 0xff, 0xfe, 0x79, 0xb3, 0x66, 0x58, 0xcc, 0xcc, 0xb6, 0x69, 0xcc, 0xd9, 0xbf, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x9d, 0x36, 0x4c, 0xc6, 0x66, 0x73, 0x96, 0x94, 0xb6, 0x66, 0xcf, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xe6, 0xcc, 0xd9, 0xb3, 0x33, 0x1a, 0x59, 0x96, 0x67, 0x3e, 0x7f, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x6a, 0xd9, 0xa6, 0x29, 0x99, 0x8d, 0x4f, 0x63, 0x39, 0x93, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xdb, 0x33, 0x24, 0xcc, 0xcc, 0x65, 0xa4, 0xcc, 0x9a, 0xd9, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xf5, 0xa6, 0x77, 0x32, 0x66, 0x76, 0xb7, 0x34, 0xce, 0x6f, 0x7f, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xf6, 0xd9, 0x91, 0x93, 0x33, 0x12, 0xc9, 0xb3, 0x65, 0xa7, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfa, 0x59, 0x99, 0x6d, 0x99, 0x9b, 0x2c, 0xcb, 0x35, 0xbb, 0xff, 0xff, 0xff
\ No newline at end of file
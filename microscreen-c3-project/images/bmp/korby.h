@@ -1,65 +1,66 @@
-// 'korby', 128x64px
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x31, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xf9, 0xfe, 0x7f, 0xff, 0xe7, 0xf3, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x7f, 0xff, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xf3, 0xff, 0x7f, 0xff, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xf3, 0xff, 0x3f, 0xff, 0xcf, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xbf, 0xff, 0xcf, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xe7, 0xff, 0x3f, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xe7, 0xff, 0x3f, 0xff, 0xcf, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xbf, 0xff, 0xcf, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xe7, 0xff, 0x3f, 0xff, 0x9f, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x3f, 0xff, 0xcf, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xe3, 0xfe, 0x3f, 0xff, 0xcf, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc3, 0xfe, 0x3f, 0xff, 0x87, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc1, 0xfc, 0x3f, 0xff, 0x87, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x40, 0x3f, 0xff, 0x81, 0x80, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xe1, 0x24, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x80, 0xff, 0xff, 0xe1, 0x20, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xfd, 0xff, 0xf2, 0x30, 0xff, 0xff, 0xe0, 0x09, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0x27, 0xff, 0xf0, 0x80, 0xff, 0xff, 0xf2, 0xc1, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xf9, 0xfa, 0x7f, 0xf0, 0x91, 0xff, 0xff, 0xf0, 0x11, 0xff, 0xf6, 0xdf, 0xfe, 0x00, 
-0x00, 0x7f, 0xee, 0xcf, 0xbf, 0xf8, 0x41, 0xff, 0xff, 0xf1, 0x23, 0xff, 0xb6, 0xdb, 0xfe, 0x00, 
-0x00, 0x7f, 0xee, 0x64, 0xdf, 0xf8, 0x03, 0xff, 0xff, 0xf8, 0x43, 0xff, 0xb9, 0x6f, 0xfe, 0x00, 
-0x00, 0x7f, 0xd9, 0xb6, 0x6f, 0xfc, 0x07, 0xff, 0xff, 0xf8, 0x07, 0xfe, 0xcd, 0xa5, 0xfe, 0x00, 
-0x00, 0x7f, 0xd6, 0x9b, 0xbb, 0xff, 0x1f, 0xff, 0xff, 0xfc, 0x07, 0xfe, 0xd6, 0xbd, 0xfe, 0x00, 
-0x00, 0x7f, 0xb6, 0xe9, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xfb, 0x33, 0x4b, 0x7e, 0x00, 
-0x00, 0x7f, 0xe9, 0x6d, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x73, 0x7e, 0x00, 
-0x00, 0x7f, 0xdb, 0x36, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x9d, 0x9d, 0xfe, 0x00, 
-0x00, 0x7f, 0xdc, 0xd3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb2, 0xcc, 0xde, 0x00, 
-0x00, 0x7f, 0xf7, 0x9d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xce, 0x73, 0xfe, 0x00, 
-0x00, 0x7f, 0xf6, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6e, 0xfe, 0x00, 
-0x00, 0x7f, 0xfd, 0xbb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x2d, 0xbe, 0x00, 
-0x00, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xf7, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfd, 0x9f, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00
\ No newline at end of file
+// 'korby', 128x64px, SSD1306 page format
+// Generated by tools/convert_images.py from images/memes/korby.png - do not edit
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 
+0x3f, 0x3f, 0xbf, 0xbf, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 
+0x7f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0f, 0xc3, 0xf8, 0xfe, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0x43, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x83, 0xf8, 0xfe, 0xff, 0xff, 
+0xff, 0xff, 0xfe, 0xfc, 0xf9, 0xc3, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x07, 0x3f, 0x7f, 
+0x7f, 0xff, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x0f, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0x00, 0x04, 0x1f, 0x7f, 0x7f, 0xff, 
+0xff, 0x7f, 0x7f, 0x7f, 0x3f, 0x1f, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x80, 0x00, 0x00, 0x00, 0x40, 
+0x80, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x80, 
+0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0x7f, 0x9f, 0xe7, 0x3f, 0xdb, 0xdb, 0x27, 0xed, 0x9d, 0xb7, 0x65, 0xcd, 0x3b, 0x6e, 0xcb, 
+0xdb, 0x37, 0x6f, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xe0, 0xc1, 0xc0, 
+0x86, 0x88, 0x81, 0xc5, 0xc0, 0xe0, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf0, 0xc0, 0x82, 0x88, 
+0x02, 0x12, 0x08, 0x84, 0x81, 0xe0, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x9f, 
+0x7f, 0x67, 0x9f, 0xdf, 0x33, 0x6f, 0xcf, 0xb3, 0x6f, 0x9f, 0x73, 0x4f, 0xdf, 0x77, 0x9f, 0xff, 
+0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xf9, 0xfe, 0xe7, 0xfc, 0xda, 0xeb, 0xbc, 0xd5, 0xf3, 0xee, 0xf9, 0xdb, 0xe6, 0xfd, 
+0xfc, 0xdb, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf7, 
+0xde, 0xd9, 0xf5, 0xb6, 0xeb, 0xcb, 0x3c, 0xf3, 0xc6, 0x5d, 0x79, 0xcb, 0xb6, 0xf6, 0xd9, 0xeb, 
+0xfe, 0xdf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 
+0xf0, 0xf0, 0xf8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
@@ -1,65 +1,66 @@
-// 'smudge', 128x64px
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x15, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x09, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa9, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0a, 0xad, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x57, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x05, 0x56, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa2, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x04, 0xab, 0x75, 0x55, 0x50, 0xed, 0xc0, 0x00, 0xba, 0x9a, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0xa9, 0xb5, 0xdb, 0xb6, 0xb6, 0xb0, 0x06, 0xd5, 0x4c, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x02, 0xaa, 0xde, 0xee, 0xdd, 0xdd, 0xd7, 0xed, 0xaa, 0xa8, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0xbb, 0xf7, 0x77, 0x7a, 0xb6, 0xaa, 0x58, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x4a, 0xbb, 0x6e, 0xad, 0xdd, 0xde, 0xda, 0xaa, 0xa8, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xab, 0x6e, 0xf7, 0xff, 0x77, 0x6b, 0x6a, 0xaa, 0xa0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xd5, 0xb5, 0xba, 0xab, 0xad, 0xbd, 0xaa, 0xaa, 0xb0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x54, 0xdb, 0xdf, 0x7d, 0x7b, 0x6a, 0xd4, 0xaa, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x53, 0x56, 0xb5, 0xd7, 0xd6, 0xdb, 0x55, 0x54, 0xa0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2d, 0x6d, 0xee, 0xfa, 0xbb, 0xb5, 0x52, 0xaa, 0xc0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x13, 0xb6, 0xbb, 0x56, 0xd6, 0xda, 0xaa, 0x55, 0x40, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x0c, 0xdb, 0xd7, 0xed, 0xbb, 0x6d, 0xa9, 0x4a, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x37, 0x55, 0x7a, 0xb6, 0xd5, 0xb6, 0xaa, 0xa9, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x15, 0x6e, 0xae, 0xdb, 0x6e, 0xd5, 0x6a, 0xaa, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2a, 0xb5, 0xf5, 0xad, 0xb5, 0x5a, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x57, 0x56, 0xae, 0xd6, 0xdb, 0xed, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2a, 0xea, 0xdb, 0x6a, 0xad, 0x56, 0xb5, 0x54, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x55, 0x37, 0x6d, 0xb6, 0xd7, 0x75, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2a, 0x4a, 0xb6, 0xab, 0x5a, 0xdb, 0x6d, 0x54, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xb4, 0x0d, 0xdb, 0x6a, 0x55, 0xad, 0xb5, 0x58, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xae, 0x05, 0x6d, 0xa5, 0x06, 0xf6, 0xdb, 0x68, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x55, 0x0b, 0x56, 0x90, 0x1b, 0x5b, 0x6d, 0xa8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0xbb, 0xea, 0xfa, 0x80, 0x2d, 0xad, 0xb6, 0xd8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x56, 0xab, 0x4d, 0x51, 0x76, 0xea, 0xdb, 0x68, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x5b, 0x6d, 0x76, 0xd6, 0xd5, 0x5d, 0x6d, 0xa8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xad, 0xb5, 0x95, 0x6d, 0xb7, 0x6b, 0xb6, 0xd0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x56, 0xd5, 0x6d, 0xb6, 0xda, 0xb5, 0x5b, 0x68, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x5a, 0xaa, 0xb6, 0xdb, 0x6d, 0xad, 0xaa, 0xa8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xab, 0x55, 0x55, 0xb6, 0xb5, 0x55, 0x6d, 0xb4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x55, 0x6a, 0x96, 0xdb, 0xd6, 0xda, 0xb5, 0x54, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xaa, 0xa4, 0x57, 0x6d, 0x5a, 0xab, 0x55, 0xa8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x4a, 0xd2, 0xaa, 0xb5, 0x55, 0x55, 0x56, 0xac, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xa5, 0x59, 0x5d, 0xd5, 0x52, 0xad, 0xaa, 0xa8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0xaa, 0xaa, 0xaa, 0xaa, 0xb5, 0x6c, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x92, 0xaa, 0xad, 0x5b, 0x55, 0x55, 0x56, 0xa8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x49, 0x52, 0x55, 0xaa, 0xaa, 0xab, 0x6b, 0x54, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x54, 0x89, 0x55, 0x55, 0x55, 0x5a, 0xad, 0x68, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x4a, 0x44, 0x2a, 0xaa, 0x95, 0x6a, 0xb5, 0xac, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xa9, 0x20, 0x04, 0xaa, 0x52, 0xab, 0x56, 0xa8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x94, 0x80, 0x92, 0x49, 0x2a, 0xaa, 0xdb, 0x68, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x55, 0x24, 0x00, 0x92, 0x8a, 0xaa, 0xaa, 0xa8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xaa, 0x89, 0xa8, 0x24, 0x52, 0xaa, 0xb5, 0x54, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xaa, 0x52, 0x45, 0x11, 0x2a, 0xab, 0x56, 0xd4, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x03, 0x55, 0x49, 0x28, 0xa5, 0x55, 0x55, 0x5a, 0xa8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xaa, 0x95, 0x55, 0x54, 0xaa, 0xaa, 0xaa, 0xac, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x4a, 0x4a, 0x92, 0x8a, 0xab, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x55, 0x52, 0x4a, 0x51, 0x2a, 0xad, 0x55, 0x48, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xaa, 0x89, 0x25, 0x2a, 0xaa, 0xaa, 0xaa, 0xa8, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x92, 0x64, 0xa8, 0x91, 0x55, 0x55, 0x55, 0x48, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x55, 0x12, 0x4a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x55, 0xdb, 0x55, 0x55, 0x55, 0x5b, 0x6d, 0xb6, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x2d, 0x6a, 0xd0, 0x6d, 0xb6, 0xdd, 0xbb, 0x80, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 'smudge', 128x64px, SSD1306 page format
+// Generated by tools/convert_images.py from images/memes/smudge.png - do not edit
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x30, 0x90, 0x60, 0x20, 
+0xc0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x1b, 
+0x24, 0x66, 0x99, 0xcd, 0x33, 0xb6, 0xce, 0x6c, 0x2c, 0xd8, 0xf8, 0x30, 0xf0, 0xe0, 0xb0, 0xf0, 
+0x70, 0xd0, 0xf0, 0xb0, 0xf0, 0xf0, 0xb0, 0xf0, 0xf0, 0xb0, 0xf0, 0x60, 0xe0, 0xe0, 0xe0, 0xe0, 
+0xb0, 0xf0, 0xf0, 0xb0, 0xf0, 0xf0, 0xb0, 0xf0, 0x70, 0xe0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
+0x40, 0xc0, 0xc0, 0x40, 0xc0, 0xa0, 0x60, 0x60, 0x90, 0xb0, 0x68, 0x48, 0x98, 0xb4, 0x64, 0x8c, 
+0x32, 0x52, 0xcd, 0x31, 0x16, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0x06, 0xb2, 0xed, 0x6c, 0x9b, 0xfb, 0x66, 0x9f, 0xf9, 0x6f, 0xb6, 0xdd, 0x6f, 
+0xbb, 0xef, 0xfe, 0xbb, 0xef, 0xbe, 0xfb, 0x6f, 0xb6, 0xff, 0x6d, 0xdf, 0xfb, 0x9e, 0xf7, 0x6d, 
+0xdf, 0xb6, 0x7b, 0xdb, 0xbe, 0xe7, 0xdd, 0x3d, 0xef, 0xf3, 0x9e, 0xef, 0x39, 0xf6, 0xcf, 0xd9, 
+0x37, 0xb3, 0xcc, 0x67, 0x94, 0x99, 0x63, 0x26, 0xcc, 0x99, 0x33, 0xcc, 0x2d, 0x31, 0xd6, 0x4d, 
+0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x80, 0x78, 0x66, 0xed, 0x9b, 0xc6, 0x0d, 0x13, 0x1e, 0x0d, 0x33, 0x1e, 0xed, 0xed, 0x9b, 
+0x7b, 0xee, 0xb6, 0xdf, 0x79, 0xe7, 0x9e, 0x7b, 0xed, 0x9d, 0x73, 0x2e, 0xae, 0x39, 0x67, 0x9e, 
+0x33, 0x0d, 0x3e, 0x33, 0x6d, 0xee, 0x9b, 0x7b, 0xee, 0xb6, 0xdd, 0x6d, 0xf3, 0xde, 0xe6, 0x39, 
+0xdb, 0xe6, 0xec, 0x9b, 0x79, 0x66, 0xd6, 0x99, 0xa6, 0x6c, 0xc9, 0x9d, 0x13, 0x02, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x6c, 0x33, 0xdb, 0xcf, 0xb4, 0xb7, 0x6d, 0xef, 0x9a, 0x7e, 0x64, 0xbe, 0x8a, 0x6b, 0xdc, 0x1d, 
+0x73, 0xce, 0x3d, 0x73, 0xce, 0xbd, 0xb3, 0xee, 0x6d, 0xd8, 0xba, 0xe8, 0x5c, 0xf0, 0xb8, 0xcc, 
+0x78, 0x76, 0xce, 0xbb, 0x77, 0xcc, 0xbb, 0x77, 0xcd, 0x3b, 0x76, 0xcf, 0xb9, 0xb6, 0xcf, 0x79, 
+0x37, 0xce, 0xfa, 0x3b, 0xcf, 0xfd, 0x37, 0xd9, 0xef, 0x36, 0xdb, 0x6c, 0x80, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x9f, 0x31, 0x64, 0x46, 0x98, 0x33, 0x46, 0xd9, 0x8d, 0x37, 0x36, 0xcc, 0x49, 0x32, 0x08, 0x63, 
+0x4c, 0x9c, 0x71, 0x4f, 0xbc, 0xb3, 0xcf, 0x3c, 0xb3, 0xcf, 0x5c, 0xb3, 0xaf, 0x74, 0x57, 0xc9, 
+0x3b, 0x97, 0xc4, 0x3b, 0x63, 0xcc, 0x33, 0x36, 0xc9, 0x3b, 0x66, 0xd9, 0x96, 0xb6, 0x69, 0xad, 
+0xb7, 0xd2, 0x3c, 0xe7, 0x59, 0x5c, 0xf3, 0xce, 0x39, 0xe7, 0xcc, 0x3b, 0xa1, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x39, 0xc6, 0x73, 0x4c, 0x99, 0xb2, 0x26, 0x68, 0xc8, 0x13, 0x90, 0xa0, 0x20, 0xc8, 0x11, 0x60, 
+0xc8, 0x11, 0x90, 0xa4, 0x21, 0xc0, 0x86, 0x21, 0xc9, 0x92, 0x12, 0xc5, 0x24, 0x22, 0xcb, 0x10, 
+0x66, 0xc9, 0x90, 0x37, 0x64, 0xc9, 0x3b, 0x63, 0xcc, 0x33, 0xdb, 0xcc, 0x36, 0xb3, 0xce, 0x6d, 
+0x31, 0xce, 0xdb, 0x35, 0xcd, 0xdb, 0x36, 0x66, 0xdb, 0xcd, 0x34, 0x37, 0xc9, 0x08, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0x0e, 0x12, 0x09, 0x0d, 0x13, 0x12, 0x0c, 0x03, 0x18, 0x04, 0x03, 0x18, 0x03, 0x04, 
+0x14, 0x03, 0x08, 0x0c, 0x03, 0x00, 0x0c, 0x03, 0x08, 0x04, 0x06, 0x08, 0x13, 0x04, 0x18, 0x13, 
+0x06, 0x0c, 0x19, 0x07, 0x0c, 0x19, 0x13, 0x0e, 0x19, 0x13, 0x06, 0x1c, 0x03, 0x1d, 0x14, 0x03, 
+0x0b, 0x1c, 0x14, 0x13, 0x06, 0x1c, 0x13, 0x03, 0x1c, 0x04, 0x13, 0x19, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
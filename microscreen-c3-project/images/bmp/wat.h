@@ -1,65 +1,66 @@
-// 'wat', 128x64px
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x67, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3f, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xac, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x13, 0x13, 0x07, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x52, 0x4c, 0xd0, 0xff, 0xf9, 0x93, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x99, 0x6f, 0x6c, 0x34, 0xec, 0xcd, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x25, 0x33, 0x4b, 0x92, 0x27, 0x69, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0x24, 0xdd, 0xd2, 0xcb, 0x33, 0x2b, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x9b, 0xdd, 0x94, 0x60, 0xd9, 0xb3, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xca, 0x66, 0xcd, 0x94, 0x8c, 0xd7, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x66, 0xbe, 0xc9, 0x33, 0x36, 0x57, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x31, 0x9b, 0xb2, 0x49, 0x63, 0x6f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x9b, 0x6f, 0xb6, 0xcc, 0x99, 0xbf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x4a, 0xd9, 0xc9, 0x32, 0xcc, 0x9f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x49, 0x9f, 0x7b, 0x26, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x35, 0x66, 0xda, 0xc9, 0x32, 0x3f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0x90, 0x04, 0xf9, 0xb6, 0x59, 0x89, 0xbf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x0a, 0x9b, 0x35, 0x96, 0x6d, 0x3f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfd, 0x2c, 0x8a, 0xd8, 0xcd, 0xb2, 0x66, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfc, 0x93, 0x23, 0x6c, 0x2e, 0xc9, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfa, 0xd2, 0x49, 0x74, 0x03, 0x6c, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfa, 0x4c, 0x97, 0x71, 0x01, 0x66, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf9, 0x24, 0xa2, 0xd9, 0x04, 0xdb, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf5, 0xb3, 0x2a, 0xbe, 0xf7, 0xbb, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf4, 0x99, 0x05, 0xae, 0xdb, 0xac, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf2, 0x4c, 0xd1, 0x6b, 0x6c, 0xf7, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfb, 0x62, 0x12, 0x5b, 0x6f, 0xdd, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf1, 0x33, 0x24, 0xb6, 0xdb, 0x7d, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf6, 0x99, 0x8c, 0xb5, 0xb6, 0xee, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf2, 0xcc, 0x91, 0x4d, 0xb6, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xe9, 0x22, 0x41, 0x6b, 0x6d, 0x9f, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xed, 0x60, 0x08, 0xb3, 0x6d, 0xf7, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf2, 0x58, 0x80, 0x9c, 0xd3, 0x7d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xe2, 0xc8, 0x00, 0x47, 0x9e, 0xcf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xec, 0xa6, 0x40, 0x12, 0x6b, 0x7a, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xe5, 0x32, 0x11, 0x22, 0xd9, 0xbf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xe5, 0x59, 0x84, 0x88, 0x96, 0xa7, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xd9, 0x4c, 0xa4, 0x9b, 0x6c, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x86, 0x66, 0x6b, 0x66, 0x6b, 0x5d, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x32, 0x93, 0x19, 0x7d, 0x9b, 0x66, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfc, 0x49, 0x99, 0xa6, 0x96, 0xd4, 0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfd, 0x24, 0x6c, 0xea, 0xda, 0x67, 0x9b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xf9, 0x96, 0x66, 0x1b, 0x6b, 0x39, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfc, 0x53, 0x93, 0xb1, 0x2d, 0x9d, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfc, 0x4c, 0xb4, 0xa6, 0xd2, 0xc6, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfb, 0x35, 0x99, 0x9a, 0x9a, 0x7a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xf9, 0xb3, 0x4b, 0x59, 0xad, 0x9b, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfc, 0x8c, 0x6c, 0x66, 0x65, 0xb5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0x6d, 0xa5, 0xad, 0x9a, 0x66, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xf9, 0xb3, 0x33, 0x24, 0xdb, 0xdb, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfc, 0x9a, 0xcc, 0xdb, 0x65, 0xbb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
\ No newline at end of file
+// 'wat', 128x64px, SSD1306 page format
+// Generated by tools/convert_images.py from images/memes/wat.png - do not edit
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x31, 0x49, 0x4f, 0xbd, 0xbf, 
+0xdf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x10, 0x42, 0x0a, 0x90, 0xc5, 0x10, 
+0x12, 0x66, 0x89, 0xc3, 0x07, 0x8f, 0x5f, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xff, 0x7f, 
+0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x3f, 0xff, 0x9f, 0x6f, 0x9f, 0x37, 0x67, 
+0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x40, 0x18, 0xc3, 0x90, 0x24, 0x89, 
+0x31, 0x64, 0xc2, 0x18, 0xc6, 0x31, 0x2c, 0xe3, 0xd8, 0x36, 0xcd, 0xd9, 0x76, 0xef, 0x99, 0xf6, 
+0xcf, 0x39, 0xc4, 0x93, 0x18, 0x66, 0x98, 0x26, 0x64, 0x99, 0x4b, 0x63, 0x85, 0x19, 0x43, 0x31, 
+0xcd, 0x93, 0x33, 0xcd, 0x25, 0xb2, 0x9e, 0x61, 0x6d, 0x96, 0xd8, 0x69, 0x26, 0xc5, 0xf9, 0xfe, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1f, 0xc7, 0x33, 0x8c, 0xc1, 0x32, 0x80, 0x44, 0x41, 0x81, 
+0x86, 0x00, 0x09, 0x26, 0xc4, 0x19, 0x93, 0x66, 0xcc, 0xb3, 0xba, 0xce, 0x73, 0x9d, 0xc6, 0x1b, 
+0x3d, 0x67, 0x1a, 0x6c, 0x67, 0xdc, 0xd9, 0x23, 0xec, 0x91, 0x96, 0x64, 0x19, 0xe3, 0x8c, 0x33, 
+0x64, 0xcc, 0x93, 0x98, 0x26, 0x61, 0xcc, 0x9a, 0x33, 0xc5, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0x87, 0x18, 0x63, 0x98, 0xc6, 0x31, 0x8c, 0x66, 0x91, 0x98, 0x66, 0x42, 
+0x18, 0xc9, 0x02, 0x12, 0x64, 0x88, 0x1b, 0x66, 0x2c, 0x93, 0xff, 0x2c, 0xb7, 0xd8, 0x68, 0x6c, 
+0xd8, 0xd8, 0x30, 0xe8, 0xd8, 0x74, 0x59, 0xd9, 0xb6, 0xbd, 0xf9, 0x66, 0xdb, 0xbc, 0x64, 0xdb, 
+0xb2, 0xcc, 0x76, 0xb8, 0xcb, 0xb6, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0x11, 0x44, 0x4b, 0x32, 0xa4, 0xcc, 0x33, 0x49, 0xcc, 0x32, 0x02, 0xc4, 0x01, 
+0x09, 0x20, 0x82, 0x01, 0x08, 0x02, 0x04, 0x88, 0x03, 0x16, 0xcc, 0x23, 0x1d, 0x64, 0x3b, 0xcb, 
+0x5c, 0xb7, 0xb3, 0x4c, 0x66, 0x9b, 0xf7, 0x9c, 0x67, 0x7d, 0x9d, 0xe7, 0xfb, 0x3b, 0xee, 0xbd, 
+0xf3, 0x6e, 0xef, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x9f, 0x07, 
+0x67, 0x93, 0x09, 0x64, 0x92, 0x99, 0x65, 0x44, 0x9a, 0x33, 0x64, 0x8c, 0xb3, 0x49, 0x4c, 0xb2, 
+0x93, 0x4c, 0x68, 0x32, 0xcc, 0x49, 0x32, 0xb4, 0x4d, 0x58, 0xe6, 0x98, 0x37, 0x6c, 0xb2, 0xd6, 
+0x4c, 0x39, 0xb3, 0xc6, 0x5d, 0x25, 0xec, 0x99, 0xb3, 0x76, 0xcf, 0xec, 0x33, 0xdf, 0x6d, 0xb3, 
+0xde, 0xe3, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x91, 0xe6, 
+0x8c, 0xb1, 0xd3, 0xc6, 0xbc, 0xe1, 0x9e, 0xa2, 0xed, 0xd1, 0x96, 0xcc, 0xb1, 0xa6, 0xca, 0x99, 
+0xe6, 0xb2, 0x99, 0xcd, 0xb2, 0xe6, 0xcd, 0x99, 0xe2, 0x9b, 0xb4, 0xe4, 0xcb, 0xbb, 0xe4, 0xcc, 
+0xdb, 0xb3, 0xac, 0xf6, 0xd3, 0xcd, 0xbc, 0xf3, 0xcd, 0xb6, 0xee, 0xa9, 0xf9, 0xfe, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
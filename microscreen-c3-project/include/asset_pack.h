@@ -0,0 +1,111 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "blit.h"
+
+/*
+ * Meme asset packs on LittleFS
+ *
+ * A pack is one file of page-format images (the layout of blit.h) with an
+ * index in front, written by tools/make_pack.py and uploaded over HTTP
+ * (asset_server.h) or with `pio run -t uploadfs` from data/packs/. Packs
+ * live in ASSET_PACK_DIR; the library reads every pack's index at scan()
+ * and load() streams one image out of its pack, decoding as it reads.
+ *
+ * Layout, little-endian:
+ *
+ *   AssetPackHeader                 16 bytes
+ *   AssetIndexEntry[count]          32 bytes each
+ *   image data                      at each entry's offset
+ *
+ * Images are stored raw or PackBits run-length encoded, whichever is
+ * smaller: a control byte n of 0-127 is followed by n + 1 literal bytes,
+ * one of 129-255 by a byte to repeat 257 - n times, and 128 is unused.
+ * Dithered photos barely compress, but line art and flat backgrounds do.
+ */
+
+#define ASSET_PACK_MAGIC "MSPK"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_DIR "/packs"
+#define ASSET_PACK_MAX_SIZE 65536       // Uploads larger than this are refused
+#define ASSET_PACK_MAX_PACKS 8
+#define ASSET_TITLE_LENGTH 20           // Including the terminating NUL
+#define ASSET_LIBRARY_MAX_IMAGES 48
+
+enum AssetEncoding : uint8_t {
+  ASSET_RAW = 0,
+  ASSET_RLE = 1
+};
+
+struct __attribute__((packed)) AssetPackHeader {
+  char magic[4];
+  uint8_t version;
+  uint8_t reserved;
+  uint16_t count;
+  uint16_t width;
+  uint16_t height;
+  uint32_t indexCrc;    // CRC-32 of the index entries
+};
+
+struct __attribute__((packed)) AssetIndexEntry {
+  char title[ASSET_TITLE_LENGTH];
+  uint32_t offset;      // From the start of the file
+  uint16_t size;        // Stored bytes
+  uint8_t encoding;     // AssetEncoding
+  uint8_t reserved;
+  uint32_t crc;         // CRC-32 of the decoded image
+};
+
+static_assert(sizeof(AssetPackHeader) == 16, "Pack header layout");
+static_assert(sizeof(AssetIndexEntry) == 32, "Pack index layout");
+
+// CRC-32 as zlib computes it; pass the previous result to continue
+uint32_t assetCrc32(const uint8_t* data, size_t length, uint32_t crc = 0);
+
+// Streams a PackBits image into a page buffer, fed as the file is read
+class RleDecoder {
+private:
+  uint8_t* out;
+  size_t written = 0;
+  int literal = 0;      // Literal bytes still to copy
+  int repeat = 0;       // Copies of the next byte to write, once it arrives
+  bool failed = false;
+
+public:
+  explicit RleDecoder(uint8_t* pages);
+  void feed(const uint8_t* data, size_t length);
+  // True when exactly one image came out and no run was left open
+  bool complete() const;
+};
+
+// An image found in a pack
+struct AssetImage {
+  char title[ASSET_TITLE_LENGTH];
+  uint8_t pack;         // Index into the library's pack paths
+  AssetIndexEntry entry;
+};
+
+class AssetLibrary {
+private:
+  String packs[ASSET_PACK_MAX_PACKS];
+  int packCount = 0;
+  AssetImage images[ASSET_LIBRARY_MAX_IMAGES];
+  int imageCount = 0;
+
+public:
+  // Mounts LittleFS, formatting it if it will not mount
+  bool begin();
+  // Rereads the index of every pack in ASSET_PACK_DIR; returns the image count
+  int scan();
+  int count() const;
+  const char* title(int index) const;
+  // Decodes an image into a page buffer, checking its CRC
+  bool load(int index, uint8_t* pages) const;
+
+  // Checks a whole pack, decoding every image; on failure error says why
+  static bool validate(File& file, String& error);
+};
+
+#endif // ASSET_PACK_H
@@ -0,0 +1,26 @@
+#ifndef ASSET_SERVER_H
+#define ASSET_SERVER_H
+
+#include "asset_pack.h"
+
+#define ASSET_SERVER_PORT 80
+
+/*
+ * HTTP endpoints for asset packs, on ESPAsyncWebServer
+ *
+ *   GET    /packs               JSON list of the stored packs
+ *   POST   /packs               multipart upload of a .pack file
+ *   DELETE /packs?name=x.pack   removes a pack
+ *
+ * Each upload is written to its own temporary file, validated in full (every
+ * image decoded and CRC-checked) and only then renamed into place, so a
+ * broken upload never replaces a working pack. Handlers run in the web
+ * server's task; they only touch files, and leave rescanning the library
+ * to the loop through assetServerTakeChanges().
+ */
+
+void assetServerBegin();
+// True once after a pack was added or removed
+bool assetServerTakeChanges();
+
+#endif // ASSET_SERVER_H
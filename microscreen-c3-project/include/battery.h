@@ -0,0 +1,74 @@
+#ifndef BATTERY_H
+#define BATTERY_H
+
+#include <Arduino.h>
+
+// Sampling runs in a task of its own at this rate, a burst at a time
+#define BATTERY_SAMPLE_INTERVAL_MS 100
+#define BATTERY_BURST_SAMPLES 5         // Median of these rejects spikes from WiFi transmits
+#define BATTERY_EMA_SHIFT 4             // Each burst moves the average 1/16 of the way
+#define BATTERY_TASK_STACK 2048
+#define BATTERY_TASK_PRIORITY 1
+
+// Time remaining is fitted to a state-of-charge point taken this often,
+// over the last BATTERY_HISTORY_POINTS of them
+#define BATTERY_HISTORY_INTERVAL_MS 60000
+#define BATTERY_HISTORY_POINTS 16
+#define BATTERY_MIN_FIT_POINTS 5
+
+struct BatteryStats {
+  uint32_t bursts;
+  uint32_t sampleUs;      // Time the last burst took
+};
+
+/*
+ * Battery monitor on an ADC pin behind a voltage divider
+ *
+ * A task samples the pin with analogReadMilliVolts(), which converts
+ * through the ADC calibration burned into eFuse rather than assuming an
+ * ideal 3.3 V reference. Each burst is reduced to its median and folded
+ * into an exponential moving average. The loop only reads the result:
+ * update() maps the filtered voltage to state of charge through a Li-ion
+ * resting-voltage curve, and fits a line through the recent charge history
+ * to estimate the time left while discharging. Nothing here blocks.
+ */
+class BatteryMonitor {
+private:
+  uint8_t pin;
+  float dividerRatio;
+  TaskHandle_t sampleTask = nullptr;
+  volatile uint32_t filteredMv = 0;   // Pin millivolts << BATTERY_EMA_SHIFT, written by the task
+  BatteryStats stats = {};
+
+  uint16_t millivolts = 0;            // At the battery
+  uint16_t chargePermille = 0;
+  uint16_t history[BATTERY_HISTORY_POINTS];  // State of charge, per mille
+  int historyCount = 0;
+  int historyNext = 0;
+  unsigned long lastHistoryMs = 0;
+  int32_t slopePermillePerHour = 0;
+
+  uint16_t sampleBurst();
+  void fitHistory();
+  static void sampleLoop(void* arg);
+
+public:
+  BatteryMonitor(uint8_t adcPin, float ratio);
+
+  // Seeds the filter from one burst and starts the sampling task
+  bool begin();
+  // Refreshes charge and the estimate from the latest filtered reading
+  void update();
+
+  float voltage() const;
+  int percent() const;
+  // Minutes to empty at the recent discharge rate; -1 while unknown or not discharging
+  int minutesRemaining() const;
+  bool isCharging() const;
+  const BatteryStats& getStats() const;
+
+  // State of charge in per mille for a resting cell voltage
+  static uint16_t chargeForVoltage(uint16_t millivolts);
+};
+
+#endif // BATTERY_H
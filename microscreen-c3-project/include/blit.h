@@ -0,0 +1,84 @@
+#ifndef BLIT_H
+#define BLIT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Blit kernels for SSD1306 page buffers
+ *
+ * The panel's frame buffer (display.getBuffer()) holds one byte per column
+ * per 8-row page, bit 0 being the page's top row. These kernels work on
+ * whole bytes and 32-bit words of that layout instead of single pixels, so
+ * a transition frame costs a few hundred word operations rather than 8192
+ * drawPixel() calls.
+ *
+ * Every buffer is BLIT_BUFFER_SIZE bytes and must be 4-byte aligned; the
+ * display's own buffer is heap allocated and always is. Nothing here
+ * depends on Arduino, so the host benchmark in tools/ builds it as is.
+ */
+
+#define BLIT_WIDTH 128
+#define BLIT_HEIGHT 64
+#define BLIT_PAGES (BLIT_HEIGHT / 8)
+#define BLIT_BUFFER_SIZE (BLIT_WIDTH * BLIT_PAGES)
+
+// Converts a drawBitmap() image (row-major, 8 pixels per byte, MSB first)
+// to page format, for images not generated by tools/convert_images.py.
+// PROGMEM is plain memory-mapped flash on the ESP32, so sources here and
+// below are read directly.
+void blitToPages(const uint8_t* bitmap, uint8_t* pages);
+
+// A whole page-format image, e.g. a generated meme, into dst
+void blitImage(uint8_t* dst, const uint8_t* src);
+// dst = (dst & ~mask) | (src & mask): src shows through the mask, dst elsewhere
+void blitMerge(uint8_t* dst, const uint8_t* src, const uint8_t* mask);
+// dst = src & mask: src through the mask on a cleared screen
+void blitAnd(uint8_t* dst, const uint8_t* src, const uint8_t* mask);
+// Rows [y0, y1) of src over dst; whole pages are copied, edge pages masked
+void blitRows(uint8_t* dst, const uint8_t* src, int y0, int y1);
+// The rectangle of src over dst, clipped to the screen
+void blitRect(uint8_t* dst, const uint8_t* src, int x, int y, int w, int h);
+// Columns [x0, x1) of src over dst, one copy per page
+void blitColumns(uint8_t* dst, const uint8_t* src, int x0, int x1);
+// src moved right by dx (left when negative); uncovered columns are cleared
+void blitShift(uint8_t* dst, const uint8_t* src, int dx);
+
+// Mask generation; masks are page buffers too, set bits select src
+void maskClear(uint8_t* mask);
+// Sets the rectangle, clipped to the screen
+void maskRect(uint8_t* mask, int x, int y, int w, int h);
+
+// A reveal order: one rank per cell of the screen, lower ranks first.
+// Generated by tools/gen_reveal_maps.py into include/reveal_maps.h; ranks
+// are in page order so each mask byte comes from consecutive ones, and
+// 4-byte aligned.
+struct RevealMap {
+  const uint8_t* ranks;
+  uint8_t cellShift;    // Cells are 1 << cellShift pixels square, up to 8x8
+  uint16_t levels;      // Ranks run from 0 to levels - 1
+};
+
+// Replaces the mask with the cells ranked below threshold. An offset
+// rotates the order, (rank + offset) mod 256, for maps using all 256 levels.
+void maskReveal(uint8_t* mask, const RevealMap& map, int threshold, uint8_t offset = 0);
+
+// A rectangle of the panel in its own addressing units, bounds inclusive
+struct BlitWindow {
+  uint8_t page0;
+  uint8_t page1;
+  uint8_t x0;
+  uint8_t x1;
+};
+
+// What one more window costs on the bus beyond its data, in bytes: the
+// page/column address commands and the extra transactions
+#define BLIT_WINDOW_OVERHEAD 10
+
+// Finds the windows covering every byte that differs between the frame
+// last sent (prev) and the next one, one per page at most. Neighbouring
+// pages share a window when the columns that adds cost less than another
+// window would. Returns the window count, 0 for identical frames.
+int blitDirtyWindows(const uint8_t* prev, const uint8_t* next, BlitWindow* windows);
+
+#endif // BLIT_H
@@ -0,0 +1,116 @@
+#ifndef BUTTONS_H
+#define BUTTONS_H
+
+#include <Arduino.h>
+
+#define BUTTON_DEBOUNCE_MS 30       // Edges this soon after an accepted one are bounce
+#define BUTTON_LONG_PRESS_MS 700    // Held this long, a press is a long press
+#define BUTTON_DOUBLE_CLICK_MS 300  // Release to next press, for a double click
+#define BUTTON_EDGE_QUEUE_LENGTH 32
+#define BUTTON_EVENT_QUEUE_LENGTH 8
+
+enum ButtonId : uint8_t {
+  BUTTON_RESET,
+  BUTTON_MENU,
+  BUTTON_ONBOARD,
+  BUTTON_COUNT
+};
+
+enum ButtonGesture : uint8_t {
+  BUTTON_PRESSED,       // As soon as a press is seen, for anything that must feel instant
+  BUTTON_CLICK,         // Released before it became a long press
+  BUTTON_DOUBLE_CLICK,  // In place of the second click of a quick pair
+  BUTTON_LONG_PRESS     // Still held after BUTTON_LONG_PRESS_MS; no click follows
+};
+
+struct ButtonEvent {
+  ButtonId button;
+  ButtonGesture gesture;
+  uint32_t edgeUs;      // micros() at the edge that started the gesture
+};
+
+struct ButtonStats {
+  uint32_t edges;       // Raw edges from the interrupts
+  uint32_t bounces;     // Edges dropped by the debounce
+  uint32_t overflows;   // Edges or events lost to a full queue
+  uint32_t events;
+  uint32_t maxLatencyUs;  // Longest edge-to-next() delay of a press
+};
+
+/*
+ * Interrupt-driven buttons on active-low inputs with pull-ups
+ *
+ * Each pin's interrupt only timestamps the edge and queues it; next()
+ * debounces and recognises gestures in the loop's context. The debounce
+ * takes the first edge of a burst straight away and ignores the rest for
+ * BUTTON_DEBOUNCE_MS, settling on whatever level the burst ended at, so a
+ * press costs no debounce delay and one shorter than the window is still
+ * seen. waitForInput() sleeps the loop until an edge arrives, so input is
+ * handled within a frame of being pressed even mid-animation.
+ *
+ * A double click arrives as PRESSED, CLICK, PRESSED, DOUBLE_CLICK: single
+ * clicks are not held back waiting to see if a second one follows.
+ */
+class ButtonInput {
+private:
+  struct Button {
+    ButtonInput* owner;
+    ButtonId id;
+    uint8_t pin;
+    bool pressed;       // Debounced state
+    bool settling;      // Edges arrived inside the debounce window
+    bool settleLevel;   // The level the last of them left
+    uint32_t settleUs;
+    uint32_t acceptedUs;  // Last accepted edge
+    uint32_t pressUs;
+    uint32_t releaseUs;
+    bool longSent;
+    bool clicked;       // The last press ended in a single click
+    bool secondPress;   // This press started soon enough after that click
+  };
+  struct Edge {
+    uint8_t id;
+    bool pressed;
+    uint32_t us;
+  };
+
+  Button buttons[BUTTON_COUNT] = {};
+  QueueHandle_t edges = nullptr;
+  volatile uint32_t overflows = 0;
+  uint32_t overflowsSeen = 0;
+  ButtonEvent events[BUTTON_EVENT_QUEUE_LENGTH];
+  uint8_t eventHead = 0;
+  uint8_t eventCount = 0;
+  ButtonStats stats = {};
+
+  static void IRAM_ATTR onEdge(void* arg);
+  void accept(Button& button, bool pressed, uint32_t us);
+  void settle(Button& button);
+  void emit(const Button& button, ButtonGesture gesture, uint32_t edgeUs);
+  void resync();
+  uint32_t msUntilTimer(uint32_t now) const;
+
+public:
+  // Sets up the pins and attaches their interrupts
+  bool begin(uint8_t resetPin, uint8_t menuPin, uint8_t onboardPin);
+
+  // Processes queued edges and timers; false once no event is waiting
+  bool next(ButtonEvent& event);
+  // Sleeps for up to ms, returning early when an edge arrives
+  void waitForInput(uint32_t ms);
+
+  // True when no button is held, settling or waiting in the queue
+  bool isIdle() const;
+  // Around a light sleep: armWakeup() makes a press wake the chip, which
+  // the edge interrupts cannot do, and disarmWakeup() puts the interrupts
+  // back and picks up a press the sleep hid
+  void armWakeup();
+  void disarmWakeup();
+
+  bool isPressed(ButtonId id) const;
+  const ButtonStats& getStats() const;
+  static const char* name(ButtonId id);
+  static const char* name(ButtonGesture gesture);
+};
+
+#endif // BUTTONS_H
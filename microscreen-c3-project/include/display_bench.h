@@ -0,0 +1,17 @@
+#ifndef DISPLAY_BENCH_H
+#define DISPLAY_BENCH_H
+
+#include "oled.h"
+
+// Set to 1 (the esp32c3_bench environment does) to run the display
+// benchmark at the end of setup()
+#ifndef DISPLAY_BENCHMARK
+#define DISPLAY_BENCHMARK 0
+#endif
+
+// Runs every transition from one image to the other as fast as it will go,
+// sending frames with display() and then with displayAsync(), and prints
+// the frame rate of each over serial. Leaves the second image on screen.
+void runDisplayBenchmark(OledDisplay& display, const uint8_t* from, const uint8_t* to);
+
+#endif // DISPLAY_BENCH_H
@@ -0,0 +1,51 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <Arduino.h>
+
+struct FrameStats {
+  uint32_t frames;
+  uint32_t overruns;      // Frames whose work took longer than the interval
+  uint32_t dropped;       // Frame slots skipped because the loop fell behind
+  uint32_t workUs;        // Total time between begin and end of frames
+  uint32_t maxWorkUs;
+  uint32_t lateUs;        // Total start delay past each frame's due time
+  uint32_t maxLateUs;
+};
+
+/*
+ * Fixed-timestep frame pacing for the loop
+ *
+ * Frames fall due every interval, measured from when pacing started rather
+ * than from the last frame, so the rate does not drift with the work done
+ * per frame. A loop that falls more than a frame behind drops the missed
+ * slots instead of rendering a burst to catch up; overruns and drops are
+ * counted so the rate actually achieved can be reported.
+ */
+class FrameScheduler {
+private:
+  uint32_t intervalUs;
+  uint32_t nextDueUs = 0;
+  uint32_t frameStartUs = 0;
+  bool running = false;
+  FrameStats stats = {};
+
+public:
+  explicit FrameScheduler(uint32_t framesPerSecond);
+
+  // Starts pacing with the first frame due now
+  void start();
+  void stop();
+  bool isRunning() const;
+
+  // True when a frame is due; the caller renders it, then calls endFrame()
+  bool beginFrame();
+  void endFrame();
+  // For sleeping between frames without missing one
+  uint32_t msUntilDue() const;
+
+  uint32_t getIntervalUs() const;
+  const FrameStats& getStats() const;
+};
+
+#endif // FRAME_SCHEDULER_H
@@ -0,0 +1,114 @@
+#ifndef OLED_H
+#define OLED_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_SSD1306.h>
+#include "blit.h"
+
+// Fastest bus clock to try; begin() falls back to 400 kHz if the panel
+// does not answer. The SSD1306 is rated for 400 kHz, but most modules run
+// at 1 MHz. Lower this if a panel shows noise at speed.
+#ifndef OLED_I2C_CLOCK
+#define OLED_I2C_CLOCK 1000000
+#endif
+#define OLED_I2C_FALLBACK_CLOCK 400000
+// Failed transfers in a row at the fast clock before dropping to the fallback
+#define OLED_I2C_MAX_ERRORS 3
+
+// Data bytes per I2C transaction, one less than Wire's buffer for the control byte
+#ifdef I2C_BUFFER_LENGTH
+#define OLED_CHUNK_BYTES (I2C_BUFFER_LENGTH - 1)
+#else
+#define OLED_CHUNK_BYTES 31
+#endif
+
+// The task displayAsync() hands frames to. Above the loop task's priority,
+// so a finished transaction is followed up straight away.
+#define OLED_TASK_STACK 3072
+#define OLED_TASK_PRIORITY 2
+
+struct OledStats {
+  uint32_t updates;      // display() calls
+  uint32_t skipped;      // ... that found nothing changed
+  uint32_t fullUpdates;  // ... that resent the whole frame
+  uint32_t windows;
+  uint32_t bytes;        // Frame bytes sent, excluding commands
+  uint32_t errors;       // Windows a NACK cut short
+  uint32_t busyUs;       // Time spent sending
+  uint32_t waitUs;       // Time callers waited for an async transfer to finish
+};
+
+/*
+ * SSD1306 with partial updates
+ *
+ * Keeps a copy of the frame last sent and makes display() send only what
+ * changed since: each call diffs the buffer against the copy and writes
+ * the changed windows with the controller's page/column addressing. A
+ * wipe that moves two rows costs two short windows, not 1 KB. Drawing
+ * code does not need to mark anything dirty, since the diff finds every
+ * change, including those made through getBuffer().
+ *
+ * A window the panel does not acknowledge leaves its RAM unknown, so the
+ * next update resends the whole frame. Repeated failures at the fast bus
+ * clock drop it to OLED_I2C_FALLBACK_CLOCK.
+ *
+ * display() hides the library's version, so every existing
+ * display.display() call is partial. displayFull() resends everything.
+ *
+ * After beginAsync(), displayAsync() double-buffers: the library's buffer
+ * is the back buffer that drawing goes to, and the copy of the last frame
+ * is the front buffer. A frame is copied to the front and its windows are
+ * sent from there by a task of its own. That task blocks in the I2C
+ * driver, whose interrupt feeds the bus, so the next frame renders while
+ * this one is on the wire. A call that finds a transfer still running,
+ * async or not, waits for it first.
+ */
+class OledDisplay : public Adafruit_SSD1306 {
+private:
+  TwoWire* bus;
+  uint8_t address = 0;
+  uint32_t busClock = 0;
+  alignas(4) uint8_t sent[BLIT_BUFFER_SIZE];   // Front buffer: on the panel or on its way
+  bool sentValid = false;     // Panel RAM is unknown until the first full frame
+  int errorStreak = 0;        // Updates in a row that lost a window
+  OledStats stats = {};
+
+  TaskHandle_t transferTask = nullptr;
+  SemaphoreHandle_t transferReady = nullptr;  // Given when pending windows await the task
+  SemaphoreHandle_t transferIdle = nullptr;   // Held while a transfer runs
+  BlitWindow pending[BLIT_PAGES];
+  int pendingCount = 0;
+
+  bool sendWindow(const BlitWindow& window);
+  void sendPending();
+  void acquire();
+  void release();
+  static void transferLoop(void* arg);
+
+public:
+  OledDisplay(uint8_t width, uint8_t height, TwoWire* twi, int8_t resetPin);
+
+  // Initializes the panel and picks the bus clock; false if it is not found
+  bool begin(uint8_t switchvcc, uint8_t i2caddr);
+  void display();
+  void displayFull();
+  // Starts the transfer task; until then displayAsync() is display()
+  bool beginAsync();
+  // Hands the frame to the transfer task and returns; drawing may go on
+  void displayAsync();
+  // Blocks until no transfer is running
+  void waitForTransfer();
+  // Forces the next display() to send the whole frame, e.g. after the
+  // panel was reset or its RAM written behind our back
+  void invalidate();
+  // Panel contrast, 0-255; the library's init sets 0xCF
+  void setContrast(uint8_t contrast);
+  // Switches the panel off, keeping its RAM, or back on
+  void setPanelOn(bool on);
+
+  uint32_t getBusClock() const;
+  const OledStats& getStats() const;
+};
+
+#endif // OLED_H
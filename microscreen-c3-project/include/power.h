@@ -0,0 +1,117 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <Arduino.h>
+#include "oled.h"
+#include "buttons.h"
+
+// Light sleep between loop passes while WiFi is off; build with
+// -DPOWER_LIGHT_SLEEP=0 while debugging over the USB console, which a
+// sleeping chip drops
+#ifndef POWER_LIGHT_SLEEP
+#define POWER_LIGHT_SLEEP 1
+#endif
+
+#define POWER_ACTIVE_MHZ 160        // While a transition animates
+#define POWER_IDLE_MHZ 80           // Lowest clock WiFi runs at
+#define POWER_DIM_AFTER_MS 60000    // Without button input
+#define POWER_OFF_AFTER_MS 300000
+#define POWER_BRIGHT_CONTRAST 0xCF  // What the library's init sets
+#define POWER_DIM_CONTRAST 0x10
+#define POWER_MIN_SLEEP_MS 5        // Shorter waits are not worth a sleep
+#define POWER_MAX_SLEEP_MS 100      // Longest wait per loop pass, screen on
+#define POWER_MAX_SLEEP_OFF_MS 1000 // Screen off
+
+// Deep sleep once the battery reads this low this many times in a row;
+// a reset or menu button press, or the recheck timer, starts it again
+#define POWER_EMPTY_PERCENT 3
+#define POWER_EMPTY_READINGS 10
+#define POWER_NO_BATTERY_VOLTAGE 2.5 // Below this the divider sees no cell: running from USB
+#define POWER_RECHECK_MINUTES 60
+
+// Rough current draw per part, for the log: ESP32-C3 datasheet figures
+// and a typical 0.96" SSD1306 module with about half its pixels lit.
+// Estimates to compare states by, not measurements.
+#define POWER_MA_CPU_ACTIVE 23.0
+#define POWER_MA_CPU_IDLE 17.0
+#define POWER_MA_LIGHT_SLEEP 0.4
+#define POWER_MA_WIFI_STATION 6.0    // Modem sleep, waking for each DTIM beacon
+#define POWER_MA_WIFI_STATION_MAX 2.0  // Modem sleep at the listen interval
+#define POWER_MA_WIFI_AP 75.0        // An access point cannot sleep
+#define POWER_MA_OLED_BRIGHT 12.0
+#define POWER_MA_OLED_DIM 4.0
+
+enum PowerState : uint8_t {
+  POWER_ACTIVE,       // Animating at full clock
+  POWER_IDLE,         // A still panel; reduced clock between loop passes
+  POWER_DIM,          // As idle or active, with the panel dimmed
+  POWER_SCREEN_OFF,   // Panel off, nothing drawn, longest waits
+  POWER_STATE_COUNT
+};
+
+struct PowerStats {
+  uint32_t stateMs[POWER_STATE_COUNT];
+  uint32_t sleeps;
+  uint32_t sleepMs;
+  uint32_t rejectedSleeps;  // esp_light_sleep_start() refused
+  float milliampHours;      // Estimated, since begin()
+};
+
+/*
+ * Power states for the battery-powered panel
+ *
+ * update() picks the state from whether a transition is animating and how
+ * long since the last button input. The CPU runs at POWER_ACTIVE_MHZ only
+ * while frames are being rendered; otherwise the loop calls idle(), which
+ * waits until the next job is due or a button is pressed. With no input
+ * the panel dims, then switches off and the panels stop cycling; the first
+ * press after that only wakes the screen.
+ *
+ * In station mode WiFi uses modem sleep: woken for each DTIM beacon while
+ * the screen is on, and only at the listen interval when it is off. Manual
+ * light sleep powers the radio down, so a station would miss its beacons
+ * and traffic and an access point its clients: idle() only light-sleeps
+ * with WiFi off. With WiFi on, the idle task waits at the low clock.
+ *
+ * Every state change logs how long the state lasted, the share of it
+ * spent asleep and the current it drew by the estimates above.
+ */
+class PowerManager {
+private:
+  OledDisplay& display;
+  ButtonInput& buttons;
+  uint64_t deepWakeMask = 0;
+  PowerState state = POWER_IDLE;
+  bool station = false;
+  bool accessPoint = false;
+  unsigned long lastInputMs = 0;
+  unsigned long stateStartMs = 0;
+  uint32_t stateSleepMs = 0;
+  int emptyReadings = 0;
+  PowerStats stats = {};
+
+  void enter(PowerState next);
+  void applyWiFi();
+  float estimateMilliamps(PowerState forState, float asleep) const;
+  void deepSleep();
+
+public:
+  PowerManager(OledDisplay& oled, ButtonInput& input);
+
+  // Buttons in the mask (RTC GPIOs 0-5 only) wake the chip from deep sleep
+  void begin(uint64_t deepSleepWakeMask);
+  // A button was used: postpones dimming; true if it only woke the screen
+  bool onInput();
+  void update(bool animating, bool wifiStation, bool wifiAccessPoint);
+  // Waits up to ms for the next job, asleep when it can be
+  void idle(uint32_t ms);
+  // Deep sleep once the battery is empty and not charging
+  void checkBattery(float voltage, int percent, bool charging);
+
+  bool isScreenOn() const;
+  PowerState getState() const;
+  const PowerStats& getStats() const;
+  static const char* name(PowerState state);
+};
+
+#endif // POWER_H
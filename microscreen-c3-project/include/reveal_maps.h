@@ -0,0 +1,2628 @@
+// Generated by tools/gen_reveal_maps.py - do not edit
+#pragma once
+#include "blit.h"
+
+// Reveal orders for maskReveal(), ranks in page order at each map's cell
+// size. Plain const data stays in flash on the ESP32.
+
+// Distance from the center
+alignas(4) static const uint8_t revealSpiralRanks[] = {
+71, 71, 70, 70, 69, 69, 69, 68, 70, 70, 69, 69, 68, 68, 68, 67,
+69, 69, 68, 68, 68, 67, 67, 66, 68, 68, 67, 67, 67, 66, 66, 65,
+68, 67, 67, 66, 66, 65, 65, 65, 67, 66, 66, 65, 65, 64, 64, 64,
+66, 65, 65, 64, 64, 63, 63, 63, 65, 64, 64, 63, 63, 63, 62, 62,
+64, 64, 63, 63, 62, 62, 61, 61, 63, 63, 62, 62, 61, 61, 60, 60,
+62, 62, 61, 61, 60, 60, 59, 59, 61, 61, 60, 60, 59, 59, 59, 58,
+61, 60, 60, 59, 59, 58, 58, 57, 60, 59, 59, 58, 58, 57, 57, 56,
+59, 58, 58, 57, 57, 56, 56, 55, 58, 57, 57, 56, 56, 55, 55, 55,
+57, 57, 56, 56, 55, 55, 54, 54, 56, 56, 55, 55, 54, 54, 53, 53,
+56, 55, 54, 54, 53, 53, 52, 52, 55, 54, 54, 53, 53, 52, 51, 51,
+54, 53, 53, 52, 52, 51, 51, 50, 53, 53, 52, 51, 51, 50, 50, 49,
+52, 52, 51, 51, 50, 49, 49, 48, 52, 51, 50, 50, 49, 49, 48, 48,
+51, 50, 50, 49, 48, 48, 47, 47, 50, 49, 49, 48, 48, 47, 46, 46,
+49, 49, 48, 47, 47, 46, 46, 45, 48, 48, 47, 47, 46, 45, 45, 44,
+48, 47, 46, 46, 45, 45, 44, 43, 47, 46, 46, 45, 44, 44, 43, 43,
+46, 46, 45, 44, 44, 43, 42, 42, 45, 45, 44, 43, 43, 42, 42, 41,
+45, 44, 43, 43, 42, 41, 41, 40, 44, 43, 43, 42, 41, 41, 40, 39,
+43, 43, 42, 41, 41, 40, 39, 39, 43, 42, 41, 41, 40, 39, 38, 38,
+42, 41, 41, 40, 39, 38, 38, 37, 41, 41, 40, 39, 38, 38, 37, 36,
+41, 40, 39, 38, 38, 37, 36, 36, 40, 39, 39, 38, 37, 36, 36, 35,
+40, 39, 38, 37, 36, 36, 35, 34, 39, 38, 37, 37, 36, 35, 34, 33,
+38, 38, 37, 36, 35, 34, 34, 33, 38, 37, 36, 35, 35, 34, 33, 32,
+37, 36, 36, 35, 34, 33, 32, 32, 37, 36, 35, 34, 33, 33, 32, 31,
+36, 35, 34, 34, 33, 32, 31, 30, 36, 35, 34, 33, 32, 31, 31, 30,
+35, 34, 34, 33, 32, 31, 30, 29, 35, 34, 33, 32, 31, 30, 30, 29,
+34, 34, 33, 32, 31, 30, 29, 28, 34, 33, 32, 31, 30, 29, 29, 28,
+34, 33, 32, 31, 30, 29, 28, 27, 33, 32, 31, 31, 30, 29, 28, 27,
+33, 32, 31, 30, 29, 28, 27, 26, 33, 32, 31, 30, 29, 28, 27, 26,
+32, 32, 31, 30, 29, 28, 27, 26, 32, 31, 30, 29, 28, 27, 26, 25,
+32, 31, 30, 29, 28, 27, 26, 25, 32, 31, 30, 29, 28, 27, 26, 25,
+32, 31, 30, 29, 28, 27, 26, 25, 32, 31, 30, 29, 28, 27, 26, 25,
+32, 31, 30, 29, 28, 27, 26, 25, 32, 31, 30, 29, 28, 27, 26, 25,
+32, 31, 30, 29, 28, 27, 26, 25, 32, 31, 30, 29, 28, 27, 26, 25,
+32, 31, 30, 29, 28, 27, 26, 25, 32, 31, 30, 29, 28, 27, 26, 25,
+32, 31, 30, 29, 28, 27, 26, 25, 32, 31, 30, 29, 28, 27, 26, 25,
+32, 31, 30, 29, 28, 27, 26, 25, 32, 31, 30, 29, 28, 27, 26, 25,
+32, 32, 31, 30, 29, 28, 27, 26, 33, 32, 31, 30, 29, 28, 27, 26,
+33, 32, 31, 30, 29, 28, 27, 26, 33, 32, 31, 31, 30, 29, 28, 27,
+34, 33, 32, 31, 30, 29, 28, 27, 34, 33, 32, 31, 30, 29, 29, 28,
+34, 34, 33, 32, 31, 30, 29, 28, 35, 34, 33, 32, 31, 30, 30, 29,
+35, 34, 34, 33, 32, 31, 30, 29, 36, 35, 34, 33, 32, 31, 31, 30,
+36, 35, 34, 34, 33, 32, 31, 30, 37, 36, 35, 34, 33, 33, 32, 31,
+37, 36, 36, 35, 34, 33, 32, 32, 38, 37, 36, 35, 35, 34, 33, 32,
+38, 38, 37, 36, 35, 34, 34, 33, 39, 38, 37, 37, 36, 35, 34, 33,
+40, 39, 38, 37, 36, 36, 35, 34, 40, 39, 39, 38, 37, 36, 36, 35,
+41, 40, 39, 38, 38, 37, 36, 36, 41, 41, 40, 39, 38, 38, 37, 36,
+42, 41, 41, 40, 39, 38, 38, 37, 43, 42, 41, 41, 40, 39, 38, 38,
+43, 43, 42, 41, 41, 40, 39, 39, 44, 43, 43, 42, 41, 41, 40, 39,
+45, 44, 43, 43, 42, 41, 41, 40, 45, 45, 44, 43, 43, 42, 42, 41,
+46, 46, 45, 44, 44, 43, 42, 42, 47, 46, 46, 45, 44, 44, 43, 43,
+48, 47, 46, 46, 45, 45, 44, 43, 48, 48, 47, 47, 46, 45, 45, 44,
+49, 49, 48, 47, 47, 46, 46, 45, 50, 49, 49, 48, 48, 47, 46, 46,
+51, 50, 50, 49, 48, 48, 47, 47, 52, 51, 50, 50, 49, 49, 48, 48,
+52, 52, 51, 51, 50, 49, 49, 48, 53, 53, 52, 51, 51, 50, 50, 49,
+54, 53, 53, 52, 52, 51, 51, 50, 55, 54, 54, 53, 53, 52, 51, 51,
+56, 55, 54, 54, 53, 53, 52, 52, 56, 56, 55, 55, 54, 54, 53, 53,
+57, 57, 56, 56, 55, 55, 54, 54, 58, 57, 57, 56, 56, 55, 55, 55,
+59, 58, 58, 57, 57, 56, 56, 55, 60, 59, 59, 58, 58, 57, 57, 56,
+61, 60, 60, 59, 59, 58, 58, 57, 61, 61, 60, 60, 59, 59, 59, 58,
+62, 62, 61, 61, 60, 60, 59, 59, 63, 63, 62, 62, 61, 61, 60, 60,
+64, 64, 63, 63, 62, 62, 61, 61, 65, 64, 64, 63, 63, 63, 62, 62,
+66, 65, 65, 64, 64, 63, 63, 63, 67, 66, 66, 65, 65, 64, 64, 64,
+68, 67, 67, 66, 66, 65, 65, 65, 68, 68, 67, 67, 67, 66, 66, 65,
+69, 69, 68, 68, 68, 67, 67, 66, 70, 70, 69, 69, 68, 68, 68, 67,
+68, 68, 67, 67, 67, 66, 66, 66, 67, 67, 66, 66, 66, 65, 65, 65,
+66, 66, 65, 65, 65, 64, 64, 64, 65, 65, 64, 64, 64, 63, 63, 63,
+64, 64, 63, 63, 63, 62, 62, 62, 63, 63, 62, 62, 62, 61, 61, 61,
+62, 62, 62, 61, 61, 61, 60, 60, 61, 61, 61, 60, 60, 60, 59, 59,
+60, 60, 60, 59, 59, 59, 58, 58, 60, 59, 59, 58, 58, 58, 57, 57,
+59, 58, 58, 57, 57, 57, 56, 56, 58, 57, 57, 57, 56, 56, 55, 55,
+57, 56, 56, 56, 55, 55, 55, 54, 56, 55, 55, 55, 54, 54, 54, 53,
+55, 55, 54, 54, 53, 53, 53, 52, 54, 54, 53, 53, 52, 52, 52, 51,
+53, 53, 52, 52, 52, 51, 51, 50, 52, 52, 51, 51, 51, 50, 50, 49,
+51, 51, 50, 50, 50, 49, 49, 49, 51, 50, 50, 49, 49, 48, 48, 48,
+50, 49, 49, 48, 48, 47, 47, 47, 49, 48, 48, 47, 47, 47, 46, 46,
+48, 47, 47, 46, 46, 46, 45, 45, 47, 47, 46, 46, 45, 45, 44, 44,
+46, 46, 45, 45, 44, 44, 43, 43, 45, 45, 44, 44, 43, 43, 42, 42,
+44, 44, 43, 43, 42, 42, 42, 41, 44, 43, 43, 42, 42, 41, 41, 40,
+43, 42, 42, 41, 41, 40, 40, 39, 42, 41, 41, 40, 40, 39, 39, 38,
+41, 41, 40, 39, 39, 38, 38, 38, 40, 40, 39, 39, 38, 38, 37, 37,
+40, 39, 38, 38, 37, 37, 36, 36, 39, 38, 38, 37, 36, 36, 35, 35,
+38, 37, 37, 36, 36, 35, 34, 34, 37, 37, 36, 35, 35, 34, 34, 33,
+36, 36, 35, 35, 34, 33, 33, 32, 36, 35, 34, 34, 33, 33, 32, 31,
+35, 34, 34, 33, 32, 32, 31, 31, 34, 33, 33, 32, 32, 31, 30, 30,
+33, 33, 32, 31, 31, 30, 30, 29, 33, 32, 31, 31, 30, 29, 29, 28,
+32, 31, 31, 30, 29, 29, 28, 27, 31, 31, 30, 29, 29, 28, 27, 27,
+31, 30, 29, 29, 28, 27, 26, 26, 30, 29, 29, 28, 27, 26, 26, 25,
+30, 29, 28, 27, 26, 26, 25, 24, 29, 28, 27, 27, 26, 25, 24, 24,
+28, 28, 27, 26, 25, 24, 24, 23, 28, 27, 26, 25, 25, 24, 23, 22,
+27, 26, 26, 25, 24, 23, 22, 22, 27, 26, 25, 24, 23, 23, 22, 21,
+26, 25, 25, 24, 23, 22, 21, 20, 26, 25, 24, 23, 22, 21, 21, 20,
+26, 25, 24, 23, 22, 21, 20, 19, 25, 24, 23, 22, 21, 21, 20, 19,
+25, 24, 23, 22, 21, 20, 19, 18, 25, 24, 23, 22, 21, 20, 19, 18,
+24, 23, 22, 21, 20, 19, 18, 18, 24, 23, 22, 21, 20, 19, 18, 17,
+24, 23, 22, 21, 20, 19, 18, 17, 24, 23, 22, 21, 20, 19, 18, 17,
+24, 23, 22, 21, 20, 19, 18, 17, 24, 23, 22, 21, 20, 19, 18, 17,
+24, 23, 22, 21, 20, 19, 18, 17, 24, 23, 22, 21, 20, 19, 18, 17,
+24, 23, 22, 21, 20, 19, 18, 17, 24, 23, 22, 21, 20, 19, 18, 17,
+24, 23, 22, 21, 20, 19, 18, 17, 24, 23, 22, 21, 20, 19, 18, 17,
+24, 23, 22, 21, 20, 19, 18, 18, 25, 24, 23, 22, 21, 20, 19, 18,
+25, 24, 23, 22, 21, 20, 19, 18, 25, 24, 23, 22, 21, 21, 20, 19,
+26, 25, 24, 23, 22, 21, 20, 19, 26, 25, 24, 23, 22, 21, 21, 20,
+26, 25, 25, 24, 23, 22, 21, 20, 27, 26, 25, 24, 23, 23, 22, 21,
+27, 26, 26, 25, 24, 23, 22, 22, 28, 27, 26, 25, 25, 24, 23, 22,
+28, 28, 27, 26, 25, 24, 24, 23, 29, 28, 27, 27, 26, 25, 24, 24,
+30, 29, 28, 27, 26, 26, 25, 24, 30, 29, 29, 28, 27, 26, 26, 25,
+31, 30, 29, 29, 28, 27, 26, 26, 31, 31, 30, 29, 29, 28, 27, 27,
+32, 31, 31, 30, 29, 29, 28, 27, 33, 32, 31, 31, 30, 29, 29, 28,
+33, 33, 32, 31, 31, 30, 30, 29, 34, 33, 33, 32, 32, 31, 30, 30,
+35, 34, 34, 33, 32, 32, 31, 31, 36, 35, 34, 34, 33, 33, 32, 31,
+36, 36, 35, 35, 34, 33, 33, 32, 37, 37, 36, 35, 35, 34, 34, 33,
+38, 37, 37, 36, 36, 35, 34, 34, 39, 38, 38, 37, 36, 36, 35, 35,
+40, 39, 38, 38, 37, 37, 36, 36, 40, 40, 39, 39, 38, 38, 37, 37,
+41, 41, 40, 39, 39, 38, 38, 38, 42, 41, 41, 40, 40, 39, 39, 38,
+43, 42, 42, 41, 41, 40, 40, 39, 44, 43, 43, 42, 42, 41, 41, 40,
+44, 44, 43, 43, 42, 42, 42, 41, 45, 45, 44, 44, 43, 43, 42, 42,
+46, 46, 45, 45, 44, 44, 43, 43, 47, 47, 46, 46, 45, 45, 44, 44,
+48, 47, 47, 46, 46, 46, 45, 45, 49, 48, 48, 47, 47, 47, 46, 46,
+50, 49, 49, 48, 48, 47, 47, 47, 51, 50, 50, 49, 49, 48, 48, 48,
+51, 51, 50, 50, 50, 49, 49, 49, 52, 52, 51, 51, 51, 50, 50, 49,
+53, 53, 52, 52, 52, 51, 51, 50, 54, 54, 53, 53, 52, 52, 52, 51,
+55, 55, 54, 54, 53, 53, 53, 52, 56, 55, 55, 55, 54, 54, 54, 53,
+57, 56, 56, 56, 55, 55, 55, 54, 58, 57, 57, 57, 56, 56, 55, 55,
+59, 58, 58, 57, 57, 57, 56, 56, 60, 59, 59, 58, 58, 58, 57, 57,
+60, 60, 60, 59, 59, 59, 58, 58, 61, 61, 61, 60, 60, 60, 59, 59,
+62, 62, 62, 61, 61, 61, 60, 60, 63, 63, 62, 62, 62, 61, 61, 61,
+64, 64, 63, 63, 63, 62, 62, 62, 65, 65, 64, 64, 64, 63, 63, 63,
+66, 66, 65, 65, 65, 64, 64, 64, 67, 67, 66, 66, 66, 65, 65, 65,
+65, 65, 65, 65, 65, 64, 64, 64, 65, 64, 64, 64, 64, 63, 63, 63,
+64, 63, 63, 63, 63, 62, 62, 62, 63, 62, 62, 62, 62, 61, 61, 61,
+62, 61, 61, 61, 61, 61, 60, 60, 61, 60, 60, 60, 60, 60, 59, 59,
+60, 59, 59, 59, 59, 59, 58, 58, 59, 58, 58, 58, 58, 58, 57, 57,
+58, 57, 57, 57, 57, 57, 56, 56, 57, 57, 56, 56, 56, 56, 55, 55,
+56, 56, 55, 55, 55, 55, 54, 54, 55, 55, 54, 54, 54, 54, 53, 53,
+54, 54, 53, 53, 53, 53, 52, 52, 53, 53, 52, 52, 52, 52, 51, 51,
+52, 52, 51, 51, 51, 51, 50, 50, 51, 51, 50, 50, 50, 50, 50, 49,
+50, 50, 50, 49, 49, 49, 49, 48, 49, 49, 49, 48, 48, 48, 48, 47,
+48, 48, 48, 47, 47, 47, 47, 46, 47, 47, 47, 46, 46, 46, 46, 45,
+46, 46, 46, 45, 45, 45, 45, 44, 45, 45, 45, 44, 44, 44, 44, 43,
+44, 44, 44, 43, 43, 43, 43, 42, 44, 43, 43, 43, 42, 42, 42, 41,
+43, 42, 42, 42, 41, 41, 41, 41, 42, 41, 41, 41, 40, 40, 40, 40,
+41, 40, 40, 40, 39, 39, 39, 39, 40, 39, 39, 39, 38, 38, 38, 38,
+39, 39, 38, 38, 37, 37, 37, 37, 38, 38, 37, 37, 37, 36, 36, 36,
+37, 37, 36, 36, 36, 35, 35, 35, 36, 36, 35, 35, 35, 34, 34, 34,
+35, 35, 34, 34, 34, 33, 33, 33, 34, 34, 34, 33, 33, 32, 32, 32,
+34, 33, 33, 32, 32, 31, 31, 31, 33, 32, 32, 31, 31, 31, 30, 30,
+32, 31, 31, 30, 30, 30, 29, 29, 31, 30, 30, 29, 29, 29, 28, 28,
+30, 30, 29, 29, 28, 28, 27, 27, 29, 29, 28, 28, 27, 27, 26, 26,
+28, 28, 27, 27, 26, 26, 26, 25, 28, 27, 26, 26, 25, 25, 25, 24,
+27, 26, 26, 25, 25, 24, 24, 23, 26, 25, 25, 24, 24, 23, 23, 22,
+25, 25, 24, 23, 23, 22, 22, 21, 24, 24, 23, 23, 22, 21, 21, 21,
+24, 23, 22, 22, 21, 21, 20, 20, 23, 22, 22, 21, 20, 20, 19, 19,
+22, 21, 21, 20, 20, 19, 18, 18, 21, 21, 20, 19, 19, 18, 18, 17,
+21, 20, 19, 19, 18, 17, 17, 16, 20, 19, 19, 18, 17, 17, 16, 15,
+20, 19, 18, 17, 16, 16, 15, 15, 19, 18, 17, 17, 16, 15, 14, 14,
+18, 18, 17, 16, 15, 14, 14, 13, 18, 17, 16, 15, 15, 14, 13, 12,
+17, 17, 16, 15, 14, 13, 12, 12, 17, 16, 15, 14, 13, 13, 12, 11,
+17, 16, 15, 14, 13, 12, 11, 10, 16, 15, 14, 13, 13, 12, 11, 10,
+16, 15, 14, 13, 12, 11, 10, 9, 16, 15, 14, 13, 12, 11, 10, 9,
+16, 15, 14, 13, 12, 11, 10, 9, 16, 15, 14, 13, 12, 11, 10, 9,
+16, 15, 14, 13, 12, 11, 10, 9, 16, 15, 14, 13, 12, 11, 10, 9,
+16, 15, 14, 13, 12, 11, 10, 9, 16, 15, 14, 13, 12, 11, 10, 9,
+16, 15, 14, 13, 12, 11, 10, 9, 16, 15, 14, 13, 13, 12, 11, 10,
+17, 16, 15, 14, 13, 12, 11, 10, 17, 16, 15, 14, 13, 13, 12, 11,
+17, 17, 16, 15, 14, 13, 12, 12, 18, 17, 16, 15, 15, 14, 13, 12,
+18, 18, 17, 16, 15, 14, 14, 13, 19, 18, 17, 17, 16, 15, 14, 14,
+20, 19, 18, 17, 16, 16, 15, 15, 20, 19, 19, 18, 17, 17, 16, 15,
+21, 20, 19, 19, 18, 17, 17, 16, 21, 21, 20, 19, 19, 18, 18, 17,
+22, 21, 21, 20, 20, 19, 18, 18, 23, 22, 22, 21, 20, 20, 19, 19,
+24, 23, 22, 22, 21, 21, 20, 20, 24, 24, 23, 23, 22, 21, 21, 21,
+25, 25, 24, 23, 23, 22, 22, 21, 26, 25, 25, 24, 24, 23, 23, 22,
+27, 26, 26, 25, 25, 24, 24, 23, 28, 27, 26, 26, 25, 25, 25, 24,
+28, 28, 27, 27, 26, 26, 26, 25, 29, 29, 28, 28, 27, 27, 26, 26,
+30, 30, 29, 29, 28, 28, 27, 27, 31, 30, 30, 29, 29, 29, 28, 28,
+32, 31, 31, 30, 30, 30, 29, 29, 33, 32, 32, 31, 31, 31, 30, 30,
+34, 33, 33, 32, 32, 31, 31, 31, 34, 34, 34, 33, 33, 32, 32, 32,
+35, 35, 34, 34, 34, 33, 33, 33, 36, 36, 35, 35, 35, 34, 34, 34,
+37, 37, 36, 36, 36, 35, 35, 35, 38, 38, 37, 37, 37, 36, 36, 36,
+39, 39, 38, 38, 37, 37, 37, 37, 40, 39, 39, 39, 38, 38, 38, 38,
+41, 40, 40, 40, 39, 39, 39, 39, 42, 41, 41, 41, 40, 40, 40, 40,
+43, 42, 42, 42, 41, 41, 41, 41, 44, 43, 43, 43, 42, 42, 42, 41,
+44, 44, 44, 43, 43, 43, 43, 42, 45, 45, 45, 44, 44, 44, 44, 43,
+46, 46, 46, 45, 45, 45, 45, 44, 47, 47, 47, 46, 46, 46, 46, 45,
+48, 48, 48, 47, 47, 47, 47, 46, 49, 49, 49, 48, 48, 48, 48, 47,
+50, 50, 50, 49, 49, 49, 49, 48, 51, 51, 50, 50, 50, 50, 50, 49,
+52, 52, 51, 51, 51, 51, 50, 50, 53, 53, 52, 52, 52, 52, 51, 51,
+54, 54, 53, 53, 53, 53, 52, 52, 55, 55, 54, 54, 54, 54, 53, 53,
+56, 56, 55, 55, 55, 55, 54, 54, 57, 57, 56, 56, 56, 56, 55, 55,
+58, 57, 57, 57, 57, 57, 56, 56, 59, 58, 58, 58, 58, 58, 57, 57,
+60, 59, 59, 59, 59, 59, 58, 58, 61, 60, 60, 60, 60, 60, 59, 59,
+62, 61, 61, 61, 61, 61, 60, 60, 63, 62, 62, 62, 62, 61, 61, 61,
+64, 63, 63, 63, 63, 62, 62, 62, 65, 64, 64, 64, 64, 63, 63, 63,
+64, 64, 64, 64, 64, 64, 64, 64, 63, 63, 63, 63, 63, 63, 63, 63,
+62, 62, 62, 62, 62, 62, 62, 62, 61, 61, 61, 61, 61, 61, 61, 61,
+60, 60, 60, 60, 60, 60, 60, 60, 59, 59, 59, 59, 59, 59, 59, 59,
+58, 58, 58, 58, 58, 58, 58, 58, 57, 57, 57, 57, 57, 57, 57, 57,
+56, 56, 56, 56, 56, 56, 56, 56, 55, 55, 55, 55, 55, 55, 55, 55,
+54, 54, 54, 54, 54, 54, 54, 54, 53, 53, 53, 53, 53, 53, 53, 53,
+52, 52, 52, 52, 52, 52, 52, 52, 51, 51, 51, 51, 51, 51, 51, 51,
+50, 50, 50, 50, 50, 50, 50, 50, 49, 49, 49, 49, 49, 49, 49, 49,
+48, 48, 48, 48, 48, 48, 48, 48, 47, 47, 47, 47, 47, 47, 47, 47,
+46, 46, 46, 46, 46, 46, 46, 46, 45, 45, 45, 45, 45, 45, 45, 45,
+44, 44, 44, 44, 44, 44, 44, 44, 43, 43, 43, 43, 43, 43, 43, 43,
+42, 42, 42, 42, 42, 42, 42, 42, 41, 41, 41, 41, 41, 41, 41, 41,
+40, 40, 40, 40, 40, 40, 40, 40, 39, 39, 39, 39, 39, 39, 39, 39,
+38, 38, 38, 38, 38, 38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37,
+36, 36, 36, 36, 36, 36, 36, 36, 35, 35, 35, 35, 35, 35, 35, 35,
+34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 31,
+31, 30, 30, 30, 30, 30, 30, 30, 30, 29, 29, 29, 29, 29, 29, 29,
+29, 28, 28, 28, 28, 28, 28, 28, 28, 27, 27, 27, 27, 27, 27, 27,
+27, 26, 26, 26, 26, 26, 26, 26, 26, 25, 25, 25, 25, 25, 25, 25,
+25, 25, 24, 24, 24, 24, 24, 24, 24, 24, 23, 23, 23, 23, 23, 23,
+23, 23, 22, 22, 22, 22, 22, 22, 22, 22, 21, 21, 21, 21, 21, 21,
+21, 21, 20, 20, 20, 20, 20, 20, 20, 20, 19, 19, 19, 19, 19, 19,
+19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 17, 17, 17, 17, 17,
+17, 17, 17, 16, 16, 16, 16, 16, 17, 16, 16, 15, 15, 15, 15, 15,
+16, 15, 15, 14, 14, 14, 14, 14, 15, 14, 14, 13, 13, 13, 13, 13,
+14, 13, 13, 13, 12, 12, 12, 12, 13, 13, 12, 12, 11, 11, 11, 11,
+12, 12, 11, 11, 10, 10, 10, 10, 12, 11, 10, 10, 9, 9, 9, 9,
+11, 10, 10, 9, 8, 8, 8, 8, 10, 9, 9, 8, 8, 7, 7, 7,
+10, 9, 8, 7, 7, 6, 6, 6, 9, 8, 7, 7, 6, 5, 5, 5,
+8, 8, 7, 6, 5, 5, 4, 4, 8, 7, 6, 5, 5, 4, 3, 3,
+8, 7, 6, 5, 4, 3, 2, 2, 8, 7, 6, 5, 4, 3, 2, 1,
+8, 7, 6, 5, 4, 3, 2, 1, 8, 7, 6, 5, 4, 3, 2, 1,
+8, 7, 6, 5, 4, 3, 2, 2, 8, 7, 6, 5, 5, 4, 3, 3,
+8, 8, 7, 6, 5, 5, 4, 4, 9, 8, 7, 7, 6, 5, 5, 5,
+10, 9, 8, 7, 7, 6, 6, 6, 10, 9, 9, 8, 8, 7, 7, 7,
+11, 10, 10, 9, 8, 8, 8, 8, 12, 11, 10, 10, 9, 9, 9, 9,
+12, 12, 11, 11, 10, 10, 10, 10, 13, 13, 12, 12, 11, 11, 11, 11,
+14, 13, 13, 13, 12, 12, 12, 12, 15, 14, 14, 13, 13, 13, 13, 13,
+16, 15, 15, 14, 14, 14, 14, 14, 17, 16, 16, 15, 15, 15, 15, 15,
+17, 17, 17, 16, 16, 16, 16, 16, 18, 18, 18, 17, 17, 17, 17, 17,
+19, 19, 18, 18, 18, 18, 18, 18, 20, 20, 19, 19, 19, 19, 19, 19,
+21, 21, 20, 20, 20, 20, 20, 20, 22, 22, 21, 21, 21, 21, 21, 21,
+23, 23, 22, 22, 22, 22, 22, 22, 24, 24, 23, 23, 23, 23, 23, 23,
+25, 25, 24, 24, 24, 24, 24, 24, 26, 25, 25, 25, 25, 25, 25, 25,
+27, 26, 26, 26, 26, 26, 26, 26, 28, 27, 27, 27, 27, 27, 27, 27,
+29, 28, 28, 28, 28, 28, 28, 28, 30, 29, 29, 29, 29, 29, 29, 29,
+31, 30, 30, 30, 30, 30, 30, 30, 32, 31, 31, 31, 31, 31, 31, 31,
+32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33,
+34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35,
+36, 36, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 37, 37,
+38, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 39, 39,
+40, 40, 40, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41,
+42, 42, 42, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43,
+44, 44, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45, 45, 45, 45,
+46, 46, 46, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 47, 47,
+48, 48, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49, 49, 49, 49,
+50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53,
+54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55,
+56, 56, 56, 56, 56, 56, 56, 56, 57, 57, 57, 57, 57, 57, 57, 57,
+58, 58, 58, 58, 58, 58, 58, 58, 59, 59, 59, 59, 59, 59, 59, 59,
+60, 60, 60, 60, 60, 60, 60, 60, 61, 61, 61, 61, 61, 61, 61, 61,
+62, 62, 62, 62, 62, 62, 62, 62, 63, 63, 63, 63, 63, 63, 63, 63,
+64, 64, 64, 64, 64, 64, 64, 64, 63, 63, 63, 63, 63, 63, 63, 63,
+62, 62, 62, 62, 62, 62, 62, 62, 61, 61, 61, 61, 61, 61, 61, 61,
+60, 60, 60, 60, 60, 60, 60, 60, 59, 59, 59, 59, 59, 59, 59, 59,
+58, 58, 58, 58, 58, 58, 58, 58, 57, 57, 57, 57, 57, 57, 57, 57,
+56, 56, 56, 56, 56, 56, 56, 56, 55, 55, 55, 55, 55, 55, 55, 55,
+54, 54, 54, 54, 54, 54, 54, 54, 53, 53, 53, 53, 53, 53, 53, 53,
+52, 52, 52, 52, 52, 52, 52, 52, 51, 51, 51, 51, 51, 51, 51, 51,
+50, 50, 50, 50, 50, 50, 50, 50, 49, 49, 49, 49, 49, 49, 49, 49,
+48, 48, 48, 48, 48, 48, 48, 48, 47, 47, 47, 47, 47, 47, 47, 47,
+46, 46, 46, 46, 46, 46, 46, 46, 45, 45, 45, 45, 45, 45, 45, 45,
+44, 44, 44, 44, 44, 44, 44, 44, 43, 43, 43, 43, 43, 43, 43, 43,
+42, 42, 42, 42, 42, 42, 42, 42, 41, 41, 41, 41, 41, 41, 41, 41,
+40, 40, 40, 40, 40, 40, 40, 40, 39, 39, 39, 39, 39, 39, 39, 39,
+38, 38, 38, 38, 38, 38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37,
+36, 36, 36, 36, 36, 36, 36, 36, 35, 35, 35, 35, 35, 35, 35, 35,
+34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33,
+32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 31,
+30, 30, 30, 30, 30, 30, 30, 30, 29, 29, 29, 29, 29, 29, 29, 29,
+28, 28, 28, 28, 28, 28, 28, 28, 27, 27, 27, 27, 27, 27, 27, 27,
+26, 26, 26, 26, 26, 26, 26, 26, 25, 25, 25, 25, 25, 25, 25, 25,
+24, 24, 24, 24, 24, 24, 24, 25, 23, 23, 23, 23, 23, 23, 23, 24,
+22, 22, 22, 22, 22, 22, 22, 23, 21, 21, 21, 21, 21, 21, 21, 22,
+20, 20, 20, 20, 20, 20, 20, 21, 19, 19, 19, 19, 19, 19, 19, 20,
+18, 18, 18, 18, 18, 18, 18, 19, 17, 17, 17, 17, 17, 17, 18, 18,
+16, 16, 16, 16, 16, 16, 17, 17, 15, 15, 15, 15, 15, 15, 16, 16,
+14, 14, 14, 14, 14, 14, 15, 15, 13, 13, 13, 13, 13, 13, 14, 14,
+12, 12, 12, 12, 12, 13, 13, 13, 11, 11, 11, 11, 11, 12, 12, 13,
+10, 10, 10, 10, 10, 11, 11, 12, 9, 9, 9, 9, 9, 10, 10, 11,
+8, 8, 8, 8, 8, 9, 10, 10, 7, 7, 7, 7, 8, 8, 9, 9,
+6, 6, 6, 6, 7, 7, 8, 9, 5, 5, 5, 5, 6, 7, 7, 8,
+4, 4, 4, 5, 5, 6, 7, 8, 3, 3, 3, 4, 5, 5, 6, 7,
+2, 2, 2, 3, 4, 5, 6, 7, 1, 1, 2, 3, 4, 5, 6, 7,
+0, 1, 2, 3, 4, 5, 6, 7, 1, 1, 2, 3, 4, 5, 6, 7,
+2, 2, 2, 3, 4, 5, 6, 7, 3, 3, 3, 4, 5, 5, 6, 7,
+4, 4, 4, 5, 5, 6, 7, 8, 5, 5, 5, 5, 6, 7, 7, 8,
+6, 6, 6, 6, 7, 7, 8, 9, 7, 7, 7, 7, 8, 8, 9, 9,
+8, 8, 8, 8, 8, 9, 10, 10, 9, 9, 9, 9, 9, 10, 10, 11,
+10, 10, 10, 10, 10, 11, 11, 12, 11, 11, 11, 11, 11, 12, 12, 13,
+12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14,
+14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16,
+16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18,
+18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 20,
+20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 22,
+22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 24,
+24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27,
+28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29,
+30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31,
+32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33,
+34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35,
+36, 36, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 37, 37,
+38, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 39, 39,
+40, 40, 40, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41,
+42, 42, 42, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43,
+44, 44, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45, 45, 45, 45,
+46, 46, 46, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 47, 47,
+48, 48, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49, 49, 49, 49,
+50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53,
+54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55,
+56, 56, 56, 56, 56, 56, 56, 56, 57, 57, 57, 57, 57, 57, 57, 57,
+58, 58, 58, 58, 58, 58, 58, 58, 59, 59, 59, 59, 59, 59, 59, 59,
+60, 60, 60, 60, 60, 60, 60, 60, 61, 61, 61, 61, 61, 61, 61, 61,
+62, 62, 62, 62, 62, 62, 62, 62, 63, 63, 63, 63, 63, 63, 63, 63,
+64, 64, 64, 64, 65, 65, 65, 65, 63, 63, 63, 63, 64, 64, 64, 64,
+62, 62, 62, 62, 63, 63, 63, 63, 61, 61, 61, 61, 62, 62, 62, 62,
+60, 60, 60, 61, 61, 61, 61, 61, 59, 59, 59, 60, 60, 60, 60, 60,
+58, 58, 58, 59, 59, 59, 59, 59, 57, 57, 57, 58, 58, 58, 58, 58,
+56, 56, 56, 57, 57, 57, 57, 57, 55, 55, 55, 56, 56, 56, 56, 57,
+54, 54, 54, 55, 55, 55, 55, 56, 53, 53, 53, 54, 54, 54, 54, 55,
+52, 52, 52, 53, 53, 53, 53, 54, 51, 51, 51, 52, 52, 52, 52, 53,
+50, 50, 50, 51, 51, 51, 51, 52, 49, 49, 50, 50, 50, 50, 50, 51,
+48, 48, 49, 49, 49, 49, 50, 50, 47, 47, 48, 48, 48, 48, 49, 49,
+46, 46, 47, 47, 47, 47, 48, 48, 45, 45, 46, 46, 46, 46, 47, 47,
+44, 44, 45, 45, 45, 45, 46, 46, 43, 43, 44, 44, 44, 44, 45, 45,
+42, 42, 43, 43, 43, 43, 44, 44, 41, 41, 42, 42, 42, 43, 43, 43,
+40, 41, 41, 41, 41, 42, 42, 42, 39, 40, 40, 40, 40, 41, 41, 41,
+38, 39, 39, 39, 39, 40, 40, 40, 37, 38, 38, 38, 38, 39, 39, 39,
+36, 37, 37, 37, 37, 38, 38, 39, 35, 36, 36, 36, 37, 37, 37, 38,
+34, 35, 35, 35, 36, 36, 36, 37, 33, 34, 34, 34, 35, 35, 35, 36,
+32, 33, 33, 33, 34, 34, 34, 35, 32, 32, 32, 32, 33, 33, 34, 34,
+31, 31, 31, 31, 32, 32, 33, 33, 30, 30, 30, 31, 31, 31, 32, 32,
+29, 29, 29, 30, 30, 30, 31, 31, 28, 28, 28, 29, 29, 29, 30, 30,
+27, 27, 27, 28, 28, 29, 29, 30, 26, 26, 26, 27, 27, 28, 28, 29,
+25, 25, 26, 26, 26, 27, 27, 28, 24, 24, 25, 25, 25, 26, 26, 27,
+23, 23, 24, 24, 25, 25, 26, 26, 22, 22, 23, 23, 24, 24, 25, 25,
+21, 21, 22, 22, 23, 23, 24, 25, 20, 21, 21, 21, 22, 23, 23, 24,
+19, 20, 20, 21, 21, 22, 22, 23, 18, 19, 19, 20, 20, 21, 22, 22,
+17, 18, 18, 19, 20, 20, 21, 21, 17, 17, 18, 18, 19, 19, 20, 21,
+16, 16, 17, 17, 18, 19, 19, 20, 15, 15, 16, 17, 17, 18, 19, 19,
+14, 15, 15, 16, 16, 17, 18, 19, 13, 14, 14, 15, 16, 17, 17, 18,
+12, 13, 14, 14, 15, 16, 17, 18, 12, 12, 13, 14, 15, 15, 16, 17,
+11, 12, 12, 13, 14, 15, 16, 17, 10, 11, 12, 13, 13, 14, 15, 16,
+10, 10, 11, 12, 13, 14, 15, 16, 9, 10, 11, 12, 13, 13, 14, 15,
+8, 9, 10, 11, 12, 13, 14, 15, 8, 9, 10, 11, 12, 13, 14, 15,
+8, 9, 10, 11, 12, 13, 14, 15, 8, 9, 10, 11, 12, 13, 14, 15,
+8, 9, 10, 11, 12, 13, 14, 15, 8, 9, 10, 11, 12, 13, 14, 15,
+8, 9, 10, 11, 12, 13, 14, 15, 8, 9, 10, 11, 12, 13, 14, 15,
+8, 9, 10, 11, 12, 13, 14, 15, 9, 10, 11, 12, 13, 13, 14, 15,
+10, 10, 11, 12, 13, 14, 15, 16, 10, 11, 12, 13, 13, 14, 15, 16,
+11, 12, 12, 13, 14, 15, 16, 17, 12, 12, 13, 14, 15, 15, 16, 17,
+12, 13, 14, 14, 15, 16, 17, 18, 13, 14, 14, 15, 16, 17, 17, 18,
+14, 15, 15, 16, 16, 17, 18, 19, 15, 15, 16, 17, 17, 18, 19, 19,
+16, 16, 17, 17, 18, 19, 19, 20, 17, 17, 18, 18, 19, 19, 20, 21,
+17, 18, 18, 19, 20, 20, 21, 21, 18, 19, 19, 20, 20, 21, 22, 22,
+19, 20, 20, 21, 21, 22, 22, 23, 20, 21, 21, 21, 22, 23, 23, 24,
+21, 21, 22, 22, 23, 23, 24, 25, 22, 22, 23, 23, 24, 24, 25, 25,
+23, 23, 24, 24, 25, 25, 26, 26, 24, 24, 25, 25, 25, 26, 26, 27,
+25, 25, 26, 26, 26, 27, 27, 28, 26, 26, 26, 27, 27, 28, 28, 29,
+27, 27, 27, 28, 28, 29, 29, 30, 28, 28, 28, 29, 29, 29, 30, 30,
+29, 29, 29, 30, 30, 30, 31, 31, 30, 30, 30, 31, 31, 31, 32, 32,
+31, 31, 31, 31, 32, 32, 33, 33, 32, 32, 32, 32, 33, 33, 34, 34,
+32, 33, 33, 33, 34, 34, 34, 35, 33, 34, 34, 34, 35, 35, 35, 36,
+34, 35, 35, 35, 36, 36, 36, 37, 35, 36, 36, 36, 37, 37, 37, 38,
+36, 37, 37, 37, 37, 38, 38, 39, 37, 38, 38, 38, 38, 39, 39, 39,
+38, 39, 39, 39, 39, 40, 40, 40, 39, 40, 40, 40, 40, 41, 41, 41,
+40, 41, 41, 41, 41, 42, 42, 42, 41, 41, 42, 42, 42, 43, 43, 43,
+42, 42, 43, 43, 43, 43, 44, 44, 43, 43, 44, 44, 44, 44, 45, 45,
+44, 44, 45, 45, 45, 45, 46, 46, 45, 45, 46, 46, 46, 46, 47, 47,
+46, 46, 47, 47, 47, 47, 48, 48, 47, 47, 48, 48, 48, 48, 49, 49,
+48, 48, 49, 49, 49, 49, 50, 50, 49, 49, 50, 50, 50, 50, 50, 51,
+50, 50, 50, 51, 51, 51, 51, 52, 51, 51, 51, 52, 52, 52, 52, 53,
+52, 52, 52, 53, 53, 53, 53, 54, 53, 53, 53, 54, 54, 54, 54, 55,
+54, 54, 54, 55, 55, 55, 55, 56, 55, 55, 55, 56, 56, 56, 56, 57,
+56, 56, 56, 57, 57, 57, 57, 57, 57, 57, 57, 58, 58, 58, 58, 58,
+58, 58, 58, 59, 59, 59, 59, 59, 59, 59, 59, 60, 60, 60, 60, 60,
+60, 60, 60, 61, 61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62,
+62, 62, 62, 62, 63, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64,
+65, 66, 66, 66, 67, 67, 67, 68, 65, 65, 65, 65, 66, 66, 66, 67,
+64, 64, 64, 64, 65, 65, 65, 66, 63, 63, 63, 63, 64, 64, 64, 65,
+62, 62, 62, 62, 63, 63, 63, 64, 61, 61, 61, 61, 62, 62, 62, 63,
+60, 60, 60, 61, 61, 61, 62, 62, 59, 59, 59, 60, 60, 60, 61, 61,
+58, 58, 58, 59, 59, 59, 60, 60, 57, 57, 57, 58, 58, 58, 59, 59,
+56, 56, 56, 57, 57, 57, 58, 58, 55, 55, 55, 56, 56, 57, 57, 57,
+54, 54, 55, 55, 55, 56, 56, 56, 53, 53, 54, 54, 54, 55, 55, 55,
+52, 52, 53, 53, 53, 54, 54, 55, 51, 51, 52, 52, 52, 53, 53, 54,
+50, 50, 51, 51, 52, 52, 52, 53, 49, 49, 50, 50, 51, 51, 51, 52,
+48, 49, 49, 49, 50, 50, 50, 51, 47, 48, 48, 48, 49, 49, 50, 50,
+46, 47, 47, 47, 48, 48, 49, 49, 45, 46, 46, 47, 47, 47, 48, 48,
+44, 45, 45, 46, 46, 46, 47, 47, 44, 44, 44, 45, 45, 46, 46, 47,
+43, 43, 43, 44, 44, 45, 45, 46, 42, 42, 42, 43, 43, 44, 44, 45,
+41, 41, 42, 42, 42, 43, 43, 44, 40, 40, 41, 41, 42, 42, 43, 43,
+39, 39, 40, 40, 41, 41, 42, 42, 38, 38, 39, 39, 40, 40, 41, 41,
+37, 38, 38, 38, 39, 39, 40, 41, 36, 37, 37, 38, 38, 39, 39, 40,
+35, 36, 36, 37, 37, 38, 38, 39, 34, 35, 35, 36, 36, 37, 38, 38,
+34, 34, 34, 35, 36, 36, 37, 37, 33, 33, 34, 34, 35, 35, 36, 37,
+32, 32, 33, 33, 34, 35, 35, 36, 31, 31, 32, 33, 33, 34, 34, 35,
+30, 31, 31, 32, 32, 33, 34, 34, 29, 30, 30, 31, 32, 32, 33, 33,
+28, 29, 30, 30, 31, 31, 32, 33, 28, 28, 29, 29, 30, 31, 31, 32,
+27, 27, 28, 29, 29, 30, 31, 31, 26, 27, 27, 28, 29, 29, 30, 31,
+25, 26, 26, 27, 28, 29, 29, 30, 24, 25, 26, 26, 27, 28, 29, 29,
+24, 24, 25, 26, 26, 27, 28, 29, 23, 24, 24, 25, 26, 27, 27, 28,
+22, 23, 24, 24, 25, 26, 27, 28, 21, 22, 23, 24, 25, 25, 26, 27,
+21, 22, 22, 23, 24, 25, 26, 26, 20, 21, 22, 23, 23, 24, 25, 26,
+20, 20, 21, 22, 23, 24, 25, 25, 19, 20, 21, 21, 22, 23, 24, 25,
+18, 19, 20, 21, 22, 23, 24, 25, 18, 19, 20, 21, 21, 22, 23, 24,
+17, 18, 19, 20, 21, 22, 23, 24, 17, 18, 19, 20, 21, 22, 23, 24,
+17, 18, 18, 19, 20, 21, 22, 23, 16, 17, 18, 19, 20, 21, 22, 23,
+16, 17, 18, 19, 20, 21, 22, 23, 16, 17, 18, 19, 20, 21, 22, 23,
+16, 17, 18, 19, 20, 21, 22, 23, 16, 17, 18, 19, 20, 21, 22, 23,
+16, 17, 18, 19, 20, 21, 22, 23, 16, 17, 18, 19, 20, 21, 22, 23,
+16, 17, 18, 19, 20, 21, 22, 23, 16, 17, 18, 19, 20, 21, 22, 23,
+16, 17, 18, 19, 20, 21, 22, 23, 16, 17, 18, 19, 20, 21, 22, 23,
+17, 18, 18, 19, 20, 21, 22, 23, 17, 18, 19, 20, 21, 22, 23, 24,
+17, 18, 19, 20, 21, 22, 23, 24, 18, 19, 20, 21, 21, 22, 23, 24,
+18, 19, 20, 21, 22, 23, 24, 25, 19, 20, 21, 21, 22, 23, 24, 25,
+20, 20, 21, 22, 23, 24, 25, 25, 20, 21, 22, 23, 23, 24, 25, 26,
+21, 22, 22, 23, 24, 25, 26, 26, 21, 22, 23, 24, 25, 25, 26, 27,
+22, 23, 24, 24, 25, 26, 27, 28, 23, 24, 24, 25, 26, 27, 27, 28,
+24, 24, 25, 26, 26, 27, 28, 29, 24, 25, 26, 26, 27, 28, 29, 29,
+25, 26, 26, 27, 28, 29, 29, 30, 26, 27, 27, 28, 29, 29, 30, 31,
+27, 27, 28, 29, 29, 30, 31, 31, 28, 28, 29, 29, 30, 31, 31, 32,
+28, 29, 30, 30, 31, 31, 32, 33, 29, 30, 30, 31, 32, 32, 33, 33,
+30, 31, 31, 32, 32, 33, 34, 34, 31, 31, 32, 33, 33, 34, 34, 35,
+32, 32, 33, 33, 34, 35, 35, 36, 33, 33, 34, 34, 35, 35, 36, 37,
+34, 34, 34, 35, 36, 36, 37, 37, 34, 35, 35, 36, 36, 37, 38, 38,
+35, 36, 36, 37, 37, 38, 38, 39, 36, 37, 37, 38, 38, 39, 39, 40,
+37, 38, 38, 38, 39, 39, 40, 41, 38, 38, 39, 39, 40, 40, 41, 41,
+39, 39, 40, 40, 41, 41, 42, 42, 40, 40, 41, 41, 42, 42, 43, 43,
+41, 41, 42, 42, 42, 43, 43, 44, 42, 42, 42, 43, 43, 44, 44, 45,
+43, 43, 43, 44, 44, 45, 45, 46, 44, 44, 44, 45, 45, 46, 46, 47,
+44, 45, 45, 46, 46, 46, 47, 47, 45, 46, 46, 47, 47, 47, 48, 48,
+46, 47, 47, 47, 48, 48, 49, 49, 47, 48, 48, 48, 49, 49, 50, 50,
+48, 49, 49, 49, 50, 50, 50, 51, 49, 49, 50, 50, 51, 51, 51, 52,
+50, 50, 51, 51, 52, 52, 52, 53, 51, 51, 52, 52, 52, 53, 53, 54,
+52, 52, 53, 53, 53, 54, 54, 55, 53, 53, 54, 54, 54, 55, 55, 55,
+54, 54, 55, 55, 55, 56, 56, 56, 55, 55, 55, 56, 56, 57, 57, 57,
+56, 56, 56, 57, 57, 57, 58, 58, 57, 57, 57, 58, 58, 58, 59, 59,
+58, 58, 58, 59, 59, 59, 60, 60, 59, 59, 59, 60, 60, 60, 61, 61,
+60, 60, 60, 61, 61, 61, 62, 62, 61, 61, 61, 61, 62, 62, 62, 63,
+62, 62, 62, 62, 63, 63, 63, 64, 63, 63, 63, 63, 64, 64, 64, 65,
+64, 64, 64, 64, 65, 65, 65, 66, 65, 65, 65, 65, 66, 66, 66, 67,
+68, 68, 69, 69, 69, 70, 70, 71, 67, 67, 68, 68, 68, 69, 69, 70,
+66, 66, 67, 67, 68, 68, 68, 69, 65, 65, 66, 66, 67, 67, 67, 68,
+64, 65, 65, 65, 66, 66, 67, 67, 63, 64, 64, 64, 65, 65, 66, 66,
+62, 63, 63, 63, 64, 64, 65, 65, 61, 62, 62, 63, 63, 63, 64, 64,
+60, 61, 61, 62, 62, 63, 63, 64, 60, 60, 60, 61, 61, 62, 62, 63,
+59, 59, 59, 60, 60, 61, 61, 62, 58, 58, 59, 59, 59, 60, 60, 61,
+57, 57, 58, 58, 59, 59, 60, 60, 56, 56, 57, 57, 58, 58, 59, 59,
+55, 55, 56, 56, 57, 57, 58, 58, 54, 55, 55, 55, 56, 56, 57, 57,
+53, 54, 54, 55, 55, 56, 56, 57, 52, 53, 53, 54, 54, 55, 55, 56,
+51, 52, 52, 53, 53, 54, 54, 55, 51, 51, 51, 52, 53, 53, 54, 54,
+50, 50, 51, 51, 52, 52, 53, 53, 49, 49, 50, 50, 51, 51, 52, 53,
+48, 48, 49, 49, 50, 51, 51, 52, 47, 48, 48, 49, 49, 50, 50, 51,
+46, 47, 47, 48, 48, 49, 50, 50, 45, 46, 46, 47, 48, 48, 49, 49,
+44, 45, 46, 46, 47, 47, 48, 49, 44, 44, 45, 45, 46, 47, 47, 48,
+43, 43, 44, 45, 45, 46, 46, 47, 42, 43, 43, 44, 44, 45, 46, 46,
+41, 42, 42, 43, 44, 44, 45, 46, 40, 41, 42, 42, 43, 43, 44, 45,
+40, 40, 41, 41, 42, 43, 43, 44, 39, 39, 40, 41, 41, 42, 43, 43,
+38, 39, 39, 40, 41, 41, 42, 43, 37, 38, 38, 39, 40, 41, 41, 42,
+36, 37, 38, 38, 39, 40, 41, 41, 36, 36, 37, 38, 38, 39, 40, 41,
+35, 36, 36, 37, 38, 38, 39, 40, 34, 35, 36, 36, 37, 38, 39, 39,
+33, 34, 35, 36, 36, 37, 38, 39, 33, 33, 34, 35, 36, 37, 37, 38,
+32, 33, 34, 34, 35, 36, 37, 38, 31, 32, 33, 34, 35, 35, 36, 37,
+31, 32, 32, 33, 34, 35, 36, 36, 30, 31, 32, 33, 33, 34, 35, 36,
+30, 30, 31, 32, 33, 34, 34, 35, 29, 30, 31, 31, 32, 33, 34, 35,
+28, 29, 30, 31, 32, 33, 34, 34, 28, 29, 30, 30, 31, 32, 33, 34,
+27, 28, 29, 30, 31, 32, 33, 34, 27, 28, 29, 29, 30, 31, 32, 33,
+26, 27, 28, 29, 30, 31, 32, 33, 26, 27, 28, 29, 30, 31, 31, 32,
+26, 26, 27, 28, 29, 30, 31, 32, 25, 26, 27, 28, 29, 30, 31, 32,
+25, 26, 27, 28, 29, 30, 31, 32, 25, 25, 26, 27, 28, 29, 30, 31,
+24, 25, 26, 27, 28, 29, 30, 31, 24, 25, 26, 27, 28, 29, 30, 31,
+24, 25, 26, 27, 28, 29, 30, 31, 24, 25, 26, 27, 28, 29, 30, 31,
+24, 25, 26, 27, 28, 29, 30, 31, 24, 25, 26, 27, 28, 29, 30, 31,
+24, 25, 26, 27, 28, 29, 30, 31, 24, 25, 26, 27, 28, 29, 30, 31,
+24, 25, 26, 27, 28, 29, 30, 31, 24, 25, 26, 27, 28, 29, 30, 31,
+24, 25, 26, 27, 28, 29, 30, 31, 24, 25, 26, 27, 28, 29, 30, 31,
+24, 25, 26, 27, 28, 29, 30, 31, 25, 25, 26, 27, 28, 29, 30, 31,
+25, 26, 27, 28, 29, 30, 31, 32, 25, 26, 27, 28, 29, 30, 31, 32,
+26, 26, 27, 28, 29, 30, 31, 32, 26, 27, 28, 29, 30, 31, 31, 32,
+26, 27, 28, 29, 30, 31, 32, 33, 27, 28, 29, 29, 30, 31, 32, 33,
+27, 28, 29, 30, 31, 32, 33, 34, 28, 29, 30, 30, 31, 32, 33, 34,
+28, 29, 30, 31, 32, 33, 34, 34, 29, 30, 31, 31, 32, 33, 34, 35,
+30, 30, 31, 32, 33, 34, 34, 35, 30, 31, 32, 33, 33, 34, 35, 36,
+31, 32, 32, 33, 34, 35, 36, 36, 31, 32, 33, 34, 35, 35, 36, 37,
+32, 33, 34, 34, 35, 36, 37, 38, 33, 33, 34, 35, 36, 37, 37, 38,
+33, 34, 35, 36, 36, 37, 38, 39, 34, 35, 36, 36, 37, 38, 39, 39,
+35, 36, 36, 37, 38, 38, 39, 40, 36, 36, 37, 38, 38, 39, 40, 41,
+36, 37, 38, 38, 39, 40, 41, 41, 37, 38, 38, 39, 40, 41, 41, 42,
+38, 39, 39, 40, 41, 41, 42, 43, 39, 39, 40, 41, 41, 42, 43, 43,
+40, 40, 41, 41, 42, 43, 43, 44, 40, 41, 42, 42, 43, 43, 44, 45,
+41, 42, 42, 43, 44, 44, 45, 46, 42, 43, 43, 44, 44, 45, 46, 46,
+43, 43, 44, 45, 45, 46, 46, 47, 44, 44, 45, 45, 46, 47, 47, 48,
+44, 45, 46, 46, 47, 47, 48, 49, 45, 46, 46, 47, 48, 48, 49, 49,
+46, 47, 47, 48, 48, 49, 50, 50, 47, 48, 48, 49, 49, 50, 50, 51,
+48, 48, 49, 49, 50, 51, 51, 52, 49, 49, 50, 50, 51, 51, 52, 53,
+50, 50, 51, 51, 52, 52, 53, 53, 51, 51, 51, 52, 53, 53, 54, 54,
+51, 52, 52, 53, 53, 54, 54, 55, 52, 53, 53, 54, 54, 55, 55, 56,
+53, 54, 54, 55, 55, 56, 56, 57, 54, 55, 55, 55, 56, 56, 57, 57,
+55, 55, 56, 56, 57, 57, 58, 58, 56, 56, 57, 57, 58, 58, 59, 59,
+57, 57, 58, 58, 59, 59, 60, 60, 58, 58, 59, 59, 59, 60, 60, 61,
+59, 59, 59, 60, 60, 61, 61, 62, 60, 60, 60, 61, 61, 62, 62, 63,
+60, 61, 61, 62, 62, 63, 63, 64, 61, 62, 62, 63, 63, 63, 64, 64,
+62, 63, 63, 63, 64, 64, 65, 65, 63, 64, 64, 64, 65, 65, 66, 66,
+64, 65, 65, 65, 66, 66, 67, 67, 65, 65, 66, 66, 67, 67, 67, 68,
+66, 66, 67, 67, 68, 68, 68, 69, 67, 67, 68, 68, 68, 69, 69, 70,
+};
+static const RevealMap revealSpiral = {revealSpiralRanks, 0, 72};
+
+// Distance from the center along the axes
+alignas(4) static const uint8_t revealDiamondRanks[] = {
+95, 94, 93, 92, 91, 90, 89, 88, 94, 93, 92, 91, 90, 89, 88, 87,
+93, 92, 91, 90, 89, 88, 87, 86, 92, 91, 90, 89, 88, 87, 86, 85,
+91, 90, 89, 88, 87, 86, 85, 84, 90, 89, 88, 87, 86, 85, 84, 83,
+89, 88, 87, 86, 85, 84, 83, 82, 88, 87, 86, 85, 84, 83, 82, 81,
+87, 86, 85, 84, 83, 82, 81, 80, 86, 85, 84, 83, 82, 81, 80, 79,
+85, 84, 83, 82, 81, 80, 79, 78, 84, 83, 82, 81, 80, 79, 78, 77,
+83, 82, 81, 80, 79, 78, 77, 76, 82, 81, 80, 79, 78, 77, 76, 75,
+81, 80, 79, 78, 77, 76, 75, 74, 80, 79, 78, 77, 76, 75, 74, 73,
+79, 78, 77, 76, 75, 74, 73, 72, 78, 77, 76, 75, 74, 73, 72, 71,
+77, 76, 75, 74, 73, 72, 71, 70, 76, 75, 74, 73, 72, 71, 70, 69,
+75, 74, 73, 72, 71, 70, 69, 68, 74, 73, 72, 71, 70, 69, 68, 67,
+73, 72, 71, 70, 69, 68, 67, 66, 72, 71, 70, 69, 68, 67, 66, 65,
+71, 70, 69, 68, 67, 66, 65, 64, 70, 69, 68, 67, 66, 65, 64, 63,
+69, 68, 67, 66, 65, 64, 63, 62, 68, 67, 66, 65, 64, 63, 62, 61,
+67, 66, 65, 64, 63, 62, 61, 60, 66, 65, 64, 63, 62, 61, 60, 59,
+65, 64, 63, 62, 61, 60, 59, 58, 64, 63, 62, 61, 60, 59, 58, 57,
+63, 62, 61, 60, 59, 58, 57, 56, 62, 61, 60, 59, 58, 57, 56, 55,
+61, 60, 59, 58, 57, 56, 55, 54, 60, 59, 58, 57, 56, 55, 54, 53,
+59, 58, 57, 56, 55, 54, 53, 52, 58, 57, 56, 55, 54, 53, 52, 51,
+57, 56, 55, 54, 53, 52, 51, 50, 56, 55, 54, 53, 52, 51, 50, 49,
+55, 54, 53, 52, 51, 50, 49, 48, 54, 53, 52, 51, 50, 49, 48, 47,
+53, 52, 51, 50, 49, 48, 47, 46, 52, 51, 50, 49, 48, 47, 46, 45,
+51, 50, 49, 48, 47, 46, 45, 44, 50, 49, 48, 47, 46, 45, 44, 43,
+49, 48, 47, 46, 45, 44, 43, 42, 48, 47, 46, 45, 44, 43, 42, 41,
+47, 46, 45, 44, 43, 42, 41, 40, 46, 45, 44, 43, 42, 41, 40, 39,
+45, 44, 43, 42, 41, 40, 39, 38, 44, 43, 42, 41, 40, 39, 38, 37,
+43, 42, 41, 40, 39, 38, 37, 36, 42, 41, 40, 39, 38, 37, 36, 35,
+41, 40, 39, 38, 37, 36, 35, 34, 40, 39, 38, 37, 36, 35, 34, 33,
+39, 38, 37, 36, 35, 34, 33, 32, 38, 37, 36, 35, 34, 33, 32, 31,
+37, 36, 35, 34, 33, 32, 31, 30, 36, 35, 34, 33, 32, 31, 30, 29,
+35, 34, 33, 32, 31, 30, 29, 28, 34, 33, 32, 31, 30, 29, 28, 27,
+33, 32, 31, 30, 29, 28, 27, 26, 32, 31, 30, 29, 28, 27, 26, 25,
+32, 31, 30, 29, 28, 27, 26, 25, 33, 32, 31, 30, 29, 28, 27, 26,
+34, 33, 32, 31, 30, 29, 28, 27, 35, 34, 33, 32, 31, 30, 29, 28,
+36, 35, 34, 33, 32, 31, 30, 29, 37, 36, 35, 34, 33, 32, 31, 30,
+38, 37, 36, 35, 34, 33, 32, 31, 39, 38, 37, 36, 35, 34, 33, 32,
+40, 39, 38, 37, 36, 35, 34, 33, 41, 40, 39, 38, 37, 36, 35, 34,
+42, 41, 40, 39, 38, 37, 36, 35, 43, 42, 41, 40, 39, 38, 37, 36,
+44, 43, 42, 41, 40, 39, 38, 37, 45, 44, 43, 42, 41, 40, 39, 38,
+46, 45, 44, 43, 42, 41, 40, 39, 47, 46, 45, 44, 43, 42, 41, 40,
+48, 47, 46, 45, 44, 43, 42, 41, 49, 48, 47, 46, 45, 44, 43, 42,
+50, 49, 48, 47, 46, 45, 44, 43, 51, 50, 49, 48, 47, 46, 45, 44,
+52, 51, 50, 49, 48, 47, 46, 45, 53, 52, 51, 50, 49, 48, 47, 46,
+54, 53, 52, 51, 50, 49, 48, 47, 55, 54, 53, 52, 51, 50, 49, 48,
+56, 55, 54, 53, 52, 51, 50, 49, 57, 56, 55, 54, 53, 52, 51, 50,
+58, 57, 56, 55, 54, 53, 52, 51, 59, 58, 57, 56, 55, 54, 53, 52,
+60, 59, 58, 57, 56, 55, 54, 53, 61, 60, 59, 58, 57, 56, 55, 54,
+62, 61, 60, 59, 58, 57, 56, 55, 63, 62, 61, 60, 59, 58, 57, 56,
+64, 63, 62, 61, 60, 59, 58, 57, 65, 64, 63, 62, 61, 60, 59, 58,
+66, 65, 64, 63, 62, 61, 60, 59, 67, 66, 65, 64, 63, 62, 61, 60,
+68, 67, 66, 65, 64, 63, 62, 61, 69, 68, 67, 66, 65, 64, 63, 62,
+70, 69, 68, 67, 66, 65, 64, 63, 71, 70, 69, 68, 67, 66, 65, 64,
+72, 71, 70, 69, 68, 67, 66, 65, 73, 72, 71, 70, 69, 68, 67, 66,
+74, 73, 72, 71, 70, 69, 68, 67, 75, 74, 73, 72, 71, 70, 69, 68,
+76, 75, 74, 73, 72, 71, 70, 69, 77, 76, 75, 74, 73, 72, 71, 70,
+78, 77, 76, 75, 74, 73, 72, 71, 79, 78, 77, 76, 75, 74, 73, 72,
+80, 79, 78, 77, 76, 75, 74, 73, 81, 80, 79, 78, 77, 76, 75, 74,
+82, 81, 80, 79, 78, 77, 76, 75, 83, 82, 81, 80, 79, 78, 77, 76,
+84, 83, 82, 81, 80, 79, 78, 77, 85, 84, 83, 82, 81, 80, 79, 78,
+86, 85, 84, 83, 82, 81, 80, 79, 87, 86, 85, 84, 83, 82, 81, 80,
+88, 87, 86, 85, 84, 83, 82, 81, 89, 88, 87, 86, 85, 84, 83, 82,
+90, 89, 88, 87, 86, 85, 84, 83, 91, 90, 89, 88, 87, 86, 85, 84,
+92, 91, 90, 89, 88, 87, 86, 85, 93, 92, 91, 90, 89, 88, 87, 86,
+94, 93, 92, 91, 90, 89, 88, 87, 95, 94, 93, 92, 91, 90, 89, 88,
+87, 86, 85, 84, 83, 82, 81, 80, 86, 85, 84, 83, 82, 81, 80, 79,
+85, 84, 83, 82, 81, 80, 79, 78, 84, 83, 82, 81, 80, 79, 78, 77,
+83, 82, 81, 80, 79, 78, 77, 76, 82, 81, 80, 79, 78, 77, 76, 75,
+81, 80, 79, 78, 77, 76, 75, 74, 80, 79, 78, 77, 76, 75, 74, 73,
+79, 78, 77, 76, 75, 74, 73, 72, 78, 77, 76, 75, 74, 73, 72, 71,
+77, 76, 75, 74, 73, 72, 71, 70, 76, 75, 74, 73, 72, 71, 70, 69,
+75, 74, 73, 72, 71, 70, 69, 68, 74, 73, 72, 71, 70, 69, 68, 67,
+73, 72, 71, 70, 69, 68, 67, 66, 72, 71, 70, 69, 68, 67, 66, 65,
+71, 70, 69, 68, 67, 66, 65, 64, 70, 69, 68, 67, 66, 65, 64, 63,
+69, 68, 67, 66, 65, 64, 63, 62, 68, 67, 66, 65, 64, 63, 62, 61,
+67, 66, 65, 64, 63, 62, 61, 60, 66, 65, 64, 63, 62, 61, 60, 59,
+65, 64, 63, 62, 61, 60, 59, 58, 64, 63, 62, 61, 60, 59, 58, 57,
+63, 62, 61, 60, 59, 58, 57, 56, 62, 61, 60, 59, 58, 57, 56, 55,
+61, 60, 59, 58, 57, 56, 55, 54, 60, 59, 58, 57, 56, 55, 54, 53,
+59, 58, 57, 56, 55, 54, 53, 52, 58, 57, 56, 55, 54, 53, 52, 51,
+57, 56, 55, 54, 53, 52, 51, 50, 56, 55, 54, 53, 52, 51, 50, 49,
+55, 54, 53, 52, 51, 50, 49, 48, 54, 53, 52, 51, 50, 49, 48, 47,
+53, 52, 51, 50, 49, 48, 47, 46, 52, 51, 50, 49, 48, 47, 46, 45,
+51, 50, 49, 48, 47, 46, 45, 44, 50, 49, 48, 47, 46, 45, 44, 43,
+49, 48, 47, 46, 45, 44, 43, 42, 48, 47, 46, 45, 44, 43, 42, 41,
+47, 46, 45, 44, 43, 42, 41, 40, 46, 45, 44, 43, 42, 41, 40, 39,
+45, 44, 43, 42, 41, 40, 39, 38, 44, 43, 42, 41, 40, 39, 38, 37,
+43, 42, 41, 40, 39, 38, 37, 36, 42, 41, 40, 39, 38, 37, 36, 35,
+41, 40, 39, 38, 37, 36, 35, 34, 40, 39, 38, 37, 36, 35, 34, 33,
+39, 38, 37, 36, 35, 34, 33, 32, 38, 37, 36, 35, 34, 33, 32, 31,
+37, 36, 35, 34, 33, 32, 31, 30, 36, 35, 34, 33, 32, 31, 30, 29,
+35, 34, 33, 32, 31, 30, 29, 28, 34, 33, 32, 31, 30, 29, 28, 27,
+33, 32, 31, 30, 29, 28, 27, 26, 32, 31, 30, 29, 28, 27, 26, 25,
+31, 30, 29, 28, 27, 26, 25, 24, 30, 29, 28, 27, 26, 25, 24, 23,
+29, 28, 27, 26, 25, 24, 23, 22, 28, 27, 26, 25, 24, 23, 22, 21,
+27, 26, 25, 24, 23, 22, 21, 20, 26, 25, 24, 23, 22, 21, 20, 19,
+25, 24, 23, 22, 21, 20, 19, 18, 24, 23, 22, 21, 20, 19, 18, 17,
+24, 23, 22, 21, 20, 19, 18, 17, 25, 24, 23, 22, 21, 20, 19, 18,
+26, 25, 24, 23, 22, 21, 20, 19, 27, 26, 25, 24, 23, 22, 21, 20,
+28, 27, 26, 25, 24, 23, 22, 21, 29, 28, 27, 26, 25, 24, 23, 22,
+30, 29, 28, 27, 26, 25, 24, 23, 31, 30, 29, 28, 27, 26, 25, 24,
+32, 31, 30, 29, 28, 27, 26, 25, 33, 32, 31, 30, 29, 28, 27, 26,
+34, 33, 32, 31, 30, 29, 28, 27, 35, 34, 33, 32, 31, 30, 29, 28,
+36, 35, 34, 33, 32, 31, 30, 29, 37, 36, 35, 34, 33, 32, 31, 30,
+38, 37, 36, 35, 34, 33, 32, 31, 39, 38, 37, 36, 35, 34, 33, 32,
+40, 39, 38, 37, 36, 35, 34, 33, 41, 40, 39, 38, 37, 36, 35, 34,
+42, 41, 40, 39, 38, 37, 36, 35, 43, 42, 41, 40, 39, 38, 37, 36,
+44, 43, 42, 41, 40, 39, 38, 37, 45, 44, 43, 42, 41, 40, 39, 38,
+46, 45, 44, 43, 42, 41, 40, 39, 47, 46, 45, 44, 43, 42, 41, 40,
+48, 47, 46, 45, 44, 43, 42, 41, 49, 48, 47, 46, 45, 44, 43, 42,
+50, 49, 48, 47, 46, 45, 44, 43, 51, 50, 49, 48, 47, 46, 45, 44,
+52, 51, 50, 49, 48, 47, 46, 45, 53, 52, 51, 50, 49, 48, 47, 46,
+54, 53, 52, 51, 50, 49, 48, 47, 55, 54, 53, 52, 51, 50, 49, 48,
+56, 55, 54, 53, 52, 51, 50, 49, 57, 56, 55, 54, 53, 52, 51, 50,
+58, 57, 56, 55, 54, 53, 52, 51, 59, 58, 57, 56, 55, 54, 53, 52,
+60, 59, 58, 57, 56, 55, 54, 53, 61, 60, 59, 58, 57, 56, 55, 54,
+62, 61, 60, 59, 58, 57, 56, 55, 63, 62, 61, 60, 59, 58, 57, 56,
+64, 63, 62, 61, 60, 59, 58, 57, 65, 64, 63, 62, 61, 60, 59, 58,
+66, 65, 64, 63, 62, 61, 60, 59, 67, 66, 65, 64, 63, 62, 61, 60,
+68, 67, 66, 65, 64, 63, 62, 61, 69, 68, 67, 66, 65, 64, 63, 62,
+70, 69, 68, 67, 66, 65, 64, 63, 71, 70, 69, 68, 67, 66, 65, 64,
+72, 71, 70, 69, 68, 67, 66, 65, 73, 72, 71, 70, 69, 68, 67, 66,
+74, 73, 72, 71, 70, 69, 68, 67, 75, 74, 73, 72, 71, 70, 69, 68,
+76, 75, 74, 73, 72, 71, 70, 69, 77, 76, 75, 74, 73, 72, 71, 70,
+78, 77, 76, 75, 74, 73, 72, 71, 79, 78, 77, 76, 75, 74, 73, 72,
+80, 79, 78, 77, 76, 75, 74, 73, 81, 80, 79, 78, 77, 76, 75, 74,
+82, 81, 80, 79, 78, 77, 76, 75, 83, 82, 81, 80, 79, 78, 77, 76,
+84, 83, 82, 81, 80, 79, 78, 77, 85, 84, 83, 82, 81, 80, 79, 78,
+86, 85, 84, 83, 82, 81, 80, 79, 87, 86, 85, 84, 83, 82, 81, 80,
+79, 78, 77, 76, 75, 74, 73, 72, 78, 77, 76, 75, 74, 73, 72, 71,
+77, 76, 75, 74, 73, 72, 71, 70, 76, 75, 74, 73, 72, 71, 70, 69,
+75, 74, 73, 72, 71, 70, 69, 68, 74, 73, 72, 71, 70, 69, 68, 67,
+73, 72, 71, 70, 69, 68, 67, 66, 72, 71, 70, 69, 68, 67, 66, 65,
+71, 70, 69, 68, 67, 66, 65, 64, 70, 69, 68, 67, 66, 65, 64, 63,
+69, 68, 67, 66, 65, 64, 63, 62, 68, 67, 66, 65, 64, 63, 62, 61,
+67, 66, 65, 64, 63, 62, 61, 60, 66, 65, 64, 63, 62, 61, 60, 59,
+65, 64, 63, 62, 61, 60, 59, 58, 64, 63, 62, 61, 60, 59, 58, 57,
+63, 62, 61, 60, 59, 58, 57, 56, 62, 61, 60, 59, 58, 57, 56, 55,
+61, 60, 59, 58, 57, 56, 55, 54, 60, 59, 58, 57, 56, 55, 54, 53,
+59, 58, 57, 56, 55, 54, 53, 52, 58, 57, 56, 55, 54, 53, 52, 51,
+57, 56, 55, 54, 53, 52, 51, 50, 56, 55, 54, 53, 52, 51, 50, 49,
+55, 54, 53, 52, 51, 50, 49, 48, 54, 53, 52, 51, 50, 49, 48, 47,
+53, 52, 51, 50, 49, 48, 47, 46, 52, 51, 50, 49, 48, 47, 46, 45,
+51, 50, 49, 48, 47, 46, 45, 44, 50, 49, 48, 47, 46, 45, 44, 43,
+49, 48, 47, 46, 45, 44, 43, 42, 48, 47, 46, 45, 44, 43, 42, 41,
+47, 46, 45, 44, 43, 42, 41, 40, 46, 45, 44, 43, 42, 41, 40, 39,
+45, 44, 43, 42, 41, 40, 39, 38, 44, 43, 42, 41, 40, 39, 38, 37,
+43, 42, 41, 40, 39, 38, 37, 36, 42, 41, 40, 39, 38, 37, 36, 35,
+41, 40, 39, 38, 37, 36, 35, 34, 40, 39, 38, 37, 36, 35, 34, 33,
+39, 38, 37, 36, 35, 34, 33, 32, 38, 37, 36, 35, 34, 33, 32, 31,
+37, 36, 35, 34, 33, 32, 31, 30, 36, 35, 34, 33, 32, 31, 30, 29,
+35, 34, 33, 32, 31, 30, 29, 28, 34, 33, 32, 31, 30, 29, 28, 27,
+33, 32, 31, 30, 29, 28, 27, 26, 32, 31, 30, 29, 28, 27, 26, 25,
+31, 30, 29, 28, 27, 26, 25, 24, 30, 29, 28, 27, 26, 25, 24, 23,
+29, 28, 27, 26, 25, 24, 23, 22, 28, 27, 26, 25, 24, 23, 22, 21,
+27, 26, 25, 24, 23, 22, 21, 20, 26, 25, 24, 23, 22, 21, 20, 19,
+25, 24, 23, 22, 21, 20, 19, 18, 24, 23, 22, 21, 20, 19, 18, 17,
+23, 22, 21, 20, 19, 18, 17, 16, 22, 21, 20, 19, 18, 17, 16, 15,
+21, 20, 19, 18, 17, 16, 15, 14, 20, 19, 18, 17, 16, 15, 14, 13,
+19, 18, 17, 16, 15, 14, 13, 12, 18, 17, 16, 15, 14, 13, 12, 11,
+17, 16, 15, 14, 13, 12, 11, 10, 16, 15, 14, 13, 12, 11, 10, 9,
+16, 15, 14, 13, 12, 11, 10, 9, 17, 16, 15, 14, 13, 12, 11, 10,
+18, 17, 16, 15, 14, 13, 12, 11, 19, 18, 17, 16, 15, 14, 13, 12,
+20, 19, 18, 17, 16, 15, 14, 13, 21, 20, 19, 18, 17, 16, 15, 14,
+22, 21, 20, 19, 18, 17, 16, 15, 23, 22, 21, 20, 19, 18, 17, 16,
+24, 23, 22, 21, 20, 19, 18, 17, 25, 24, 23, 22, 21, 20, 19, 18,
+26, 25, 24, 23, 22, 21, 20, 19, 27, 26, 25, 24, 23, 22, 21, 20,
+28, 27, 26, 25, 24, 23, 22, 21, 29, 28, 27, 26, 25, 24, 23, 22,
+30, 29, 28, 27, 26, 25, 24, 23, 31, 30, 29, 28, 27, 26, 25, 24,
+32, 31, 30, 29, 28, 27, 26, 25, 33, 32, 31, 30, 29, 28, 27, 26,
+34, 33, 32, 31, 30, 29, 28, 27, 35, 34, 33, 32, 31, 30, 29, 28,
+36, 35, 34, 33, 32, 31, 30, 29, 37, 36, 35, 34, 33, 32, 31, 30,
+38, 37, 36, 35, 34, 33, 32, 31, 39, 38, 37, 36, 35, 34, 33, 32,
+40, 39, 38, 37, 36, 35, 34, 33, 41, 40, 39, 38, 37, 36, 35, 34,
+42, 41, 40, 39, 38, 37, 36, 35, 43, 42, 41, 40, 39, 38, 37, 36,
+44, 43, 42, 41, 40, 39, 38, 37, 45, 44, 43, 42, 41, 40, 39, 38,
+46, 45, 44, 43, 42, 41, 40, 39, 47, 46, 45, 44, 43, 42, 41, 40,
+48, 47, 46, 45, 44, 43, 42, 41, 49, 48, 47, 46, 45, 44, 43, 42,
+50, 49, 48, 47, 46, 45, 44, 43, 51, 50, 49, 48, 47, 46, 45, 44,
+52, 51, 50, 49, 48, 47, 46, 45, 53, 52, 51, 50, 49, 48, 47, 46,
+54, 53, 52, 51, 50, 49, 48, 47, 55, 54, 53, 52, 51, 50, 49, 48,
+56, 55, 54, 53, 52, 51, 50, 49, 57, 56, 55, 54, 53, 52, 51, 50,
+58, 57, 56, 55, 54, 53, 52, 51, 59, 58, 57, 56, 55, 54, 53, 52,
+60, 59, 58, 57, 56, 55, 54, 53, 61, 60, 59, 58, 57, 56, 55, 54,
+62, 61, 60, 59, 58, 57, 56, 55, 63, 62, 61, 60, 59, 58, 57, 56,
+64, 63, 62, 61, 60, 59, 58, 57, 65, 64, 63, 62, 61, 60, 59, 58,
+66, 65, 64, 63, 62, 61, 60, 59, 67, 66, 65, 64, 63, 62, 61, 60,
+68, 67, 66, 65, 64, 63, 62, 61, 69, 68, 67, 66, 65, 64, 63, 62,
+70, 69, 68, 67, 66, 65, 64, 63, 71, 70, 69, 68, 67, 66, 65, 64,
+72, 71, 70, 69, 68, 67, 66, 65, 73, 72, 71, 70, 69, 68, 67, 66,
+74, 73, 72, 71, 70, 69, 68, 67, 75, 74, 73, 72, 71, 70, 69, 68,
+76, 75, 74, 73, 72, 71, 70, 69, 77, 76, 75, 74, 73, 72, 71, 70,
+78, 77, 76, 75, 74, 73, 72, 71, 79, 78, 77, 76, 75, 74, 73, 72,
+71, 70, 69, 68, 67, 66, 65, 64, 70, 69, 68, 67, 66, 65, 64, 63,
+69, 68, 67, 66, 65, 64, 63, 62, 68, 67, 66, 65, 64, 63, 62, 61,
+67, 66, 65, 64, 63, 62, 61, 60, 66, 65, 64, 63, 62, 61, 60, 59,
+65, 64, 63, 62, 61, 60, 59, 58, 64, 63, 62, 61, 60, 59, 58, 57,
+63, 62, 61, 60, 59, 58, 57, 56, 62, 61, 60, 59, 58, 57, 56, 55,
+61, 60, 59, 58, 57, 56, 55, 54, 60, 59, 58, 57, 56, 55, 54, 53,
+59, 58, 57, 56, 55, 54, 53, 52, 58, 57, 56, 55, 54, 53, 52, 51,
+57, 56, 55, 54, 53, 52, 51, 50, 56, 55, 54, 53, 52, 51, 50, 49,
+55, 54, 53, 52, 51, 50, 49, 48, 54, 53, 52, 51, 50, 49, 48, 47,
+53, 52, 51, 50, 49, 48, 47, 46, 52, 51, 50, 49, 48, 47, 46, 45,
+51, 50, 49, 48, 47, 46, 45, 44, 50, 49, 48, 47, 46, 45, 44, 43,
+49, 48, 47, 46, 45, 44, 43, 42, 48, 47, 46, 45, 44, 43, 42, 41,
+47, 46, 45, 44, 43, 42, 41, 40, 46, 45, 44, 43, 42, 41, 40, 39,
+45, 44, 43, 42, 41, 40, 39, 38, 44, 43, 42, 41, 40, 39, 38, 37,
+43, 42, 41, 40, 39, 38, 37, 36, 42, 41, 40, 39, 38, 37, 36, 35,
+41, 40, 39, 38, 37, 36, 35, 34, 40, 39, 38, 37, 36, 35, 34, 33,
+39, 38, 37, 36, 35, 34, 33, 32, 38, 37, 36, 35, 34, 33, 32, 31,
+37, 36, 35, 34, 33, 32, 31, 30, 36, 35, 34, 33, 32, 31, 30, 29,
+35, 34, 33, 32, 31, 30, 29, 28, 34, 33, 32, 31, 30, 29, 28, 27,
+33, 32, 31, 30, 29, 28, 27, 26, 32, 31, 30, 29, 28, 27, 26, 25,
+31, 30, 29, 28, 27, 26, 25, 24, 30, 29, 28, 27, 26, 25, 24, 23,
+29, 28, 27, 26, 25, 24, 23, 22, 28, 27, 26, 25, 24, 23, 22, 21,
+27, 26, 25, 24, 23, 22, 21, 20, 26, 25, 24, 23, 22, 21, 20, 19,
+25, 24, 23, 22, 21, 20, 19, 18, 24, 23, 22, 21, 20, 19, 18, 17,
+23, 22, 21, 20, 19, 18, 17, 16, 22, 21, 20, 19, 18, 17, 16, 15,
+21, 20, 19, 18, 17, 16, 15, 14, 20, 19, 18, 17, 16, 15, 14, 13,
+19, 18, 17, 16, 15, 14, 13, 12, 18, 17, 16, 15, 14, 13, 12, 11,
+17, 16, 15, 14, 13, 12, 11, 10, 16, 15, 14, 13, 12, 11, 10, 9,
+15, 14, 13, 12, 11, 10, 9, 8, 14, 13, 12, 11, 10, 9, 8, 7,
+13, 12, 11, 10, 9, 8, 7, 6, 12, 11, 10, 9, 8, 7, 6, 5,
+11, 10, 9, 8, 7, 6, 5, 4, 10, 9, 8, 7, 6, 5, 4, 3,
+9, 8, 7, 6, 5, 4, 3, 2, 8, 7, 6, 5, 4, 3, 2, 1,
+8, 7, 6, 5, 4, 3, 2, 1, 9, 8, 7, 6, 5, 4, 3, 2,
+10, 9, 8, 7, 6, 5, 4, 3, 11, 10, 9, 8, 7, 6, 5, 4,
+12, 11, 10, 9, 8, 7, 6, 5, 13, 12, 11, 10, 9, 8, 7, 6,
+14, 13, 12, 11, 10, 9, 8, 7, 15, 14, 13, 12, 11, 10, 9, 8,
+16, 15, 14, 13, 12, 11, 10, 9, 17, 16, 15, 14, 13, 12, 11, 10,
+18, 17, 16, 15, 14, 13, 12, 11, 19, 18, 17, 16, 15, 14, 13, 12,
+20, 19, 18, 17, 16, 15, 14, 13, 21, 20, 19, 18, 17, 16, 15, 14,
+22, 21, 20, 19, 18, 17, 16, 15, 23, 22, 21, 20, 19, 18, 17, 16,
+24, 23, 22, 21, 20, 19, 18, 17, 25, 24, 23, 22, 21, 20, 19, 18,
+26, 25, 24, 23, 22, 21, 20, 19, 27, 26, 25, 24, 23, 22, 21, 20,
+28, 27, 26, 25, 24, 23, 22, 21, 29, 28, 27, 26, 25, 24, 23, 22,
+30, 29, 28, 27, 26, 25, 24, 23, 31, 30, 29, 28, 27, 26, 25, 24,
+32, 31, 30, 29, 28, 27, 26, 25, 33, 32, 31, 30, 29, 28, 27, 26,
+34, 33, 32, 31, 30, 29, 28, 27, 35, 34, 33, 32, 31, 30, 29, 28,
+36, 35, 34, 33, 32, 31, 30, 29, 37, 36, 35, 34, 33, 32, 31, 30,
+38, 37, 36, 35, 34, 33, 32, 31, 39, 38, 37, 36, 35, 34, 33, 32,
+40, 39, 38, 37, 36, 35, 34, 33, 41, 40, 39, 38, 37, 36, 35, 34,
+42, 41, 40, 39, 38, 37, 36, 35, 43, 42, 41, 40, 39, 38, 37, 36,
+44, 43, 42, 41, 40, 39, 38, 37, 45, 44, 43, 42, 41, 40, 39, 38,
+46, 45, 44, 43, 42, 41, 40, 39, 47, 46, 45, 44, 43, 42, 41, 40,
+48, 47, 46, 45, 44, 43, 42, 41, 49, 48, 47, 46, 45, 44, 43, 42,
+50, 49, 48, 47, 46, 45, 44, 43, 51, 50, 49, 48, 47, 46, 45, 44,
+52, 51, 50, 49, 48, 47, 46, 45, 53, 52, 51, 50, 49, 48, 47, 46,
+54, 53, 52, 51, 50, 49, 48, 47, 55, 54, 53, 52, 51, 50, 49, 48,
+56, 55, 54, 53, 52, 51, 50, 49, 57, 56, 55, 54, 53, 52, 51, 50,
+58, 57, 56, 55, 54, 53, 52, 51, 59, 58, 57, 56, 55, 54, 53, 52,
+60, 59, 58, 57, 56, 55, 54, 53, 61, 60, 59, 58, 57, 56, 55, 54,
+62, 61, 60, 59, 58, 57, 56, 55, 63, 62, 61, 60, 59, 58, 57, 56,
+64, 63, 62, 61, 60, 59, 58, 57, 65, 64, 63, 62, 61, 60, 59, 58,
+66, 65, 64, 63, 62, 61, 60, 59, 67, 66, 65, 64, 63, 62, 61, 60,
+68, 67, 66, 65, 64, 63, 62, 61, 69, 68, 67, 66, 65, 64, 63, 62,
+70, 69, 68, 67, 66, 65, 64, 63, 71, 70, 69, 68, 67, 66, 65, 64,
+64, 65, 66, 67, 68, 69, 70, 71, 63, 64, 65, 66, 67, 68, 69, 70,
+62, 63, 64, 65, 66, 67, 68, 69, 61, 62, 63, 64, 65, 66, 67, 68,
+60, 61, 62, 63, 64, 65, 66, 67, 59, 60, 61, 62, 63, 64, 65, 66,
+58, 59, 60, 61, 62, 63, 64, 65, 57, 58, 59, 60, 61, 62, 63, 64,
+56, 57, 58, 59, 60, 61, 62, 63, 55, 56, 57, 58, 59, 60, 61, 62,
+54, 55, 56, 57, 58, 59, 60, 61, 53, 54, 55, 56, 57, 58, 59, 60,
+52, 53, 54, 55, 56, 57, 58, 59, 51, 52, 53, 54, 55, 56, 57, 58,
+50, 51, 52, 53, 54, 55, 56, 57, 49, 50, 51, 52, 53, 54, 55, 56,
+48, 49, 50, 51, 52, 53, 54, 55, 47, 48, 49, 50, 51, 52, 53, 54,
+46, 47, 48, 49, 50, 51, 52, 53, 45, 46, 47, 48, 49, 50, 51, 52,
+44, 45, 46, 47, 48, 49, 50, 51, 43, 44, 45, 46, 47, 48, 49, 50,
+42, 43, 44, 45, 46, 47, 48, 49, 41, 42, 43, 44, 45, 46, 47, 48,
+40, 41, 42, 43, 44, 45, 46, 47, 39, 40, 41, 42, 43, 44, 45, 46,
+38, 39, 40, 41, 42, 43, 44, 45, 37, 38, 39, 40, 41, 42, 43, 44,
+36, 37, 38, 39, 40, 41, 42, 43, 35, 36, 37, 38, 39, 40, 41, 42,
+34, 35, 36, 37, 38, 39, 40, 41, 33, 34, 35, 36, 37, 38, 39, 40,
+32, 33, 34, 35, 36, 37, 38, 39, 31, 32, 33, 34, 35, 36, 37, 38,
+30, 31, 32, 33, 34, 35, 36, 37, 29, 30, 31, 32, 33, 34, 35, 36,
+28, 29, 30, 31, 32, 33, 34, 35, 27, 28, 29, 30, 31, 32, 33, 34,
+26, 27, 28, 29, 30, 31, 32, 33, 25, 26, 27, 28, 29, 30, 31, 32,
+24, 25, 26, 27, 28, 29, 30, 31, 23, 24, 25, 26, 27, 28, 29, 30,
+22, 23, 24, 25, 26, 27, 28, 29, 21, 22, 23, 24, 25, 26, 27, 28,
+20, 21, 22, 23, 24, 25, 26, 27, 19, 20, 21, 22, 23, 24, 25, 26,
+18, 19, 20, 21, 22, 23, 24, 25, 17, 18, 19, 20, 21, 22, 23, 24,
+16, 17, 18, 19, 20, 21, 22, 23, 15, 16, 17, 18, 19, 20, 21, 22,
+14, 15, 16, 17, 18, 19, 20, 21, 13, 14, 15, 16, 17, 18, 19, 20,
+12, 13, 14, 15, 16, 17, 18, 19, 11, 12, 13, 14, 15, 16, 17, 18,
+10, 11, 12, 13, 14, 15, 16, 17, 9, 10, 11, 12, 13, 14, 15, 16,
+8, 9, 10, 11, 12, 13, 14, 15, 7, 8, 9, 10, 11, 12, 13, 14,
+6, 7, 8, 9, 10, 11, 12, 13, 5, 6, 7, 8, 9, 10, 11, 12,
+4, 5, 6, 7, 8, 9, 10, 11, 3, 4, 5, 6, 7, 8, 9, 10,
+2, 3, 4, 5, 6, 7, 8, 9, 1, 2, 3, 4, 5, 6, 7, 8,
+1, 2, 3, 4, 5, 6, 7, 8, 2, 3, 4, 5, 6, 7, 8, 9,
+3, 4, 5, 6, 7, 8, 9, 10, 4, 5, 6, 7, 8, 9, 10, 11,
+5, 6, 7, 8, 9, 10, 11, 12, 6, 7, 8, 9, 10, 11, 12, 13,
+7, 8, 9, 10, 11, 12, 13, 14, 8, 9, 10, 11, 12, 13, 14, 15,
+9, 10, 11, 12, 13, 14, 15, 16, 10, 11, 12, 13, 14, 15, 16, 17,
+11, 12, 13, 14, 15, 16, 17, 18, 12, 13, 14, 15, 16, 17, 18, 19,
+13, 14, 15, 16, 17, 18, 19, 20, 14, 15, 16, 17, 18, 19, 20, 21,
+15, 16, 17, 18, 19, 20, 21, 22, 16, 17, 18, 19, 20, 21, 22, 23,
+17, 18, 19, 20, 21, 22, 23, 24, 18, 19, 20, 21, 22, 23, 24, 25,
+19, 20, 21, 22, 23, 24, 25, 26, 20, 21, 22, 23, 24, 25, 26, 27,
+21, 22, 23, 24, 25, 26, 27, 28, 22, 23, 24, 25, 26, 27, 28, 29,
+23, 24, 25, 26, 27, 28, 29, 30, 24, 25, 26, 27, 28, 29, 30, 31,
+25, 26, 27, 28, 29, 30, 31, 32, 26, 27, 28, 29, 30, 31, 32, 33,
+27, 28, 29, 30, 31, 32, 33, 34, 28, 29, 30, 31, 32, 33, 34, 35,
+29, 30, 31, 32, 33, 34, 35, 36, 30, 31, 32, 33, 34, 35, 36, 37,
+31, 32, 33, 34, 35, 36, 37, 38, 32, 33, 34, 35, 36, 37, 38, 39,
+33, 34, 35, 36, 37, 38, 39, 40, 34, 35, 36, 37, 38, 39, 40, 41,
+35, 36, 37, 38, 39, 40, 41, 42, 36, 37, 38, 39, 40, 41, 42, 43,
+37, 38, 39, 40, 41, 42, 43, 44, 38, 39, 40, 41, 42, 43, 44, 45,
+39, 40, 41, 42, 43, 44, 45, 46, 40, 41, 42, 43, 44, 45, 46, 47,
+41, 42, 43, 44, 45, 46, 47, 48, 42, 43, 44, 45, 46, 47, 48, 49,
+43, 44, 45, 46, 47, 48, 49, 50, 44, 45, 46, 47, 48, 49, 50, 51,
+45, 46, 47, 48, 49, 50, 51, 52, 46, 47, 48, 49, 50, 51, 52, 53,
+47, 48, 49, 50, 51, 52, 53, 54, 48, 49, 50, 51, 52, 53, 54, 55,
+49, 50, 51, 52, 53, 54, 55, 56, 50, 51, 52, 53, 54, 55, 56, 57,
+51, 52, 53, 54, 55, 56, 57, 58, 52, 53, 54, 55, 56, 57, 58, 59,
+53, 54, 55, 56, 57, 58, 59, 60, 54, 55, 56, 57, 58, 59, 60, 61,
+55, 56, 57, 58, 59, 60, 61, 62, 56, 57, 58, 59, 60, 61, 62, 63,
+57, 58, 59, 60, 61, 62, 63, 64, 58, 59, 60, 61, 62, 63, 64, 65,
+59, 60, 61, 62, 63, 64, 65, 66, 60, 61, 62, 63, 64, 65, 66, 67,
+61, 62, 63, 64, 65, 66, 67, 68, 62, 63, 64, 65, 66, 67, 68, 69,
+63, 64, 65, 66, 67, 68, 69, 70, 64, 65, 66, 67, 68, 69, 70, 71,
+72, 73, 74, 75, 76, 77, 78, 79, 71, 72, 73, 74, 75, 76, 77, 78,
+70, 71, 72, 73, 74, 75, 76, 77, 69, 70, 71, 72, 73, 74, 75, 76,
+68, 69, 70, 71, 72, 73, 74, 75, 67, 68, 69, 70, 71, 72, 73, 74,
+66, 67, 68, 69, 70, 71, 72, 73, 65, 66, 67, 68, 69, 70, 71, 72,
+64, 65, 66, 67, 68, 69, 70, 71, 63, 64, 65, 66, 67, 68, 69, 70,
+62, 63, 64, 65, 66, 67, 68, 69, 61, 62, 63, 64, 65, 66, 67, 68,
+60, 61, 62, 63, 64, 65, 66, 67, 59, 60, 61, 62, 63, 64, 65, 66,
+58, 59, 60, 61, 62, 63, 64, 65, 57, 58, 59, 60, 61, 62, 63, 64,
+56, 57, 58, 59, 60, 61, 62, 63, 55, 56, 57, 58, 59, 60, 61, 62,
+54, 55, 56, 57, 58, 59, 60, 61, 53, 54, 55, 56, 57, 58, 59, 60,
+52, 53, 54, 55, 56, 57, 58, 59, 51, 52, 53, 54, 55, 56, 57, 58,
+50, 51, 52, 53, 54, 55, 56, 57, 49, 50, 51, 52, 53, 54, 55, 56,
+48, 49, 50, 51, 52, 53, 54, 55, 47, 48, 49, 50, 51, 52, 53, 54,
+46, 47, 48, 49, 50, 51, 52, 53, 45, 46, 47, 48, 49, 50, 51, 52,
+44, 45, 46, 47, 48, 49, 50, 51, 43, 44, 45, 46, 47, 48, 49, 50,
+42, 43, 44, 45, 46, 47, 48, 49, 41, 42, 43, 44, 45, 46, 47, 48,
+40, 41, 42, 43, 44, 45, 46, 47, 39, 40, 41, 42, 43, 44, 45, 46,
+38, 39, 40, 41, 42, 43, 44, 45, 37, 38, 39, 40, 41, 42, 43, 44,
+36, 37, 38, 39, 40, 41, 42, 43, 35, 36, 37, 38, 39, 40, 41, 42,
+34, 35, 36, 37, 38, 39, 40, 41, 33, 34, 35, 36, 37, 38, 39, 40,
+32, 33, 34, 35, 36, 37, 38, 39, 31, 32, 33, 34, 35, 36, 37, 38,
+30, 31, 32, 33, 34, 35, 36, 37, 29, 30, 31, 32, 33, 34, 35, 36,
+28, 29, 30, 31, 32, 33, 34, 35, 27, 28, 29, 30, 31, 32, 33, 34,
+26, 27, 28, 29, 30, 31, 32, 33, 25, 26, 27, 28, 29, 30, 31, 32,
+24, 25, 26, 27, 28, 29, 30, 31, 23, 24, 25, 26, 27, 28, 29, 30,
+22, 23, 24, 25, 26, 27, 28, 29, 21, 22, 23, 24, 25, 26, 27, 28,
+20, 21, 22, 23, 24, 25, 26, 27, 19, 20, 21, 22, 23, 24, 25, 26,
+18, 19, 20, 21, 22, 23, 24, 25, 17, 18, 19, 20, 21, 22, 23, 24,
+16, 17, 18, 19, 20, 21, 22, 23, 15, 16, 17, 18, 19, 20, 21, 22,
+14, 15, 16, 17, 18, 19, 20, 21, 13, 14, 15, 16, 17, 18, 19, 20,
+12, 13, 14, 15, 16, 17, 18, 19, 11, 12, 13, 14, 15, 16, 17, 18,
+10, 11, 12, 13, 14, 15, 16, 17, 9, 10, 11, 12, 13, 14, 15, 16,
+9, 10, 11, 12, 13, 14, 15, 16, 10, 11, 12, 13, 14, 15, 16, 17,
+11, 12, 13, 14, 15, 16, 17, 18, 12, 13, 14, 15, 16, 17, 18, 19,
+13, 14, 15, 16, 17, 18, 19, 20, 14, 15, 16, 17, 18, 19, 20, 21,
+15, 16, 17, 18, 19, 20, 21, 22, 16, 17, 18, 19, 20, 21, 22, 23,
+17, 18, 19, 20, 21, 22, 23, 24, 18, 19, 20, 21, 22, 23, 24, 25,
+19, 20, 21, 22, 23, 24, 25, 26, 20, 21, 22, 23, 24, 25, 26, 27,
+21, 22, 23, 24, 25, 26, 27, 28, 22, 23, 24, 25, 26, 27, 28, 29,
+23, 24, 25, 26, 27, 28, 29, 30, 24, 25, 26, 27, 28, 29, 30, 31,
+25, 26, 27, 28, 29, 30, 31, 32, 26, 27, 28, 29, 30, 31, 32, 33,
+27, 28, 29, 30, 31, 32, 33, 34, 28, 29, 30, 31, 32, 33, 34, 35,
+29, 30, 31, 32, 33, 34, 35, 36, 30, 31, 32, 33, 34, 35, 36, 37,
+31, 32, 33, 34, 35, 36, 37, 38, 32, 33, 34, 35, 36, 37, 38, 39,
+33, 34, 35, 36, 37, 38, 39, 40, 34, 35, 36, 37, 38, 39, 40, 41,
+35, 36, 37, 38, 39, 40, 41, 42, 36, 37, 38, 39, 40, 41, 42, 43,
+37, 38, 39, 40, 41, 42, 43, 44, 38, 39, 40, 41, 42, 43, 44, 45,
+39, 40, 41, 42, 43, 44, 45, 46, 40, 41, 42, 43, 44, 45, 46, 47,
+41, 42, 43, 44, 45, 46, 47, 48, 42, 43, 44, 45, 46, 47, 48, 49,
+43, 44, 45, 46, 47, 48, 49, 50, 44, 45, 46, 47, 48, 49, 50, 51,
+45, 46, 47, 48, 49, 50, 51, 52, 46, 47, 48, 49, 50, 51, 52, 53,
+47, 48, 49, 50, 51, 52, 53, 54, 48, 49, 50, 51, 52, 53, 54, 55,
+49, 50, 51, 52, 53, 54, 55, 56, 50, 51, 52, 53, 54, 55, 56, 57,
+51, 52, 53, 54, 55, 56, 57, 58, 52, 53, 54, 55, 56, 57, 58, 59,
+53, 54, 55, 56, 57, 58, 59, 60, 54, 55, 56, 57, 58, 59, 60, 61,
+55, 56, 57, 58, 59, 60, 61, 62, 56, 57, 58, 59, 60, 61, 62, 63,
+57, 58, 59, 60, 61, 62, 63, 64, 58, 59, 60, 61, 62, 63, 64, 65,
+59, 60, 61, 62, 63, 64, 65, 66, 60, 61, 62, 63, 64, 65, 66, 67,
+61, 62, 63, 64, 65, 66, 67, 68, 62, 63, 64, 65, 66, 67, 68, 69,
+63, 64, 65, 66, 67, 68, 69, 70, 64, 65, 66, 67, 68, 69, 70, 71,
+65, 66, 67, 68, 69, 70, 71, 72, 66, 67, 68, 69, 70, 71, 72, 73,
+67, 68, 69, 70, 71, 72, 73, 74, 68, 69, 70, 71, 72, 73, 74, 75,
+69, 70, 71, 72, 73, 74, 75, 76, 70, 71, 72, 73, 74, 75, 76, 77,
+71, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 79,
+80, 81, 82, 83, 84, 85, 86, 87, 79, 80, 81, 82, 83, 84, 85, 86,
+78, 79, 80, 81, 82, 83, 84, 85, 77, 78, 79, 80, 81, 82, 83, 84,
+76, 77, 78, 79, 80, 81, 82, 83, 75, 76, 77, 78, 79, 80, 81, 82,
+74, 75, 76, 77, 78, 79, 80, 81, 73, 74, 75, 76, 77, 78, 79, 80,
+72, 73, 74, 75, 76, 77, 78, 79, 71, 72, 73, 74, 75, 76, 77, 78,
+70, 71, 72, 73, 74, 75, 76, 77, 69, 70, 71, 72, 73, 74, 75, 76,
+68, 69, 70, 71, 72, 73, 74, 75, 67, 68, 69, 70, 71, 72, 73, 74,
+66, 67, 68, 69, 70, 71, 72, 73, 65, 66, 67, 68, 69, 70, 71, 72,
+64, 65, 66, 67, 68, 69, 70, 71, 63, 64, 65, 66, 67, 68, 69, 70,
+62, 63, 64, 65, 66, 67, 68, 69, 61, 62, 63, 64, 65, 66, 67, 68,
+60, 61, 62, 63, 64, 65, 66, 67, 59, 60, 61, 62, 63, 64, 65, 66,
+58, 59, 60, 61, 62, 63, 64, 65, 57, 58, 59, 60, 61, 62, 63, 64,
+56, 57, 58, 59, 60, 61, 62, 63, 55, 56, 57, 58, 59, 60, 61, 62,
+54, 55, 56, 57, 58, 59, 60, 61, 53, 54, 55, 56, 57, 58, 59, 60,
+52, 53, 54, 55, 56, 57, 58, 59, 51, 52, 53, 54, 55, 56, 57, 58,
+50, 51, 52, 53, 54, 55, 56, 57, 49, 50, 51, 52, 53, 54, 55, 56,
+48, 49, 50, 51, 52, 53, 54, 55, 47, 48, 49, 50, 51, 52, 53, 54,
+46, 47, 48, 49, 50, 51, 52, 53, 45, 46, 47, 48, 49, 50, 51, 52,
+44, 45, 46, 47, 48, 49, 50, 51, 43, 44, 45, 46, 47, 48, 49, 50,
+42, 43, 44, 45, 46, 47, 48, 49, 41, 42, 43, 44, 45, 46, 47, 48,
+40, 41, 42, 43, 44, 45, 46, 47, 39, 40, 41, 42, 43, 44, 45, 46,
+38, 39, 40, 41, 42, 43, 44, 45, 37, 38, 39, 40, 41, 42, 43, 44,
+36, 37, 38, 39, 40, 41, 42, 43, 35, 36, 37, 38, 39, 40, 41, 42,
+34, 35, 36, 37, 38, 39, 40, 41, 33, 34, 35, 36, 37, 38, 39, 40,
+32, 33, 34, 35, 36, 37, 38, 39, 31, 32, 33, 34, 35, 36, 37, 38,
+30, 31, 32, 33, 34, 35, 36, 37, 29, 30, 31, 32, 33, 34, 35, 36,
+28, 29, 30, 31, 32, 33, 34, 35, 27, 28, 29, 30, 31, 32, 33, 34,
+26, 27, 28, 29, 30, 31, 32, 33, 25, 26, 27, 28, 29, 30, 31, 32,
+24, 25, 26, 27, 28, 29, 30, 31, 23, 24, 25, 26, 27, 28, 29, 30,
+22, 23, 24, 25, 26, 27, 28, 29, 21, 22, 23, 24, 25, 26, 27, 28,
+20, 21, 22, 23, 24, 25, 26, 27, 19, 20, 21, 22, 23, 24, 25, 26,
+18, 19, 20, 21, 22, 23, 24, 25, 17, 18, 19, 20, 21, 22, 23, 24,
+17, 18, 19, 20, 21, 22, 23, 24, 18, 19, 20, 21, 22, 23, 24, 25,
+19, 20, 21, 22, 23, 24, 25, 26, 20, 21, 22, 23, 24, 25, 26, 27,
+21, 22, 23, 24, 25, 26, 27, 28, 22, 23, 24, 25, 26, 27, 28, 29,
+23, 24, 25, 26, 27, 28, 29, 30, 24, 25, 26, 27, 28, 29, 30, 31,
+25, 26, 27, 28, 29, 30, 31, 32, 26, 27, 28, 29, 30, 31, 32, 33,
+27, 28, 29, 30, 31, 32, 33, 34, 28, 29, 30, 31, 32, 33, 34, 35,
+29, 30, 31, 32, 33, 34, 35, 36, 30, 31, 32, 33, 34, 35, 36, 37,
+31, 32, 33, 34, 35, 36, 37, 38, 32, 33, 34, 35, 36, 37, 38, 39,
+33, 34, 35, 36, 37, 38, 39, 40, 34, 35, 36, 37, 38, 39, 40, 41,
+35, 36, 37, 38, 39, 40, 41, 42, 36, 37, 38, 39, 40, 41, 42, 43,
+37, 38, 39, 40, 41, 42, 43, 44, 38, 39, 40, 41, 42, 43, 44, 45,
+39, 40, 41, 42, 43, 44, 45, 46, 40, 41, 42, 43, 44, 45, 46, 47,
+41, 42, 43, 44, 45, 46, 47, 48, 42, 43, 44, 45, 46, 47, 48, 49,
+43, 44, 45, 46, 47, 48, 49, 50, 44, 45, 46, 47, 48, 49, 50, 51,
+45, 46, 47, 48, 49, 50, 51, 52, 46, 47, 48, 49, 50, 51, 52, 53,
+47, 48, 49, 50, 51, 52, 53, 54, 48, 49, 50, 51, 52, 53, 54, 55,
+49, 50, 51, 52, 53, 54, 55, 56, 50, 51, 52, 53, 54, 55, 56, 57,
+51, 52, 53, 54, 55, 56, 57, 58, 52, 53, 54, 55, 56, 57, 58, 59,
+53, 54, 55, 56, 57, 58, 59, 60, 54, 55, 56, 57, 58, 59, 60, 61,
+55, 56, 57, 58, 59, 60, 61, 62, 56, 57, 58, 59, 60, 61, 62, 63,
+57, 58, 59, 60, 61, 62, 63, 64, 58, 59, 60, 61, 62, 63, 64, 65,
+59, 60, 61, 62, 63, 64, 65, 66, 60, 61, 62, 63, 64, 65, 66, 67,
+61, 62, 63, 64, 65, 66, 67, 68, 62, 63, 64, 65, 66, 67, 68, 69,
+63, 64, 65, 66, 67, 68, 69, 70, 64, 65, 66, 67, 68, 69, 70, 71,
+65, 66, 67, 68, 69, 70, 71, 72, 66, 67, 68, 69, 70, 71, 72, 73,
+67, 68, 69, 70, 71, 72, 73, 74, 68, 69, 70, 71, 72, 73, 74, 75,
+69, 70, 71, 72, 73, 74, 75, 76, 70, 71, 72, 73, 74, 75, 76, 77,
+71, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 79,
+73, 74, 75, 76, 77, 78, 79, 80, 74, 75, 76, 77, 78, 79, 80, 81,
+75, 76, 77, 78, 79, 80, 81, 82, 76, 77, 78, 79, 80, 81, 82, 83,
+77, 78, 79, 80, 81, 82, 83, 84, 78, 79, 80, 81, 82, 83, 84, 85,
+79, 80, 81, 82, 83, 84, 85, 86, 80, 81, 82, 83, 84, 85, 86, 87,
+88, 89, 90, 91, 92, 93, 94, 95, 87, 88, 89, 90, 91, 92, 93, 94,
+86, 87, 88, 89, 90, 91, 92, 93, 85, 86, 87, 88, 89, 90, 91, 92,
+84, 85, 86, 87, 88, 89, 90, 91, 83, 84, 85, 86, 87, 88, 89, 90,
+82, 83, 84, 85, 86, 87, 88, 89, 81, 82, 83, 84, 85, 86, 87, 88,
+80, 81, 82, 83, 84, 85, 86, 87, 79, 80, 81, 82, 83, 84, 85, 86,
+78, 79, 80, 81, 82, 83, 84, 85, 77, 78, 79, 80, 81, 82, 83, 84,
+76, 77, 78, 79, 80, 81, 82, 83, 75, 76, 77, 78, 79, 80, 81, 82,
+74, 75, 76, 77, 78, 79, 80, 81, 73, 74, 75, 76, 77, 78, 79, 80,
+72, 73, 74, 75, 76, 77, 78, 79, 71, 72, 73, 74, 75, 76, 77, 78,
+70, 71, 72, 73, 74, 75, 76, 77, 69, 70, 71, 72, 73, 74, 75, 76,
+68, 69, 70, 71, 72, 73, 74, 75, 67, 68, 69, 70, 71, 72, 73, 74,
+66, 67, 68, 69, 70, 71, 72, 73, 65, 66, 67, 68, 69, 70, 71, 72,
+64, 65, 66, 67, 68, 69, 70, 71, 63, 64, 65, 66, 67, 68, 69, 70,
+62, 63, 64, 65, 66, 67, 68, 69, 61, 62, 63, 64, 65, 66, 67, 68,
+60, 61, 62, 63, 64, 65, 66, 67, 59, 60, 61, 62, 63, 64, 65, 66,
+58, 59, 60, 61, 62, 63, 64, 65, 57, 58, 59, 60, 61, 62, 63, 64,
+56, 57, 58, 59, 60, 61, 62, 63, 55, 56, 57, 58, 59, 60, 61, 62,
+54, 55, 56, 57, 58, 59, 60, 61, 53, 54, 55, 56, 57, 58, 59, 60,
+52, 53, 54, 55, 56, 57, 58, 59, 51, 52, 53, 54, 55, 56, 57, 58,
+50, 51, 52, 53, 54, 55, 56, 57, 49, 50, 51, 52, 53, 54, 55, 56,
+48, 49, 50, 51, 52, 53, 54, 55, 47, 48, 49, 50, 51, 52, 53, 54,
+46, 47, 48, 49, 50, 51, 52, 53, 45, 46, 47, 48, 49, 50, 51, 52,
+44, 45, 46, 47, 48, 49, 50, 51, 43, 44, 45, 46, 47, 48, 49, 50,
+42, 43, 44, 45, 46, 47, 48, 49, 41, 42, 43, 44, 45, 46, 47, 48,
+40, 41, 42, 43, 44, 45, 46, 47, 39, 40, 41, 42, 43, 44, 45, 46,
+38, 39, 40, 41, 42, 43, 44, 45, 37, 38, 39, 40, 41, 42, 43, 44,
+36, 37, 38, 39, 40, 41, 42, 43, 35, 36, 37, 38, 39, 40, 41, 42,
+34, 35, 36, 37, 38, 39, 40, 41, 33, 34, 35, 36, 37, 38, 39, 40,
+32, 33, 34, 35, 36, 37, 38, 39, 31, 32, 33, 34, 35, 36, 37, 38,
+30, 31, 32, 33, 34, 35, 36, 37, 29, 30, 31, 32, 33, 34, 35, 36,
+28, 29, 30, 31, 32, 33, 34, 35, 27, 28, 29, 30, 31, 32, 33, 34,
+26, 27, 28, 29, 30, 31, 32, 33, 25, 26, 27, 28, 29, 30, 31, 32,
+25, 26, 27, 28, 29, 30, 31, 32, 26, 27, 28, 29, 30, 31, 32, 33,
+27, 28, 29, 30, 31, 32, 33, 34, 28, 29, 30, 31, 32, 33, 34, 35,
+29, 30, 31, 32, 33, 34, 35, 36, 30, 31, 32, 33, 34, 35, 36, 37,
+31, 32, 33, 34, 35, 36, 37, 38, 32, 33, 34, 35, 36, 37, 38, 39,
+33, 34, 35, 36, 37, 38, 39, 40, 34, 35, 36, 37, 38, 39, 40, 41,
+35, 36, 37, 38, 39, 40, 41, 42, 36, 37, 38, 39, 40, 41, 42, 43,
+37, 38, 39, 40, 41, 42, 43, 44, 38, 39, 40, 41, 42, 43, 44, 45,
+39, 40, 41, 42, 43, 44, 45, 46, 40, 41, 42, 43, 44, 45, 46, 47,
+41, 42, 43, 44, 45, 46, 47, 48, 42, 43, 44, 45, 46, 47, 48, 49,
+43, 44, 45, 46, 47, 48, 49, 50, 44, 45, 46, 47, 48, 49, 50, 51,
+45, 46, 47, 48, 49, 50, 51, 52, 46, 47, 48, 49, 50, 51, 52, 53,
+47, 48, 49, 50, 51, 52, 53, 54, 48, 49, 50, 51, 52, 53, 54, 55,
+49, 50, 51, 52, 53, 54, 55, 56, 50, 51, 52, 53, 54, 55, 56, 57,
+51, 52, 53, 54, 55, 56, 57, 58, 52, 53, 54, 55, 56, 57, 58, 59,
+53, 54, 55, 56, 57, 58, 59, 60, 54, 55, 56, 57, 58, 59, 60, 61,
+55, 56, 57, 58, 59, 60, 61, 62, 56, 57, 58, 59, 60, 61, 62, 63,
+57, 58, 59, 60, 61, 62, 63, 64, 58, 59, 60, 61, 62, 63, 64, 65,
+59, 60, 61, 62, 63, 64, 65, 66, 60, 61, 62, 63, 64, 65, 66, 67,
+61, 62, 63, 64, 65, 66, 67, 68, 62, 63, 64, 65, 66, 67, 68, 69,
+63, 64, 65, 66, 67, 68, 69, 70, 64, 65, 66, 67, 68, 69, 70, 71,
+65, 66, 67, 68, 69, 70, 71, 72, 66, 67, 68, 69, 70, 71, 72, 73,
+67, 68, 69, 70, 71, 72, 73, 74, 68, 69, 70, 71, 72, 73, 74, 75,
+69, 70, 71, 72, 73, 74, 75, 76, 70, 71, 72, 73, 74, 75, 76, 77,
+71, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 79,
+73, 74, 75, 76, 77, 78, 79, 80, 74, 75, 76, 77, 78, 79, 80, 81,
+75, 76, 77, 78, 79, 80, 81, 82, 76, 77, 78, 79, 80, 81, 82, 83,
+77, 78, 79, 80, 81, 82, 83, 84, 78, 79, 80, 81, 82, 83, 84, 85,
+79, 80, 81, 82, 83, 84, 85, 86, 80, 81, 82, 83, 84, 85, 86, 87,
+81, 82, 83, 84, 85, 86, 87, 88, 82, 83, 84, 85, 86, 87, 88, 89,
+83, 84, 85, 86, 87, 88, 89, 90, 84, 85, 86, 87, 88, 89, 90, 91,
+85, 86, 87, 88, 89, 90, 91, 92, 86, 87, 88, 89, 90, 91, 92, 93,
+87, 88, 89, 90, 91, 92, 93, 94, 88, 89, 90, 91, 92, 93, 94, 95,
+};
+static const RevealMap revealDiamond = {revealDiamondRanks, 0, 96};
+
+// Angle around the center, clockwise from the top
+alignas(4) static const uint8_t revealSweepRanks[] = {
+210, 210, 209, 209, 208, 208, 207, 207, 211, 210, 209, 209, 208, 208, 207, 207,
+211, 210, 210, 209, 209, 208, 208, 207, 211, 211, 210, 209, 209, 208, 208, 207,
+211, 211, 210, 210, 209, 209, 208, 207, 212, 211, 211, 210, 209, 209, 208, 208,
+212, 211, 211, 210, 210, 209, 209, 208, 212, 212, 211, 211, 210, 209, 209, 208,
+213, 212, 211, 211, 210, 210, 209, 208, 213, 212, 212, 211, 211, 210, 209, 209,
+213, 213, 212, 211, 211, 210, 210, 209, 214, 213, 212, 212, 211, 211, 210, 209,
+214, 213, 213, 212, 211, 211, 210, 210, 214, 214, 213, 212, 212, 211, 211, 210,
+215, 214, 213, 213, 212, 212, 211, 210, 215, 214, 214, 213, 213, 212, 211, 211,
+215, 215, 214, 214, 213, 212, 212, 211, 216, 215, 215, 214, 213, 213, 212, 211,
+216, 216, 215, 214, 214, 213, 212, 212, 217, 216, 215, 215, 214, 213, 213, 212,
+217, 216, 216, 215, 214, 214, 213, 212, 217, 217, 216, 216, 215, 214, 214, 213,
+218, 217, 217, 216, 215, 215, 214, 213, 218, 218, 217, 216, 216, 215, 214, 214,
+219, 218, 218, 217, 216, 216, 215, 214, 219, 219, 218, 217, 217, 216, 215, 215,
+220, 219, 219, 218, 217, 217, 216, 215, 221, 220, 219, 219, 218, 217, 216, 216,
+221, 220, 220, 219, 218, 218, 217, 216, 222, 221, 220, 220, 219, 218, 217, 217,
+222, 222, 221, 220, 220, 219, 218, 217, 223, 222, 222, 221, 220, 219, 219, 218,
+224, 223, 222, 221, 221, 220, 219, 218, 224, 224, 223, 222, 221, 221, 220, 219,
+225, 224, 224, 223, 222, 221, 221, 220, 226, 225, 224, 224, 223, 222, 221, 220,
+226, 226, 225, 224, 224, 223, 222, 221, 227, 226, 226, 225, 224, 224, 223, 222,
+228, 227, 226, 226, 225, 224, 224, 223, 229, 228, 227, 227, 226, 225, 224, 224,
+229, 229, 228, 227, 227, 226, 225, 224, 230, 230, 229, 228, 228, 227, 226, 225,
+231, 230, 230, 229, 228, 228, 227, 226, 232, 231, 231, 230, 229, 229, 228, 227,
+233, 232, 232, 231, 230, 230, 229, 228, 234, 233, 233, 232, 231, 231, 230, 229,
+235, 234, 234, 233, 232, 232, 231, 230, 236, 235, 235, 234, 233, 233, 232, 231,
+237, 236, 236, 235, 235, 234, 233, 233, 238, 237, 237, 236, 236, 235, 234, 234,
+239, 239, 238, 237, 237, 236, 236, 235, 240, 240, 239, 239, 238, 238, 237, 236,
+241, 241, 240, 240, 239, 239, 238, 238, 242, 242, 242, 241, 241, 240, 240, 239,
+244, 243, 243, 242, 242, 241, 241, 240, 245, 244, 244, 244, 243, 243, 242, 242,
+246, 246, 245, 245, 245, 244, 244, 243, 247, 247, 247, 246, 246, 246, 245, 245,
+248, 248, 248, 248, 247, 247, 247, 247, 250, 250, 249, 249, 249, 249, 248, 248,
+251, 251, 251, 251, 250, 250, 250, 250, 252, 252, 252, 252, 252, 252, 252, 251,
+254, 253, 253, 253, 253, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255,
+0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2,
+3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5,
+5, 5, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8,
+8, 8, 8, 9, 9, 9, 10, 10, 9, 9, 10, 10, 10, 11, 11, 12,
+10, 11, 11, 11, 12, 12, 13, 13, 11, 12, 12, 13, 13, 14, 14, 15,
+13, 13, 13, 14, 14, 15, 15, 16, 14, 14, 15, 15, 16, 16, 17, 17,
+15, 15, 16, 16, 17, 17, 18, 19, 16, 16, 17, 18, 18, 19, 19, 20,
+17, 18, 18, 19, 19, 20, 21, 21, 18, 19, 19, 20, 20, 21, 22, 22,
+19, 20, 20, 21, 22, 22, 23, 24, 20, 21, 21, 22, 23, 23, 24, 25,
+21, 22, 22, 23, 24, 24, 25, 26, 22, 23, 23, 24, 25, 25, 26, 27,
+23, 24, 24, 25, 26, 26, 27, 28, 24, 25, 25, 26, 27, 27, 28, 29,
+25, 25, 26, 27, 27, 28, 29, 30, 26, 26, 27, 28, 28, 29, 30, 31,
+26, 27, 28, 28, 29, 30, 31, 32, 27, 28, 29, 29, 30, 31, 32, 32,
+28, 29, 29, 30, 31, 32, 32, 33, 29, 29, 30, 31, 32, 32, 33, 34,
+29, 30, 31, 32, 32, 33, 34, 35, 30, 31, 32, 32, 33, 34, 34, 35,
+31, 32, 32, 33, 34, 34, 35, 36, 32, 32, 33, 34, 34, 35, 36, 37,
+32, 33, 33, 34, 35, 36, 36, 37, 33, 33, 34, 35, 35, 36, 37, 38,
+33, 34, 35, 35, 36, 37, 38, 38, 34, 35, 35, 36, 37, 37, 38, 39,
+34, 35, 36, 36, 37, 38, 39, 39, 35, 36, 36, 37, 38, 38, 39, 40,
+36, 36, 37, 38, 38, 39, 40, 40, 36, 37, 37, 38, 39, 39, 40, 41,
+37, 37, 38, 39, 39, 40, 41, 41, 37, 38, 38, 39, 40, 40, 41, 42,
+38, 38, 39, 39, 40, 41, 41, 42, 38, 39, 39, 40, 41, 41, 42, 43,
+38, 39, 40, 40, 41, 42, 42, 43, 39, 39, 40, 41, 41, 42, 43, 43,
+39, 40, 40, 41, 42, 42, 43, 44, 40, 40, 41, 41, 42, 43, 43, 44,
+40, 41, 41, 42, 42, 43, 44, 44, 40, 41, 42, 42, 43, 43, 44, 45,
+41, 41, 42, 43, 43, 44, 44, 45, 41, 42, 42, 43, 44, 44, 45, 45,
+41, 42, 43, 43, 44, 44, 45, 46, 42, 42, 43, 44, 44, 45, 45, 46,
+42, 43, 43, 44, 44, 45, 46, 46, 42, 43, 44, 44, 45, 45, 46, 47,
+43, 43, 44, 44, 45, 46, 46, 47, 43, 44, 44, 45, 45, 46, 46, 47,
+43, 44, 44, 45, 46, 46, 47, 47, 44, 44, 45, 45, 46, 46, 47, 48,
+44, 44, 45, 46, 46, 47, 47, 48, 44, 45, 45, 46, 46, 47, 47, 48,
+44, 45, 46, 46, 47, 47, 48, 48, 45, 45, 46, 46, 47, 47, 48, 48,
+206, 205, 205, 204, 204, 203, 202, 202, 206, 206, 205, 204, 204, 203, 203, 202,
+206, 206, 205, 205, 204, 203, 203, 202, 207, 206, 205, 205, 204, 204, 203, 202,
+207, 206, 206, 205, 204, 204, 203, 203, 207, 206, 206, 205, 205, 204, 203, 203,
+207, 207, 206, 205, 205, 204, 204, 203, 208, 207, 206, 206, 205, 204, 204, 203,
+208, 207, 207, 206, 205, 205, 204, 203, 208, 207, 207, 206, 205, 205, 204, 203,
+208, 208, 207, 206, 206, 205, 204, 204, 209, 208, 207, 207, 206, 205, 205, 204,
+209, 208, 208, 207, 206, 206, 205, 204, 209, 209, 208, 207, 207, 206, 205, 204,
+210, 209, 208, 207, 207, 206, 205, 205, 210, 209, 209, 208, 207, 206, 206, 205,
+210, 210, 209, 208, 207, 207, 206, 205, 211, 210, 209, 208, 208, 207, 206, 205,
+211, 210, 209, 209, 208, 207, 206, 206, 211, 211, 210, 209, 208, 208, 207, 206,
+212, 211, 210, 209, 209, 208, 207, 206, 212, 211, 211, 210, 209, 208, 207, 207,
+212, 212, 211, 210, 209, 209, 208, 207, 213, 212, 211, 211, 210, 209, 208, 207,
+213, 213, 212, 211, 210, 209, 208, 208, 214, 213, 212, 211, 211, 210, 209, 208,
+214, 214, 213, 212, 211, 210, 209, 208, 215, 214, 213, 212, 211, 211, 210, 209,
+215, 215, 214, 213, 212, 211, 210, 209, 216, 215, 214, 213, 212, 212, 211, 210,
+216, 216, 215, 214, 213, 212, 211, 210, 217, 216, 215, 214, 214, 213, 212, 211,
+218, 217, 216, 215, 214, 213, 212, 211, 218, 217, 217, 216, 215, 214, 213, 212,
+219, 218, 217, 216, 215, 214, 213, 212, 220, 219, 218, 217, 216, 215, 214, 213,
+220, 219, 219, 218, 217, 216, 215, 214, 221, 220, 219, 218, 217, 216, 215, 214,
+222, 221, 220, 219, 218, 217, 216, 215, 223, 222, 221, 220, 219, 218, 217, 216,
+224, 223, 222, 221, 220, 219, 218, 216, 224, 224, 223, 222, 221, 220, 218, 217,
+225, 224, 224, 223, 222, 220, 219, 218, 226, 225, 224, 224, 222, 221, 220, 219,
+227, 226, 225, 225, 224, 222, 221, 220, 228, 227, 227, 226, 225, 224, 222, 221,
+229, 229, 228, 227, 226, 225, 224, 222, 231, 230, 229, 228, 227, 226, 225, 224,
+232, 231, 230, 229, 228, 227, 226, 225, 233, 232, 231, 230, 229, 228, 227, 226,
+234, 233, 233, 232, 231, 230, 229, 228, 236, 235, 234, 233, 232, 231, 230, 229,
+237, 236, 235, 235, 234, 233, 232, 231, 238, 238, 237, 236, 235, 234, 233, 232,
+240, 239, 239, 238, 237, 236, 235, 234, 241, 241, 240, 239, 239, 238, 237, 236,
+243, 242, 242, 241, 241, 240, 239, 238, 245, 244, 244, 243, 242, 242, 241, 240,
+246, 246, 245, 245, 244, 244, 243, 242, 248, 247, 247, 247, 246, 246, 245, 245,
+249, 249, 249, 249, 248, 248, 247, 247, 251, 251, 251, 251, 250, 250, 250, 249,
+253, 253, 253, 253, 252, 252, 252, 252, 255, 255, 255, 255, 254, 254, 254, 254,
+0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+4, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6, 6, 7, 7, 8, 8,
+7, 8, 8, 8, 9, 9, 10, 10, 9, 9, 10, 10, 11, 11, 12, 13,
+10, 11, 11, 12, 13, 13, 14, 15, 12, 13, 13, 14, 14, 15, 16, 17,
+14, 14, 15, 16, 16, 17, 18, 19, 15, 16, 16, 17, 18, 19, 20, 21,
+17, 17, 18, 19, 20, 21, 22, 23, 18, 19, 20, 20, 21, 22, 23, 24,
+19, 20, 21, 22, 23, 24, 25, 26, 21, 22, 22, 23, 24, 25, 26, 27,
+22, 23, 24, 25, 26, 27, 28, 29, 23, 24, 25, 26, 27, 28, 29, 30,
+24, 25, 26, 27, 28, 29, 30, 32, 26, 26, 27, 28, 29, 30, 32, 33,
+27, 28, 28, 29, 30, 32, 33, 34, 28, 29, 30, 30, 32, 33, 34, 35,
+29, 30, 31, 32, 33, 34, 35, 36, 30, 31, 32, 32, 33, 35, 36, 37,
+31, 32, 32, 33, 34, 35, 37, 38, 32, 32, 33, 34, 35, 36, 37, 39,
+32, 33, 34, 35, 36, 37, 38, 39, 33, 34, 35, 36, 37, 38, 39, 40,
+34, 35, 36, 37, 38, 39, 40, 41, 35, 36, 36, 37, 38, 39, 40, 41,
+35, 36, 37, 38, 39, 40, 41, 42, 36, 37, 38, 39, 40, 41, 42, 43,
+37, 38, 38, 39, 40, 41, 42, 43, 37, 38, 39, 40, 41, 42, 43, 44,
+38, 39, 40, 41, 41, 42, 43, 44, 39, 39, 40, 41, 42, 43, 44, 45,
+39, 40, 41, 42, 43, 43, 44, 45, 40, 40, 41, 42, 43, 44, 45, 46,
+40, 41, 42, 43, 44, 44, 45, 46, 41, 41, 42, 43, 44, 45, 46, 47,
+41, 42, 43, 44, 44, 45, 46, 47, 42, 42, 43, 44, 45, 46, 47, 47,
+42, 43, 44, 44, 45, 46, 47, 48, 43, 43, 44, 45, 46, 46, 47, 48,
+43, 44, 44, 45, 46, 47, 48, 48, 43, 44, 45, 46, 46, 47, 48, 49,
+44, 44, 45, 46, 47, 47, 48, 49, 44, 45, 46, 46, 47, 48, 49, 49,
+44, 45, 46, 47, 47, 48, 49, 50, 45, 45, 46, 47, 48, 48, 49, 50,
+45, 46, 46, 47, 48, 49, 49, 50, 45, 46, 47, 48, 48, 49, 50, 50,
+46, 46, 47, 48, 48, 49, 50, 51, 46, 47, 47, 48, 49, 49, 50, 51,
+46, 47, 48, 48, 49, 50, 50, 51, 47, 47, 48, 49, 49, 50, 51, 51,
+47, 48, 48, 49, 50, 50, 51, 52, 47, 48, 48, 49, 50, 50, 51, 52,
+47, 48, 49, 49, 50, 51, 51, 52, 48, 48, 49, 50, 50, 51, 51, 52,
+48, 49, 49, 50, 50, 51, 52, 52, 48, 49, 49, 50, 51, 51, 52, 52,
+48, 49, 50, 50, 51, 51, 52, 53, 49, 49, 50, 50, 51, 52, 52, 53,
+49, 49, 50, 51, 51, 52, 52, 53, 49, 50, 50, 51, 51, 52, 53, 53,
+201, 201, 200, 199, 199, 198, 198, 197, 201, 201, 200, 200, 199, 198, 198, 197,
+202, 201, 200, 200, 199, 198, 198, 197, 202, 201, 200, 200, 199, 199, 198, 197,
+202, 201, 201, 200, 199, 199, 198, 197, 202, 201, 201, 200, 199, 199, 198, 197,
+202, 202, 201, 200, 200, 199, 198, 197, 202, 202, 201, 200, 200, 199, 198, 198,
+203, 202, 201, 201, 200, 199, 198, 198, 203, 202, 201, 201, 200, 199, 199, 198,
+203, 202, 202, 201, 200, 199, 199, 198, 203, 202, 202, 201, 200, 200, 199, 198,
+203, 203, 202, 201, 200, 200, 199, 198, 204, 203, 202, 201, 201, 200, 199, 198,
+204, 203, 202, 202, 201, 200, 199, 198, 204, 203, 203, 202, 201, 200, 199, 199,
+204, 204, 203, 202, 201, 200, 200, 199, 205, 204, 203, 202, 201, 201, 200, 199,
+205, 204, 203, 202, 202, 201, 200, 199, 205, 204, 204, 203, 202, 201, 200, 199,
+205, 205, 204, 203, 202, 201, 200, 199, 206, 205, 204, 203, 202, 201, 200, 200,
+206, 205, 204, 203, 203, 202, 201, 200, 206, 206, 205, 204, 203, 202, 201, 200,
+207, 206, 205, 204, 203, 202, 201, 200, 207, 206, 205, 204, 203, 202, 201, 200,
+207, 207, 206, 205, 204, 203, 202, 201, 208, 207, 206, 205, 204, 203, 202, 201,
+208, 207, 206, 205, 204, 203, 202, 201, 209, 208, 207, 206, 205, 204, 202, 201,
+209, 208, 207, 206, 205, 204, 203, 202, 210, 209, 208, 206, 205, 204, 203, 202,
+210, 209, 208, 207, 206, 205, 203, 202, 211, 210, 208, 207, 206, 205, 204, 203,
+211, 210, 209, 208, 207, 205, 204, 203, 212, 211, 210, 208, 207, 206, 205, 203,
+212, 211, 210, 209, 208, 206, 205, 204, 213, 212, 211, 209, 208, 207, 206, 204,
+214, 213, 211, 210, 209, 207, 206, 205, 214, 213, 212, 211, 209, 208, 207, 205,
+215, 214, 213, 211, 210, 209, 207, 206, 216, 215, 214, 212, 211, 209, 208, 206,
+217, 216, 214, 213, 212, 210, 208, 207, 218, 217, 215, 214, 212, 211, 209, 208,
+219, 218, 216, 215, 213, 212, 210, 208, 220, 219, 217, 216, 214, 213, 211, 209,
+221, 220, 218, 217, 215, 214, 212, 210, 222, 221, 219, 218, 216, 215, 213, 211,
+224, 222, 221, 219, 218, 216, 214, 212, 225, 224, 222, 220, 219, 217, 215, 213,
+226, 225, 224, 222, 220, 218, 216, 214, 228, 227, 225, 224, 222, 220, 218, 216,
+229, 228, 227, 225, 224, 222, 220, 217, 231, 230, 229, 227, 225, 224, 221, 219,
+233, 232, 231, 229, 227, 226, 224, 221, 235, 234, 233, 231, 230, 228, 226, 224,
+237, 236, 235, 233, 232, 230, 228, 226, 239, 238, 237, 236, 235, 233, 231, 229,
+242, 241, 240, 239, 237, 236, 234, 232, 244, 243, 242, 241, 240, 239, 237, 236,
+246, 246, 245, 244, 243, 242, 241, 240, 249, 249, 248, 247, 247, 246, 245, 244,
+252, 251, 251, 251, 250, 250, 249, 248, 254, 254, 254, 254, 254, 254, 253, 253,
+1, 1, 1, 1, 1, 1, 2, 2, 3, 4, 4, 4, 5, 5, 6, 7,
+6, 6, 7, 8, 8, 9, 10, 11, 9, 9, 10, 11, 12, 13, 14, 15,
+11, 12, 13, 14, 15, 16, 18, 19, 13, 14, 15, 16, 18, 19, 21, 23,
+16, 17, 18, 19, 20, 22, 24, 26, 18, 19, 20, 22, 23, 25, 27, 29,
+20, 21, 22, 24, 25, 27, 29, 32, 22, 23, 24, 26, 28, 29, 32, 34,
+24, 25, 26, 28, 30, 32, 34, 36, 26, 27, 28, 30, 32, 33, 35, 38,
+27, 28, 30, 32, 33, 35, 37, 39, 29, 30, 32, 33, 35, 37, 39, 41,
+30, 32, 33, 35, 36, 38, 40, 42, 32, 33, 34, 36, 37, 39, 41, 43,
+33, 34, 36, 37, 39, 40, 42, 44, 34, 35, 37, 38, 40, 41, 43, 45,
+35, 36, 38, 39, 41, 42, 44, 46, 36, 37, 39, 40, 42, 43, 45, 47,
+37, 38, 40, 41, 43, 44, 46, 47, 38, 39, 41, 42, 43, 45, 47, 48,
+39, 40, 41, 43, 44, 46, 47, 49, 40, 41, 42, 44, 45, 46, 48, 49,
+41, 42, 43, 44, 46, 47, 48, 50, 41, 42, 44, 45, 46, 48, 49, 50,
+42, 43, 44, 46, 47, 48, 49, 51, 43, 44, 45, 46, 47, 49, 50, 51,
+43, 44, 45, 47, 48, 49, 50, 52, 44, 45, 46, 47, 48, 50, 51, 52,
+44, 45, 47, 48, 49, 50, 51, 52, 45, 46, 47, 48, 49, 50, 52, 53,
+45, 46, 47, 49, 50, 51, 52, 53, 46, 47, 48, 49, 50, 51, 52, 53,
+46, 47, 48, 49, 50, 51, 53, 54, 47, 48, 49, 50, 51, 52, 53, 54,
+47, 48, 49, 50, 51, 52, 53, 54, 48, 48, 49, 50, 51, 52, 53, 54,
+48, 49, 50, 51, 52, 53, 54, 55, 48, 49, 50, 51, 52, 53, 54, 55,
+49, 49, 50, 51, 52, 53, 54, 55, 49, 50, 51, 52, 52, 53, 54, 55,
+49, 50, 51, 52, 53, 54, 55, 55, 50, 50, 51, 52, 53, 54, 55, 56,
+50, 51, 51, 52, 53, 54, 55, 56, 50, 51, 52, 53, 53, 54, 55, 56,
+50, 51, 52, 53, 54, 54, 55, 56, 51, 51, 52, 53, 54, 55, 55, 56,
+51, 52, 52, 53, 54, 55, 56, 56, 51, 52, 53, 53, 54, 55, 56, 57,
+51, 52, 53, 54, 54, 55, 56, 57, 52, 52, 53, 54, 55, 55, 56, 57,
+52, 53, 53, 54, 55, 55, 56, 57, 52, 53, 53, 54, 55, 56, 56, 57,
+52, 53, 54, 54, 55, 56, 56, 57, 52, 53, 54, 54, 55, 56, 57, 57,
+53, 53, 54, 55, 55, 56, 57, 57, 53, 53, 54, 55, 55, 56, 57, 58,
+53, 54, 54, 55, 56, 56, 57, 58, 53, 54, 54, 55, 56, 56, 57, 58,
+53, 54, 55, 55, 56, 56, 57, 58, 53, 54, 55, 55, 56, 57, 57, 58,
+54, 54, 55, 55, 56, 57, 57, 58, 54, 54, 55, 56, 56, 57, 57, 58,
+196, 196, 195, 194, 194, 193, 192, 192, 196, 196, 195, 194, 194, 193, 192, 192,
+196, 196, 195, 194, 194, 193, 192, 192, 197, 196, 195, 195, 194, 193, 193, 192,
+197, 196, 195, 195, 194, 193, 193, 192, 197, 196, 195, 195, 194, 193, 193, 192,
+197, 196, 195, 195, 194, 193, 193, 192, 197, 196, 195, 195, 194, 193, 193, 192,
+197, 196, 196, 195, 194, 193, 193, 192, 197, 196, 196, 195, 194, 193, 193, 192,
+197, 196, 196, 195, 194, 193, 193, 192, 197, 197, 196, 195, 194, 193, 193, 192,
+197, 197, 196, 195, 194, 193, 193, 192, 198, 197, 196, 195, 194, 194, 193, 192,
+198, 197, 196, 195, 194, 194, 193, 192, 198, 197, 196, 195, 194, 194, 193, 192,
+198, 197, 196, 195, 194, 194, 193, 192, 198, 197, 196, 195, 195, 194, 193, 192,
+198, 197, 196, 196, 195, 194, 193, 192, 198, 197, 197, 196, 195, 194, 193, 192,
+198, 198, 197, 196, 195, 194, 193, 192, 199, 198, 197, 196, 195, 194, 193, 192,
+199, 198, 197, 196, 195, 194, 193, 192, 199, 198, 197, 196, 195, 194, 193, 192,
+199, 198, 197, 196, 195, 194, 193, 192, 199, 198, 197, 196, 195, 194, 193, 192,
+200, 198, 197, 196, 195, 194, 193, 192, 200, 199, 198, 196, 195, 194, 193, 192,
+200, 199, 198, 197, 196, 194, 193, 192, 200, 199, 198, 197, 196, 194, 193, 192,
+200, 199, 198, 197, 196, 195, 193, 192, 201, 200, 198, 197, 196, 195, 193, 192,
+201, 200, 199, 197, 196, 195, 193, 192, 201, 200, 199, 197, 196, 195, 194, 192,
+202, 200, 199, 198, 196, 195, 194, 192, 202, 201, 199, 198, 196, 195, 194, 192,
+202, 201, 200, 198, 197, 195, 194, 192, 203, 201, 200, 198, 197, 195, 194, 192,
+203, 202, 200, 199, 197, 195, 194, 192, 204, 202, 200, 199, 197, 196, 194, 192,
+204, 202, 201, 199, 198, 196, 194, 192, 205, 203, 201, 200, 198, 196, 194, 192,
+205, 203, 202, 200, 198, 196, 194, 192, 206, 204, 202, 200, 198, 196, 194, 192,
+206, 205, 203, 201, 199, 197, 195, 193, 207, 205, 203, 201, 199, 197, 195, 193,
+208, 206, 204, 202, 200, 197, 195, 193, 209, 207, 205, 202, 200, 198, 195, 193,
+210, 208, 205, 203, 201, 198, 195, 193, 211, 209, 206, 204, 201, 198, 196, 193,
+212, 210, 207, 205, 202, 199, 196, 193, 214, 211, 208, 206, 203, 200, 196, 193,
+215, 212, 210, 207, 204, 200, 197, 193, 217, 214, 211, 208, 205, 201, 197, 193,
+219, 216, 213, 210, 206, 202, 198, 194, 221, 218, 215, 211, 207, 203, 199, 194,
+224, 221, 217, 214, 209, 205, 200, 194, 226, 224, 220, 216, 212, 206, 201, 195,
+230, 227, 224, 219, 215, 209, 202, 195, 233, 231, 228, 224, 218, 212, 205, 196,
+238, 235, 232, 229, 224, 217, 208, 197, 242, 241, 238, 235, 230, 224, 214, 200,
+247, 246, 245, 242, 239, 233, 224, 205, 253, 252, 252, 251, 250, 247, 242, 224,
+2, 3, 3, 4, 5, 8, 13, 32, 8, 9, 10, 13, 16, 22, 32, 50,
+13, 14, 17, 20, 25, 32, 41, 55, 17, 20, 23, 26, 32, 38, 47, 58,
+22, 24, 27, 32, 37, 43, 50, 59, 25, 28, 32, 36, 40, 46, 53, 60,
+29, 32, 35, 39, 43, 49, 54, 60, 32, 34, 38, 41, 46, 50, 55, 61,
+34, 37, 40, 44, 48, 52, 56, 61, 36, 39, 42, 45, 49, 53, 57, 61,
+38, 41, 44, 47, 50, 54, 58, 62, 40, 43, 45, 48, 51, 55, 58, 62,
+41, 44, 47, 49, 52, 55, 59, 62, 43, 45, 48, 50, 53, 56, 59, 62,
+44, 46, 49, 51, 54, 57, 59, 62, 45, 47, 50, 52, 54, 57, 60, 62,
+46, 48, 50, 53, 55, 57, 60, 62, 47, 49, 51, 53, 55, 58, 60, 62,
+48, 50, 52, 54, 56, 58, 60, 62, 49, 50, 52, 54, 56, 58, 60, 62,
+49, 51, 53, 55, 57, 59, 61, 63, 50, 52, 53, 55, 57, 59, 61, 63,
+50, 52, 54, 55, 57, 59, 61, 63, 51, 53, 54, 56, 57, 59, 61, 63,
+51, 53, 55, 56, 58, 59, 61, 63, 52, 53, 55, 56, 58, 60, 61, 63,
+52, 54, 55, 57, 58, 60, 61, 63, 53, 54, 55, 57, 58, 60, 61, 63,
+53, 54, 56, 57, 59, 60, 61, 63, 53, 55, 56, 57, 59, 60, 61, 63,
+54, 55, 56, 58, 59, 60, 61, 63, 54, 55, 56, 58, 59, 60, 62, 63,
+54, 55, 57, 58, 59, 60, 62, 63, 55, 56, 57, 58, 59, 60, 62, 63,
+55, 56, 57, 58, 59, 61, 62, 63, 55, 56, 57, 58, 59, 61, 62, 63,
+55, 56, 57, 59, 60, 61, 62, 63, 55, 57, 58, 59, 60, 61, 62, 63,
+56, 57, 58, 59, 60, 61, 62, 63, 56, 57, 58, 59, 60, 61, 62, 63,
+56, 57, 58, 59, 60, 61, 62, 63, 56, 57, 58, 59, 60, 61, 62, 63,
+56, 57, 58, 59, 60, 61, 62, 63, 57, 57, 58, 59, 60, 61, 62, 63,
+57, 58, 58, 59, 60, 61, 62, 63, 57, 58, 59, 59, 60, 61, 62, 63,
+57, 58, 59, 60, 60, 61, 62, 63, 57, 58, 59, 60, 61, 61, 62, 63,
+57, 58, 59, 60, 61, 61, 62, 63, 57, 58, 59, 60, 61, 61, 62, 63,
+57, 58, 59, 60, 61, 61, 62, 63, 58, 58, 59, 60, 61, 62, 62, 63,
+58, 58, 59, 60, 61, 62, 62, 63, 58, 59, 59, 60, 61, 62, 62, 63,
+58, 59, 59, 60, 61, 62, 62, 63, 58, 59, 59, 60, 61, 62, 62, 63,
+58, 59, 60, 60, 61, 62, 62, 63, 58, 59, 60, 60, 61, 62, 62, 63,
+58, 59, 60, 60, 61, 62, 62, 63, 58, 59, 60, 60, 61, 62, 62, 63,
+58, 59, 60, 60, 61, 62, 62, 63, 59, 59, 60, 61, 61, 62, 63, 63,
+59, 59, 60, 61, 61, 62, 63, 63, 59, 59, 60, 61, 61, 62, 63, 63,
+191, 191, 190, 189, 189, 188, 187, 187, 191, 191, 190, 189, 189, 188, 187, 187,
+191, 191, 190, 189, 189, 188, 187, 187, 191, 190, 190, 189, 188, 188, 187, 186,
+191, 190, 190, 189, 188, 188, 187, 186, 191, 190, 190, 189, 188, 188, 187, 186,
+191, 190, 190, 189, 188, 188, 187, 186, 191, 190, 190, 189, 188, 188, 187, 186,
+191, 190, 190, 189, 188, 187, 187, 186, 191, 190, 190, 189, 188, 187, 187, 186,
+191, 190, 190, 189, 188, 187, 187, 186, 191, 190, 190, 189, 188, 187, 186, 186,
+191, 190, 190, 189, 188, 187, 186, 186, 191, 190, 189, 189, 188, 187, 186, 185,
+191, 190, 189, 189, 188, 187, 186, 185, 191, 190, 189, 189, 188, 187, 186, 185,
+191, 190, 189, 189, 188, 187, 186, 185, 191, 190, 189, 188, 188, 187, 186, 185,
+191, 190, 189, 188, 187, 187, 186, 185, 191, 190, 189, 188, 187, 186, 186, 185,
+191, 190, 189, 188, 187, 186, 185, 185, 191, 190, 189, 188, 187, 186, 185, 184,
+191, 190, 189, 188, 187, 186, 185, 184, 191, 190, 189, 188, 187, 186, 185, 184,
+191, 190, 189, 188, 187, 186, 185, 184, 191, 190, 189, 188, 187, 186, 185, 184,
+191, 190, 189, 188, 187, 186, 185, 183, 191, 190, 189, 188, 187, 185, 184, 183,
+191, 190, 189, 187, 186, 185, 184, 183, 191, 190, 189, 187, 186, 185, 184, 183,
+191, 190, 188, 187, 186, 185, 184, 183, 191, 190, 188, 187, 186, 185, 183, 182,
+191, 190, 188, 187, 186, 184, 183, 182, 191, 189, 188, 187, 186, 184, 183, 182,
+191, 189, 188, 187, 185, 184, 183, 181, 191, 189, 188, 187, 185, 184, 182, 181,
+191, 189, 188, 186, 185, 183, 182, 181, 191, 189, 188, 186, 185, 183, 182, 180,
+191, 189, 188, 186, 184, 183, 181, 180, 191, 189, 187, 186, 184, 183, 181, 179,
+191, 189, 187, 185, 184, 182, 181, 179, 191, 189, 187, 185, 183, 182, 180, 178,
+191, 189, 187, 185, 183, 181, 180, 178, 191, 189, 187, 185, 183, 181, 179, 177,
+190, 188, 186, 184, 182, 180, 178, 177, 190, 188, 186, 184, 182, 180, 178, 176,
+190, 188, 186, 183, 181, 179, 177, 175, 190, 188, 185, 183, 181, 178, 176, 174,
+190, 188, 185, 182, 180, 178, 175, 173, 190, 187, 185, 182, 179, 177, 174, 172,
+190, 187, 184, 181, 178, 176, 173, 171, 190, 187, 183, 180, 177, 175, 172, 169,
+190, 186, 183, 179, 176, 173, 171, 168, 190, 186, 182, 178, 175, 172, 169, 166,
+189, 185, 181, 177, 173, 170, 167, 164, 189, 184, 180, 176, 172, 168, 165, 162,
+189, 183, 178, 174, 169, 166, 162, 160, 188, 182, 177, 171, 167, 163, 160, 157,
+188, 181, 174, 168, 164, 160, 156, 153, 187, 178, 171, 165, 160, 155, 152, 150,
+186, 175, 166, 160, 154, 151, 148, 145, 183, 169, 160, 153, 148, 145, 142, 141,
+178, 160, 150, 144, 141, 138, 137, 136, 160, 141, 136, 133, 132, 131, 131, 130,
+96, 114, 119, 122, 123, 124, 124, 125, 77, 96, 105, 111, 114, 117, 118, 119,
+72, 86, 96, 102, 107, 110, 113, 114, 69, 80, 89, 96, 101, 104, 107, 110,
+68, 77, 84, 90, 96, 100, 103, 105, 67, 74, 81, 87, 91, 96, 99, 102,
+67, 73, 78, 84, 88, 92, 96, 98, 66, 72, 77, 81, 86, 89, 93, 96,
+66, 71, 75, 79, 83, 87, 90, 93, 66, 70, 74, 78, 82, 85, 88, 91,
+65, 69, 73, 77, 80, 83, 86, 89, 65, 69, 72, 76, 79, 82, 84, 87,
+65, 68, 72, 75, 78, 80, 83, 86, 65, 68, 71, 74, 77, 79, 82, 84,
+65, 68, 70, 73, 76, 78, 81, 83, 65, 67, 70, 73, 75, 77, 80, 82,
+65, 67, 70, 72, 74, 77, 79, 81, 65, 67, 69, 72, 74, 76, 78, 80,
+65, 67, 69, 71, 73, 75, 77, 79, 65, 67, 69, 71, 73, 75, 77, 78,
+64, 66, 68, 70, 72, 74, 76, 78, 64, 66, 68, 70, 72, 74, 75, 77,
+64, 66, 68, 70, 72, 73, 75, 77, 64, 66, 68, 70, 71, 73, 74, 76,
+64, 66, 68, 69, 71, 72, 74, 76, 64, 66, 67, 69, 71, 72, 74, 75,
+64, 66, 67, 69, 70, 72, 73, 75, 64, 66, 67, 69, 70, 72, 73, 74,
+64, 66, 67, 68, 70, 71, 73, 74, 64, 66, 67, 68, 70, 71, 72, 74,
+64, 66, 67, 68, 69, 71, 72, 73, 64, 65, 67, 68, 69, 71, 72, 73,
+64, 65, 67, 68, 69, 70, 72, 73, 64, 65, 67, 68, 69, 70, 71, 72,
+64, 65, 66, 68, 69, 70, 71, 72, 64, 65, 66, 68, 69, 70, 71, 72,
+64, 65, 66, 67, 68, 70, 71, 72, 64, 65, 66, 67, 68, 69, 70, 72,
+64, 65, 66, 67, 68, 69, 70, 71, 64, 65, 66, 67, 68, 69, 70, 71,
+64, 65, 66, 67, 68, 69, 70, 71, 64, 65, 66, 67, 68, 69, 70, 71,
+64, 65, 66, 67, 68, 69, 70, 71, 64, 65, 66, 67, 68, 69, 70, 70,
+64, 65, 66, 67, 68, 69, 69, 70, 64, 65, 66, 67, 68, 68, 69, 70,
+64, 65, 66, 67, 67, 68, 69, 70, 64, 65, 66, 66, 67, 68, 69, 70,
+64, 65, 66, 66, 67, 68, 69, 70, 64, 65, 66, 66, 67, 68, 69, 70,
+64, 65, 66, 66, 67, 68, 69, 70, 64, 65, 65, 66, 67, 68, 69, 69,
+64, 65, 65, 66, 67, 68, 69, 69, 64, 65, 65, 66, 67, 68, 68, 69,
+64, 65, 65, 66, 67, 68, 68, 69, 64, 65, 65, 66, 67, 68, 68, 69,
+64, 65, 65, 66, 67, 67, 68, 69, 64, 65, 65, 66, 67, 67, 68, 69,
+64, 65, 65, 66, 67, 67, 68, 69, 64, 65, 65, 66, 67, 67, 68, 69,
+64, 65, 65, 66, 67, 67, 68, 69, 64, 64, 65, 66, 66, 67, 68, 68,
+64, 64, 65, 66, 66, 67, 68, 68, 64, 64, 65, 66, 66, 67, 68, 68,
+186, 185, 185, 184, 184, 183, 182, 182, 186, 185, 185, 184, 183, 183, 182, 182,
+186, 185, 185, 184, 183, 183, 182, 181, 186, 185, 184, 184, 183, 183, 182, 181,
+186, 185, 184, 184, 183, 182, 182, 181, 186, 185, 184, 184, 183, 182, 182, 181,
+186, 185, 184, 183, 183, 182, 181, 181, 185, 185, 184, 183, 183, 182, 181, 181,
+185, 185, 184, 183, 182, 182, 181, 180, 185, 184, 184, 183, 182, 182, 181, 180,
+185, 184, 184, 183, 182, 181, 181, 180, 185, 184, 183, 183, 182, 181, 181, 180,
+185, 184, 183, 183, 182, 181, 180, 180, 185, 184, 183, 182, 182, 181, 180, 179,
+185, 184, 183, 182, 181, 181, 180, 179, 184, 184, 183, 182, 181, 180, 180, 179,
+184, 183, 183, 182, 181, 180, 179, 179, 184, 183, 182, 182, 181, 180, 179, 178,
+184, 183, 182, 181, 181, 180, 179, 178, 184, 183, 182, 181, 180, 179, 179, 178,
+184, 183, 182, 181, 180, 179, 178, 178, 183, 183, 182, 181, 180, 179, 178, 177,
+183, 182, 181, 180, 180, 179, 178, 177, 183, 182, 181, 180, 179, 178, 177, 177,
+183, 182, 181, 180, 179, 178, 177, 176, 183, 182, 181, 180, 179, 178, 177, 176,
+182, 181, 180, 179, 178, 177, 176, 176, 182, 181, 180, 179, 178, 177, 176, 175,
+182, 181, 180, 179, 178, 177, 176, 175, 182, 181, 179, 178, 177, 176, 175, 174,
+181, 180, 179, 178, 177, 176, 175, 174, 181, 180, 179, 178, 177, 175, 174, 173,
+181, 180, 178, 177, 176, 175, 174, 173, 180, 179, 178, 177, 176, 175, 173, 172,
+180, 179, 178, 176, 175, 174, 173, 172, 180, 178, 177, 176, 175, 173, 172, 171,
+179, 178, 177, 175, 174, 173, 172, 171, 179, 177, 176, 175, 174, 172, 171, 170,
+178, 177, 176, 174, 173, 172, 170, 169, 178, 176, 175, 174, 172, 171, 170, 169,
+177, 176, 174, 173, 172, 170, 169, 168, 177, 175, 174, 172, 171, 169, 168, 167,
+176, 175, 173, 171, 170, 169, 167, 166, 175, 174, 172, 171, 169, 168, 166, 165,
+175, 173, 171, 170, 168, 167, 165, 164, 174, 172, 170, 169, 167, 166, 164, 163,
+173, 171, 169, 168, 166, 165, 163, 162, 172, 170, 168, 167, 165, 164, 162, 161,
+171, 169, 167, 165, 164, 162, 161, 160, 170, 168, 166, 164, 163, 161, 160, 158,
+169, 167, 165, 163, 161, 160, 158, 157, 167, 165, 163, 161, 160, 158, 156, 155,
+166, 163, 161, 160, 158, 156, 155, 154, 164, 162, 160, 158, 156, 154, 153, 152,
+162, 160, 157, 156, 154, 152, 151, 150, 160, 157, 155, 153, 152, 150, 149, 148,
+157, 155, 153, 151, 150, 148, 147, 146, 154, 152, 150, 148, 147, 146, 145, 144,
+151, 149, 147, 146, 144, 143, 142, 141, 147, 146, 144, 143, 142, 141, 140, 139,
+143, 142, 141, 140, 139, 138, 137, 137, 139, 138, 137, 136, 136, 135, 134, 134,
+135, 134, 133, 133, 132, 132, 132, 131, 130, 130, 129, 129, 129, 129, 129, 129,
+125, 125, 126, 126, 126, 126, 126, 126, 120, 121, 122, 122, 123, 123, 123, 124,
+116, 117, 118, 119, 119, 120, 121, 121, 112, 113, 114, 115, 116, 117, 118, 118,
+108, 109, 111, 112, 113, 114, 115, 116, 104, 106, 108, 109, 111, 112, 113, 114,
+101, 103, 105, 107, 108, 109, 110, 111, 98, 100, 102, 104, 105, 107, 108, 109,
+96, 98, 100, 102, 103, 105, 106, 107, 93, 96, 98, 99, 101, 103, 104, 105,
+91, 93, 96, 97, 99, 101, 102, 103, 89, 92, 94, 96, 97, 99, 100, 101,
+88, 90, 92, 94, 96, 97, 99, 100, 86, 88, 90, 92, 94, 96, 97, 98,
+85, 87, 89, 91, 92, 94, 96, 97, 84, 86, 88, 90, 91, 93, 94, 96,
+83, 85, 87, 88, 90, 91, 93, 94, 82, 84, 86, 87, 89, 90, 92, 93,
+81, 83, 85, 86, 88, 89, 91, 92, 80, 82, 84, 85, 87, 88, 90, 91,
+80, 81, 83, 84, 86, 87, 89, 90, 79, 80, 82, 84, 85, 86, 88, 89,
+78, 80, 81, 83, 84, 86, 87, 88, 78, 79, 81, 82, 83, 85, 86, 87,
+77, 79, 80, 81, 83, 84, 85, 86, 77, 78, 79, 81, 82, 83, 85, 86,
+76, 78, 79, 80, 81, 83, 84, 85, 76, 77, 78, 80, 81, 82, 83, 84,
+75, 77, 78, 79, 80, 82, 83, 84, 75, 76, 77, 79, 80, 81, 82, 83,
+75, 76, 77, 78, 79, 80, 82, 83, 74, 75, 77, 78, 79, 80, 81, 82,
+74, 75, 76, 77, 78, 80, 81, 82, 74, 75, 76, 77, 78, 79, 80, 81,
+73, 74, 76, 77, 78, 79, 80, 81, 73, 74, 75, 76, 77, 78, 79, 80,
+73, 74, 75, 76, 77, 78, 79, 80, 73, 74, 75, 76, 77, 78, 79, 79,
+72, 73, 74, 75, 76, 77, 78, 79, 72, 73, 74, 75, 76, 77, 78, 79,
+72, 73, 74, 75, 76, 77, 78, 78, 72, 73, 74, 75, 75, 76, 77, 78,
+72, 72, 73, 74, 75, 76, 77, 78, 71, 72, 73, 74, 75, 76, 77, 77,
+71, 72, 73, 74, 75, 76, 76, 77, 71, 72, 73, 74, 74, 75, 76, 77,
+71, 72, 73, 73, 74, 75, 76, 77, 71, 72, 72, 73, 74, 75, 76, 76,
+71, 71, 72, 73, 74, 75, 75, 76, 70, 71, 72, 73, 74, 74, 75, 76,
+70, 71, 72, 73, 73, 74, 75, 76, 70, 71, 72, 72, 73, 74, 75, 75,
+70, 71, 72, 72, 73, 74, 74, 75, 70, 71, 71, 72, 73, 74, 74, 75,
+70, 71, 71, 72, 73, 73, 74, 75, 70, 70, 71, 72, 73, 73, 74, 75,
+70, 70, 71, 72, 72, 73, 74, 74, 69, 70, 71, 72, 72, 73, 74, 74,
+69, 70, 71, 71, 72, 73, 73, 74, 69, 70, 71, 71, 72, 73, 73, 74,
+69, 70, 71, 71, 72, 72, 73, 74, 69, 70, 70, 71, 72, 72, 73, 74,
+69, 70, 70, 71, 72, 72, 73, 73, 69, 70, 70, 71, 71, 72, 73, 73,
+181, 181, 180, 179, 179, 178, 178, 177, 181, 180, 180, 179, 179, 178, 177, 177,
+181, 180, 180, 179, 178, 178, 177, 177, 181, 180, 179, 179, 178, 178, 177, 176,
+180, 180, 179, 179, 178, 177, 177, 176, 180, 180, 179, 178, 178, 177, 177, 176,
+180, 179, 179, 178, 178, 177, 176, 176, 180, 179, 179, 178, 177, 177, 176, 175,
+180, 179, 178, 178, 177, 176, 176, 175, 180, 179, 178, 178, 177, 176, 176, 175,
+179, 179, 178, 177, 177, 176, 175, 175, 179, 178, 178, 177, 176, 176, 175, 174,
+179, 178, 177, 177, 176, 175, 175, 174, 179, 178, 177, 176, 176, 175, 174, 174,
+178, 178, 177, 176, 176, 175, 174, 173, 178, 177, 177, 176, 175, 174, 174, 173,
+178, 177, 176, 176, 175, 174, 173, 173, 178, 177, 176, 175, 175, 174, 173, 172,
+177, 177, 176, 175, 174, 174, 173, 172, 177, 176, 175, 175, 174, 173, 172, 172,
+177, 176, 175, 174, 174, 173, 172, 171, 176, 176, 175, 174, 173, 172, 172, 171,
+176, 175, 174, 174, 173, 172, 171, 171, 176, 175, 174, 173, 172, 172, 171, 170,
+175, 175, 174, 173, 172, 171, 170, 170, 175, 174, 173, 172, 172, 171, 170, 169,
+175, 174, 173, 172, 171, 170, 169, 169, 174, 173, 172, 172, 171, 170, 169, 168,
+174, 173, 172, 171, 170, 169, 168, 168, 173, 172, 171, 171, 170, 169, 168, 167,
+173, 172, 171, 170, 169, 168, 167, 167, 172, 171, 170, 169, 169, 168, 167, 166,
+172, 171, 170, 169, 168, 167, 166, 165, 171, 170, 169, 168, 167, 166, 166, 165,
+171, 170, 169, 168, 167, 166, 165, 164, 170, 169, 168, 167, 166, 165, 164, 163,
+169, 168, 167, 166, 165, 164, 164, 163, 169, 168, 167, 166, 165, 164, 163, 162,
+168, 167, 166, 165, 164, 163, 162, 161, 167, 166, 165, 164, 163, 162, 161, 160,
+167, 165, 164, 163, 162, 161, 160, 160, 166, 165, 163, 162, 161, 160, 160, 159,
+165, 164, 163, 161, 160, 160, 159, 158, 164, 163, 162, 161, 160, 159, 158, 157,
+163, 162, 161, 160, 158, 158, 157, 156, 162, 161, 160, 158, 157, 156, 156, 155,
+161, 160, 158, 157, 156, 155, 154, 154, 160, 158, 157, 156, 155, 154, 153, 152,
+158, 157, 156, 155, 154, 153, 152, 151, 157, 156, 155, 154, 153, 152, 151, 150,
+155, 154, 153, 152, 151, 150, 150, 149, 154, 153, 152, 151, 150, 149, 148, 147,
+152, 151, 150, 149, 148, 148, 147, 146, 151, 150, 149, 148, 147, 146, 145, 145,
+149, 148, 147, 146, 145, 144, 144, 143, 147, 146, 145, 144, 144, 143, 142, 142,
+145, 144, 143, 142, 142, 141, 141, 140, 143, 142, 141, 141, 140, 139, 139, 138,
+141, 140, 139, 139, 138, 138, 137, 137, 138, 138, 137, 137, 136, 136, 136, 135,
+136, 136, 135, 135, 134, 134, 134, 134, 134, 133, 133, 133, 132, 132, 132, 132,
+131, 131, 131, 131, 130, 130, 130, 130, 129, 129, 129, 129, 128, 128, 128, 128,
+126, 126, 126, 126, 127, 127, 127, 127, 124, 124, 124, 124, 125, 125, 125, 125,
+121, 122, 122, 122, 123, 123, 123, 123, 119, 119, 120, 120, 121, 121, 121, 121,
+117, 117, 118, 118, 119, 119, 119, 120, 114, 115, 116, 116, 117, 117, 118, 118,
+112, 113, 114, 114, 115, 116, 116, 117, 110, 111, 112, 113, 113, 114, 114, 115,
+108, 109, 110, 111, 111, 112, 113, 113, 106, 107, 108, 109, 110, 111, 111, 112,
+104, 105, 106, 107, 108, 109, 110, 110, 103, 104, 105, 106, 107, 107, 108, 109,
+101, 102, 103, 104, 105, 106, 107, 108, 100, 101, 102, 103, 104, 105, 105, 106,
+98, 99, 100, 101, 102, 103, 104, 105, 97, 98, 99, 100, 101, 102, 103, 104,
+96, 97, 98, 99, 100, 101, 102, 103, 94, 96, 97, 98, 99, 100, 101, 101,
+93, 94, 96, 97, 98, 99, 99, 100, 92, 93, 94, 96, 97, 97, 98, 99,
+91, 92, 93, 94, 96, 96, 97, 98, 90, 91, 92, 94, 95, 96, 96, 97,
+89, 90, 92, 93, 94, 95, 96, 96, 88, 90, 91, 92, 93, 94, 95, 96,
+88, 89, 90, 91, 92, 93, 94, 95, 87, 88, 89, 90, 91, 92, 93, 94,
+86, 87, 88, 89, 90, 91, 92, 93, 86, 87, 88, 89, 90, 91, 91, 92,
+85, 86, 87, 88, 89, 90, 91, 92, 84, 85, 86, 87, 88, 89, 90, 91,
+84, 85, 86, 87, 88, 89, 89, 90, 83, 84, 85, 86, 87, 88, 89, 90,
+83, 84, 85, 86, 86, 87, 88, 89, 82, 83, 84, 85, 86, 87, 88, 88,
+82, 83, 84, 84, 85, 86, 87, 88, 81, 82, 83, 84, 85, 86, 87, 87,
+81, 82, 83, 83, 84, 85, 86, 87, 80, 81, 82, 83, 84, 85, 86, 86,
+80, 81, 82, 83, 83, 84, 85, 86, 80, 80, 81, 82, 83, 84, 85, 85,
+79, 80, 81, 82, 83, 83, 84, 85, 79, 80, 81, 81, 82, 83, 84, 84,
+79, 79, 80, 81, 82, 83, 83, 84, 78, 79, 80, 81, 81, 82, 83, 84,
+78, 79, 80, 80, 81, 82, 83, 83, 78, 78, 79, 80, 81, 81, 82, 83,
+77, 78, 79, 80, 80, 81, 82, 83, 77, 78, 79, 79, 80, 81, 82, 82,
+77, 78, 78, 79, 80, 81, 81, 82, 77, 77, 78, 79, 79, 80, 81, 82,
+76, 77, 78, 79, 79, 80, 81, 81, 76, 77, 78, 78, 79, 80, 80, 81,
+76, 77, 77, 78, 79, 79, 80, 81, 76, 76, 77, 78, 78, 79, 80, 80,
+75, 76, 77, 77, 78, 79, 79, 80, 75, 76, 77, 77, 78, 79, 79, 80,
+75, 76, 76, 77, 78, 78, 79, 80, 75, 76, 76, 77, 77, 78, 79, 79,
+75, 75, 76, 77, 77, 78, 78, 79, 75, 75, 76, 76, 77, 78, 78, 79,
+74, 75, 76, 76, 77, 77, 78, 79, 74, 75, 75, 76, 77, 77, 78, 78,
+74, 75, 75, 76, 76, 77, 78, 78, 74, 74, 75, 76, 76, 77, 77, 78,
+176, 176, 175, 175, 174, 174, 173, 173, 176, 176, 175, 175, 174, 174, 173, 172,
+176, 175, 175, 174, 174, 173, 173, 172, 176, 175, 175, 174, 174, 173, 172, 172,
+176, 175, 174, 174, 173, 173, 172, 172, 175, 175, 174, 174, 173, 172, 172, 171,
+175, 174, 174, 173, 173, 172, 172, 171, 175, 174, 174, 173, 172, 172, 171, 171,
+175, 174, 173, 173, 172, 172, 171, 170, 174, 174, 173, 172, 172, 171, 171, 170,
+174, 173, 173, 172, 172, 171, 170, 170, 174, 173, 172, 172, 171, 171, 170, 169,
+173, 173, 172, 172, 171, 170, 170, 169, 173, 172, 172, 171, 171, 170, 169, 169,
+173, 172, 171, 171, 170, 170, 169, 168, 172, 172, 171, 170, 170, 169, 169, 168,
+172, 171, 171, 170, 169, 169, 168, 168, 172, 171, 170, 170, 169, 168, 168, 167,
+171, 171, 170, 169, 169, 168, 167, 167, 171, 170, 170, 169, 168, 168, 167, 166,
+171, 170, 169, 169, 168, 167, 167, 166, 170, 169, 169, 168, 167, 167, 166, 166,
+170, 169, 168, 168, 167, 166, 166, 165, 169, 169, 168, 167, 167, 166, 165, 165,
+169, 168, 167, 167, 166, 165, 165, 164, 168, 168, 167, 166, 166, 165, 164, 164,
+168, 167, 166, 166, 165, 164, 164, 163, 167, 167, 166, 165, 164, 164, 163, 162,
+167, 166, 165, 165, 164, 163, 163, 162, 166, 166, 165, 164, 163, 163, 162, 161,
+166, 165, 164, 163, 163, 162, 161, 161, 165, 164, 164, 163, 162, 161, 161, 160,
+165, 164, 163, 162, 162, 161, 160, 160, 164, 163, 162, 162, 161, 160, 160, 159,
+163, 162, 162, 161, 160, 160, 159, 158, 163, 162, 161, 160, 160, 159, 158, 157,
+162, 161, 160, 160, 159, 158, 157, 157, 161, 160, 160, 159, 158, 157, 157, 156,
+160, 160, 159, 158, 157, 157, 156, 155, 160, 159, 158, 157, 156, 156, 155, 154,
+159, 158, 157, 156, 156, 155, 154, 154, 158, 157, 156, 155, 155, 154, 153, 153,
+157, 156, 155, 155, 154, 153, 153, 152, 156, 155, 154, 154, 153, 152, 152, 151,
+155, 154, 153, 153, 152, 151, 151, 150, 154, 153, 152, 152, 151, 150, 150, 149,
+153, 152, 151, 151, 150, 149, 149, 148, 152, 151, 150, 150, 149, 148, 148, 147,
+150, 150, 149, 148, 148, 147, 147, 146, 149, 149, 148, 147, 147, 146, 146, 145,
+148, 147, 147, 146, 146, 145, 144, 144, 147, 146, 145, 145, 144, 144, 143, 143,
+145, 145, 144, 144, 143, 143, 142, 142, 144, 143, 143, 142, 142, 141, 141, 141,
+143, 142, 142, 141, 141, 140, 140, 139, 141, 141, 140, 140, 139, 139, 139, 138,
+140, 139, 139, 138, 138, 138, 137, 137, 138, 138, 137, 137, 137, 136, 136, 136,
+136, 136, 136, 136, 135, 135, 135, 135, 135, 135, 134, 134, 134, 134, 133, 133,
+133, 133, 133, 133, 132, 132, 132, 132, 132, 131, 131, 131, 131, 131, 131, 131,
+130, 130, 130, 130, 130, 130, 130, 129, 128, 128, 128, 128, 128, 128, 128, 128,
+127, 127, 127, 127, 127, 127, 127, 127, 125, 125, 125, 125, 125, 125, 125, 126,
+123, 124, 124, 124, 124, 124, 124, 124, 122, 122, 122, 122, 123, 123, 123, 123,
+120, 120, 121, 121, 121, 121, 122, 122, 119, 119, 119, 119, 120, 120, 120, 120,
+117, 117, 118, 118, 118, 119, 119, 119, 115, 116, 116, 117, 117, 117, 118, 118,
+114, 114, 115, 115, 116, 116, 116, 117, 112, 113, 113, 114, 114, 115, 115, 116,
+111, 112, 112, 113, 113, 114, 114, 114, 110, 110, 111, 111, 112, 112, 113, 113,
+108, 109, 110, 110, 111, 111, 112, 112, 107, 108, 108, 109, 109, 110, 111, 111,
+106, 106, 107, 108, 108, 109, 109, 110, 105, 105, 106, 107, 107, 108, 108, 109,
+103, 104, 105, 105, 106, 107, 107, 108, 102, 103, 104, 104, 105, 106, 106, 107,
+101, 102, 103, 103, 104, 105, 105, 106, 100, 101, 102, 102, 103, 104, 104, 105,
+99, 100, 101, 101, 102, 103, 103, 104, 98, 99, 100, 100, 101, 102, 102, 103,
+97, 98, 99, 100, 100, 101, 102, 102, 96, 97, 98, 99, 99, 100, 101, 101,
+96, 96, 97, 98, 99, 99, 100, 101, 95, 96, 96, 97, 98, 98, 99, 100,
+94, 95, 96, 96, 97, 98, 98, 99, 93, 94, 95, 96, 96, 97, 98, 98,
+92, 93, 94, 95, 96, 96, 97, 98, 92, 93, 93, 94, 95, 96, 96, 97,
+91, 92, 93, 93, 94, 95, 96, 96, 90, 91, 92, 93, 93, 94, 95, 96,
+90, 91, 91, 92, 93, 94, 94, 95, 89, 90, 91, 92, 92, 93, 94, 94,
+89, 89, 90, 91, 92, 92, 93, 94, 88, 89, 90, 90, 91, 92, 92, 93,
+88, 88, 89, 90, 91, 91, 92, 93, 87, 88, 89, 89, 90, 91, 91, 92,
+87, 87, 88, 89, 89, 90, 91, 91, 86, 87, 88, 88, 89, 90, 90, 91,
+86, 86, 87, 88, 88, 89, 90, 90, 85, 86, 87, 87, 88, 89, 89, 90,
+85, 86, 86, 87, 88, 88, 89, 89, 84, 85, 86, 86, 87, 88, 88, 89,
+84, 85, 85, 86, 87, 87, 88, 89, 84, 84, 85, 86, 86, 87, 88, 88,
+83, 84, 85, 85, 86, 87, 87, 88, 83, 84, 84, 85, 86, 86, 87, 87,
+83, 83, 84, 85, 85, 86, 86, 87, 82, 83, 84, 84, 85, 85, 86, 87,
+82, 83, 83, 84, 84, 85, 86, 86, 82, 82, 83, 83, 84, 85, 85, 86,
+81, 82, 83, 83, 84, 84, 85, 86, 81, 82, 82, 83, 83, 84, 85, 85,
+81, 81, 82, 83, 83, 84, 84, 85, 80, 81, 82, 82, 83, 83, 84, 85,
+80, 81, 81, 82, 83, 83, 84, 84, 80, 81, 81, 82, 82, 83, 83, 84,
+80, 80, 81, 81, 82, 83, 83, 84, 79, 80, 81, 81, 82, 82, 83, 83,
+79, 80, 80, 81, 81, 82, 83, 83, 79, 80, 80, 81, 81, 82, 82, 83,
+79, 79, 80, 80, 81, 81, 82, 83, 79, 79, 80, 80, 81, 81, 82, 82,
+};
+static const RevealMap revealSweep = {revealSweepRanks, 0, 256};
+
+// 8x8 ordered dither, 64 levels
+alignas(4) static const uint8_t revealFadeRanks[] = {
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+0, 48, 12, 60, 3, 51, 15, 63, 32, 16, 44, 28, 35, 19, 47, 31,
+8, 56, 4, 52, 11, 59, 7, 55, 40, 24, 36, 20, 43, 27, 39, 23,
+2, 50, 14, 62, 1, 49, 13, 61, 34, 18, 46, 30, 33, 17, 45, 29,
+10, 58, 6, 54, 9, 57, 5, 53, 42, 26, 38, 22, 41, 25, 37, 21,
+};
+static const RevealMap revealFade = {revealFadeRanks, 0, 64};
+
+// Every pixel in random order
+alignas(4) static const uint8_t revealDissolveRanks[] = {
+216, 146, 181, 14, 34, 195, 10, 14, 145, 13, 140, 206, 153, 122, 54, 134,
+21, 109, 80, 245, 196, 212, 195, 168, 180, 65, 153, 102, 244, 60, 238, 120,
+240, 98, 54, 134, 114, 113, 64, 159, 26, 78, 68, 125, 64, 46, 107, 70,
+48, 192, 127, 137, 87, 18, 35, 195, 205, 98, 187, 21, 1, 99, 229, 190,
+128, 164, 185, 204, 27, 35, 51, 73, 88, 54, 224, 23, 147, 147, 196, 177,
+221, 121, 36, 216, 240, 192, 98, 181, 205, 177, 38, 253, 3, 17, 250, 225,
+24, 123, 55, 97, 136, 60, 112, 88, 109, 33, 139, 46, 41, 96, 5, 107,
+238, 227, 68, 149, 108, 188, 212, 58, 107, 221, 45, 155, 79, 126, 209, 129,
+141, 236, 81, 241, 114, 225, 204, 193, 209, 144, 179, 93, 171, 203, 17, 254,
+64, 73, 38, 121, 53, 8, 163, 131, 62, 4, 15, 110, 10, 181, 182, 213,
+233, 183, 55, 215, 58, 106, 132, 245, 47, 164, 59, 68, 12, 84, 78, 223,
+202, 86, 115, 10, 208, 152, 191, 137, 14, 120, 155, 204, 171, 44, 63, 94,
+187, 197, 15, 203, 177, 147, 116, 200, 17, 23, 179, 124, 172, 168, 42, 215,
+49, 27, 74, 31, 38, 137, 81, 128, 15, 24, 239, 76, 236, 33, 251, 152,
+234, 172, 136, 180, 35, 88, 95, 61, 143, 70, 28, 254, 145, 211, 33, 126,
+238, 121, 216, 179, 241, 219, 14, 247, 234, 149, 201, 39, 90, 140, 161, 220,
+200, 157, 142, 223, 55, 105, 197, 211, 242, 179, 230, 240, 2, 159, 180, 2,
+7, 97, 236, 137, 209, 23, 107, 109, 76, 93, 87, 31, 47, 22, 27, 248,
+45, 241, 147, 153, 13, 208, 220, 67, 243, 151, 130, 240, 126, 53, 211, 49,
+223, 109, 248, 18, 232, 190, 215, 162, 31, 15, 174, 62, 121, 208, 246, 61,
+124, 51, 159, 160, 168, 57, 206, 97, 49, 142, 232, 79, 53, 241, 185, 237,
+61, 138, 84, 254, 41, 233, 96, 173, 233, 87, 61, 7, 226, 190, 205, 67,
+159, 156, 122, 196, 204, 191, 188, 4, 115, 210, 22, 124, 73, 74, 50, 158,
+32, 204, 137, 138, 221, 103, 112, 151, 168, 42, 232, 49, 189, 21, 134, 230,
+1, 36, 186, 169, 186, 68, 2, 124, 81, 147, 60, 176, 146, 87, 62, 111,
+108, 132, 189, 4, 115, 208, 14, 157, 81, 102, 23, 20, 234, 85, 203, 55,
+54, 1, 192, 208, 149, 234, 70, 4, 145, 47, 12, 155, 120, 186, 214, 90,
+55, 147, 130, 39, 81, 231, 55, 158, 109, 91, 174, 85, 191, 26, 69, 117,
+223, 170, 109, 248, 124, 122, 192, 200, 79, 92, 1, 35, 95, 222, 50, 202,
+208, 77, 3, 106, 134, 72, 213, 84, 110, 155, 244, 216, 125, 103, 155, 113,
+185, 180, 26, 110, 157, 118, 219, 43, 193, 234, 201, 152, 109, 68, 25, 218,
+85, 192, 136, 72, 190, 87, 129, 105, 30, 5, 71, 97, 125, 201, 179, 117,
+155, 237, 93, 88, 131, 50, 46, 51, 97, 221, 188, 178, 67, 57, 82, 89,
+240, 140, 32, 228, 186, 152, 191, 209, 206, 89, 233, 131, 64, 175, 110, 76,
+253, 4, 105, 51, 18, 240, 241, 100, 187, 149, 43, 146, 29, 123, 139, 178,
+43, 14, 146, 36, 143, 6, 10, 61, 158, 123, 10, 203, 76, 66, 21, 185,
+116, 231, 173, 92, 146, 138, 252, 90, 64, 239, 91, 168, 10, 94, 177, 69,
+94, 44, 133, 151, 154, 198, 61, 98, 75, 186, 53, 19, 46, 185, 210, 120,
+69, 15, 242, 224, 97, 208, 45, 210, 219, 250, 170, 254, 234, 117, 17, 220,
+130, 89, 46, 81, 240, 32, 197, 230, 49, 20, 86, 167, 176, 109, 251, 178,
+196, 33, 209, 155, 64, 238, 81, 25, 175, 203, 7, 87, 98, 7, 24, 223,
+127, 24, 58, 43, 146, 31, 88, 185, 213, 58, 89, 176, 119, 87, 122, 31,
+87, 199, 155, 63, 56, 69, 222, 139, 202, 62, 173, 205, 178, 111, 243, 235,
+245, 20, 144, 32, 134, 235, 158, 56, 121, 92, 4, 40, 91, 234, 60, 50,
+180, 119, 253, 221, 175, 182, 32, 145, 138, 26, 11, 174, 176, 87, 225, 134,
+182, 156, 16, 45, 18, 173, 146, 163, 114, 142, 98, 17, 154, 92, 135, 134,
+90, 208, 19, 103, 147, 151, 219, 205, 139, 137, 182, 65, 116, 68, 61, 40,
+147, 120, 66, 194, 180, 137, 16, 45, 18, 251, 227, 131, 75, 20, 79, 32,
+5, 196, 12, 201, 210, 135, 186, 215, 0, 232, 125, 3, 141, 182, 57, 230,
+103, 231, 218, 215, 65, 226, 216, 46, 33, 224, 49, 215, 147, 176, 16, 12,
+33, 156, 162, 241, 156, 110, 6, 174, 241, 74, 184, 32, 155, 18, 152, 56,
+83, 185, 4, 79, 146, 185, 240, 18, 211, 127, 140, 197, 45, 173, 129, 131,
+148, 58, 209, 117, 60, 241, 253, 175, 44, 141, 231, 32, 97, 63, 203, 193,
+41, 191, 9, 69, 45, 95, 73, 64, 82, 248, 173, 175, 207, 25, 212, 247,
+11, 156, 226, 97, 56, 76, 113, 200, 36, 48, 208, 65, 21, 22, 110, 163,
+214, 56, 27, 3, 190, 152, 150, 116, 184, 214, 62, 101, 141, 179, 67, 98,
+107, 129, 247, 138, 233, 82, 157, 204, 80, 30, 18, 119, 21, 112, 251, 131,
+21, 226, 210, 65, 173, 196, 207, 200, 189, 221, 155, 82, 100, 224, 208, 12,
+10, 227, 132, 4, 48, 221, 66, 53, 95, 13, 7, 132, 98, 202, 225, 190,
+146, 48, 40, 79, 203, 246, 252, 60, 233, 195, 117, 17, 45, 131, 28, 104,
+152, 157, 102, 102, 207, 23, 38, 163, 120, 115, 172, 26, 102, 7, 18, 166,
+49, 226, 162, 117, 128, 158, 33, 125, 114, 72, 169, 42, 25, 47, 124, 242,
+250, 173, 76, 137, 45, 201, 134, 74, 90, 42, 187, 252, 7, 187, 112, 95,
+21, 158, 104, 172, 121, 90, 188, 25, 172, 127, 143, 150, 75, 17, 226, 89,
+203, 219, 162, 67, 152, 243, 230, 194, 74, 188, 155, 135, 115, 54, 86, 137,
+76, 232, 111, 248, 134, 79, 9, 107, 208, 245, 39, 223, 148, 141, 59, 194,
+111, 114, 75, 219, 202, 118, 1, 241, 128, 215, 22, 227, 97, 86, 191, 42,
+231, 104, 222, 206, 8, 73, 163, 124, 167, 117, 168, 39, 37, 55, 158, 208,
+244, 39, 68, 24, 211, 13, 85, 148, 181, 212, 154, 33, 88, 15, 109, 111,
+180, 2, 159, 91, 221, 89, 36, 141, 122, 70, 144, 70, 147, 251, 104, 164,
+171, 84, 58, 62, 155, 120, 128, 157, 225, 3, 63, 188, 74, 148, 135, 31,
+30, 59, 67, 159, 241, 129, 149, 202, 106, 254, 182, 100, 186, 88, 174, 48,
+51, 20, 164, 30, 11, 252, 248, 98, 245, 165, 51, 136, 2, 225, 26, 77,
+20, 222, 226, 148, 128, 73, 245, 30, 193, 137, 211, 49, 197, 141, 255, 15,
+89, 122, 68, 210, 200, 138, 167, 206, 170, 84, 153, 66, 161, 34, 210, 148,
+173, 172, 161, 154, 97, 211, 200, 131, 75, 54, 180, 84, 205, 176, 103, 251,
+71, 0, 203, 165, 247, 146, 120, 152, 222, 9, 205, 154, 161, 250, 35, 253,
+10, 169, 75, 152, 25, 21, 249, 73, 214, 45, 192, 42, 111, 23, 137, 127,
+71, 162, 34, 105, 124, 164, 127, 82, 205, 76, 15, 246, 235, 184, 253, 143,
+69, 47, 108, 156, 220, 12, 63, 25, 209, 199, 14, 1, 222, 8, 46, 224,
+219, 180, 235, 16, 199, 113, 29, 218, 111, 38, 63, 192, 221, 253, 170, 245,
+128, 222, 29, 36, 8, 25, 186, 247, 162, 62, 224, 20, 247, 48, 246, 32,
+79, 105, 221, 106, 147, 72, 116, 14, 169, 189, 125, 165, 205, 158, 57, 146,
+13, 103, 140, 91, 228, 77, 147, 202, 150, 63, 161, 27, 99, 130, 254, 207,
+176, 98, 0, 235, 213, 249, 3, 236, 127, 42, 15, 120, 79, 93, 75, 78,
+125, 62, 59, 132, 43, 252, 38, 173, 216, 228, 60, 69, 14, 16, 69, 145,
+24, 251, 78, 212, 16, 38, 119, 54, 67, 132, 161, 186, 47, 82, 0, 197,
+85, 51, 94, 144, 23, 166, 179, 47, 210, 0, 251, 175, 227, 168, 7, 11,
+173, 174, 132, 163, 82, 230, 142, 139, 125, 133, 4, 63, 17, 55, 89, 34,
+53, 44, 167, 52, 84, 30, 112, 212, 252, 83, 122, 209, 79, 251, 201, 132,
+250, 167, 237, 182, 110, 213, 140, 70, 183, 191, 79, 65, 190, 71, 35, 29,
+250, 238, 37, 182, 139, 226, 185, 16, 253, 229, 131, 122, 35, 220, 244, 130,
+96, 132, 131, 92, 196, 81, 11, 14, 49, 100, 41, 114, 244, 201, 136, 83,
+226, 181, 188, 131, 254, 82, 10, 49, 73, 156, 224, 101, 108, 128, 235, 193,
+112, 107, 161, 15, 63, 123, 61, 144, 168, 102, 248, 15, 114, 72, 49, 117,
+89, 224, 222, 106, 142, 80, 237, 13, 115, 187, 131, 137, 99, 73, 77, 176,
+216, 62, 193, 194, 138, 100, 72, 254, 59, 42, 0, 104, 79, 74, 58, 187,
+107, 227, 191, 214, 58, 239, 86, 223, 180, 217, 242, 214, 0, 117, 147, 4,
+7, 228, 104, 91, 23, 101, 201, 181, 122, 13, 142, 1, 86, 139, 40, 57,
+126, 246, 92, 123, 255, 62, 206, 40, 184, 16, 39, 107, 166, 90, 82, 101,
+202, 138, 238, 58, 171, 201, 131, 201, 187, 224, 40, 241, 124, 52, 246, 133,
+14, 89, 43, 28, 128, 186, 235, 144, 250, 33, 83, 116, 44, 174, 48, 35,
+91, 43, 30, 194, 251, 116, 15, 35, 159, 203, 46, 43, 252, 230, 243, 152,
+227, 48, 76, 69, 61, 207, 83, 179, 86, 135, 18, 209, 124, 43, 88, 183,
+110, 205, 159, 144, 162, 236, 88, 26, 107, 149, 144, 50, 122, 202, 180, 160,
+148, 133, 27, 181, 65, 150, 0, 42, 55, 128, 104, 146, 31, 222, 10, 149,
+99, 234, 225, 184, 161, 43, 233, 9, 105, 65, 65, 7, 40, 243, 0, 75,
+34, 67, 28, 34, 9, 208, 6, 177, 242, 109, 4, 95, 40, 80, 13, 131,
+197, 76, 181, 207, 64, 61, 67, 93, 42, 153, 83, 43, 132, 226, 76, 214,
+121, 90, 134, 142, 54, 25, 155, 212, 114, 161, 29, 149, 27, 201, 162, 25,
+56, 184, 229, 12, 85, 19, 139, 73, 47, 148, 5, 44, 103, 157, 93, 46,
+222, 120, 187, 62, 184, 42, 71, 158, 92, 103, 98, 184, 95, 130, 41, 48,
+128, 7, 237, 169, 47, 8, 235, 31, 198, 219, 109, 128, 135, 242, 61, 91,
+241, 212, 87, 110, 100, 90, 32, 154, 33, 245, 61, 147, 130, 217, 185, 80,
+168, 79, 49, 194, 193, 225, 211, 208, 70, 106, 207, 85, 150, 156, 18, 20,
+243, 236, 66, 198, 16, 2, 22, 237, 238, 173, 137, 217, 178, 237, 137, 116,
+145, 92, 142, 88, 123, 240, 27, 238, 73, 247, 227, 18, 226, 48, 213, 77,
+242, 155, 134, 56, 176, 231, 219, 110, 29, 144, 109, 121, 27, 221, 98, 111,
+136, 31, 105, 26, 104, 49, 113, 143, 181, 116, 99, 28, 65, 66, 120, 119,
+152, 193, 77, 18, 184, 134, 45, 133, 96, 26, 241, 99, 88, 91, 224, 156,
+223, 156, 9, 168, 196, 146, 100, 252, 17, 5, 139, 35, 78, 232, 231, 81,
+98, 227, 124, 68, 152, 89, 162, 114, 173, 22, 73, 70, 252, 105, 245, 10,
+84, 168, 210, 4, 78, 83, 13, 240, 237, 76, 116, 222, 19, 230, 184, 112,
+118, 56, 222, 224, 98, 205, 21, 252, 108, 123, 58, 205, 214, 186, 70, 11,
+122, 204, 214, 6, 28, 199, 238, 208, 11, 115, 144, 194, 55, 92, 48, 119,
+172, 237, 36, 83, 37, 48, 210, 213, 47, 89, 210, 94, 13, 51, 217, 160,
+45, 196, 7, 163, 31, 140, 253, 101, 183, 115, 111, 154, 202, 26, 39, 30,
+45, 118, 186, 158, 117, 11, 28, 136, 66, 194, 101, 91, 25, 204, 56, 250,
+35, 127, 193, 139, 252, 86, 254, 162, 145, 213, 180, 70, 101, 55, 133, 8,
+248, 163, 221, 180, 228, 172, 252, 18, 132, 95, 207, 123, 48, 223, 143, 3,
+254, 214, 239, 101, 18, 24, 218, 179, 9, 134, 231, 169, 140, 0, 40, 76,
+11, 104, 169, 80, 2, 140, 171, 184, 94, 9, 252, 180, 188, 6, 248, 151,
+183, 78, 220, 217, 123, 249, 65, 168, 37, 115, 47, 171, 116, 93, 255, 92,
+184, 171, 80, 106, 59, 105, 174, 107, 35, 156, 102, 114, 34, 37, 215, 215,
+6, 221, 86, 94, 204, 222, 24, 137, 13, 138, 194, 242, 224, 62, 178, 46,
+118, 7, 104, 180, 204, 170, 209, 60, 53, 126, 108, 185, 244, 205, 101, 135,
+32, 250, 77, 106, 141, 81, 80, 155, 115, 157, 206, 244, 218, 205, 224, 126,
+64, 38, 255, 4, 167, 93, 170, 51, 200, 45, 178, 82, 232, 35, 113, 179,
+92, 32, 226, 103, 248, 123, 42, 222, 137, 19, 108, 176, 70, 27, 83, 48,
+202, 168, 93, 169, 54, 6, 171, 210, 42, 244, 225, 232, 54, 119, 137, 130,
+64, 212, 45, 180, 39, 107, 71, 188, 130, 162, 156, 40, 110, 24, 184, 157,
+234, 222, 47, 211, 78, 179, 172, 219, 229, 222, 13, 19, 36, 40, 194, 168,
+248, 28, 245, 98, 1, 0, 224, 2, 113, 52, 29, 39, 47, 238, 23, 239,
+96, 6, 50, 103, 195, 150, 74, 81, 202, 6, 136, 32, 76, 195, 160, 54,
+85, 55, 201, 141, 197, 122, 115, 6, 225, 124, 157, 174, 137, 88, 68, 240,
+44, 207, 188, 238, 140, 144, 66, 133, 123, 137, 148, 238, 238, 101, 9, 223,
+167, 249, 185, 224, 151, 21, 172, 1, 47, 228, 164, 223, 246, 246, 165, 29,
+104, 173, 161, 84, 67, 228, 57, 168, 2, 73, 129, 9, 32, 254, 189, 207,
+35, 36, 34, 135, 152, 105, 79, 207, 24, 16, 201, 3, 26, 124, 239, 191,
+73, 153, 99, 239, 222, 198, 166, 70, 247, 190, 11, 224, 106, 30, 160, 23,
+166, 187, 164, 240, 75, 22, 231, 172, 38, 193, 53, 158, 161, 86, 222, 60,
+151, 243, 81, 1, 42, 166, 43, 200, 174, 58, 7, 62, 206, 29, 248, 71,
+178, 183, 26, 197, 16, 184, 207, 17, 210, 200, 64, 141, 206, 108, 115, 72,
+134, 208, 61, 126, 254, 57, 107, 125, 126, 183, 4, 57, 230, 56, 110, 75,
+168, 91, 182, 33, 44, 149, 37, 72, 28, 143, 30, 2, 76, 127, 165, 227,
+66, 132, 188, 245, 226, 218, 116, 238, 119, 24, 15, 204, 43, 52, 214, 11,
+33, 183, 12, 148, 240, 64, 199, 218, 83, 92, 119, 231, 241, 6, 81, 165,
+98, 129, 162, 204, 19, 83, 129, 184, 174, 107, 184, 179, 213, 68, 207, 29,
+207, 185, 51, 105, 4, 81, 216, 164, 181, 79, 243, 106, 122, 229, 91, 205,
+86, 188, 176, 178, 59, 99, 182, 202, 144, 166, 230, 141, 60, 47, 193, 99,
+238, 190, 75, 82, 181, 1, 254, 104, 232, 48, 83, 83, 95, 79, 14, 128,
+66, 192, 197, 182, 149, 131, 51, 250, 16, 151, 44, 21, 23, 168, 90, 24,
+19, 54, 215, 92, 106, 139, 167, 209, 118, 131, 66, 117, 74, 122, 194, 236,
+113, 200, 126, 15, 225, 43, 228, 151, 254, 132, 114, 64, 159, 227, 77, 132,
+199, 97, 94, 51, 246, 112, 228, 31, 126, 249, 121, 14, 53, 165, 135, 136,
+37, 65, 55, 126, 37, 132, 186, 219, 199, 170, 159, 243, 86, 162, 21, 217,
+205, 163, 15, 190, 232, 129, 120, 250, 94, 33, 220, 103, 205, 166, 98, 91,
+219, 36, 21, 227, 141, 141, 236, 78, 198, 118, 14, 22, 84, 208, 168, 140,
+249, 238, 157, 230, 235, 162, 23, 106, 61, 94, 238, 55, 229, 108, 118, 246,
+42, 98, 218, 84, 174, 73, 239, 21, 100, 197, 164, 63, 244, 196, 40, 192,
+150, 230, 242, 242, 126, 246, 80, 123, 241, 54, 104, 235, 178, 172, 252, 42,
+40, 155, 200, 55, 118, 33, 232, 198, 220, 142, 250, 119, 119, 249, 125, 160,
+43, 219, 216, 207, 83, 82, 79, 90, 24, 62, 237, 240, 28, 10, 107, 177,
+250, 123, 244, 233, 197, 73, 218, 48, 183, 94, 160, 107, 20, 128, 168, 188,
+233, 39, 46, 43, 198, 212, 93, 216, 163, 196, 108, 135, 165, 199, 182, 31,
+145, 131, 6, 195, 250, 252, 216, 99, 108, 189, 135, 79, 40, 22, 105, 4,
+253, 58, 111, 148, 184, 250, 182, 60, 110, 137, 117, 178, 105, 121, 151, 167,
+143, 214, 154, 43, 219, 75, 70, 85, 198, 142, 250, 180, 13, 98, 57, 200,
+160, 185, 53, 144, 36, 53, 160, 142, 5, 38, 75, 65, 189, 17, 33, 127,
+134, 196, 198, 100, 188, 3, 213, 225, 203, 127, 214, 219, 53, 132, 209, 236,
+183, 102, 240, 247, 209, 116, 62, 40, 120, 220, 80, 186, 120, 189, 200, 109,
+72, 253, 225, 9, 176, 70, 11, 78, 143, 254, 250, 165, 92, 62, 131, 194,
+69, 132, 132, 143, 188, 96, 197, 5, 182, 8, 82, 90, 183, 232, 146, 49,
+133, 24, 238, 255, 47, 183, 21, 53, 155, 126, 109, 152, 193, 185, 121, 212,
+19, 44, 225, 102, 13, 80, 181, 228, 194, 55, 176, 9, 124, 132, 2, 127,
+81, 114, 157, 45, 50, 29, 159, 254, 171, 19, 185, 115, 11, 147, 219, 85,
+144, 44, 204, 111, 194, 104, 18, 26, 102, 209, 169, 165, 166, 17, 163, 77,
+124, 252, 89, 36, 99, 222, 223, 8, 58, 117, 112, 252, 174, 97, 129, 241,
+140, 185, 220, 243, 59, 145, 137, 238, 143, 171, 147, 183, 11, 96, 13, 87,
+191, 229, 222, 220, 156, 154, 144, 38, 86, 23, 142, 206, 239, 229, 243, 89,
+69, 241, 66, 167, 67, 47, 18, 159, 97, 200, 24, 164, 94, 72, 52, 251,
+56, 161, 19, 1, 175, 3, 123, 79, 36, 44, 212, 245, 171, 164, 155, 11,
+214, 28, 4, 206, 220, 87, 246, 143, 115, 81, 21, 44, 145, 202, 127, 160,
+86, 113, 122, 33, 126, 30, 181, 110, 217, 197, 187, 95, 187, 221, 142, 74,
+188, 231, 255, 134, 91, 255, 163, 119, 54, 71, 139, 138, 17, 47, 149, 110,
+59, 210, 175, 171, 251, 235, 197, 207, 182, 172, 119, 108, 141, 74, 197, 98,
+147, 77, 115, 220, 74, 96, 94, 105, 134, 164, 46, 74, 147, 95, 239, 74,
+109, 166, 201, 69, 149, 181, 57, 42, 9, 183, 255, 6, 30, 4, 7, 194,
+172, 227, 225, 145, 145, 246, 59, 32, 237, 182, 178, 242, 168, 61, 75, 72,
+180, 77, 63, 87, 164, 35, 198, 133, 203, 242, 29, 0, 52, 170, 207, 28,
+48, 251, 179, 102, 126, 212, 2, 53, 99, 187, 49, 165, 57, 169, 215, 62,
+232, 67, 24, 147, 65, 77, 39, 227, 221, 102, 221, 28, 30, 121, 199, 212,
+12, 228, 117, 167, 226, 15, 49, 150, 10, 226, 20, 199, 201, 112, 87, 235,
+21, 205, 74, 58, 92, 230, 65, 158, 119, 22, 6, 113, 110, 41, 68, 52,
+230, 253, 19, 231, 204, 153, 136, 126, 41, 194, 231, 174, 239, 139, 144, 44,
+16, 21, 92, 106, 100, 241, 128, 31, 131, 12, 245, 183, 242, 165, 174, 139,
+230, 1, 236, 236, 206, 66, 116, 91, 138, 221, 178, 72, 50, 166, 177, 59,
+158, 123, 213, 50, 174, 125, 227, 211, 135, 61, 154, 33, 170, 96, 231, 37,
+105, 183, 183, 9, 157, 171, 129, 12, 82, 40, 68, 84, 90, 253, 79, 229,
+47, 174, 156, 52, 124, 97, 119, 197, 234, 173, 102, 72, 74, 0, 140, 43,
+247, 52, 4, 177, 243, 182, 80, 210, 124, 30, 141, 159, 240, 179, 17, 149,
+143, 23, 230, 68, 89, 229, 218, 237, 114, 219, 182, 167, 56, 214, 119, 122,
+231, 64, 128, 214, 231, 176, 129, 194, 202, 52, 190, 144, 63, 222, 119, 139,
+248, 139, 27, 147, 1, 5, 19, 45, 34, 54, 46, 138, 73, 249, 29, 189,
+93, 186, 46, 0, 236, 93, 138, 204, 111, 255, 197, 203, 127, 94, 240, 235,
+159, 159, 77, 62, 162, 202, 68, 8, 21, 252, 47, 52, 92, 27, 175, 152,
+153, 191, 228, 111, 246, 45, 76, 125, 10, 99, 24, 127, 3, 164, 100, 69,
+170, 52, 33, 190, 16, 4, 236, 174, 229, 101, 99, 8, 99, 211, 150, 130,
+156, 84, 235, 183, 20, 202, 172, 5, 248, 78, 103, 39, 27, 208, 196, 213,
+54, 117, 96, 100, 65, 136, 162, 169, 120, 255, 146, 64, 41, 149, 249, 19,
+100, 113, 85, 51, 119, 64, 91, 88, 154, 121, 152, 211, 239, 199, 95, 176,
+187, 98, 71, 123, 219, 129, 226, 235, 135, 155, 196, 171, 125, 233, 112, 24,
+160, 180, 211, 209, 63, 188, 122, 84, 247, 193, 169, 63, 241, 220, 148, 57,
+11, 190, 156, 7, 182, 71, 109, 5, 104, 21, 54, 110, 105, 236, 92, 79,
+119, 112, 23, 169, 104, 219, 219, 135, 13, 160, 234, 232, 253, 57, 18, 130,
+21, 171, 182, 209, 159, 150, 12, 136, 14, 37, 246, 92, 228, 219, 7, 181,
+226, 163, 175, 193, 0, 228, 15, 16, 151, 57, 27, 245, 160, 144, 2, 199,
+112, 2, 167, 89, 66, 105, 57, 74, 47, 166, 192, 113, 49, 9, 39, 206,
+246, 112, 111, 24, 129, 67, 64, 91, 45, 116, 61, 199, 57, 170, 161, 77,
+27, 90, 172, 172, 212, 199, 212, 197, 82, 47, 61, 196, 215, 48, 7, 95,
+171, 169, 225, 122, 96, 64, 136, 68, 32, 81, 233, 145, 77, 147, 107, 235,
+198, 33, 150, 56, 83, 151, 121, 202, 171, 92, 215, 151, 60, 134, 52, 234,
+93, 10, 211, 88, 129, 84, 143, 0, 233, 111, 240, 40, 239, 234, 113, 49,
+48, 69, 97, 125, 11, 60, 230, 239, 177, 157, 50, 171, 203, 123, 82, 160,
+152, 133, 141, 165, 176, 164, 31, 160, 194, 1, 48, 61, 206, 59, 134, 118,
+3, 121, 95, 71, 78, 238, 15, 16, 236, 153, 161, 134, 51, 17, 114, 196,
+99, 212, 100, 125, 192, 13, 208, 125, 157, 31, 92, 27, 10, 110, 146, 17,
+20, 39, 95, 30, 104, 220, 192, 141, 239, 78, 30, 4, 146, 114, 165, 62,
+49, 143, 34, 28, 88, 235, 122, 139, 97, 170, 243, 116, 130, 55, 111, 80,
+60, 223, 65, 140, 209, 164, 208, 38, 51, 183, 133, 171, 12, 169, 252, 21,
+142, 58, 90, 75, 201, 145, 121, 20, 34, 74, 226, 4, 99, 142, 17, 151,
+13, 71, 82, 184, 172, 204, 255, 96, 51, 78, 148, 8, 173, 22, 97, 6,
+21, 193, 45, 104, 227, 69, 59, 176, 113, 84, 191, 231, 161, 184, 139, 64,
+232, 2, 140, 163, 154, 46, 139, 96, 71, 218, 172, 161, 60, 125, 90, 0,
+195, 50, 118, 166, 225, 94, 39, 173, 60, 79, 85, 67, 74, 245, 102, 151,
+254, 134, 58, 59, 126, 31, 192, 198, 69, 249, 83, 241, 216, 94, 67, 190,
+246, 177, 23, 89, 44, 19, 241, 183, 143, 50, 233, 249, 157, 133, 61, 189,
+136, 164, 70, 253, 145, 123, 124, 170, 117, 244, 107, 94, 136, 28, 160, 231,
+56, 211, 255, 244, 174, 189, 98, 53, 21, 211, 180, 16, 59, 227, 22, 148,
+62, 49, 101, 219, 19, 103, 242, 166, 220, 11, 5, 80, 112, 77, 75, 176,
+131, 156, 99, 210, 68, 240, 221, 69, 135, 10, 60, 22, 209, 58, 2, 192,
+41, 104, 31, 171, 93, 70, 65, 12, 106, 14, 235, 39, 203, 6, 138, 195,
+185, 185, 38, 187, 67, 12, 126, 53, 139, 235, 227, 246, 218, 5, 71, 181,
+33, 12, 79, 8, 123, 112, 217, 83, 26, 201, 224, 98, 175, 146, 85, 28,
+190, 72, 49, 245, 170, 218, 222, 146, 204, 56, 90, 125, 26, 160, 144, 95,
+169, 118, 174, 130, 252, 244, 162, 186, 234, 220, 76, 178, 178, 68, 147, 112,
+137, 196, 32, 106, 213, 178, 147, 203, 107, 158, 45, 65, 213, 3, 183, 23,
+136, 41, 63, 128, 188, 173, 72, 109, 26, 232, 213, 67, 203, 169, 199, 86,
+162, 251, 129, 96, 16, 229, 156, 65, 128, 165, 155, 27, 114, 23, 191, 239,
+192, 72, 205, 175, 229, 235, 73, 187, 26, 250, 175, 227, 220, 26, 26, 3,
+247, 220, 82, 247, 97, 98, 126, 104, 118, 150, 107, 64, 218, 36, 216, 205,
+28, 245, 39, 144, 177, 132, 198, 213, 92, 47, 227, 226, 172, 179, 96, 138,
+127, 36, 37, 127, 120, 161, 233, 210, 195, 36, 225, 20, 68, 170, 177, 165,
+102, 125, 87, 92, 204, 255, 136, 189, 213, 109, 71, 59, 87, 166, 96, 56,
+237, 83, 13, 200, 6, 228, 113, 194, 44, 31, 74, 1, 249, 154, 224, 188,
+39, 113, 63, 170, 150, 28, 167, 14, 89, 197, 62, 119, 84, 252, 48, 8,
+229, 200, 218, 54, 200, 91, 64, 0, 95, 215, 192, 223, 203, 247, 116, 229,
+57, 106, 25, 45, 46, 126, 155, 10, 69, 194, 229, 56, 196, 26, 17, 14,
+87, 57, 187, 110, 103, 161, 243, 246, 10, 203, 25, 226, 229, 225, 90, 226,
+232, 240, 50, 179, 59, 67, 179, 115, 114, 186, 130, 197, 237, 59, 1, 148,
+36, 111, 6, 112, 103, 37, 73, 235, 137, 37, 10, 193, 152, 87, 213, 95,
+211, 113, 175, 59, 204, 61, 22, 65, 0, 193, 115, 140, 118, 2, 216, 142,
+53, 105, 203, 74, 252, 89, 43, 255, 142, 211, 97, 34, 118, 197, 152, 41,
+166, 71, 85, 104, 80, 159, 229, 236, 153, 206, 60, 34, 162, 154, 38, 150,
+142, 29, 221, 20, 208, 93, 3, 39, 27, 132, 199, 150, 150, 41, 254, 7,
+135, 136, 118, 26, 247, 148, 76, 8, 0, 72, 5, 46, 15, 217, 117, 141,
+155, 16, 26, 226, 151, 162, 23, 144, 176, 93, 58, 102, 185, 80, 243, 208,
+10, 56, 148, 25, 223, 135, 225, 67, 236, 47, 77, 72, 181, 167, 215, 238,
+158, 17, 142, 217, 79, 69, 93, 180, 140, 203, 0, 222, 41, 167, 157, 255,
+95, 133, 245, 151, 127, 86, 178, 254, 31, 126, 195, 195, 205, 135, 51, 111,
+25, 132, 36, 177, 37, 93, 34, 7, 205, 47, 247, 170, 142, 162, 58, 233,
+156, 227, 54, 100, 248, 166, 136, 202, 198, 31, 78, 180, 191, 255, 32, 49,
+215, 63, 138, 208, 51, 233, 83, 11, 100, 26, 137, 187, 164, 71, 142, 193,
+39, 50, 180, 189, 46, 181, 68, 187, 249, 177, 250, 14, 3, 173, 148, 140,
+253, 81, 228, 172, 23, 80, 202, 71, 224, 159, 84, 130, 233, 218, 43, 15,
+111, 179, 242, 184, 169, 169, 28, 28, 115, 57, 249, 241, 40, 111, 241, 20,
+206, 148, 101, 193, 234, 221, 238, 56, 77, 63, 92, 106, 214, 214, 36, 41,
+207, 25, 140, 90, 67, 206, 255, 189, 33, 239, 102, 207, 118, 18, 38, 60,
+213, 31, 20, 231, 32, 30, 77, 218, 67, 249, 81, 113, 182, 35, 254, 250,
+6, 234, 107, 77, 79, 103, 57, 38, 217, 105, 7, 38, 206, 179, 123, 111,
+70, 104, 17, 193, 50, 212, 141, 99, 250, 107, 238, 63, 172, 22, 29, 219,
+124, 68, 162, 68, 104, 139, 1, 215, 234, 183, 3, 0, 210, 232, 151, 201,
+5, 44, 100, 244, 179, 208, 176, 216, 56, 19, 111, 175, 105, 18, 74, 100,
+57, 44, 22, 146, 80, 83, 201, 215, 122, 182, 185, 93, 114, 56, 151, 191,
+113, 84, 65, 153, 9, 173, 204, 25, 77, 251, 214, 33, 81, 111, 242, 51,
+186, 168, 92, 96, 157, 27, 205, 58, 118, 246, 218, 76, 136, 131, 87, 73,
+217, 233, 195, 86, 249, 188, 2, 143, 230, 113, 72, 156, 238, 108, 173, 83,
+59, 230, 183, 80, 224, 104, 58, 247, 200, 13, 226, 86, 45, 101, 229, 207,
+87, 11, 88, 138, 251, 78, 138, 153, 213, 243, 7, 11, 84, 98, 5, 125,
+90, 55, 204, 192, 116, 193, 87, 181, 145, 249, 31, 65, 9, 138, 181, 158,
+195, 227, 27, 99, 59, 93, 66, 3, 117, 132, 114, 44, 95, 240, 48, 231,
+41, 93, 233, 53, 94, 221, 6, 64, 42, 164, 125, 22, 65, 60, 158, 130,
+241, 63, 232, 108, 87, 100, 107, 7, 82, 122, 128, 106, 169, 236, 88, 20,
+188, 29, 119, 217, 9, 40, 43, 136, 165, 193, 198, 154, 77, 35, 82, 255,
+33, 40, 169, 92, 76, 5, 219, 103, 109, 222, 124, 50, 253, 132, 36, 63,
+140, 190, 200, 152, 12, 145, 187, 47, 218, 126, 41, 160, 14, 241, 188, 48,
+139, 233, 40, 28, 215, 109, 202, 199, 131, 45, 25, 211, 121, 139, 168, 207,
+216, 217, 44, 75, 201, 179, 237, 97, 8, 115, 1, 164, 25, 16, 225, 166,
+112, 141, 232, 175, 96, 204, 101, 176, 221, 156, 162, 179, 157, 170, 246, 140,
+36, 68, 202, 153, 21, 160, 124, 1, 248, 98, 28, 8, 30, 115, 71, 174,
+191, 243, 73, 78, 133, 227, 210, 14, 222, 8, 247, 145, 197, 18, 129, 159,
+110, 88, 127, 90, 139, 213, 130, 206, 121, 10, 182, 123, 134, 241, 75, 21,
+187, 133, 234, 177, 129, 137, 77, 57, 209, 38, 35, 228, 135, 199, 226, 7,
+153, 96, 206, 144, 112, 23, 91, 88, 175, 187, 99, 233, 148, 75, 184, 192,
+162, 246, 174, 210, 14, 215, 227, 25, 65, 86, 164, 125, 249, 114, 19, 127,
+170, 242, 189, 178, 78, 48, 132, 75, 45, 17, 25, 178, 211, 194, 101, 8,
+153, 16, 167, 195, 90, 99, 46, 49, 16, 42, 134, 154, 0, 41, 85, 126,
+190, 171, 237, 110, 198, 37, 184, 178, 12, 113, 227, 250, 203, 219, 143, 17,
+209, 7, 45, 195, 94, 140, 237, 130, 26, 23, 171, 184, 8, 59, 62, 176,
+250, 78, 52, 159, 186, 187, 17, 221, 112, 29, 211, 64, 113, 33, 24, 246,
+248, 255, 50, 208, 245, 82, 251, 107, 16, 61, 78, 220, 167, 166, 20, 73,
+248, 157, 93, 116, 248, 58, 69, 82, 240, 63, 53, 42, 15, 221, 188, 138,
+133, 235, 17, 165, 189, 235, 34, 86, 85, 229, 88, 0, 92, 116, 163, 200,
+228, 215, 69, 151, 43, 12, 75, 243, 134, 201, 217, 217, 204, 228, 153, 182,
+142, 120, 86, 106, 166, 234, 243, 124, 111, 42, 22, 198, 227, 150, 54, 139,
+216, 101, 166, 144, 37, 143, 181, 108, 75, 150, 85, 169, 237, 158, 73, 63,
+161, 192, 1, 101, 195, 155, 244, 61, 161, 8, 140, 115, 209, 244, 191, 151,
+165, 6, 77, 8, 224, 154, 67, 34, 145, 14, 32, 106, 24, 71, 215, 5,
+234, 154, 169, 69, 150, 124, 217, 38, 237, 212, 249, 20, 6, 93, 120, 240,
+244, 34, 239, 39, 172, 54, 94, 132, 41, 38, 27, 200, 161, 72, 245, 129,
+98, 233, 76, 140, 52, 64, 102, 209, 88, 70, 104, 203, 179, 247, 172, 234,
+24, 32, 34, 232, 19, 187, 203, 204, 254, 159, 156, 89, 223, 156, 94, 75,
+92, 149, 71, 106, 31, 43, 78, 71, 67, 97, 163, 106, 214, 157, 148, 29,
+194, 132, 100, 99, 55, 33, 37, 232, 113, 242, 77, 61, 124, 196, 10, 109,
+18, 241, 189, 22, 46, 84, 36, 222, 167, 137, 252, 46, 32, 145, 214, 211,
+208, 87, 199, 174, 85, 186, 133, 100, 190, 156, 251, 43, 96, 22, 220, 213,
+163, 19, 40, 2, 243, 96, 20, 163, 61, 74, 19, 135, 117, 41, 176, 194,
+243, 80, 185, 163, 148, 145, 63, 163, 134, 12, 252, 121, 108, 57, 104, 214,
+169, 228, 35, 19, 105, 134, 37, 77, 190, 176, 144, 163, 248, 133, 91, 252,
+155, 22, 107, 103, 25, 148, 147, 84, 89, 57, 201, 216, 215, 109, 12, 211,
+103, 37, 141, 245, 214, 247, 198, 207, 14, 192, 50, 62, 54, 124, 228, 105,
+244, 146, 34, 187, 170, 207, 108, 49, 3, 152, 127, 239, 93, 152, 8, 214,
+217, 157, 161, 145, 250, 103, 154, 164, 51, 196, 65, 116, 22, 80, 112, 67,
+16, 196, 152, 243, 173, 17, 110, 187, 73, 146, 35, 51, 18, 207, 162, 66,
+137, 254, 112, 87, 180, 100, 202, 112, 42, 135, 130, 169, 23, 42, 49, 14,
+1, 62, 200, 25, 44, 66, 138, 177, 2, 34, 143, 253, 5, 39, 117, 212,
+199, 177, 228, 183, 34, 115, 130, 147, 129, 251, 168, 244, 0, 92, 194, 8,
+221, 122, 251, 67, 57, 108, 170, 141, 97, 54, 251, 79, 142, 188, 112, 75,
+82, 110, 142, 35, 14, 77, 7, 225, 128, 79, 242, 56, 149, 185, 24, 37,
+61, 6, 189, 234, 70, 46, 237, 38, 100, 222, 37, 41, 75, 50, 202, 223,
+202, 149, 181, 21, 75, 30, 183, 149, 102, 222, 34, 164, 89, 223, 224, 36,
+76, 150, 198, 136, 36, 30, 222, 216, 15, 26, 74, 100, 236, 8, 83, 157,
+147, 226, 149, 126, 105, 248, 41, 235, 231, 119, 209, 42, 197, 142, 29, 15,
+255, 154, 55, 15, 178, 37, 154, 76, 232, 56, 252, 65, 183, 2, 57, 82,
+163, 217, 174, 197, 167, 50, 147, 106, 28, 79, 181, 242, 253, 4, 109, 122,
+11, 13, 254, 62, 191, 243, 191, 243, 153, 90, 163, 233, 111, 225, 119, 17,
+223, 72, 170, 238, 79, 43, 143, 113, 115, 66, 128, 165, 110, 39, 234, 229,
+196, 218, 151, 17, 80, 119, 58, 190, 211, 141, 177, 25, 118, 217, 177, 25,
+41, 97, 179, 183, 117, 220, 76, 126, 9, 51, 178, 49, 168, 201, 149, 118,
+89, 81, 155, 112, 248, 156, 69, 22, 73, 108, 170, 189, 3, 53, 120, 221,
+67, 27, 53, 99, 210, 192, 237, 123, 191, 208, 216, 190, 186, 37, 127, 99,
+79, 75, 162, 59, 206, 238, 216, 254, 34, 91, 95, 199, 11, 220, 94, 175,
+247, 166, 159, 160, 103, 83, 153, 54, 1, 78, 156, 44, 189, 39, 189, 34,
+74, 218, 35, 71, 202, 137, 239, 156, 118, 230, 180, 192, 154, 96, 81, 87,
+53, 20, 0, 82, 39, 43, 236, 157, 55, 138, 245, 59, 198, 103, 210, 152,
+69, 12, 162, 49, 237, 131, 177, 66, 143, 25, 104, 86, 178, 56, 243, 173,
+196, 151, 191, 147, 212, 52, 224, 239, 68, 124, 88, 0, 52, 123, 159, 218,
+223, 91, 195, 49, 235, 132, 151, 57, 199, 96, 101, 117, 31, 124, 175, 9,
+101, 94, 6, 135, 231, 218, 235, 109, 255, 175, 192, 60, 199, 217, 214, 69,
+93, 115, 93, 212, 198, 213, 155, 12, 205, 128, 59, 57, 46, 133, 94, 53,
+222, 209, 72, 163, 59, 239, 24, 141, 209, 242, 210, 192, 116, 244, 213, 53,
+137, 191, 126, 150, 63, 242, 42, 83, 224, 56, 107, 175, 163, 214, 154, 209,
+20, 17, 91, 174, 65, 214, 100, 198, 205, 5, 49, 193, 125, 240, 166, 12,
+16, 122, 174, 133, 183, 220, 246, 34, 48, 197, 105, 229, 115, 81, 217, 143,
+159, 120, 212, 166, 245, 248, 87, 30, 248, 28, 53, 201, 88, 37, 36, 119,
+58, 219, 219, 70, 202, 49, 255, 163, 131, 210, 220, 69, 137, 150, 165, 48,
+171, 12, 91, 173, 120, 107, 112, 18, 251, 240, 108, 118, 230, 119, 217, 106,
+53, 54, 108, 184, 155, 189, 72, 32, 10, 168, 137, 117, 249, 170, 3, 254,
+38, 54, 91, 224, 130, 80, 244, 32, 135, 169, 166, 30, 229, 116, 105, 131,
+249, 109, 179, 94, 213, 110, 8, 68, 115, 145, 133, 143, 241, 11, 112, 114,
+220, 234, 253, 167, 82, 1, 116, 129, 108, 151, 145, 187, 158, 186, 9, 113,
+225, 185, 47, 148, 227, 183, 4, 234, 52, 97, 113, 220, 131, 232, 161, 181,
+135, 90, 138, 244, 100, 234, 21, 9, 34, 43, 186, 194, 18, 50, 29, 230,
+198, 70, 220, 138, 228, 55, 144, 169, 217, 211, 176, 212, 31, 99, 216, 135,
+124, 97, 76, 239, 46, 225, 116, 248, 247, 35, 4, 228, 201, 62, 38, 148,
+76, 149, 211, 7, 102, 233, 146, 62, 87, 200, 223, 111, 133, 139, 248, 252,
+179, 228, 36, 254, 37, 97, 76, 77, 159, 106, 231, 1, 132, 11, 224, 136,
+224, 174, 144, 38, 181, 88, 16, 240, 159, 53, 164, 73, 210, 250, 167, 15,
+223, 63, 70, 133, 186, 193, 206, 75, 103, 44, 108, 36, 5, 179, 12, 74,
+14, 110, 102, 128, 67, 147, 251, 110, 243, 123, 142, 151, 198, 13, 160, 64,
+217, 239, 41, 234, 134, 203, 87, 158, 129, 213, 64, 89, 233, 160, 43, 75,
+237, 80, 61, 245, 95, 175, 37, 58, 250, 233, 40, 103, 218, 123, 52, 35,
+10, 167, 218, 149, 101, 107, 160, 211, 54, 127, 56, 234, 224, 75, 247, 22,
+164, 61, 153, 186, 80, 219, 103, 253, 184, 78, 245, 30, 182, 214, 16, 133,
+47, 207, 98, 247, 240, 62, 210, 215, 50, 196, 92, 249, 72, 157, 161, 109,
+91, 235, 255, 233, 74, 200, 33, 86, 70, 127, 66, 51, 28, 239, 1, 24,
+207, 70, 164, 56, 52, 190, 29, 93, 182, 164, 128, 157, 23, 88, 130, 232,
+141, 125, 59, 143, 254, 68, 180, 88, 162, 71, 187, 254, 115, 65, 29, 31,
+170, 195, 123, 168, 199, 16, 158, 89, 160, 107, 7, 50, 56, 244, 215, 122,
+50, 175, 114, 199, 145, 3, 6, 21, 8, 61, 195, 245, 194, 42, 179, 211,
+34, 55, 217, 82, 240, 248, 136, 18, 244, 239, 184, 97, 178, 50, 167, 2,
+254, 232, 44, 38, 120, 154, 60, 13, 37, 171, 160, 174, 34, 212, 199, 160,
+65, 101, 247, 19, 215, 27, 253, 85, 232, 181, 193, 211, 171, 188, 108, 109,
+18, 111, 154, 230, 70, 3, 40, 178, 216, 52, 78, 252, 229, 101, 41, 122,
+175, 180, 217, 28, 12, 80, 180, 216, 190, 103, 2, 131, 84, 119, 233, 72,
+99, 17, 38, 178, 209, 165, 236, 195, 109, 170, 153, 64, 93, 195, 192, 236,
+0, 173, 198, 12, 36, 59, 167, 221, 243, 221, 1, 62, 31, 87, 97, 104,
+30, 46, 5, 95, 147, 149, 102, 161, 0, 236, 64, 25, 44, 238, 159, 89,
+142, 160, 39, 249, 188, 52, 95, 93, 103, 224, 62, 172, 154, 122, 47, 241,
+23, 235, 71, 121, 60, 73, 206, 52, 152, 78, 5, 121, 114, 124, 250, 255,
+16, 60, 84, 25, 223, 198, 101, 32, 85, 161, 240, 220, 59, 244, 69, 119,
+234, 231, 47, 14, 194, 183, 38, 29, 58, 151, 32, 41, 27, 111, 228, 68,
+190, 253, 101, 153, 56, 135, 99, 206, 198, 81, 181, 170, 174, 157, 208, 240,
+245, 63, 2, 205, 247, 210, 66, 150, 153, 167, 186, 242, 125, 55, 190, 164,
+100, 127, 226, 1, 65, 158, 172, 122, 225, 25, 203, 66, 255, 7, 118, 142,
+38, 248, 63, 35, 236, 13, 155, 189, 48, 105, 249, 45, 10, 55, 4, 232,
+85, 121, 0, 216, 2, 206, 142, 189, 150, 86, 182, 15, 195, 148, 130, 233,
+121, 145, 127, 146, 95, 224, 77, 250, 161, 239, 245, 189, 48, 4, 102, 98,
+148, 72, 210, 214, 77, 51, 80, 205, 73, 20, 195, 190, 108, 146, 191, 80,
+130, 88, 170, 85, 155, 29, 185, 139, 13, 100, 121, 35, 227, 221, 156, 6,
+193, 15, 229, 205, 95, 130, 31, 229, 185, 9, 133, 37, 148, 237, 204, 120,
+124, 161, 146, 22, 2, 181, 51, 70, 202, 56, 202, 186, 201, 129, 172, 199,
+27, 144, 84, 33, 76, 94, 44, 88, 190, 45, 86, 8, 140, 85, 123, 70,
+163, 205, 14, 123, 150, 196, 157, 187, 165, 82, 26, 69, 64, 70, 231, 153,
+85, 12, 147, 5, 83, 242, 228, 218, 23, 58, 165, 3, 110, 111, 67, 149,
+81, 141, 215, 194, 158, 117, 116, 223, 86, 85, 222, 34, 13, 120, 67, 173,
+119, 84, 160, 102, 91, 46, 24, 129, 191, 46, 230, 240, 138, 201, 156, 50,
+243, 136, 201, 173, 122, 30, 223, 66, 152, 144, 84, 121, 22, 90, 183, 166,
+94, 3, 178, 177, 130, 186, 188, 160, 34, 226, 191, 255, 138, 212, 108, 112,
+210, 165, 136, 111, 210, 213, 8, 140, 25, 127, 188, 223, 83, 249, 72, 172,
+161, 197, 162, 45, 253, 68, 20, 105, 95, 249, 5, 8, 80, 38, 255, 143,
+20, 153, 149, 23, 114, 172, 246, 199, 196, 2, 129, 30, 195, 246, 186, 135,
+54, 140, 10, 247, 201, 8, 191, 35, 59, 60, 29, 106, 158, 55, 120, 0,
+248, 100, 159, 72, 243, 81, 125, 231, 238, 89, 190, 247, 177, 146, 129, 33,
+199, 93, 117, 231, 171, 32, 5, 232, 84, 85, 242, 175, 145, 169, 52, 193,
+199, 168, 221, 235, 175, 83, 31, 62, 107, 14, 225, 105, 158, 253, 106, 23,
+68, 84, 251, 134, 253, 61, 28, 242, 9, 167, 1, 116, 113, 216, 208, 38,
+255, 232, 145, 165, 151, 120, 193, 28, 35, 24, 34, 144, 117, 61, 90, 35,
+60, 254, 6, 197, 19, 55, 188, 182, 51, 98, 250, 184, 32, 192, 115, 169,
+128, 175, 195, 8, 36, 100, 22, 53, 252, 99, 231, 15, 253, 247, 52, 1,
+33, 196, 116, 64, 128, 55, 238, 97, 56, 119, 254, 13, 253, 114, 228, 120,
+191, 118, 19, 244, 226, 18, 189, 133, 237, 31, 66, 150, 236, 3, 101, 178,
+93, 94, 191, 117, 191, 235, 241, 5, 40, 243, 144, 183, 113, 195, 64, 10,
+169, 146, 29, 195, 74, 149, 110, 129, 216, 81, 192, 125, 237, 159, 187, 218,
+79, 77, 4, 23, 228, 96, 223, 133, 89, 26, 57, 230, 133, 9, 56, 115,
+99, 177, 181, 44, 177, 158, 78, 121, 219, 213, 225, 224, 145, 228, 86, 83,
+253, 11, 178, 219, 248, 29, 118, 30, 150, 198, 230, 76, 207, 91, 1, 41,
+242, 216, 182, 52, 253, 118, 245, 196, 174, 96, 227, 136, 121, 207, 7, 10,
+86, 40, 62, 29, 212, 120, 247, 216, 213, 167, 66, 54, 110, 242, 76, 30,
+152, 192, 229, 137, 203, 76, 83, 141, 16, 154, 23, 120, 164, 15, 30, 27,
+81, 184, 30, 249, 110, 155, 142, 6, 136, 247, 129, 239, 2, 41, 204, 5,
+143, 108, 230, 153, 179, 176, 215, 39, 122, 128, 115, 177, 132, 230, 218, 207,
+242, 195, 220, 85, 249, 24, 77, 170, 18, 49, 236, 117, 168, 140, 147, 58,
+219, 223, 117, 191, 139, 144, 90, 159, 252, 114, 187, 173, 152, 2, 63, 69,
+200, 180, 59, 35, 11, 247, 184, 172, 78, 150, 19, 178, 113, 5, 86, 30,
+151, 143, 11, 3, 189, 88, 153, 20, 192, 46, 40, 39, 27, 129, 158, 28,
+120, 235, 3, 185, 240, 28, 198, 6, 136, 103, 168, 175, 182, 50, 153, 145,
+43, 66, 200, 185, 86, 78, 27, 40, 54, 196, 175, 124, 234, 177, 163, 118,
+19, 218, 236, 32, 251, 166, 33, 227, 190, 227, 168, 55, 136, 98, 203, 212,
+255, 250, 144, 244, 143, 103, 44, 186, 13, 200, 225, 9, 239, 164, 180, 151,
+104, 66, 250, 15, 237, 139, 9, 180, 140, 102, 108, 161, 193, 185, 91, 239,
+43, 22, 18, 135, 132, 21, 217, 158, 4, 88, 156, 181, 108, 217, 118, 4,
+71, 194, 90, 235, 118, 116, 42, 51, 139, 200, 153, 184, 102, 26, 204, 37,
+206, 82, 65, 41, 118, 191, 106, 112, 41, 97, 141, 73, 228, 242, 2, 179,
+78, 237, 156, 101, 115, 103, 255, 96, 202, 104, 212, 211, 20, 251, 64, 29,
+53, 163, 48, 107, 226, 72, 215, 232, 58, 185, 151, 126, 90, 13, 126, 67,
+165, 230, 187, 227, 48, 53, 225, 121, 17, 51, 24, 138, 87, 229, 104, 57,
+79, 182, 151, 9, 245, 95, 215, 206, 159, 52, 83, 94, 158, 70, 223, 58,
+143, 57, 160, 94, 93, 200, 89, 125, 231, 95, 145, 19, 127, 80, 71, 219,
+10, 216, 55, 190, 69, 82, 237, 66, 123, 226, 116, 149, 84, 138, 116, 66,
+30, 163, 99, 223, 103, 55, 106, 92, 232, 177, 11, 8, 44, 209, 157, 181,
+101, 205, 72, 76, 192, 95, 244, 122, 41, 114, 37, 108, 5, 173, 73, 21,
+146, 7, 236, 117, 113, 153, 22, 188, 42, 71, 49, 189, 131, 217, 155, 196,
+243, 186, 46, 105, 161, 26, 52, 100, 109, 133, 32, 135, 175, 170, 59, 34,
+189, 128, 98, 158, 149, 78, 88, 60, 11, 213, 197, 102, 223, 167, 158, 217,
+124, 209, 83, 66, 251, 74, 89, 228, 63, 91, 172, 245, 119, 231, 207, 165,
+101, 51, 118, 97, 143, 66, 108, 40, 206, 233, 160, 224, 244, 177, 122, 246,
+54, 78, 143, 6, 70, 43, 20, 12, 176, 239, 128, 249, 175, 241, 15, 234,
+133, 198, 40, 193, 148, 246, 46, 245, 195, 109, 12, 36, 207, 199, 173, 46,
+60, 39, 230, 197, 63, 60, 60, 156, 70, 138, 4, 73, 19, 5, 140, 170,
+68, 48, 236, 96, 193, 85, 80, 159, 131, 243, 5, 27, 207, 89, 253, 167,
+92, 250, 39, 152, 44, 27, 113, 184, 209, 255, 166, 40, 212, 41, 44, 57,
+141, 102, 212, 154, 141, 190, 190, 200, 209, 153, 54, 146, 238, 246, 164, 11,
+11, 96, 186, 199, 209, 68, 95, 185, 52, 121, 32, 194, 100, 20, 203, 26,
+66, 2, 60, 148, 120, 149, 22, 136, 218, 84, 16, 165, 131, 171, 165, 249,
+133, 170, 246, 168, 206, 106, 126, 162, 135, 104, 141, 0, 19, 180, 197, 188,
+191, 95, 179, 244, 234, 230, 200, 87, 210, 46, 249, 82, 158, 58, 102, 194,
+206, 164, 138, 225, 42, 249, 166, 41, 13, 127, 176, 52, 51, 251, 81, 71,
+229, 166, 237, 16, 204, 127, 101, 3, 125, 201, 43, 109, 134, 121, 81, 67,
+154, 160, 166, 242, 68, 4, 216, 14, 42, 169, 70, 45, 192, 244, 133, 196,
+105, 110, 253, 35, 130, 121, 33, 10, 31, 25, 107, 208, 17, 74, 135, 123,
+254, 167, 3, 251, 140, 102, 178, 131, 189, 14, 71, 149, 238, 29, 3, 192,
+212, 148, 142, 23, 145, 195, 214, 208, 20, 251, 101, 13, 105, 150, 127, 193,
+6, 86, 163, 195, 35, 238, 72, 9, 233, 113, 45, 114, 50, 52, 205, 114,
+211, 204, 91, 167, 176, 101, 237, 9, 106, 40, 19, 185, 7, 206, 154, 23,
+90, 171, 134, 188, 102, 214, 201, 48, 239, 176, 173, 114, 162, 22, 173, 128,
+126, 146, 150, 221, 205, 136, 39, 214, 252, 174, 26, 163, 85, 111, 87, 177,
+47, 202, 117, 96, 174, 176, 141, 114, 184, 2, 140, 206, 94, 176, 142, 15,
+138, 78, 71, 242, 194, 24, 223, 1, 39, 91, 178, 213, 220, 72, 126, 73,
+106, 154, 120, 85, 255, 112, 103, 161, 146, 99, 89, 117, 171, 37, 36, 24,
+246, 5, 229, 51, 231, 177, 9, 69, 152, 168, 75, 29, 210, 236, 3, 153,
+84, 221, 220, 216, 12, 74, 189, 29, 50, 123, 129, 126, 53, 38, 90, 50,
+31, 128, 215, 13, 114, 86, 20, 181, 218, 157, 150, 82, 157, 90, 58, 81,
+25, 131, 231, 149, 177, 61, 97, 217, 9, 226, 165, 22, 179, 81, 52, 226,
+111, 85, 204, 152, 215, 6, 135, 229, 105, 45, 198, 130, 189, 67, 128, 28,
+204, 108, 123, 236, 47, 33, 166, 139, 197, 138, 55, 36, 201, 17, 172, 94,
+60, 130, 171, 150, 27, 198, 241, 130, 154, 83, 129, 109, 157, 112, 177, 222,
+148, 71, 246, 44, 28, 24, 32, 162, 75, 88, 10, 85, 115, 50, 244, 38,
+132, 125, 74, 196, 171, 134, 169, 248, 96, 53, 153, 51, 213, 127, 237, 248,
+230, 134, 63, 80, 251, 69, 18, 182, 119, 18, 37, 129, 233, 204, 149, 139,
+165, 236, 203, 252, 130, 130, 203, 125, 218, 125, 208, 26, 96, 211, 225, 171,
+42, 203, 229, 116, 27, 251, 202, 175, 102, 96, 155, 118, 121, 50, 42, 19,
+};
+static const RevealMap revealDissolve = {revealDissolveRanks, 0, 256};
+
+// 4x4 blocks in random order
+alignas(4) static const uint8_t revealPixelatedRanks[] = {
+104, 39, 49, 237, 94, 4, 48, 185, 70, 216, 111, 236, 251, 73, 139, 163,
+156, 44, 91, 174, 123, 144, 218, 147, 103, 116, 57, 66, 109, 239, 70, 4,
+154, 247, 227, 217, 186, 178, 62, 25, 90, 223, 74, 153, 22, 212, 234, 62,
+230, 214, 77, 88, 248, 2, 250, 80, 79, 59, 91, 24, 175, 20, 155, 248,
+176, 76, 198, 220, 229, 177, 226, 48, 189, 51, 131, 40, 36, 183, 12, 143,
+137, 181, 245, 199, 180, 188, 193, 243, 240, 201, 118, 83, 134, 107, 42, 67,
+82, 102, 169, 106, 155, 50, 232, 184, 205, 251, 26, 204, 151, 35, 135, 59,
+84, 134, 139, 120, 236, 241, 203, 5, 52, 77, 32, 246, 118, 226, 243, 58,
+166, 109, 161, 69, 41, 0, 113, 96, 18, 89, 21, 164, 23, 38, 159, 25,
+124, 213, 219, 108, 32, 167, 24, 207, 130, 150, 174, 225, 94, 88, 81, 179,
+38, 82, 99, 252, 71, 157, 164, 12, 103, 184, 56, 18, 181, 46, 203, 27,
+213, 162, 26, 73, 245, 101, 3, 16, 212, 93, 172, 209, 100, 244, 143, 51,
+42, 215, 215, 8, 149, 29, 208, 45, 199, 147, 136, 116, 233, 145, 46, 190,
+74, 205, 176, 114, 168, 125, 36, 75, 182, 106, 123, 148, 253, 140, 187, 72,
+95, 234, 158, 99, 178, 188, 115, 84, 222, 64, 166, 37, 35, 242, 214, 210,
+150, 252, 224, 122, 67, 90, 228, 49, 230, 2, 43, 121, 89, 112, 177, 60,
+104, 13, 57, 204, 247, 31, 10, 78, 44, 129, 101, 238, 120, 37, 231, 153,
+156, 231, 190, 93, 202, 97, 85, 76, 131, 85, 211, 193, 28, 47, 189, 30,
+80, 229, 249, 138, 43, 121, 55, 5, 168, 65, 1, 244, 71, 15, 146, 218,
+39, 100, 119, 117, 253, 221, 250, 127, 61, 159, 154, 55, 23, 145, 79, 202,
+92, 152, 50, 107, 220, 200, 54, 196, 96, 125, 151, 78, 20, 9, 187, 239,
+110, 133, 173, 68, 102, 144, 208, 142, 207, 3, 115, 19, 210, 254, 169, 122,
+27, 227, 157, 149, 10, 183, 75, 47, 219, 223, 200, 206, 92, 66, 179, 240,
+128, 161, 6, 221, 255, 28, 217, 34, 173, 165, 7, 1, 41, 112, 195, 163,
+45, 113, 0, 16, 114, 196, 119, 108, 249, 182, 186, 11, 33, 185, 63, 61,
+222, 40, 241, 211, 58, 128, 135, 198, 216, 98, 13, 15, 86, 148, 21, 130,
+60, 132, 87, 14, 133, 124, 64, 33, 160, 17, 68, 53, 65, 141, 191, 95,
+83, 172, 197, 54, 192, 86, 237, 246, 72, 56, 194, 136, 254, 127, 235, 52,
+98, 142, 191, 105, 238, 162, 141, 180, 209, 9, 53, 11, 81, 171, 242, 146,
+192, 6, 170, 34, 225, 137, 165, 140, 19, 29, 206, 158, 194, 63, 30, 126,
+195, 129, 14, 132, 167, 22, 170, 228, 111, 138, 233, 105, 232, 97, 17, 117,
+8, 197, 152, 235, 160, 31, 255, 171, 87, 201, 126, 69, 7, 224, 175, 110,
+};
+static const RevealMap revealPixelated = {revealPixelatedRanks, 2, 256};
@@ -0,0 +1,70 @@
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include "blit.h"
+
+enum TransitionType {
+  TRANSITION_CUT,           // Straight to the image
+  TRANSITION_PIXELATED,     // Random block reveal
+  TRANSITION_SLIDE_RIGHT,   // Slides in from the right
+  TRANSITION_SLIDE_LEFT,    // Slides in from the left
+  TRANSITION_FADE,          // Ordered dither from the old image to the new
+  TRANSITION_WIPE_DOWN,     // Horizontal line moving down
+  TRANSITION_WIPE_RIGHT,    // Vertical line moving right
+  TRANSITION_SPIRAL,        // Circle expanding from the center
+  TRANSITION_DIAMOND,       // Diamond expanding from the center
+  TRANSITION_DISSOLVE,      // Random pixel reveal
+  TRANSITION_SWEEP,         // Clock hand sweeping round from a random angle
+  TRANSITION_COUNT
+};
+
+#define PIXELATED_BLOCK_SIZE 4 // Cell size of revealPixelated (tools/gen_reveal_maps.py)
+
+/*
+ * A panel transition as a resumable state machine
+ *
+ * begin() sets one up; each step() draws the next frame into the display
+ * buffer and leaves sending it to the caller, so the loop decides when
+ * frames happen and keeps servicing everything else in between. The last
+ * frame is always the complete image. A transition can be cut short with
+ * finish() or left mid-way with cancel().
+ *
+ * Effects that reveal the image in some order (pixelated, fade, spiral,
+ * diamond, dissolve, sweep) take that order from a precomputed reveal map,
+ * so a frame is one threshold compare per cell with no runtime math.
+ */
+class Transition {
+private:
+  Adafruit_SSD1306& display;
+  TransitionType type = TRANSITION_CUT;
+  const uint8_t* image = nullptr;   // Page format; must outlive the transition
+  int frame = 0;
+  int frames = 0;                   // Including the final complete frame
+  bool active = false;
+  const RevealMap* map = nullptr;   // For the map-driven effects
+  uint8_t offset = 0;               // Random start for the shuffled and angular maps
+  alignas(4) uint8_t mask[BLIT_BUFFER_SIZE];
+
+  void drawFrame(int index);
+
+public:
+  explicit Transition(Adafruit_SSD1306& target);
+
+  void begin(TransitionType transitionType, const uint8_t* newImage);
+  // Draws the next frame; the transition is inactive once the last is drawn
+  void step();
+  // Draws the complete image and ends the transition
+  void finish();
+  // Ends the transition, leaving the buffer as it is
+  void cancel();
+
+  bool isActive() const;
+  TransitionType getType() const;
+  int getFrame() const;
+  int getFrames() const;
+  static const char* name(TransitionType transitionType);
+};
+
+#endif // TRANSITION_H
@@ -0,0 +1,224 @@
+#include "asset_pack.h"
+#include <LittleFS.h>
+
+// Bytes read from a pack per call while decoding
+#define ASSET_READ_CHUNK 64
+
+uint32_t assetCrc32(const uint8_t* data, size_t length, uint32_t crc) {
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+RleDecoder::RleDecoder(uint8_t* pages) : out(pages) {
+}
+
+void RleDecoder::feed(const uint8_t* data, size_t length) {
+  for (size_t i = 0; i < length && !failed; i++) {
+    uint8_t byte = data[i];
+    if (literal > 0) {
+      literal--;
+    } else if (repeat > 0) {
+      if (written + repeat > BLIT_BUFFER_SIZE) {
+        failed = true;
+        break;
+      }
+      memset(out + written, byte, repeat);
+      written += repeat;
+      repeat = 0;
+      continue;
+    } else {
+      if (byte < 128) {
+        literal = byte + 1;
+      } else if (byte > 128) {
+        repeat = 257 - byte;
+      }
+      continue;
+    }
+
+    if (written == BLIT_BUFFER_SIZE) {
+      failed = true;
+      break;
+    }
+    out[written++] = byte;
+  }
+}
+
+bool RleDecoder::complete() const {
+  return !failed && written == BLIT_BUFFER_SIZE && literal == 0 && repeat == 0;
+}
+
+// Reads and checks a pack's header and index; entries are left to the caller
+static bool readHeader(File& file, AssetPackHeader& header, String& error) {
+  size_t fileSize = file.size();
+  file.seek(0);
+  if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+    error = "too short for a header";
+    return false;
+  }
+  if (memcmp(header.magic, ASSET_PACK_MAGIC, 4) != 0) {
+    error = "not an asset pack";
+    return false;
+  }
+  if (header.version != ASSET_PACK_VERSION) {
+    error = "unsupported version " + String(header.version);
+    return false;
+  }
+  if (header.width != BLIT_WIDTH || header.height != BLIT_HEIGHT) {
+    error = "images are " + String(header.width) + "x" + String(header.height) + ", not 128x64";
+    return false;
+  }
+  if (header.count == 0 || header.count > ASSET_LIBRARY_MAX_IMAGES) {
+    error = "image count " + String(header.count) + " out of range";
+    return false;
+  }
+
+  uint32_t crc = 0;
+  for (int i = 0; i < header.count; i++) {
+    AssetIndexEntry entry;
+    if (file.read((uint8_t*)&entry, sizeof(entry)) != sizeof(entry)) {
+      error = "index truncated";
+      return false;
+    }
+    crc = assetCrc32((const uint8_t*)&entry, sizeof(entry), crc);
+
+    bool sizeOk = entry.encoding == ASSET_RAW ? entry.size == BLIT_BUFFER_SIZE
+                : entry.encoding == ASSET_RLE ? entry.size > 0 && entry.size <= 2 * BLIT_BUFFER_SIZE
+                : false;
+    if (!sizeOk || (size_t)entry.offset + entry.size > fileSize ||
+        memchr(entry.title, 0, ASSET_TITLE_LENGTH) == nullptr) {
+      error = "bad index entry " + String(i);
+      return false;
+    }
+  }
+  if (crc != header.indexCrc) {
+    error = "index CRC mismatch";
+    return false;
+  }
+  return true;
+}
+
+// Decodes one entry's image from an open pack
+static bool readImage(File& file, const AssetIndexEntry& entry, uint8_t* pages) {
+  if (!file.seek(entry.offset)) return false;
+
+  if (entry.encoding == ASSET_RAW) {
+    if (file.read(pages, BLIT_BUFFER_SIZE) != BLIT_BUFFER_SIZE) return false;
+  } else {
+    RleDecoder decoder(pages);
+    uint8_t chunk[ASSET_READ_CHUNK];
+    size_t remaining = entry.size;
+    while (remaining > 0) {
+      size_t want = remaining < sizeof(chunk) ? remaining : sizeof(chunk);
+      size_t got = file.read(chunk, want);
+      if (got != want) return false;
+      decoder.feed(chunk, got);
+      remaining -= got;
+    }
+    if (!decoder.complete()) return false;
+  }
+  return assetCrc32(pages, BLIT_BUFFER_SIZE) == entry.crc;
+}
+
+bool AssetLibrary::begin() {
+  if (!LittleFS.begin(true)) {
+    Serial.println("Assets: LittleFS mount failed");
+    return false;
+  }
+  if (!LittleFS.exists(ASSET_PACK_DIR)) {
+    LittleFS.mkdir(ASSET_PACK_DIR);
+  }
+  Serial.printf("Assets: LittleFS %u of %u KB used\n", (unsigned)(LittleFS.usedBytes() / 1024),
+                (unsigned)(LittleFS.totalBytes() / 1024));
+  return true;
+}
+
+int AssetLibrary::scan() {
+  packCount = 0;
+  imageCount = 0;
+
+  File dir = LittleFS.open(ASSET_PACK_DIR);
+  if (!dir || !dir.isDirectory()) {
+    return 0;
+  }
+
+  // Pack paths in name order, so the panels come in a predictable order
+  for (File file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    String path = file.path();
+    if (file.isDirectory() || !path.endsWith(".pack")) continue;
+    if (packCount == ASSET_PACK_MAX_PACKS) {
+      Serial.printf("Assets: more than %d packs, skipping %s\n", ASSET_PACK_MAX_PACKS, path.c_str());
+      continue;
+    }
+    int i = packCount++;
+    while (i > 0 && packs[i - 1] > path) {
+      packs[i] = packs[i - 1];
+      i--;
+    }
+    packs[i] = path;
+  }
+
+  for (int p = 0; p < packCount; p++) {
+    File file = LittleFS.open(packs[p], "r");
+    AssetPackHeader header;
+    String error;
+    if (!file || !readHeader(file, header, error)) {
+      Serial.printf("Assets: skipping %s: %s\n", packs[p].c_str(), file ? error.c_str() : "cannot open");
+      continue;
+    }
+
+    file.seek(sizeof(header));
+    for (int i = 0; i < header.count && imageCount < ASSET_LIBRARY_MAX_IMAGES; i++) {
+      AssetImage& image = images[imageCount++];
+      file.read((uint8_t*)&image.entry, sizeof(image.entry));
+      memcpy(image.title, image.entry.title, ASSET_TITLE_LENGTH);
+      image.pack = p;
+    }
+    Serial.printf("Assets: %s, %d images\n", packs[p].c_str(), header.count);
+  }
+  return imageCount;
+}
+
+int AssetLibrary::count() const {
+  return imageCount;
+}
+
+const char* AssetLibrary::title(int index) const {
+  return index >= 0 && index < imageCount ? images[index].title : "";
+}
+
+bool AssetLibrary::load(int index, uint8_t* pages) const {
+  if (index < 0 || index >= imageCount) return false;
+
+  const AssetImage& image = images[index];
+  File file = LittleFS.open(packs[image.pack], "r");
+  if (!file || !readImage(file, image.entry, pages)) {
+    Serial.printf("Assets: failed to load '%s' from %s\n", image.title, packs[image.pack].c_str());
+    return false;
+  }
+  return true;
+}
+
+bool AssetLibrary::validate(File& file, String& error) {
+  AssetPackHeader header;
+  if (!readHeader(file, header, error)) return false;
+
+  // Decodes into a scratch image; validation runs to completion on the web
+  // server's task, so concurrent uploads never share it
+  alignas(4) static uint8_t scratch[BLIT_BUFFER_SIZE];
+  for (int i = 0; i < header.count; i++) {
+    AssetIndexEntry entry;
+    file.seek(sizeof(header) + i * sizeof(entry));
+    file.read((uint8_t*)&entry, sizeof(entry));
+    if (!readImage(file, entry, scratch)) {
+      error = "image " + String(i) + " ('" + String(entry.title) + "') does not decode";
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,174 @@
+#include "asset_server.h"
+#include <WiFi.h>
+#include <LittleFS.h>
+#include <ESPAsyncWebServer.h>
+#include <vector>
+
+#define UPLOAD_TEMP_PREFIX ".upload-"
+#define PACK_NAME_MAX 24
+
+static AsyncWebServer server(ASSET_SERVER_PORT);
+static volatile bool packsChanged = false;
+static uint32_t uploadCount = 0;
+
+// Per request in _tempObject, which the server frees with the request;
+// the open temp file is the request's _tempFile. Concurrent uploads each
+// write their own temp file.
+struct UploadState {
+  char path[sizeof(ASSET_PACK_DIR) + PACK_NAME_MAX + 1];
+  char tempPath[sizeof(ASSET_PACK_DIR) + sizeof(UPLOAD_TEMP_PREFIX) + 10];
+  char error[96];
+  bool done;      // Stored or failed; later file parts are ignored
+};
+
+// A plain file name ending in .pack, or an empty string
+static String packPath(String name) {
+  int slash = name.lastIndexOf('/');
+  if (slash >= 0) name = name.substring(slash + 1);
+  if (!name.endsWith(".pack") || name.length() <= 5 || name.length() > PACK_NAME_MAX) return "";
+  for (unsigned int i = 0; i < name.length(); i++) {
+    char c = name[i];
+    if (!isalnum(c) && c != '-' && c != '_' && c != '.') return "";
+  }
+  return String(ASSET_PACK_DIR) + "/" + name;
+}
+
+static void failUpload(AsyncWebServerRequest* request, UploadState* upload, const String& error) {
+  strlcpy(upload->error, error.c_str(), sizeof(upload->error));
+  upload->done = true;
+  if (request->_tempFile) request->_tempFile.close();
+  LittleFS.remove(upload->tempPath);
+}
+
+static void handleUpload(AsyncWebServerRequest* request, const String& filename, size_t index,
+                         uint8_t* data, size_t len, bool final) {
+  UploadState* upload = (UploadState*)request->_tempObject;
+  if (upload && upload->done) return;
+  if (index == 0) {
+    upload = (UploadState*)calloc(1, sizeof(UploadState));
+    if (!upload) return;
+    request->_tempObject = upload;
+    snprintf(upload->tempPath, sizeof(upload->tempPath), ASSET_PACK_DIR "/" UPLOAD_TEMP_PREFIX "%u",
+             (unsigned)++uploadCount);
+
+    String path = packPath(filename);
+    if (path.length() == 0) {
+      failUpload(request, upload, "file name must be letters, digits, - _ . and end in .pack");
+      return;
+    }
+    strlcpy(upload->path, path.c_str(), sizeof(upload->path));
+
+    // An abandoned upload leaves no temp file behind
+    String tempPath = upload->tempPath;
+    request->onDisconnect([request, tempPath]() {
+      if (request->_tempFile) {
+        request->_tempFile.close();
+        LittleFS.remove(tempPath);
+      }
+    });
+    request->_tempFile = LittleFS.open(upload->tempPath, "w");
+    if (!request->_tempFile) {
+      failUpload(request, upload, "cannot create a file on LittleFS");
+      return;
+    }
+  }
+  if (!upload) return;
+
+  if (index + len > ASSET_PACK_MAX_SIZE) {
+    failUpload(request, upload, "pack larger than " + String(ASSET_PACK_MAX_SIZE) + " bytes");
+    return;
+  }
+  if (request->_tempFile.write(data, len) != len) {
+    failUpload(request, upload, "LittleFS is full");
+    return;
+  }
+  if (!final) return;
+
+  request->_tempFile.close();
+  File check = LittleFS.open(upload->tempPath, "r");
+  String error;
+  bool valid = check && AssetLibrary::validate(check, error);
+  check.close();
+  if (!valid) {
+    failUpload(request, upload, "invalid pack: " + error);
+    return;
+  }
+  // rename() replaces an existing pack, which stays intact if it fails
+  if (!LittleFS.rename(upload->tempPath, upload->path)) {
+    failUpload(request, upload, "cannot store the pack");
+    return;
+  }
+  upload->done = true;
+  Serial.printf("Assets: stored %s (%u bytes)\n", upload->path, (unsigned)(index + len));
+  packsChanged = true;
+}
+
+static void handleList(AsyncWebServerRequest* request) {
+  String json = "{\"packs\":[";
+  File dir = LittleFS.open(ASSET_PACK_DIR);
+  bool first = true;
+  for (File file = dir ? dir.openNextFile() : File(); file; file = dir.openNextFile()) {
+    String name = file.name();
+    if (file.isDirectory() || !name.endsWith(".pack")) continue;
+    AssetPackHeader header;
+    bool readable = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                    memcmp(header.magic, ASSET_PACK_MAGIC, 4) == 0;
+    json += String(first ? "" : ",") + "{\"name\":\"" + name + "\",\"size\":" + String(file.size()) +
+            ",\"images\":" + String(readable ? header.count : 0) + "}";
+    first = false;
+  }
+  json += "],\"free\":" + String(LittleFS.totalBytes() - LittleFS.usedBytes()) + "}";
+  request->send(200, "application/json", json);
+}
+
+static void handleDelete(AsyncWebServerRequest* request) {
+  String path = request->hasParam("name") ? packPath(request->getParam("name")->value()) : "";
+  if (path.length() == 0) {
+    request->send(400, "text/plain", "name=<file>.pack required\n");
+  } else if (!LittleFS.exists(path) || !LittleFS.remove(path)) {
+    request->send(404, "text/plain", "no such pack\n");
+  } else {
+    Serial.printf("Assets: removed %s\n", path.c_str());
+    packsChanged = true;
+    request->send(200, "text/plain", "removed\n");
+  }
+}
+
+// Temp files of uploads cut short by a reset
+static void removeStaleUploads() {
+  std::vector<String> stale;
+  File dir = LittleFS.open(ASSET_PACK_DIR);
+  for (File file = dir ? dir.openNextFile() : File(); file; file = dir.openNextFile()) {
+    String name = file.name();
+    if (name.startsWith(UPLOAD_TEMP_PREFIX)) stale.push_back(String(ASSET_PACK_DIR) + "/" + name);
+  }
+  dir.close();
+  for (const String& path : stale) {
+    LittleFS.remove(path);
+  }
+}
+
+void assetServerBegin() {
+  removeStaleUploads();
+  server.on("/packs", HTTP_GET, handleList);
+  server.on("/packs", HTTP_DELETE, handleDelete);
+  server.on("/packs", HTTP_POST, [](AsyncWebServerRequest* request) {
+    const UploadState* upload = (const UploadState*)request->_tempObject;
+    if (!upload) {
+      request->send(400, "text/plain", "no file in the request\n");
+    } else if (upload->error[0]) {
+      request->send(400, "text/plain", String(upload->error) + "\n");
+    } else {
+      request->send(200, "text/plain", "stored " + String(upload->path) + "\n");
+    }
+  }, handleUpload);
+  server.begin();
+  Serial.printf("Assets: upload packs to http://%s/packs\n", WiFi.getMode() == WIFI_AP
+                ? WiFi.softAPIP().toString().c_str() : WiFi.localIP().toString().c_str());
+}
+
+bool assetServerTakeChanges() {
+  if (!packsChanged) return false;
+  packsChanged = false;
+  return true;
+}
@@ -0,0 +1,139 @@
+#include "battery.h"
+
+// Resting voltage of a typical 1-cell Li-ion/LiPo at 5% steps of charge.
+// Flat between 3.7 and 3.9 V, steep at both ends, so a linear map from
+// 3.0-4.2 V reads half charge for a cell that is nearly empty.
+struct ChargePoint {
+  uint16_t millivolts;
+  uint16_t permille;
+};
+
+static const ChargePoint dischargeCurve[] = {
+  {3270, 0}, {3610, 50}, {3690, 100}, {3710, 150}, {3730, 200}, {3750, 250},
+  {3770, 300}, {3790, 350}, {3800, 400}, {3820, 450}, {3840, 500}, {3850, 550},
+  {3870, 600}, {3910, 650}, {3950, 700}, {3980, 750}, {4020, 800}, {4080, 850},
+  {4110, 900}, {4150, 950}, {4200, 1000}
+};
+#define CURVE_POINTS (sizeof(dischargeCurve) / sizeof(dischargeCurve[0]))
+
+// Discharge slower than this counts as flat: no estimate, and not charging
+#define MIN_SLOPE_PERMILLE_PER_HOUR 5
+
+BatteryMonitor::BatteryMonitor(uint8_t adcPin, float ratio) : pin(adcPin), dividerRatio(ratio) {
+}
+
+bool BatteryMonitor::begin() {
+  analogSetPinAttenuation(pin, ADC_11db);
+  filteredMv = (uint32_t)sampleBurst() << BATTERY_EMA_SHIFT;
+  update();
+
+  if (xTaskCreate(sampleLoop, "battery", BATTERY_TASK_STACK, this, BATTERY_TASK_PRIORITY, &sampleTask) != pdPASS) {
+    sampleTask = nullptr;
+    Serial.println("Battery: could not start the sampling task");
+    return false;
+  }
+  return true;
+}
+
+// Median of a burst of calibrated readings, in pin millivolts
+uint16_t BatteryMonitor::sampleBurst() {
+  uint32_t start = micros();
+  uint16_t samples[BATTERY_BURST_SAMPLES];
+  for (int i = 0; i < BATTERY_BURST_SAMPLES; i++) {
+    uint16_t sample = analogReadMilliVolts(pin);
+    int j = i;
+    while (j > 0 && samples[j - 1] > sample) {
+      samples[j] = samples[j - 1];
+      j--;
+    }
+    samples[j] = sample;
+  }
+  stats.sampleUs = micros() - start;
+  stats.bursts++;
+  return samples[BATTERY_BURST_SAMPLES / 2];
+}
+
+void BatteryMonitor::sampleLoop(void* arg) {
+  BatteryMonitor* monitor = static_cast<BatteryMonitor*>(arg);
+  TickType_t wake = xTaskGetTickCount();
+  for (;;) {
+    vTaskDelayUntil(&wake, pdMS_TO_TICKS(BATTERY_SAMPLE_INTERVAL_MS));
+    uint32_t average = monitor->filteredMv;
+    average += monitor->sampleBurst() - (average >> BATTERY_EMA_SHIFT);
+    monitor->filteredMv = average;
+  }
+}
+
+void BatteryMonitor::update() {
+  uint32_t pinMv = (filteredMv + (1 << (BATTERY_EMA_SHIFT - 1))) >> BATTERY_EMA_SHIFT;
+  millivolts = (uint16_t)(pinMv * dividerRatio + 0.5f);
+  chargePermille = chargeForVoltage(millivolts);
+
+  unsigned long now = millis();
+  if (historyCount == 0 || now - lastHistoryMs >= BATTERY_HISTORY_INTERVAL_MS) {
+    history[historyNext] = chargePermille;
+    historyNext = (historyNext + 1) % BATTERY_HISTORY_POINTS;
+    if (historyCount < BATTERY_HISTORY_POINTS) historyCount++;
+    lastHistoryMs = now;
+    fitHistory();
+  }
+}
+
+// Least-squares slope of the charge history against time
+void BatteryMonitor::fitHistory() {
+  if (historyCount < BATTERY_MIN_FIT_POINTS) {
+    slopePermillePerHour = 0;
+    return;
+  }
+
+  // Points are one interval apart, oldest first at x = 0
+  int oldest = (historyNext - historyCount + BATTERY_HISTORY_POINTS) % BATTERY_HISTORY_POINTS;
+  int32_t n = historyCount;
+  int32_t sumX = n * (n - 1) / 2;
+  int32_t sumXX = (n - 1) * n * (2 * n - 1) / 6;
+  int32_t sumY = 0;
+  int32_t sumXY = 0;
+  for (int i = 0; i < historyCount; i++) {
+    int32_t y = history[(oldest + i) % BATTERY_HISTORY_POINTS];
+    sumY += y;
+    sumXY += i * y;
+  }
+  // Per mille per interval, scaled to per hour
+  int32_t numerator = n * sumXY - sumX * sumY;
+  int32_t denominator = n * sumXX - sumX * sumX;
+  slopePermillePerHour = (int32_t)((int64_t)numerator * (3600000 / BATTERY_HISTORY_INTERVAL_MS) / denominator);
+}
+
+float BatteryMonitor::voltage() const {
+  return millivolts / 1000.0f;
+}
+
+int BatteryMonitor::percent() const {
+  return (chargePermille + 5) / 10;
+}
+
+int BatteryMonitor::minutesRemaining() const {
+  if (slopePermillePerHour > -MIN_SLOPE_PERMILLE_PER_HOUR) return -1;
+  return (int)((int32_t)chargePermille * 60 / -slopePermillePerHour);
+}
+
+bool BatteryMonitor::isCharging() const {
+  return slopePermillePerHour >= MIN_SLOPE_PERMILLE_PER_HOUR;
+}
+
+const BatteryStats& BatteryMonitor::getStats() const {
+  return stats;
+}
+
+uint16_t BatteryMonitor::chargeForVoltage(uint16_t mv) {
+  if (mv <= dischargeCurve[0].millivolts) return 0;
+  for (size_t i = 1; i < CURVE_POINTS; i++) {
+    const ChargePoint& high = dischargeCurve[i];
+    if (mv < high.millivolts) {
+      const ChargePoint& low = dischargeCurve[i - 1];
+      return low.permille + (uint32_t)(mv - low.millivolts) * (high.permille - low.permille) /
+                            (high.millivolts - low.millivolts);
+    }
+  }
+  return 1000;
+}
@@ -0,0 +1,252 @@
+#include "blit.h"
+#include <string.h>
+
+// Word access to byte buffers without breaking strict aliasing
+typedef uint32_t __attribute__((may_alias)) BlitWord;
+
+#define BLIT_WORDS (BLIT_BUFFER_SIZE / 4)
+
+// Bits of the given page covering rows [y0, y1); the caller clips to the page
+static inline uint8_t pageBits(int page, int y0, int y1) {
+  int top = page * 8;
+  int lo = y0 > top ? y0 - top : 0;
+  int hi = y1 < top + 8 ? y1 - top : 8;
+  return (uint8_t)((0xFF << lo) & (0xFF >> (8 - hi)));
+}
+
+static inline void clip(int& lo, int& hi, int limit) {
+  if (lo < 0) lo = 0;
+  if (hi > limit) hi = limit;
+}
+
+void blitToPages(const uint8_t* bitmap, uint8_t* pages) {
+  const int rowBytes = BLIT_WIDTH / 8;
+
+  // Each 8x8 block is a bit transpose: source row r, bit 7 - i becomes
+  // bit r of output column i
+  for (int page = 0; page < BLIT_PAGES; page++) {
+    const uint8_t* rows = bitmap + page * 8 * rowBytes;
+    uint8_t* out = pages + page * BLIT_WIDTH;
+    for (int block = 0; block < rowBytes; block++) {
+      uint8_t column[8] = {0};
+      for (int r = 0; r < 8; r++) {
+        uint8_t bits = rows[r * rowBytes + block];
+        for (int i = 0; bits; i++, bits <<= 1) {
+          if (bits & 0x80) column[i] |= 1 << r;
+        }
+      }
+      memcpy(out + block * 8, column, 8);
+    }
+  }
+}
+
+void blitImage(uint8_t* dst, const uint8_t* src) {
+  memcpy(dst, src, BLIT_BUFFER_SIZE);
+}
+
+void blitMerge(uint8_t* dst, const uint8_t* src, const uint8_t* mask) {
+  BlitWord* d = (BlitWord*)dst;
+  const BlitWord* s = (const BlitWord*)src;
+  const BlitWord* m = (const BlitWord*)mask;
+  for (int i = 0; i < BLIT_WORDS; i++) {
+    d[i] = (d[i] & ~m[i]) | (s[i] & m[i]);
+  }
+}
+
+void blitAnd(uint8_t* dst, const uint8_t* src, const uint8_t* mask) {
+  BlitWord* d = (BlitWord*)dst;
+  const BlitWord* s = (const BlitWord*)src;
+  const BlitWord* m = (const BlitWord*)mask;
+  for (int i = 0; i < BLIT_WORDS; i++) {
+    d[i] = s[i] & m[i];
+  }
+}
+
+void blitRows(uint8_t* dst, const uint8_t* src, int y0, int y1) {
+  clip(y0, y1, BLIT_HEIGHT);
+  if (y0 >= y1) return;
+
+  for (int page = y0 / 8; page <= (y1 - 1) / 8; page++) {
+    uint8_t bits = pageBits(page, y0, y1);
+    uint8_t* d = dst + page * BLIT_WIDTH;
+    const uint8_t* s = src + page * BLIT_WIDTH;
+    if (bits == 0xFF) {
+      memcpy(d, s, BLIT_WIDTH);
+    } else {
+      for (int x = 0; x < BLIT_WIDTH; x++) {
+        d[x] = (d[x] & ~bits) | (s[x] & bits);
+      }
+    }
+  }
+}
+
+void blitRect(uint8_t* dst, const uint8_t* src, int x, int y, int w, int h) {
+  int x1 = x + w;
+  int y1 = y + h;
+  clip(x, x1, BLIT_WIDTH);
+  clip(y, y1, BLIT_HEIGHT);
+  if (x >= x1 || y >= y1) return;
+
+  for (int page = y / 8; page <= (y1 - 1) / 8; page++) {
+    uint8_t bits = pageBits(page, y, y1);
+    uint8_t* d = dst + page * BLIT_WIDTH;
+    const uint8_t* s = src + page * BLIT_WIDTH;
+    for (int col = x; col < x1; col++) {
+      d[col] = (d[col] & ~bits) | (s[col] & bits);
+    }
+  }
+}
+
+void blitColumns(uint8_t* dst, const uint8_t* src, int x0, int x1) {
+  clip(x0, x1, BLIT_WIDTH);
+  if (x0 >= x1) return;
+
+  for (int page = 0; page < BLIT_PAGES; page++) {
+    memcpy(dst + page * BLIT_WIDTH + x0, src + page * BLIT_WIDTH + x0, x1 - x0);
+  }
+}
+
+void blitShift(uint8_t* dst, const uint8_t* src, int dx) {
+  if (dx <= -BLIT_WIDTH || dx >= BLIT_WIDTH) {
+    memset(dst, 0, BLIT_BUFFER_SIZE);
+    return;
+  }
+
+  int width = BLIT_WIDTH - (dx < 0 ? -dx : dx);
+  for (int page = 0; page < BLIT_PAGES; page++) {
+    uint8_t* d = dst + page * BLIT_WIDTH;
+    const uint8_t* s = src + page * BLIT_WIDTH;
+    if (dx >= 0) {
+      memset(d, 0, dx);
+      memcpy(d + dx, s, width);
+    } else {
+      memcpy(d, s - dx, width);
+      memset(d + width, 0, -dx);
+    }
+  }
+}
+
+void maskClear(uint8_t* mask) {
+  memset(mask, 0, BLIT_BUFFER_SIZE);
+}
+
+void maskRect(uint8_t* mask, int x, int y, int w, int h) {
+  int x1 = x + w;
+  int y1 = y + h;
+  clip(x, x1, BLIT_WIDTH);
+  clip(y, y1, BLIT_HEIGHT);
+  if (x >= x1 || y >= y1) return;
+
+  for (int page = y / 8; page <= (y1 - 1) / 8; page++) {
+    uint8_t bits = pageBits(page, y, y1);
+    uint8_t* m = mask + page * BLIT_WIDTH;
+    for (int col = x; col < x1; col++) {
+      m[col] |= bits;
+    }
+  }
+}
+
+// Byte lanes of x below those of t, as unsigned bytes: the lane's top bit
+// set where true. Compares the low 7 bits with a subtraction that cannot
+// borrow across lanes, then settles lanes whose top bits differ.
+static inline uint32_t lanesBelow(uint32_t x, uint32_t t) {
+  const uint32_t top = 0x80808080;
+  uint32_t lowAtLeast = (x | top) - (t & ~top);
+  return ((~x & t) | (~(x ^ t) & ~lowAtLeast)) & top;
+}
+
+// (x + k) mod 256 in each byte lane
+static inline uint32_t lanesAdd(uint32_t x, uint32_t k) {
+  const uint32_t top = 0x80808080;
+  return ((x & ~top) + (k & ~top)) ^ ((x ^ k) & top);
+}
+
+// The lanes' top bits as bits 0-3, lane 0 (the lowest address on the
+// little-endian C3) first
+static inline uint8_t laneBits(uint32_t lanes) {
+  return (uint8_t)((((lanes >> 7) * 0x01020408) >> 24) & 0x0F);
+}
+
+void maskReveal(uint8_t* mask, const RevealMap& map, int threshold, uint8_t offset) {
+  if (threshold <= 0 || threshold > 255) {
+    memset(mask, threshold <= 0 ? 0 : 0xFF, BLIT_BUFFER_SIZE);
+    return;
+  }
+
+  if (map.cellShift == 0) {
+    // One rank per pixel: a mask byte is two words of ranks, four compares each
+    const BlitWord* r = (const BlitWord*)map.ranks;
+    uint32_t t = threshold * 0x01010101u;
+    uint32_t k = offset * 0x01010101u;
+    for (int i = 0; i < BLIT_BUFFER_SIZE; i++, r += 2) {
+      uint32_t top = r[0];      // Rows 0-3 of the page
+      uint32_t bottom = r[1];   // Rows 4-7
+      if (offset) {
+        top = lanesAdd(top, k);
+        bottom = lanesAdd(bottom, k);
+      }
+      mask[i] = laneBits(lanesBelow(top, t)) | laneBits(lanesBelow(bottom, t)) << 4;
+    }
+    return;
+  }
+
+  // Larger cells: each rank sets a run of rows across the cell's columns
+  int size = 1 << map.cellShift;
+  int rows = 8 >> map.cellShift;
+  int cells = BLIT_PAGES * (BLIT_WIDTH >> map.cellShift);
+  uint8_t cellBits = 0xFF >> (8 - size);
+  const uint8_t* r = map.ranks;
+  for (int i = 0; i < cells; i++) {
+    uint8_t bits = 0;
+    for (int row = 0; row < rows; row++) {
+      if ((uint8_t)(*r++ + offset) < threshold) {
+        bits |= cellBits << (row * size);
+      }
+    }
+    memset(mask + i * size, bits, size);
+  }
+}
+
+int blitDirtyWindows(const uint8_t* prev, const uint8_t* next, BlitWindow* windows) {
+  const int wordsPerPage = BLIT_WIDTH / 4;
+  const BlitWord* a = (const BlitWord*)prev;
+  const BlitWord* b = (const BlitWord*)next;
+  int count = 0;
+
+  for (int page = 0; page < BLIT_PAGES; page++) {
+    // Narrow to the first and last differing word, then to bytes
+    const BlitWord* pa = a + page * wordsPerPage;
+    const BlitWord* pb = b + page * wordsPerPage;
+    int first = 0;
+    while (first < wordsPerPage && pa[first] == pb[first]) first++;
+    if (first == wordsPerPage) continue;
+    int last = wordsPerPage - 1;
+    while (pa[last] == pb[last]) last--;
+
+    const uint8_t* ra = prev + page * BLIT_WIDTH;
+    const uint8_t* rb = next + page * BLIT_WIDTH;
+    int x0 = first * 4;
+    while (ra[x0] == rb[x0]) x0++;
+    int x1 = last * 4 + 3;
+    while (ra[x1] == rb[x1]) x1--;
+
+    if (count > 0) {
+      BlitWindow& open = windows[count - 1];
+      if (open.page1 == page - 1) {
+        int pages = open.page1 - open.page0 + 1;
+        int ux0 = x0 < open.x0 ? x0 : open.x0;
+        int ux1 = x1 > open.x1 ? x1 : open.x1;
+        int apart = pages * (open.x1 - open.x0 + 1) + (x1 - x0 + 1) + BLIT_WINDOW_OVERHEAD;
+        int together = (pages + 1) * (ux1 - ux0 + 1);
+        if (together <= apart) {
+          open.page1 = page;
+          open.x0 = ux0;
+          open.x1 = ux1;
+          continue;
+        }
+      }
+    }
+    windows[count++] = {(uint8_t)page, (uint8_t)page, (uint8_t)x0, (uint8_t)x1};
+  }
+  return count;
+}
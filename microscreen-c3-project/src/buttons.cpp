@@ -0,0 +1,209 @@
+#include "buttons.h"
+#include <driver/gpio.h>
+
+#define DEBOUNCE_US ((uint32_t)BUTTON_DEBOUNCE_MS * 1000)
+#define LONG_PRESS_US ((uint32_t)BUTTON_LONG_PRESS_MS * 1000)
+#define DOUBLE_CLICK_US ((uint32_t)BUTTON_DOUBLE_CLICK_MS * 1000)
+
+static const char* buttonNames[] = {"Reset", "Menu", "Onboard"};
+static_assert(sizeof(buttonNames) / sizeof(buttonNames[0]) == BUTTON_COUNT, "One name per button");
+
+static const char* gestureNames[] = {"pressed", "click", "double click", "long press"};
+
+bool ButtonInput::begin(uint8_t resetPin, uint8_t menuPin, uint8_t onboardPin) {
+  edges = xQueueCreate(BUTTON_EDGE_QUEUE_LENGTH, sizeof(Edge));
+  if (edges == nullptr) {
+    Serial.println("Buttons: cannot create the edge queue");
+    return false;
+  }
+
+  const uint8_t pins[BUTTON_COUNT] = {resetPin, menuPin, onboardPin};
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    Button& button = buttons[i];
+    button = {};
+    button.owner = this;
+    button.id = static_cast<ButtonId>(i);
+    button.pin = pins[i];
+    pinMode(button.pin, INPUT_PULLUP);
+    button.pressed = digitalRead(button.pin) == LOW;
+    attachInterruptArg(button.pin, onEdge, &button, CHANGE);
+  }
+  return true;
+}
+
+// Runs in the interrupt: timestamp and queue, nothing else
+void IRAM_ATTR ButtonInput::onEdge(void* arg) {
+  Button* button = static_cast<Button*>(arg);
+  Edge edge = {button->id, digitalRead(button->pin) == LOW, (uint32_t)micros()};
+  BaseType_t woken = pdFALSE;
+  if (xQueueSendFromISR(button->owner->edges, &edge, &woken) != pdTRUE) {
+    button->owner->overflows++;
+  }
+  if (woken) {
+    portYIELD_FROM_ISR();
+  }
+}
+
+bool ButtonInput::next(ButtonEvent& event) {
+  Edge edge;
+  while (xQueueReceive(edges, &edge, 0) == pdTRUE) {
+    stats.edges++;
+    Button& button = buttons[edge.id];
+    if (edge.us - button.acceptedUs >= DEBOUNCE_US) {
+      settle(button);
+    }
+    if (edge.us - button.acceptedUs < DEBOUNCE_US) {
+      // Bounce: remember where it leaves the pin, settled once the window ends
+      stats.bounces++;
+      button.settling = true;
+      button.settleLevel = edge.pressed;
+      button.settleUs = edge.us;
+      continue;
+    }
+    if (edge.pressed != button.pressed) {
+      accept(button, edge.pressed, edge.us);
+    }
+  }
+
+  uint32_t lost = overflows;
+  if (lost != overflowsSeen) {
+    stats.overflows += lost - overflowsSeen;
+    overflowsSeen = lost;
+    resync();
+  }
+
+  uint32_t now = micros();
+  for (Button& button : buttons) {
+    if (button.settling && now - button.acceptedUs >= DEBOUNCE_US) {
+      settle(button);
+    }
+    if (button.pressed && !button.longSent && now - button.pressUs >= LONG_PRESS_US) {
+      button.longSent = true;
+      button.secondPress = false;
+      emit(button, BUTTON_LONG_PRESS, button.pressUs);
+    }
+  }
+
+  if (eventCount == 0) return false;
+  event = events[eventHead];
+  eventHead = (eventHead + 1) % BUTTON_EVENT_QUEUE_LENGTH;
+  eventCount--;
+  if (event.gesture == BUTTON_PRESSED) {
+    stats.maxLatencyUs = max(stats.maxLatencyUs, (uint32_t)micros() - event.edgeUs);
+  }
+  return true;
+}
+
+// A debounced change of state, and the gestures it completes
+void ButtonInput::accept(Button& button, bool pressed, uint32_t us) {
+  button.pressed = pressed;
+  button.acceptedUs = us;
+
+  if (pressed) {
+    button.secondPress = button.clicked && us - button.releaseUs <= DOUBLE_CLICK_US;
+    button.clicked = false;
+    button.pressUs = us;
+    button.longSent = false;
+    emit(button, BUTTON_PRESSED, us);
+  } else if (!button.longSent) {
+    emit(button, button.secondPress ? BUTTON_DOUBLE_CLICK : BUTTON_CLICK, button.pressUs);
+    button.clicked = !button.secondPress;
+    button.secondPress = false;
+    button.releaseUs = us;
+  }
+}
+
+// Ends a debounce window: a burst that left the pin changed counts as one edge
+void ButtonInput::settle(Button& button) {
+  if (!button.settling) return;
+  button.settling = false;
+  if (button.settleLevel != button.pressed) {
+    accept(button, button.settleLevel, button.settleUs);
+  }
+}
+
+void ButtonInput::emit(const Button& button, ButtonGesture gesture, uint32_t edgeUs) {
+  if (eventCount == BUTTON_EVENT_QUEUE_LENGTH) {
+    stats.overflows++;
+    return;
+  }
+  events[(eventHead + eventCount) % BUTTON_EVENT_QUEUE_LENGTH] = {button.id, gesture, edgeUs};
+  eventCount++;
+  stats.events++;
+}
+
+// After lost edges or a light sleep, take the state from the pins as they are now
+void ButtonInput::resync() {
+  uint32_t now = micros();
+  for (Button& button : buttons) {
+    bool pressed = digitalRead(button.pin) == LOW;
+    button.settling = false;
+    if (pressed != button.pressed) {
+      accept(button, pressed, now);
+    }
+  }
+}
+
+// Until a settling button or a long press next needs next() to look at it
+uint32_t ButtonInput::msUntilTimer(uint32_t now) const {
+  uint32_t untilUs = UINT32_MAX;
+  for (const Button& button : buttons) {
+    if (button.settling) {
+      uint32_t elapsed = now - button.acceptedUs;
+      untilUs = min(untilUs, elapsed < DEBOUNCE_US ? DEBOUNCE_US - elapsed : 0);
+    }
+    if (button.pressed && !button.longSent) {
+      uint32_t elapsed = now - button.pressUs;
+      untilUs = min(untilUs, elapsed < LONG_PRESS_US ? LONG_PRESS_US - elapsed : 0);
+    }
+  }
+  return untilUs == UINT32_MAX ? UINT32_MAX : (untilUs + 999) / 1000;
+}
+
+void ButtonInput::waitForInput(uint32_t ms) {
+  ms = min(ms, msUntilTimer(micros()));
+  if (ms == 0 || edges == nullptr) return;
+  Edge edge;
+  xQueuePeek(edges, &edge, pdMS_TO_TICKS(ms));
+}
+
+bool ButtonInput::isIdle() const {
+  for (const Button& button : buttons) {
+    if (button.pressed || button.settling) return false;
+  }
+  return edges == nullptr || uxQueueMessagesWaiting(edges) == 0;
+}
+
+// Wakeup uses the pin's interrupt type, so the edge interrupt is masked
+// while it is set to low level
+void ButtonInput::armWakeup() {
+  for (Button& button : buttons) {
+    gpio_intr_disable((gpio_num_t)button.pin);
+    gpio_wakeup_enable((gpio_num_t)button.pin, GPIO_INTR_LOW_LEVEL);
+  }
+}
+
+void ButtonInput::disarmWakeup() {
+  for (Button& button : buttons) {
+    gpio_wakeup_disable((gpio_num_t)button.pin);
+    gpio_set_intr_type((gpio_num_t)button.pin, GPIO_INTR_ANYEDGE);
+    gpio_intr_enable((gpio_num_t)button.pin);
+  }
+  resync();
+}
+
+bool ButtonInput::isPressed(ButtonId id) const {
+  return id < BUTTON_COUNT && buttons[id].pressed;
+}
+
+const ButtonStats& ButtonInput::getStats() const {
+  return stats;
+}
+
+const char* ButtonInput::name(ButtonId id) {
+  return id < BUTTON_COUNT ? buttonNames[id] : "Unknown";
+}
+
+const char* ButtonInput::name(ButtonGesture gesture) {
+  return gesture <= BUTTON_LONG_PRESS ? gestureNames[gesture] : "unknown";
+}
@@ -0,0 +1,57 @@
+#include "display_bench.h"
+#include "transition.h"
+
+// Runs of each transition per mode, averaged
+#define BENCH_RUNS 3
+
+// Microseconds for one unpaced run of the transition, frames counted into frames
+static unsigned long benchRun(OledDisplay& display, Transition& transition, TransitionType type,
+                              const uint8_t* from, const uint8_t* to, bool async, int& frames) {
+  blitImage(display.getBuffer(), from);
+  display.displayFull();
+
+  unsigned long start = micros();
+  transition.begin(type, to);
+  while (transition.isActive()) {
+    transition.step();
+    if (async) {
+      display.displayAsync();
+    } else {
+      display.display();
+    }
+    frames++;
+  }
+  display.waitForTransfer();
+  return micros() - start;
+}
+
+void runDisplayBenchmark(OledDisplay& display, const uint8_t* from, const uint8_t* to) {
+  static Transition transition(display); // Static: its mask is too big for the stack
+
+  Serial.println("Display benchmark: unpaced transitions, display() vs displayAsync()");
+  Serial.printf("%-18s %7s %10s %10s %8s\n", "transition", "frames", "sync fps", "async fps", "gain");
+
+  float syncTotal = 0;
+  float asyncTotal = 0;
+  int measured = 0;
+  for (int t = TRANSITION_CUT + 1; t < TRANSITION_COUNT; t++) {
+    TransitionType type = (TransitionType)t;
+    float fps[2];
+    int frames = 0;
+    for (int async = 0; async < 2; async++) {
+      unsigned long elapsed = 0;
+      frames = 0;
+      for (int run = 0; run < BENCH_RUNS; run++) {
+        elapsed += benchRun(display, transition, type, from, to, async, frames);
+      }
+      fps[async] = frames * 1e6f / elapsed;
+    }
+    Serial.printf("%-18s %7d %10.1f %10.1f %7.0f%%\n", Transition::name(type), frames / BENCH_RUNS,
+                  fps[0], fps[1], (fps[1] / fps[0] - 1) * 100);
+    syncTotal += fps[0];
+    asyncTotal += fps[1];
+    measured++;
+  }
+  Serial.printf("%-18s %7s %10.1f %10.1f %7.0f%%\n", "mean", "", syncTotal / measured, asyncTotal / measured,
+                (asyncTotal / syncTotal - 1) * 100);
+}
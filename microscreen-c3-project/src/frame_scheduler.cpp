@@ -0,0 +1,68 @@
+#include "frame_scheduler.h"
+
+FrameScheduler::FrameScheduler(uint32_t framesPerSecond)
+    : intervalUs(1000000UL / framesPerSecond) {
+}
+
+void FrameScheduler::start() {
+  nextDueUs = micros();
+  running = true;
+}
+
+void FrameScheduler::stop() {
+  running = false;
+}
+
+bool FrameScheduler::isRunning() const {
+  return running;
+}
+
+bool FrameScheduler::beginFrame() {
+  if (!running) return false;
+
+  uint32_t now = micros();
+  int32_t late = (int32_t)(now - nextDueUs);
+  if (late < 0) return false;
+
+  // Whole intervals missed are dropped, not made up
+  uint32_t missed = (uint32_t)late / intervalUs;
+  if (missed > 0) {
+    stats.dropped += missed;
+    nextDueUs += missed * intervalUs;
+    late -= missed * intervalUs;
+  }
+  nextDueUs += intervalUs;
+
+  stats.lateUs += late;
+  if ((uint32_t)late > stats.maxLateUs) {
+    stats.maxLateUs = late;
+  }
+  frameStartUs = now;
+  return true;
+}
+
+void FrameScheduler::endFrame() {
+  uint32_t work = micros() - frameStartUs;
+  stats.frames++;
+  stats.workUs += work;
+  if (work > stats.maxWorkUs) {
+    stats.maxWorkUs = work;
+  }
+  if (work > intervalUs) {
+    stats.overruns++;
+  }
+}
+
+uint32_t FrameScheduler::msUntilDue() const {
+  if (!running) return UINT32_MAX;
+  int32_t remaining = (int32_t)(nextDueUs - micros());
+  return remaining > 0 ? remaining / 1000 : 0;
+}
+
+uint32_t FrameScheduler::getIntervalUs() const {
+  return intervalUs;
+}
+
+const FrameStats& FrameScheduler::getStats() const {
+  return stats;
+}
@@ -8,6 +8,16 @@
 
 // Include all bitmap header files
 #include "../images/bmp/all.h"
+#include "blit.h" // Page-buffer kernels for the transitions
+#include "oled.h" // SSD1306 with partial updates
+#include "transition.h" // Transitions as resumable state machines
+#include "frame_scheduler.h" // Fixed-rate frame pacing
+#include "display_bench.h" // Optional sync/async display benchmark
+#include "asset_pack.h" // Meme packs on LittleFS
+#include "asset_server.h" // HTTP upload of meme packs
+#include "buttons.h" // Interrupt-driven buttons and gestures
+#include "battery.h" // Filtered, calibrated battery readings
+#include "power.h" // Clock scaling, modem sleep and screen dimming
 
 /*
  * ESP32 MEME MACHINE - Panel Display System
@@ -19,9 +29,17 @@
  * Each panel displays for 5 seconds with random transition effects:
  * - Pixelated transition (random block reveal)
  * - Slide transition (left/right sliding)
- * - Fade transition (checkerboard fade-in)
+ * - Fade transition (ordered-dither fade-in)
  * - Wipe transition (horizontal/vertical line reveal)
  * - Spiral transition (circular expanding reveal)
+ * - Diamond, dissolve and radial sweep reveals
+ * 
+ * Transitions compose frames straight into the display's page buffer with
+ * the byte/word kernels in blit.h rather than pixel by pixel. Each is a
+ * state machine (transition.h) that loop() steps at a fixed frame rate
+ * (frame_scheduler.h), so buttons, OTA and WiFi are serviced between
+ * frames and a button press can skip or interrupt a transition. Reveal
+ * orders come from maps generated at build time (tools/gen_reveal_maps.py).
  * 
  * WiFi auto-connects to preferred networks or creates AP mode as fallback.
  */
@@ -60,7 +78,6 @@ const unsigned long WIFI_TIMEOUT = 20000; // 20 seconds per network
 #define RESET_BUTTON_PIN 3 // GPIO3 - Reset/Change screen button
 #define MENU_BUTTON_PIN 2  // GPIO2 - Menu navigation button (new)
 #define ONBOARD_BUTTON_PIN 9 // GPIO9 - Onboard boot/user button
-#define BUTTON_DEBOUNCE_DELAY 50 // ms
 
 // LED Configuration
 #define ONBOARD_LED_PIN 8 // GPIO8 - Onboard red LED
@@ -69,22 +86,14 @@ const unsigned long WIFI_TIMEOUT = 20000; // 20 seconds per network
 // Battery Monitoring Configuration
 #define BATTERY_ADC_PIN 0 // GPIO0 - Battery voltage monitoring (ADC1_CH0)
 #define VOLTAGE_DIVIDER_RATIO 2.0 // Adjust based on your voltage divider circuit
-#define BATTERY_MAX_VOLTAGE 4.2 // Maximum battery voltage (4.2V for Li-ion)
-#define BATTERY_MIN_VOLTAGE 3.0 // Minimum usable battery voltage
-#define BATTERY_SAMPLE_COUNT 10 // Number of samples to average for stable reading
 
-// Initialize display object
-Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+// Initialize display object; display() only sends what changed (see oled.h)
+OledDisplay display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 
 // Display cycling "panels" configuration 
 enum DisplayMode
 {
-  DISPLAY_ANGY,      // Meme panel 1
-  DISPLAY_AW,        // Meme panel 2
-  DISPLAY_CONCORNED, // Meme panel 3
-  DISPLAY_KORBY,     // Meme panel 4
-  DISPLAY_SMUDGE,    // Meme panel 5
-  DISPLAY_WAT,       // Meme panel 6
+  DISPLAY_MEME,      // Meme panels, built-in then from packs (currentMeme)
   DISPLAY_WIFI_INFO, // WiFi information panel
   DISPLAY_BATTERY,   // Battery status panel
   DISPLAY_SYSTEM_INFO // System information panel
@@ -98,31 +107,21 @@ enum MenuMode
   MENU_SYSTEM     // System information submenu
 };
 
-DisplayMode currentDisplay = DISPLAY_ANGY; // Start with the first meme panel
+DisplayMode currentDisplay = DISPLAY_MEME; // Start with the first meme panel
+int currentMeme = 0;
 MenuMode currentMenu = MENU_NORMAL; // Start in normal mode
 unsigned long lastDisplayChange = 0;
 const unsigned long DISPLAY_INTERVAL = 5000; // 5 seconds per panel
 
 // Panel cycling configuration
 const unsigned long AUTO_CYCLE_INTERVAL = 10000; // 10 seconds per panel
+const unsigned long MODE_MESSAGE_DURATION = 2000; // Mode messages stay up this long
 const unsigned long MENU_TIMEOUT = 30000; // 30 seconds before returning to normal mode
 
-// Reset button state tracking
-bool resetButtonLastState = HIGH;
-unsigned long resetButtonLastChange = 0;
-bool resetButtonProcessed = false;
-
-// Menu button state tracking
-bool menuButtonLastState = HIGH;
-unsigned long menuButtonLastChange = 0;
-bool menuButtonProcessed = false;
+// Buttons: edges come from interrupts, gestures are handled in loop()
+ButtonInput buttons;
 unsigned long lastMenuActivity = 0;
 
-// Onboard button state tracking
-bool onboardButtonLastState = HIGH;
-unsigned long onboardButtonLastChange = 0;
-bool onboardButtonProcessed = false;
-
 // LED control variables
 bool ledState = false;
 unsigned long ledFlashStartTime = 0;
@@ -131,30 +130,45 @@ unsigned long ledFlashStartTime = 0;
 float batteryVoltage = 0.0;
 int batteryPercentage = 0;
 unsigned long lastBatteryRead = 0;
-const unsigned long BATTERY_READ_INTERVAL = 1000; // Read battery every second
+const unsigned long BATTERY_READ_INTERVAL = 1000; // Refresh the figures every second
+BatteryMonitor battery(BATTERY_ADC_PIN, VOLTAGE_DIVIDER_RATIO); // Samples in its own task
 
-// Add buffer for loading raw bitmaps
+// Power: dims and then switches off the panel without input, sleeps between loop passes
+PowerManager power(display, buttons);
+
+// Buffers in the display's page format (see blit.h): the image of a panel
+// drawn at runtime, which a transition reveals, and the frame on screen,
+// kept aside while that panel is drawn
 constexpr size_t BITMAP_BUF_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
-static uint8_t bitmapBuffer[BITMAP_BUF_SIZE];
-
-// Structure to hold bitmap info for panels
-struct BitmapInfo {
-  const unsigned char* bitmap;  // Pointer to PROGMEM bitmap data
-  uint16_t width;              // Direct value for width
-  uint16_t height;             // Direct value for height
-  const char* title;           // For serial logging
+static_assert(BITMAP_BUF_SIZE == BLIT_BUFFER_SIZE, "Blit kernels are sized for the 128x64 panel");
+alignas(4) static uint8_t bitmapBuffer[BITMAP_BUF_SIZE];
+alignas(4) static uint8_t savedFrame[BITMAP_BUF_SIZE];
+
+// Transition frame pacing: the loop steps the running transition once per
+// frame and services OTA, buttons and WiFi in between
+#define TRANSITION_FPS 25
+#define LOOP_IDLE_MS 10 // Longest sleep per loop pass, so buttons stay responsive
+Transition transition(display);
+FrameScheduler frameScheduler(TRANSITION_FPS);
+OledStats transitionBusStart;
+FrameStats transitionFrameStart;
+unsigned long transitionStartMs = 0;
+
+// Effects picked at random for each kind of panel
+const TransitionType memeTransitions[] = {
+  TRANSITION_PIXELATED, TRANSITION_SLIDE_RIGHT, TRANSITION_SLIDE_LEFT, TRANSITION_WIPE_DOWN, TRANSITION_SPIRAL,
+  TRANSITION_DIAMOND, TRANSITION_DISSOLVE, TRANSITION_SWEEP
+};
+#define MEME_TRANSITION_COUNT (sizeof(memeTransitions) / sizeof(memeTransitions[0]))
+const TransitionType wifiTransitions[] = {
+  TRANSITION_FADE, TRANSITION_WIPE_RIGHT, TRANSITION_WIPE_DOWN, TRANSITION_SLIDE_RIGHT, TRANSITION_CUT
 };
 
-// Array of bitmap info for easy panel cycling
-const BitmapInfo memes[] = {
-    {angy, SCREEN_WIDTH, SCREEN_HEIGHT, "Angy"},
-    {aw, SCREEN_WIDTH, SCREEN_HEIGHT, "Aw"},
-    {concorned, SCREEN_WIDTH, SCREEN_HEIGHT, "Concorned"},
-    {korby, SCREEN_WIDTH, SCREEN_HEIGHT, "Korby"},
-    {smudge, SCREEN_WIDTH, SCREEN_HEIGHT, "Smudge"},
-    {wat, SCREEN_WIDTH, SCREEN_HEIGHT, "Wat"}};
-
-const int TOTAL_MEMES = sizeof(memes) / sizeof(memes[0]); // Total meme panels
+// The built-in meme images and memes[] table are generated into
+// images/bmp/all.h from images/memes/*.png by tools/convert_images.py before
+// each build. Images from packs on LittleFS follow them in the rotation and
+// are decoded into bitmapBuffer when their turn comes.
+AssetLibrary assets;
 
 // WiFi status tracking
 bool wifiConnected = false;
@@ -167,13 +181,14 @@ const unsigned long WIFI_CHECK_INTERVAL = 30000; // Check WiFi every 30 seconds
 GPIOViewer gpioViewer;
 
 // Function prototypes
+int memeCount();
+const char* memeTitle(int memeIndex);
 void displayPanelWithRandomTransition(int memeIndex);
 void displayWiFiPanelWithRandomTransition();
-void pixelatedTransition(const unsigned char* newBitmap, uint16_t width, uint16_t height);
-void slideTransition(const unsigned char* newBitmap, uint16_t width, uint16_t height, int direction);
-void fadeTransition(const unsigned char* newBitmap, uint16_t width, uint16_t height);
-void wipeTransition(const unsigned char* newBitmap, uint16_t width, uint16_t height, bool vertical);
-void spiralTransition(const unsigned char* newBitmap, uint16_t width, uint16_t height);
+void startTransition(TransitionType type, const uint8_t* image);
+void serviceTransition();
+void interruptTransition();
+void logTransitionStats();
 void cyclePanels();
 void displayModeMessage(const char* message, const char* submessage = nullptr);
 bool connectToWiFi();
@@ -181,9 +196,12 @@ void startAPMode();
 void displayWiFiStatus();
 void checkWiFiStatus();
 void displayWiFiInfoScreen();
-void checkResetButton();
-void checkMenuButton();
-void checkOnboardButton();
+void drawWiFiInfoScreen();
+void pollButtons();
+uint32_t msUntilNextJob();
+void handleResetButton(ButtonGesture gesture);
+void handleMenuButton(ButtonGesture gesture);
+void handleOnboardButton(ButtonGesture gesture);
 void flashLED();
 void updateLED();
 void readBatteryVoltage();
@@ -194,9 +212,6 @@ void displaySystemInfoPanel();
 void handleMenuNavigation();
 void displayWiFiInfoScreen();
 
-// Reset button function
-void checkResetButton();
-
 void setup()
 {
   Serial.begin(115200);
@@ -213,6 +228,7 @@ void setup()
   
   // Initialize ADC for battery monitoring
   analogReadResolution(12); // Set ADC resolution to 12 bits (0-4095)
+  battery.begin();
   
   // Debug: Check initial button states
   Serial.println("🎮 Button Initialization:");
@@ -280,6 +296,13 @@ void setup()
   }
   Serial.println("Button test complete.");
   
+  // From here on, button edges are caught by interrupts and queued
+  if (!buttons.begin(RESET_BUTTON_PIN, MENU_BUTTON_PIN, ONBOARD_BUTTON_PIN)) {
+    Serial.println("Buttons will not respond");
+  }
+  // Reset and menu are on RTC GPIOs, so either can wake the chip from deep sleep
+  power.begin((1ULL << RESET_BUTTON_PIN) | (1ULL << MENU_BUTTON_PIN));
+  
   // Initialize I2C and OLED Display
   Wire.begin(I2C_SDA, I2C_SCL);
   if (!display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR))
@@ -288,6 +311,7 @@ void setup()
     while (1)
       ; // Halt if display not found
   }
+  display.beginAsync(); // Transition frames transfer while the next renders
 
   // Show epic startup message
   display.clearDisplay();
@@ -318,6 +342,12 @@ void setup()
   displayWiFiStatus();
   delay(2000);
 
+  // Meme packs: on LittleFS whatever the network, uploads once there is one
+  if (assets.begin()) {
+    assets.scan();
+    assetServerBegin();
+  }
+
   // Initialize OTA (Over-The-Air updates) if WiFi is connected
   if (wifiConnected && !isAPMode) {
     ArduinoOTA.setHostname("ESP32-MEME-MACHINE");
@@ -401,18 +431,23 @@ void setup()
   display.display();
   delay(3000);
 
-  // Start with first meme panel, no transition, just display it
-  displayPanelWithRandomTransition(currentDisplay);
+#if DISPLAY_BENCHMARK
+  runDisplayBenchmark(display, memes[0].pages, memes[1].pages);
+#endif
+
+  // Start with first meme panel; loop() runs its transition
+  displayPanelWithRandomTransition(currentMeme);
   lastDisplayChange = millis();
   lastWiFiCheck = millis();
 
   Serial.println("🐱 MEME MACHINE ACTIVATED! 🐱");
-  Serial.print("Total meme panels loaded: "); Serial.println(TOTAL_MEMES);
-  Serial.print("Displaying panel: "); Serial.println(memes[currentDisplay].title);
-  Serial.println("Image rendering using display.drawBitmap().");
+  Serial.printf("Total meme panels loaded: %d (%d from packs)\n", memeCount(), assets.count());
+  Serial.print("Displaying panel: "); Serial.println(memeTitle(currentMeme));
+  Serial.println("Image rendering using page-format images and blits (blit.h).");
   Serial.println("🎮 Controls:");
-  Serial.println("   Reset Button (GPIO3): Change panel/navigate in menu");
-  Serial.println("   Menu Button (GPIO2): Enter menu/back to normal mode");
+  Serial.println("   Reset Button (GPIO3): Change panel/skip transition, hold for the first panel");
+  Serial.println("   Menu Button (GPIO2): Next menu panel, hold to go back to normal mode");
+  Serial.println("   Onboard Button (GPIO9): System info, double click for WiFi info");
   Serial.println("   Auto-cycle: Panels change every 10 seconds (normal mode)");
   
   // Initialize GPIOViewer for real-time GPIO monitoring (must be at end of setup)
@@ -467,18 +502,17 @@ void loop()
   // Handle OTA updates
   ArduinoOTA.handle();
   
-  // Check button inputs
-  checkResetButton();
-  checkMenuButton();
-  checkOnboardButton();
+  // Handle button gestures queued since the last pass
+  pollButtons();
   
   // Handle menu navigation and timeouts
   handleMenuNavigation();
   
-  // Read battery voltage periodically
+  // Pick up the latest filtered battery reading periodically
   if (millis() - lastBatteryRead >= BATTERY_READ_INTERVAL) {
     readBatteryVoltage();
     lastBatteryRead = millis();
+    power.checkBattery(batteryVoltage, batteryPercentage, battery.isCharging());
   }
   
   // Debug: Print button states and battery info every 3 seconds
@@ -495,7 +529,13 @@ void loop()
     Serial.print(batteryVoltage, 2);
     Serial.print("V (");
     Serial.print(batteryPercentage);
-    Serial.print("%)");
+    Serial.print("%");
+    if (battery.minutesRemaining() >= 0) {
+      Serial.printf(", ~%d min left", battery.minutesRemaining());
+    }
+    Serial.print(")");
+    Serial.printf(" | Input: max %lu us", (unsigned long)buttons.getStats().maxLatencyUs);
+    Serial.printf(" | Power: %s, ~%.1f mAh", PowerManager::name(power.getState()), power.getStats().milliampHours);
     
     // GPIOViewer reminder
     if (wifiConnected && !isAPMode) {
@@ -508,8 +548,11 @@ void loop()
     lastDebug = millis();
   }
   
-  // Check if it's time to change panel (only in normal auto-cycle mode)
-  if (currentMenu == MENU_NORMAL) {
+  // Step the running transition, or check if it's time to change panel
+  // (only in normal auto-cycle mode, with the screen on)
+  if (transition.isActive()) {
+    serviceTransition();
+  } else if (currentMenu == MENU_NORMAL && power.isScreenOn()) {
     unsigned long currentInterval = AUTO_CYCLE_INTERVAL;
     if (millis() - lastDisplayChange >= currentInterval)
     {
@@ -517,6 +560,13 @@ void loop()
     }
   }
 
+  // Pick up packs uploaded or removed over HTTP
+  if (assetServerTakeChanges()) {
+    assets.scan();
+    if (currentMeme >= memeCount()) currentMeme = 0;
+    Serial.printf("Meme panels: %d (%d from packs)\n", memeCount(), assets.count());
+  }
+
   // Periodically check WiFi status
   if (millis() - lastWiFiCheck >= WIFI_CHECK_INTERVAL)
   {
@@ -524,382 +574,160 @@ void loop()
     lastWiFiCheck = millis();
   }
 
-  delay(100); // Small delay to keep things responsive
+  // Clock, panel and WiFi power follow what the loop is doing
+  power.update(transition.isActive(), wifiConnected && !isAPMode, isAPMode);
+
+  // Sleep until the next frame is due; a button edge ends the sleep early.
+  // Between transitions, sleep until the next panel or battery refresh.
+  if (transition.isActive()) {
+    buttons.waitForInput(min(frameScheduler.msUntilDue(), (uint32_t)LOOP_IDLE_MS));
+  } else {
+    power.idle(msUntilNextJob());
+  }
+}
+
+// Until the panel cycles or the battery figures are next refreshed
+uint32_t msUntilNextJob() {
+  unsigned long now = millis();
+  unsigned long until = BATTERY_READ_INTERVAL - min(now - lastBatteryRead, BATTERY_READ_INTERVAL);
+  if (currentMenu == MENU_NORMAL && power.isScreenOn()) {
+    until = min(until, AUTO_CYCLE_INTERVAL - min(now - lastDisplayChange, AUTO_CYCLE_INTERVAL));
+  }
+  return (uint32_t)until;
+}
+
+// Built-in memes plus the images of every pack on LittleFS
+int memeCount() {
+  return MEME_IMAGE_COUNT + assets.count();
+}
+
+const char* memeTitle(int memeIndex) {
+  return memeIndex < MEME_IMAGE_COUNT ? memes[memeIndex].title : assets.title(memeIndex - MEME_IMAGE_COUNT);
 }
 
 // Display the meme panel with a random transition effect
 void displayPanelWithRandomTransition(int memeIndex) {
-  if (memeIndex < 0 || memeIndex >= TOTAL_MEMES) {
+  if (memeIndex < 0 || memeIndex >= memeCount()) {
     Serial.println("Error: Invalid meme index in displayPanelWithRandomTransition.");
     return;
   }
   
-  const BitmapInfo& meme = memes[memeIndex];
+  // Pack images are decoded into bitmapBuffer, which the transition then
+  // reveals; a pack that no longer reads falls back to the first built-in
+  const uint8_t* image = memes[0].pages;
+  if (memeIndex < MEME_IMAGE_COUNT) {
+    image = memes[memeIndex].pages;
+  } else if (assets.load(memeIndex - MEME_IMAGE_COUNT, bitmapBuffer)) {
+    image = bitmapBuffer;
+  }
   
-  // Choose random transition effect
+  // First panel display - transition in from a clear screen
   static bool firstDisplay = true;
   if (firstDisplay) {
-    // First panel display - clear screen then use transition
     display.clearDisplay();
-    display.display();
-    delay(200); // Brief pause before first transition
     firstDisplay = false;
   }
   
-  // Random transition selection (5 different effects)
-  int transitionType = random(0, 5);
-  
+  // Random transition selection
+  TransitionType type = memeTransitions[random(0, MEME_TRANSITION_COUNT)];
   Serial.print("Panel transition type: ");
-  switch(transitionType) {
-    case 0:
-      Serial.println("Pixelated");
-      pixelatedTransition(meme.bitmap, meme.width, meme.height);
-      break;
-    case 1:
-      Serial.println("Slide from right");
-      slideTransition(meme.bitmap, meme.width, meme.height, 0);
-      break;
-    case 2:
-      Serial.println("Slide from left");
-      slideTransition(meme.bitmap, meme.width, meme.height, 1);
-      break;
-    case 3:
-      Serial.println("Vertical wipe");
-      wipeTransition(meme.bitmap, meme.width, meme.height, true);
-      break;
-    case 4:
-      Serial.println("Spiral");
-      spiralTransition(meme.bitmap, meme.width, meme.height);
-      break;
-    default:
-      // Fallback to pixelated
-      pixelatedTransition(meme.bitmap, meme.width, meme.height);
-      break;
-  }
+  Serial.println(Transition::name(type));
+  startTransition(type, image);
 }
 
 // Display the WiFi info panel with a random transition effect
 void displayWiFiPanelWithRandomTransition() {
-  // Random transition selection for WiFi panel
-  int transitionType = random(0, 5);
+  // Draw the panel into bitmapBuffer, leaving the frame on screen as it was
+  uint8_t* buffer = display.getBuffer();
+  memcpy(savedFrame, buffer, BITMAP_BUF_SIZE);
+  drawWiFiInfoScreen();
+  memcpy(bitmapBuffer, buffer, BITMAP_BUF_SIZE);
+  memcpy(buffer, savedFrame, BITMAP_BUF_SIZE);
   
+  // Random transition selection for WiFi panel
+  TransitionType type = wifiTransitions[random(0, 5)];
   Serial.print("WiFi panel transition type: ");
-  switch(transitionType) {
-    case 0:
-      Serial.println("Pixelated fade-in");
-      // Create a temporary bitmap buffer for WiFi screen
-      display.clearDisplay();
-      displayWiFiInfoScreen(); // This renders to display buffer
-      // Since we can't easily extract the display buffer, use fade effect
-      fadeTransition(nullptr, SCREEN_WIDTH, SCREEN_HEIGHT);
-      break;
-    case 1:
-      Serial.println("Horizontal wipe");
-      display.clearDisplay();
-      display.display();
-      delay(100);
-      wipeTransition(nullptr, SCREEN_WIDTH, SCREEN_HEIGHT, false);
-      displayWiFiInfoScreen();
-      break;
-    case 2:
-      Serial.println("Vertical wipe");
-      display.clearDisplay(); 
-      display.display();
-      delay(100);
-      wipeTransition(nullptr, SCREEN_WIDTH, SCREEN_HEIGHT, true);
-      displayWiFiInfoScreen();
-      break;
-    case 3:
-      Serial.println("Slide in");
-      display.clearDisplay();
-      display.display();
-      delay(100);
-      slideTransition(nullptr, SCREEN_WIDTH, SCREEN_HEIGHT, 0);
-      displayWiFiInfoScreen();
-      break;
-    default:
-      Serial.println("Direct display");
-      displayWiFiInfoScreen();
-      break;
-  }
+  Serial.println(Transition::name(type));
+  startTransition(type, bitmapBuffer);
 }
 
-// Pixelated transition effect for panels
-void pixelatedTransition(const unsigned char* newBitmap, uint16_t width, uint16_t height) {
-  const int PIXEL_SIZE = 4; // Size of pixelated blocks
-  const int STEPS = 10;     // Increased steps for smoother transition
-  
-  // Create array to track which blocks have been revealed
-  const int blocksX = (width + PIXEL_SIZE - 1) / PIXEL_SIZE;
-  const int blocksY = (height + PIXEL_SIZE - 1) / PIXEL_SIZE;
-  const int totalBlocks = blocksX * blocksY;
-  
-  // Create array of block indices for random order
-  int* blockOrder = new int[totalBlocks];
-  for (int i = 0; i < totalBlocks; i++) {
-    blockOrder[i] = i;
-  }
-  
-  // Shuffle the array using Fisher-Yates algorithm
-  for (int i = totalBlocks - 1; i > 0; i--) {
-    int j = random(i + 1);
-    int temp = blockOrder[i];
-    blockOrder[i] = blockOrder[j];
-    blockOrder[j] = temp;
-  }
-  
-  // Perform transition in steps
-  int blocksPerStep = max(1, totalBlocks / STEPS);
-  
-  for (int step = 0; step < STEPS; step++) {
-    int startIdx = step * blocksPerStep;
-    int endIdx = min((step + 1) * blocksPerStep, totalBlocks);
-    
-    // Reveal blocks for this step
-    for (int idx = startIdx; idx < endIdx; idx++) {
-      int blockNum = blockOrder[idx];
-      int blockX = blockNum % blocksX;
-      int blockY = blockNum / blocksX;
-      
-      int pixelX = blockX * PIXEL_SIZE;
-      int pixelY = blockY * PIXEL_SIZE;
-      int blockWidth = min(PIXEL_SIZE, (int)width - pixelX);
-      int blockHeight = min(PIXEL_SIZE, (int)height - pixelY);
-      
-      // Clear the block area and draw the new bitmap section
-      display.fillRect(pixelX, pixelY, blockWidth, blockHeight, SSD1306_BLACK);
-      
-      // Draw the new bitmap section
-      for (int y = 0; y < blockHeight; y++) {
-        for (int x = 0; x < blockWidth; x++) {
-          int globalX = pixelX + x;
-          int globalY = pixelY + y;
-          
-          // Calculate byte position in bitmap
-          int byteIndex = (globalY * width + globalX) / 8;
-          int bitIndex = 7 - ((globalY * width + globalX) % 8);
-          
-          uint8_t byte = pgm_read_byte(&newBitmap[byteIndex]);
-          if (byte & (1 << bitIndex)) {
-            display.drawPixel(globalX, globalY, SSD1306_WHITE);
-          }
-        }
-      }
-    }
-    
-    display.display();
-    delay(40); // Slightly faster transition for smoother effect
-  }
-  
-  // Clean up
-  delete[] blockOrder;
-  
-  // Final complete redraw to ensure everything is correct
-  display.clearDisplay();
-  display.drawBitmap(0, 0, newBitmap, width, height, SSD1306_WHITE);
-  display.display();
-}
-
-// Slide transition effect for panels - slides new bitmap from specified direction
-void slideTransition(const unsigned char* newBitmap, uint16_t width, uint16_t height, int direction) {
-  const int STEPS = 16; // Number of slide steps
-  const int stepSize = width / STEPS;
-  
-  for (int step = 0; step < STEPS; step++) {
-    display.clearDisplay();
-    
-    if (direction == 0) { // Slide from right
-      int xOffset = width - (step + 1) * stepSize;
-      if (newBitmap != nullptr) {
-        display.drawBitmap(xOffset, 0, newBitmap, width, height, SSD1306_WHITE);
-      }
-    } else { // Slide from left
-      int xOffset = -width + (step + 1) * stepSize;
-      if (newBitmap != nullptr) {
-        display.drawBitmap(xOffset, 0, newBitmap, width, height, SSD1306_WHITE);
-      }
-    }
-    
-    display.display();
-    delay(30);
-  }
-  
-  // Final position
-  if (newBitmap != nullptr) {
-    display.clearDisplay();
-    display.drawBitmap(0, 0, newBitmap, width, height, SSD1306_WHITE);
-    display.display();
+// Replaces any running transition; frames are drawn from loop()
+void startTransition(TransitionType type, const uint8_t* image) {
+  if (transition.isActive()) {
+    Serial.println("  (interrupted the previous transition)");
   }
+  transition.begin(type, image);
+  transitionBusStart = display.getStats();
+  transitionFrameStart = frameScheduler.getStats();
+  transitionStartMs = millis();
+  frameScheduler.start();
 }
 
-// Fade transition effect for panels - gradually reveals new bitmap
-void fadeTransition(const unsigned char* newBitmap, uint16_t width, uint16_t height) {
-  const int STEPS = 8;
+// Draws and sends the next transition frame once it is due
+void serviceTransition() {
+  if (!transition.isActive() || !frameScheduler.beginFrame()) return;
   
-  for (int step = 0; step < STEPS; step++) {
-    display.clearDisplay();
-    
-    // Create a checkerboard pattern that gets denser each step
-    for (int y = 0; y < height; y++) {
-      for (int x = 0; x < width; x++) {
-        // Use step to determine probability of showing pixel
-        if ((x + y + step) % (STEPS - step + 1) == 0) {
-          if (newBitmap != nullptr) {
-            int byteIndex = (y * width + x) / 8;
-            int bitIndex = 7 - ((y * width + x) % 8);
-            uint8_t byte = pgm_read_byte(&newBitmap[byteIndex]);
-            if (byte & (1 << bitIndex)) {
-              display.drawPixel(x, y, SSD1306_WHITE);
-            }
-          } else {
-            // For WiFi panel, just show a pattern
-            if ((x + y) % 3 == 0) {
-              display.drawPixel(x, y, SSD1306_WHITE);
-            }
-          }
-        }
-      }
-    }
-    
-    display.display();
-    delay(60);
-  }
+  transition.step();
+  display.displayAsync();
+  frameScheduler.endFrame();
   
-  // Final complete image
-  if (newBitmap != nullptr) {
-    display.clearDisplay();
-    display.drawBitmap(0, 0, newBitmap, width, height, SSD1306_WHITE);
-    display.display();
+  if (!transition.isActive()) {
+    frameScheduler.stop();
+    display.waitForTransfer(); // Count the last frame's transfer in the stats
+    logTransitionStats();
+    lastDisplayChange = millis(); // The panel's time on screen starts now
   }
 }
 
-// Wipe transition effect for panels - reveals new bitmap with a moving line
-void wipeTransition(const unsigned char* newBitmap, uint16_t width, uint16_t height, bool vertical) {
-  const int STEPS = 20;
-  
-  for (int step = 0; step <= STEPS; step++) {
-    display.clearDisplay();
-    
-    if (vertical) {
-      // Vertical wipe from top to bottom
-      int revealHeight = (height * step) / STEPS;
-      if (newBitmap != nullptr) {
-        // Draw only the revealed portion
-        for (int y = 0; y < revealHeight; y++) {
-          for (int x = 0; x < width; x++) {
-            int byteIndex = (y * width + x) / 8;
-            int bitIndex = 7 - ((y * width + x) % 8);
-            uint8_t byte = pgm_read_byte(&newBitmap[byteIndex]);
-            if (byte & (1 << bitIndex)) {
-              display.drawPixel(x, y, SSD1306_WHITE);
-            }
-          }
-        }
-      }
-      // Draw wipe line
-      display.drawLine(0, revealHeight, width-1, revealHeight, SSD1306_WHITE);
-    } else {
-      // Horizontal wipe from left to right
-      int revealWidth = (width * step) / STEPS;
-      if (newBitmap != nullptr) {
-        // Draw only the revealed portion
-        for (int y = 0; y < height; y++) {
-          for (int x = 0; x < revealWidth; x++) {
-            int byteIndex = (y * width + x) / 8;
-            int bitIndex = 7 - ((y * width + x) % 8);
-            uint8_t byte = pgm_read_byte(&newBitmap[byteIndex]);
-            if (byte & (1 << bitIndex)) {
-              display.drawPixel(x, y, SSD1306_WHITE);
-            }
-          }
-        }
-      }
-      // Draw wipe line
-      display.drawLine(revealWidth, 0, revealWidth, height-1, SSD1306_WHITE);
-    }
-    
-    display.display();
-    delay(40);
-  }
-  
-  // Final complete image
-  if (newBitmap != nullptr) {
-    display.clearDisplay();
-    display.drawBitmap(0, 0, newBitmap, width, height, SSD1306_WHITE);
-    display.display();
+// Stops a transition mid-way, e.g. when a menu panel takes the screen
+void interruptTransition() {
+  if (transition.isActive()) {
+    Serial.printf("  Transition interrupted at frame %d/%d\n", transition.getFrame(), transition.getFrames());
+    transition.cancel();
+    frameScheduler.stop();
   }
 }
 
-// Spiral transition effect for panels - reveals bitmap in a spiral pattern
-void spiralTransition(const unsigned char* newBitmap, uint16_t width, uint16_t height) {
-  const int STEPS = 30;
-  const int centerX = width / 2;
-  const int centerY = height / 2;
-  const int maxRadius = max(width, height);
-  
-  for (int step = 0; step <= STEPS; step++) {
-    display.clearDisplay();
-    
-    int currentRadius = (maxRadius * step) / STEPS;
-    
-    if (newBitmap != nullptr) {
-      // Reveal pixels within spiral radius
-      for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-          int dx = x - centerX;
-          int dy = y - centerY;
-          int distance = sqrt(dx*dx + dy*dy);
-          
-          if (distance <= currentRadius) {
-            int byteIndex = (y * width + x) / 8;
-            int bitIndex = 7 - ((y * width + x) % 8);
-            uint8_t byte = pgm_read_byte(&newBitmap[byteIndex]);
-            if (byte & (1 << bitIndex)) {
-              display.drawPixel(x, y, SSD1306_WHITE);
-            }
-          }
-        }
-      }
-    }
-    
-    // Draw spiral border
-    display.drawCircle(centerX, centerY, currentRadius, SSD1306_WHITE);
-    
-    display.display();
-    delay(50);
-  }
-  
-  // Final complete image
-  if (newBitmap != nullptr) {
-    display.clearDisplay();
-    display.drawBitmap(0, 0, newBitmap, width, height, SSD1306_WHITE);
-    display.display();
-  }
+// Effective frame rate of the transition just run, its pacing, and what it cost on the bus
+void logTransitionStats() {
+  const OledStats& bus = display.getStats();
+  const FrameStats& pacing = frameScheduler.getStats();
+  unsigned long elapsed = millis() - transitionStartMs;
+  uint32_t frames = pacing.frames - transitionFrameStart.frames;
+  uint32_t bytes = bus.bytes - transitionBusStart.bytes;
+  uint32_t busyMs = (bus.busyUs - transitionBusStart.busyUs) / 1000;
+  uint32_t waitMs = (bus.waitUs - transitionBusStart.waitUs) / 1000;
+  if (frames == 0 || elapsed == 0) return;
+
+  Serial.printf("  %lu frames in %lu ms: %.1f fps (target %d), %lu overruns, %lu dropped, max late %lu us\n",
+                (unsigned long)frames, elapsed, frames * 1000.0f / elapsed, TRANSITION_FPS,
+                (unsigned long)(pacing.overruns - transitionFrameStart.overruns),
+                (unsigned long)(pacing.dropped - transitionFrameStart.dropped),
+                (unsigned long)pacing.maxLateUs);
+  Serial.printf("  %lu bytes/frame, %lu ms on the bus (%lu kHz), %lu ms waiting for it\n",
+                (unsigned long)(bytes / frames), (unsigned long)busyMs,
+                (unsigned long)(display.getBusClock() / 1000), (unsigned long)waitMs);
 }
 
 // Function to handle the cycling of panels
 void cyclePanels()
 {
   // Include WiFi info panel in the rotation
-  if (currentDisplay == DISPLAY_WAT) {
+  if (currentDisplay == DISPLAY_MEME && currentMeme >= memeCount() - 1) {
     // Switch to WiFi info panel after the last meme panel
     currentDisplay = DISPLAY_WIFI_INFO;
     Serial.println("Displaying WiFi Information Panel");
     displayWiFiPanelWithRandomTransition();
-  } else if (currentDisplay == DISPLAY_WIFI_INFO) {
-    // Return to first meme panel after WiFi info panel
-    currentDisplay = DISPLAY_ANGY;
-    Serial.print("Cycling to panel: ");
-    Serial.println(memes[currentDisplay].title);
-    displayPanelWithRandomTransition(currentDisplay);
   } else {
-    // Normal meme panel cycling
-    currentDisplay = static_cast<DisplayMode>((static_cast<int>(currentDisplay) + 1));
+    // Next meme panel, or the first one again after the WiFi info panel
+    currentMeme = currentDisplay == DISPLAY_MEME ? currentMeme + 1 : 0;
+    currentDisplay = DISPLAY_MEME;
     Serial.print("Cycling to panel: ");
-    Serial.println(memes[currentDisplay].title);
-    displayPanelWithRandomTransition(currentDisplay);
+    Serial.println(memeTitle(currentMeme));
+    displayPanelWithRandomTransition(currentMeme);
   }
   
+  // Counted again from when the transition finishes
   lastDisplayChange = millis();
 }
 
@@ -1037,6 +865,12 @@ void checkWiFiStatus() {
 
 // Display WiFi information screen with nice formatting
 void displayWiFiInfoScreen() {
+  drawWiFiInfoScreen();
+  display.display();
+}
+
+// Draw the WiFi information screen into the display buffer
+void drawWiFiInfoScreen() {
   display.clearDisplay();
   display.setTextColor(SSD1306_WHITE);
   
@@ -1138,8 +972,6 @@ void displayWiFiInfoScreen() {
       display.fillCircle(95 + (i * 6), 50, 1, SSD1306_WHITE);
     }
   }
-  
-  display.display();
 }
 
 void displayModeMessage(const char* message, const char* submessage) {
@@ -1166,79 +998,48 @@ void displayModeMessage(const char* message, const char* submessage) {
   }
   
   display.display();
-  delay(2000); // Show the message for 2 seconds
+  
+  // Show the message for 2 seconds before auto-cycling resumes
+  lastDisplayChange = millis() - AUTO_CYCLE_INTERVAL + MODE_MESSAGE_DURATION;
 }
 
-// Read battery voltage and calculate percentage
+// Battery voltage and charge from the monitor's filtered readings
 void readBatteryVoltage() {
-  // Take multiple samples for stable reading
-  long adcSum = 0;
-  for (int i = 0; i < BATTERY_SAMPLE_COUNT; i++) {
-    adcSum += analogRead(BATTERY_ADC_PIN);
-    delay(1); // Small delay between samples
-  }
-  
-  // Calculate average ADC reading
-  int avgADC = adcSum / BATTERY_SAMPLE_COUNT;
-  
-  // Convert ADC reading to voltage
-  // ESP32-C3 ADC reference is 3.3V with 12-bit resolution (0-4095)
-  float adcVoltage = (avgADC / 4095.0) * 3.3;
-  
-  // Apply voltage divider ratio to get actual battery voltage
-  batteryVoltage = adcVoltage * VOLTAGE_DIVIDER_RATIO;
-  
-  // Calculate battery percentage
-  batteryPercentage = map(constrain(batteryVoltage * 100, BATTERY_MIN_VOLTAGE * 100, BATTERY_MAX_VOLTAGE * 100), 
-                         BATTERY_MIN_VOLTAGE * 100, BATTERY_MAX_VOLTAGE * 100, 0, 100);
-  
-  // Ensure percentage is within bounds
-  batteryPercentage = constrain(batteryPercentage, 0, 100);
+  battery.update();
+  batteryVoltage = battery.voltage();
+  batteryPercentage = battery.percent();
 }
 
-// Menu button handling with debouncing
-void checkMenuButton() {
-  unsigned long currentTime = millis();
-  
-  // Read current button state
-  bool menuButtonState = digitalRead(MENU_BUTTON_PIN);
-  
-  // Menu Button Logic
-  if (menuButtonState != menuButtonLastState) {
-    menuButtonLastChange = currentTime;
-    menuButtonProcessed = false;
-    Serial.print("Menu button state changed to: ");
-    Serial.println(menuButtonState ? "HIGH" : "LOW");
-  }
-  
-  if (!menuButtonProcessed && (currentTime - menuButtonLastChange) > BUTTON_DEBOUNCE_DELAY) {
-    if (menuButtonState == LOW && menuButtonLastState == HIGH) {
-      // Button press detected (falling edge after debounce)
-      Serial.println("MENU BUTTON PRESSED!");
-      menuButtonProcessed = true;
-      lastMenuActivity = currentTime;
-      
-      // Toggle between menu modes
-      switch (currentMenu) {
-        case MENU_NORMAL:
-          currentMenu = MENU_BATTERY;
-          Serial.println("Entered BATTERY menu");
-          displayBatteryPanel();
-          break;
-        case MENU_BATTERY:
-          currentMenu = MENU_SYSTEM;
-          Serial.println("Entered SYSTEM menu");
-          displaySystemInfoPanel();
-          break;
-        case MENU_SYSTEM:
-          currentMenu = MENU_NORMAL;
-          Serial.println("Returned to NORMAL mode");
-          displayModeMessage("Normal Mode", "Auto-cycling panels");
-          break;
-      }
+// Menu button handling - next menu panel, or back to normal mode when held
+void handleMenuButton(ButtonGesture gesture) {
+  if (gesture == BUTTON_PRESSED) {
+    lastMenuActivity = millis();
+    interruptTransition(); // The menu panel takes the screen straight away
+    
+    // Toggle between menu modes
+    switch (currentMenu) {
+      case MENU_NORMAL:
+        currentMenu = MENU_BATTERY;
+        Serial.println("Entered BATTERY menu");
+        displayBatteryPanel();
+        break;
+      case MENU_BATTERY:
+        currentMenu = MENU_SYSTEM;
+        Serial.println("Entered SYSTEM menu");
+        displaySystemInfoPanel();
+        break;
+      case MENU_SYSTEM:
+        currentMenu = MENU_NORMAL;
+        Serial.println("Returned to NORMAL mode");
+        displayModeMessage("Normal Mode", "Auto-cycling panels");
+        break;
     }
+  } else if (gesture == BUTTON_LONG_PRESS && currentMenu != MENU_NORMAL) {
+    // Held: straight back to normal mode from any menu panel
+    currentMenu = MENU_NORMAL;
+    Serial.println("Returned to NORMAL mode");
+    displayModeMessage("Normal Mode", "Auto-cycling panels");
   }
-  menuButtonLastState = menuButtonState;
 }
 
 // Handle menu navigation and timeouts
@@ -1296,6 +1097,12 @@ void displayBatteryPanel() {
   display.print("Level: ");
   display.print(batteryPercentage);
   display.print("%");
+  int minutesLeft = battery.minutesRemaining();
+  if (minutesLeft >= 0) {
+    display.printf("  ~%dh%02dm", minutesLeft / 60, minutesLeft % 60);
+  } else if (battery.isCharging()) {
+    display.print("  charging");
+  }
   
   // Battery bar indicator
   display.drawRect(5, 42, 100, 10, SSD1306_WHITE);
@@ -1354,68 +1161,84 @@ void displaySystemInfoPanel() {
   
   display.setCursor(2, 56);
   display.print("Memes: ");
-  display.print(TOTAL_MEMES);
+  display.print(memeCount());
   display.print(" loaded");
   
   display.display();
 }
 
-// Reset button handling with debouncing
-void checkResetButton() {
-  unsigned long currentTime = millis();
-  
-  // Read current button state
-  bool resetButtonState = digitalRead(RESET_BUTTON_PIN);
-  
-  // Reset Button Logic
-  if (resetButtonState != resetButtonLastState) {
-    resetButtonLastChange = currentTime;
-    resetButtonProcessed = false;
-    Serial.print("Reset button state changed to: ");
-    Serial.println(resetButtonState ? "HIGH" : "LOW");
-  }
-  
-  if (!resetButtonProcessed && (currentTime - resetButtonLastChange) > BUTTON_DEBOUNCE_DELAY) {
-    if (resetButtonState == LOW && resetButtonLastState == HIGH) {
-      // Button press detected (falling edge after debounce)
-      Serial.println("RESET BUTTON PRESSED!");
-      resetButtonProcessed = true;
-      
+// Reset button handling - next panel or skip the transition, first panel when held
+void handleResetButton(ButtonGesture gesture) {
+  if (gesture == BUTTON_PRESSED) {
+    if (transition.isActive()) {
+      // Skip to the end of the running transition
+      transition.finish();
+      display.display();
+      frameScheduler.stop();
+      logTransitionStats();
+      lastDisplayChange = millis();
+      Serial.println("Transition skipped by reset button");
+    } else {
       // Immediately cycle to the next panel
       cyclePanels();
       Serial.println("Panel changed by reset button");
     }
+  } else if (gesture == BUTTON_LONG_PRESS) {
+    // Held: back to the first meme panel
+    currentDisplay = DISPLAY_MEME;
+    currentMeme = 0;
+    Serial.print("Back to the first panel: ");
+    Serial.println(memeTitle(currentMeme));
+    displayPanelWithRandomTransition(currentMeme);
+    lastDisplayChange = millis();
   }
-  resetButtonLastState = resetButtonState;
 }
 
-// Onboard button handling - currently just for testing/boot mode
-void checkOnboardButton() {
-  unsigned long currentTime = millis();
-  
-  // Read current button state
-  bool onboardButtonState = digitalRead(ONBOARD_BUTTON_PIN);
-  
-  // Onboard Button Logic
-  if (onboardButtonState != onboardButtonLastState) {
-    onboardButtonLastChange = currentTime;
-    onboardButtonProcessed = false;
-    Serial.print("Onboard button state changed to: ");
-    Serial.println(onboardButtonState ? "HIGH" : "LOW");
+// Onboard button handling - system information, or WiFi information on a double click
+void handleOnboardButton(ButtonGesture gesture) {
+  if (gesture == BUTTON_PRESSED) {
+    interruptTransition();
+    displaySystemInfoPanel();
+    Serial.println("Displayed system information panel");
+  } else if (gesture == BUTTON_DOUBLE_CLICK) {
+    interruptTransition();
+    displayWiFiInfoScreen();
+    Serial.println("Displayed WiFi information panel");
   }
-  
-  if (!onboardButtonProcessed && (currentTime - onboardButtonLastChange) > BUTTON_DEBOUNCE_DELAY) {
-    if (onboardButtonState == LOW && onboardButtonLastState == HIGH) {
-      // Button press detected (falling edge after debounce)
-      Serial.println("ONBOARD BUTTON PRESSED!");
-      onboardButtonProcessed = true;
-      
-      // For testing: Immediately show system info panel
-      displaySystemInfoPanel();
-      Serial.println("Displayed system information panel");
+}
+
+// Handles every gesture the button interrupts have queued since the last pass
+void pollButtons() {
+  // A press that only woke the screen does nothing else, nor do the
+  // gestures that press goes on to complete
+  static ButtonId wakingButton = BUTTON_COUNT;
+  ButtonEvent event;
+  while (buttons.next(event)) {
+    if (event.gesture == BUTTON_PRESSED) {
+      wakingButton = power.onInput() ? event.button : BUTTON_COUNT;
+    } else {
+      power.onInput();
+    }
+    if (event.button == wakingButton) {
+      Serial.printf("%s button %s woke the screen\n", ButtonInput::name(event.button), ButtonInput::name(event.gesture));
+      continue;
+    }
+    switch (event.button) {
+      case BUTTON_RESET:
+        handleResetButton(event.gesture);
+        break;
+      case BUTTON_MENU:
+        handleMenuButton(event.gesture);
+        break;
+      case BUTTON_ONBOARD:
+        handleOnboardButton(event.gesture);
+        break;
+      default:
+        break;
     }
+    Serial.printf("%s button %s, handled %lu us after the edge\n", ButtonInput::name(event.button),
+                  ButtonInput::name(event.gesture), (unsigned long)(micros() - event.edgeUs));
   }
-  onboardButtonLastState = onboardButtonState;
 }
 
 // LED control - flash LED briefly
@@ -0,0 +1,227 @@
+#include "oled.h"
+
+OledDisplay::OledDisplay(uint8_t width, uint8_t height, TwoWire* twi, int8_t resetPin)
+    : Adafruit_SSD1306(width, height, twi, resetPin), bus(twi) {
+}
+
+bool OledDisplay::begin(uint8_t switchvcc, uint8_t i2caddr) {
+  if (!Adafruit_SSD1306::begin(switchvcc, i2caddr)) {
+    return false;
+  }
+  address = i2caddr;
+
+  // Probe for an ACK at the fast clock. The library switches the clock
+  // around each of its own transfers, so it gets the same one.
+  const uint32_t clocks[] = {OLED_I2C_CLOCK, OLED_I2C_FALLBACK_CLOCK};
+  for (uint32_t clock : clocks) {
+    bus->setClock(clock);
+    bus->beginTransmission(address);
+    if (bus->endTransmission() == 0) {
+      busClock = clock;
+      break;
+    }
+  }
+  if (busClock == 0) {
+    busClock = OLED_I2C_FALLBACK_CLOCK;
+    bus->setClock(busClock);
+  }
+  wireClk = busClock;
+  restoreClk = busClock;
+
+  Serial.printf("OLED: I2C at %lu kHz, %d-byte transfers\n", (unsigned long)(busClock / 1000), OLED_CHUNK_BYTES);
+  sentValid = false;
+  return true;
+}
+
+void OledDisplay::display() {
+  // Checked once the bus is ours: a failed transfer clears it
+  acquire();
+  if (!sentValid) {
+    release();
+    displayFull();
+    return;
+  }
+  pendingCount = blitDirtyWindows(sent, getBuffer(), pending);
+  stats.updates++;
+  if (pendingCount == 0) {
+    stats.skipped++;
+  }
+  memcpy(sent, getBuffer(), BLIT_BUFFER_SIZE);
+  sendPending();
+  release();
+}
+
+void OledDisplay::displayFull() {
+  acquire();
+  memcpy(sent, getBuffer(), BLIT_BUFFER_SIZE);
+  sentValid = true;
+  pending[0] = {0, BLIT_PAGES - 1, 0, BLIT_WIDTH - 1};
+  pendingCount = 1;
+  stats.updates++;
+  stats.fullUpdates++;
+  sendPending();
+  release();
+}
+
+bool OledDisplay::beginAsync() {
+  if (transferTask != nullptr) return true;
+
+  transferReady = xSemaphoreCreateBinary();
+  transferIdle = xSemaphoreCreateBinary();
+  if (transferReady == nullptr || transferIdle == nullptr) {
+    Serial.println("OLED: no memory for async transfers");
+    return false;
+  }
+  xSemaphoreGive(transferIdle);
+  if (xTaskCreate(transferLoop, "oled", OLED_TASK_STACK, this, OLED_TASK_PRIORITY, &transferTask) != pdPASS) {
+    transferTask = nullptr;
+    Serial.println("OLED: could not start the transfer task");
+    return false;
+  }
+  Serial.println("OLED: async transfers enabled");
+  return true;
+}
+
+void OledDisplay::displayAsync() {
+  if (transferTask == nullptr) {
+    display();
+    return;
+  }
+
+  acquire();
+  if (!sentValid) {
+    release();
+    displayFull();
+    return;
+  }
+  pendingCount = blitDirtyWindows(sent, getBuffer(), pending);
+  stats.updates++;
+  if (pendingCount == 0) {
+    stats.skipped++;
+    release();
+    return;
+  }
+
+  // The swap: the frame moves to the front buffer and drawing carries on
+  // in the back one, which still holds it for incremental effects
+  memcpy(sent, getBuffer(), BLIT_BUFFER_SIZE);
+  xSemaphoreGive(transferReady); // The task releases the bus when done
+}
+
+void OledDisplay::waitForTransfer() {
+  acquire();
+  release();
+}
+
+void OledDisplay::transferLoop(void* arg) {
+  OledDisplay* self = (OledDisplay*)arg;
+  for (;;) {
+    xSemaphoreTake(self->transferReady, portMAX_DELAY);
+    self->sendPending();
+    self->release();
+  }
+}
+
+// Waits out a running transfer, leaving the front buffer and the bus to the caller
+void OledDisplay::acquire() {
+  if (transferTask == nullptr) return;
+  unsigned long start = micros();
+  xSemaphoreTake(transferIdle, portMAX_DELAY);
+  stats.waitUs += micros() - start;
+}
+
+void OledDisplay::release() {
+  if (transferTask == nullptr) return;
+  xSemaphoreGive(transferIdle);
+}
+
+void OledDisplay::sendPending() {
+  unsigned long start = micros();
+  int failed = 0;
+  for (int i = 0; i < pendingCount; i++) {
+    if (!sendWindow(pending[i])) failed++;
+  }
+  stats.windows += pendingCount;
+  stats.errors += failed;
+  stats.busyUs += micros() - start;
+
+  if (failed == 0) {
+    errorStreak = 0;
+    return;
+  }
+  // The panel no longer matches the front buffer: resend it all next time
+  sentValid = false;
+  if (++errorStreak >= OLED_I2C_MAX_ERRORS && busClock > OLED_I2C_FALLBACK_CLOCK) {
+    busClock = OLED_I2C_FALLBACK_CLOCK;
+    bus->setClock(busClock);
+    wireClk = busClock;
+    restoreClk = busClock;
+    errorStreak = 0;
+    Serial.printf("OLED: %d failed updates in a row, I2C down to %lu kHz\n", OLED_I2C_MAX_ERRORS,
+                  (unsigned long)(busClock / 1000));
+  }
+}
+
+void OledDisplay::invalidate() {
+  sentValid = false;
+}
+
+void OledDisplay::setContrast(uint8_t contrast) {
+  const uint8_t commands[] = {SSD1306_SETCONTRAST, contrast};
+  acquire();
+  ssd1306_commandList(commands, sizeof(commands));
+  release();
+}
+
+void OledDisplay::setPanelOn(bool on) {
+  acquire();
+  ssd1306_command1(on ? SSD1306_DISPLAYON : SSD1306_DISPLAYOFF);
+  release();
+}
+
+// Sends a window of the front buffer. In horizontal addressing mode (set
+// by the library's init) the panel wraps writes inside the window from
+// one page to the next, so the window's bytes stream out in full-size
+// transactions. False if a transaction was not acknowledged; the rest of
+// the window is not sent, as the panel's write position is then unknown
+bool OledDisplay::sendWindow(const BlitWindow& window) {
+  const uint8_t commands[] = {
+    SSD1306_PAGEADDR, window.page0, window.page1,
+    SSD1306_COLUMNADDR, window.x0, window.x1
+  };
+  ssd1306_commandList(commands, sizeof(commands));
+
+  const uint8_t* frame = sent;
+  int width = window.x1 - window.x0 + 1;
+  uint8_t chunk[OLED_CHUNK_BYTES];
+  int filled = 0;
+  for (int page = window.page0; page <= window.page1; page++) {
+    const uint8_t* row = frame + page * BLIT_WIDTH + window.x0;
+    for (int x = 0; x < width; ) {
+      int length = min(OLED_CHUNK_BYTES - filled, width - x);
+      memcpy(chunk + filled, row + x, length);
+      filled += length;
+      x += length;
+      bool last = page == window.page1 && x == width;
+      if (filled == OLED_CHUNK_BYTES || last) {
+        bus->beginTransmission(address);
+        bus->write((uint8_t)0x40); // Co = 0, D/C = 1: data follows
+        bus->write(chunk, filled);
+        if (bus->endTransmission() != 0) {
+          return false;
+        }
+        filled = 0;
+      }
+    }
+  }
+  stats.bytes += width * (window.page1 - window.page0 + 1);
+  return true;
+}
+
+uint32_t OledDisplay::getBusClock() const {
+  return busClock;
+}
+
+const OledStats& OledDisplay::getStats() const {
+  return stats;
+}
@@ -0,0 +1,185 @@
+#include "power.h"
+#include <WiFi.h>
+#include <esp_sleep.h>
+
+static const char* powerStateNames[] = {"ACTIVE", "IDLE", "DIM", "SCREEN OFF"};
+static_assert(sizeof(powerStateNames) / sizeof(powerStateNames[0]) == POWER_STATE_COUNT,
+              "One name per power state");
+
+PowerManager::PowerManager(OledDisplay& oled, ButtonInput& input) : display(oled), buttons(input) {
+}
+
+void PowerManager::begin(uint64_t deepSleepWakeMask) {
+  deepWakeMask = deepSleepWakeMask;
+  lastInputMs = millis();
+  stateStartMs = lastInputMs;
+  setCpuFrequencyMhz(POWER_IDLE_MHZ);
+  Serial.printf("Power: %s at %lu MHz, light sleep %s\n", name(state), (unsigned long)getCpuFrequencyMhz(),
+                POWER_LIGHT_SLEEP ? "on" : "off");
+}
+
+bool PowerManager::onInput() {
+  lastInputMs = millis();
+  bool wasOff = state == POWER_SCREEN_OFF;
+  if (state == POWER_DIM || wasOff) {
+    enter(POWER_IDLE);
+  }
+  return wasOff;
+}
+
+void PowerManager::update(bool animating, bool wifiStation, bool wifiAccessPoint) {
+  unsigned long sinceInput = millis() - lastInputMs;
+  PowerState next = animating ? POWER_ACTIVE : POWER_IDLE;
+  if (sinceInput >= POWER_OFF_AFTER_MS) {
+    next = POWER_SCREEN_OFF;
+  } else if (sinceInput >= POWER_DIM_AFTER_MS) {
+    next = POWER_DIM;
+  }
+
+  if (wifiStation != station || wifiAccessPoint != accessPoint) {
+    station = wifiStation;
+    accessPoint = wifiAccessPoint;
+    applyWiFi();
+  }
+  if (next != state) {
+    enter(next);
+  }
+
+  // The clock follows the frames, whatever the screen is doing
+  uint32_t mhz = animating ? POWER_ACTIVE_MHZ : POWER_IDLE_MHZ;
+  if (getCpuFrequencyMhz() != mhz) {
+    setCpuFrequencyMhz(mhz);
+  }
+}
+
+// Logs the state that ended and sets up the panel and WiFi for the next
+void PowerManager::enter(PowerState next) {
+  unsigned long now = millis();
+  unsigned long elapsed = now - stateStartMs;
+  float asleep = elapsed > 0 ? min(1.0f, (float)stateSleepMs / elapsed) : 0.0f;
+  float milliamps = estimateMilliamps(state, asleep);
+  stats.stateMs[state] += elapsed;
+  stats.milliampHours += milliamps * elapsed / 3600000.0f;
+  Serial.printf("Power: %s for %.1f s, %d%% asleep, ~%.1f mA; now %s\n", name(state), elapsed / 1000.0f,
+                (int)(asleep * 100 + 0.5f), milliamps, name(next));
+
+  if (state == POWER_SCREEN_OFF) {
+    display.setPanelOn(true);
+  }
+  if (next == POWER_SCREEN_OFF) {
+    display.setPanelOn(false);
+  } else if (next == POWER_DIM || state == POWER_DIM || state == POWER_SCREEN_OFF) {
+    display.setContrast(next == POWER_DIM ? POWER_DIM_CONTRAST : POWER_BRIGHT_CONTRAST);
+  }
+
+  bool wasOff = state == POWER_SCREEN_OFF;
+  state = next;
+  stateStartMs = now;
+  stateSleepMs = 0;
+  if (wasOff || next == POWER_SCREEN_OFF) {
+    applyWiFi();
+  }
+}
+
+// Station modem sleep: every DTIM beacon with the screen on, only at the
+// listen interval with it off
+void PowerManager::applyWiFi() {
+  if (!station) return;
+  WiFi.setSleep(state == POWER_SCREEN_OFF ? WIFI_PS_MAX_MODEM : WIFI_PS_MIN_MODEM);
+}
+
+float PowerManager::estimateMilliamps(PowerState forState, float asleep) const {
+  float cpu = forState == POWER_ACTIVE ? POWER_MA_CPU_ACTIVE : POWER_MA_CPU_IDLE;
+  float milliamps = cpu * (1.0f - asleep) + POWER_MA_LIGHT_SLEEP * asleep;
+  if (forState == POWER_DIM) {
+    milliamps += POWER_MA_OLED_DIM;
+  } else if (forState != POWER_SCREEN_OFF) {
+    milliamps += POWER_MA_OLED_BRIGHT;
+  }
+  if (accessPoint) {
+    milliamps += POWER_MA_WIFI_AP;
+  } else if (station) {
+    milliamps += forState == POWER_SCREEN_OFF ? POWER_MA_WIFI_STATION_MAX : POWER_MA_WIFI_STATION;
+  }
+  return milliamps;
+}
+
+void PowerManager::idle(uint32_t ms) {
+  ms = min(ms, (uint32_t)(state == POWER_SCREEN_OFF ? POWER_MAX_SLEEP_OFF_MS : POWER_MAX_SLEEP_MS));
+
+#if POWER_LIGHT_SLEEP
+  // Not while the radio is in use, whose association it would drop, nor
+  // while a button is in play, whose edges would be missed
+  if (ms >= POWER_MIN_SLEEP_MS && WiFi.getMode() == WIFI_OFF && buttons.isIdle()) {
+    display.waitForTransfer();
+    buttons.armWakeup();
+    esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+    esp_sleep_enable_gpio_wakeup();
+    unsigned long start = millis();
+    esp_err_t result = esp_light_sleep_start();
+    buttons.disarmWakeup();
+    if (result == ESP_OK) {
+      uint32_t slept = millis() - start;
+      stats.sleeps++;
+      stats.sleepMs += slept;
+      stateSleepMs += slept;
+      return;
+    }
+    stats.rejectedSleeps++;
+  }
+#endif
+
+  buttons.waitForInput(ms);
+}
+
+void PowerManager::checkBattery(float voltage, int percent, bool charging) {
+  if (voltage < POWER_NO_BATTERY_VOLTAGE || charging || percent > POWER_EMPTY_PERCENT) {
+    emptyReadings = 0;
+    return;
+  }
+  if (++emptyReadings >= POWER_EMPTY_READINGS) {
+    deepSleep();
+  }
+}
+
+// Does not return: the chip restarts from setup() when woken
+void PowerManager::deepSleep() {
+  Serial.printf("Power: battery empty, deep sleep; wakes on a button or in %d min\n", POWER_RECHECK_MINUTES);
+
+  display.clearDisplay();
+  display.setTextSize(1);
+  display.setTextColor(SSD1306_WHITE);
+  display.setCursor(25, 20);
+  display.print("Battery empty");
+  display.setCursor(10, 35);
+  display.print("Charge, then press");
+  display.setCursor(40, 45);
+  display.print("Reset");
+  display.display();
+  delay(3000);
+  display.setPanelOn(false);
+
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
+  if (deepWakeMask != 0) {
+    esp_deep_sleep_enable_gpio_wakeup(deepWakeMask, ESP_GPIO_WAKEUP_GPIO_LOW);
+  }
+  esp_sleep_enable_timer_wakeup((uint64_t)POWER_RECHECK_MINUTES * 60 * 1000000);
+  Serial.flush();
+  esp_deep_sleep_start();
+}
+
+bool PowerManager::isScreenOn() const {
+  return state != POWER_SCREEN_OFF;
+}
+
+PowerState PowerManager::getState() const {
+  return state;
+}
+
+const PowerStats& PowerManager::getStats() const {
+  return stats;
+}
+
+const char* PowerManager::name(PowerState powerState) {
+  return powerState < POWER_STATE_COUNT ? powerStateNames[powerState] : "Unknown";
+}
@@ -0,0 +1,165 @@
+#include "transition.h"
+#include "reveal_maps.h"
+
+#define PIXELATED_STEPS 10
+#define SLIDE_STEPS 16
+#define FADE_STEPS 8
+#define WIPE_STEPS 20
+#define SPIRAL_STEPS 18
+#define DIAMOND_STEPS 16
+#define DISSOLVE_STEPS 16
+#define SWEEP_STEPS 20
+
+static const char* transitionNames[] = {
+  "Cut", "Pixelated", "Slide from right", "Slide from left",
+  "Fade", "Vertical wipe", "Horizontal wipe", "Spiral",
+  "Diamond", "Dissolve", "Radial sweep"
+};
+static_assert(sizeof(transitionNames) / sizeof(transitionNames[0]) == TRANSITION_COUNT,
+              "One name per transition");
+
+Transition::Transition(Adafruit_SSD1306& target) : display(target) {
+}
+
+void Transition::begin(TransitionType transitionType, const uint8_t* newImage) {
+  type = transitionType;
+  image = newImage;
+  frame = 0;
+  active = true;
+  map = nullptr;
+  offset = 0;
+
+  // Animation frames, then the complete image
+  switch (type) {
+    case TRANSITION_PIXELATED:
+      frames = PIXELATED_STEPS + 1;
+      map = &revealPixelated;
+      offset = random(256);
+      break;
+    case TRANSITION_SLIDE_RIGHT:
+    case TRANSITION_SLIDE_LEFT:
+      frames = SLIDE_STEPS + 1;
+      break;
+    case TRANSITION_FADE:
+      frames = FADE_STEPS + 1;
+      map = &revealFade;
+      break;
+    case TRANSITION_WIPE_DOWN:
+    case TRANSITION_WIPE_RIGHT:
+      frames = WIPE_STEPS + 2;
+      break;
+    case TRANSITION_SPIRAL:
+      frames = SPIRAL_STEPS + 1;
+      map = &revealSpiral;
+      break;
+    case TRANSITION_DIAMOND:
+      frames = DIAMOND_STEPS + 1;
+      map = &revealDiamond;
+      break;
+    case TRANSITION_DISSOLVE:
+      frames = DISSOLVE_STEPS + 1;
+      map = &revealDissolve;
+      offset = random(256);
+      break;
+    case TRANSITION_SWEEP:
+      frames = SWEEP_STEPS + 1;
+      map = &revealSweep;
+      offset = random(256);
+      break;
+    default:
+      type = TRANSITION_CUT;
+      frames = 1;
+      break;
+  }
+}
+
+void Transition::step() {
+  if (!active) return;
+
+  if (frame == frames - 1) {
+    finish();
+    return;
+  }
+  drawFrame(frame++);
+}
+
+void Transition::finish() {
+  if (!active) return;
+  blitImage(display.getBuffer(), image);
+  frame = frames;
+  active = false;
+}
+
+void Transition::cancel() {
+  active = false;
+}
+
+// One frame of the animation
+void Transition::drawFrame(int index) {
+  uint8_t* buffer = display.getBuffer();
+
+  if (map != nullptr) {
+    // Cells ranked below the threshold show the new image; it reaches the
+    // top level only on the final, complete frame
+    int threshold = map->levels * (index + 1) / frames;
+    maskReveal(mask, *map, threshold, offset);
+    if (type == TRANSITION_SPIRAL) {
+      // The disc on a cleared screen, edged by a circle
+      blitAnd(buffer, image, mask);
+      display.drawCircle(BLIT_WIDTH / 2, BLIT_HEIGHT / 2, threshold - 1, SSD1306_WHITE);
+    } else {
+      // Over whatever is on screen
+      blitMerge(buffer, image, mask);
+    }
+    return;
+  }
+
+  switch (type) {
+    case TRANSITION_SLIDE_RIGHT:
+    case TRANSITION_SLIDE_LEFT: {
+      int travelled = (index + 1) * (BLIT_WIDTH / SLIDE_STEPS);
+      int shift = type == TRANSITION_SLIDE_RIGHT ? BLIT_WIDTH - travelled : travelled - BLIT_WIDTH;
+      blitShift(buffer, image, shift);
+      break;
+    }
+
+    case TRANSITION_WIPE_DOWN: {
+      int revealHeight = (BLIT_HEIGHT * index) / WIPE_STEPS;
+      memset(buffer, 0, BLIT_BUFFER_SIZE);
+      blitRows(buffer, image, 0, revealHeight);
+      display.drawLine(0, revealHeight, BLIT_WIDTH - 1, revealHeight, SSD1306_WHITE);
+      break;
+    }
+
+    case TRANSITION_WIPE_RIGHT: {
+      int revealWidth = (BLIT_WIDTH * index) / WIPE_STEPS;
+      memset(buffer, 0, BLIT_BUFFER_SIZE);
+      blitColumns(buffer, image, 0, revealWidth);
+      display.drawLine(revealWidth, 0, revealWidth, BLIT_HEIGHT - 1, SSD1306_WHITE);
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+bool Transition::isActive() const {
+  return active;
+}
+
+TransitionType Transition::getType() const {
+  return type;
+}
+
+int Transition::getFrame() const {
+  return frame;
+}
+
+int Transition::getFrames() const {
+  return frames;
+}
+
+const char* Transition::name(TransitionType transitionType) {
+  return transitionType < TRANSITION_COUNT ? transitionNames[transitionType] : "Unknown";
+}
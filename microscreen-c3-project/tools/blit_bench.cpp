@@ -0,0 +1,500 @@
+/*
+ * Host benchmark for the transition kernels in include/blit.h
+ *
+ * Replays every frame of the pixelated, slide, fade, wipe, spiral, diamond
+ * and sweep transitions two ways: per-pixel loops working the effect out
+ * as they go, as the firmware used to (pgm_read_byte + drawPixel with
+ * Adafruit_SSD1306's bounds, rotation and colour checks, sqrt and atan2
+ * per pixel), and the page-buffer kernels with the reveal maps from
+ * include/reveal_maps.h. Frames must match bit for bit; the report gives
+ * the compute time per frame of each.
+ *
+ * A second table models the I2C side: every frame sent whole at 400 kHz
+ * (Adafruit_SSD1306::display()) against only its changed windows
+ * (OledDisplay::display(), include/oled.h) at 400 kHz and 1 MHz, and the
+ * frame rate each gives with the transition's own delay().
+ *
+ * A third simulates the display pipeline frame by frame at 1 MHz, unpaced:
+ * display() renders and then sends each frame, displayAsync() hands it to
+ * the transfer task and renders the next while it goes out, waiting only
+ * when the previous transfer is still running. Render times are the
+ * host's scaled up to the C3 by a rough factor, the second argument.
+ *
+ * Build and run from the project directory:
+ *   g++ -O2 -Iinclude tools/blit_bench.cpp src/blit.cpp -o blit_bench && ./blit_bench [repeats] [cpu scale]
+ *
+ * Lines and circles drawn over a frame go through the display in both
+ * versions and are left out.
+ */
+
+#include "blit.h"
+#include "reveal_maps.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// Generated page-format image; the old loops read the row-major form
+alignas(4) static const unsigned char watPages[] = {
+#include "../images/bmp/wat.h"
+};
+static unsigned char wat[BLIT_BUFFER_SIZE];
+
+#define W BLIT_WIDTH
+#define H BLIT_HEIGHT
+
+// The parts of Adafruit_SSD1306/Adafruit_GFX the old loops went through
+struct PixelDisplay {
+  uint8_t buffer[BLIT_BUFFER_SIZE];
+  volatile uint8_t rotation = 0; // Read per pixel, as getRotation() is
+
+  void clearDisplay() { memset(buffer, 0, sizeof(buffer)); }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x >= 0 && x < W && y >= 0 && y < H) {
+      switch (rotation) {
+        case 1: { int16_t t = x; x = W - y - 1; y = t; break; }
+        case 2: x = W - x - 1; y = H - y - 1; break;
+        case 3: { int16_t t = x; x = y; y = H - t - 1; break; }
+      }
+      switch (color) {
+        case 1: buffer[x + (y / 8) * W] |= (1 << (y & 7)); break;
+        case 0: buffer[x + (y / 8) * W] &= ~(1 << (y & 7)); break;
+        case 2: buffer[x + (y / 8) * W] ^= (1 << (y & 7)); break;
+      }
+    }
+  }
+
+  // SSD1306's own fast vertical line, one column at a time
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t i = x; i < x + w; i++) {
+      for (int16_t j = y; j < y + h;) {
+        int16_t run = 8 - (j & 7);
+        if (run > y + h - j) run = y + h - j;
+        uint8_t bits = ((1 << run) - 1) << (j & 7);
+        uint8_t* p = &buffer[i + (j / 8) * W];
+        *p = color ? (*p | bits) : (*p & ~bits);
+        j += run;
+      }
+    }
+  }
+
+  void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
+    int16_t byteWidth = (w + 7) / 8;
+    uint8_t b = 0;
+    for (int16_t j = 0; j < h; j++, y++) {
+      for (int16_t i = 0; i < w; i++) {
+        if (i & 7) b <<= 1;
+        else b = bitmap[j * byteWidth + i / 8];
+        if (b & 0x80) drawPixel(x + i, y, color);
+      }
+    }
+  }
+};
+
+static PixelDisplay oldDisplay;
+alignas(4) static uint8_t newBuffer[BLIT_BUFFER_SIZE];
+alignas(4) static uint8_t pages[BLIT_BUFFER_SIZE];
+alignas(4) static uint8_t mask[BLIT_BUFFER_SIZE];
+
+static inline bool bitAt(const uint8_t* bitmap, int x, int y) {
+  int byteIndex = (y * W + x) / 8;
+  int bitIndex = 7 - ((y * W + x) % 8);
+  return bitmap[byteIndex] & (1 << bitIndex);
+}
+
+struct Result {
+  double oldNs = 0;
+  double newNs = 0;
+  int frames = 0;
+  bool match = true;
+  int delayMs = 0;          // The transition's delay() per frame
+  long partialBytes = 0;    // Frame bytes in changed windows
+  int windows = 0;
+  std::vector<double> renderNs;     // Per frame: kernels plus the window diff
+  std::vector<double> transfer1MUs; // Per frame: its windows at 1 MHz
+};
+
+// Bus model: 9 clocks a byte, plus start, address, control byte and stop
+// per transaction, plus Wire's own per-transaction time on the ESP32-C3
+#define I2C_TRANSACTION_CLOCKS 20
+#define I2C_TRANSACTION_US 40
+#define I2C_CHUNK_BYTES 127         // Wire's 128-byte buffer less the control byte
+
+static double transferUs(long bytes, long transactions, double clock) {
+  return (bytes * 9.0 + transactions * I2C_TRANSACTION_CLOCKS) * 1e6 / clock + transactions * I2C_TRANSACTION_US;
+}
+
+// The library sends a full frame as one 6-byte command list and 1 KB of data
+static double fullFrameUs(double clock) {
+  long transactions = 1 + (BLIT_BUFFER_SIZE + I2C_CHUNK_BYTES - 1) / I2C_CHUNK_BYTES;
+  return transferUs(BLIT_BUFFER_SIZE + 6, transactions, clock);
+}
+
+// What the transitions last sent, for planning the next frame's windows
+alignas(4) static uint8_t sentFrame[BLIT_BUFFER_SIZE];
+static long partialTransactions = 0;
+
+typedef std::chrono::steady_clock Clock;
+
+static double elapsedNs(Clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// Times one frame each way and compares the results
+template <typename OldFrame, typename NewFrame>
+static void frame(Result& result, int repeats, OldFrame oldFrame, NewFrame newFrame) {
+  uint8_t before[BLIT_BUFFER_SIZE];
+  memcpy(before, oldDisplay.buffer, sizeof(before));
+  memcpy(newBuffer, before, sizeof(before));
+
+  auto start = Clock::now();
+  for (int i = 0; i < repeats; i++) {
+    memcpy(oldDisplay.buffer, before, sizeof(before));
+    oldFrame();
+  }
+  result.oldNs += elapsedNs(start) / repeats;
+
+  uint8_t newBefore[BLIT_BUFFER_SIZE];
+  memcpy(newBefore, newBuffer, sizeof(newBefore));
+  start = Clock::now();
+  for (int i = 0; i < repeats; i++) {
+    memcpy(newBuffer, newBefore, sizeof(newBefore));
+    newFrame();
+  }
+  double renderNs = elapsedNs(start) / repeats;
+  result.newNs += renderNs;
+
+  result.frames++;
+  if (memcmp(oldDisplay.buffer, newBuffer, BLIT_BUFFER_SIZE) != 0) {
+    result.match = false;
+  }
+
+  BlitWindow windows[BLIT_PAGES];
+  int count = 0;
+  start = Clock::now();
+  for (int i = 0; i < repeats; i++) {
+    count = blitDirtyWindows(sentFrame, newBuffer, windows);
+  }
+  renderNs += elapsedNs(start) / repeats;
+
+  long frameBytes = 0;
+  long frameTransactions = 0;
+  for (int i = 0; i < count; i++) {
+    long bytes = (long)(windows[i].page1 - windows[i].page0 + 1) * (windows[i].x1 - windows[i].x0 + 1);
+    frameBytes += bytes;
+    frameTransactions += 1 + (bytes + I2C_CHUNK_BYTES - 1) / I2C_CHUNK_BYTES;
+  }
+  result.partialBytes += frameBytes;
+  partialTransactions += frameTransactions;
+  result.windows += count;
+  result.renderNs.push_back(renderNs);
+  result.transfer1MUs.push_back(transferUs(frameBytes + 7L * count, frameTransactions, 1000000));
+  memcpy(sentFrame, newBuffer, BLIT_BUFFER_SIZE);
+}
+
+// Threshold of the given animation step, as Transition::drawFrame() has it
+static int revealThreshold(const RevealMap& map, int step, int steps) {
+  return map.levels * (step + 1) / (steps + 1);
+}
+
+static Result pixelated(int repeats) {
+  const int PIXEL_SIZE = 4;
+  const int STEPS = 10;
+  const int blocksX = W / PIXEL_SIZE;
+  const int blocksY = H / PIXEL_SIZE;
+  const uint8_t offset = 77;
+
+  // The block order the firmware used to shuffle in, read out of the map
+  uint8_t blockRank[blocksY][blocksX];
+  for (int by = 0; by < blocksY; by++) {
+    for (int bx = 0; bx < blocksX; bx++) {
+      int index = ((by / 2) * blocksX + bx) * 2 + (by & 1);
+      blockRank[by][bx] = (uint8_t)(revealPixelatedRanks[index] + offset);
+    }
+  }
+
+  Result result;
+  result.delayMs = 40;
+  oldDisplay.clearDisplay();
+  int previous = 0;
+  for (int step = 0; step < STEPS; step++) {
+    int threshold = revealThreshold(revealPixelated, step, STEPS);
+    frame(result, repeats, [&]() {
+      for (int by = 0; by < blocksY; by++) {
+        for (int bx = 0; bx < blocksX; bx++) {
+          if (blockRank[by][bx] < previous || blockRank[by][bx] >= threshold) continue;
+          int px = bx * PIXEL_SIZE;
+          int py = by * PIXEL_SIZE;
+          oldDisplay.fillRect(px, py, PIXEL_SIZE, PIXEL_SIZE, 0);
+          for (int y = 0; y < PIXEL_SIZE; y++) {
+            for (int x = 0; x < PIXEL_SIZE; x++) {
+              if (bitAt(wat, px + x, py + y)) oldDisplay.drawPixel(px + x, py + y, 1);
+            }
+          }
+        }
+      }
+    }, [&]() {
+      maskReveal(mask, revealPixelated, threshold, offset);
+      blitMerge(newBuffer, pages, mask);
+    });
+    previous = threshold;
+  }
+  return result;
+}
+
+static Result slide(int repeats) {
+  const int STEPS = 16;
+  Result result;
+  result.delayMs = 30;
+  for (int direction = 0; direction < 2; direction++) {
+    for (int step = 0; step < STEPS; step++) {
+      int offset = direction == 0 ? W - (step + 1) * (W / STEPS) : -W + (step + 1) * (W / STEPS);
+      frame(result, repeats, [&]() {
+        oldDisplay.clearDisplay();
+        oldDisplay.drawBitmap(offset, 0, wat, W, H, 1);
+      }, [&]() {
+        blitShift(newBuffer, pages, offset);
+      });
+    }
+  }
+  return result;
+}
+
+static Result fade(int repeats) {
+  const int STEPS = 8;
+  Result result;
+  result.delayMs = 60;
+  oldDisplay.clearDisplay();
+  for (int step = 0; step < STEPS; step++) {
+    int threshold = revealThreshold(revealFade, step, STEPS);
+    frame(result, repeats, [&]() {
+      for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+          // 8x8 Bayer rank: the bits of (x ^ y, y) interleaved and reversed
+          int rank = 0;
+          for (int bit = 0; bit < 3; bit++) {
+            int pair = (((x >> bit) ^ (y >> bit)) & 1) << 1 | ((y >> bit) & 1);
+            rank |= pair << (2 * (2 - bit));
+          }
+          if (rank < threshold) oldDisplay.drawPixel(x, y, bitAt(wat, x, y));
+        }
+      }
+    }, [&]() {
+      maskReveal(mask, revealFade, threshold);
+      blitMerge(newBuffer, pages, mask);
+    });
+  }
+  return result;
+}
+
+static Result wipe(int repeats) {
+  const int STEPS = 20;
+  Result result;
+  result.delayMs = 40;
+  for (int vertical = 0; vertical < 2; vertical++) {
+    for (int step = 0; step <= STEPS; step++) {
+      int reveal = ((vertical ? H : W) * step) / STEPS;
+      frame(result, repeats, [&]() {
+        oldDisplay.clearDisplay();
+        for (int y = 0; y < (vertical ? reveal : H); y++) {
+          for (int x = 0; x < (vertical ? W : reveal); x++) {
+            if (bitAt(wat, x, y)) oldDisplay.drawPixel(x, y, 1);
+          }
+        }
+      }, [&]() {
+        memset(newBuffer, 0, BLIT_BUFFER_SIZE);
+        if (vertical) blitRows(newBuffer, pages, 0, reveal);
+        else blitColumns(newBuffer, pages, 0, reveal);
+      });
+    }
+  }
+  return result;
+}
+
+static Result spiral(int repeats) {
+  const int STEPS = 18;
+  const int centerX = W / 2;
+  const int centerY = H / 2;
+  Result result;
+  result.delayMs = 50;
+  for (int step = 0; step < STEPS; step++) {
+    int radius = revealThreshold(revealSpiral, step, STEPS) - 1;
+    frame(result, repeats, [&]() {
+      oldDisplay.clearDisplay();
+      for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+          int dx = x - centerX;
+          int dy = y - centerY;
+          int distance = sqrt(dx * dx + dy * dy);
+          if (distance <= radius && bitAt(wat, x, y)) oldDisplay.drawPixel(x, y, 1);
+        }
+      }
+    }, [&]() {
+      memset(newBuffer, 0, BLIT_BUFFER_SIZE);
+      maskReveal(mask, revealSpiral, radius + 1);
+      blitAnd(newBuffer, pages, mask);
+    });
+  }
+  return result;
+}
+
+// Revealed over the previous frame, in the order rank(x, y) gives
+template <typename Rank>
+static Result reveal(int repeats, const RevealMap& map, int steps, uint8_t offset, Rank rank) {
+  Result result;
+  result.delayMs = 40;
+  oldDisplay.clearDisplay();
+  for (int step = 0; step < steps; step++) {
+    int threshold = revealThreshold(map, step, steps);
+    frame(result, repeats, [&]() {
+      for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+          if ((uint8_t)(rank(x, y) + offset) < threshold) oldDisplay.drawPixel(x, y, bitAt(wat, x, y));
+        }
+      }
+    }, [&]() {
+      maskReveal(mask, map, threshold, offset);
+      blitMerge(newBuffer, pages, mask);
+    });
+  }
+  return result;
+}
+
+static Result diamond(int repeats) {
+  return reveal(repeats, revealDiamond, 16, 0, [](int x, int y) {
+    return (int)(fabs(x + 0.5 - W / 2) + fabs(y + 0.5 - H / 2));
+  });
+}
+
+static Result sweep(int repeats) {
+  return reveal(repeats, revealSweep, 20, 200, [](int x, int y) {
+    double angle = atan2(x + 0.5 - W / 2, H / 2 - (y + 0.5));
+    if (angle < 0) angle += 2 * M_PI;
+    return (int)(angle / (2 * M_PI) * 256) % 256;
+  });
+}
+
+#define TRANSITIONS 7
+static Result results[TRANSITIONS];
+static long transactionsPer[TRANSITIONS];
+static const char* names[TRANSITIONS] = {"pixelated", "slide", "fade", "wipe", "spiral", "diamond", "sweep"};
+
+// Frames per second with the transition's delay, compute and transfer
+static double fps(const Result& r, double transferPerFrameUs) {
+  return 1e6 / (r.delayMs * 1000.0 + r.newNs / r.frames / 1000.0 + transferPerFrameUs);
+}
+
+static void reportBus() {
+  printf("\n%-10s %8s %8s %14s %14s %14s\n", "transition", "bytes", "windows", "full 400k fps",
+         "part 400k fps", "part 1M fps");
+  for (int i = 0; i < TRANSITIONS; i++) {
+    const Result& r = results[i];
+    long transactions = transactionsPer[i];
+    double partial400 = transferUs(r.partialBytes + 7L * r.windows, transactions, 400000) / r.frames;
+    double partial1M = transferUs(r.partialBytes + 7L * r.windows, transactions, 1000000) / r.frames;
+    printf("%-10s %8ld %8.1f %14.1f %14.1f %14.1f\n", names[i], r.partialBytes / r.frames,
+           (double)r.windows / r.frames, fps(r, fullFrameUs(400000)), fps(r, partial400), fps(r, partial1M));
+  }
+  printf("(bytes and windows per frame; a full frame is %d bytes, %.1f ms at 400 kHz)\n",
+         BLIT_BUFFER_SIZE, fullFrameUs(400000) / 1000.0);
+}
+
+// The hand-off in displayAsync(): the 1 KB copy to the front buffer, the
+// semaphores and two task switches
+#define ASYNC_HANDOFF_US 20
+
+// Unpaced run of a transition through the pipeline, in microseconds
+static double serialUs(const Result& r, double cpuScale) {
+  double total = 0;
+  for (size_t i = 0; i < r.renderNs.size(); i++) {
+    total += r.renderNs[i] * cpuScale / 1000.0 + r.transfer1MUs[i];
+  }
+  return total;
+}
+
+static double pipelinedUs(const Result& r, double cpuScale) {
+  double rendered = 0;      // When the current frame finishes rendering
+  double sent = 0;          // When the previous frame's transfer finishes
+  for (size_t i = 0; i < r.renderNs.size(); i++) {
+    rendered += r.renderNs[i] * cpuScale / 1000.0;
+    double handoff = rendered > sent ? rendered : sent;   // Waits for the front buffer
+    sent = handoff + ASYNC_HANDOFF_US + r.transfer1MUs[i];
+    rendered = handoff + ASYNC_HANDOFF_US;                // The next frame starts rendering
+  }
+  return sent;
+}
+
+static void reportPipeline(double cpuScale) {
+  printf("\n%-10s %10s %12s %9s %10s %6s %12s %12s\n", "transition", "render us", "transfer us", "sync fps",
+         "async fps", "gain", "sync loop %", "async loop %");
+  for (int i = 0; i < TRANSITIONS; i++) {
+    const Result& r = results[i];
+    double render = r.newNs * cpuScale / 1000.0 / r.frames;
+    double transfer = 0;
+    for (double t : r.transfer1MUs) transfer += t;
+    double sync = r.frames * 1e6 / serialUs(r, cpuScale);
+    double async = r.frames * 1e6 / pipelinedUs(r, cpuScale);
+    // Paced at the firmware's 25 fps, the share of each 40 ms frame the loop spends on it
+    double syncLoop = (render + transfer / r.frames) / 400.0;
+    double asyncLoop = (render + ASYNC_HANDOFF_US) / 400.0;
+    printf("%-10s %10.1f %12.1f %9.1f %10.1f %5.0f%% %11.1f%% %11.1f%%\n", names[i], render, transfer / r.frames,
+           sync, async, (async / sync - 1) * 100, syncLoop, asyncLoop);
+  }
+  printf("(per frame at 1 MHz: fps unpaced, loop share paced at 25 fps; render times are host\n"
+         " times x %.0f for the C3)\n", cpuScale);
+}
+
+static bool report(const char* name, const Result& r) {
+  double oldUs = r.oldNs / r.frames / 1000.0;
+  double newUs = r.newNs / r.frames / 1000.0;
+  printf("%-10s %6d %12.2f %12.2f %9.1fx  %s\n", name, r.frames, oldUs, newUs, oldUs / newUs,
+         r.match ? "match" : "MISMATCH");
+  return r.match;
+}
+
+int main(int argc, char** argv) {
+  int repeats = argc > 1 ? atoi(argv[1]) : 200;
+  double cpuScale = argc > 2 ? atof(argv[2]) : 40;
+
+  for (int y = 0; y < H; y++) {
+    for (int x = 0; x < W; x++) {
+      if (watPages[(y / 8) * W + x] & (1 << (y & 7))) wat[(y * W + x) / 8] |= 0x80 >> (x % 8);
+    }
+  }
+
+  // A full-screen draw: drawBitmap() against copying the generated image
+  auto start = Clock::now();
+  for (int i = 0; i < repeats; i++) {
+    oldDisplay.clearDisplay();
+    oldDisplay.drawBitmap(0, 0, wat, W, H, 1);
+  }
+  double drawUs = elapsedNs(start) / repeats / 1000.0;
+  start = Clock::now();
+  for (int i = 0; i < repeats; i++) blitImage(pages, watPages);
+  double copyUs = elapsedNs(start) / repeats / 1000.0;
+  bool ok = memcmp(oldDisplay.buffer, pages, BLIT_BUFFER_SIZE) == 0;
+
+  // Row-major sources still convert once per image
+  start = Clock::now();
+  for (int i = 0; i < repeats; i++) blitToPages(wat, pages);
+  double convertUs = elapsedNs(start) / repeats / 1000.0;
+  ok &= memcmp(watPages, pages, BLIT_BUFFER_SIZE) == 0;
+
+  printf("full-screen image: drawBitmap %.2f us, blitImage %.2f us (%.0fx), blitToPages %.2f us, %s\n\n",
+         drawUs, copyUs, drawUs / copyUs, convertUs, ok ? "match" : "MISMATCH");
+
+  printf("%-10s %6s %12s %12s %10s\n", "transition", "frames", "pixel us", "blit us", "speedup");
+  Result (*transitions[])(int) = {pixelated, slide, fade, wipe, spiral, diamond, sweep};
+  for (int i = 0; i < TRANSITIONS; i++) {
+    long before = partialTransactions;
+    results[i] = transitions[i](repeats);
+    transactionsPer[i] = partialTransactions - before;
+    ok &= report(names[i], results[i]);
+  }
+  reportBus();
+  reportPipeline(cpuScale);
+  return ok ? 0 : 1;
+}
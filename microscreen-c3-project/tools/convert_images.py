@@ -0,0 +1,274 @@
+"""
+Converts images/memes/*.png into SSD1306 page-format headers
+
+Each PNG is centered on a 128x64 canvas (cropped if larger), composited
+over its background, reduced to luminance, dithered to 1 bit and written
+as images/bmp/<name>.h
+in the display buffer's own layout: one byte per column per 8-row page,
+bit 0 on top. Drawing a meme is then a 1 KB memcpy into
+display.getBuffer(). images/bmp/all.h gets the arrays and the memes[]
+table the firmware cycles through, in file name order.
+
+Per-image settings go in images/memes/images.json, keyed by file name
+without the extension; anything left out takes the defaults below:
+
+    {"smudge": {"background": "black", "dither": "none", "threshold": 100, "title": "Smudge"}}
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and
+only rewrites files whose contents change. It can also be run by hand:
+
+    python3 tools/convert_images.py [--dither atkinson|floyd|none] [--threshold 128] [--background white|black]
+
+Needs only the Python standard library, so it runs inside PlatformIO's
+own interpreter.
+"""
+
+import argparse
+import json
+import math
+import os
+import struct
+import zlib
+
+WIDTH = 128
+HEIGHT = 64
+
+# Matches image2cpp, which the old headers came from
+DEFAULT_DITHER = "atkinson"
+DEFAULT_THRESHOLD = 128
+DEFAULT_BACKGROUND = "white"          # Shows through transparent pixels
+
+
+def read_png(path):
+    """Returns (width, height, rows of (r, g, b, a) tuples)"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG" % path)
+
+    pos = 8
+    idat = b""
+    palette = None
+    transparency = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            transparency = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    if interlace:
+        raise ValueError("%s: interlaced PNGs are not supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits_per_pixel = channels * depth
+    stride = (width * bits_per_pixel + 7) // 8
+    step = max(1, bits_per_pixel // 8)
+    raw = zlib.decompress(idat)
+
+    rows = []
+    previous = bytearray(stride)
+    offset = 0
+    for _ in range(height):
+        kind = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        offset += 1 + stride
+        for i in range(stride):
+            left = line[i - step] if i >= step else 0
+            up = previous[i]
+            corner = previous[i - step] if i >= step else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (left + up) // 2) & 0xFF
+            elif kind == 4:
+                p = left + up - corner
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - corner)
+                predictor = left if pa <= pb and pa <= pc else up if pb <= pc else corner
+                line[i] = (line[i] + predictor) & 0xFF
+        rows.append(_unpack_row(line, width, depth, color, palette, transparency))
+        previous = line
+    return width, height, rows
+
+
+def _unpack_row(line, width, depth, color, palette, transparency):
+    if depth < 8:
+        per_byte = 8 // depth
+        mask = (1 << depth) - 1
+        samples = [(line[x // per_byte] >> (8 - depth * (x % per_byte + 1))) & mask for x in range(width)]
+    elif depth == 8:
+        samples = list(line)
+    else:
+        samples = [line[i] for i in range(0, len(line), 2)]  # High byte of 16-bit samples
+
+    if color == 3:
+        alphas = transparency or b""
+        return [palette[i] + ((alphas[i] if i < len(alphas) else 255),) for i in samples[:width]]
+
+    scale = 255 // ((1 << depth) - 1) if depth < 8 else 1
+    pixels = []
+    for x in range(width):
+        if color == 0:
+            v = samples[x] * scale
+            pixels.append((v, v, v, 255))
+        elif color == 4:
+            v = samples[2 * x]
+            pixels.append((v, v, v, samples[2 * x + 1]))
+        elif color == 2:
+            pixels.append(tuple(samples[3 * x:3 * x + 3]) + (255,))
+        else:
+            pixels.append(tuple(samples[4 * x:4 * x + 4]))
+    return pixels
+
+
+def to_luminance(width, height, rows, background):
+    """Centers the image on a panel-sized canvas; returns WIDTH * HEIGHT grey levels"""
+    fill = 255 if background == "white" else 0
+    left = (width - WIDTH) // 2
+    top = (height - HEIGHT) // 2
+    grey = []
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            sx, sy = x + left, y + top
+            if 0 <= sx < width and 0 <= sy < height:
+                r, g, b, a = rows[sy][sx]
+                r, g, b = [(v * a + fill * (255 - a)) // 255 for v in (r, g, b)]
+                grey.append(int(r * 0.3 + g * 0.59 + b * 0.11))
+            else:
+                grey.append(fill)
+    return grey
+
+
+def dither(grey, mode, threshold):
+    """Returns WIDTH * HEIGHT bits, 1 for a lit pixel"""
+    spread = {
+        "floyd": (16, ((1, 7), (WIDTH - 1, 3), (WIDTH, 5), (WIDTH + 1, 1))),
+        "atkinson": (8, ((1, 1), (2, 1), (WIDTH - 1, 1), (WIDTH, 1), (WIDTH + 1, 1), (2 * WIDTH, 1))),
+        "none": (1, ()),
+    }[mode]
+    divisor, taps = spread
+    grey = list(grey)
+    count = len(grey)
+    bits = []
+    for i in range(count):
+        value = 255 if grey[i] > threshold else 0
+        error = math.floor((grey[i] - value) / divisor)
+        for offset, weight in taps:
+            if i + offset < count:
+                grey[i + offset] = min(255, max(0, grey[i + offset] + error * weight))
+        bits.append(1 if value else 0)
+    return bits
+
+
+def to_pages(bits):
+    pages = bytearray(WIDTH * HEIGHT // 8)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if bits[y * WIDTH + x]:
+                pages[(y // 8) * WIDTH + x] |= 1 << (y & 7)
+    return pages
+
+
+def image_header(name, source, pages):
+    lines = ["// '%s', %dx%dpx, SSD1306 page format" % (name, WIDTH, HEIGHT),
+             "// Generated by tools/convert_images.py from %s - do not edit" % source]
+    for i in range(0, len(pages), 16):
+        lines.append(", ".join("0x%02x" % b for b in pages[i:i + 16]) + ", ")
+    return "\n".join(lines) + "\n"
+
+
+def all_header(names, titles):
+    out = ["// Generated by tools/convert_images.py from images/memes/*.png - do not edit",
+           "#pragma once",
+           "#include <Arduino.h>  // for PROGMEM on ESP32",
+           "",
+           "// Images are in the SSD1306 buffer's page format: one byte per column per",
+           "// 8-row page, bit 0 on top. Word aligned for the blit kernels.",
+           ""]
+    for name in names:
+        out += ["alignas(4) static const unsigned char %s[] PROGMEM = {" % name,
+                '#include "%s.h"' % name,
+                "};",
+                ""]
+    out += ["// Structure to hold bitmap info for panels",
+            "struct BitmapInfo {",
+            "  const unsigned char* pages; // Page-format image, %d bytes" % (WIDTH * HEIGHT // 8),
+            "  uint16_t width;",
+            "  uint16_t height;",
+            "  const char* title;          // For serial logging",
+            "};",
+            "",
+            "// Array of bitmap info for easy panel cycling",
+            "static const BitmapInfo memes[] = {"]
+    for i, name in enumerate(names):
+        out.append('    {%s, %d, %d, "%s"}%s' % (name, WIDTH, HEIGHT, titles[i], "," if i < len(names) - 1 else ""))
+    out += ["};",
+            "",
+            "#define MEME_IMAGE_COUNT %d" % len(names),
+            ""]
+    return "\n".join(out)
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return False
+    with open(path, "w") as f:
+        f.write(text)
+    return True
+
+
+def convert(project_dir, defaults):
+    source_dir = os.path.join(project_dir, "images", "memes")
+    out_dir = os.path.join(project_dir, "images", "bmp")
+    names = sorted(f[:-4] for f in os.listdir(source_dir) if f.lower().endswith(".png"))
+
+    settings = {}
+    manifest = os.path.join(source_dir, "images.json")
+    if os.path.exists(manifest):
+        with open(manifest) as f:
+            settings = json.load(f)
+
+    written = 0
+    titles = []
+    for name in names:
+        options = dict(defaults, title=name[:1].upper() + name[1:])
+        options.update(settings.get(name, {}))
+        titles.append(options["title"])
+
+        width, height, rows = read_png(os.path.join(source_dir, name + ".png"))
+        grey = to_luminance(width, height, rows, options["background"])
+        pages = to_pages(dither(grey, options["dither"], options["threshold"]))
+        header = image_header(name, "images/memes/%s.png" % name, pages)
+        written += write_if_changed(os.path.join(out_dir, name + ".h"), header)
+    written += write_if_changed(os.path.join(out_dir, "all.h"), all_header(names, titles))
+    print("convert_images: %d images, %d files updated" % (len(names), written))
+
+
+try:
+    Import("env")  # noqa: F821 - defined when PlatformIO runs this as an extra script
+except NameError:
+    env = None
+
+DEFAULTS = {"dither": DEFAULT_DITHER, "threshold": DEFAULT_THRESHOLD, "background": DEFAULT_BACKGROUND}
+
+if env is not None:
+    convert(env["PROJECT_DIR"], DEFAULTS)
+elif __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--dither", choices=("atkinson", "floyd", "none"), default=DEFAULT_DITHER)
+    parser.add_argument("--threshold", type=int, default=DEFAULT_THRESHOLD)
+    parser.add_argument("--background", choices=("white", "black"), default=DEFAULT_BACKGROUND)
+    args = parser.parse_args()
+    convert(os.path.dirname(os.path.dirname(os.path.abspath(__file__))),
+            {"dither": args.dither, "threshold": args.threshold, "background": args.background})
@@ -0,0 +1,151 @@
+"""
+Generates include/reveal_maps.h, the reveal orders of the map-driven transitions
+
+A reveal map gives every cell of the screen a rank, and a transition frame
+shows the cells ranked below a threshold that rises from frame to frame
+(maskReveal() in include/blit.h). Working the order out here means no
+square roots, angles or shuffles at runtime: a frame is a threshold compare
+per cell whatever the shape of the effect.
+
+Ranks are stored in the panel's page order at the map's cell size, so
+maskReveal() builds each mask byte from consecutive ranks:
+
+    index = (page * cellsX + cellX) * rowsPerPage + rowInPage
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and
+only rewrites the header when it changes. It can also be run by hand:
+
+    python3 tools/gen_reveal_maps.py
+
+Needs only the Python standard library, so it runs inside PlatformIO's
+own interpreter.
+"""
+
+import math
+import os
+import random
+
+WIDTH = 128
+HEIGHT = 64
+
+# The shuffled orders are fixed here; the firmware rotates them by a random
+# offset per transition so consecutive runs still differ
+SEED = 0x5EED
+
+
+def spiral(x, y):
+    # Distance from (64, 32) truncated, as the old per-pixel loop had it
+    dx = x - WIDTH // 2
+    dy = y - HEIGHT // 2
+    d2 = dx * dx + dy * dy
+    d = int(math.sqrt(d2))
+    while d * d > d2:
+        d -= 1
+    while (d + 1) * (d + 1) <= d2:
+        d += 1
+    return d
+
+
+def diamond(x, y):
+    return int(abs(x + 0.5 - WIDTH / 2) + abs(y + 0.5 - HEIGHT / 2))
+
+
+def sweep(x, y):
+    # Clockwise from 12 o'clock in 256ths of a turn
+    angle = math.atan2(x + 0.5 - WIDTH / 2, HEIGHT / 2 - (y + 0.5))
+    return int(angle % (2 * math.pi) / (2 * math.pi) * 256) % 256
+
+
+def bayer(x, y):
+    # 8x8 ordered dither: each level adds one pixel per tile, spread evenly
+    rank = 0
+    for bit in range(3):
+        xb = (x >> bit) & 1
+        yb = (y >> bit) & 1
+        rank |= ((xb ^ yb) << 1 | yb) << (2 * (2 - bit))
+    return rank
+
+
+def shuffled(cells_x, cells_y, levels, rng):
+    """A random order of every cell, spread evenly over the levels"""
+    order = list(range(cells_x * cells_y))
+    rng.shuffle(order)
+    ranks = [0] * len(order)
+    for position, cell in enumerate(order):
+        ranks[cell] = position * levels // len(order)
+    return lambda cx, cy: ranks[cy * cells_x + cx]
+
+
+def page_order(rank, cell_shift):
+    cells_x = WIDTH >> cell_shift
+    rows_per_page = 8 >> cell_shift
+    out = []
+    for page in range(HEIGHT // 8):
+        for cx in range(cells_x):
+            for row in range(rows_per_page):
+                out.append(rank(cx, page * rows_per_page + row))
+    return out
+
+
+def maps():
+    rng = random.Random(SEED)
+    pixel = 0
+    block = 2  # PIXELATED_BLOCK_SIZE in include/transition.h
+    return [
+        ("revealSpiral", "Distance from the center", pixel, spiral),
+        ("revealDiamond", "Distance from the center along the axes", pixel, diamond),
+        ("revealSweep", "Angle around the center, clockwise from the top", pixel, sweep),
+        ("revealFade", "8x8 ordered dither, 64 levels", pixel, bayer),
+        ("revealDissolve", "Every pixel in random order", pixel,
+         shuffled(WIDTH, HEIGHT, 256, rng)),
+        ("revealPixelated", "4x4 blocks in random order", block,
+         shuffled(WIDTH >> block, HEIGHT >> block, 256, rng)),
+    ]
+
+
+def header():
+    out = ["// Generated by tools/gen_reveal_maps.py - do not edit",
+           "#pragma once",
+           '#include "blit.h"',
+           "",
+           "// Reveal orders for maskReveal(), ranks in page order at each map's cell",
+           "// size. Plain const data stays in flash on the ESP32.",
+           ""]
+    for name, comment, shift, rank in maps():
+        ranks = page_order(rank, shift)
+        levels = max(ranks) + 1
+        out.append("// %s" % comment)
+        out.append("alignas(4) static const uint8_t %sRanks[] = {" % name)
+        for i in range(0, len(ranks), 16):
+            out.append(", ".join("%d" % r for r in ranks[i:i + 16]) + ",")
+        out.append("};")
+        out.append("static const RevealMap %s = {%sRanks, %d, %d};" % (name, name, shift, levels))
+        out.append("")
+    return "\n".join(out)
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return False
+    with open(path, "w") as f:
+        f.write(text)
+    return True
+
+
+def generate(project_dir):
+    path = os.path.join(project_dir, "include", "reveal_maps.h")
+    written = write_if_changed(path, header())
+    print("gen_reveal_maps: %s" % ("include/reveal_maps.h updated" if written else "up to date"))
+
+
+try:
+    Import("env")  # noqa: F821 - defined when PlatformIO runs this as an extra script
+except NameError:
+    env = None
+
+if env is not None:
+    generate(env["PROJECT_DIR"])
+elif __name__ == "__main__":
+    generate(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
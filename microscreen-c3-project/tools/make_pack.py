@@ -0,0 +1,219 @@
+"""
+Builds, checks and lists meme asset packs for LittleFS
+
+A pack holds page-format images with an index in front; the layout is
+described in include/asset_pack.h. Images are converted exactly as
+tools/convert_images.py converts the built-in memes, including settings
+from an images.json beside the PNGs, then stored raw or PackBits encoded,
+whichever is smaller.
+
+    python3 tools/make_pack.py build my.pack images/new/*.png [--title cat=Cat] [--dither floyd]
+    python3 tools/make_pack.py check my.pack
+    python3 tools/make_pack.py list my.pack
+
+Upload a pack to a running device (it validates it again before storing):
+
+    curl -F "pack=@my.pack" http://<device>/packs
+
+or copy it to data/packs/ and run `pio run -e esp32c3_serial -t uploadfs`.
+"""
+
+import argparse
+import json
+import os
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import convert_images  # noqa: E402 - shares the PNG decoder and dithering
+
+MAGIC = b"MSPK"
+VERSION = 1
+WIDTH = convert_images.WIDTH
+HEIGHT = convert_images.HEIGHT
+IMAGE_BYTES = WIDTH * HEIGHT // 8
+TITLE_LENGTH = 20           # Including the terminating NUL
+MAX_IMAGES = 48             # ASSET_LIBRARY_MAX_IMAGES
+MAX_SIZE = 65536            # ASSET_PACK_MAX_SIZE
+
+HEADER = struct.Struct("<4sBBHHHI")
+ENTRY = struct.Struct("<%dsIHBBI" % TITLE_LENGTH)
+RAW, RLE = 0, 1
+
+
+def packbits(data):
+    """Runs of 3 or more as (257 - n, byte), everything else as literals"""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            out += bytes((257 - run, data[i]))
+            i += run
+            continue
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
+
+
+def unpackbits(data):
+    """As the firmware's RleDecoder; raises ValueError on a malformed stream"""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        n = data[i]
+        i += 1
+        if n < 128:
+            if i + n + 1 > len(data):
+                raise ValueError("literal run past the end")
+            out += data[i:i + n + 1]
+            i += n + 1
+        elif n > 128:
+            if i >= len(data):
+                raise ValueError("repeat run past the end")
+            out += bytes([data[i]]) * (257 - n)
+            i += 1
+        if len(out) > IMAGE_BYTES:
+            raise ValueError("decodes past %d bytes" % IMAGE_BYTES)
+    if len(out) != IMAGE_BYTES:
+        raise ValueError("decodes to %d bytes, not %d" % (len(out), IMAGE_BYTES))
+    return bytes(out)
+
+
+def build(images):
+    """images: list of (title, page-format bytes); returns the pack"""
+    if not 0 < len(images) <= MAX_IMAGES:
+        raise ValueError("a pack holds 1 to %d images" % MAX_IMAGES)
+    offset = HEADER.size + ENTRY.size * len(images)
+    index = b""
+    data = b""
+    for title, pages in images:
+        encoded = packbits(pages)
+        encoding = RLE if len(encoded) < len(pages) else RAW
+        stored = encoded if encoding == RLE else bytes(pages)
+        name = title.encode("utf-8")[:TITLE_LENGTH - 1]
+        index += ENTRY.pack(name, offset + len(data), len(stored), encoding, 0, zlib.crc32(bytes(pages)))
+        data += stored
+    header = HEADER.pack(MAGIC, VERSION, 0, len(images), WIDTH, HEIGHT, zlib.crc32(index))
+    pack = header + index + data
+    if len(pack) > MAX_SIZE:
+        raise ValueError("pack is %d bytes, the device takes at most %d" % (len(pack), MAX_SIZE))
+    return pack
+
+
+def read(pack):
+    """Checks a pack as the firmware does; returns [(title, encoding, stored size, pages)]"""
+    if len(pack) < HEADER.size:
+        raise ValueError("too short for a header")
+    magic, version, _, count, width, height, index_crc = HEADER.unpack_from(pack)
+    if magic != MAGIC:
+        raise ValueError("not an asset pack")
+    if version != VERSION:
+        raise ValueError("unsupported version %d" % version)
+    if (width, height) != (WIDTH, HEIGHT):
+        raise ValueError("images are %dx%d, not %dx%d" % (width, height, WIDTH, HEIGHT))
+    if not 0 < count <= MAX_IMAGES:
+        raise ValueError("image count %d out of range" % count)
+    index = pack[HEADER.size:HEADER.size + ENTRY.size * count]
+    if len(index) != ENTRY.size * count:
+        raise ValueError("index truncated")
+    if zlib.crc32(index) != index_crc:
+        raise ValueError("index CRC mismatch")
+
+    images = []
+    for i in range(count):
+        name, offset, size, encoding, _, crc = ENTRY.unpack_from(index, i * ENTRY.size)
+        if b"\0" not in name:
+            raise ValueError("entry %d: title not terminated" % i)
+        title = name.split(b"\0")[0].decode("utf-8", "replace")
+        if offset + size > len(pack):
+            raise ValueError("entry %d (%s): data past the end of the pack" % (i, title))
+        stored = pack[offset:offset + size]
+        if encoding == RAW:
+            if size != IMAGE_BYTES:
+                raise ValueError("entry %d (%s): raw image of %d bytes" % (i, title, size))
+            pages = stored
+        elif encoding == RLE:
+            try:
+                pages = unpackbits(stored)
+            except ValueError as e:
+                raise ValueError("entry %d (%s): %s" % (i, title, e))
+        else:
+            raise ValueError("entry %d (%s): unknown encoding %d" % (i, title, encoding))
+        if zlib.crc32(pages) != crc:
+            raise ValueError("entry %d (%s): CRC mismatch" % (i, title))
+        images.append((title, encoding, size, pages))
+    return images
+
+
+def settings(directory):
+    """Per-image settings from an images.json beside the PNGs, as convert_images.py reads them"""
+    manifest = os.path.join(directory, "images.json")
+    if not os.path.exists(manifest):
+        return {}
+    with open(manifest) as f:
+        return json.load(f)
+
+
+def convert(path, options):
+    width, height, rows = convert_images.read_png(path)
+    grey = convert_images.to_luminance(width, height, rows, options["background"])
+    return convert_images.to_pages(convert_images.dither(grey, options["dither"], options["threshold"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    build_args = commands.add_parser("build", help="convert PNGs into a pack")
+    build_args.add_argument("output")
+    build_args.add_argument("pngs", nargs="+")
+    build_args.add_argument("--title", action="append", default=[], metavar="NAME=TITLE",
+                            help="panel title for the PNG of that file name (default: capitalized name)")
+    build_args.add_argument("--dither", choices=("atkinson", "floyd", "none"), default=convert_images.DEFAULT_DITHER)
+    build_args.add_argument("--threshold", type=int, default=convert_images.DEFAULT_THRESHOLD)
+    build_args.add_argument("--background", choices=("white", "black"), default=convert_images.DEFAULT_BACKGROUND)
+
+    for name, text in (("check", "validate a pack"), ("list", "list a pack's images")):
+        commands.add_parser(name, help=text).add_argument("pack")
+    args = parser.parse_args()
+
+    try:
+        if args.command == "build":
+            titles = dict(t.split("=", 1) for t in args.title)
+            defaults = {"dither": args.dither, "threshold": args.threshold, "background": args.background}
+            images = []
+            for path in args.pngs:
+                name = os.path.splitext(os.path.basename(path))[0]
+                options = dict(defaults, title=name[:1].upper() + name[1:])
+                options.update(settings(os.path.dirname(path)).get(name, {}))
+                images.append((titles.get(name, options["title"]), convert(path, options)))
+            pack = build(images)
+            read(pack)
+            with open(args.output, "wb") as f:
+                f.write(pack)
+            print("%s: %d images, %d bytes (%d raw)" % (args.output, len(images), len(pack),
+                                                       HEADER.size + len(images) * (ENTRY.size + IMAGE_BYTES)))
+        else:
+            with open(args.pack, "rb") as f:
+                pack = f.read()
+            images = read(pack)
+            if args.command == "list":
+                for title, encoding, size, _ in images:
+                    print("%-20s %s %5d bytes" % (title, "rle" if encoding == RLE else "raw", size))
+            print("%s: OK, %d images, %d bytes" % (args.pack, len(images), len(pack)))
+    except (OSError, ValueError) as e:
+        print("make_pack: %s" % e, file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()